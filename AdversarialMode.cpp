@@ -0,0 +1,218 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "AdversarialMode.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <tuple>
+
+template<size_t L>
+BasicAdversarialMode<L>::BasicAdversarialMode(Display &display, BasicFeedback<L> &feedback_instance)
+    : display(display),
+      feedback(feedback_instance) {}
+
+template<size_t L>
+uint64_t BasicAdversarialMode<L>::hash_state(const State &state) {
+    uint64_t hash = 1469598103934665603ull;
+    for (uint32_t id : state) {
+        hash ^= id;
+        hash *= 1099511628211ull;
+    }
+    return hash ^ (state.size() << 48);
+}
+
+template<size_t L>
+std::vector<uint32_t> BasicAdversarialMode<L>::largest_buckets(const State &state) const {
+    std::vector<uint32_t> largest(guess_ids.size(), 0);
+    std::vector<uint32_t> counts(Traits::patterns, 0);
+
+    for (size_t g = 0; g < guess_ids.size(); ++g) {
+        const Pattern *row = feedback.row(guess_ids[g]);
+        for (uint32_t id : state) counts[row[id]]++;
+
+        // Read back and clear only the buckets this state touched
+        uint32_t max_count = 0;
+        for (uint32_t id : state) {
+            Pattern fb = row[id];
+            if (fb != Traits::solved) max_count = std::max(max_count, counts[fb]);
+            counts[fb] = 0;
+        }
+        largest[g] = max_count;
+    }
+    return largest;
+}
+
+template<size_t L>
+std::vector<uint32_t> BasicAdversarialMode<L>::ordered_guesses(const State &state, size_t limit) const {
+    std::vector<uint32_t> largest = largest_buckets(state);
+
+    std::vector<std::tuple<uint32_t, bool, uint32_t>> ranked;
+    ranked.reserve(guess_ids.size());
+    for (size_t g = 0; g < guess_ids.size(); ++g) {
+        bool candidate = std::binary_search(state.begin(), state.end(), guess_ids[g]);
+        ranked.emplace_back(largest[g], !candidate, guess_ids[g]);
+    }
+
+    limit = std::min(limit, ranked.size());
+    std::partial_sort(ranked.begin(), ranked.begin() + limit, ranked.end());
+
+    std::vector<uint32_t> ordered(limit);
+    for (size_t i = 0; i < limit; ++i) ordered[i] = std::get<2>(ranked[i]);
+    return ordered;
+}
+
+template<size_t L>
+std::vector<typename BasicAdversarialMode<L>::State> BasicAdversarialMode<L>::partition(
+    uint32_t guess, const State &state) const {
+    std::unordered_map<Pattern, State> buckets;
+    const Pattern *row = feedback.row(guess);
+    for (uint32_t id : state)
+        if (row[id] != Traits::solved) buckets[row[id]].push_back(id);
+
+    std::vector<State> out;
+    out.reserve(buckets.size());
+    for (auto &[fb, bucket] : buckets) out.push_back(std::move(bucket));
+    std::sort(out.begin(), out.end(), [](const State &a, const State &b) { return a.size() > b.size(); });
+    return out;
+}
+
+template<size_t L>
+bool BasicAdversarialMode<L>::solvable(const State &state, int turns) {
+    if (state.size() <= 1) return turns >= static_cast<int>(state.size());
+    if (turns < 2) return false;
+
+    uint64_t key = hash_state(state);
+    {
+        std::lock_guard<std::mutex> lock(memo_mutex);
+        auto it = memo.find(key);
+        if (it != memo.end()) {
+            if (turns >= it->second.upper) return true;
+            if (turns < it->second.lower) return false;
+        }
+    }
+
+    bool ok = false;
+    if (turns == 2) {
+        // Every unsolved bucket must be a single word, guessed next turn
+        for (uint32_t largest : largest_buckets(state))
+            if (largest <= 1) {
+                ok = true;
+                break;
+            }
+    } else {
+        for (uint32_t guess : ordered_guesses(state, kBeamWidth)) {
+            std::vector<State> buckets = partition(guess, state);
+            if (buckets.size() == 1 && buckets[0].size() == state.size()) continue;
+
+            // Largest buckets are the likeliest to fail, which cuts the guess off
+            bool all = true;
+            for (const State &bucket : buckets)
+                if (!solvable(bucket, turns - 1)) {
+                    all = false;
+                    break;
+                }
+            if (all) {
+                ok = true;
+                break;
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(memo_mutex);
+    Bounds &bounds = memo[key];
+    if (ok) bounds.upper = std::min(bounds.upper, turns);
+    else bounds.lower = std::max(bounds.lower, turns + 1);
+    return ok;
+}
+
+template<size_t L>
+std::pair<std::string, int> BasicAdversarialMode<L>::get_best_guess(
+    const std::vector<std::string> &guesses,
+    const std::vector<std::string> &solutions
+) {
+    // Bounds are only valid for the guess list they were searched with
+    std::vector<uint32_t> ids;
+    ids.reserve(guesses.size());
+    for (const auto &guess : guesses) {
+        long idx = feedback.index_of(guess);
+        if (idx >= 0) ids.push_back(static_cast<uint32_t>(idx));
+    }
+    if (ids != guess_ids) {
+        guess_ids = std::move(ids);
+        memo.clear();
+    }
+
+    State state;
+    for (const auto &solution : solutions) {
+        long idx = feedback.index_of(solution);
+        if (idx >= 0) state.push_back(static_cast<uint32_t>(idx));
+    }
+    std::sort(state.begin(), state.end());
+
+    const std::vector<std::string> &words = feedback.get_words();
+    if (state.empty() || guess_ids.empty()) return {"", 0};
+    if (state.size() == 1) return {words[state[0]], 1};
+
+    std::vector<uint32_t> ordered = ordered_guesses(state, kBeamWidth);
+    size_t n_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (int turns = 2; turns <= kMaxTurns; ++turns) {
+        // Earliest guess in order that finishes within turns, later ones stop once it is found
+        std::atomic<size_t> found(ordered.size());
+        ThreadPool pool(n_threads);
+        std::vector<std::future<void>> futures;
+        for (size_t i = 0; i < ordered.size(); ++i) {
+            futures.push_back(pool.enqueue([&, i]() {
+                if (found.load() < i) return;
+                std::vector<State> buckets = partition(ordered[i], state);
+                for (const State &bucket : buckets)
+                    if (found.load() < i || !solvable(bucket, turns - 1)) return;
+
+                size_t current = found.load();
+                while (i < current && !found.compare_exchange_weak(current, i)) {}
+            }));
+        }
+        for (auto &f : futures) f.get();
+
+        if (found.load() < ordered.size())
+            return {words[ordered[found.load()]], turns};
+    }
+
+    return {words[ordered[0]], 0};
+}
+
+template<size_t L>
+int BasicAdversarialMode<L>::run(std::vector<std::string> guesses, std::vector<std::string> solutions) {
+    size_t guess_count = 0;
+
+    while (!solutions.empty() && guess_count < 2 * kMaxTurns) {
+        auto [best_guess, turns] = get_best_guess(guesses, solutions);
+        if (best_guess.empty()) break;
+        guess_count++;
+
+        display.showOutput("Next Guess: " + display.word(best_guess) + " | Worst Case Turns: " +
+                           (turns > 0 ? std::to_string(turns) : "over " + std::to_string(kMaxTurns)));
+
+        // The adversary keeps the largest bucket, the one with the lowest pattern among equals
+        std::vector<uint32_t> counts(Traits::patterns, 0);
+        for (const auto &solution : solutions)
+            counts[feedback.get_feedback_cached(best_guess, solution)]++;
+        auto kept = static_cast<Pattern>(std::max_element(counts.begin(), counts.end()) - counts.begin());
+
+        display.showOutput("Feedback: " + pattern_string(kept, L) + " | Remaining: " + std::to_string(counts[kept]));
+        if (kept == Traits::solved) {
+            display.showOutput("Solution found in " + std::to_string(guess_count) + " guesses: " + display.word(best_guess));
+            return static_cast<int>(guess_count);
+        }
+        solutions = feedback.get_new_solutions(solutions, best_guess, kept);
+    }
+
+    display.showOutput("No solution found.\n");
+    return -1;
+}
+
+WORDLE_SOLVED_INSTANTIATE(BasicAdversarialMode)
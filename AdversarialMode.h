@@ -0,0 +1,76 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_ADVERSARIALMODE_H
+#define WORDLE_SOLVED_ADVERSARIALMODE_H
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Display.h"
+#include "Feedback.h"
+#include "WordTraits.h"
+
+
+// Absurdle, where the game has no fixed answer and keeps the largest bucket of candidates
+// after every guess. Guesses are chosen by minimax over feedback patterns to minimise the
+// worst case number of turns, by iterative deepening on "every bucket can be finished within
+// t - 1 turns". Buckets are tried largest first so a failing one cuts the guess off early,
+// and the guesses tried at each state are the ones with the smallest largest bucket.
+template<size_t L>
+class BasicAdversarialMode {
+public:
+    using Traits = WordTraits<L>;
+    using Pattern = typename Traits::Pattern;
+    using State = std::vector<uint32_t>;
+
+    static constexpr int kMaxTurns = 8;
+    static constexpr size_t kBeamWidth = 24;
+
+private:
+    Display &display;
+    BasicFeedback<L> &feedback;
+    std::vector<uint32_t> guess_ids;
+
+    // Turns known to suffice (upper) and known not to suffice (below lower) per state
+    struct Bounds {
+        int lower = 1;
+        int upper = kMaxTurns + 1;
+    };
+    std::mutex memo_mutex;
+    std::unordered_map<uint64_t, Bounds> memo;
+
+    static uint64_t hash_state(const State &state);
+
+    // Largest bucket of every guess over state, ignoring the solved bucket
+    std::vector<uint32_t> largest_buckets(const State &state) const;
+
+    // Guesses in order of their largest bucket, candidates first among equals
+    std::vector<uint32_t> ordered_guesses(const State &state, size_t limit) const;
+
+    // Unsolved buckets of guess over state, largest first
+    std::vector<State> partition(uint32_t guess, const State &state) const;
+
+    // Whether every answer in state can be found within turns guesses, whatever the feedback
+    bool solvable(const State &state, int turns);
+
+public:
+    BasicAdversarialMode(Display &display, BasicFeedback<L> &feedback_instance);
+
+    // Guess minimising the worst case number of turns over solutions, and that number.
+    // Returns 0 turns if no guess within the search limits finishes in kMaxTurns.
+    std::pair<std::string, int> get_best_guess(const std::vector<std::string> &guesses,
+                                               const std::vector<std::string> &solutions);
+
+    // Play against the largest bucket adversary, returns the guesses used or -1
+    int run(std::vector<std::string> guesses, std::vector<std::string> solutions);
+};
+
+using AdversarialMode = BasicAdversarialMode<5>;
+
+
+#endif //WORDLE_SOLVED_ADVERSARIALMODE_H
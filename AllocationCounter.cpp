@@ -0,0 +1,19 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "AllocationCounter.h"
+#include <atomic>
+
+namespace {
+    std::atomic<size_t (*)()> counter{nullptr};
+}
+
+void AllocationCounter::set_counter(size_t (*thread_counter)()) {counter.store(thread_counter);}
+
+bool AllocationCounter::enabled() {return counter.load() != nullptr;}
+
+size_t AllocationCounter::thread_allocations() {
+    size_t (*thread_counter)() = counter.load();
+    return thread_counter ? thread_counter() : 0;
+}
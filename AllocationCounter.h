@@ -0,0 +1,34 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_ALLOCATIONCOUNTER_H
+#define WORDLE_SOLVED_ALLOCATIONCOUNTER_H
+#pragma once
+#include <cstddef>
+#include "Arena.h"
+
+
+// Heap allocations per thread, for checking that scoring stays off the heap. Builds configured
+// with WORDLE_SOLVED_COUNT_ALLOCATIONS link AllocationHook.cpp into the wordle_solved executable,
+// which replaces the global operator new and registers its counter here; the libraries never
+// replace it, so without the hook they can only see how often an arena grew.
+class AllocationCounter {
+public:
+    // Per-thread operator new count of the program, set once by AllocationHook.cpp
+    static void set_counter(size_t (*thread_counter)());
+
+    // Whether operator new is counted in this program
+    static bool enabled();
+
+    // operator new calls made by the calling thread so far, 0 when not enabled
+    static size_t thread_allocations();
+
+    // Every allocation of the calling thread when counted, otherwise the growth of arena
+    static size_t allocations(const Arena &arena) {
+        return enabled() ? thread_allocations() : arena.heap_allocations();
+    }
+};
+
+
+#endif //WORDLE_SOLVED_ALLOCATIONCOUNTER_H
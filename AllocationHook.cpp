@@ -0,0 +1,39 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "AllocationCounter.h"
+#include <cstdlib>
+#include <new>
+
+// Replaces the global operator new of the program it is linked into, so it is only built into
+// the wordle_solved executable, never the libraries other hosts load
+namespace {
+    thread_local size_t thread_count = 0;
+
+    void *counted_alloc(size_t size) {
+        thread_count++;
+        for (;;) {
+            if (void *p = std::malloc(size > 0 ? size : 1)) return p;
+            std::new_handler handler = std::get_new_handler();
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+            if (!handler) throw std::bad_alloc();
+#else
+            if (!handler) std::abort();
+#endif
+            handler();
+        }
+    }
+
+    size_t thread_allocations() {return thread_count;}
+
+    const bool registered = (AllocationCounter::set_counter(thread_allocations), true);
+}
+
+// Over-aligned allocations keep the default operators, nothing on the scoring path uses them
+void *operator new(size_t size) {return counted_alloc(size);}
+void *operator new[](size_t size) {return counted_alloc(size);}
+void operator delete(void *p) noexcept {std::free(p);}
+void operator delete[](void *p) noexcept {std::free(p);}
+void operator delete(void *p, size_t) noexcept {std::free(p);}
+void operator delete[](void *p, size_t) noexcept {std::free(p);}
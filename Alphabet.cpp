@@ -0,0 +1,163 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "Alphabet.h"
+
+namespace {
+    // Decode one code point, returns false on malformed UTF-8
+    bool next_code_point(const std::string &s, size_t &i, uint32_t &cp) {
+        unsigned char c = static_cast<unsigned char>(s[i++]);
+        size_t extra;
+        if (c < 0x80) { cp = c; return true; }
+        else if ((c & 0xE0) == 0xC0) { cp = c & 0x1F; extra = 1; }
+        else if ((c & 0xF0) == 0xE0) { cp = c & 0x0F; extra = 2; }
+        else if ((c & 0xF8) == 0xF0) { cp = c & 0x07; extra = 3; }
+        else return false;
+
+        if (i + extra > s.size()) return false;
+        for (size_t k = 0; k < extra; ++k) {
+            unsigned char cont = static_cast<unsigned char>(s[i++]);
+            if ((cont & 0xC0) != 0x80) return false;
+            cp = (cp << 6) | (cont & 0x3F);
+        }
+        return cp >= 0x80 && cp <= 0x10FFFF;
+    }
+
+    std::string to_utf8(uint32_t cp) {
+        std::string out;
+        if (cp < 0x80) {
+            out += static_cast<char>(cp);
+        } else if (cp < 0x800) {
+            out += static_cast<char>(0xC0 | (cp >> 6));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            out += static_cast<char>(0xE0 | (cp >> 12));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (cp >> 18));
+            out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+        return out;
+    }
+}
+
+Alphabet::Alphabet() {
+    for (char c = 'a'; c <= 'z'; ++c) {
+        ids.emplace(static_cast<uint32_t>(c), static_cast<uint8_t>(symbols.size()));
+        symbols.emplace_back(1, c);
+    }
+}
+
+Alphabet::Alphabet(const std::string &utf8_symbols) {
+    for (size_t i = 0; i < utf8_symbols.size() && symbols.size() < kMaxSymbols;) {
+        uint32_t cp;
+        if (!next_code_point(utf8_symbols, i, cp)) continue;
+        if (ids.emplace(cp, static_cast<uint8_t>(symbols.size())).second)
+            symbols.push_back(to_utf8(cp));
+    }
+}
+
+// Simple case folding for Latin, Greek and Cyrillic capitals
+uint32_t Alphabet::to_lower(uint32_t cp) {
+    if (cp >= 'A' && cp <= 'Z') return cp + 0x20;
+    if (cp >= 0xC0 && cp <= 0xDE && cp != 0xD7) return cp + 0x20;
+    if ((cp >= 0x100 && cp <= 0x137) || (cp >= 0x14A && cp <= 0x177)) return cp | 1;
+    if ((cp >= 0x139 && cp <= 0x148) || (cp >= 0x179 && cp <= 0x17E)) return (cp & 1) ? cp + 1 : cp;
+    if (cp == 0x178) return 0xFF;
+    if (cp >= 0x391 && cp <= 0x3A9 && cp != 0x3A2) return cp + 0x20;
+    if (cp >= 0x400 && cp <= 0x40F) return cp + 0x50;
+    if (cp >= 0x410 && cp <= 0x42F) return cp + 0x20;
+    return cp;
+}
+
+bool Alphabet::letters(const std::string &utf8, std::vector<uint32_t> &out, std::string *error) const {
+    out.clear();
+    for (size_t i = 0; i < utf8.size();) {
+        uint32_t cp;
+        if (!next_code_point(utf8, i, cp)) {
+            if (error) *error = "invalid UTF-8";
+            return false;
+        }
+        cp = to_lower(cp);
+        if (cp < 0x80 && (cp < 'a' || cp > 'z') && !ids.count(cp)) {
+            if (error) *error = "'" + to_utf8(cp) + "' is not a letter";
+            return false;
+        }
+        out.push_back(cp);
+    }
+    return true;
+}
+
+bool Alphabet::encode(const std::string &utf8, std::string &out, std::string *error) const {
+    std::vector<uint32_t> code_points;
+    if (!letters(utf8, code_points, error)) return false;
+
+    out.clear();
+    for (uint32_t cp : code_points) {
+        auto it = ids.find(cp);
+        if (it == ids.end()) {
+            if (error) *error = "'" + to_utf8(cp) + "' is not in the alphabet";
+            return false;
+        }
+        out += static_cast<char>(kFirstSymbol + it->second);
+    }
+    return true;
+}
+
+bool Alphabet::encode_pattern(const std::string &utf8, std::string &out, std::string *error) const {
+    out.clear();
+    for (size_t i = 0; i < utf8.size();) {
+        if (utf8[i] == kWildcard) {
+            out += kWildcard;
+            ++i;
+            continue;
+        }
+
+        size_t start = i;
+        uint32_t cp;
+        if (!next_code_point(utf8, i, cp)) {
+            if (error) *error = "invalid UTF-8";
+            return false;
+        }
+        std::vector<uint32_t> code_points;
+        if (!letters(utf8.substr(start, i - start), code_points, error)) return false;
+
+        auto it = ids.find(code_points[0]);
+        out += it == ids.end() ? kUnknown : static_cast<char>(kFirstSymbol + it->second);
+    }
+    return true;
+}
+
+bool Alphabet::extend(const std::string &utf8, std::string &out, std::string *error) {
+    std::vector<uint32_t> code_points;
+    if (!letters(utf8, code_points, error)) return false;
+
+    for (uint32_t cp : code_points) {
+        if (ids.count(cp)) continue;
+        if (symbols.size() >= kMaxSymbols) {
+            if (error) *error = "more than " + std::to_string(kMaxSymbols) + " distinct letters";
+            return false;
+        }
+        ids.emplace(cp, static_cast<uint8_t>(symbols.size()));
+        symbols.push_back(to_utf8(cp));
+    }
+    return encode(utf8, out, error);
+}
+
+const std::string &Alphabet::symbol(char symbol) const {
+    static const std::string unknown = "?";
+    size_t id = index(symbol);
+    return id < symbols.size() ? symbols[id] : unknown;
+}
+
+std::string Alphabet::decode(const std::string &word) const {
+    std::string out;
+    out.reserve(word.size());
+    for (char c : word)
+        out += symbol(c);
+    return out;
+}
@@ -0,0 +1,64 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_ALPHABET_H
+#define WORDLE_SOLVED_ALPHABET_H
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+// Maps the letters of a dictionary to dense one byte symbols, so the feedback kernel can
+// count letters in a small array whatever the language. a-z keep their ASCII bytes, other
+// letters get the bytes after 'z' in order of first appearance, up to 64 symbols in total.
+// Words are encoded from UTF-8 when loaded and decoded back only for display.
+class Alphabet {
+public:
+    static constexpr size_t kMaxSymbols = 64;
+    static constexpr unsigned char kFirstSymbol = 'a';
+
+    // Placeholders in encoded patterns: any letter, and a letter outside the alphabet
+    static constexpr char kWildcard = '?';
+    static constexpr char kUnknown = '\0';
+
+    // Index of a symbol byte into a kMaxSymbols sized array
+    static size_t index(char symbol) {return static_cast<unsigned char>(symbol) - kFirstSymbol;}
+
+private:
+    std::vector<std::string> symbols;
+    std::unordered_map<uint32_t, uint8_t> ids;
+
+    static uint32_t to_lower(uint32_t code_point);
+
+    // Lowercased code points of a word, fails on invalid UTF-8 and non-letters outside the alphabet
+    bool letters(const std::string &utf8, std::vector<uint32_t> &out, std::string *error) const;
+
+public:
+    Alphabet();
+
+    // Alphabet of the given UTF-8 symbols in order, which may include digits and operators
+    explicit Alphabet(const std::string &utf8_symbols);
+
+    // Encode a UTF-8 word, lowercased. Fails on invalid UTF-8, non-letters and unknown letters.
+    bool encode(const std::string &utf8, std::string &out, std::string *error = nullptr) const;
+
+    // Encode a UTF-8 pattern of letters and '?' wildcards, lowercased. Letters outside the
+    // alphabet become kUnknown instead of failing, since no word can contain them.
+    bool encode_pattern(const std::string &utf8, std::string &out, std::string *error = nullptr) const;
+
+    // Add the new letters of a word, then encode it. Fails if the alphabet would overflow.
+    bool extend(const std::string &utf8, std::string &out, std::string *error = nullptr);
+
+    // UTF-8 text of a symbol byte or an encoded word
+    const std::string &symbol(char symbol) const;
+    std::string decode(const std::string &word) const;
+
+    size_t size() const {return symbols.size();}
+};
+
+
+#endif //WORDLE_SOLVED_ALPHABET_H
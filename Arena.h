@@ -0,0 +1,83 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_ARENA_H
+#define WORDLE_SOLVED_ARENA_H
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+
+// Bump allocator for the scratch arrays of one thread's recursive search, released in stack
+// order with mark() and release(). Memory comes from the heap in blocks, only when the arena
+// grows; heap_allocations() counts them, so a search that reserve()s its depth up front
+// allocates nothing while it runs.
+class Arena {
+public:
+    static constexpr size_t kAlignment = alignof(std::max_align_t);
+    static constexpr size_t kMinBlock = size_t(64) << 10;
+
+    struct Mark {
+        size_t block;
+        size_t offset;
+    };
+
+private:
+    struct Block {
+        std::unique_ptr<unsigned char[]> data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks;
+    size_t current = 0;
+    size_t offset = 0;
+    size_t allocations = 0;
+
+    void grow(size_t bytes) {
+        blocks.push_back({std::unique_ptr<unsigned char[]>(new unsigned char[bytes]), bytes});
+        allocations++;
+    }
+
+public:
+    explicit Arena(size_t bytes = 0) {
+        if (bytes > 0) reserve(bytes);
+    }
+
+    // Make sure the next bytes fit without touching the heap
+    void reserve(size_t bytes) {
+        bytes += kAlignment;
+        for (size_t b = current; b < blocks.size(); ++b)
+            if (blocks[b].size - (b == current ? offset : 0) >= bytes) return;
+        grow(std::max(bytes, kMinBlock));
+    }
+
+    template<class T>
+    T *alloc(size_t count) {
+        size_t bytes = (count * sizeof(T) + kAlignment - 1) / kAlignment * kAlignment;
+        while (current < blocks.size() && offset + bytes > blocks[current].size) {
+            current++;
+            offset = 0;
+        }
+        if (current == blocks.size()) {
+            size_t last = blocks.empty() ? 0 : blocks.back().size;
+            grow(std::max({bytes, kMinBlock, last * 2}));
+        }
+        T *out = reinterpret_cast<T *>(blocks[current].data.get() + offset);
+        offset += bytes;
+        return out;
+    }
+
+    Mark mark() const {return {current, offset};}
+    void release(Mark m) {
+        current = m.block;
+        offset = m.offset;
+    }
+
+    size_t heap_allocations() const {return allocations;}
+};
+
+
+#endif //WORDLE_SOLVED_ARENA_H
@@ -8,45 +8,61 @@
 #include <vector>
 #include <string>
 
-AutoMode::AutoMode(Display &display, Feedback &feedback_instance)
+template<size_t L, class Rule>
+BasicAutoMode<L, Rule>::BasicAutoMode(Display &display, BasicFeedback<L, Rule> &feedback_instance, bool hard_mode, Metric metric,
+                                      size_t threads)
     : display(display),
       feedback(feedback_instance),
-      entropy(feedback) {}
+      entropy(feedback, threads),
+      hard_mode(hard_mode),
+      metric(metric) {}
 
-int AutoMode::run(std::vector<std::string> guesses,
+template<size_t L, class Rule>
+int BasicAutoMode<L, Rule>::run(std::vector<std::string> guesses,
                std::vector<std::string> solutions,
                int steps,
                const std::string &answer) {
-    std::unordered_map<std::string, uint8_t> guessFeedback;
+    std::unordered_map<std::string, typename Rule::Pattern> guessFeedback;
     size_t guess_count = 1;
+    BasicHardMode<L, Rule> hard(feedback, guesses);
 
     while (solutions.size() > 1) {
+        // Look no further ahead than the guesses left
         int k = steps;
-        if (7 - guess_count < steps) {
-            k = 7 - guess_count;
+        if (Rule::max_guesses + 1 - guess_count < steps) {
+            k = Rule::max_guesses + 1 - guess_count;
         }
 
-        auto [best_guess, best_entropy] = entropy.get_best_guess(
-            guesses, solutions, k, display);
+        // Only score guesses consistent with every hint so far
+        if (hard_mode && guess_count > 1)
+            guesses = hard.get_guesses();
+
+        auto [best_guess, best_score] = entropy.get_best_guess(
+            guesses, solutions, k, display, metric);
 
         guesses.erase(std::remove(guesses.begin(), guesses.end(), best_guess),
                             guesses.end());
 
-        display.showOutput("Next Guess: " + best_guess + " | Expected Entropy (over " + std::to_string(k) + " steps): " + std::to_string(best_entropy));
+        display.showOutput("Next Guess: " + display.word(best_guess) + " | " + metric_label(metric) + " (over " + std::to_string(k) + " steps): " + std::to_string(best_score));
 
         // Get feedback for actual answer
-        uint8_t fb_encoded = feedback.get_feedback(best_guess, answer);
+        auto fb_encoded = feedback.get_feedback(best_guess, answer);
 
         solutions = feedback.get_new_solutions(solutions, best_guess, fb_encoded);
+        if (hard_mode)
+            hard.apply(best_guess, fb_encoded);
 
         guess_count ++;
     }
 
     if (!solutions.empty()) {
-        display.showOutput("Solution found in " + std::to_string(guess_count) + " guesses: " + solutions[0]);
+        display.showOutput("Solution found in " + std::to_string(guess_count) + " guesses: " + display.word(solutions[0]));
         return guess_count;
     } else {
         display.showOutput("No solution found.\n");
     }
     return -1;
-}
\ No newline at end of file
+}
+
+WORDLE_SOLVED_INSTANTIATE(BasicAutoMode)
+WORDLE_SOLVED_INSTANTIATE_RULES(BasicAutoMode)
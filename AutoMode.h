@@ -8,16 +8,30 @@
 #include "Feedback.h"
 #include "Display.h"
 #include "Entropy.h"
+#include "HardMode.h"
 
 
-class AutoMode {
+template<size_t L, class Rule = WordleRule<L>>
+class BasicAutoMode {
 private:
     Display &display;
-    Feedback &feedback;
-    Entropy entropy;
+    BasicFeedback<L, Rule> &feedback;
+    BasicEntropy<L, Rule> entropy;
+    bool hard_mode;
+    Metric metric;
 
 public:
-    AutoMode(Display &display, Feedback &feedback_instance);
+    BasicAutoMode(Display &display, BasicFeedback<L, Rule> &feedback_instance, bool hard_mode = false,
+                  Metric metric = Metric::Entropy, size_t threads = 0);
+
+    // Score only the best survivors of a cheap first pass, see BasicEntropy::set_prefilter
+    void set_prefilter(size_t survivors, bool safe) {entropy.set_prefilter(survivors, safe);}
+
+    // Value model for Metric::Model, see BasicEntropy::set_model
+    void set_model(const Mlp *model) {entropy.set_model(model);}
+
+    // Turn-1 histograms, see BasicEntropy::set_histograms
+    void set_histograms(const BasicHistogramCache<L, Rule> *histograms) {entropy.set_histograms(histograms);}
 
     int run(std::vector<std::string> all_solutions,
              std::vector<std::string> solutions,
@@ -25,5 +39,7 @@ public:
              const std::string &answer);
 };
 
+using AutoMode = BasicAutoMode<5>;
+
 
 #endif //WORDLE_SOLVED_AUTOMODE_H
\ No newline at end of file
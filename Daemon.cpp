@@ -0,0 +1,520 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "Daemon.h"
+#include "Json.h"
+#include "TiledEntropy.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    const char *const kCommands[] = {"new", "feedback", "suggest", "topk", "close", "stats", "update"};
+
+    std::string error_response(const std::string &message) {
+        return "{\"ok\":false,\"error\":" + JsonObject::escape(message) + "}";
+    }
+
+    // Encode a G/Y/B feedback string to Base 3, returns -1 if invalid
+    int encode_feedback(const std::string &fb_input, size_t length) {
+        if (fb_input.length() != length || fb_input.find_first_not_of("GYBgyb") != std::string::npos)
+            return -1;
+
+        int fb_encoded = 0;
+        for (char c : fb_input) {
+            int code = 0;
+            switch (toupper(c)) {
+                case 'G': code = 2; break;
+                case 'Y': code = 1; break;
+                default: code = 0; break;
+            }
+            fb_encoded = fb_encoded * 3 + code;
+        }
+        return fb_encoded;
+    }
+
+    // Parse a comma separated list of words of the given length, returns false if any is invalid
+    bool parse_word_list(const std::string &list, size_t length, const Alphabet &alphabet,
+                         std::vector<std::string> &words) {
+        size_t start = 0;
+        while (start < list.size()) {
+            size_t end = list.find(',', start);
+            if (end == std::string::npos) end = list.size();
+            std::string word = list.substr(start, end - start), encoded;
+            word.erase(0, word.find_first_not_of(' '));
+            word.erase(word.find_last_not_of(' ') + 1);
+            if (!alphabet.encode(word, encoded) || encoded.size() != length)
+                return false;
+            words.push_back(encoded);
+            start = end + 1;
+        }
+        return true;
+    }
+}
+
+template<size_t L>
+void BasicDaemon<L>::LatencyHistogram::record(uint64_t us) {
+    size_t bucket = 0;
+    while (bucket + 1 < buckets.size() && (uint64_t(1) << (bucket + 1)) <= us) ++bucket;
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    total_us.fetch_add(us, std::memory_order_relaxed);
+}
+
+template<size_t L>
+std::string BasicDaemon<L>::LatencyHistogram::to_json() const {
+    uint64_t n = count.load();
+    uint64_t p50 = 0, p99 = 0, seen = 0;
+    std::string bucket_list;
+
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        uint64_t b = buckets[i].load();
+        if (i > 0) bucket_list += ",";
+        bucket_list += std::to_string(b);
+
+        // Percentiles reported as the upper bound of their bucket
+        seen += b;
+        if (p50 == 0 && seen * 2 >= n && n > 0) p50 = uint64_t(1) << (i + 1);
+        if (p99 == 0 && seen * 100 >= n * 99 && n > 0) p99 = uint64_t(1) << (i + 1);
+    }
+
+    uint64_t mean = n > 0 ? total_us.load() / n : 0;
+    return "{\"count\":" + std::to_string(n) +
+           ",\"mean_us\":" + std::to_string(mean) +
+           ",\"p50_us\":" + std::to_string(p50) +
+           ",\"p99_us\":" + std::to_string(p99) +
+           ",\"buckets\":[" + bucket_list + "]}";
+}
+
+template<size_t L>
+BasicDaemon<L>::BasicDaemon(Display &display,
+                            BasicFeedback<L> &feedback_instance,
+                            const std::vector<std::string> &guesses,
+                            const std::vector<std::string> &answers,
+                            int steps)
+    : display(display),
+      default_steps(steps) {
+    auto initial = std::make_shared<Lists>();
+    initial->feedback = feedback_instance.snapshot();
+    initial->guesses = guesses;
+    initial->answers = answers;
+    lists = initial;
+
+    // Every histogram is created up front so lookups never rehash while serving
+    for (const char *cmd : kCommands)
+        latencies[cmd];
+}
+
+template<size_t L>
+std::shared_ptr<typename BasicDaemon<L>::Session> BasicDaemon<L>::find_session(uint64_t id) {
+    std::lock_guard<std::mutex> lock(sessions_mutex);
+    auto it = sessions.find(id);
+    return it == sessions.end() ? nullptr : it->second;
+}
+
+template<size_t L>
+std::shared_ptr<const typename BasicDaemon<L>::Ranking> BasicDaemon<L>::get_ranking(
+    const std::shared_ptr<const Lists> &state_lists, const std::vector<std::string> &solutions, int k) {
+    // The state is identified by its word lists, remaining candidates and lookahead depth
+    std::string key = std::to_string(state_lists->generation) + ":" + std::to_string(k) + ":";
+    key.reserve(key.size() + solutions.size() * L);
+    for (const auto &s : solutions) key += s;
+
+    std::promise<std::shared_ptr<const Ranking>> promise;
+    std::shared_future<std::shared_ptr<const Ranking>> pending;
+    {
+        std::lock_guard<std::mutex> lock(rankings_mutex);
+        auto it = rankings.find(key);
+        if (it != rankings.end()) {
+            // Only joins on a ranking still being computed are coalesced, the rest are cache hits
+            if (it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                coalesced.fetch_add(1, std::memory_order_relaxed);
+            pending = it->second;
+        } else {
+            rankings.emplace(key, promise.get_future().share());
+            ranking_order.push_back(key);
+            while (ranking_order.size() > kMaxCachedStates) {
+                rankings.erase(ranking_order.front());
+                ranking_order.pop_front();
+            }
+        }
+    }
+
+    // Another request is already computing (or has computed) this state
+    if (pending.valid()) return pending.get();
+
+    auto ranking = std::make_shared<Ranking>();
+    if (solutions.size() == 1) {
+        ranking->emplace_back(solutions[0], 0.0);
+    } else {
+        std::atomic<size_t> progress(0);
+        const BasicFeedback<L> &state_feedback = state_lists->feedback;
+        if (state_feedback.is_materialised()) {
+            BasicEntropy<L> entropy(state_feedback);
+            *ranking = entropy.get_n_step_entropy(state_lists->guesses, solutions, k, progress, true);
+        } else {
+            BasicTiledEntropy<L> tiled(state_feedback, state_feedback.get_memory_budget());
+            *ranking = tiled.get_entropy(state_lists->guesses, solutions, progress);
+        }
+
+        // Prefer remaining candidates on ties, they can win outright
+        std::vector<std::string> sorted_solutions(solutions);
+        std::sort(sorted_solutions.begin(), sorted_solutions.end());
+        auto is_candidate = [&](const std::string &word) {
+            return std::binary_search(sorted_solutions.begin(), sorted_solutions.end(), word);
+        };
+
+        size_t top = std::min(kMaxTopK, ranking->size());
+        std::partial_sort(ranking->begin(), ranking->begin() + top, ranking->end(),
+                          [&](const auto &a, const auto &b) {
+                              if (a.second != b.second) return a.second > b.second;
+                              return is_candidate(a.first) > is_candidate(b.first);
+                          });
+        ranking->resize(top);
+    }
+    computed.fetch_add(1, std::memory_order_relaxed);
+
+    std::shared_ptr<const Ranking> result = ranking;
+    promise.set_value(result);
+    return result;
+}
+
+template<size_t L>
+std::string BasicDaemon<L>::handle(const JsonObject &request) {
+    std::string cmd = request.get("cmd");
+
+    if (cmd == "stats") return handle_stats();
+    if (cmd == "update") return handle_update(request);
+
+    if (cmd == "new") {
+        int steps = static_cast<int>(request.get_int("k", default_steps));
+        if (steps < 1 || steps > 6) return error_response("k must be between 1 and 6");
+
+        // Sessions keep the lists they started with until closed
+        auto session = std::make_shared<Session>();
+        session->lists = std::atomic_load(&lists);
+        session->solutions = session->lists->answers;
+        session->steps = steps;
+
+        uint64_t id;
+        {
+            std::lock_guard<std::mutex> lock(sessions_mutex);
+            id = next_session++;
+            sessions.emplace(id, session);
+        }
+        return "{\"ok\":true,\"session\":" + std::to_string(id) +
+               ",\"remaining\":" + std::to_string(session->solutions.size()) + "}";
+    }
+
+    long id = request.get_int("session", -1);
+    if (id < 0) return error_response("missing session");
+
+    if (cmd == "close") {
+        std::lock_guard<std::mutex> lock(sessions_mutex);
+        if (sessions.erase(static_cast<uint64_t>(id)) == 0) return error_response("unknown session");
+        return "{\"ok\":true}";
+    }
+
+    auto session = find_session(static_cast<uint64_t>(id));
+    if (!session) return error_response("unknown session");
+
+    if (cmd == "feedback") {
+        std::string guess;
+        bool valid_guess = display.getAlphabet().encode(request.get("guess"), guess) && guess.size() == L;
+        int fb_encoded = encode_feedback(request.get("feedback"), L);
+        if (!valid_guess || fb_encoded < 0)
+            return error_response("feedback must be a " + std::to_string(L) + " letter guess and " +
+                                  std::to_string(L) + " letters using G/Y/B");
+
+        std::lock_guard<std::mutex> lock(session->mutex);
+        auto new_solutions = session->lists->feedback.get_new_solutions(session->solutions, guess, static_cast<typename WordTraits<L>::Pattern>(fb_encoded));
+        if (new_solutions.empty()) return error_response("feedback is inconsistent with previous guesses");
+
+        session->solutions = std::move(new_solutions);
+        session->guess_count++;
+        std::string response = "{\"ok\":true,\"remaining\":" + std::to_string(session->solutions.size());
+        if (session->solutions.size() == 1)
+            response += ",\"solution\":" + JsonObject::escape(display.word(session->solutions[0]));
+        return response + "}";
+    }
+
+    if (cmd == "suggest" || cmd == "topk") {
+        std::vector<std::string> solutions;
+        int k;
+        {
+            std::lock_guard<std::mutex> lock(session->mutex);
+            solutions = session->solutions;
+            k = session->steps;
+            if (7 - static_cast<int>(session->guess_count) < k)
+                k = 7 - static_cast<int>(session->guess_count);
+        }
+        k = std::max(k, 1);
+
+        auto ranking = get_ranking(session->lists, solutions, k);
+
+        if (cmd == "suggest") {
+            const auto &[guess, score] = ranking->front();
+            return "{\"ok\":true,\"guess\":" + JsonObject::escape(display.word(guess)) +
+                   ",\"score\":" + std::to_string(score) +
+                   ",\"remaining\":" + std::to_string(solutions.size()) + "}";
+        }
+
+        long n = std::clamp<long>(request.get_int("n", 5), 1, static_cast<long>(kMaxTopK));
+        std::string response = "{\"ok\":true,\"guesses\":[";
+        for (size_t i = 0; i < ranking->size() && i < static_cast<size_t>(n); ++i) {
+            if (i > 0) response += ",";
+            response += "{\"guess\":" + JsonObject::escape(display.word((*ranking)[i].first)) +
+                        ",\"score\":" + std::to_string((*ranking)[i].second) + "}";
+        }
+        return response + "],\"remaining\":" + std::to_string(solutions.size()) + "}";
+    }
+
+    return error_response("unknown command");
+}
+
+template<size_t L>
+std::string BasicDaemon<L>::handle_update(const JsonObject &request) {
+    const Alphabet &alphabet = display.getAlphabet();
+    std::vector<std::string> add_guesses, remove_guesses, add_answers, remove_answers;
+    if (!parse_word_list(request.get("add_guesses"), L, alphabet, add_guesses) ||
+        !parse_word_list(request.get("remove_guesses"), L, alphabet, remove_guesses) ||
+        !parse_word_list(request.get("add_answers"), L, alphabet, add_answers) ||
+        !parse_word_list(request.get("remove_answers"), L, alphabet, remove_answers))
+        return error_response("word lists must be comma separated " + std::to_string(L) + " letter words");
+
+    // Updates are serialised, queries keep reading the current lists meanwhile
+    std::lock_guard<std::mutex> update_lock(update_mutex);
+    std::shared_ptr<const Lists> current = std::atomic_load(&lists);
+
+    auto next = std::make_shared<Lists>();
+    next->generation = current->generation + 1;
+
+    // Answers stay valid guesses, so removed guesses are removed from the answers too
+    std::unordered_set<std::string> dropped_guesses(remove_guesses.begin(), remove_guesses.end());
+    std::unordered_set<std::string> dropped_answers(remove_answers.begin(), remove_answers.end());
+    dropped_answers.insert(remove_guesses.begin(), remove_guesses.end());
+
+    std::unordered_set<std::string> seen;
+    for (const auto &w : current->guesses)
+        if (!dropped_guesses.count(w) && seen.insert(w).second) next->guesses.push_back(w);
+
+    std::vector<std::string> added;
+    for (const auto *list : {&add_guesses, &add_answers})
+        for (const auto &w : *list)
+            if (seen.insert(w).second) {
+                next->guesses.push_back(w);
+                added.push_back(w);
+            }
+
+    seen.clear();
+    for (const auto &w : current->answers)
+        if (!dropped_answers.count(w) && seen.insert(w).second) next->answers.push_back(w);
+    for (const auto &w : add_answers)
+        if (!dropped_answers.count(w) && seen.insert(w).second) next->answers.push_back(w);
+
+    if (next->answers.empty()) return error_response("update would leave no answers");
+
+    next->feedback = current->feedback;
+    next->feedback.update_words(added, remove_guesses);
+
+    std::atomic_store(&lists, std::shared_ptr<const Lists>(next));
+
+    // Warm the new opening state, earlier sessions keep their cached rankings
+    warm(next);
+
+    return "{\"ok\":true,\"generation\":" + std::to_string(next->generation) +
+           ",\"guesses\":" + std::to_string(next->guesses.size()) +
+           ",\"answers\":" + std::to_string(next->answers.size()) + "}";
+}
+
+template<size_t L>
+void BasicDaemon<L>::warm(std::shared_ptr<const Lists> state_lists) {
+    std::lock_guard<std::mutex> lock(warmers_mutex);
+    warmers.emplace_back([this, state_lists]() {
+        get_ranking(state_lists, state_lists->answers, default_steps);
+    });
+}
+
+template<size_t L>
+std::string BasicDaemon<L>::handle_stats() {
+    size_t session_count;
+    {
+        std::lock_guard<std::mutex> lock(sessions_mutex);
+        session_count = sessions.size();
+    }
+
+    std::string response = "{\"ok\":true,\"sessions\":" + std::to_string(session_count) +
+                           ",\"clients\":" + std::to_string(clients.load()) +
+                           ",\"generation\":" + std::to_string(std::atomic_load(&lists)->generation) +
+                           ",\"computed\":" + std::to_string(computed.load()) +
+                           ",\"coalesced\":" + std::to_string(coalesced.load()) +
+                           ",\"latency\":{";
+    bool first = true;
+    for (const char *cmd : kCommands) {
+        if (!first) response += ",";
+        first = false;
+        response += JsonObject::escape(cmd) + ":" + latencies.at(cmd).to_json();
+    }
+    return response + "}}";
+}
+
+#ifdef _WIN32
+
+template<size_t L>
+void BasicDaemon<L>::serve_client(Connection &) {}
+
+template<size_t L>
+int BasicDaemon<L>::run(const std::string &) {
+    display.showOutput("Error: daemon mode requires Unix domain sockets and is not supported on Windows.\n");
+    return 1;
+}
+
+#else
+
+template<size_t L>
+void BasicDaemon<L>::serve_client(Connection &connection) {
+    int fd = connection.fd;
+    clients.fetch_add(1);
+
+    std::string buffer;
+    char chunk[4096];
+
+    while (true) {
+        ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        buffer.append(chunk, static_cast<size_t>(n));
+
+        size_t newline;
+        while ((newline = buffer.find('\n')) != std::string::npos) {
+            std::string line = buffer.substr(0, newline);
+            buffer.erase(0, newline + 1);
+            if (line.empty()) continue;
+
+            auto start = std::chrono::steady_clock::now();
+            JsonObject request;
+            std::string response = (request.parse(line) ? handle(request) : error_response("malformed request")) + "\n";
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start).count();
+
+            auto it = latencies.find(request.get("cmd"));
+            if (it != latencies.end())
+                it->second.record(static_cast<uint64_t>(elapsed));
+
+            const char *p = response.data();
+            size_t remaining = response.size();
+            while (remaining > 0) {
+                ssize_t sent = send(fd, p, remaining, MSG_NOSIGNAL);
+                if (sent < 0 && errno == EINTR) continue;
+                if (sent <= 0) {
+                    remaining = 0;
+                    buffer.clear();
+                    break;
+                }
+                p += sent;
+                remaining -= static_cast<size_t>(sent);
+            }
+        }
+
+        // Drop clients sending unbounded lines
+        if (buffer.size() > (1 << 20)) break;
+    }
+
+    clients.fetch_sub(1);
+    std::lock_guard<std::mutex> lock(connections_mutex);
+    close(fd);
+    connection.open = false;
+}
+
+template<size_t L>
+int BasicDaemon<L>::run(const std::string &socket_path) {
+    sockaddr_un addr{};
+    if (socket_path.size() >= sizeof(addr.sun_path)) {
+        display.showOutput("Error: socket path is too long.\n");
+        return 1;
+    }
+
+    int server = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (server < 0) {
+        display.showOutput(std::string("Error: failed to create socket: ") + std::strerror(errno) + "\n");
+        return 1;
+    }
+
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+    unlink(socket_path.c_str());
+
+    if (bind(server, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0 || listen(server, 128) != 0) {
+        display.showOutput(std::string("Error: failed to listen on ") + socket_path + ": " + std::strerror(errno) + "\n");
+        close(server);
+        return 1;
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+
+    // Warm the opening state so the first clients do not pay for it
+    warm(std::atomic_load(&lists));
+
+    display.showOutput("Daemon listening on " + socket_path);
+
+    while (true) {
+        int client = accept(server, nullptr, nullptr);
+        if (client < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            display.showOutput(std::string("Error: accept failed: ") + std::strerror(errno) + "\n");
+            break;
+        }
+
+        // Served clients are joined here, a thread holds the lock only while closing its socket
+        std::lock_guard<std::mutex> lock(connections_mutex);
+        for (auto it = connections.begin(); it != connections.end();) {
+            if (it->open) {
+                ++it;
+                continue;
+            }
+            it->thread.join();
+            it = connections.erase(it);
+        }
+        Connection &connection = connections.emplace_back();
+        connection.fd = client;
+        connection.thread = std::thread(&BasicDaemon::serve_client, this, std::ref(connection));
+    }
+
+    close(server);
+    unlink(socket_path.c_str());
+
+    // Wake the remaining clients out of recv and wait for every thread using the daemon
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex);
+        for (Connection &connection : connections)
+            if (connection.open) shutdown(connection.fd, SHUT_RDWR);
+    }
+    for (Connection &connection : connections) connection.thread.join();
+    connections.clear();
+
+    std::vector<std::thread> pending;
+    {
+        std::lock_guard<std::mutex> lock(warmers_mutex);
+        pending.swap(warmers);
+    }
+    for (auto &t : pending) t.join();
+    return 1;
+}
+
+#endif
+
+WORDLE_SOLVED_INSTANTIATE(BasicDaemon)
@@ -0,0 +1,125 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_DAEMON_H
+#define WORDLE_SOLVED_DAEMON_H
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Display.h"
+#include "Entropy.h"
+#include "Feedback.h"
+#include "Json.h"
+
+
+template<size_t L>
+class BasicDaemon {
+public:
+    using Ranking = std::vector<std::pair<std::string, double>>;
+
+    static constexpr size_t kMaxTopK = 64;
+    static constexpr size_t kMaxCachedStates = 1024;
+
+private:
+    // Word lists and tables served to new sessions, replaced as a whole by updates
+    struct Lists {
+        BasicFeedback<L> feedback;
+        std::vector<std::string> guesses;
+        std::vector<std::string> answers;
+        uint64_t generation = 0;
+    };
+
+    struct Session {
+        std::mutex mutex;
+        std::shared_ptr<const Lists> lists;
+        std::vector<std::string> solutions;
+        size_t guess_count = 1;
+        int steps = 1;
+    };
+
+    // A client thread and its socket, the socket is closed under connections_mutex once served
+    struct Connection {
+        std::thread thread;
+        int fd = -1;
+        bool open = true;
+    };
+
+    // Latency histogram with power of two microsecond buckets
+    struct LatencyHistogram {
+        std::array<std::atomic<uint64_t>, 32> buckets{};
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> total_us{0};
+
+        void record(uint64_t us);
+        std::string to_json() const;
+    };
+
+    Display &display;
+    int default_steps;
+
+    // Published RCU style: readers pin the current lists, updates swap in a new copy
+    std::shared_ptr<const Lists> lists;
+    std::mutex update_mutex;
+
+    std::mutex sessions_mutex;
+    std::unordered_map<uint64_t, std::shared_ptr<Session>> sessions;
+    uint64_t next_session = 1;
+
+    // Rankings by state, in-flight requests for the same state share one computation
+    std::mutex rankings_mutex;
+    std::unordered_map<std::string, std::shared_future<std::shared_ptr<const Ranking>>> rankings;
+    std::deque<std::string> ranking_order;
+    std::atomic<uint64_t> computed{0};
+    std::atomic<uint64_t> coalesced{0};
+
+    std::atomic<size_t> clients{0};
+
+    // Threads using this daemon, joined before run returns
+    std::mutex connections_mutex;
+    std::list<Connection> connections;
+    std::mutex warmers_mutex;
+    std::vector<std::thread> warmers;
+    std::unordered_map<std::string, LatencyHistogram> latencies;
+
+    std::shared_ptr<Session> find_session(uint64_t id);
+
+    // Top guesses for a state, computed once per state
+    std::shared_ptr<const Ranking> get_ranking(const std::shared_ptr<const Lists> &state_lists,
+                                               const std::vector<std::string> &solutions, int k);
+
+    std::string handle(const JsonObject &request);
+    std::string handle_update(const JsonObject &request);
+    std::string handle_stats();
+
+    // Rank a state's opening in the background so the first requests do not pay for it
+    void warm(std::shared_ptr<const Lists> state_lists);
+
+    void serve_client(Connection &connection);
+
+public:
+    BasicDaemon(Display &display,
+                BasicFeedback<L> &feedback_instance,
+                const std::vector<std::string> &guesses,
+                const std::vector<std::string> &answers,
+                int steps);
+
+    // Listen on a Unix domain socket and serve JSON-lines requests until killed
+    int run(const std::string &socket_path);
+};
+
+using Daemon = BasicDaemon<5>;
+
+
+#endif //WORDLE_SOLVED_DAEMON_H
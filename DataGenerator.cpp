@@ -0,0 +1,212 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "DataGenerator.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <future>
+#include <map>
+#include <mutex>
+#include <random>
+#include <thread>
+
+template<size_t L>
+BasicDataGenerator<L>::BasicDataGenerator(Display &display, BasicFeedback<L> &feedback_instance, unsigned seed)
+    : display(display),
+      feedback(feedback_instance),
+      seed(seed) {}
+
+template<size_t L>
+uint32_t BasicDataGenerator<L>::score(const std::vector<uint32_t> &guesses, const std::vector<uint32_t> &candidates,
+                                      float *scores, std::vector<uint32_t> &counts) const {
+    const std::vector<double> &log_cache = feedback.get_log_cache();
+    double log_total = log_cache[candidates.size()];
+    double best_score = -1.0;
+    uint32_t best = 0;
+
+    for (size_t g = 0; g < guesses.size(); ++g) {
+        const Pattern *row = feedback.row(guesses[g]);
+        for (uint32_t c : candidates) counts[row[c]]++;
+
+        // Read back through the candidates, so only touched buckets are visited and cleared
+        double entropy = 0.0;
+        for (uint32_t c : candidates) {
+            uint32_t count = counts[row[c]];
+            if (count == 0) continue;
+            counts[row[c]] = 0;
+            entropy -= static_cast<double>(count) / candidates.size() * (log_cache[count] - log_total);
+        }
+
+        scores[g] = static_cast<float>(entropy);
+        if (entropy > best_score) {
+            best_score = entropy;
+            best = static_cast<uint32_t>(g);
+        }
+    }
+    return best;
+}
+
+template<size_t L>
+void BasicDataGenerator<L>::play(const std::vector<uint32_t> &guesses, const std::vector<uint32_t> &answers,
+                                 const std::vector<float> &opening, uint32_t opening_best, uint64_t game,
+                                 std::vector<float> &records) const {
+    size_t n_guesses = guesses.size();
+    size_t stride = record_size(n_guesses) / sizeof(float);
+    std::mt19937_64 rng(seed * 0x9E3779B97F4A7C15ull + game);
+    std::uniform_real_distribution<double> explore(0.0, 1.0);
+    std::uniform_int_distribution<size_t> pick_guess(0, n_guesses - 1);
+
+    uint32_t answer = answers[std::uniform_int_distribution<size_t>(0, answers.size() - 1)(rng)];
+    std::vector<uint32_t> candidates = answers, counts(Traits::patterns, 0);
+    records.clear();
+
+    size_t turn = 0;
+    for (; turn < kMaxTurns; ++turn) {
+        records.resize((turn + 1) * stride, 0.0f);
+        float *record = records.data() + turn * stride;
+        float *scores = record + Features::kSize;
+
+        const std::vector<std::string> &words = feedback.get_words();
+        for (uint32_t c : candidates) Features::add(words[c], record);
+        Features::finish(record, candidates.size());
+
+        // Every game opens on the same state
+        uint32_t best;
+        if (turn == 0) {
+            std::copy(opening.begin(), opening.end(), scores);
+            best = opening_best;
+        } else {
+            best = score(guesses, candidates, scores, counts);
+        }
+        uint32_t best_bits = best;
+        std::memcpy(scores + n_guesses, &best_bits, sizeof(best_bits));
+        scores[n_guesses + 1] = scores[best];
+
+        uint32_t guess = guesses[best];
+        if (candidates.size() == 1) guess = candidates[0];
+        else if (explore(rng) < kExplore) guess = guesses[pick_guess(rng)];
+        if (guess == answer) break;
+
+        // Keep the candidates giving the same pattern as the answer
+        const Pattern *row = feedback.row(guess);
+        Pattern pattern = row[answer];
+        candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                        [&](uint32_t c) { return row[c] != pattern; }),
+                         candidates.end());
+    }
+
+    // Guesses taken from each state, counting the one that solved it
+    size_t used = std::min(turn + 1, kMaxTurns);
+    records.resize(used * stride);
+    for (size_t t = 0; t < used; ++t)
+        records[t * stride + Features::kSize + n_guesses + 2] = static_cast<float>(turn + 1 - t);
+}
+
+template<size_t L>
+std::string BasicDataGenerator<L>::npy_header(size_t records, size_t n_guesses) const {
+    std::string dict = "{'descr': [('features', '<f4', (" + std::to_string(Features::kSize) + ",)), "
+                       "('scores', '<f4', (" + std::to_string(n_guesses) + ",)), "
+                       "('best', '<u4'), ('best_score', '<f4'), ('value', '<f4')], "
+                       "'fortran_order': False, 'shape': (" + std::to_string(records) + ",), }";
+
+    // Version 1.0: magic, two version bytes, little-endian uint16 header length, then the
+    // dict padded with spaces and a newline to a multiple of 64 bytes
+    size_t unpadded = 10 + dict.size() + 1;
+    dict.append((64 - unpadded % 64) % 64, ' ');
+    dict.push_back('\n');
+
+    std::string header("\x93NUMPY\x01\x00", 8);
+    header.push_back(static_cast<char>(dict.size() & 0xff));
+    header.push_back(static_cast<char>(dict.size() >> 8));
+    return header + dict;
+}
+
+template<size_t L>
+bool BasicDataGenerator<L>::run(const std::vector<std::string> &guesses, const std::vector<std::string> &answers,
+                                size_t records, const std::string &path) {
+    std::vector<uint32_t> guess_ids, answer_ids;
+    for (const auto &g : guesses) guess_ids.push_back(static_cast<uint32_t>(feedback.index_of(g)));
+    for (const auto &a : answers) answer_ids.push_back(static_cast<uint32_t>(feedback.index_of(a)));
+
+    FILE *file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        display.showOutput("Error: cannot write " + path + "\n");
+        return false;
+    }
+    std::string header = npy_header(records, guess_ids.size());
+    bool ok = std::fwrite(header.data(), 1, header.size(), file) == header.size();
+
+    // The opening state is the same for every game, score it once
+    std::vector<float> opening(guess_ids.size());
+    std::vector<uint32_t> counts(Traits::patterns, 0);
+    uint32_t opening_best = score(guess_ids, answer_ids, opening.data(), counts);
+
+    size_t stride = record_size(guess_ids.size());
+    size_t n_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::atomic<uint64_t> next_game{0};
+    std::mutex write_mutex;
+    std::condition_variable window_cv;
+    size_t written = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    // Games are seeded by their number and written in that order, so a seed always gives the same
+    // file. Games finished early wait in a reorder buffer, workers stay within a window of the
+    // next game to write so the buffer stays small.
+    std::map<uint64_t, std::vector<float>> finished;
+    uint64_t next_write = 0;
+    uint64_t window = 4 * n_threads;
+
+    auto worker = [&]() {
+        std::vector<float> game_records;
+        while (true) {
+            uint64_t game = next_game.fetch_add(1);
+            {
+                std::unique_lock<std::mutex> lock(write_mutex);
+                window_cv.wait(lock, [&] { return written >= records || !ok || game < next_write + window; });
+                if (written >= records || !ok) return;
+            }
+            play(guess_ids, answer_ids, opening, opening_best, game, game_records);
+
+            std::lock_guard<std::mutex> lock(write_mutex);
+            if (written >= records || !ok) return;
+            finished.emplace(game, std::move(game_records));
+            while (!finished.empty() && finished.begin()->first == next_write && written < records && ok) {
+                const std::vector<float> &next = finished.begin()->second;
+                size_t count = std::min(next.size() * sizeof(float) / stride, records - written);
+                ok = std::fwrite(next.data(), stride, count, file) == count;
+                written += count;
+                finished.erase(finished.begin());
+                next_write++;
+            }
+            display.showProgress("Generating States", written, records);
+            window_cv.notify_all();
+        }
+    };
+
+    {
+        ThreadPool pool(n_threads);
+        std::vector<std::future<void>> futures;
+        for (size_t t = 0; t < n_threads; ++t)
+            futures.push_back(pool.enqueue(worker));
+        for (auto &f : futures) f.get();
+    }
+
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok) {
+        display.showOutput("Error: failed writing " + path + "\n");
+        return false;
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    display.showOutput("Wrote " + std::to_string(written) + " states from " + std::to_string(next_write) +
+                       " games to " + path + " in " + std::to_string(seconds) + "s");
+    return true;
+}
+
+WORDLE_SOLVED_INSTANTIATE(BasicDataGenerator)
@@ -0,0 +1,68 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_DATAGENERATOR_H
+#define WORDLE_SOLVED_DATAGENERATOR_H
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "Display.h"
+#include "Feedback.h"
+#include "StateFeatures.h"
+#include "WordTraits.h"
+
+
+// Training states for learned models, sampled from games the entropy solver plays against
+// random answers, with a random guess instead of the best one kExplore of the time so that
+// states off the solver's own path are covered too. Records stream into a .npy file of one
+// structured array:
+//   features    float32[BasicStateFeatures<L>::kSize] of the candidates
+//   scores      float32[guesses], single-step entropy of every guess over the candidates
+//   best        uint32 guess index with the highest score, first on ties
+//   best_score  float32 its entropy
+//   value       float32 guesses the game still took from this state, including the last
+template<size_t L>
+class BasicDataGenerator {
+public:
+    using Traits = WordTraits<L>;
+    using Pattern = typename Traits::Pattern;
+    using Features = BasicStateFeatures<L>;
+
+    static constexpr double kExplore = 0.25;
+    static constexpr size_t kMaxTurns = 12;
+
+private:
+    Display &display;
+    BasicFeedback<L> &feedback;
+    unsigned seed;
+
+    // Entropy of every guess over candidates, returns the best guess
+    uint32_t score(const std::vector<uint32_t> &guesses, const std::vector<uint32_t> &candidates,
+                   float *scores, std::vector<uint32_t> &counts) const;
+
+    // One game's records, value filled in once the game is over
+    void play(const std::vector<uint32_t> &guesses, const std::vector<uint32_t> &answers,
+              const std::vector<float> &opening, uint32_t opening_best, uint64_t game,
+              std::vector<float> &records) const;
+
+    std::string npy_header(size_t records, size_t n_guesses) const;
+
+public:
+    BasicDataGenerator(Display &display, BasicFeedback<L> &feedback_instance, unsigned seed = 1);
+
+    // Bytes of one record for n_guesses guesses
+    static size_t record_size(size_t n_guesses) {return (Features::kSize + n_guesses + 3) * sizeof(float);}
+
+    // Write records states to path using every core, in game order so a seed always writes the
+    // same file. Returns false if the file cannot be written
+    bool run(const std::vector<std::string> &guesses, const std::vector<std::string> &answers,
+             size_t records, const std::string &path);
+};
+
+using DataGenerator = BasicDataGenerator<5>;
+
+
+#endif //WORDLE_SOLVED_DATAGENERATOR_H
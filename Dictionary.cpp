@@ -0,0 +1,353 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "Dictionary.h"
+#include "words.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <unordered_map>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    constexpr size_t kBuiltinWordLength = 5;
+
+    // Parse one UTF-8 word per line into symbols, blank lines and # comments are skipped.
+    // A length of 0 is set from the first word, every other word must match it.
+    bool parse_records(const char *data, size_t size, const std::string &path, Alphabet &alphabet,
+                       std::vector<Dictionary::Record> &records, size_t &length, std::string &error) {
+        records.clear();
+        records.reserve(size / (length > 0 ? length + 1 : kBuiltinWordLength + 1) + 1);
+
+        size_t line_number = 0;
+        const char *end = data + size;
+        for (const char *line = data; line < end;) {
+            const char *newline = static_cast<const char *>(std::memchr(line, '\n', end - line));
+            const char *line_end = newline ? newline : end;
+            line_number++;
+
+            const char *first = line, *last = line_end;
+            while (first < last && (*first == ' ' || *first == '\t')) ++first;
+            while (last > first && (last[-1] == ' ' || last[-1] == '\t' || last[-1] == '\r')) --last;
+
+            if (first < last && *first != '#') {
+                std::string raw(first, last), word, reason;
+                if (!alphabet.extend(raw, word, &reason)) {
+                    error = path + ":" + std::to_string(line_number) + ": '" + raw + "': " + reason;
+                    return false;
+                }
+                if (length == 0 && word.size() >= kMinWordLength && word.size() <= kMaxWordLength)
+                    length = word.size();
+
+                if (length == 0 || word.size() != length) {
+                    std::string expected = length > 0
+                        ? std::to_string(length) + " letter word"
+                        : "word of " + std::to_string(kMinWordLength) + " to " + std::to_string(kMaxWordLength) + " letters";
+                    error = path + ":" + std::to_string(line_number) + ": '" + raw + "' is not a " + expected;
+                    return false;
+                }
+
+                Dictionary::Record record{};
+                std::memcpy(record.data(), word.data(), length);
+                records.push_back(record);
+            }
+
+            line = line_end + 1;
+        }
+        return true;
+    }
+
+    constexpr size_t kNerdleLength = 8;
+
+    // Extend expr by numbers (no leading or lone zeros) joined by + - * /, using at most
+    // remaining more characters and folding each number into the running sum and signed
+    // term. Every expression whose whole non-negative result fills the row is an equation.
+    void nerdle_equations(std::string &expr, size_t remaining, long long sum, long long term, char op,
+                          std::vector<std::string> &out) {
+        long long low = 1, high = 9;
+        for (size_t digits = 1; digits <= remaining; ++digits, low *= 10, high = high * 10 + 9) {
+            for (long long number = low; number <= high; ++number) {
+                long long next_sum = sum, next_term = number;
+                if (op == '*') next_term = term * number;
+                else if (op == '/') {
+                    if (term % number != 0) continue;
+                    next_term = term / number;
+                } else if (op == '+' || op == '-') {
+                    next_sum = sum + term;
+                    next_term = op == '-' ? -number : number;
+                }
+
+                std::string number_text = std::to_string(number);
+                expr += number_text;
+                size_t left = remaining - digits;
+
+                if (op != 0) {
+                    long long value = next_sum + next_term;
+                    std::string result = std::to_string(value);
+                    if (value >= 0 && expr.size() + 1 + result.size() == kNerdleLength)
+                        out.push_back(expr + "=" + result);
+                }
+                if (left >= 2) {
+                    for (char next_op : {'+', '-', '*', '/'}) {
+                        expr += next_op;
+                        nerdle_equations(expr, left - 1, next_sum, next_term, next_op, out);
+                        expr.pop_back();
+                    }
+                }
+                expr.resize(expr.size() - number_text.size());
+            }
+        }
+    }
+
+    std::vector<Dictionary::Record> to_records(const char (*words)[kBuiltinWordLength], size_t count) {
+        std::vector<Dictionary::Record> records(count);
+        for (size_t i = 0; i < count; ++i)
+            std::memcpy(records[i].data(), words[i], kBuiltinWordLength);
+        return records;
+    }
+}
+
+#ifdef _WIN32
+
+bool Dictionary::read_records(const std::string &path, std::vector<Record> &records,
+                              size_t &length, std::string &error) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return parse_records(data.data(), data.size(), path, alphabet, records, length, error);
+}
+
+#else
+
+bool Dictionary::read_records(const std::string &path, std::vector<Record> &records,
+                              size_t &length, std::string &error) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error = "cannot open " + path + ": " + std::strerror(errno);
+        return false;
+    }
+
+    struct stat st{};
+    if (fstat(fd, &st) != 0) {
+        error = "cannot stat " + path + ": " + std::strerror(errno);
+        close(fd);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(st.st_size);
+    if (size == 0) {
+        close(fd);
+        records.clear();
+        return true;
+    }
+
+    void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        error = "cannot map " + path + ": " + std::strerror(errno);
+        return false;
+    }
+    madvise(mapped, size, MADV_SEQUENTIAL);
+
+    bool ok = parse_records(static_cast<const char *>(mapped), size, path, alphabet, records, length, error);
+    munmap(mapped, size);
+    return ok;
+}
+
+#endif
+
+void Dictionary::normalise(std::vector<Record> &records) {
+    // Word lists are usually already sorted, skip the sort when they are
+    if (!std::is_sorted(records.begin(), records.end()))
+        std::sort(records.begin(), records.end());
+    records.erase(std::unique(records.begin(), records.end()), records.end());
+}
+
+void Dictionary::set(std::vector<Record> guess_records, std::vector<Record> answer_records, size_t length) {
+    word_length = length;
+    normalise(guess_records);
+    normalise(answer_records);
+
+    // Merge in answers missing from the guess list, both inputs are sorted
+    std::vector<Record> missing;
+    std::set_difference(answer_records.begin(), answer_records.end(),
+                        guess_records.begin(), guess_records.end(),
+                        std::back_inserter(missing));
+    if (!missing.empty()) {
+        std::vector<Record> merged;
+        merged.reserve(guess_records.size() + missing.size());
+        std::merge(guess_records.begin(), guess_records.end(), missing.begin(), missing.end(),
+                   std::back_inserter(merged));
+        guess_records = std::move(merged);
+    }
+
+    guesses = std::move(guess_records);
+    priors.clear();
+    answers.clear();
+    answers.reserve(answer_records.size());
+    for (const Record &answer : answer_records) {
+        auto it = std::lower_bound(guesses.begin(), guesses.end(), answer);
+        answers.push_back(static_cast<uint32_t>(it - guesses.begin()));
+    }
+}
+
+bool Dictionary::load_priors(const std::string &path, std::string &error) {
+    std::ifstream file(path);
+    if (!file) {
+        error = "cannot open " + path;
+        return false;
+    }
+
+    // Answer positions by record
+    std::unordered_map<std::string, size_t> answer_index;
+    for (size_t i = 0; i < answers.size(); ++i)
+        answer_index.emplace(std::string(guesses[answers[i]].data(), word_length), i);
+
+    std::vector<double> weights(answers.size(), -1.0);
+    double smallest = -1.0;
+    std::string line;
+    for (size_t line_number = 1; std::getline(file, line); ++line_number) {
+        std::istringstream fields(line);
+        std::string raw, symbols;
+        double weight;
+        if (!(fields >> raw) || raw[0] == '#') continue;
+        if (!(fields >> weight) || !std::isfinite(weight) || weight < 0) {
+            error = path + ":" + std::to_string(line_number) + ": expected a word and a non-negative weight";
+            return false;
+        }
+        if (!alphabet.encode(raw, symbols)) continue;
+
+        auto it = answer_index.find(symbols);
+        if (it == answer_index.end()) continue;
+        weights[it->second] = weight;
+        if (weight > 0 && (smallest < 0 || weight < smallest)) smallest = weight;
+    }
+
+    if (smallest < 0) {
+        error = path + " gives no answer a positive weight";
+        return false;
+    }
+    for (double &weight : weights)
+        if (weight <= 0) weight = smallest;
+
+    priors = std::move(weights);
+    return true;
+}
+
+void Dictionary::load_builtin(bool fast) {
+    std::vector<Record> answer_records = to_records(VALID_WORDS, VALID_WORD_COUNT);
+    std::vector<Record> guess_records = fast ? answer_records : to_records(ALL_WORDS, ALL_WORD_COUNT);
+    set(std::move(guess_records), std::move(answer_records), kBuiltinWordLength);
+}
+
+bool Dictionary::load(const std::string &guesses_path, const std::string &answers_path, bool fast, std::string &error) {
+    std::vector<Record> guess_records, answer_records;
+    size_t length = 0;
+
+    if (answers_path.empty()) {
+        answer_records = to_records(VALID_WORDS, VALID_WORD_COUNT);
+        length = kBuiltinWordLength;
+    } else if (!read_records(answers_path, answer_records, length, error)) {
+        return false;
+    }
+
+    if (fast) {
+        guess_records = answer_records;
+    } else if (guesses_path.empty()) {
+        if (length != kBuiltinWordLength) {
+            error = "the built-in guess list only has 5 letter words, use --guesses with a " +
+                    std::to_string(length) + " letter list";
+            return false;
+        }
+        guess_records = to_records(ALL_WORDS, ALL_WORD_COUNT);
+    } else if (!read_records(guesses_path, guess_records, length, error)) {
+        return false;
+    }
+
+    if (answer_records.empty()) {
+        error = "answer list is empty";
+        return false;
+    }
+
+    set(std::move(guess_records), std::move(answer_records), length);
+    return true;
+}
+
+bool Dictionary::load_mastermind(size_t pegs, size_t colours, std::string &error) {
+    if (pegs < kMinWordLength || pegs > kMaxWordLength || colours < 2 || colours > 26) {
+        error = "Mastermind needs " + std::to_string(kMinWordLength) + " to " + std::to_string(kMaxWordLength) +
+                " pegs and 2 to 26 colours";
+        return false;
+    }
+
+    size_t count = 1;
+    for (size_t i = 0; i < pegs && count <= kMaxMastermindCodes; ++i) count *= colours;
+    if (count > kMaxMastermindCodes) {
+        error = "Mastermind is limited to " + std::to_string(kMaxMastermindCodes) + " codes, " +
+                std::to_string(pegs) + " pegs of " + std::to_string(colours) + " colours make more";
+        return false;
+    }
+
+    // Codes in order, counting in base colours
+    std::vector<Record> records(count);
+    for (size_t code = 0; code < count; ++code) {
+        size_t rest = code;
+        for (size_t i = pegs; i-- > 0;) {
+            records[code][i] = static_cast<char>('a' + rest % colours);
+            rest /= colours;
+        }
+    }
+
+    alphabet = Alphabet();
+    set(records, records, pegs);
+    return true;
+}
+
+void Dictionary::load_nerdle() {
+    alphabet = Alphabet("0123456789+-*/=");
+
+    // Left hand sides take at most 6 characters, the result the rest
+    std::vector<std::string> equations;
+    std::string expr;
+    nerdle_equations(expr, kNerdleLength - 2, 0, 0, 0, equations);
+
+    std::vector<Record> records;
+    records.reserve(equations.size());
+    for (const auto &equation : equations) {
+        std::string symbols;
+        alphabet.encode(equation, symbols);
+        Record record{};
+        std::memcpy(record.data(), symbols.data(), kNerdleLength);
+        records.push_back(record);
+    }
+    set(records, records, kNerdleLength);
+}
+
+std::vector<std::string> Dictionary::guess_words() const {
+    std::vector<std::string> words;
+    words.reserve(guesses.size());
+    for (const Record &r : guesses)
+        words.emplace_back(r.data(), word_length);
+    return words;
+}
+
+std::vector<std::string> Dictionary::answer_words() const {
+    std::vector<std::string> words;
+    words.reserve(answers.size());
+    for (uint32_t idx : answers)
+        words.emplace_back(guesses[idx].data(), word_length);
+    return words;
+}
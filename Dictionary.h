@@ -0,0 +1,74 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_DICTIONARY_H
+#define WORDLE_SOLVED_DICTIONARY_H
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Alphabet.h"
+#include "WordTraits.h"
+
+
+// Guess and answer lists as sorted, unique fixed size records of alphabet symbols, zero
+// padded past the word length. Every word has the same length in letters, detected from
+// the first word loaded.
+// Answers are stored as indices into the guess list, answers missing from it are merged in.
+class Dictionary {
+public:
+    using Record = std::array<char, kMaxWordLength>;
+
+    // Most Mastermind codes generated, so their feedback table stays within 1 GiB: 4 pegs of up
+    // to 13 colours or 5 of up to 8
+    static constexpr size_t kMaxMastermindCodes = size_t(1) << 15;
+
+private:
+    std::vector<Record> guesses;
+    std::vector<uint32_t> answers;
+    size_t word_length = 0;
+    Alphabet alphabet;
+    std::vector<double> priors;
+
+    // Map a word list file and parse one word per line into records
+    bool read_records(const std::string &path, std::vector<Record> &records,
+                             size_t &length, std::string &error);
+
+    // Sort and remove duplicates
+    static void normalise(std::vector<Record> &records);
+
+    void set(std::vector<Record> guess_records, std::vector<Record> answer_records, size_t length);
+
+public:
+    // Built-in lists, fast uses the answers as the guess list
+    void load_builtin(bool fast);
+
+    // Load from files, an empty path falls back to the built-in list
+    bool load(const std::string &guesses_path, const std::string &answers_path, bool fast, std::string &error);
+
+    // Every Mastermind code of pegs pegs in colours colours, the colours being letters from a.
+    // Fails without generating any when there would be more than kMaxMastermindCodes.
+    bool load_mastermind(size_t pegs, size_t colours, std::string &error);
+
+    // Every valid 8 character Nerdle equation, over the symbols 0-9 + - * / =
+    void load_nerdle();
+
+    // Relative answer weights, one "word weight" pair per line. Answers left out get the
+    // smallest weight listed, words that are not answers are ignored.
+    bool load_priors(const std::string &path, std::string &error);
+
+    size_t get_word_length() const {return word_length;}
+    const Alphabet &get_alphabet() const {return alphabet;}
+    const std::vector<Record> &get_guess_records() const {return guesses;}
+    const std::vector<uint32_t> &get_answer_indices() const {return answers;}
+    // Weights in answer_words() order, empty without priors
+    const std::vector<double> &get_priors() const {return priors;}
+
+    std::vector<std::string> guess_words() const;
+    std::vector<std::string> answer_words() const;
+};
+
+
+#endif //WORDLE_SOLVED_DICTIONARY_H
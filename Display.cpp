@@ -8,10 +8,8 @@
 #include <cstdlib>
 #include <vector>
 
-bool Display::global_silent = false;
-
 void Display::showProgress(const std::string& title, size_t workDone, size_t totalWork) {
-    if (global_silent) return;
+    if (silent) return;
 
     // Initialize progress if not started
     if (!progress.started || totalWork != progress.totalWork) {
@@ -30,7 +28,7 @@ void Display::showProgress(const std::string& title, size_t workDone, size_t tot
 }
 
 void Display::displayProgressBar(const std::string& title) const {
-    if (global_silent) return;
+    if (silent) return;
 
     using namespace std::chrono;
     const int barWidth = 50;
@@ -71,9 +69,9 @@ void Display::displayProgressBar(const std::string& title) const {
 }
 
 void Display::showGuesses(
-    const std::vector<std::pair<std::string, uint8_t>>& guessFeedback,
+    const std::vector<std::pair<std::string, uint16_t>>& guessFeedback,
     const std::string& currentGuess) {
-    if (global_silent) return;
+    if (silent) return;
 
     std::cout << "\n";
     for (const auto& [guess, fB] : guessFeedback) {
@@ -90,7 +88,7 @@ void Display::showGuesses(
         }
 
         for (size_t i = 0; i < guess.size(); ++i) {
-            char letter = guess[i];
+            const std::string &letter = alphabet.symbol(guess[i]);
 
             if (fbVector[i] == 2)
                 std::cout << "\033[1;42;30m " << letter << " \033[0m"; // Green
@@ -112,12 +110,12 @@ void Display::showGuesses(
 }
 
 void Display::showOutput(const std::string& output) {
-    if (global_silent) return;
+    if (silent) return;
     std::cout << output << std::endl;
 }
 
 void Display::clearDisplay() {
-    if (global_silent) return;
+    if (silent) return;
 
 #ifdef _WIN32
     std::system("cls");
@@ -5,10 +5,12 @@
 #ifndef WORDLE_SOLVED_DISPLAY_H
 #define WORDLE_SOLVED_DISPLAY_H
 #pragma once
+#include <cstdint>
 #include <string>
 #include <chrono>
 #include <mutex>
 #include <vector>
+#include "Alphabet.h"
 
 class Display {
 private:
@@ -21,19 +23,20 @@ private:
 
     ProgressData progress;
     std::mutex cout_mutex;
-    static bool global_silent;
+    bool silent = false;
+    Alphabet alphabet;
 
     void displayProgressBar(const std::string& title) const;
 
 public:
     Display() {progress.started = false;}
-    Display(bool silent) {progress.started = false; global_silent = silent;}
+    Display(bool silent) : silent(silent) {progress.started = false;}
 
     // Start or update a progress bar
     void showProgress(const std::string& title, size_t workDone, size_t totalWork);
 
     void showGuesses(
-        const std::vector<std::pair<std::string, uint8_t>>& guessFeedback,
+        const std::vector<std::pair<std::string, uint16_t>>& guessFeedback,
         const std::string& currentGuess= ""
         );
 
@@ -43,8 +46,13 @@ public:
 
     std::mutex& getMutex() {return cout_mutex;};
 
-    static void setSilent(bool silent) {global_silent = silent;}
-    static bool isSilent() {return global_silent;}
+    void setSilent(bool is_silent) {silent = is_silent;}
+    bool isSilent() const {return silent;}
+
+    // Alphabet of the loaded dictionary, words are decoded with it for output
+    void setAlphabet(const Alphabet &word_alphabet) {alphabet = word_alphabet;}
+    const Alphabet &getAlphabet() const {return alphabet;}
+    std::string word(const std::string &symbols) const {return alphabet.decode(symbols);}
 };
 
 
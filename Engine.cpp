@@ -0,0 +1,21 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "Engine.h"
+#include <utility>
+
+template<size_t L, class Rule>
+BasicEngine<L, Rule>::BasicEngine(bool silent)
+    : display(silent),
+      feedback(display) {}
+
+template<size_t L, class Rule>
+void BasicEngine<L, Rule>::load(std::vector<std::string> guess_list, std::vector<std::string> answer_list) {
+    guesses = std::move(guess_list);
+    answers = std::move(answer_list);
+    feedback.precache_feedback(guesses);
+}
+
+WORDLE_SOLVED_INSTANTIATE(BasicEngine)
+WORDLE_SOLVED_INSTANTIATE_RULES(BasicEngine)
@@ -0,0 +1,45 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_ENGINE_H
+#define WORDLE_SOLVED_ENGINE_H
+#pragma once
+#include <string>
+#include <vector>
+#include "Display.h"
+#include "Feedback.h"
+
+
+// Engine context for one configuration: its own display settings, word lists and
+// feedback/log tables. Tables are immutable and shared by every engine loading the
+// same word list, so several engines can run side by side in one process.
+template<size_t L, class Rule = WordleRule<L>>
+class BasicEngine {
+private:
+    Display display;
+    BasicFeedback<L, Rule> feedback;
+    std::vector<std::string> guesses;
+    std::vector<std::string> answers;
+
+public:
+    explicit BasicEngine(bool silent = false);
+
+    BasicEngine(const BasicEngine &) = delete;
+    BasicEngine &operator=(const BasicEngine &) = delete;
+
+    // Set the word lists and build (or share) their tables
+    void load(std::vector<std::string> guess_list, std::vector<std::string> answer_list);
+
+    Display &get_display() {return display;}
+    BasicFeedback<L, Rule> &get_feedback() {return feedback;}
+    const BasicFeedback<L, Rule> &get_feedback() const {return feedback;}
+
+    const std::vector<std::string> &get_guesses() const {return guesses;}
+    const std::vector<std::string> &get_answers() const {return answers;}
+};
+
+using Engine = BasicEngine<5>;
+
+
+#endif //WORDLE_SOLVED_ENGINE_H
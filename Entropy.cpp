@@ -3,87 +3,354 @@
 //
 
 #include "Entropy.h"
+#include "AllocationCounter.h"
+#include "StateFeatures.h"
 #include "ThreadPool.h"
+#include "TiledEntropy.h"
 #include <algorithm>
 #include <array>
-#include <future>
 #include <vector>
 #include <string>
 #include <cmath>
 #include <thread>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <limits>
+#include <mutex>
+#include <type_traits>
+
+namespace {
+    uint64_t mix(uint64_t x) {
+        x += 0x9e3779b97f4a7c15ull;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+        return x ^ (x >> 31);
+    }
+
+    uint64_t word_hash(const std::string &word) {
+        uint64_t hash = 14695981039346656037ull;
+        for (char c : word) hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+        return mix(hash);
+    }
+
+    // Everything a best branch score depends on besides the candidates
+    uint64_t subtree_context(uint64_t guess_list, Metric metric, int depth) {
+        return mix(guess_list ^ mix(static_cast<uint64_t>(metric) << 8 | static_cast<uint64_t>(depth)));
+    }
+}
+
+template<size_t L, class Rule>
+BasicEntropy<L, Rule>::BasicEntropy(const BasicFeedback<L, Rule> &fbCache, size_t threads)
+    : cache(fbCache),
+      n_threads(threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency())) {}
+
+// Candidate sets hash as the sum of their word hashes, so the order they were filtered in
+// does not matter
+template<size_t L, class Rule>
+uint64_t BasicEntropy<L, Rule>::subtree_set(const Search &search_state, const Node &node) const {
+    uint64_t sum = 0;
+    for (size_t c = 0; c < node.size; ++c) sum += search_state.hashes[node.ids[c]];
+    return mix(sum + node.size);
+}
+
+template<size_t L, class Rule>
+uint64_t BasicEntropy<L, Rule>::subtree_key(uint64_t context, uint64_t set) {
+    return mix(context ^ set) | 1;
+}
+
+// Keys live in the even slot of their pair or the odd one after it, the newest first
+template<size_t L, class Rule>
+bool BasicEntropy<L, Rule>::find_subtree(uint64_t key, double &value) const {
+    size_t slot = static_cast<size_t>(key >> 1) & (kSubtreeSlots - 2);
+    std::lock_guard<std::mutex> lock(subtrees.mutexes[(slot >> 1) % kSubtreeShards]);
+    for (size_t s = slot; s < slot + 2; ++s) {
+        if (subtrees.slots[s].first == key) {
+            value = subtrees.slots[s].second;
+            return true;
+        }
+    }
+    return false;
+}
+
+template<size_t L, class Rule>
+void BasicEntropy<L, Rule>::store_subtree(uint64_t key, double value) const {
+    size_t slot = static_cast<size_t>(key >> 1) & (kSubtreeSlots - 2);
+    std::lock_guard<std::mutex> lock(subtrees.mutexes[(slot >> 1) % kSubtreeShards]);
+    if (subtrees.slots[slot].first != key) subtrees.slots[slot + 1] = subtrees.slots[slot];
+    subtrees.slots[slot] = {key, value};
+}
+
+template<size_t L, class Rule>
+std::vector<uint32_t> BasicEntropy<L, Rule>::get_ids(const std::vector<std::string> &words) const {
+    std::vector<uint32_t> ids(words.size());
+    for (size_t i = 0; i < words.size(); ++i)
+        ids[i] = static_cast<uint32_t>(cache.index_of(words[i]));
+    return ids;
+}
 
-Entropy::Entropy(const Feedback &fbCache) : cache(fbCache) {}
+template<size_t L, class Rule>
+std::vector<uint64_t> BasicEntropy<L, Rule>::get_hashes(const std::vector<uint32_t> &solution_ids) const {
+    std::vector<uint64_t> hashes(cache.size(), 0);
+    const std::vector<std::string> &words = cache.get_words();
+    for (uint32_t id : solution_ids) hashes[id] = word_hash(words[id]);
+    return hashes;
+}
+
+template<size_t L, class Rule>
+typename BasicEntropy<L, Rule>::Search BasicEntropy<L, Rule>::make_search(
+    const std::vector<std::string> &next_guesses,
+    const std::vector<uint32_t> &next_ids,
+    const std::vector<uint32_t> &solution_ids,
+    const std::vector<uint64_t> &hashes,
+    Metric metric,
+    int k
+) const {
+    Search search_state{next_ids.data(), next_ids.size(), hashes.data(), {}, 0, &cache.get_log_cache(), cache.weight_unit()};
+    if (k > 1) {
+        std::call_once(subtrees.allocated, [this]() { subtrees.slots.assign(kSubtreeSlots, {0, 0.0}); });
+        uint64_t guess_list = 0;
+        for (const auto &guess : next_guesses) guess_list = mix(guess_list ^ word_hash(guess));
+
+        std::lock_guard<std::mutex> lock(lineage.mutex);
+        advance_lineage(next_ids, solution_ids, guess_list);
+        search_state.seeds = lineage.seeds.size();
+        for (size_t s = 0; s < search_state.seeds; ++s) {
+            uint64_t seed = lineage.seeds[search_state.seeds - 1 - s];
+            for (int depth = 1; depth < k && depth < static_cast<int>(search_state.contexts[s].size()); ++depth)
+                search_state.contexts[s][depth] = subtree_context(seed, metric, depth);
+        }
+    }
+    return search_state;
+}
+
+template<size_t L, class Rule>
+void BasicEntropy<L, Rule>::advance_lineage(
+    const std::vector<uint32_t> &next_ids,
+    const std::vector<uint32_t> &solution_ids,
+    uint64_t guess_list
+) const {
+    lineage.listed.resize(cache.size(), 0);
+    lineage.candidates.resize(cache.size(), 0);
+
+    // Lists and candidates can only shrink along a lineage
+    bool continues = !lineage.seeds.empty();
+    size_t kept = 0;
+    for (uint32_t id : next_ids) kept += lineage.listed[id];
+    for (uint32_t id : solution_ids) continues = continues && lineage.candidates[id];
+    continues = continues && kept == next_ids.size();
+
+    // Every guess dropped since must give the candidates a single bucket
+    uint64_t removed = 0;
+    size_t n_removed = 0;
+    if (continues) {
+        for (uint32_t id : lineage.list) lineage.listed[id] = 0;
+        for (uint32_t id : next_ids) lineage.listed[id] = 1;
+        for (uint32_t id : lineage.list) {
+            if (lineage.listed[id] || !continues) continue;
+            const Pattern *row = cache.row(id);
+            for (uint32_t c : solution_ids) continues = continues && row[c] == row[solution_ids.front()];
+            removed += word_hash(cache.get_words()[id]);
+            ++n_removed;
+        }
+    }
 
-// Logarithm Cache
-std::vector<double> Entropy::log_cache;
+    if (!continues) {
+        lineage.seeds.assign(1, guess_list);
+    } else if (n_removed > 0) {
+        if (lineage.seeds.size() == kLineageTurns) lineage.seeds.erase(lineage.seeds.begin());
+        lineage.seeds.push_back(mix(lineage.seeds.back() ^ removed));
+    }
 
-void Entropy::precache_log(size_t max_size,
-                    Display& display) {
-    log_cache.resize(max_size + 1);
+    for (uint32_t id : lineage.list) lineage.listed[id] = 0;
+    for (uint32_t id : next_ids) lineage.listed[id] = 1;
+    lineage.list = next_ids;
+    std::fill(lineage.candidates.begin(), lineage.candidates.end(), 0);
+    for (uint32_t id : solution_ids) lineage.candidates[id] = 1;
+}
 
-    for (size_t i = 1; i <= max_size; ++i) {
-        double p = static_cast<double>(i) / max_size;
-        log_cache[i] = std::log2(p);
+template<size_t L, class Rule>
+size_t BasicEntropy<L, Rule>::scratch_size(size_t n, int k) {
+    size_t frame = 2 * (Traits::patterns * sizeof(uint32_t) + Arena::kAlignment);
+    return 2 * (n * sizeof(uint32_t) + Arena::kAlignment) + static_cast<size_t>(k + 1) * frame;
+}
 
-        if (i % 100 == 0 || i == max_size) {
-            display.showProgress("Caching log2", i, max_size);
+// American flag sort: count the buckets, then swap every candidate into its bucket's range
+template<size_t L, class Rule>
+void BasicEntropy<L, Rule>::partition(
+    const Pattern *row,
+    Node &node,
+    uint32_t *starts,
+    uint32_t *sizes,
+    std::array<size_t, Traits::patterns> &counts
+) const {
+    std::fill(sizes, sizes + Traits::patterns, 0u);
+    counts.fill(0);
+    for (size_t c = 0; c < node.size; ++c) {
+        Pattern fb = row[node.ids[c]];
+        sizes[fb]++;
+        counts[fb] += node.weights[c];
+    }
+
+    // starts doubles as each bucket's fill position until its range is full
+    uint32_t offset = 0;
+    for (size_t p = 0; p < Traits::patterns; ++p) {
+        starts[p] = offset;
+        offset += sizes[p];
+    }
+    uint32_t end = 0;
+    for (size_t p = 0; p < Traits::patterns; ++p) {
+        end += sizes[p];
+        while (starts[p] < end) {
+            Pattern fb = row[node.ids[starts[p]]];
+            if (fb == p) {
+                starts[p]++;
+                continue;
+            }
+            std::swap(node.ids[starts[p]], node.ids[starts[fb]]);
+            std::swap(node.weights[starts[p]], node.weights[starts[fb]]);
+            starts[fb]++;
         }
     }
+    for (size_t p = 0; p < Traits::patterns; ++p) starts[p] -= sizes[p];
+}
+
+template<size_t L, class Rule>
+template<class Score>
+double BasicEntropy<L, Rule>::search(const Search &search_state, uint32_t guess, Node &node, int k, Arena &arena) const {
+    const Pattern *row = cache.row(guess);
+    std::array<size_t, Traits::patterns> counts{};
+    if (k <= 1) {
+        for (size_t c = 0; c < node.size; ++c) counts[row[node.ids[c]]] += node.weights[c];
+        return Score::score(counts, node.total, Traits::solved, search_state.unit, *search_state.log_cache);
+    }
+
+    Arena::Mark mark = arena.mark();
+    uint32_t *starts = arena.alloc<uint32_t>(Traits::patterns);
+    uint32_t *sizes = arena.alloc<uint32_t>(Traits::patterns);
+    partition(row, node, starts, sizes, counts);
+
+    // Fold in the best score of each unsolved bucket one step further
+    double current = Score::score(counts, node.total, Traits::solved, search_state.unit, *search_state.log_cache);
+    double value = Score::first(current, static_cast<double>(counts[Traits::solved]) / node.total);
+    for (size_t fb = 0; fb < Traits::patterns; ++fb) {
+        if (counts[fb] == 0 || fb == Traits::solved) continue;
+        Node child{node.ids + starts[fb], node.weights + starts[fb], sizes[fb], counts[fb]};
+        double best = best_branch<Score>(search_state, child, k - 1, arena);
+        value = Score::fold(value, static_cast<double>(counts[fb]) / node.total, best);
+    }
+
+    arena.release(mark);
+    return value;
+}
+
+template<size_t L, class Rule>
+template<class Score>
+double BasicEntropy<L, Rule>::best_branch(const Search &search_state, Node &node, int depth, Arena &arena) const {
+    uint64_t set = subtree_set(search_state, node);
+    double best = Score::maximise ? 0.0 : std::numeric_limits<double>::infinity();
+    for (size_t s = 0; s < search_state.seeds; ++s) {
+        if (!find_subtree(subtree_key(search_state.contexts[s][depth], set), best)) continue;
+        if (s > 0) cross_turn_hits.fetch_add(1, std::memory_order_relaxed);
+        return best;
+    }
+
+    for (size_t h = 0; h < search_state.n_guesses; ++h) {
+        double score = search<Score>(search_state, search_state.guesses[h], node, depth, arena);
+        best = Score::maximise ? std::max(best, score) : std::min(best, score);
+    }
+    store_subtree(subtree_key(search_state.contexts[0][depth], set), best);
+    return best;
 }
 
 // Feedback Count
-std::array<size_t, 243> Entropy::get_feedback_count(
+template<size_t L, class Rule>
+std::array<size_t, Rule::patterns> BasicEntropy<L, Rule>::get_feedback_count(
     const std::string &guess,
     const std::vector<std::string> &solutions,
     const std::vector<size_t> &indices
 ) const {
-    std::array<size_t, 243> counts{};
+    std::array<size_t, Traits::patterns> counts{};
     counts.fill(0);
 
     for (size_t idx : indices) {
-        uint8_t db = cache.get_feedback_cached(guess, solutions[idx]);
+        Pattern db = cache.get_feedback_cached(guess, solutions[idx]);
     }
 
     return counts;
 }
 
-// Single-step Entropies
-std::vector<std::pair<std::string, double>> Entropy::get_entropy(
+// Single-step Scores
+template<size_t L, class Rule>
+template<class Score>
+std::vector<std::pair<std::string, double>> BasicEntropy<L, Rule>::get_entropy(
     const std::vector<std::string> &guesses,
     const std::vector<std::string> &solutions,
+    const std::vector<uint32_t> &weights,
     const std::vector<size_t> &indices
 ) const {
     std::vector<std::pair<std::string, double>> results;
     results.reserve(guesses.size());
 
-    size_t total = indices.size();
+    size_t total = 0;
+    for (size_t idx : indices) total += weights[idx];
     if (total == 0) return results;
 
+    const std::vector<double> &log_cache = cache.get_log_cache();
+    size_t unit = cache.weight_unit();
+
     for (const auto &guess : guesses) {
-        std::array<size_t, 243> counts{};
+        std::array<size_t, Traits::patterns> counts{};
         for (size_t idx : indices) {
-            uint8_t fb = cache.get_feedback_cached(guess, solutions[idx]);
-            counts[fb]++;
+            Pattern fb = cache.get_feedback_cached(guess, solutions[idx]);
+            counts[fb] += weights[idx];
         }
 
+        results.emplace_back(guess, Score::score(counts, total, Traits::solved, unit, log_cache));
+    }
+
+    return results;
+}
+
+// Single-step Entropies by index, written to a caller-provided buffer
+template<size_t L, class Rule>
+void BasicEntropy<L, Rule>::get_entropy_indices(
+    const uint32_t *guesses,
+    size_t n_guesses,
+    const uint32_t *candidates,
+    size_t n_candidates,
+    double *out
+) const {
+    if (n_candidates == 0) {
+        std::fill(out, out + n_guesses, 0.0);
+        return;
+    }
+
+    double log_total = std::log2(static_cast<double>(n_candidates));
+    const std::vector<double> &log_cache = cache.get_log_cache();
+
+    for (size_t g = 0; g < n_guesses; ++g) {
+        const Pattern *row = cache.row(guesses[g]);
+
+        std::array<uint32_t, Traits::patterns> counts{};
+        for (size_t c = 0; c < n_candidates; ++c)
+            counts[row[candidates[c]]]++;
+
         double entropy = 0.0;
-        for (size_t count : counts) {
+        for (uint32_t count : counts) {
             if (count == 0) continue;
-            double p = static_cast<double>(count) / total;
-            double logp = (count < log_cache.size()) ? log_cache[count] - std::log2(total) : std::log2(p);
-            entropy -= p * logp;
+            double p = static_cast<double>(count) / n_candidates;
+            double logc = (count < log_cache.size()) ? log_cache[count] : std::log2(static_cast<double>(count));
+            entropy -= p * (logc - log_total);
         }
-
-        results.emplace_back(guess, entropy);
+        out[g] = entropy;
     }
-
-    return results;
 }
 
 // Get Next Step Entropies
-std::vector<std::pair<std::string, double>> Entropy::get_next_entropy(
+template<size_t L, class Rule>
+std::vector<std::pair<std::string, double>> BasicEntropy<L, Rule>::get_next_entropy(
     const std::vector<std::pair<std::string, double>> &entropies,
     const std::vector<std::string> &guesses,
     const std::vector<std::string> &solutions
@@ -95,16 +362,17 @@ std::vector<std::pair<std::string, double>> Entropy::get_next_entropy(
     for (size_t i = 0; i < solutions.size(); ++i) {
         indices[i] = i;
     }
+    std::vector<uint32_t> weights = cache.get_weights(solutions);
 
     for (const auto &[first_guess, _] : entropies) {
         // Partition solutions by feedback pattern
-        std::array<std::vector<size_t>, 243> partitions;
+        std::array<std::vector<size_t>, Traits::patterns> partitions;
         for (size_t i = 0; i < solutions.size(); ++i) {
-            partitions[i].reserve(solutions.size() / 243 + 1);
+            partitions[i].reserve(solutions.size() / Traits::patterns + 1);
         }
 
         for (size_t idx : indices) {
-            uint8_t fb = cache.get_feedback_cached(first_guess, solutions[idx]);
+            Pattern fb = cache.get_feedback_cached(first_guess, solutions[idx]);
             partitions[fb].push_back(idx);
         }
 
@@ -115,7 +383,7 @@ std::vector<std::pair<std::string, double>> Entropy::get_next_entropy(
             const auto &subset = partitions[fb];
             if (subset.empty()) continue;
 
-            auto sub_entropies = get_entropy(guesses, solutions, subset);
+            auto sub_entropies = get_entropy<EntropyScore>(guesses, solutions, weights, subset);
 
             double weight = static_cast<double>(subset.size()) / solutions.size();
             for (size_t i = 0; i < sub_entropies.size(); i++) {
@@ -131,9 +399,12 @@ std::vector<std::pair<std::string, double>> Entropy::get_next_entropy(
     return result;
 }
 
-// Get N-Step Entropies
-std::vector<std::pair<std::string, double>> Entropy::get_n_step_entropy(
+// Get N-Step Scores
+template<size_t L, class Rule>
+template<class Score>
+std::vector<std::pair<std::string, double>> BasicEntropy<L, Rule>::get_n_step_scores(
     const std::vector<std::string> &guesses,
+    const std::vector<std::string> &next_guesses,
     const std::vector<std::string> &solutions,
     int k,
     std::atomic<size_t> &progress,
@@ -142,118 +413,417 @@ std::vector<std::pair<std::string, double>> Entropy::get_n_step_entropy(
     std::vector<std::pair<std::string, double>> results(guesses.size());
     if (solutions.empty()) return results;
 
-    auto compute_for_guess = [&](size_t i) {
-        const std::string &guess = guesses[i];
-        size_t total = solutions.size();
+    // Candidates accumulate their prior weights, all 1 without priors
+    std::vector<uint32_t> solution_ids = get_ids(solutions);
+    std::vector<uint32_t> weights = cache.get_weights(solutions);
+    size_t total = 0;
+    for (uint32_t w : weights) total += w;
+
+    std::vector<uint32_t> guess_ids = get_ids(guesses);
+    std::vector<uint32_t> next_ids = get_ids(next_guesses);
+    std::vector<uint64_t> hashes = get_hashes(solution_ids);
+    Search search_state = make_search(next_guesses, next_ids, solution_ids, hashes, Score::metric, k);
+
+    // Single-step histograms of most of the answers are the turn-1 ones minus the removed few
+    std::vector<uint32_t> removed;
+    bool derived = k == 1 && histograms && !cache.is_weighted() && histograms->get_removed(solutions, removed);
+
+    // Scores by guess index, each block searching its own copy of the candidates
+    std::vector<double> scores(guesses.size());
+    size_t n = solutions.size();
+    auto score_block = [&](size_t start, size_t end) {
+        Arena arena(scratch_size(n, k));
+        Node root{arena.alloc<uint32_t>(n), arena.alloc<uint32_t>(n), n, total};
+        std::copy(solution_ids.begin(), solution_ids.end(), root.ids);
+        std::copy(weights.begin(), weights.end(), root.weights);
+
+        size_t before = AllocationCounter::allocations(arena);
+        for (size_t i = start; i < end; ++i) {
+            if (derived) {
+                std::array<size_t, Traits::patterns> counts;
+                histograms->get_counts(guess_ids[i], removed, counts);
+                scores[i] = Score::score(counts, total, Traits::solved, search_state.unit, *search_state.log_cache);
+            } else {
+                scores[i] = search<Score>(search_state, guess_ids[i], root, k, arena);
+            }
+            if (top_level)
+                progress.fetch_add(1, std::memory_order_relaxed);
+        }
+        scoring_allocations.fetch_add(AllocationCounter::allocations(arena) - before, std::memory_order_relaxed);
+    };
+
+    size_t n_guesses = guesses.size();
+    if (top_level) {
+        ThreadPool pool(n_threads);
+        pool.parallel_for(0, n_guesses, ThreadPool::block_size(n_guesses, n_threads), score_block);
+    } else {
+        score_block(0, n_guesses);
+    }
+
+    for (size_t i = 0; i < n_guesses; ++i)
+        results[i] = {guesses[i], scores[i]};
+    return results;
+}
+
+template<size_t L, class Rule>
+std::vector<std::pair<std::string, double>> BasicEntropy<L, Rule>::get_n_step_entropy(
+    const std::vector<std::string> &guesses,
+    const std::vector<std::string> &solutions,
+    int k,
+    std::atomic<size_t> &progress,
+    bool top_level
+) const {
+    return get_n_step_scores<EntropyScore>(guesses, guesses, solutions, k, progress, top_level);
+}
 
-        // 1. Precompute feedbacks
-        std::vector<uint8_t> feedbacks(total);
-        std::array<size_t, 243> counts{};
-        counts.fill(0);
+// Survivors by positional letter frequency
+template<size_t L, class Rule>
+std::vector<size_t> BasicEntropy<L, Rule>::get_survivors(
+    const std::vector<std::string> &guesses,
+    const std::vector<std::string> &solutions,
+    size_t survivors
+) const {
+    // Candidate weight with each symbol at each position, and containing each symbol
+    std::vector<uint64_t> positional(L * 256, 0);
+    std::array<uint64_t, 256> present{};
+    std::vector<uint32_t> weights = cache.get_weights(solutions);
+    for (size_t j = 0; j < solutions.size(); ++j) {
+        const std::string &solution = solutions[j];
+        for (size_t p = 0; p < L; ++p) {
+            unsigned char c = static_cast<unsigned char>(solution[p]);
+            positional[p * 256 + c] += weights[j];
+            if (solution.find(solution[p]) == p) present[c] += weights[j];
+        }
+    }
 
-        for (size_t j = 0; j < total; ++j) {
-            uint8_t fb = cache.get_feedback_cached(guess, solutions[j]);
-            feedbacks[j] = fb;
-            counts[fb]++;
+    // One sweep per position over every guess, a repeated letter only scores its position
+    size_t n_guesses = guesses.size();
+    std::vector<uint64_t> score(n_guesses, 0);
+    for (size_t p = 0; p < L; ++p) {
+        const uint64_t *column = positional.data() + p * 256;
+        for (size_t g = 0; g < n_guesses; ++g) {
+            const char *word = guesses[g].data();
+            unsigned char c = static_cast<unsigned char>(word[p]);
+            uint64_t first = 1;
+            for (size_t q = 0; q < p; ++q) first &= word[q] != word[p];
+            score[g] += column[c] + present[c] * first;
         }
+    }
 
-        // 2. Single-step entropy
-        double H_current = 0.0;
-        for (size_t count : counts) {
-            if (count == 0) continue;
-            double p = static_cast<double>(count) / total;
-            double logp = (count < log_cache.size()) ? log_cache[count] - std::log2(total) : std::log2(p);
-            H_current -= p * logp;
+    std::vector<size_t> order(n_guesses);
+    for (size_t g = 0; g < n_guesses; ++g) order[g] = g;
+    survivors = std::min(survivors, n_guesses);
+    std::nth_element(order.begin(), order.begin() + survivors, order.end(), [&](size_t a, size_t b) {
+        return score[a] != score[b] ? score[a] > score[b] : a < b;
+    });
+    order.resize(survivors);
+
+    // Back in guess order, so ties break as they do without the prefilter
+    std::sort(order.begin(), order.end());
+    return order;
+}
+
+// Safe two-stage entropy ranking, two steps deep
+template<size_t L, class Rule>
+std::vector<std::pair<std::string, double>> BasicEntropy<L, Rule>::get_bounded_scores(
+    const std::vector<std::string> &guesses,
+    const std::vector<std::string> &solutions,
+    std::atomic<size_t> &progress
+) const {
+    size_t n_guesses = guesses.size();
+    size_t n = solutions.size();
+
+    std::vector<uint32_t> solution_ids = get_ids(solutions);
+    std::vector<uint32_t> weights = cache.get_weights(solutions);
+    size_t total = 0;
+    for (uint32_t w : weights) total += w;
+
+    std::vector<uint32_t> guess_ids = get_ids(guesses);
+    std::vector<uint64_t> hashes = get_hashes(solution_ids);
+    Search search_state = make_search(guesses, guess_ids, solution_ids, hashes, Metric::Entropy, 2);
+
+    // Stage 1: single-step entropy of every guess, straight from the table rows
+    std::vector<double> first(n_guesses);
+    size_t block = ThreadPool::block_size(n_guesses, n_threads);
+    ThreadPool pool(n_threads);
+    pool.parallel_for(0, n_guesses, block, [&](size_t start, size_t end) {
+        Arena arena(scratch_size(n, 1));
+        Node root{arena.alloc<uint32_t>(n), arena.alloc<uint32_t>(n), n, total};
+        std::copy(solution_ids.begin(), solution_ids.end(), root.ids);
+        std::copy(weights.begin(), weights.end(), root.weights);
+        for (size_t g = start; g < end; ++g)
+            first[g] = search<EntropyScore>(search_state, guess_ids[g], root, 1, arena);
+    });
+
+    std::vector<size_t> order(n_guesses);
+    for (size_t g = 0; g < n_guesses; ++g) order[g] = g;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return first[a] != first[b] ? first[a] > first[b] : a < b;
+    });
+
+    // Stage 2: exact scores in that order. The survivors seed the best score, every later
+    // guess stops once its bound falls below it. A bucket of s candidates has at most
+    // min(s, patterns) outcomes, so its best next guess gains at most the log of that.
+    std::vector<std::pair<std::string, double>> results(n_guesses);
+    for (size_t g = 0; g < n_guesses; ++g)
+        results[g] = {guesses[g], -std::numeric_limits<double>::infinity()};
+
+    std::mutex best_mutex;
+    double best = -std::numeric_limits<double>::infinity();
+    double cap = std::log2(static_cast<double>(Traits::patterns));
+
+    auto evaluate = [&](size_t g, bool bounded, Node &root, Arena &arena) {
+        Arena::Mark mark = arena.mark();
+        uint32_t *starts = arena.alloc<uint32_t>(Traits::patterns);
+        uint32_t *sizes = arena.alloc<uint32_t>(Traits::patterns);
+        uint32_t *buckets = arena.alloc<uint32_t>(Traits::patterns);
+        std::array<size_t, Traits::patterns> counts;
+        partition(cache.row(guess_ids[g]), root, starts, sizes, counts);
+
+        // Largest buckets first, they move the bound the most
+        size_t n_buckets = 0;
+        double rest = 0.0;
+        for (size_t fb = 0; fb < counts.size(); ++fb) {
+            if (counts[fb] == 0 || fb == Traits::solved) continue;
+            buckets[n_buckets++] = static_cast<uint32_t>(fb);
+            rest += static_cast<double>(counts[fb]) / total * std::min(std::log2(static_cast<double>(sizes[fb])), cap);
         }
+        std::sort(buckets, buckets + n_buckets, [&](uint32_t a, uint32_t b) { return sizes[a] > sizes[b]; });
+
+        std::array<double, Traits::patterns> child{};
+        double partial = first[g];
+        for (size_t b = 0; b < n_buckets; ++b) {
+            size_t fb = buckets[b];
+            if (bounded) {
+                std::lock_guard<std::mutex> lock(best_mutex);
+                if (partial + rest < best - 1e-9) {
+                    arena.release(mark);
+                    progress.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+            }
 
-        // 3. Weighted max entropy for next step
-        double H_next = 0.0;
-        if (k > 1) {
-            for (size_t fb = 0; fb < counts.size(); ++fb) {
-                size_t count = counts[fb];
-                if (count == 0) continue;
-
-                // Collect subset indices
-                std::vector<size_t> subset_indices;
-                subset_indices.reserve(count);
-                for (size_t j = 0; j < feedbacks.size(); ++j)
-                    if (feedbacks[j] == fb)
-                        subset_indices.push_back(j);
-
-                if (subset_indices.empty()) continue;
-
-                // Compute next-step entropy recursively
-                double max_branch_entropy = 0.0;
-                if (k > 2) {
-                    auto next_entropies = get_n_step_entropy(guesses, solutions, k - 1, progress, false);
-                    for (auto &[g, e] : next_entropies)
-                        if (e > max_branch_entropy) max_branch_entropy = e;
-                } else {
-                    auto entropies = get_entropy(guesses, solutions, subset_indices);
-                    for (auto &[g, e] : entropies)
-                        if (e > max_branch_entropy) max_branch_entropy = e;
+            Node bucket{root.ids + starts[fb], root.weights + starts[fb], sizes[fb], counts[fb]};
+            child[fb] = best_branch<EntropyScore>(search_state, bucket, 1, arena);
+
+            double weight = static_cast<double>(counts[fb]) / total;
+            partial += weight * child[fb];
+            rest -= weight * std::min(std::log2(static_cast<double>(sizes[fb])), cap);
+        }
+        arena.release(mark);
+
+        // Summed in pattern order, as the full search does, so scores match it exactly
+        double value = first[g];
+        for (size_t fb = 0; fb < counts.size(); ++fb)
+            if (counts[fb] != 0 && fb != Traits::solved)
+                value += static_cast<double>(counts[fb]) / total * child[fb];
+
+        results[g].second = value;
+        {
+            std::lock_guard<std::mutex> lock(best_mutex);
+            best = std::max(best, value);
+        }
+        progress.fetch_add(1, std::memory_order_relaxed);
+    };
+
+    // Blocks of guesses in ranked order, each searching its own copy of the candidates
+    auto evaluate_block = [&](size_t start, size_t end, bool bounded) {
+        Arena arena(scratch_size(n, 2) + 2 * Traits::patterns * sizeof(uint32_t));
+        Node root{arena.alloc<uint32_t>(n), arena.alloc<uint32_t>(n), n, total};
+        std::copy(solution_ids.begin(), solution_ids.end(), root.ids);
+        std::copy(weights.begin(), weights.end(), root.weights);
+        size_t before = AllocationCounter::allocations(arena);
+        for (size_t i = start; i < end; ++i) evaluate(order[i], bounded, root, arena);
+        scoring_allocations.fetch_add(AllocationCounter::allocations(arena) - before, std::memory_order_relaxed);
+    };
+
+    size_t survivors = std::min(prefilter_survivors, n_guesses);
+    pool.parallel_for(0, survivors, block, [&](size_t start, size_t end) { evaluate_block(start, end, false); });
+    pool.parallel_for(survivors, n_guesses, block, [&](size_t start, size_t end) { evaluate_block(start, end, true); });
+
+    return results;
+}
+
+template<size_t L, class Rule>
+std::vector<std::pair<std::string, double>> BasicEntropy<L, Rule>::get_model_scores(
+    const std::vector<std::string> &guesses,
+    const std::vector<std::string> &solutions,
+    std::atomic<size_t> &progress
+) const {
+    using Features = BasicStateFeatures<L>;
+    size_t n_guesses = guesses.size();
+    size_t n = solutions.size();
+    std::vector<std::pair<std::string, double>> results(n_guesses);
+    if (n == 0) return results;
+
+    bool materialised = cache.is_materialised();
+    std::vector<size_t> solution_index(n);
+    if (materialised)
+        for (size_t j = 0; j < n; ++j)
+            solution_index[j] = static_cast<size_t>(cache.index_of(solutions[j]));
+
+    // Each block keeps the feature sums of the buckets of one guess, one slot per bucket in use
+    size_t max_slots = std::min<size_t>(Traits::patterns, n);
+    auto compute_block = [&](size_t g_start, size_t g_end) {
+        std::vector<int> slot(Traits::patterns, -1);
+        std::vector<size_t> used, sizes(max_slots);
+        std::vector<float> sums(max_slots * Features::kSize);
+        std::vector<float> scratch(model->scratch_size());
+        used.reserve(max_slots);
+
+        for (size_t g = g_start; g < g_end; ++g) {
+            const Pattern *row = materialised ? cache.row(static_cast<size_t>(cache.index_of(guesses[g]))) : nullptr;
+            for (size_t j = 0; j < n; ++j) {
+                Pattern fb = row ? row[solution_index[j]] : cache.get_feedback(guesses[g], solutions[j]);
+                if (fb == Traits::solved) continue;
+                if (slot[fb] < 0) {
+                    slot[fb] = static_cast<int>(used.size());
+                    std::fill(sums.begin() + used.size() * Features::kSize, sums.begin() + (used.size() + 1) * Features::kSize, 0.0f);
+                    sizes[used.size()] = 0;
+                    used.push_back(fb);
                 }
+                size_t s = static_cast<size_t>(slot[fb]);
+                sizes[s]++;
+                Features::add(solutions[j], sums.data() + s * Features::kSize);
+            }
 
-                double weight = static_cast<double>(count) / total;
-                H_next += weight * max_branch_entropy;
+            double expected = 1.0;
+            for (size_t s = 0; s < used.size(); ++s) {
+                double value;
+                if (sizes[s] <= 2) {
+                    value = sizes[s] == 1 ? 1.0 : 1.5;
+                } else {
+                    float *features = sums.data() + s * Features::kSize;
+                    float predicted;
+                    Features::finish(features, sizes[s]);
+                    model->forward(features, &predicted, scratch.data());
+                    value = std::max(1.0, static_cast<double>(predicted));
+                }
+                expected += static_cast<double>(sizes[s]) / n * value;
+                slot[used[s]] = -1;
             }
+            used.clear();
+
+            results[g] = {guesses[g], expected};
         }
+        progress.fetch_add(g_end - g_start, std::memory_order_relaxed);
+    };
 
-        results[i] = {guess, H_current + H_next};
+    ThreadPool pool(n_threads);
+    pool.parallel_for(0, n_guesses, ThreadPool::block_size(n_guesses, n_threads), compute_block);
 
-        if (top_level)
-            progress.fetch_add(1, std::memory_order_relaxed);
-    };
+    return results;
+}
 
-    if (top_level) {
-        // Use a single ThreadPool
-        ThreadPool pool(std::thread::hardware_concurrency());
-        std::vector<std::future<void>> futures;
-        futures.reserve(guesses.size());
-        for (size_t i = 0; i < guesses.size(); ++i)
-            futures.push_back(pool.enqueue([&, i]() { compute_for_guess(i); }));
-        for (auto &f : futures) f.get();
+// Scores of every guess under one policy, from the table when it is materialised
+template<size_t L, class Rule>
+template<class Score>
+std::pair<std::string, double> BasicEntropy<L, Rule>::best_guess(
+    const std::vector<std::string> &guesses,
+    const std::vector<std::string> &solutions,
+    int k,
+    std::atomic<size_t> &progress
+) const {
+    // Without a materialised table only single-step scores are available, computed in tiles
+    std::vector<std::pair<std::string, double>> scores;
+    if (cache.is_materialised() && prefilter_survivors > 0 && guesses.size() > prefilter_survivors) {
+        if (prefilter_safe) {
+            // Only two step entropy has a bound, anything else scores every guess
+            if constexpr (std::is_same_v<Score, EntropyScore>) {
+                if (k == 2) scores = get_bounded_scores(guesses, solutions, progress);
+            }
+            if (scores.empty())
+                scores = get_n_step_scores<Score>(guesses, guesses, solutions, k, progress, true);
+        } else {
+            // Survivors stand in for the whole guess list, in the lookahead too
+            std::vector<std::string> survivors;
+            for (size_t g : get_survivors(guesses, solutions, prefilter_survivors))
+                survivors.push_back(guesses[g]);
+            progress.fetch_add(guesses.size() - survivors.size(), std::memory_order_relaxed);
+            scores = get_n_step_scores<Score>(survivors, survivors, solutions, k, progress, true);
+        }
+    } else if (cache.is_materialised()) {
+        scores = get_n_step_scores<Score>(guesses, guesses, solutions, k, progress, true);
     } else {
-        for (size_t i = 0; i < guesses.size(); ++i)
-            compute_for_guess(i);
+        size_t budget = cache.get_memory_budget() > 0 ? cache.get_memory_budget() : BasicTiledEntropy<L, Rule>::kDefaultMemoryBudget;
+        scores = BasicTiledEntropy<L, Rule>(cache, budget, n_threads).get_entropy(guesses, solutions, progress, Score::metric);
     }
 
-    return results;
+    auto best_it = std::max_element(
+        scores.begin(),
+        scores.end(),
+        [](const auto &a, const auto &b) { return Score::maximise ? a.second < b.second : a.second > b.second; }
+    );
+
+    return *best_it;
 }
 
-std::pair<std::string, double> Entropy::get_best_guess(
+template<size_t L, class Rule>
+std::pair<std::string, double> BasicEntropy<L, Rule>::get_best_guess(
     const std::vector<std::string> &guesses,
     const std::vector<std::string> &solutions,
     int k,
-    Display &display
+    Display &display,
+    Metric metric
 ) const {
-    if (std::find(guesses.begin(), guesses.end(), "slate") != guesses.end()) {
+    if (metric == Metric::Entropy && !cache.is_weighted() && std::find(guesses.begin(), guesses.end(), "slate") != guesses.end()) {
         return {"slate", 0.0};
     }
 
     display.showProgress("Calculating Best Guess", 0, guesses.size());
     std::atomic<size_t> progress(0);
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
     bool done = false;
 
-    // Progress thread
-    std::thread progress_thread([&]() {
-        while (!done) {
-            display.showProgress("Calculating Best Guess", progress.load(), guesses.size());
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
-        }
-        display.showProgress("Calculating Best Guess", guesses.size(), guesses.size());
-    });
+    // Progress thread, woken as soon as scoring finishes. Silent displays draw nothing, so
+    // sweep workers and other quiet callers skip it.
+    std::thread progress_thread;
+    if (!display.isSilent()) {
+        progress_thread = std::thread([&]() {
+            std::unique_lock<std::mutex> lock(done_mutex);
+            while (!done_cv.wait_for(lock, std::chrono::milliseconds(100), [&]() { return done; }))
+                display.showProgress("Calculating Best Guess", progress.load(), guesses.size());
+            display.showProgress("Calculating Best Guess", guesses.size(), guesses.size());
+        });
+    }
 
-    auto entropies = get_n_step_entropy(guesses, solutions, k, progress, true);
+    // Dispatch once, each policy is compiled into its own kernels
+    std::pair<std::string, double> best;
+    switch (metric) {
+        case Metric::Model:
+            if (model) {
+                // Learned leaf values stand in for the lookahead, k is not used
+                std::vector<std::string> scored;
+                if (prefilter_survivors > 0 && guesses.size() > prefilter_survivors) {
+                    for (size_t g : get_survivors(guesses, solutions, prefilter_survivors))
+                        scored.push_back(guesses[g]);
+                    progress.fetch_add(guesses.size() - scored.size(), std::memory_order_relaxed);
+                }
+                auto scores = get_model_scores(scored.empty() ? guesses : scored, solutions, progress);
+                best = *std::min_element(scores.begin(), scores.end(),
+                                         [](const auto &a, const auto &b) { return a.second < b.second; });
+                break;
+            }
+            best = best_guess<EntropyScore>(guesses, solutions, k, progress);
+            break;
+        case Metric::Remaining: best = best_guess<RemainingScore>(guesses, solutions, k, progress); break;
+        case Metric::WorstCase: best = best_guess<WorstCaseScore>(guesses, solutions, k, progress); break;
+        case Metric::SolveProbability: best = best_guess<SolveProbabilityScore>(guesses, solutions, k, progress); break;
+        default: best = best_guess<EntropyScore>(guesses, solutions, k, progress); break;
+    }
 
-    done = true;
-    progress_thread.join();
+    if (progress_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(done_mutex);
+            done = true;
+        }
+        done_cv.notify_one();
+        progress_thread.join();
+    }
 
-    auto max_it = std::max_element(
-        entropies.begin(),
-        entropies.end(),
-        [](const auto &a, const auto &b) { return a.second < b.second; }
-    );
+    return best;
+}
 
-    return *max_it;
-}
\ No newline at end of file
+WORDLE_SOLVED_INSTANTIATE(BasicEntropy)
+WORDLE_SOLVED_INSTANTIATE_RULES(BasicEntropy)
@@ -5,29 +5,129 @@
 #ifndef WORDLE_SOLVED_ENTROPY_H
 #define WORDLE_SOLVED_ENTROPY_H
 #pragma once
+#include "Arena.h"
 #include "Feedback.h"
+#include "HistogramCache.h"
+#include "Mlp.h"
+#include "Scoring.h"
+#include "WordTraits.h"
 #include <array>
+#include <cstdint>
 #include <atomic>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <utility>
 
 
-class Entropy {
+template<size_t L, class Rule = WordleRule<L>>
+class BasicEntropy {
+public:
+    using Traits = Rule;
+    using Pattern = typename Traits::Pattern;
+
+    static constexpr size_t kSubtreeShards = 16;
+    static constexpr size_t kSubtreeSlots = size_t(1) << 18;
+    static constexpr size_t kLineageTurns = 8;
+
 private:
-    const Feedback &cache;
+    // Best branch score of every candidate set searched so far, by guess list seed, policy and
+    // depth, shared by every guess splitting off the same set. Slots are allocated once and pairs
+    // of them overwritten when full, so storing never allocates.
+    struct Subtrees {
+        std::array<std::mutex, kSubtreeShards> mutexes;
+        std::vector<std::pair<uint64_t, double>> slots;
+        std::once_flag allocated;
+    };
+
+    // Guess list seeds of the searches so far, oldest first. A search whose list is the last one
+    // minus guesses that cannot split its candidates, like the guess just played, and whose
+    // candidates are a subset of the last ones gets a new seed and keeps the older ones: a guess
+    // with a single bucket never beats the rest of the list, so the subtrees stored under them
+    // still hold. Any other list starts over from its own hash, which the next game shares.
+    struct Lineage {
+        std::mutex mutex;
+        std::vector<uint32_t> list;
+        std::vector<uint8_t> listed;
+        std::vector<uint8_t> candidates;
+        std::vector<uint64_t> seeds;
+    };
+
+    // Candidates of one search node, word ids and their weights, permuted in place as the
+    // node is partitioned
+    struct Node {
+        uint32_t *ids;
+        uint32_t *weights;
+        size_t size;
+        size_t total;
+    };
+
+    // Shared by every node of one search
+    struct Search {
+        const uint32_t *guesses;
+        size_t n_guesses;
+        const uint64_t *hashes;
+        std::array<std::array<uint64_t, 8>, kLineageTurns> contexts;    // Newest seed first
+        size_t seeds;
+        const std::vector<double> *log_cache;
+        size_t unit;
+    };
+
+    const BasicFeedback<L, Rule> &cache;
+    size_t n_threads;
+    mutable Subtrees subtrees;
+    mutable Lineage lineage;
+    mutable std::atomic<size_t> cross_turn_hits{0};
+    mutable std::atomic<size_t> scoring_allocations{0};
+    size_t prefilter_survivors = 0;
+    bool prefilter_safe = false;
+    const Mlp *model = nullptr;
+    const BasicHistogramCache<L, Rule> *histograms = nullptr;
+
+    // Hash of a node's candidate set, independent of their order, and its key under a context
+    uint64_t subtree_set(const Search &search, const Node &node) const;
+    static uint64_t subtree_key(uint64_t context, uint64_t set);
+    bool find_subtree(uint64_t key, double &value) const;
+    void store_subtree(uint64_t key, double value) const;
+
+    // Ids of words in the table, hashes of the solutions by id, and the guess ids and subtree
+    // contexts of a search of solution_ids looking ahead with next_guesses
+    std::vector<uint32_t> get_ids(const std::vector<std::string> &words) const;
+    std::vector<uint64_t> get_hashes(const std::vector<uint32_t> &solution_ids) const;
+    Search make_search(const std::vector<std::string> &next_guesses, const std::vector<uint32_t> &next_ids,
+                       const std::vector<uint32_t> &solution_ids, const std::vector<uint64_t> &hashes,
+                       Metric metric, int k) const;
+    // Moves the lineage on to a search's list, lineage.mutex held
+    void advance_lineage(const std::vector<uint32_t> &next_ids, const std::vector<uint32_t> &solution_ids,
+                         uint64_t guess_list) const;
+
+    // Arena bytes a search of n candidates k levels deep needs, including its copy of them
+    static size_t scratch_size(size_t n, int k);
+
+    // Group a node's candidates by a guess's feedback in place, counting sort style: bucket p
+    // ends up at starts[p], sizes[p] long. counts gets the weight of each bucket.
+    void partition(const Pattern *row, Node &node, uint32_t *starts, uint32_t *sizes,
+                   std::array<size_t, Traits::patterns> &counts) const;
+
+    // k-step score of one guess over a node, and the best score of any guess over a node
+    template<class Score>
+    double search(const Search &search_state, uint32_t guess, Node &node, int k, Arena &arena) const;
+    template<class Score>
+    double best_branch(const Search &search_state, Node &node, int depth, Arena &arena) const;
 
     // Feedback Count
-    std::array<size_t, 243> get_feedback_count(
+    std::array<size_t, Traits::patterns> get_feedback_count(
         const std::string &guess,
         const std::vector<std::string> &solutions,
         const std::vector<size_t> &indices
     ) const;
 
-    // Single-step Entropies
+    // Single-step Scores, weights aligned with solutions
+    template<class Score>
     std::vector<std::pair<std::string, double>> get_entropy(
         const std::vector<std::string> &guesses,
         const std::vector<std::string> &solutions,
+        const std::vector<uint32_t> &weights,
         const std::vector<size_t> &indices
     ) const;
 
@@ -38,13 +138,85 @@ private:
         const std::vector<std::string> &solutions
     ) const;
 
+    // N-step scores of guesses under one policy, looking ahead with next_guesses
+    template<class Score>
+    std::vector<std::pair<std::string, double>> get_n_step_scores(
+        const std::vector<std::string> &guesses,
+        const std::vector<std::string> &next_guesses,
+        const std::vector<std::string> &solutions,
+        int k,
+        std::atomic<size_t> &progress,
+        bool top_level
+    ) const;
+
+    // Indices of the survivors guesses with the highest positional letter frequency over
+    // the solutions, in guess order
+    std::vector<size_t> get_survivors(
+        const std::vector<std::string> &guesses,
+        const std::vector<std::string> &solutions,
+        size_t survivors
+    ) const;
+
+    // Two-step entropies, exact for the survivors best by single-step entropy and for every
+    // other guess whose upper bound reaches the best so far, the rest score -infinity
+    std::vector<std::pair<std::string, double>> get_bounded_scores(
+        const std::vector<std::string> &guesses,
+        const std::vector<std::string> &solutions,
+        std::atomic<size_t> &progress
+    ) const;
+
+    // Expected guesses to solve after each guess: 1 for the guess, plus the model's value of
+    // every bucket it leaves. Buckets of one or two candidates are valued exactly.
+    std::vector<std::pair<std::string, double>> get_model_scores(
+        const std::vector<std::string> &guesses,
+        const std::vector<std::string> &solutions,
+        std::atomic<size_t> &progress
+    ) const;
+
+    // Best guess under one policy
+    template<class Score>
+    std::pair<std::string, double> best_guess(
+        const std::vector<std::string> &guesses,
+        const std::vector<std::string> &solutions,
+        int k,
+        std::atomic<size_t> &progress
+    ) const;
+
 
 public:
-    Entropy(const Feedback &fbCache);
+    // threads 0 uses every core
+    BasicEntropy(const BasicFeedback<L, Rule> &fbCache, size_t threads = 0);
+
+    // Two-stage ranking: a cheap first pass keeps the best survivors guesses for exact
+    // scoring, 0 scores every guess. Safe mode also scores any guess that could still win.
+    void set_prefilter(size_t survivors, bool safe = false) {
+        prefilter_survivors = survivors;
+        prefilter_safe = safe;
+    }
+
+    // Value model for Metric::Model, mapping BasicStateFeatures<L> to expected guesses
+    void set_model(const Mlp *value_model) {model = value_model;}
 
-    static std::vector<double> log_cache;
-    static void precache_log(size_t max_size,
-                        Display &display);
+    // Turn-1 histograms over the answers, single-step scores of answer subsets missing fewer
+    // answers than they keep are derived from them instead of counted
+    void set_histograms(const BasicHistogramCache<L, Rule> *turn_one) {histograms = turn_one;}
+
+    // Heap allocations made while scoring guesses, over every call. Every allocation in builds
+    // counting them, see AllocationCounter, otherwise only arena growth. Arenas are sized
+    // before scoring starts, so either way this should stay 0; --check-allocations checks it.
+    size_t get_scoring_allocations() const {return scoring_allocations.load();}
+
+    // Subtrees found under the seed of an earlier search, over every call
+    size_t get_cross_turn_hits() const {return cross_turn_hits.load();}
+
+    // Single-step entropies of guess indices over candidate indices
+    void get_entropy_indices(
+        const uint32_t *guesses,
+        size_t n_guesses,
+        const uint32_t *candidates,
+        size_t n_candidates,
+        double *out
+    ) const;
 
     // N-step entropy
     std::vector<std::pair<std::string, double>> get_n_step_entropy(
@@ -59,9 +231,12 @@ public:
         const std::vector<std::string> &guesses,
         const std::vector<std::string> &solutions,
         int k,
-        Display &display
+        Display &display,
+        Metric metric = Metric::Entropy
         ) const;
 };
 
+using Entropy = BasicEntropy<5>;
+
 
 #endif //WORDLE_SOLVED_ENTROPY_H
\ No newline at end of file
@@ -3,90 +3,151 @@
 //
 
 #include "Feedback.h"
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <future>
+#include <mutex>
 #include <thread>
 #include <cstdint>
 #include <unordered_map>
 #include <vector>
 
-std::vector<std::vector<uint8_t>> Feedback::feedback_cache;
-std::unordered_map<std::string, size_t> Feedback::word_index;
-
-// Encode Feedback to Base 3
-uint8_t Feedback::get_feedback(const std::string &guess, const std::string &solution) const {
-    uint8_t feedback = 0;
-    int freq[26] = {0};
-
-    // Step 1: Count letters in solution
-    for (int i = 0; i < 5; ++i)
-        freq[solution[i] - 'a']++;
-
-    // Step 2: Mark greens (and adjust freq)
-    uint8_t codes[5];
-    for (int i = 0; i < 5; ++i) {
-        if (guess[i] == solution[i]) {
-            codes[i] = 2;
-            freq[guess[i] - 'a']--;
-        } else {
-            codes[i] = 0;
-        }
-    }
+template<size_t L, class Rule>
+const std::vector<std::string> BasicFeedback<L, Rule>::empty_words;
+template<size_t L, class Rule>
+const std::vector<typename BasicFeedback<L, Rule>::Pattern> BasicFeedback<L, Rule>::empty_cache;
+template<size_t L, class Rule>
+const LetterIndex BasicFeedback<L, Rule>::empty_index;
 
-    // Step 3: Mark yellows
-    for (int i = 0; i < 5; ++i) {
-        if (codes[i] == 0) {
-            int idx = guess[i] - 'a';
-            if (freq[idx] > 0) {
-                codes[i] = 1;
-                freq[idx]--;
-            }
-        }
+namespace {
+    // Live tables by word list hash, so instances loading the same list share one copy. A table
+    // still being built is a pending future, set once it is published or found over budget.
+    std::mutex registry_mutex;
+
+    template<size_t L, class Rule>
+    using RegistryEntry = std::shared_future<std::weak_ptr<const BasicFeedbackTable<L, Rule>>>;
+
+    template<size_t L, class Rule>
+    std::unordered_multimap<size_t, RegistryEntry<L, Rule>> &registry() {
+        static std::unordered_multimap<size_t, RegistryEntry<L, Rule>> tables;
+        return tables;
     }
 
-    // Step 4: Encode to base-3 number
-    for (int i = 0; i < 5; ++i)
-        feedback = feedback * 3 + codes[i];
+    size_t hash_words(const std::vector<std::string> &words) {
+        size_t h = words.size();
+        std::hash<std::string> hasher;
+        for (const auto &w : words)
+            h ^= hasher(w) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+        return h;
+    }
+}
 
-    return feedback;
+// Encode Feedback with the rule's kernel, Base 3 for Wordle
+template<size_t L, class Rule>
+typename BasicFeedback<L, Rule>::Pattern BasicFeedback<L, Rule>::get_feedback(const std::string &guess, const std::string &solution) const {
+    return Rule::feedback(guess, solution);
 }
 
 // TODO: Separate feedback cache table by Base 3 Feedback int, optimise get cache function
-uint8_t Feedback::get_feedback_cached(const std::string &guess, const std::string &solution) const {
-    auto it_guess = word_index.find(guess);
-    if (it_guess == word_index.end()) return 0;
+template<size_t L, class Rule>
+typename BasicFeedback<L, Rule>::Pattern BasicFeedback<L, Rule>::get_feedback_cached(const std::string &guess, const std::string &solution) const {
+    // Hot path, reads this instance's table directly rather than through an atomic load
+    if (!table || table->feedback_cache.empty()) return get_feedback(guess, solution);
+
+    auto it_guess = table->word_index.find(guess);
+    if (it_guess == table->word_index.end()) return 0;
     size_t idx = it_guess->second;
 
-    auto it_sol = word_index.find(solution);
-    if (it_sol == word_index.end()) return 0;
+    auto it_sol = table->word_index.find(solution);
+    if (it_sol == table->word_index.end()) return 0;
     size_t sol_idx = it_sol->second;
 
-    return feedback_cache[idx][sol_idx];
+    return table->feedback_cache[idx * table->words.size() + sol_idx];
+}
+
+template<size_t L, class Rule>
+long BasicFeedback<L, Rule>::index_of(const std::string &word) const {
+    if (!table) return -1;
+    auto it = table->word_index.find(word);
+    return it == table->word_index.end() ? -1 : static_cast<long>(it->second);
 }
 
 // Cache Feedback with Thread Pool
-void Feedback::precache_feedback(const std::vector<std::string> &all_solutions) {
+template<size_t L, class Rule>
+void BasicFeedback<L, Rule>::precache_feedback(const std::vector<std::string> &all_solutions) {
     size_t n_words = all_solutions.size();
+    size_t key = hash_words(all_solutions);
+
+    // Concurrent loads of the same list wait on the first one's build and share its table, the
+    // build itself runs outside the registry lock
+    std::promise<std::weak_ptr<const Table>> building;
+    while (true) {
+        std::vector<RegistryEntry<L, Rule>> pending;
+        {
+            std::lock_guard<std::mutex> registry_lock(registry_mutex);
+            auto range = registry<L, Rule>().equal_range(key);
+            for (auto it = range.first; it != range.second;) {
+                if (it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                    pending.push_back(it->second);
+                    ++it;
+                    continue;
+                }
+                auto live = it->second.get().lock();
+                if (!live) {
+                    it = registry<L, Rule>().erase(it);
+                    continue;
+                }
+                if (live->words == all_solutions && !live->feedback_cache.empty()) {
+                    std::atomic_store(&table, std::shared_ptr<const Table>(std::move(live)));
+                    return;
+                }
+                ++it;
+            }
+            if (pending.empty()) {
+                registry<L, Rule>().emplace(key, building.get_future().share());
+                break;
+            }
+        }
+        for (const auto &entry : pending) entry.wait();
+    }
+
+    auto built = std::make_shared<Table>();
 
     // Build word_index for fast lookup
-    word_index.clear();
+    built->words = all_solutions;
     for (size_t i = 0; i < n_words; ++i)
-        word_index[all_solutions[i]] = i;
+        built->word_index[all_solutions[i]] = i;
+    built->letter_index.build(built->words, L);
+
+    built->log_cache.resize(n_words + 1);
+    for (size_t i = 1; i <= n_words; ++i)
+        built->log_cache[i] = std::log2(static_cast<double>(i));
+
+    // Over the memory budget only the index is kept, feedback is computed on demand
+    if (memory_budget > 0 && n_words * n_words * sizeof(Pattern) > memory_budget) {
+        std::atomic_store(&table, std::shared_ptr<const Table>(built));
+        building.set_value({});
+        return;
+    }
 
-    feedback_cache.assign(n_words, std::vector<uint8_t>(n_words, 0));
+    std::vector<Pattern> &feedback_cache = built->feedback_cache;
+    feedback_cache.assign(n_words * n_words, 0);
     std::atomic<size_t> progress(0);
 
-    size_t n_threads = std::thread::hardware_concurrency();
+    size_t n_threads = std::max(1u, std::thread::hardware_concurrency());
     std::vector<std::thread> threads;
 
     std::atomic<bool> done(false);
-    auto start_time = std::chrono::high_resolution_clock::now();
 
     // Progress Bar Thread
     std::thread progress_thread([&] {
-        while (!done) {
+        while (display && !done) {
             {
-                std::lock_guard<std::mutex> lock(display.getMutex());
-                display.showProgress("Caching Feedback", progress.load(), n_words);
+                std::lock_guard<std::mutex> lock(display->getMutex());
+                display->showProgress("Caching Feedback", progress.load(), n_words);
             }
             std::this_thread::sleep_for(std::chrono::milliseconds(100));
         }
@@ -95,8 +156,9 @@ void Feedback::precache_feedback(const std::vector<std::string> &all_solutions)
     // Worker Threads
     auto worker = [&](size_t start, size_t end) {
         for (size_t i = start; i < end; ++i) {
+            Pattern *out = feedback_cache.data() + i * n_words;
             for (size_t j = 0; j < n_words; ++j)
-                feedback_cache[i][j] = get_feedback(all_solutions[i], all_solutions[j]);
+                out[j] = get_feedback(all_solutions[i], all_solutions[j]);
             progress.fetch_add(1, std::memory_order_relaxed);
         }
     };
@@ -113,15 +175,121 @@ void Feedback::precache_feedback(const std::vector<std::string> &all_solutions)
     done = true;
     progress_thread.join();
 
-    std::lock_guard<std::mutex> lock(display.getMutex());
-    display.showProgress("Caching Feedback", n_words, n_words);
+    if (display) {
+        std::lock_guard<std::mutex> lock(display->getMutex());
+        display->showProgress("Caching Feedback", n_words, n_words);
+    }
+
+    std::shared_ptr<const Table> published = built;
+    std::atomic_store(&table, published);
+    building.set_value(published);
+}
+
+// Incremental update, rows and columns of kept words are copied from the current table
+template<size_t L, class Rule>
+void BasicFeedback<L, Rule>::update_words(const std::vector<std::string> &added, const std::vector<std::string> &removed) {
+    std::shared_ptr<const Table> current = std::atomic_load(&table);
+    static const Table empty_table;
+    const Table &old_table = current ? *current : empty_table;
+    size_t n_old = old_table.words.size();
+
+    std::vector<bool> drop(n_old, false);
+    for (const auto &w : removed) {
+        auto it = old_table.word_index.find(w);
+        if (it != old_table.word_index.end()) drop[it->second] = true;
+    }
+
+    auto built = std::make_shared<Table>();
+
+    // Kept words in their old order as contiguous runs of old indices, then added words
+    struct Run {size_t new_start, old_start, length;};
+    std::vector<Run> runs;
+    std::vector<long> old_of;
+    for (size_t i = 0; i < n_old; ++i) {
+        if (drop[i]) continue;
+        size_t j = built->words.size();
+        if (!runs.empty() && runs.back().old_start + runs.back().length == i) runs.back().length++;
+        else runs.push_back({j, i, 1});
+        built->word_index.emplace(old_table.words[i], j);
+        built->words.push_back(old_table.words[i]);
+        old_of.push_back(static_cast<long>(i));
+    }
+    size_t n_kept = built->words.size();
+    for (const auto &w : added) {
+        if (built->word_index.emplace(w, built->words.size()).second) {
+            built->words.push_back(w);
+            old_of.push_back(-1);
+        }
+    }
+
+    size_t n_words = built->words.size();
+    if (n_kept == n_old && n_words == n_old) return;
+    built->letter_index.build(built->words, L);
+
+    // Priors follow their words to the new indices, added words weigh an average answer
+    if (!weights.empty()) {
+        std::vector<uint32_t> remapped(n_words, kWeightOne);
+        for (size_t i = 0; i < n_kept; ++i) remapped[i] = weights[static_cast<size_t>(old_of[i])];
+        weights = std::move(remapped);
+    }
+
+    built->log_cache.resize(n_words + 1);
+    size_t reused_logs = std::min(old_table.log_cache.size(), built->log_cache.size());
+    std::copy(old_table.log_cache.begin(), old_table.log_cache.begin() + reused_logs, built->log_cache.begin());
+    for (size_t i = std::max<size_t>(reused_logs, 1); i <= n_words; ++i)
+        built->log_cache[i] = std::log2(static_cast<double>(i));
+
+    if (memory_budget > 0 && n_words * n_words * sizeof(Pattern) > memory_budget) {
+        std::atomic_store(&table, std::shared_ptr<const Table>(built));
+        return;
+    }
+    bool reuse = !old_table.feedback_cache.empty();
+
+    std::vector<Pattern> &feedback_cache = built->feedback_cache;
+    feedback_cache.resize(n_words * n_words);
+    const std::vector<std::string> &words = built->words;
+
+    auto worker = [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            Pattern *out = feedback_cache.data() + i * n_words;
+            size_t first_new = 0;
+            if (reuse && old_of[i] >= 0) {
+                const Pattern *old_row = old_table.feedback_cache.data() + old_of[i] * n_old;
+                for (const Run &run : runs)
+                    std::copy(old_row + run.old_start, old_row + run.old_start + run.length, out + run.new_start);
+                first_new = n_kept;
+            }
+            for (size_t j = first_new; j < n_words; ++j)
+                out[j] = get_feedback(words[i], words[j]);
+        }
+    };
+
+    size_t n_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::thread> threads;
+    size_t chunk_size = (n_words + n_threads - 1) / n_threads;
+    for (size_t i = 0; i < n_threads; ++i) {
+        size_t start = std::min(i * chunk_size, n_words);
+        size_t end = std::min(start + chunk_size, n_words);
+        threads.emplace_back(worker, start, end);
+    }
+    for (auto &t : threads) t.join();
+
+    std::shared_ptr<const Table> published = built;
+    std::promise<std::weak_ptr<const Table>> entry;
+    entry.set_value(published);
+    {
+        std::lock_guard<std::mutex> registry_lock(registry_mutex);
+        registry<L, Rule>().emplace(hash_words(built->words), entry.get_future().share());
+    }
+    std::atomic_store(&table, published);
 }
 
 // Update Solutions
-std::vector<std::string> Feedback::get_new_solutions(
+template<size_t L, class Rule>
+std::vector<std::string> BasicFeedback<L, Rule>::get_new_solutions(
     const std::vector<std::string> &solutions,
     const std::string &guess,
-    uint8_t feedback
+    Pattern feedback
 ) const {
     std::vector<std::string> new_solutions;
 
@@ -131,4 +299,38 @@ std::vector<std::string> Feedback::get_new_solutions(
     }
 
     return new_solutions;
-}
\ No newline at end of file
+}
+
+template<size_t L, class Rule>
+void BasicFeedback<L, Rule>::set_priors(const std::vector<std::string> &answers, const std::vector<double> &priors) {
+    weights.clear();
+    if (priors.empty() || priors.size() != answers.size() || !table) return;
+
+    double sum = 0.0;
+    for (double p : priors) sum += p;
+    if (sum <= 0) return;
+
+    // Scale so the mean answer weighs kWeightOne, every answer keeping at least 1
+    double scale = kWeightOne * static_cast<double>(priors.size()) / sum;
+    weights.assign(table->words.size(), kWeightOne);
+    for (size_t i = 0; i < answers.size(); ++i) {
+        long idx = index_of(answers[i]);
+        if (idx < 0) continue;
+        double fixed = std::round(priors[i] * scale);
+        weights[idx] = static_cast<uint32_t>(std::clamp(fixed, 1.0, 4294967295.0));
+    }
+}
+
+template<size_t L, class Rule>
+std::vector<uint32_t> BasicFeedback<L, Rule>::get_weights(const std::vector<std::string> &solutions) const {
+    std::vector<uint32_t> out(solutions.size(), 1);
+    if (weights.empty()) return out;
+    for (size_t i = 0; i < solutions.size(); ++i) {
+        long idx = index_of(solutions[i]);
+        out[i] = idx < 0 ? kWeightOne : weights[idx];
+    }
+    return out;
+}
+
+WORDLE_SOLVED_INSTANTIATE(BasicFeedback)
+WORDLE_SOLVED_INSTANTIATE_RULES(BasicFeedback)
@@ -5,39 +5,127 @@
 #ifndef WORDLE_SOLVED_FEEDBACK_H
 #define WORDLE_SOLVED_FEEDBACK_H
 #pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <vector>
 #include <unordered_map>
 #include <string>
 #include "Display.h"
+#include "FeedbackRule.h"
+#include "LetterIndex.h"
+#include "WordTraits.h"
 
 
-class Feedback {
+// Immutable tables for one word list, shared between every Feedback using the same list
+template<size_t L, class Rule = WordleRule<L>>
+struct BasicFeedbackTable {
+    using Pattern = typename Rule::Pattern;
+
+    std::vector<std::string> words;
+    std::unordered_map<std::string, size_t> word_index;
+
+    // Position and letter count bitsets over words
+    LetterIndex letter_index;
+
+    // Row-major n x n table, feedback_cache[guess * n + solution]
+    std::vector<Pattern> feedback_cache;
+
+    // log_cache[count] = log2(count), for count <= n
+    std::vector<double> log_cache;
+};
+
+
+template<size_t L, class Rule = WordleRule<L>>
+class BasicFeedback {
+public:
+    using Traits = Rule;
+    using Pattern = typename Traits::Pattern;
+    using Table = BasicFeedbackTable<L, Rule>;
+
 private:
-    static std::vector<std::vector<uint8_t>> feedback_cache;
-    static std::unordered_map<std::string, size_t> word_index;
-    Display &display;
+    std::shared_ptr<const Table> table;
+    Display *display;
+    size_t memory_budget = 0;
+
+    // Fixed point prior weight of each word by index, empty when every word weighs 1
+    std::vector<uint32_t> weights;
+
+    static const std::vector<std::string> empty_words;
+    static const std::vector<Pattern> empty_cache;
+    static const LetterIndex empty_index;
 
 public:
-    Feedback(Display &display) : display(display) {}
+    // Weight of an answer of average prior
+    static constexpr uint32_t kWeightOne = uint32_t(1) << 16;
+
+    BasicFeedback() : display(nullptr) {}
+    BasicFeedback(Display &display) : display(&display) {}
 
-    // Encode Feedback to Base 3
-    uint8_t get_feedback(const std::string &guess, const std::string &solution) const;
+    // Encode Feedback with the rule, Base 3 for Wordle
+    Pattern get_feedback(const std::string &guess, const std::string &solution) const;
 
     // Cached Feedback
-    uint8_t get_feedback_cached(const std::string &guess, const std::string &solution) const;
+    Pattern get_feedback_cached(const std::string &guess, const std::string &solution) const;
 
-    // Cache Feedback with Thread Pool
+    // Cache Feedback with Thread Pool, reusing the tables of any live instance with the same words
     void precache_feedback(const std::vector<std::string> &all_solutions);
 
-    const std::vector<std::vector<uint8_t>> &get_cache() const {return feedback_cache;};
+    // Largest feedback table in bytes precache_feedback may build, 0 for no limit.
+    // Larger lists keep only their index and are scored with TiledEntropy.
+    void set_memory_budget(size_t bytes) {memory_budget = bytes;}
+    size_t get_memory_budget() const {return memory_budget;}
+    bool is_materialised() const {
+        auto current = std::atomic_load(&table);
+        return current && !current->feedback_cache.empty();
+    }
+
+    // Add and remove words, computing only the rows and columns of added words.
+    // The updated tables are published atomically, snapshots taken before keep the old ones.
+    void update_words(const std::vector<std::string> &added, const std::vector<std::string> &removed);
+
+    // Share another instance's tables without rebuilding
+    void share_tables(const BasicFeedback &other) {table = std::atomic_load(&other.table);}
+    std::shared_ptr<const Table> get_table() const {return std::atomic_load(&table);}
+
+    // Pin the current tables, for readers running alongside update_words
+    BasicFeedback snapshot() const {
+        BasicFeedback pinned;
+        pinned.display = display;
+        pinned.memory_budget = memory_budget;
+        pinned.table = std::atomic_load(&table);
+        pinned.weights = weights;
+        return pinned;
+    }
+
+    // Weight answers by their priors, in answers order, after the word list is loaded.
+    // Scores then accumulate weights where they counted candidates, in units of weight_unit().
+    void set_priors(const std::vector<std::string> &answers, const std::vector<double> &priors);
+    bool is_weighted() const {return !weights.empty();}
+    uint32_t weight_unit() const {return weights.empty() ? 1 : kWeightOne;}
+    std::vector<uint32_t> get_weights(const std::vector<std::string> &solutions) const;
+
+    const std::vector<Pattern> &get_cache() const {return table ? table->feedback_cache : empty_cache;};
+    const std::vector<double> &get_log_cache() const {return table->log_cache;}
+
+    // Index based access to the cached table
+    size_t size() const {return table ? table->words.size() : 0;}
+    const std::vector<std::string> &get_words() const {return table ? table->words : empty_words;}
+    long index_of(const std::string &word) const;
+    const LetterIndex &get_letter_index() const {return table ? table->letter_index : empty_index;}
+    const Pattern *row(size_t guess) const {return table->feedback_cache.data() + guess * table->words.size();}
+    Pattern get_feedback_index(size_t guess, size_t solution) const {return row(guess)[solution];}
 
     // Update Solutions
     std::vector<std::string> get_new_solutions(
         const std::vector<std::string> &solutions,
         const std::string &guess,
-        uint8_t feedback
+        Pattern feedback
     ) const;
 };
 
+using FeedbackTable = BasicFeedbackTable<5>;
+using Feedback = BasicFeedback<5>;
+
 
-#endif //WORDLE_SOLVED_FEEDBACK_H
\ No newline at end of file
+#endif //WORDLE_SOLVED_FEEDBACK_H
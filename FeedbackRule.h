@@ -0,0 +1,112 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_FEEDBACKRULE_H
+#define WORDLE_SOLVED_FEEDBACKRULE_H
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "Alphabet.h"
+#include "WordTraits.h"
+
+
+// Compile-time feedback rules. The tables, histogram kernels and lookahead only ever see
+// pattern ids, so a rule supplies the pattern count and type, the solved pattern, the guess
+// limit and the feedback kernel itself, which is inlined into every table build.
+
+// Wordle: one Base 3 digit per position, Gray = 0, Yellow = 1, Green = 2. Nerdle colours
+// its 8 character equations the same way, so it is this rule over an equation alphabet.
+template<size_t L>
+struct WordleRule : WordTraits<L> {
+    using Pattern = typename WordTraits<L>::Pattern;
+
+    static constexpr size_t max_guesses = 6;
+
+    static Pattern feedback(const std::string &guess, const std::string &solution) {
+        Pattern feedback = 0;
+        uint8_t freq[Alphabet::kMaxSymbols] = {0};
+
+        // Step 1: Count letters in solution
+        for (size_t i = 0; i < L; ++i)
+            freq[Alphabet::index(solution[i])]++;
+
+        // Step 2: Mark greens (and adjust freq)
+        uint8_t codes[L];
+        for (size_t i = 0; i < L; ++i) {
+            if (guess[i] == solution[i]) {
+                codes[i] = 2;
+                freq[Alphabet::index(guess[i])]--;
+            } else {
+                codes[i] = 0;
+            }
+        }
+
+        // Step 3: Mark yellows
+        for (size_t i = 0; i < L; ++i) {
+            if (codes[i] == 0) {
+                size_t idx = Alphabet::index(guess[i]);
+                if (freq[idx] > 0) {
+                    codes[i] = 1;
+                    freq[idx]--;
+                }
+            }
+        }
+
+        // Step 4: Encode to base-3 number
+        for (size_t i = 0; i < L; ++i)
+            feedback = feedback * 3 + codes[i];
+
+        return feedback;
+    }
+};
+
+// Mastermind: L pegs scored as black (right colour, right place) and white (right colour,
+// wrong place) counts, pattern = black * (L + 1) + white.
+template<size_t L>
+struct MastermindRule {
+    static constexpr size_t length = L;
+    static constexpr size_t patterns = (L + 1) * (L + 1);
+    using Pattern = uint8_t;
+
+    // All black
+    static constexpr Pattern solved = static_cast<Pattern>(L * (L + 1));
+
+    static constexpr size_t max_guesses = 10;
+
+    static Pattern feedback(const std::string &guess, const std::string &solution) {
+        uint8_t guess_freq[Alphabet::kMaxSymbols] = {0};
+        uint8_t solution_freq[Alphabet::kMaxSymbols] = {0};
+        size_t black = 0;
+
+        for (size_t i = 0; i < L; ++i) {
+            if (guess[i] == solution[i]) {
+                black++;
+            } else {
+                guess_freq[Alphabet::index(guess[i])]++;
+                solution_freq[Alphabet::index(solution[i])]++;
+            }
+        }
+
+        size_t white = 0;
+        for (size_t i = 0; i < L; ++i) {
+            size_t idx = Alphabet::index(guess[i]);
+            if (guess[i] != solution[i] && solution_freq[idx] > 0 && guess_freq[idx] > 0) {
+                white++;
+                solution_freq[idx]--;
+                guess_freq[idx]--;
+            }
+        }
+
+        return static_cast<Pattern>(black * (L + 1) + white);
+    }
+};
+
+// Instantiate a class template for the non-Wordle rules, alongside WORDLE_SOLVED_INSTANTIATE
+#define WORDLE_SOLVED_INSTANTIATE_RULES(T)  \
+    template class T<4, MastermindRule<4>>; \
+    template class T<5, MastermindRule<5>>;
+
+
+#endif //WORDLE_SOLVED_FEEDBACKRULE_H
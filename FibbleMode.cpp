@@ -0,0 +1,194 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "FibbleMode.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <thread>
+
+template<size_t L>
+BasicFibbleMode<L>::BasicFibbleMode(Display &display, BasicFeedback<L> &feedback_instance, unsigned seed)
+    : display(display),
+      feedback(feedback_instance),
+      seed(seed) {}
+
+template<size_t L>
+const std::vector<uint64_t> &BasicFibbleMode<L>::adjacency() {
+    static const std::vector<uint64_t> table = [] {
+        std::vector<uint64_t> bits(Traits::patterns * kStride, 0);
+        for (size_t p = 0; p < Traits::patterns; ++p) {
+            size_t place = 1;
+            for (size_t i = 0; i < L; ++i, place *= 3) {
+                size_t digit = p / place % 3;
+                for (size_t other = 0; other < 3; ++other) {
+                    if (other == digit) continue;
+                    size_t q = p - digit * place + other * place;
+                    bits[p * kStride + q / 64] |= uint64_t(1) << (q % 64);
+                }
+            }
+        }
+        return bits;
+    }();
+    return table;
+}
+
+template<size_t L>
+std::vector<std::string> BasicFibbleMode<L>::get_new_solutions(
+    const std::vector<std::string> &solutions,
+    const std::string &guess,
+    Pattern reported
+) const {
+    const uint64_t *row_bits = adjacency().data() + reported * kStride;
+    long guess_idx = feedback.index_of(guess);
+    bool materialised = feedback.is_materialised() && guess_idx >= 0;
+
+    // Look every pattern up first, then keep candidates with a branch free compaction
+    std::vector<Pattern> patterns(solutions.size());
+    if (materialised) {
+        const Pattern *row = feedback.row(guess_idx);
+        for (size_t i = 0; i < solutions.size(); ++i) {
+            long idx = feedback.index_of(solutions[i]);
+            patterns[i] = idx >= 0 ? row[idx] : feedback.get_feedback(guess, solutions[i]);
+        }
+    } else {
+        for (size_t i = 0; i < solutions.size(); ++i)
+            patterns[i] = feedback.get_feedback(guess, solutions[i]);
+    }
+
+    std::vector<uint32_t> kept(solutions.size());
+    size_t n_kept = 0;
+    for (size_t i = 0; i < solutions.size(); ++i) {
+        kept[n_kept] = static_cast<uint32_t>(i);
+        n_kept += row_bits[patterns[i] / 64] >> (patterns[i] % 64) & 1;
+    }
+
+    std::vector<std::string> new_solutions;
+    new_solutions.reserve(n_kept);
+    for (size_t i = 0; i < n_kept; ++i)
+        new_solutions.push_back(solutions[kept[i]]);
+    return new_solutions;
+}
+
+template<size_t L>
+std::vector<std::pair<std::string, double>> BasicFibbleMode<L>::get_entropy(
+    const std::vector<std::string> &guesses,
+    const std::vector<std::string> &solutions
+) const {
+    size_t n_guesses = guesses.size();
+    std::vector<std::pair<std::string, double>> results(n_guesses);
+    if (n_guesses == 0 || solutions.empty()) return results;
+
+    std::vector<long> ids(solutions.size());
+    for (size_t i = 0; i < solutions.size(); ++i) ids[i] = feedback.index_of(solutions[i]);
+    bool materialised = feedback.is_materialised();
+
+    // Every answer reports each of its true pattern's neighbours with probability 1 / 2L
+    double total = static_cast<double>(solutions.size() * kNeighbours);
+    double log_total = std::log2(total);
+
+    auto compute_block = [&](size_t g_start, size_t g_end) {
+        std::vector<uint32_t> counts(Traits::patterns, 0);
+        std::vector<uint32_t> reported(Traits::patterns, 0);
+
+        for (size_t g = g_start; g < g_end; ++g) {
+            const std::string &guess = guesses[g];
+            long guess_idx = feedback.index_of(guess);
+            const Pattern *row = materialised && guess_idx >= 0 ? feedback.row(guess_idx) : nullptr;
+
+            for (size_t i = 0; i < solutions.size(); ++i)
+                counts[row && ids[i] >= 0 ? row[ids[i]] : feedback.get_feedback(guess, solutions[i])]++;
+
+            for (size_t p = 0; p < Traits::patterns; ++p) {
+                if (counts[p] == 0) continue;
+                size_t place = 1;
+                for (size_t i = 0; i < L; ++i, place *= 3) {
+                    size_t digit = p / place % 3;
+                    for (size_t other = 0; other < 3; ++other)
+                        if (other != digit) reported[p - digit * place + other * place] += counts[p];
+                }
+                counts[p] = 0;
+            }
+
+            double entropy = 0.0;
+            for (size_t r = 0; r < Traits::patterns; ++r) {
+                if (reported[r] == 0) continue;
+                double c = static_cast<double>(reported[r]);
+                entropy -= c / total * (std::log2(c) - log_total);
+                reported[r] = 0;
+            }
+            results[g] = {guess, entropy};
+        }
+    };
+
+    size_t n_threads = std::max(1u, std::thread::hardware_concurrency());
+    ThreadPool pool(n_threads);
+    pool.parallel_for(0, n_guesses, ThreadPool::block_size(n_guesses, n_threads), compute_block);
+
+    return results;
+}
+
+template<size_t L>
+int BasicFibbleMode<L>::run(std::vector<std::string> guesses,
+                            std::vector<std::string> solutions,
+                            const std::string &answer) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<size_t> pick_tile(0, L - 1);
+    std::uniform_int_distribution<size_t> pick_shift(1, 2);
+    size_t guess_count = 0;
+
+    while (!solutions.empty() && guess_count < kMaxGuesses) {
+        std::string best_guess = solutions[0];
+        double best_entropy = 0.0;
+
+        // Among equal scores prefer a guess that could be the answer, candidates marked by word id
+        if (solutions.size() > 1) {
+            std::vector<bool> candidate_ids(feedback.get_words().size(), false);
+            for (const auto &s : solutions) {
+                long id = feedback.index_of(s);
+                if (id >= 0) candidate_ids[id] = true;
+            }
+
+            bool best_candidate = true;
+            auto entropies = get_entropy(guesses, solutions);
+            for (const auto &[guess, entropy] : entropies) {
+                double diff = entropy - best_entropy;
+                long id = feedback.index_of(guess);
+                bool candidate = id >= 0 && candidate_ids[id];
+                if (diff > 1e-9 || (diff > -1e-9 && candidate && !best_candidate)) {
+                    best_guess = guess;
+                    best_entropy = entropy;
+                    best_candidate = candidate;
+                }
+            }
+        }
+        guess_count++;
+
+        display.showOutput("Next Guess: " + display.word(best_guess) + " | Expected Entropy: " + std::to_string(best_entropy));
+        if (best_guess == answer) {
+            display.showOutput("Solution found in " + std::to_string(guess_count) + " guesses: " + display.word(answer));
+            return static_cast<int>(guess_count);
+        }
+
+        // Report the true pattern with one tile changed to another colour
+        uint32_t reported = feedback.get_feedback(best_guess, answer);
+        size_t place = 1;
+        for (size_t i = pick_tile(rng); i > 0; --i) place *= 3;
+        size_t digit = reported / place % 3;
+        reported = static_cast<uint32_t>(reported - digit * place + (digit + pick_shift(rng)) % 3 * place);
+
+        solutions = get_new_solutions(solutions, best_guess, static_cast<Pattern>(reported));
+        solutions.erase(std::remove(solutions.begin(), solutions.end(), best_guess), solutions.end());
+        guesses.erase(std::remove(guesses.begin(), guesses.end(), best_guess), guesses.end());
+
+        display.showOutput("Feedback: " + pattern_string(reported, L) + " (one tile is a lie) | Remaining: " +
+                           std::to_string(solutions.size()));
+    }
+
+    display.showOutput("No solution found.\n");
+    return -1;
+}
+
+WORDLE_SOLVED_INSTANTIATE(BasicFibbleMode)
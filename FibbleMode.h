@@ -0,0 +1,64 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_FIBBLEMODE_H
+#define WORDLE_SOLVED_FIBBLEMODE_H
+#pragma once
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Display.h"
+#include "Feedback.h"
+#include "WordTraits.h"
+
+
+// Fibble, where exactly one tile of every reported pattern is wrong. A candidate stays
+// consistent when its true pattern differs from the reported one in exactly one tile, which
+// is looked up in a patterns x patterns adjacency bitset. Guesses maximise the entropy of the
+// reported pattern, whose distribution is the true pattern histogram spread over each
+// pattern's 2L neighbours.
+template<size_t L>
+class BasicFibbleMode {
+public:
+    using Traits = WordTraits<L>;
+    using Pattern = typename Traits::Pattern;
+
+    static constexpr size_t kMaxGuesses = 9;
+
+    // Patterns one tile away from another, every row holds exactly 2L bits
+    static constexpr size_t kNeighbours = 2 * L;
+    static constexpr size_t kStride = (Traits::patterns + 63) / 64;
+
+private:
+    Display &display;
+    BasicFeedback<L> &feedback;
+    unsigned seed;
+
+    static const std::vector<uint64_t> &adjacency();
+
+public:
+    BasicFibbleMode(Display &display, BasicFeedback<L> &feedback_instance, unsigned seed = 1);
+
+    static bool adjacent(Pattern reported, Pattern actual) {
+        return adjacency()[reported * kStride + actual / 64] >> (actual % 64) & 1;
+    }
+
+    // Candidates whose true pattern for guess is one tile away from the reported pattern
+    std::vector<std::string> get_new_solutions(const std::vector<std::string> &solutions,
+                                               const std::string &guess,
+                                               Pattern reported) const;
+
+    // Entropy of the reported pattern of each guess over solutions
+    std::vector<std::pair<std::string, double>> get_entropy(const std::vector<std::string> &guesses,
+                                                            const std::vector<std::string> &solutions) const;
+
+    // Play against answer with one random lie per row, returns the guesses used or -1
+    int run(std::vector<std::string> guesses, std::vector<std::string> solutions, const std::string &answer);
+};
+
+using FibbleMode = BasicFibbleMode<5>;
+
+
+#endif //WORDLE_SOLVED_FIBBLEMODE_H
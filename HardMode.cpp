@@ -0,0 +1,46 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "HardMode.h"
+#include <type_traits>
+
+template<size_t L, class Rule>
+BasicHardMode<L, Rule>::BasicHardMode(const BasicFeedback<L, Rule> &feedback_instance, const std::vector<std::string> &guesses)
+    : feedback(feedback_instance),
+      allowed((feedback.size() + 63) / 64, 0) {
+    for (const auto &guess : guesses) {
+        long idx = feedback.index_of(guess);
+        if (idx >= 0) allowed[idx / 64] |= uint64_t(1) << (idx % 64);
+    }
+}
+
+template<size_t L, class Rule>
+void BasicHardMode<L, Rule>::apply(const std::string &guess, typename Rule::Pattern pattern) {
+    // The letter index decodes Wordle's Base 3 patterns, other rules compare word by word
+    if constexpr (std::is_same_v<Rule, WordleRule<L>>) {
+        feedback.get_letter_index().apply_feedback(allowed, guess, pattern);
+    } else {
+        const std::vector<std::string> &words = feedback.get_words();
+        for (uint32_t idx : LetterIndex::indices(allowed))
+            if (feedback.get_feedback_cached(guess, words[idx]) != pattern) LetterIndex::reset(allowed, idx);
+    }
+}
+
+template<size_t L, class Rule>
+void BasicHardMode<L, Rule>::remove(const std::string &guess) {
+    long idx = feedback.index_of(guess);
+    if (idx >= 0) LetterIndex::reset(allowed, static_cast<size_t>(idx));
+}
+
+template<size_t L, class Rule>
+std::vector<std::string> BasicHardMode<L, Rule>::get_guesses() const {
+    const std::vector<std::string> &words = feedback.get_words();
+    std::vector<std::string> guesses;
+    for (uint32_t idx : LetterIndex::indices(allowed))
+        guesses.push_back(words[idx]);
+    return guesses;
+}
+
+WORDLE_SOLVED_INSTANTIATE(BasicHardMode)
+WORDLE_SOLVED_INSTANTIATE_RULES(BasicHardMode)
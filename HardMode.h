@@ -0,0 +1,39 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_HARDMODE_H
+#define WORDLE_SOLVED_HARDMODE_H
+#pragma once
+#include <string>
+#include <vector>
+#include "Feedback.h"
+#include "LetterIndex.h"
+
+
+// Guesses allowed in hard mode, where every guess must be consistent with all hints so far.
+// Kept as a bitset over the feedback table's words, narrowed with its letter index under
+// Wordle rules and by comparing feedback under any other.
+template<size_t L, class Rule = WordleRule<L>>
+class BasicHardMode {
+private:
+    const BasicFeedback<L, Rule> &feedback;
+    LetterIndex::Bits allowed;
+
+public:
+    BasicHardMode(const BasicFeedback<L, Rule> &feedback_instance, const std::vector<std::string> &guesses);
+
+    // Keep guesses consistent with guess receiving pattern
+    void apply(const std::string &guess, typename Rule::Pattern pattern);
+
+    // Drop a guess, e.g. one the game rejected
+    void remove(const std::string &guess);
+
+    std::vector<std::string> get_guesses() const;
+    size_t size() const {return LetterIndex::count(allowed);}
+};
+
+using HardMode = BasicHardMode<5>;
+
+
+#endif //WORDLE_SOLVED_HARDMODE_H
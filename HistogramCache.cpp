@@ -0,0 +1,167 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "HistogramCache.h"
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace {
+    constexpr char kMagic[8] = {'W', 'S', 'H', 'I', 'S', 'T', '0', '1'};
+
+    // FNV-1a over the words in order, so a file only matches the lists it was built from
+    uint64_t fingerprint_of(const std::vector<std::string> &words, const std::vector<std::string> &answers) {
+        uint64_t hash = 14695981039346656037ull;
+        auto mix = [&](unsigned char byte) {
+            hash ^= byte;
+            hash *= 1099511628211ull;
+        };
+        for (const auto &list : {&words, &answers}) {
+            for (const auto &word : *list) {
+                for (char c : word) mix(static_cast<unsigned char>(c));
+                mix(0);
+            }
+            mix(0xff);
+        }
+        return hash;
+    }
+
+    void write_u32(std::ofstream &file, uint32_t value) {
+        unsigned char bytes[4] = {static_cast<unsigned char>(value), static_cast<unsigned char>(value >> 8),
+                                  static_cast<unsigned char>(value >> 16), static_cast<unsigned char>(value >> 24)};
+        file.write(reinterpret_cast<const char *>(bytes), 4);
+    }
+
+    bool read_u32(std::ifstream &file, uint32_t &value) {
+        unsigned char bytes[4];
+        if (!file.read(reinterpret_cast<char *>(bytes), 4)) return false;
+        value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+        return true;
+    }
+}
+
+template<size_t L, class Rule>
+bool BasicHistogramCache<L, Rule>::bind(const BasicFeedback<L, Rule> &feedback_instance,
+                                        const std::vector<std::string> &answers, std::string &error) {
+    if (!feedback_instance.is_materialised()) {
+        error = "turn-1 histograms need the feedback table, which exceeds the memory budget";
+        return false;
+    }
+    if (answers.empty() || answers.size() > std::numeric_limits<uint16_t>::max()) {
+        error = "turn-1 histograms support 1 to 65535 answers";
+        return false;
+    }
+
+    std::vector<uint32_t> ids;
+    std::vector<uint8_t> marks(feedback_instance.size(), 0);
+    ids.reserve(answers.size());
+    for (const auto &answer : answers) {
+        long idx = feedback_instance.index_of(answer);
+        if (idx < 0) {
+            error = "answer " + answer + " is not in the word list";
+            return false;
+        }
+        ids.push_back(static_cast<uint32_t>(idx));
+        marks[static_cast<size_t>(idx)] = 1;
+    }
+
+    feedback = &feedback_instance;
+    answer_ids = std::move(ids);
+    is_answer = std::move(marks);
+    fingerprint = fingerprint_of(feedback_instance.get_words(), answers);
+    return true;
+}
+
+template<size_t L, class Rule>
+bool BasicHistogramCache<L, Rule>::build(const BasicFeedback<L, Rule> &feedback_instance,
+                                         const std::vector<std::string> &answers, std::string &error) {
+    if (!bind(feedback_instance, answers, error)) return false;
+
+    size_t n = feedback_instance.size();
+    histograms.assign(n * Rule::patterns, 0);
+    for (size_t g = 0; g < n; ++g) {
+        const Pattern *row = feedback_instance.row(g);
+        uint16_t *histogram = histograms.data() + g * Rule::patterns;
+        for (uint32_t id : answer_ids) histogram[row[id]]++;
+    }
+    return true;
+}
+
+template<size_t L, class Rule>
+bool BasicHistogramCache<L, Rule>::load(const std::string &path, const BasicFeedback<L, Rule> &feedback_instance,
+                                        const std::vector<std::string> &answers, std::string &error) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        error = "cannot open " + path;
+        return false;
+    }
+    if (!bind(feedback_instance, answers, error)) return false;
+
+    char magic[8];
+    uint32_t patterns = 0, words = 0, n_answers = 0, low = 0, high = 0;
+    if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(magic)) != 0 ||
+        !read_u32(file, patterns) || !read_u32(file, words) || !read_u32(file, n_answers) ||
+        !read_u32(file, low) || !read_u32(file, high)) {
+        error = path + " is not a histogram file";
+        return false;
+    }
+    if (patterns != Rule::patterns || words != feedback_instance.size() || n_answers != answers.size() ||
+        ((static_cast<uint64_t>(high) << 32) | low) != fingerprint) {
+        error = path + " was built for other word lists";
+        return false;
+    }
+
+    std::vector<uint16_t> loaded(static_cast<size_t>(words) * patterns);
+    if (!file.read(reinterpret_cast<char *>(loaded.data()),
+                   static_cast<std::streamsize>(loaded.size() * sizeof(uint16_t)))) {
+        error = path + " is truncated";
+        return false;
+    }
+    histograms = std::move(loaded);
+    return true;
+}
+
+template<size_t L, class Rule>
+bool BasicHistogramCache<L, Rule>::save(const std::string &path, std::string &error) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        error = "cannot write " + path;
+        return false;
+    }
+
+    file.write(kMagic, sizeof(kMagic));
+    write_u32(file, static_cast<uint32_t>(Rule::patterns));
+    write_u32(file, static_cast<uint32_t>(histograms.size() / Rule::patterns));
+    write_u32(file, static_cast<uint32_t>(answer_ids.size()));
+    write_u32(file, static_cast<uint32_t>(fingerprint));
+    write_u32(file, static_cast<uint32_t>(fingerprint >> 32));
+    file.write(reinterpret_cast<const char *>(histograms.data()),
+               static_cast<std::streamsize>(histograms.size() * sizeof(uint16_t)));
+    if (!file) {
+        error = "cannot write " + path;
+        return false;
+    }
+    return true;
+}
+
+template<size_t L, class Rule>
+bool BasicHistogramCache<L, Rule>::get_removed(const std::vector<std::string> &solutions,
+                                               std::vector<uint32_t> &removed) const {
+    removed.clear();
+    if (histograms.empty() || solutions.size() * 2 <= answer_ids.size()) return false;
+
+    std::vector<uint8_t> kept(is_answer.size(), 0);
+    for (const auto &solution : solutions) {
+        long idx = feedback->index_of(solution);
+        if (idx < 0 || !is_answer[static_cast<size_t>(idx)] || kept[static_cast<size_t>(idx)]) return false;
+        kept[static_cast<size_t>(idx)] = 1;
+    }
+
+    for (uint32_t id : answer_ids)
+        if (!kept[id]) removed.push_back(id);
+    return true;
+}
+
+WORDLE_SOLVED_INSTANTIATE(BasicHistogramCache)
+WORDLE_SOLVED_INSTANTIATE_RULES(BasicHistogramCache)
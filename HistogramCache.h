@@ -0,0 +1,67 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_HISTOGRAMCACHE_H
+#define WORDLE_SOLVED_HISTOGRAMCACHE_H
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Feedback.h"
+#include "WordTraits.h"
+
+
+// Turn-1 pattern histograms of every word in the table over the full answer set, which never
+// change between games. Later candidate sets are subsets of the answers, so their histograms
+// are the turn-1 histogram minus the removed answers, cheaper whenever fewer were removed
+// than kept. Saved little-endian as:
+//   "WSHIST01", uint32 patterns, uint32 words, uint32 answers, uint64 fingerprint of both lists,
+//   uint16 histograms[words][patterns]
+template<size_t L, class Rule = WordleRule<L>>
+class BasicHistogramCache {
+public:
+    using Pattern = typename Rule::Pattern;
+
+private:
+    const BasicFeedback<L, Rule> *feedback = nullptr;
+    std::vector<uint16_t> histograms;
+    std::vector<uint32_t> answer_ids;
+    std::vector<uint8_t> is_answer;
+    uint64_t fingerprint = 0;
+
+    // Resolve the answers against the table, false if any is missing or there are too many
+    bool bind(const BasicFeedback<L, Rule> &feedback_instance, const std::vector<std::string> &answers,
+              std::string &error);
+
+public:
+    // Count every word against the answers, needs a materialised table
+    bool build(const BasicFeedback<L, Rule> &feedback_instance, const std::vector<std::string> &answers,
+               std::string &error);
+
+    // Load histograms saved for the same word and answer lists
+    bool load(const std::string &path, const BasicFeedback<L, Rule> &feedback_instance,
+              const std::vector<std::string> &answers, std::string &error);
+    bool save(const std::string &path, std::string &error) const;
+
+    bool empty() const {return histograms.empty();}
+
+    // Answers missing from solutions, when solutions are answers and fewer were removed than
+    // kept. False means counting the solutions directly is cheaper.
+    bool get_removed(const std::vector<std::string> &solutions, std::vector<uint32_t> &removed) const;
+
+    // Histogram of guess over the answers left after removed, counts is overwritten
+    template<class Counts>
+    void get_counts(size_t guess, const std::vector<uint32_t> &removed, Counts &counts) const {
+        const uint16_t *histogram = histograms.data() + guess * Rule::patterns;
+        for (size_t p = 0; p < Rule::patterns; ++p) counts[p] = histogram[p];
+        const Pattern *row = feedback->row(guess);
+        for (uint32_t id : removed) counts[row[id]]--;
+    }
+};
+
+using HistogramCache = BasicHistogramCache<5>;
+
+
+#endif //WORDLE_SOLVED_HISTOGRAMCACHE_H
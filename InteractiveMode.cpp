@@ -8,16 +8,21 @@
 #include <string>
 #include <iostream>
 
-InteractiveMode::InteractiveMode(Display &display, Feedback &feedback_instance)
+template<size_t L>
+BasicInteractiveMode<L>::BasicInteractiveMode(Display &display, BasicFeedback<L> &feedback_instance, bool hard_mode, Metric metric)
     : display(display),
       feedback(feedback_instance),
-      entropy(feedback) {}
+      entropy(feedback),
+      hard_mode(hard_mode),
+      metric(metric) {}
 
-void InteractiveMode::run(std::vector<std::string>  guesses,
+template<size_t L>
+void BasicInteractiveMode<L>::run(std::vector<std::string>  guesses,
                       std::vector<std::string>  solutions,
                       int steps) {
-    std::vector<std::pair<std::string, uint8_t>> guessFeedback;
+    std::vector<std::pair<std::string, uint16_t>> guessFeedback;
     size_t guess_count = 1;
+    BasicHardMode<L> hard(feedback, guesses);
 
     while (solutions.size() > 1) {
         int k = steps;
@@ -25,15 +30,19 @@ void InteractiveMode::run(std::vector<std::string>  guesses,
             k = 7 - guess_count;
         }
 
-        auto [best_guess, best_entropy] = entropy.get_best_guess(
-            guesses, solutions, k, display);
+        // Only score guesses consistent with every hint so far
+        if (hard_mode && !guessFeedback.empty())
+            guesses = hard.get_guesses();
+
+        auto [best_guess, best_score] = entropy.get_best_guess(
+            guesses, solutions, k, display, metric);
 
         guesses.erase(std::remove(guesses.begin(), guesses.end(), best_guess),
                             guesses.end());
 
         display.clearDisplay();
         display.showGuesses(guessFeedback, best_guess);
-        display.showOutput("Next Guess: " + best_guess + " | Expected Entropy (over " + std::to_string(k) + " steps): " + std::to_string(best_entropy));
+        display.showOutput("Next Guess: " + display.word(best_guess) + " | " + metric_label(metric) + " (over " + std::to_string(k) + " steps): " + std::to_string(best_score));
 
         std::string fb_input;
         while (true) {
@@ -42,17 +51,18 @@ void InteractiveMode::run(std::vector<std::string>  guesses,
             // Remove Invalid Guess
             if (fb_input.find('N') != std::string::npos || fb_input.find('n') != std::string::npos) {
                 guesses.erase(std::remove(guesses.begin(), guesses.end(), best_guess), guesses.end());
+                hard.remove(best_guess);
                 break;
             }
 
             // Validate input length and characters
-            if (fb_input.length() != 5 || fb_input.find_first_not_of("GYBgyb") != std::string::npos) {
-                std::cout << "Invalid feedback! Must be 5 letters using G/Y/B/ or N for an invalid guess.\n";
+            if (fb_input.length() != L || fb_input.find_first_not_of("GYBgyb") != std::string::npos) {
+                std::cout << "Invalid feedback! Must be " << L << " letters using G/Y/B/ or N for an invalid guess.\n";
                 continue;
             }
 
             // Encode feedback to Base 3
-            uint8_t fb_encoded = 0;
+            typename WordTraits<L>::Pattern fb_encoded = 0;
             for (char c : fb_input) {
                 uint8_t code = 0;
                 switch (toupper(c)) {
@@ -70,6 +80,8 @@ void InteractiveMode::run(std::vector<std::string>  guesses,
                 std::cout << "Invalid Feedback! Please enter correct feedback. \n";
             } else {
                 solutions = new_solutions;
+                if (hard_mode)
+                    hard.apply(best_guess, fb_encoded);
                 guessFeedback.push_back({best_guess, fb_encoded});
                 guess_count++;
                 break;
@@ -78,12 +90,14 @@ void InteractiveMode::run(std::vector<std::string>  guesses,
     }
 
     if (!solutions.empty()) {
-        guessFeedback.push_back({solutions[0], 242});
+        guessFeedback.push_back({solutions[0], WordTraits<L>::solved});
 
         display.clearDisplay();
         display.showGuesses(guessFeedback);
-        display.showOutput("\nSolution found in " + std::to_string(guess_count) + " guesses: " + solutions[0]);
+        display.showOutput("\nSolution found in " + std::to_string(guess_count) + " guesses: " + display.word(solutions[0]));
     } else {
         display.showOutput("No solution found.\n");
     }
-}
\ No newline at end of file
+}
+
+WORDLE_SOLVED_INSTANTIATE(BasicInteractiveMode)
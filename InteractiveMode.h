@@ -9,22 +9,38 @@
 #include <string>
 #include "Display.h"
 #include "Entropy.h"
+#include "HardMode.h"
 #include "Feedback.h"
 
 
-class InteractiveMode {
+template<size_t L>
+class BasicInteractiveMode {
 private:
     Display &display;
-    Feedback &feedback;
-    Entropy entropy;
+    BasicFeedback<L> &feedback;
+    BasicEntropy<L> entropy;
+    bool hard_mode;
+    Metric metric;
 
 public:
-    InteractiveMode(Display &display, Feedback &feedback_instance);
+    BasicInteractiveMode(Display &display, BasicFeedback<L> &feedback_instance, bool hard_mode = false,
+                         Metric metric = Metric::Entropy);
+
+    // Score only the best survivors of a cheap first pass, see BasicEntropy::set_prefilter
+    void set_prefilter(size_t survivors, bool safe) {entropy.set_prefilter(survivors, safe);}
+
+    // Value model for Metric::Model, see BasicEntropy::set_model
+    void set_model(const Mlp *model) {entropy.set_model(model);}
+
+    // Turn-1 histograms, see BasicEntropy::set_histograms
+    void set_histograms(const BasicHistogramCache<L> *histograms) {entropy.set_histograms(histograms);}
 
     void run(std::vector<std::string> all_solutions,
              std::vector<std::string> solutions,
              int steps);
 };
 
+using InteractiveMode = BasicInteractiveMode<5>;
+
 
 #endif //WORDLE_SOLVED_INTERACTIVEMODE_H
\ No newline at end of file
@@ -0,0 +1,144 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_JSON_H
+#define WORDLE_SOLVED_JSON_H
+#pragma once
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+
+// Minimal reader/writer for the flat JSON objects used by the daemon protocol.
+// Values are kept as their raw text (strings are unescaped), nested values are skipped.
+class JsonObject {
+private:
+    std::unordered_map<std::string, std::string> values;
+
+    static void skip_ws(const std::string &s, size_t &i) {
+        while (i < s.size() && (s[i] == ' ' || s[i] == '\t' || s[i] == '\r' || s[i] == '\n')) ++i;
+    }
+
+    static bool parse_string(const std::string &s, size_t &i, std::string &out) {
+        if (i >= s.size() || s[i] != '"') return false;
+        ++i;
+        out.clear();
+        while (i < s.size() && s[i] != '"') {
+            char c = s[i++];
+            if (c == '\\' && i < s.size()) {
+                char e = s[i++];
+                switch (e) {
+                    case 'n': out += '\n'; break;
+                    case 't': out += '\t'; break;
+                    case 'r': out += '\r'; break;
+                    default: out += e; break;
+                }
+            } else {
+                out += c;
+            }
+        }
+        if (i >= s.size()) return false;
+        ++i;
+        return true;
+    }
+
+    // Skip a nested object/array, keeping its raw text
+    static bool parse_nested(const std::string &s, size_t &i, std::string &out) {
+        size_t start = i;
+        int depth = 0;
+        bool in_string = false;
+        for (; i < s.size(); ++i) {
+            char c = s[i];
+            if (in_string) {
+                if (c == '\\') ++i;
+                else if (c == '"') in_string = false;
+            } else if (c == '"') {
+                in_string = true;
+            } else if (c == '{' || c == '[') {
+                depth++;
+            } else if (c == '}' || c == ']') {
+                if (--depth == 0) {
+                    ++i;
+                    out = s.substr(start, i - start);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+public:
+    bool parse(const std::string &line) {
+        values.clear();
+        size_t i = 0;
+        skip_ws(line, i);
+        if (i >= line.size() || line[i] != '{') return false;
+        ++i;
+
+        while (true) {
+            skip_ws(line, i);
+            if (i < line.size() && line[i] == '}') return true;
+
+            std::string key, value;
+            if (!parse_string(line, i, key)) return false;
+            skip_ws(line, i);
+            if (i >= line.size() || line[i] != ':') return false;
+            ++i;
+            skip_ws(line, i);
+            if (i >= line.size()) return false;
+
+            if (line[i] == '"') {
+                if (!parse_string(line, i, value)) return false;
+            } else if (line[i] == '{' || line[i] == '[') {
+                if (!parse_nested(line, i, value)) return false;
+            } else {
+                size_t start = i;
+                while (i < line.size() && line[i] != ',' && line[i] != '}') ++i;
+                value = line.substr(start, i - start);
+                while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) value.pop_back();
+            }
+            values[key] = value;
+
+            skip_ws(line, i);
+            if (i < line.size() && line[i] == ',') { ++i; continue; }
+            if (i < line.size() && line[i] == '}') return true;
+            return false;
+        }
+    }
+
+    bool has(const std::string &key) const { return values.count(key) > 0; }
+
+    std::string get(const std::string &key, const std::string &fallback = "") const {
+        auto it = values.find(key);
+        return it == values.end() ? fallback : it->second;
+    }
+
+    long get_int(const std::string &key, long fallback = 0) const {
+        auto it = values.find(key);
+        if (it == values.end() || it->second.empty()) return fallback;
+        char *end = nullptr;
+        long v = std::strtol(it->second.c_str(), &end, 10);
+        return (end && *end == '\0') ? v : fallback;
+    }
+
+    static std::string escape(const std::string &s) {
+        std::string out;
+        out.reserve(s.size() + 2);
+        out += '"';
+        for (char c : s) {
+            switch (c) {
+                case '"': out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\t': out += "\\t"; break;
+                case '\r': out += "\\r"; break;
+                default: out += c; break;
+            }
+        }
+        out += '"';
+        return out;
+    }
+};
+
+
+#endif //WORDLE_SOLVED_JSON_H
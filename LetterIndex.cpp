@@ -0,0 +1,115 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "LetterIndex.h"
+#include <algorithm>
+#include <bitset>
+
+void LetterIndex::build(const std::vector<std::string> &words, size_t word_length) {
+    n_words = words.size();
+    length = word_length;
+    stride = (n_words + 63) / 64;
+
+    positions.assign(length * Alphabet::kMaxSymbols * stride, 0);
+    at_least.assign(Alphabet::kMaxSymbols * length * stride, 0);
+
+    for (size_t w = 0; w < n_words; ++w) {
+        const std::string &word = words[w];
+        uint64_t bit = uint64_t(1) << (w % 64);
+        size_t block = w / 64;
+
+        uint8_t counts[Alphabet::kMaxSymbols] = {0};
+        for (size_t pos = 0; pos < length; ++pos) {
+            size_t symbol = Alphabet::index(word[pos]);
+            positions[(pos * Alphabet::kMaxSymbols + symbol) * stride + block] |= bit;
+            size_t count = ++counts[symbol];
+            at_least[(symbol * length + count - 1) * stride + block] |= bit;
+        }
+    }
+}
+
+LetterIndex::Bits LetterIndex::all() const {
+    Bits bits(stride, ~uint64_t(0));
+    if (n_words % 64 != 0) bits.back() = (uint64_t(1) << (n_words % 64)) - 1;
+    return bits;
+}
+
+void LetterIndex::require_at(Bits &bits, size_t pos, char symbol) const {
+    const uint64_t *mask = position_bits(pos, symbol);
+    for (size_t i = 0; i < stride; ++i) bits[i] &= mask[i];
+}
+
+void LetterIndex::exclude_at(Bits &bits, size_t pos, char symbol) const {
+    const uint64_t *mask = position_bits(pos, symbol);
+    for (size_t i = 0; i < stride; ++i) bits[i] &= ~mask[i];
+}
+
+void LetterIndex::require_count(Bits &bits, char symbol, size_t count) const {
+    if (count == 0) return;
+    if (count > length) {
+        std::fill(bits.begin(), bits.end(), 0);
+        return;
+    }
+    const uint64_t *mask = count_bits(symbol, count);
+    for (size_t i = 0; i < stride; ++i) bits[i] &= mask[i];
+}
+
+void LetterIndex::limit_count(Bits &bits, char symbol, size_t count) const {
+    if (count >= length) return;
+    const uint64_t *mask = count_bits(symbol, count + 1);
+    for (size_t i = 0; i < stride; ++i) bits[i] &= ~mask[i];
+}
+
+void LetterIndex::apply_feedback(Bits &bits, const std::string &guess, uint32_t pattern) const {
+    // Base 3 digits, most significant first
+    uint8_t codes[kMaxWordLength];
+    for (size_t i = length; i-- > 0;) {
+        codes[i] = static_cast<uint8_t>(pattern % 3);
+        pattern /= 3;
+    }
+
+    // Greens fix a position, yellows and grays rule one out
+    uint8_t marked[Alphabet::kMaxSymbols] = {0};
+    bool gray[Alphabet::kMaxSymbols] = {false};
+    for (size_t pos = 0; pos < length; ++pos) {
+        size_t symbol = Alphabet::index(guess[pos]);
+        if (codes[pos] == 2) {
+            require_at(bits, pos, guess[pos]);
+        } else {
+            exclude_at(bits, pos, guess[pos]);
+        }
+        if (codes[pos] > 0) marked[symbol]++;
+        else gray[symbol] = true;
+    }
+
+    // Green and yellow copies give a minimum count, a gray copy makes it exact
+    for (size_t pos = 0; pos < length; ++pos) {
+        size_t symbol = Alphabet::index(guess[pos]);
+        if (marked[symbol] == 0 && !gray[symbol]) continue;
+        require_count(bits, guess[pos], marked[symbol]);
+        if (gray[symbol]) limit_count(bits, guess[pos], marked[symbol]);
+        marked[symbol] = 0;
+        gray[symbol] = false;
+    }
+}
+
+size_t LetterIndex::count(const Bits &bits) {
+    size_t total = 0;
+    for (uint64_t word : bits) total += std::bitset<64>(word).count();
+    return total;
+}
+
+std::vector<uint32_t> LetterIndex::indices(const Bits &bits) {
+    std::vector<uint32_t> out;
+    out.reserve(count(bits));
+    for (size_t i = 0; i < bits.size(); ++i) {
+        uint64_t word = bits[i];
+        while (word) {
+            size_t bit = std::bitset<64>((word & (~word + 1)) - 1).count();
+            out.push_back(static_cast<uint32_t>(i * 64 + bit));
+            word &= word - 1;
+        }
+    }
+    return out;
+}
@@ -0,0 +1,70 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_LETTERINDEX_H
+#define WORDLE_SOLVED_LETTERINDEX_H
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Alphabet.h"
+#include "WordTraits.h"
+
+
+// Inverted index of a word list as bitsets over word indices: one per position x symbol
+// and one per symbol x minimum count. Constraints on letters and positions are answered
+// with a few ANDs over n / 64 words instead of a pass over the word list.
+class LetterIndex {
+public:
+    using Bits = std::vector<uint64_t>;
+
+private:
+    size_t n_words = 0;
+    size_t length = 0;
+    size_t stride = 0;
+
+    // positions[(pos * kMaxSymbols + symbol) * stride], at_least[(symbol * length + count - 1) * stride]
+    std::vector<uint64_t> positions;
+    std::vector<uint64_t> at_least;
+
+    const uint64_t *position_bits(size_t pos, char symbol) const {
+        return positions.data() + (pos * Alphabet::kMaxSymbols + Alphabet::index(symbol)) * stride;
+    }
+    const uint64_t *count_bits(char symbol, size_t count) const {
+        return at_least.data() + (Alphabet::index(symbol) * length + count - 1) * stride;
+    }
+
+public:
+    // Build over words of equal length, encoded as alphabet symbols
+    void build(const std::vector<std::string> &words, size_t word_length);
+
+    size_t size() const {return n_words;}
+    size_t word_length() const {return length;}
+
+    // Every word
+    Bits all() const;
+
+    // Narrow a set to words with / without symbol at pos
+    void require_at(Bits &bits, size_t pos, char symbol) const;
+    void exclude_at(Bits &bits, size_t pos, char symbol) const;
+
+    // Narrow a set to words with at least / at most count copies of symbol
+    void require_count(Bits &bits, char symbol, size_t count) const;
+    void limit_count(Bits &bits, char symbol, size_t count) const;
+
+    // Narrow a set to words consistent with guess receiving a Base 3 feedback pattern,
+    // i.e. the words that would give that pattern if they were the answer
+    void apply_feedback(Bits &bits, const std::string &guess, uint32_t pattern) const;
+
+    static size_t count(const Bits &bits);
+    static bool test(const Bits &bits, size_t index) {return bits[index / 64] >> (index % 64) & 1;}
+    static void reset(Bits &bits, size_t index) {bits[index / 64] &= ~(uint64_t(1) << (index % 64));}
+
+    // Indices of the set bits, ascending
+    static std::vector<uint32_t> indices(const Bits &bits);
+};
+
+
+#endif //WORDLE_SOLVED_LETTERINDEX_H
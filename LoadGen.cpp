@@ -0,0 +1,205 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+// Soak test client for the solver daemon: plays concurrent games over the
+// Unix socket and reports client side latency percentiles per command.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Dictionary.h"
+#include "Display.h"
+#include "Feedback.h"
+#include "Json.h"
+#include "WordTraits.h"
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+struct LoadOptions {
+    std::string socket_path = "/tmp/wordle_solved.sock";
+    size_t clients = 8;
+    size_t games = 10;
+    unsigned seed = 1;
+    int k = 1;
+};
+
+struct LatencyLog {
+    std::mutex mutex;
+    std::map<std::string, std::vector<double>> samples;
+    std::atomic<size_t> errors{0};
+
+    void add(const std::string &cmd, double ms) {
+        std::lock_guard<std::mutex> lock(mutex);
+        samples[cmd].push_back(ms);
+    }
+};
+
+#ifdef _WIN32
+
+int main() {
+    std::cout << "Error: the load generator requires Unix domain sockets and is not supported on Windows.\n";
+    return 1;
+}
+
+#else
+
+class Connection {
+private:
+    int fd = -1;
+    std::string buffer;
+
+public:
+    explicit Connection(const std::string &path) {
+        sockaddr_un addr{};
+        if (path.size() >= sizeof(addr.sun_path)) return;
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd >= 0 && connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+
+    ~Connection() {
+        if (fd >= 0) close(fd);
+    }
+
+    bool ok() const { return fd >= 0; }
+
+    // Send one request line and wait for its response line
+    bool request(const std::string &line, std::string &response) {
+        std::string out = line + "\n";
+        if (send(fd, out.data(), out.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(out.size())) return false;
+
+        size_t newline;
+        char chunk[4096];
+        while ((newline = buffer.find('\n')) == std::string::npos) {
+            ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+            if (n <= 0) return false;
+            buffer.append(chunk, static_cast<size_t>(n));
+        }
+        response = buffer.substr(0, newline);
+        buffer.erase(0, newline + 1);
+        return true;
+    }
+};
+
+void run_client(const LoadOptions &opts, size_t client_id, const std::vector<std::string> &answers,
+                Feedback &feedback, LatencyLog &log) {
+    Connection conn(opts.socket_path);
+    if (!conn.ok()) {
+        log.errors.fetch_add(1);
+        return;
+    }
+
+    std::mt19937 rng(opts.seed + static_cast<unsigned>(client_id));
+    std::uniform_int_distribution<size_t> pick(0, answers.size() - 1);
+
+    auto timed = [&](const std::string &cmd, const std::string &line, JsonObject &response) {
+        std::string raw;
+        auto start = std::chrono::steady_clock::now();
+        bool ok = conn.request(line, raw);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (!ok || !response.parse(raw) || response.get("ok") != "true") {
+            log.errors.fetch_add(1);
+            return false;
+        }
+        log.add(cmd, ms);
+        return true;
+    };
+
+    for (size_t game = 0; game < opts.games; ++game) {
+        const std::string &answer = answers[pick(rng)];
+
+        JsonObject response;
+        if (!timed("new", "{\"cmd\":\"new\",\"k\":" + std::to_string(opts.k) + "}", response)) return;
+        std::string session = response.get("session");
+
+        for (int turn = 0; turn < 10; ++turn) {
+            if (turn % 3 == 1)
+                timed("topk", "{\"cmd\":\"topk\",\"session\":" + session + ",\"n\":5}", response);
+
+            if (!timed("suggest", "{\"cmd\":\"suggest\",\"session\":" + session + "}", response)) break;
+            std::string guess = response.get("guess");
+            if (guess == answer) break;
+
+            std::string pattern = pattern_string(feedback.get_feedback(guess, answer), WordTraits<5>::length);
+            if (!timed("feedback", "{\"cmd\":\"feedback\",\"session\":" + session +
+                                   ",\"guess\":\"" + guess + "\",\"feedback\":\"" + pattern + "\"}", response))
+                break;
+        }
+
+        timed("close", "{\"cmd\":\"close\",\"session\":" + session + "}", response);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    LoadOptions opts;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cout << "Error: " << arg << " flag requires a value.\n";
+            return 1;
+        }
+        if (arg == "-S") opts.socket_path = argv[++i];
+        else if (arg == "-c") opts.clients = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "-g") opts.games = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "-k") opts.k = std::clamp(std::atoi(argv[++i]), 1, 6);
+        else if (arg == "--seed") opts.seed = static_cast<unsigned>(std::atoi(argv[++i]));
+        else {
+            std::cout << "Unknown flag: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    Display display(true);
+    Feedback feedback(display);
+    Dictionary dictionary;
+    dictionary.load_builtin(true);
+    std::vector<std::string> answers = dictionary.answer_words();
+    LatencyLog log;
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t c = 0; c < opts.clients; ++c)
+        threads.emplace_back(run_client, std::cref(opts), c, std::cref(answers), std::ref(feedback), std::ref(log));
+    for (auto &t : threads) t.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    size_t total = 0;
+    for (auto &[cmd, samples] : log.samples) {
+        std::sort(samples.begin(), samples.end());
+        auto pct = [&](double p) { return samples[std::min(samples.size() - 1, static_cast<size_t>(p * samples.size()))]; };
+        total += samples.size();
+        std::cout << cmd << ": " << samples.size() << " requests"
+                  << " | p50 " << pct(0.50) << "ms"
+                  << " | p90 " << pct(0.90) << "ms"
+                  << " | p99 " << pct(0.99) << "ms"
+                  << " | max " << samples.back() << "ms\n";
+    }
+    std::cout << "Total: " << total << " requests in " << seconds << "s ("
+              << (seconds > 0 ? total / seconds : 0.0) << " req/s), "
+              << log.errors.load() << " errors\n";
+
+    return log.errors.load() == 0 ? 0 : 1;
+}
+
+#endif
@@ -0,0 +1,92 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "Mlp.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace {
+    constexpr char kMagic[8] = {'W', 'S', 'M', 'L', 'P', '0', '0', '1'};
+
+    bool read_u32(std::ifstream &file, uint32_t &value) {
+        unsigned char bytes[4];
+        if (!file.read(reinterpret_cast<char *>(bytes), 4)) return false;
+        value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+        return true;
+    }
+
+    bool read_floats(std::ifstream &file, std::vector<float> &values) {
+        return static_cast<bool>(file.read(reinterpret_cast<char *>(values.data()),
+                                           static_cast<std::streamsize>(values.size() * sizeof(float))));
+    }
+}
+
+bool Mlp::load(const std::string &path, std::string &error) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        error = "cannot open " + path;
+        return false;
+    }
+
+    char magic[8];
+    uint32_t count = 0;
+    if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(magic)) != 0 ||
+        !read_u32(file, count) || count == 0 || count > kMaxLayers) {
+        error = path + " is not a model exported by export_model.py";
+        return false;
+    }
+
+    std::vector<Layer> loaded(count);
+    size_t width = 0;
+    for (size_t l = 0; l < count; ++l) {
+        uint32_t inputs, outputs;
+        if (!read_u32(file, inputs) || !read_u32(file, outputs) ||
+            inputs == 0 || outputs == 0 || inputs > kMaxWidth || outputs > kMaxWidth ||
+            (l > 0 && inputs != loaded[l - 1].outputs)) {
+            error = path + ": layer " + std::to_string(l) + " has an invalid shape";
+            return false;
+        }
+
+        Layer &layer = loaded[l];
+        layer.inputs = inputs;
+        layer.outputs = outputs;
+        layer.weights.resize(static_cast<size_t>(inputs) * outputs);
+        layer.bias.resize(outputs);
+        if (!read_floats(file, layer.weights) || !read_floats(file, layer.bias)) {
+            error = path + ": layer " + std::to_string(l) + " is truncated";
+            return false;
+        }
+        width = std::max<size_t>(width, outputs);
+    }
+
+    layers = std::move(loaded);
+    widest = width;
+    return true;
+}
+
+void Mlp::forward(const float *input, float *output, float *scratch) const {
+    const float *x = input;
+    for (size_t l = 0; l < layers.size(); ++l) {
+        const Layer &layer = layers[l];
+        bool last = l + 1 == layers.size();
+        float *y = last ? output : scratch + (l % 2) * widest;
+
+        // y = b + sum of x[i] * W[i], skipping the zeros of sparse inputs
+        std::copy(layer.bias.begin(), layer.bias.end(), y);
+        for (size_t i = 0; i < layer.inputs; ++i) {
+            float xi = x[i];
+            if (xi == 0.0f) continue;
+            const float *w = layer.weights.data() + i * layer.outputs;
+            for (size_t o = 0; o < layer.outputs; ++o)
+                y[o] += xi * w[o];
+        }
+
+        if (!last)
+            for (size_t o = 0; o < layer.outputs; ++o)
+                y[o] = std::max(y[o], 0.0f);
+        x = y;
+    }
+}
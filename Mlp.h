@@ -0,0 +1,50 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_MLP_H
+#define WORDLE_SOLVED_MLP_H
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+// Fully connected network loaded from the flat file written by export_model.py, ReLU between
+// layers and none after the last. The file is little-endian:
+//   "WSMLP001", uint32 layer count, then per layer uint32 inputs, uint32 outputs,
+//   float32 weights[inputs][outputs] (transposed from PyTorch), float32 bias[outputs]
+// Weights are stored input-major so each input scales one contiguous row into the outputs,
+// a loop the compiler vectorises without reordering any sums.
+class Mlp {
+public:
+    static constexpr size_t kMaxLayers = 16;
+    static constexpr size_t kMaxWidth = 4096;
+
+private:
+    struct Layer {
+        size_t inputs;
+        size_t outputs;
+        std::vector<float> weights;
+        std::vector<float> bias;
+    };
+
+    std::vector<Layer> layers;
+    size_t widest = 0;
+
+public:
+    bool load(const std::string &path, std::string &error);
+
+    bool empty() const {return layers.empty();}
+    size_t input_size() const {return layers.empty() ? 0 : layers.front().inputs;}
+    size_t output_size() const {return layers.empty() ? 0 : layers.back().outputs;}
+
+    // Floats of scratch space forward needs, so callers can keep one buffer per thread
+    size_t scratch_size() const {return 2 * widest;}
+
+    // output = network(input), allocation free
+    void forward(const float *input, float *output, float *scratch) const;
+};
+
+
+#endif //WORDLE_SOLVED_MLP_H
@@ -0,0 +1,171 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "MultiBoard.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <thread>
+
+template<size_t L>
+BasicMultiBoard<L>::BasicMultiBoard(Display &display, BasicFeedback<L> &feedback_instance, size_t threads)
+    : display(display),
+      feedback(feedback_instance),
+      n_threads(threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency())) {}
+
+template<size_t L>
+std::vector<std::pair<std::string, double>> BasicMultiBoard<L>::get_entropy(
+    const std::vector<std::string> &guesses,
+    const std::vector<std::vector<std::string>> &boards
+) const {
+    size_t n_guesses = guesses.size();
+    size_t n_boards = std::min(boards.size(), kMaxBoards);
+    std::vector<std::pair<std::string, double>> results(n_guesses);
+    if (n_guesses == 0) return results;
+
+    // Union of the boards' candidates in table order, each with the mask of boards holding it
+    const std::vector<std::string> &words = feedback.get_words();
+    std::vector<uint32_t> masks(words.size(), 0);
+    for (size_t b = 0; b < n_boards; ++b)
+        for (const auto &word : boards[b]) {
+            long idx = feedback.index_of(word);
+            if (idx >= 0) masks[idx] |= uint32_t(1) << b;
+        }
+
+    std::vector<uint32_t> ids, id_masks;
+    for (size_t i = 0; i < masks.size(); ++i) {
+        if (masks[i] == 0) continue;
+        ids.push_back(static_cast<uint32_t>(i));
+        id_masks.push_back(masks[i]);
+    }
+
+    // H = log2(n) - sum(c log2 c) / n for each board of n candidates
+    const std::vector<double> &log_cache = feedback.get_log_cache();
+    std::vector<double> log_totals(n_boards, 0.0);
+    for (size_t b = 0; b < n_boards; ++b)
+        if (!boards[b].empty()) log_totals[b] = std::log2(static_cast<double>(boards[b].size()));
+
+    bool materialised = feedback.is_materialised();
+
+    auto compute_block = [&](size_t g_start, size_t g_end) {
+        std::vector<uint32_t> counts(n_boards * Traits::patterns, 0);
+
+        for (size_t g = g_start; g < g_end; ++g) {
+            const std::string &guess = guesses[g];
+            long guess_idx = feedback.index_of(guess);
+            const Pattern *row = materialised && guess_idx >= 0 ? feedback.row(guess_idx) : nullptr;
+
+            // One pass over the row, each pattern lands in the histogram of every board holding the word
+            for (size_t e = 0; e < ids.size(); ++e) {
+                Pattern fb = row ? row[ids[e]] : feedback.get_feedback(guess, words[ids[e]]);
+                uint32_t mask = id_masks[e];
+                while (mask) {
+                    size_t b = std::bitset<32>((mask & (~mask + 1)) - 1).count();
+                    counts[b * Traits::patterns + fb]++;
+                    mask &= mask - 1;
+                }
+            }
+
+            // Fold into entropies, clearing the histograms for the next guess
+            double entropy = 0.0;
+            for (size_t b = 0; b < n_boards; ++b) {
+                size_t total = boards[b].size();
+                if (total == 0) continue;
+                uint32_t *h = counts.data() + b * Traits::patterns;
+                double sum = 0.0;
+                for (size_t p = 0; p < Traits::patterns; ++p) {
+                    if (h[p] == 0) continue;
+                    double logc = h[p] < log_cache.size() ? log_cache[h[p]] : std::log2(static_cast<double>(h[p]));
+                    sum += h[p] * logc;
+                    h[p] = 0;
+                }
+                entropy += log_totals[b] - sum / total;
+            }
+            results[g] = {guess, entropy};
+        }
+    };
+
+    ThreadPool pool(n_threads);
+    pool.parallel_for(0, n_guesses, ThreadPool::block_size(n_guesses, n_threads), compute_block);
+
+    return results;
+}
+
+template<size_t L>
+std::pair<std::string, double> BasicMultiBoard<L>::get_best_guess(
+    const std::vector<std::string> &guesses,
+    const std::vector<std::vector<std::string>> &boards
+) const {
+    for (const auto &board : boards)
+        if (board.size() == 1) return {board[0], 0.0};
+
+    auto entropies = get_entropy(guesses, boards);
+    if (entropies.empty()) return {"", 0.0};
+
+    // Among equal scores prefer a guess that could solve a board outright
+    auto is_candidate = [&](const std::string &word) {
+        for (const auto &board : boards)
+            if (std::find(board.begin(), board.end(), word) != board.end()) return true;
+        return false;
+    };
+
+    size_t best = 0;
+    for (size_t i = 1; i < entropies.size(); ++i) {
+        double diff = entropies[i].second - entropies[best].second;
+        if (diff > 1e-9 || (diff > -1e-9 && !is_candidate(entropies[best].first) && is_candidate(entropies[i].first)))
+            best = i;
+    }
+    return entropies[best];
+}
+
+template<size_t L>
+int BasicMultiBoard<L>::run(std::vector<std::string> guesses,
+                            const std::vector<std::string> &solutions,
+                            const std::vector<std::string> &answers) {
+    size_t n_boards = answers.size();
+    std::vector<std::vector<std::string>> boards(n_boards, solutions);
+    std::vector<bool> solved(n_boards, false);
+    size_t remaining = n_boards;
+    size_t max_guesses = n_boards + 5;
+    size_t guess_count = 0;
+
+    while (remaining > 0 && guess_count < max_guesses) {
+        // Score against the unsolved boards only
+        std::vector<std::vector<std::string>> open;
+        for (size_t b = 0; b < n_boards; ++b)
+            if (!solved[b]) open.push_back(boards[b]);
+
+        auto [best_guess, best_entropy] = get_best_guess(guesses, open);
+        if (best_guess.empty()) break;
+        guesses.erase(std::remove(guesses.begin(), guesses.end(), best_guess), guesses.end());
+        guess_count++;
+
+        display.showOutput("Next Guess: " + display.word(best_guess) + " | Summed Entropy over " +
+                           std::to_string(remaining) + " boards: " + std::to_string(best_entropy));
+
+        for (size_t b = 0; b < n_boards; ++b) {
+            if (solved[b]) continue;
+            auto fb = feedback.get_feedback(best_guess, answers[b]);
+            if (fb == Traits::solved) {
+                solved[b] = true;
+                remaining--;
+                display.showOutput("Board " + std::to_string(b + 1) + " solved in " +
+                                   std::to_string(guess_count) + " guesses: " + display.word(answers[b]));
+                continue;
+            }
+            boards[b] = feedback.get_new_solutions(boards[b], best_guess, fb);
+        }
+    }
+
+    if (remaining > 0) {
+        display.showOutput("No solution found for " + std::to_string(remaining) + " of " +
+                           std::to_string(n_boards) + " boards.\n");
+        return -1;
+    }
+    display.showOutput("All " + std::to_string(n_boards) + " boards solved in " + std::to_string(guess_count) + " guesses");
+    return static_cast<int>(guess_count);
+}
+
+WORDLE_SOLVED_INSTANTIATE(BasicMultiBoard)
@@ -0,0 +1,62 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_MULTIBOARD_H
+#define WORDLE_SOLVED_MULTIBOARD_H
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Display.h"
+#include "Feedback.h"
+#include "WordTraits.h"
+
+
+// Solver for several boards sharing every guess, as in Dordle, Quordle and Octordle.
+// A guess is scored by the summed entropy of its partitions of each board's candidates,
+// which for independent boards is also the entropy of the joint partition. Every board's
+// histogram is built in one sweep over the guess's feedback row, so B boards read the
+// table once rather than B times.
+template<size_t L>
+class BasicMultiBoard {
+public:
+    using Traits = WordTraits<L>;
+    using Pattern = typename Traits::Pattern;
+
+    // Boards are tracked as bits of a word's board mask
+    static constexpr size_t kMaxBoards = 32;
+
+private:
+    Display &display;
+    BasicFeedback<L> &feedback;
+    size_t n_threads;
+
+public:
+    BasicMultiBoard(Display &display, BasicFeedback<L> &feedback_instance, size_t threads = 0);
+
+    // Summed single-step entropy of each guess over the candidates of every board
+    std::vector<std::pair<std::string, double>> get_entropy(
+        const std::vector<std::string> &guesses,
+        const std::vector<std::vector<std::string>> &boards
+    ) const;
+
+    // Best guess for the unsolved boards, a board down to one candidate is guessed first
+    std::pair<std::string, double> get_best_guess(
+        const std::vector<std::string> &guesses,
+        const std::vector<std::vector<std::string>> &boards
+    ) const;
+
+    // Play one board per answer, returns the guesses used or -1 if a board is left
+    // unsolved after the usual boards + 5 guesses
+    int run(std::vector<std::string> guesses,
+            const std::vector<std::string> &solutions,
+            const std::vector<std::string> &answers);
+};
+
+using MultiBoard = BasicMultiBoard<5>;
+
+
+#endif //WORDLE_SOLVED_MULTIBOARD_H
@@ -0,0 +1,120 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_SCORING_H
+#define WORDLE_SOLVED_SCORING_H
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+// Runtime choice of policy, dispatched once per search
+enum class Metric {
+    Entropy,
+    Remaining,
+    WorstCase,
+    SolveProbability,
+    // Expected guesses to solve, leaves valued by a learned model, see BasicEntropy::set_model
+    Model
+};
+
+// Scoring policies over a guess's pattern histogram, compiled into the entropy kernels.
+// score() rates a guess from its histogram alone, counts and total being candidate
+// weights with unit the weight of one average candidate. Looking further, a guess is rated by
+// first() of that score folded with the best score of each unsolved bucket.
+
+// Expected information in bits, higher is better
+struct EntropyScore {
+    static constexpr Metric metric = Metric::Entropy;
+    static constexpr bool maximise = true;
+
+    template<class Counts>
+    static double score(const Counts &counts, size_t total, size_t, size_t, const std::vector<double> &log_cache) {
+        double entropy = 0.0;
+        for (auto count : counts) {
+            if (count == 0) continue;
+            double p = static_cast<double>(count) / total;
+            double logp = (count < log_cache.size()) ? log_cache[count] - std::log2(total) : std::log2(p);
+            entropy -= p * logp;
+        }
+        return entropy;
+    }
+    static double first(double score, double) {return score;}
+    static double fold(double acc, double weight, double child) {return acc + weight * child;}
+};
+
+// Expected number of candidates left after the guess, lower is better
+struct RemainingScore {
+    static constexpr Metric metric = Metric::Remaining;
+    static constexpr bool maximise = false;
+
+    template<class Counts>
+    static double score(const Counts &counts, size_t total, size_t solved, size_t unit, const std::vector<double> &) {
+        double sum = 0.0;
+        for (size_t p = 0; p < counts.size(); ++p)
+            if (p != solved) sum += static_cast<double>(counts[p]) * counts[p];
+        return sum / total / unit;
+    }
+    static double first(double, double) {return 0.0;}
+    static double fold(double acc, double weight, double child) {return acc + weight * child;}
+};
+
+// Largest bucket left after the guess, lower is better
+struct WorstCaseScore {
+    static constexpr Metric metric = Metric::WorstCase;
+    static constexpr bool maximise = false;
+
+    template<class Counts>
+    static double score(const Counts &counts, size_t, size_t solved, size_t unit, const std::vector<double> &) {
+        size_t largest = 0;
+        for (size_t p = 0; p < counts.size(); ++p)
+            if (p != solved) largest = std::max<size_t>(largest, counts[p]);
+        return static_cast<double>(largest) / unit;
+    }
+    static double first(double, double) {return 0.0;}
+    static double fold(double acc, double, double child) {return std::max(acc, child);}
+};
+
+// Probability of solving within k + 1 guesses for a k step search, higher is better.
+// One step: each distinct pattern leaves a bucket whose next guess is right 1 / size of
+// the time, which sums to buckets / total. Weighted, bucket sizes are taken in units.
+struct SolveProbabilityScore {
+    static constexpr Metric metric = Metric::SolveProbability;
+    static constexpr bool maximise = true;
+
+    template<class Counts>
+    static double score(const Counts &counts, size_t total, size_t, size_t unit, const std::vector<double> &) {
+        size_t buckets = 0;
+        for (auto count : counts) buckets += count > 0;
+        return std::min(1.0, static_cast<double>(buckets) * unit / total);
+    }
+    static double first(double, double solved_weight) {return solved_weight;}
+    static double fold(double acc, double weight, double child) {return acc + weight * child;}
+};
+
+inline bool parse_metric(const std::string &name, Metric &metric) {
+    if (name == "entropy") metric = Metric::Entropy;
+    else if (name == "remaining") metric = Metric::Remaining;
+    else if (name == "worst") metric = Metric::WorstCase;
+    else if (name == "probability") metric = Metric::SolveProbability;
+    else return false;
+    return true;
+}
+
+// Label for output, e.g. "Expected Entropy"
+inline std::string metric_label(Metric metric) {
+    switch (metric) {
+        case Metric::Remaining: return "Expected Remaining";
+        case Metric::WorstCase: return "Worst Case Remaining";
+        case Metric::SolveProbability: return "Solve Probability";
+        case Metric::Model: return "Expected Guesses";
+        default: return "Expected Entropy";
+    }
+}
+
+
+#endif //WORDLE_SOLVED_SCORING_H
@@ -0,0 +1,47 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_STATEFEATURES_H
+#define WORDLE_SOLVED_STATEFEATURES_H
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include "Alphabet.h"
+#include "WordTraits.h"
+
+
+// Fixed size description of a candidate set, the input of learned value models:
+//   [p * 26 + c]   fraction of candidates with letter c at position p
+//   [L * 26 + c]   fraction of candidates containing letter c
+//   [L * 26 + 26]  log2 of the candidate count over 16
+// Only the first 26 symbols are described, later symbols of larger alphabets are dropped.
+// Features are summed one candidate at a time, so a set can be described while it is split.
+template<size_t L>
+struct BasicStateFeatures {
+    static constexpr size_t kLetters = 26;
+    static constexpr size_t kSize = L * kLetters + kLetters + 1;
+
+    static void add(const std::string &word, float *sums) {
+        bool seen[kLetters] = {};
+        for (size_t p = 0; p < L; ++p) {
+            size_t c = Alphabet::index(word[p]);
+            if (c >= kLetters) continue;
+            sums[p * kLetters + c] += 1.0f;
+            if (!seen[c]) sums[L * kLetters + c] += 1.0f;
+            seen[c] = true;
+        }
+    }
+
+    // Turn the sums over count candidates into features
+    static void finish(float *sums, size_t count) {
+        float scale = 1.0f / static_cast<float>(std::max<size_t>(count, 1));
+        for (size_t i = 0; i < kSize - 1; ++i) sums[i] *= scale;
+        sums[kSize - 1] = static_cast<float>(std::log2(static_cast<double>(std::max<size_t>(count, 1))) / 16.0);
+    }
+};
+
+
+#endif //WORDLE_SOLVED_STATEFEATURES_H
@@ -0,0 +1,305 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "Sweep.h"
+#include "AutoMode.h"
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    // Message header for both directions of the pipe
+    struct ShardHeader {
+        uint32_t shard;
+        uint32_t count;
+    };
+
+    struct Shard {
+        std::vector<SweepTypes::Job> jobs;
+        size_t attempts = 0;
+        bool done = false;
+    };
+
+    struct Worker {
+        int pid = -1;
+        int to_fd = -1;
+        int from_fd = -1;
+        long shard = -1;
+    };
+
+#ifndef _WIN32
+    bool write_all(int fd, const void *data, size_t size) {
+        const char *p = static_cast<const char *>(data);
+        while (size > 0) {
+            ssize_t n = write(fd, p, size);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return false;
+            p += n;
+            size -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    bool read_all(int fd, void *data, size_t size) {
+        char *p = static_cast<char *>(data);
+        while (size > 0) {
+            ssize_t n = read(fd, p, size);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return false;
+            p += n;
+            size -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+#endif
+}
+
+template<size_t L>
+BasicSweep<L>::BasicSweep(Display &display, BasicFeedback<L> &feedback_instance)
+    : display(display),
+      feedback(feedback_instance) {}
+
+#ifdef _WIN32
+
+template<size_t L>
+void BasicSweep<L>::worker_loop(int, int,
+                                const std::vector<std::string> &,
+                                const std::vector<std::string> &,
+                                const Options &) const {}
+
+template<size_t L>
+std::vector<SweepTypes::Result> BasicSweep<L>::run(const std::vector<std::string> &,
+                                                   const std::vector<std::string> &,
+                                                   const Options &) const {
+    display.showOutput("Error: sweep mode requires fork() and is not supported on Windows.\n");
+    return {};
+}
+
+#else
+
+template<size_t L>
+void BasicSweep<L>::worker_loop(int in_fd, int out_fd,
+                                const std::vector<std::string> &guesses,
+                                const std::vector<std::string> &answers,
+                                const Options &opts) const {
+    // Workers split the cores between them rather than each starting a pool per core
+    size_t threads = std::max<size_t>(1, std::thread::hardware_concurrency() / std::max<size_t>(opts.workers, 1));
+    BasicAutoMode<L> automode(display, feedback, opts.hard_mode, opts.metric, threads);
+    automode.set_prefilter(opts.prefilter, opts.prefilter_safe);
+    automode.set_model(opts.model);
+    automode.set_histograms(histograms);
+
+    ShardHeader header{};
+    std::vector<Job> jobs;
+    std::vector<Result> results;
+
+    while (read_all(in_fd, &header, sizeof(header))) {
+        jobs.resize(header.count);
+        if (!read_all(in_fd, jobs.data(), jobs.size() * sizeof(Job))) break;
+
+        results.clear();
+        for (const Job &job : jobs) {
+            int guess_count = automode.run(guesses, answers, static_cast<int>(job.k), answers[job.answer]);
+            results.push_back({job.answer, job.k, guess_count});
+        }
+
+        if (!write_all(out_fd, &header, sizeof(header)) ||
+            !write_all(out_fd, results.data(), results.size() * sizeof(Result)))
+            break;
+    }
+}
+
+template<size_t L>
+std::vector<SweepTypes::Result> BasicSweep<L>::run(const std::vector<std::string> &guesses,
+                                                   const std::vector<std::string> &answers,
+                                                   const Options &opts) const {
+    // Split every (k, answer) pair into shards
+    std::vector<Shard> shards;
+    size_t shard_size = std::max<size_t>(opts.shard_size, 1);
+    for (int k : opts.ks) {
+        for (size_t a = 0; a < answers.size(); ++a) {
+            if (shards.empty() || shards.back().jobs.size() >= shard_size)
+                shards.emplace_back();
+            shards.back().jobs.push_back({static_cast<uint32_t>(a), static_cast<uint32_t>(k)});
+        }
+    }
+
+    std::vector<Result> results;
+    results.reserve(opts.ks.size() * answers.size());
+    if (shards.empty()) return results;
+
+    // Writes to a crashed worker must fail with EPIPE rather than kill the coordinator
+    signal(SIGPIPE, SIG_IGN);
+
+    std::deque<size_t> pending;
+    for (size_t i = 0; i < shards.size(); ++i)
+        pending.push_back(i);
+
+    std::vector<Worker> workers(std::min(std::max<size_t>(opts.workers, 1), shards.size()));
+
+    // Fork a worker, the feedback cache is shared copy-on-write
+    auto spawn = [&](Worker &w) -> bool {
+        int to_child[2], from_child[2];
+        if (pipe(to_child) != 0) return false;
+        if (pipe(from_child) != 0) {
+            close(to_child[0]);
+            close(to_child[1]);
+            return false;
+        }
+
+        pid_t pid = fork();
+        if (pid < 0) {
+            close(to_child[0]); close(to_child[1]);
+            close(from_child[0]); close(from_child[1]);
+            return false;
+        }
+
+        if (pid == 0) {
+            // Drop the coordinator's pipe ends, including those of sibling workers
+            for (const Worker &other : workers) {
+                if (other.to_fd >= 0) close(other.to_fd);
+                if (other.from_fd >= 0) close(other.from_fd);
+            }
+            close(to_child[1]);
+            close(from_child[0]);
+            display.setSilent(true);
+            worker_loop(to_child[0], from_child[1], guesses, answers, opts);
+            _exit(0);
+        }
+
+        close(to_child[0]);
+        close(from_child[1]);
+        w.pid = pid;
+        w.to_fd = to_child[1];
+        w.from_fd = from_child[0];
+        w.shard = -1;
+        return true;
+    };
+
+    auto reap = [&](Worker &w) {
+        if (w.to_fd >= 0) close(w.to_fd);
+        if (w.from_fd >= 0) close(w.from_fd);
+        if (w.pid > 0) waitpid(w.pid, nullptr, 0);
+        w = Worker{};
+    };
+
+    // Put a shard back in the queue, or give up on it after too many crashes
+    size_t completed = 0;
+    auto retry = [&](size_t shard_id) {
+        Shard &shard = shards[shard_id];
+        if (++shard.attempts <= opts.max_retries) {
+            pending.push_front(shard_id);
+            return;
+        }
+        display.showOutput("Warning: shard " + std::to_string(shard_id) + " failed after " +
+                           std::to_string(shard.attempts) + " attempts.");
+        for (const Job &job : shard.jobs)
+            results.push_back({job.answer, job.k, -1});
+        shard.done = true;
+        completed++;
+    };
+
+    auto dispatch = [&](Worker &w) {
+        while (!pending.empty()) {
+            size_t shard_id = pending.front();
+            pending.pop_front();
+
+            const Shard &shard = shards[shard_id];
+            ShardHeader header{static_cast<uint32_t>(shard_id), static_cast<uint32_t>(shard.jobs.size())};
+            if (write_all(w.to_fd, &header, sizeof(header)) &&
+                write_all(w.to_fd, shard.jobs.data(), shard.jobs.size() * sizeof(Job))) {
+                w.shard = static_cast<long>(shard_id);
+                return;
+            }
+
+            // Worker died before accepting the shard
+            reap(w);
+            pending.push_front(shard_id);
+            if (!spawn(w)) return;
+        }
+    };
+
+    for (Worker &w : workers) {
+        if (!spawn(w)) {
+            display.showOutput("Error: failed to fork sweep worker.\n");
+            for (Worker &other : workers) reap(other);
+            return {};
+        }
+    }
+
+    size_t total_jobs = opts.ks.size() * answers.size();
+    std::vector<pollfd> fds;
+    std::vector<Result> buffer;
+
+    while (completed < shards.size()) {
+        for (Worker &w : workers)
+            if (w.pid > 0 && w.shard < 0) dispatch(w);
+
+        fds.clear();
+        for (const Worker &w : workers)
+            if (w.pid > 0 && w.shard >= 0) fds.push_back({w.from_fd, POLLIN, 0});
+
+        if (fds.empty()) {
+            // Every worker failed to respawn
+            display.showOutput("Error: no sweep workers left.\n");
+            break;
+        }
+
+        if (poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+
+        for (const pollfd &pfd : fds) {
+            if (pfd.revents == 0) continue;
+
+            Worker *w = nullptr;
+            for (Worker &candidate : workers)
+                if (candidate.from_fd == pfd.fd) w = &candidate;
+            if (w == nullptr) continue;
+
+            size_t shard_id = static_cast<size_t>(w->shard);
+            ShardHeader header{};
+            bool ok = read_all(w->from_fd, &header, sizeof(header)) && header.shard == shard_id;
+            if (ok) {
+                buffer.resize(header.count);
+                ok = read_all(w->from_fd, buffer.data(), buffer.size() * sizeof(Result));
+            }
+
+            if (!ok) {
+                // Worker crashed mid-shard: replace it and retry the shard
+                reap(*w);
+                retry(shard_id);
+                if (!spawn(*w))
+                    display.showOutput("Warning: failed to respawn sweep worker.");
+                continue;
+            }
+
+            results.insert(results.end(), buffer.begin(), buffer.end());
+            shards[shard_id].done = true;
+            w->shard = -1;
+            completed++;
+
+            std::lock_guard<std::mutex> lock(display.getMutex());
+            display.showProgress("Sweeping Answers", results.size(), total_jobs);
+        }
+    }
+
+    for (Worker &w : workers) reap(w);
+    return results;
+}
+
+#endif
+
+WORDLE_SOLVED_INSTANTIATE(BasicSweep)
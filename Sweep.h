@@ -0,0 +1,75 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_SWEEP_H
+#define WORDLE_SOLVED_SWEEP_H
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Display.h"
+#include "Feedback.h"
+#include "HistogramCache.h"
+#include "Mlp.h"
+#include "Scoring.h"
+
+
+// Shard and result records, the same for every word length
+struct SweepTypes {
+    // Single game to solve: answer index and lookahead depth. Shards are whole games, the
+    // lookahead of one game is not split across workers.
+    struct Job {
+        uint32_t answer;
+        uint32_t k;
+    };
+
+    struct Result {
+        uint32_t answer;
+        uint32_t k;
+        int32_t guesses;
+    };
+
+    struct Options {
+        size_t workers = 1;
+        size_t shard_size = 16;
+        size_t max_retries = 2;
+        bool hard_mode = false;
+        Metric metric = Metric::Entropy;
+        size_t prefilter = 0;
+        bool prefilter_safe = false;
+        const Mlp *model = nullptr;
+        std::vector<int> ks;
+    };
+};
+
+
+template<size_t L>
+class BasicSweep : public SweepTypes {
+private:
+    Display &display;
+    BasicFeedback<L> &feedback;
+    const BasicHistogramCache<L> *histograms = nullptr;
+
+    // Worker process loop: read shards from in_fd, write results to out_fd
+    void worker_loop(int in_fd, int out_fd,
+                     const std::vector<std::string> &guesses,
+                     const std::vector<std::string> &answers,
+                     const Options &opts) const;
+
+public:
+    BasicSweep(Display &display, BasicFeedback<L> &feedback_instance);
+
+    // Turn-1 histograms shared by every worker, see BasicEntropy::set_histograms
+    void set_histograms(const BasicHistogramCache<L> *turn_one) {histograms = turn_one;}
+
+    // Fork workers sharing the feedback cache and solve every answer for every k
+    std::vector<Result> run(const std::vector<std::string> &guesses,
+                            const std::vector<std::string> &answers,
+                            const Options &opts) const;
+};
+
+using Sweep = BasicSweep<5>;
+
+
+#endif //WORDLE_SOLVED_SWEEP_H
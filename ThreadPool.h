@@ -5,6 +5,7 @@
 #ifndef WORDLE_SOLVED_THREADPOOL_H
 #define WORDLE_SOLVED_THREADPOOL_H
 #pragma once
+#include <algorithm>
 #include <vector>
 #include <thread>
 #include <queue>
@@ -68,6 +69,23 @@ public:
         cv.notify_one();
         return res;
     }
+
+    // Blocks giving each of threads workers about four blocks of n items, for load balance
+    static size_t block_size(size_t n, size_t threads) {
+        return std::max<size_t>(1, (n + threads * 4 - 1) / (threads * 4));
+    }
+
+    // Run body(start, end) over [begin, end) in blocks of block items and wait for every block
+    template<typename F>
+    void parallel_for(size_t begin, size_t end, size_t block, F &&body) {
+        std::vector<std::future<void>> futures;
+        if (end > begin) futures.reserve((end - begin + block - 1) / block);
+        for (size_t start = begin; start < end; start += block) {
+            size_t block_end = std::min(start + block, end);
+            futures.push_back(enqueue([&body, start, block_end]() { body(start, block_end); }));
+        }
+        for (auto &f : futures) f.get();
+    }
 };
 
 
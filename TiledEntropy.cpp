@@ -0,0 +1,96 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "TiledEntropy.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+
+template<size_t L, class Rule>
+BasicTiledEntropy<L, Rule>::BasicTiledEntropy(const BasicFeedback<L, Rule> &feedback_instance, size_t memory_budget, size_t threads)
+    : feedback(feedback_instance),
+      memory_budget(memory_budget),
+      n_threads(threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency())) {}
+
+template<size_t L, class Rule>
+template<class Score>
+std::vector<std::pair<std::string, double>> BasicTiledEntropy<L, Rule>::get_scores(
+    const std::vector<std::string> &guesses,
+    const std::vector<std::string> &solutions,
+    std::atomic<size_t> &progress
+) const {
+    size_t n_guesses = guesses.size();
+    size_t n_solutions = solutions.size();
+    std::vector<std::pair<std::string, double>> results(n_guesses);
+    if (n_guesses == 0) return results;
+
+    // Each running task holds one tile and the histograms of its guess block
+    using Pattern = typename Rule::Pattern;
+    using Histogram = std::array<uint64_t, Rule::patterns>;
+    size_t tile_candidates = std::max<size_t>(1, std::min(n_solutions, kMaxTileCandidates));
+    size_t per_task = memory_budget / n_threads;
+    size_t guess_block = per_task / (sizeof(Histogram) + tile_candidates * sizeof(Pattern));
+    guess_block = std::clamp<size_t>(guess_block, 1, (n_guesses + n_threads - 1) / n_threads);
+
+    // Counts are folded per tile, so entropy takes its logarithms directly
+    const std::vector<double> no_log_cache;
+    std::vector<uint32_t> weights = feedback.get_weights(solutions);
+    size_t total = 0;
+    for (uint32_t w : weights) total += w;
+
+    auto compute_block = [&](size_t g_start, size_t g_end) {
+        size_t rows = g_end - g_start;
+        std::vector<Pattern> tile(rows * tile_candidates);
+        std::vector<Histogram> counts(rows, Histogram{});
+
+        for (size_t c_start = 0; c_start < n_solutions; c_start += tile_candidates) {
+            size_t c_end = std::min(c_start + tile_candidates, n_solutions);
+            size_t cols = c_end - c_start;
+
+            // Fill the tile, then fold it into the histograms while it is still in cache
+            for (size_t g = 0; g < rows; ++g) {
+                Pattern *out = tile.data() + g * tile_candidates;
+                for (size_t c = 0; c < cols; ++c)
+                    out[c] = feedback.get_feedback(guesses[g_start + g], solutions[c_start + c]);
+            }
+            for (size_t g = 0; g < rows; ++g) {
+                const Pattern *in = tile.data() + g * tile_candidates;
+                const uint32_t *w = weights.data() + c_start;
+                Histogram &h = counts[g];
+                for (size_t c = 0; c < cols; ++c)
+                    h[in[c]] += w[c];
+            }
+        }
+
+        for (size_t g = 0; g < rows; ++g)
+            results[g_start + g] = {guesses[g_start + g], Score::score(counts[g], total, Rule::solved, feedback.weight_unit(), no_log_cache)};
+        progress.fetch_add(rows, std::memory_order_relaxed);
+    };
+
+    ThreadPool pool(n_threads);
+    pool.parallel_for(0, n_guesses, guess_block, compute_block);
+
+    return results;
+}
+
+template<size_t L, class Rule>
+std::vector<std::pair<std::string, double>> BasicTiledEntropy<L, Rule>::get_entropy(
+    const std::vector<std::string> &guesses,
+    const std::vector<std::string> &solutions,
+    std::atomic<size_t> &progress,
+    Metric metric
+) const {
+    switch (metric) {
+        case Metric::Remaining: return get_scores<RemainingScore>(guesses, solutions, progress);
+        case Metric::WorstCase: return get_scores<WorstCaseScore>(guesses, solutions, progress);
+        case Metric::SolveProbability: return get_scores<SolveProbabilityScore>(guesses, solutions, progress);
+        default: return get_scores<EntropyScore>(guesses, solutions, progress);
+    }
+}
+
+WORDLE_SOLVED_INSTANTIATE(BasicTiledEntropy)
+WORDLE_SOLVED_INSTANTIATE_RULES(BasicTiledEntropy)
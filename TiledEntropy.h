@@ -0,0 +1,53 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_TILEDENTROPY_H
+#define WORDLE_SOLVED_TILEDENTROPY_H
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Feedback.h"
+#include "Scoring.h"
+#include "WordTraits.h"
+
+
+// Single-step scores for word lists too large to materialise the n x n feedback table.
+// Feedback is computed in guess x candidate tiles and folded straight into per-guess
+// histograms, so working memory stays within the budget and the table is never stored.
+template<size_t L, class Rule = WordleRule<L>>
+class BasicTiledEntropy {
+public:
+    static constexpr size_t kDefaultMemoryBudget = size_t(256) << 20;
+    static constexpr size_t kMaxTileCandidates = 4096;
+
+private:
+    const BasicFeedback<L, Rule> &feedback;
+    size_t memory_budget;
+    size_t n_threads;
+
+    template<class Score>
+    std::vector<std::pair<std::string, double>> get_scores(
+        const std::vector<std::string> &guesses,
+        const std::vector<std::string> &solutions,
+        std::atomic<size_t> &progress
+    ) const;
+
+public:
+    BasicTiledEntropy(const BasicFeedback<L, Rule> &feedback_instance, size_t memory_budget = kDefaultMemoryBudget, size_t threads = 0);
+
+    std::vector<std::pair<std::string, double>> get_entropy(
+        const std::vector<std::string> &guesses,
+        const std::vector<std::string> &solutions,
+        std::atomic<size_t> &progress,
+        Metric metric = Metric::Entropy
+    ) const;
+};
+
+using TiledEntropy = BasicTiledEntropy<5>;
+
+
+#endif //WORDLE_SOLVED_TILEDENTROPY_H
@@ -0,0 +1,94 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "WordQuery.h"
+#include <algorithm>
+
+WordQuery::WordQuery(size_t word_length)
+    : length(word_length),
+      pattern(word_length, Alphabet::kWildcard) {}
+
+bool WordQuery::encode(const Alphabet &alphabet, const std::string &text, std::string &out, std::string *error) {
+    if (!alphabet.encode_pattern(text, out, error)) return false;
+    if (out.size() != length) {
+        if (error) *error = "\"" + text + "\" must have " + std::to_string(length) + " letters";
+        return false;
+    }
+    return true;
+}
+
+bool WordQuery::set_pattern(const Alphabet &alphabet, const std::string &text, std::string *error) {
+    std::string encoded;
+    if (!encode(alphabet, text, encoded, error)) return false;
+    if (encoded.find(Alphabet::kUnknown) != std::string::npos) unsatisfiable = true;
+    pattern = encoded;
+    return true;
+}
+
+bool WordQuery::add_contains(const Alphabet &alphabet, const std::string &letters, std::string *error) {
+    std::string encoded;
+    if (!alphabet.encode_pattern(letters, encoded, error)) return false;
+
+    uint8_t counts[Alphabet::kMaxSymbols] = {0};
+    for (char symbol : encoded) {
+        if (symbol == Alphabet::kWildcard) continue;
+        if (symbol == Alphabet::kUnknown) {
+            unsatisfiable = true;
+            continue;
+        }
+        size_t id = Alphabet::index(symbol);
+        counts[id]++;
+        minimum[id] = std::max(minimum[id], counts[id]);
+    }
+    return true;
+}
+
+bool WordQuery::add_excludes(const Alphabet &alphabet, const std::string &letters, std::string *error) {
+    std::string encoded;
+    if (!alphabet.encode_pattern(letters, encoded, error)) return false;
+
+    // Letters outside the alphabet are excluded already
+    for (char symbol : encoded)
+        if (symbol != Alphabet::kWildcard && symbol != Alphabet::kUnknown)
+            excluded[Alphabet::index(symbol)] = true;
+    return true;
+}
+
+bool WordQuery::add_not_at(const Alphabet &alphabet, const std::string &patterns, std::string *error) {
+    size_t start = 0;
+    while (start <= patterns.size()) {
+        size_t end = patterns.find(',', start);
+        if (end == std::string::npos) end = patterns.size();
+
+        std::string encoded;
+        if (!encode(alphabet, patterns.substr(start, end - start), encoded, error)) return false;
+        not_at.push_back(encoded);
+        start = end + 1;
+    }
+    return true;
+}
+
+LetterIndex::Bits WordQuery::match(const LetterIndex &index) const {
+    LetterIndex::Bits bits = index.all();
+    if (unsatisfiable || index.word_length() != length) {
+        std::fill(bits.begin(), bits.end(), 0);
+        return bits;
+    }
+
+    for (size_t pos = 0; pos < length; ++pos)
+        if (pattern[pos] != Alphabet::kWildcard)
+            index.require_at(bits, pos, pattern[pos]);
+
+    for (const std::string &ruled_out : not_at)
+        for (size_t pos = 0; pos < length; ++pos)
+            if (ruled_out[pos] != Alphabet::kWildcard && ruled_out[pos] != Alphabet::kUnknown)
+                index.exclude_at(bits, pos, ruled_out[pos]);
+
+    for (size_t id = 0; id < Alphabet::kMaxSymbols; ++id) {
+        char symbol = static_cast<char>(Alphabet::kFirstSymbol + id);
+        if (minimum[id] > 0) index.require_count(bits, symbol, minimum[id]);
+        if (excluded[id]) index.limit_count(bits, symbol, 0);
+    }
+    return bits;
+}
@@ -0,0 +1,58 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_WORDQUERY_H
+#define WORDLE_SOLVED_WORDQUERY_H
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Alphabet.h"
+#include "LetterIndex.h"
+
+
+// Constraints on the letters of a word, e.g. "matches a?e??, contains r, excludes s and t
+// and r is not in position 2". Parsed from UTF-8 text and answered over a LetterIndex
+// with one bitset AND per constraint.
+class WordQuery {
+private:
+    size_t length;
+
+    // Encoded pattern, a symbol or kWildcard per position
+    std::string pattern;
+
+    // Minimum copies of each symbol, repeated letters in "contains" ask for more than one
+    uint8_t minimum[Alphabet::kMaxSymbols] = {0};
+    bool excluded[Alphabet::kMaxSymbols] = {false};
+
+    // Encoded patterns whose letters are ruled out at their positions
+    std::vector<std::string> not_at;
+
+    // Asks for a letter outside the alphabet, so nothing matches
+    bool unsatisfiable = false;
+
+    bool encode(const Alphabet &alphabet, const std::string &text, std::string &out, std::string *error);
+
+public:
+    explicit WordQuery(size_t word_length);
+
+    // Letters and '?' wildcards, one per position
+    bool set_pattern(const Alphabet &alphabet, const std::string &text, std::string *error = nullptr);
+
+    // Letters that must appear, "ee" requires two copies of e
+    bool add_contains(const Alphabet &alphabet, const std::string &letters, std::string *error = nullptr);
+
+    // Letters that must not appear anywhere
+    bool add_excludes(const Alphabet &alphabet, const std::string &letters, std::string *error = nullptr);
+
+    // Comma separated patterns whose letters must not be at their positions, "?r???" rules out r second
+    bool add_not_at(const Alphabet &alphabet, const std::string &patterns, std::string *error = nullptr);
+
+    // Words of the index matching every constraint
+    LetterIndex::Bits match(const LetterIndex &index) const;
+};
+
+
+#endif //WORDLE_SOLVED_WORDQUERY_H
@@ -0,0 +1,52 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#ifndef WORDLE_SOLVED_WORDTRAITS_H
+#define WORDLE_SOLVED_WORDTRAITS_H
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+constexpr size_t kMinWordLength = 4;
+constexpr size_t kMaxWordLength = 8;
+
+constexpr size_t pow3(size_t n) {return n == 0 ? 1 : 3 * pow3(n - 1);}
+
+// Compile-time sizes for words of L letters. Patterns are Base 3 with one digit per letter,
+// stored in a byte up to 5 letters (243 patterns) and 16 bits up to 8 (6561 patterns).
+template<size_t L>
+struct WordTraits {
+    static_assert(L >= kMinWordLength && L <= kMaxWordLength, "unsupported word length");
+
+    static constexpr size_t length = L;
+    static constexpr size_t patterns = pow3(L);
+    using Pattern = std::conditional_t<(patterns <= 256), uint8_t, uint16_t>;
+
+    // All Green
+    static constexpr Pattern solved = static_cast<Pattern>(patterns - 1);
+};
+
+// "GYB" string of a Base 3 pattern of length letters
+inline std::string pattern_string(uint32_t pattern, size_t length) {
+    std::string out(length, 'B');
+    for (size_t i = length; i-- > 0;) {
+        uint32_t code = pattern % 3;
+        pattern /= 3;
+        out[i] = code == 2 ? 'G' : code == 1 ? 'Y' : 'B';
+    }
+    return out;
+}
+
+// Explicitly instantiate a class template for every supported word length
+#define WORDLE_SOLVED_INSTANTIATE(T) \
+    template class T<4>;             \
+    template class T<5>;             \
+    template class T<6>;             \
+    template class T<7>;             \
+    template class T<8>;
+
+
+#endif //WORDLE_SOLVED_WORDTRAITS_H
@@ -0,0 +1,110 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+# Value model for the native solver: an MLP from the state features of a candidate set
+# (StateFeatures.h) to the expected number of guesses still needed to solve it.
+# Trains it on states written by `wordle_solved --generate N --out states.npy`, and
+# exports a trained state dict to the flat binary read by Mlp.cpp, selected with --model.
+#
+#   python export_model.py --train states.npy value.pt
+#   python export_model.py value.pt value.bin
+
+import argparse
+import struct
+
+MAGIC = b"WSMLP001"
+LETTERS = 26
+
+
+def feature_size(length):
+    return length * LETTERS + LETTERS + 1
+
+
+def build_model(length, hidden=(256, 128)):
+    import torch.nn as nn
+
+    layers, width = [], feature_size(length)
+    for h in hidden:
+        layers += [nn.Linear(width, h), nn.ReLU()]
+        width = h
+    layers.append(nn.Linear(width, 1))
+    return nn.Sequential(*layers)
+
+
+def linear_layers(state_dict):
+    """(weight, bias) pairs of the Linear layers in order, rejecting anything else"""
+    layers, pending = [], None
+    for name, tensor in state_dict.items():
+        if name.endswith(".weight") and tensor.dim() == 2 and pending is None:
+            pending = tensor
+        elif name.endswith(".bias") and tensor.dim() == 1 and pending is not None and tensor.shape[0] == pending.shape[0]:
+            layers.append((pending, tensor))
+            pending = None
+        else:
+            raise ValueError(f"{name} is not part of a Linear layer, only MLPs can be exported")
+    if pending is not None or not layers:
+        raise ValueError("state dict holds no complete Linear layers")
+    return layers
+
+
+def export(state_dict, path):
+    layers = linear_layers(state_dict)
+    with open(path, "wb") as f:
+        f.write(MAGIC)
+        f.write(struct.pack("<I", len(layers)))
+        for weight, bias in layers:
+            outputs, inputs = weight.shape
+            f.write(struct.pack("<II", inputs, outputs))
+            # Input-major, so each input scales one contiguous row of outputs
+            f.write(weight.detach().float().t().contiguous().cpu().numpy().astype("<f4").tobytes())
+            f.write(bias.detach().float().contiguous().cpu().numpy().astype("<f4").tobytes())
+
+
+def train(data_path, save_path, epochs, batch_size):
+    """Fit the value of every state in a --generate file, memory mapped so it can exceed RAM"""
+    import numpy as np
+    import torch
+    import torch.nn as nn
+
+    data = np.load(data_path, mmap_mode="r")
+    features = data["features"]
+    length = (features.shape[1] - LETTERS - 1) // LETTERS
+    device = torch.device("cuda" if torch.cuda.is_available() else "cpu")
+    model = build_model(length).to(device)
+    optimizer = torch.optim.Adam(model.parameters(), lr=1e-3)
+    loss_fn = nn.MSELoss()
+
+    for epoch in range(epochs):
+        order = np.random.permutation(len(data))
+        total = 0.0
+        for start in range(0, len(order), batch_size):
+            rows = np.sort(order[start:start + batch_size])
+            x = torch.from_numpy(np.ascontiguousarray(features[rows])).to(device)
+            y = torch.from_numpy(np.ascontiguousarray(data["value"][rows])).to(device).unsqueeze(1)
+            optimizer.zero_grad()
+            loss = loss_fn(model(x), y)
+            loss.backward()
+            optimizer.step()
+            total += loss.item() * len(rows)
+        print(f"Epoch {epoch + 1}: mse {total / len(order):.4f}")
+
+    torch.save(model.state_dict(), save_path)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument("model", type=str, help="Trained state dict (.pt)")
+    parser.add_argument("output", type=str, nargs="?", default=None, help="Flat binary for --model")
+    parser.add_argument("--train", type=str, default=None, help="Train the model on a --generate .npy file first")
+    parser.add_argument("-e", "--epochs", type=int, default=5, help="Training epochs (default=5)")
+    parser.add_argument("-b", "--batch-size", type=int, default=512, help="Batch size (default=512)")
+    args = parser.parse_args()
+
+    import torch
+
+    if args.train is not None:
+        train(args.train, args.model, args.epochs, args.batch_size)
+        print(f"Trained {args.model} on {args.train}")
+    if args.output is not None:
+        export(torch.load(args.model, map_location="cpu"), args.output)
+        print(f"Exported {args.model} to {args.output}")
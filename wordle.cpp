@@ -3,24 +3,81 @@
 //
 
 #include <algorithm>
+#include <chrono>
 #include <csignal>
+#include <cstdlib>
 #include <iostream>
 #include <ostream>
 
+#include "AdversarialMode.h"
+#include "AllocationCounter.h"
 #include "AutoMode.h"
+#include "Daemon.h"
+#include "DataGenerator.h"
+#include "Dictionary.h"
+#include "Engine.h"
+#include "Entropy.h"
 #include "Feedback.h"
+#include "FibbleMode.h"
+#include "HistogramCache.h"
 #include "Display.h"
 #include "InteractiveMode.h"
-#include "words.h"
+#include "Mlp.h"
+#include "MultiBoard.h"
+#include "StateFeatures.h"
+#include "Sweep.h"
+#include "WordQuery.h"
 
 
 struct Options {
     int k = 1;
     bool fast = false;
     bool silent = false;
+    bool hard = false;
+    Metric metric = Metric::Entropy;
+    size_t prefilter = 0;
+    bool prefilter_safe = false;
+    bool absurdle = false;
+    bool fibble = false;
+    bool nerdle = false;
+    size_t mastermind_pegs = 0;
+    size_t mastermind_colours = 0;
+    unsigned seed = 1;
     std::string answer;
+    size_t sweep_workers = 0;
+    size_t shard_size = 16;
+    std::vector<int> sweep_ks;
+    std::string daemon_socket;
+    std::string guesses_file;
+    std::string answers_file;
+    std::string priors_file;
+    std::string model_file;
+    std::string histograms_file;
+    size_t generate = 0;
+    std::string generate_path = "states.npy";
+    size_t memory_budget = 0;
+    bool check_allocations = false;
+    bool query = false;
+    std::string query_pattern;
+    std::string query_contains;
+    std::string query_excludes;
+    std::string query_not_at;
 };
 
+// Parse a comma separated list of k values, e.g. "1,2,3"
+std::vector<int> parse_k_list(const std::string &list) {
+    std::vector<int> ks;
+    size_t start = 0;
+    while (start < list.size()) {
+        size_t end = list.find(',', start);
+        if (end == std::string::npos) end = list.size();
+        int k = std::atoi(list.substr(start, end - start).c_str());
+        if (k >= 1 && k <= 6) ks.push_back(k);
+        start = end + 1;
+    }
+    return ks;
+}
+
 Options parse_args(int argc, char *argv[], Display &display) {
     Options opts;
 
@@ -36,7 +93,7 @@ Options parse_args(int argc, char *argv[], Display &display) {
             opts.fast = true;
         }
         else if (arg == "-s") {
-            Display::setSilent(true);
+            display.setSilent(true);
             opts.silent = true;
         }
         else if (arg == "-k") {
@@ -53,6 +110,143 @@ Options parse_args(int argc, char *argv[], Display &display) {
             }
         }
 
+        else if (arg == "-m") {
+            if (i + 1 >= argc || !parse_metric(argv[++i], opts.metric)) {
+                display.showOutput("Error: -m flag requires a metric: entropy, remaining, worst or probability.\n");
+                exit(1);
+            }
+        }
+
+        else if (arg == "--prefilter") {
+            if (i + 1 < argc && std::atoi(argv[i + 1]) > 0) {
+                opts.prefilter = std::atoi(argv[++i]);
+            } else {
+                display.showOutput("Error: --prefilter flag requires a survivor count.\n");
+                exit(1);
+            }
+        }
+        else if (arg == "--safe") {
+            opts.prefilter_safe = true;
+        }
+        else if (arg == "--hard") {
+            opts.hard = true;
+        }
+        else if (arg == "--check-allocations") {
+            opts.check_allocations = true;
+        }
+        else if (arg == "--absurdle") {
+            opts.absurdle = true;
+        }
+        else if (arg == "--fibble") {
+            opts.fibble = true;
+        }
+        else if (arg == "--nerdle") {
+            opts.nerdle = true;
+        }
+        else if (arg == "--mastermind") {
+            std::string value = i + 1 < argc ? argv[++i] : "";
+            size_t comma = value.find(',');
+            if (comma == std::string::npos || std::atoi(value.c_str()) <= 0 || std::atoi(value.c_str() + comma + 1) <= 0) {
+                display.showOutput("Error: --mastermind flag requires pegs and colours, e.g. 4,6.\n");
+                exit(1);
+            }
+            opts.mastermind_pegs = std::atoi(value.c_str());
+            opts.mastermind_colours = std::atoi(value.c_str() + comma + 1);
+            if (opts.mastermind_pegs != 4 && opts.mastermind_pegs != 5) {
+                display.showOutput("Error: Mastermind is built for 4 or 5 pegs.\n");
+                exit(1);
+            }
+        }
+        else if (arg == "--seed") {
+            if (i + 1 < argc) {
+                opts.seed = static_cast<unsigned>(std::atoi(argv[++i]));
+            } else {
+                display.showOutput("Error: --seed flag requires a number.\n");
+                exit(1);
+            }
+        }
+        else if (arg == "--sweep") {
+            if (i + 1 < argc && std::atoi(argv[i + 1]) > 0) {
+                opts.sweep_workers = std::atoi(argv[++i]);
+            } else {
+                display.showOutput("Error: --sweep flag requires a worker count.\n");
+                exit(1);
+            }
+        }
+        else if (arg == "--sweep-k") {
+            if (i + 1 < argc) {
+                opts.sweep_ks = parse_k_list(argv[++i]);
+            }
+            if (opts.sweep_ks.empty()) {
+                display.showOutput("Error: --sweep-k flag requires a list of k values between 1 and 6.\n");
+                exit(1);
+            }
+        }
+        else if (arg == "--daemon") {
+            if (i + 1 < argc) {
+                opts.daemon_socket = argv[++i];
+            } else {
+                display.showOutput("Error: --daemon flag requires a socket path.\n");
+                exit(1);
+            }
+        }
+        else if (arg == "--guesses" || arg == "--answers" || arg == "--priors" || arg == "--model" ||
+                 arg == "--histograms") {
+            if (i + 1 < argc) {
+                (arg == "--guesses" ? opts.guesses_file : arg == "--answers" ? opts.answers_file :
+                 arg == "--priors" ? opts.priors_file : arg == "--model" ? opts.model_file :
+                 opts.histograms_file) = argv[++i];
+            } else {
+                display.showOutput("Error: " + arg + " flag requires a file path.\n");
+                exit(1);
+            }
+        }
+        else if (arg == "--memory-budget") {
+            if (i + 1 < argc && std::atoi(argv[i + 1]) > 0) {
+                opts.memory_budget = static_cast<size_t>(std::atoi(argv[++i])) << 20;
+            } else {
+                display.showOutput("Error: --memory-budget flag requires a size in MiB.\n");
+                exit(1);
+            }
+        }
+        else if (arg == "--query" || arg == "--contains" || arg == "--excludes" || arg == "--not-at") {
+            if (i + 1 < argc) {
+                std::string value = argv[++i];
+                if (arg == "--query") opts.query_pattern = value;
+                else if (arg == "--contains") opts.query_contains += value;
+                else if (arg == "--excludes") opts.query_excludes += value;
+                else opts.query_not_at += (opts.query_not_at.empty() ? "" : ",") + value;
+                opts.query = true;
+            } else {
+                display.showOutput("Error: " + arg + " flag requires a value.\n");
+                exit(1);
+            }
+        }
+        else if (arg == "--generate") {
+            if (i + 1 < argc && std::atoi(argv[i + 1]) > 0) {
+                opts.generate = std::atoi(argv[++i]);
+            } else {
+                display.showOutput("Error: --generate flag requires a record count.\n");
+                exit(1);
+            }
+        }
+        else if (arg == "--out") {
+            if (i + 1 < argc) {
+                opts.generate_path = argv[++i];
+            } else {
+                display.showOutput("Error: --out flag requires a file path.\n");
+                exit(1);
+            }
+        }
+        else if (arg == "--shard") {
+            if (i + 1 < argc && std::atoi(argv[i + 1]) > 0) {
+                opts.shard_size = std::atoi(argv[++i]);
+            } else {
+                display.showOutput("Error: --shard flag requires a shard size.\n");
+                exit(1);
+            }
+        }
+
         else if (arg.size() > 2 && arg[0] == '-') {
             for (size_t j = 1; j < arg.size(); j++) {
                 char flag = arg[j];
@@ -60,7 +254,7 @@ Options parse_args(int argc, char *argv[], Display &display) {
                     opts.fast = true;
                 }
                 else if (flag == 's') {
-                    Display::setSilent(true);
+                    display.setSilent(true);
                     opts.silent = true;
                 }
                 else if (flag == 'k') {
@@ -76,6 +270,12 @@ Options parse_args(int argc, char *argv[], Display &display) {
                         exit(1);
                     }
                 }
+                else if (flag == 'm') {
+                    if (i + 1 >= argc || !parse_metric(argv[++i], opts.metric)) {
+                        display.showOutput("Error: -m flag requires a metric: entropy, remaining, worst or probability.\n");
+                        exit(1);
+                    }
+                }
                 else {
                     display.showOutput(std::string("Unknown flag: -") + flag + "\n");
                 }
@@ -86,35 +286,260 @@ Options parse_args(int argc, char *argv[], Display &display) {
     return opts;
 }
 
-int main(int argc, char *argv[]) {
-    Display display;
-    Feedback feedback(display);
+// Print the words matching a query over the loaded word list
+template<size_t L>
+int run_query(const Options &opts, const Dictionary &dictionary, BasicFeedback<L> &feedback, Display &display) {
+    const Alphabet &alphabet = dictionary.get_alphabet();
+    WordQuery query(L);
+    std::string error;
+    if ((!opts.query_pattern.empty() && !query.set_pattern(alphabet, opts.query_pattern, &error)) ||
+        !query.add_contains(alphabet, opts.query_contains, &error) ||
+        !query.add_excludes(alphabet, opts.query_excludes, &error) ||
+        (!opts.query_not_at.empty() && !query.add_not_at(alphabet, opts.query_not_at, &error))) {
+        display.showOutput("Error: invalid query, " + error + ".\n");
+        return 1;
+    }
 
-    Options opts = parse_args(argc, argv, display);
+    auto start = std::chrono::steady_clock::now();
+    LetterIndex::Bits bits = query.match(feedback.get_letter_index());
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
 
-    std::vector<std::string> guesses;
-    if (opts.fast) {
-        guesses = get_valid_solutions();
-    } else {
-        guesses = get_all_solutions();
+    const std::vector<std::string> &words = feedback.get_words();
+    for (uint32_t index : LetterIndex::indices(bits))
+        std::cout << display.word(words[index]) << "\n";
+    std::cout.flush();
+
+    display.showOutput(std::to_string(LetterIndex::count(bits)) + " matching words in " +
+                       std::to_string(us) + " us");
+    return 0;
+}
+
+// Score an opening bucket k = 1..3 steps ahead and fail if scoring touched the heap. Its
+// candidates are also the guesses, which keeps three steps quick.
+template<size_t L>
+int run_allocation_check(const std::vector<std::string> &answers, BasicFeedback<L> &feedback,
+                         const BasicHistogramCache<L> *turn_one, Display &display) {
+    constexpr size_t kCandidates = 100;
+    const std::string &opening = answers.front();
+    auto pattern = feedback.get_feedback(opening, answers[answers.size() / 2]);
+    std::vector<std::string> candidates;
+    for (const auto &answer : answers)
+        if (feedback.get_feedback(opening, answer) == pattern && candidates.size() < kCandidates)
+            candidates.push_back(answer);
+
+    BasicEntropy<L> entropy(feedback);
+    entropy.set_histograms(turn_one);
+    size_t failed = 0;
+    for (int k = 1; k <= 3; ++k) {
+        std::atomic<size_t> progress(0);
+        size_t before = entropy.get_scoring_allocations();
+        entropy.get_n_step_entropy(candidates, candidates, k, progress, true);
+        size_t allocations = entropy.get_scoring_allocations() - before;
+        if (allocations > 0) failed++;
+        display.showOutput("k = " + std::to_string(k) + " | Scored " + std::to_string(progress.load()) +
+                           " guesses over " + std::to_string(candidates.size()) + " candidates | Heap Allocations: " +
+                           std::to_string(allocations));
     }
 
-    std::vector<std::string> answers = get_valid_solutions();
+    if (!AllocationCounter::enabled())
+        display.showOutput("Warning: only arena growth was counted, configure with -DWORDLE_SOLVED_COUNT_ALLOCATIONS=ON to count every allocation.");
+    return failed > 0 ? 1 : 0;
+}
+
+// Everything after loading the dictionary, compiled once per word length
+template<size_t L>
+int run(Options &opts, const Dictionary &dictionary) {
+    BasicEngine<L> engine(opts.silent);
+    Display &display = engine.get_display();
+    BasicFeedback<L> &feedback = engine.get_feedback();
+    display.setAlphabet(dictionary.get_alphabet());
 
-    feedback.precache_feedback(guesses);
-    Entropy::precache_log(guesses.size(), display);
+    std::vector<std::string> guesses = dictionary.guess_words();
+    std::vector<std::string> answers = dictionary.answer_words();
 
-    if (!opts.answer.empty()) {
-        std::string answer = opts.answer;
-        for (char &c : answer) c = tolower(c);
+    // Queries only need the letter index, a one byte budget skips the feedback table
+    feedback.set_memory_budget(opts.query ? 1 : opts.memory_budget);
+    engine.load(guesses, answers);
+
+    if (opts.query) {
+        return run_query<L>(opts, dictionary, feedback, display);
+    }
+
+    feedback.set_priors(answers, dictionary.get_priors());
+
+    // A value model replaces the metric with expected guesses
+    Mlp model;
+    if (!opts.model_file.empty()) {
+        std::string error;
+        if (!model.load(opts.model_file, error)) {
+            display.showOutput("Error: " + error + "\n");
+            return 1;
+        }
+        if (model.input_size() != BasicStateFeatures<L>::kSize || model.output_size() != 1) {
+            display.showOutput("Error: the model takes " + std::to_string(model.input_size()) + " features to " +
+                               std::to_string(model.output_size()) + " outputs, " + std::to_string(L) +
+                               " letter words need " + std::to_string(BasicStateFeatures<L>::kSize) + " to 1.\n");
+            return 1;
+        }
+        opts.metric = Metric::Model;
+    }
+
+    if (!feedback.is_materialised() && opts.k > 1) {
+        display.showOutput("Warning: the feedback table exceeds the memory budget, only k = 1 is supported. Using k = 1.\n");
+        opts.k = 1;
+        opts.sweep_ks.clear();
+    }
+
+    // Turn-1 histograms come from the file when it matches the lists, otherwise they are built and saved
+    BasicHistogramCache<L> histograms;
+    if (!opts.histograms_file.empty()) {
+        std::string error;
+        if (!histograms.load(opts.histograms_file, feedback, answers, error)) {
+            if (!histograms.build(feedback, answers, error) || !histograms.save(opts.histograms_file, error)) {
+                display.showOutput("Error: " + error + "\n");
+                return 1;
+            }
+            display.showOutput("Saved turn-1 histograms to " + opts.histograms_file);
+        }
+    }
+    const BasicHistogramCache<L> *turn_one = histograms.empty() ? nullptr : &histograms;
+
+    if (opts.check_allocations) {
+        if (!feedback.is_materialised()) {
+            display.showOutput("Error: --check-allocations needs the feedback table, which exceeds the memory budget.\n");
+            return 1;
+        }
+        return run_allocation_check<L>(answers, feedback, turn_one, display);
+    }
+
+    if (opts.generate > 0) {
+        if (!feedback.is_materialised()) {
+            display.showOutput("Error: --generate needs the feedback table, which exceeds the memory budget.\n");
+            return 1;
+        }
+        BasicDataGenerator<L> generator(display, feedback, opts.seed);
+        return generator.run(guesses, answers, opts.generate, opts.generate_path) ? 0 : 1;
+    }
+
+    if (!opts.daemon_socket.empty()) {
+        BasicDaemon<L> daemon(display, feedback, guesses, answers, opts.k);
+        return daemon.run(opts.daemon_socket);
+    }
+
+    if (opts.sweep_workers > 0) {
+        SweepTypes::Options sweep_opts;
+        sweep_opts.workers = opts.sweep_workers;
+        sweep_opts.shard_size = opts.shard_size;
+        sweep_opts.hard_mode = opts.hard;
+        sweep_opts.metric = opts.metric;
+        sweep_opts.prefilter = opts.prefilter;
+        sweep_opts.prefilter_safe = opts.prefilter_safe;
+        sweep_opts.model = model.empty() ? nullptr : &model;
+        sweep_opts.ks = opts.sweep_ks.empty() ? std::vector<int>{opts.k} : opts.sweep_ks;
+
+        BasicSweep<L> sweep(display, feedback);
+        sweep.set_histograms(turn_one);
+        auto results = sweep.run(guesses, answers, sweep_opts);
+        if (results.empty()) {
+            return 1;
+        }
+
+        std::sort(results.begin(), results.end(), [](const auto &a, const auto &b) {
+            return a.k != b.k ? a.k < b.k : a.answer < b.answer;
+        });
+
+        for (int k : sweep_opts.ks) {
+            size_t solved = 0, failed = 0, total_guesses = 0;
+            for (const auto &r : results) {
+                if (r.k != static_cast<uint32_t>(k)) continue;
+                if (r.guesses > 0) {
+                    solved++;
+                    total_guesses += r.guesses;
+                } else {
+                    failed++;
+                }
+            }
+            double average = solved > 0 ? static_cast<double>(total_guesses) / solved : 0.0;
+            display.showOutput("k = " + std::to_string(k) + " | Average Guesses: " + std::to_string(average) +
+                               " | Solved: " + std::to_string(solved) + " | Failed: " + std::to_string(failed));
+        }
+
+        if (opts.silent) {
+            for (const auto &r : results)
+                std::cout << display.word(answers[r.answer]) << "," << r.k << "," << r.guesses << "\n";
+            std::cout.flush();
+        }
+        return 0;
+    }
+
+    if (opts.absurdle) {
+        if (!feedback.is_materialised()) {
+            display.showOutput("Error: --absurdle needs the feedback table, which exceeds the memory budget.\n");
+            return 1;
+        }
+
+        BasicAdversarialMode<L> adversarial(display, feedback);
+        int guess_count = adversarial.run(guesses, answers);
+        if (guess_count == -1) {
+            return 1;
+        }
+        if (opts.silent) {
+            std::cout << guess_count << std::endl;
+        }
+        return 0;
+    }
+
+    // Comma separated answers play one board each
+    if (opts.answer.find(',') != std::string::npos) {
+        std::vector<std::string> board_answers;
+        size_t start = 0;
+        while (start <= opts.answer.size()) {
+            size_t end = opts.answer.find(',', start);
+            if (end == std::string::npos) end = opts.answer.size();
+            std::string answer;
+            if (!dictionary.get_alphabet().encode(opts.answer.substr(start, end - start), answer) ||
+                std::find(answers.begin(), answers.end(), answer) == answers.end()) {
+                display.showOutput("Error: provided answer is not in solution list.\n");
+                return 1;
+            }
+            board_answers.push_back(answer);
+            start = end + 1;
+        }
+        if (board_answers.size() > BasicMultiBoard<L>::kMaxBoards) {
+            display.showOutput("Error: at most " + std::to_string(BasicMultiBoard<L>::kMaxBoards) + " boards are supported.\n");
+            return 1;
+        }
+
+        BasicMultiBoard<L> multiboard(display, feedback);
+        int guess_count = multiboard.run(guesses, answers, board_answers);
+        if (guess_count == -1) {
+            return 1;
+        }
+        if (opts.silent) {
+            std::cout << guess_count << std::endl;
+        }
+        return 0;
+    }
 
-        if (std::find(answers.begin(), answers.end(), answer) == answers.end()) {
+    if (!opts.answer.empty()) {
+        std::string answer;
+        if (!dictionary.get_alphabet().encode(opts.answer, answer) ||
+            std::find(answers.begin(), answers.end(), answer) == answers.end()) {
             display.showOutput("Error: provided answer is not in solution list.\n");
             return 1;
         }
 
-        AutoMode automode(display, feedback);
-        int guess_count = automode.run(guesses, answers, opts.k, answer);
+        int guess_count;
+        if (opts.fibble) {
+            BasicFibbleMode<L> fibble(display, feedback, opts.seed);
+            guess_count = fibble.run(guesses, answers, answer);
+        } else {
+            BasicAutoMode<L> automode(display, feedback, opts.hard, opts.metric);
+            automode.set_prefilter(opts.prefilter, opts.prefilter_safe);
+            automode.set_model(model.empty() ? nullptr : &model);
+            automode.set_histograms(turn_one);
+            guess_count = automode.run(guesses, answers, opts.k, answer);
+        }
 
         if (guess_count == -1) {
             return 1;
@@ -123,9 +548,100 @@ int main(int argc, char *argv[]) {
         if (opts.silent) {
             std::cout << guess_count << std::endl;
         }
+    } else if (opts.fibble) {
+        display.showOutput("Error: --fibble needs an answer to play against.\n");
+        return 1;
     } else {
         display.showOutput("Interactive Mode Starting");
-        InteractiveMode interactivemode(display, feedback);
+        BasicInteractiveMode<L> interactivemode(display, feedback, opts.hard, opts.metric);
+        interactivemode.set_prefilter(opts.prefilter, opts.prefilter_safe);
+        interactivemode.set_model(model.empty() ? nullptr : &model);
+        interactivemode.set_histograms(turn_one);
         interactivemode.run(guesses, answers, opts.k);
     }
-}
\ No newline at end of file
+
+    return 0;
+}
+
+// Games scored by another feedback rule, played automatically against an answer
+template<size_t L, class Rule>
+int run_rule(Options &opts, const Dictionary &dictionary) {
+    BasicEngine<L, Rule> engine(opts.silent);
+    Display &display = engine.get_display();
+    BasicFeedback<L, Rule> &feedback = engine.get_feedback();
+    display.setAlphabet(dictionary.get_alphabet());
+
+    std::vector<std::string> guesses = dictionary.guess_words();
+    std::vector<std::string> answers = dictionary.answer_words();
+
+    std::string answer;
+    if (opts.answer.empty() || !dictionary.get_alphabet().encode(opts.answer, answer) ||
+        std::find(answers.begin(), answers.end(), answer) == answers.end()) {
+        display.showOutput("Error: provide an answer from the solution list to play against.\n");
+        return 1;
+    }
+
+    feedback.set_memory_budget(opts.memory_budget);
+    engine.load(guesses, answers);
+
+    if (!feedback.is_materialised() && opts.k > 1) {
+        display.showOutput("Warning: the feedback table exceeds the memory budget, only k = 1 is supported. Using k = 1.\n");
+        opts.k = 1;
+    }
+
+    BasicAutoMode<L, Rule> automode(display, feedback, false, opts.metric);
+    automode.set_prefilter(opts.prefilter, opts.prefilter_safe);
+    int guess_count = automode.run(guesses, answers, opts.k, answer);
+    if (guess_count == -1) {
+        return 1;
+    }
+    if (opts.silent) {
+        std::cout << guess_count << std::endl;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    Display display;
+    Options opts = parse_args(argc, argv, display);
+
+    Dictionary dictionary;
+    std::string error;
+    if (opts.mastermind_pegs > 0) {
+        if (!dictionary.load_mastermind(opts.mastermind_pegs, opts.mastermind_colours, error)) {
+            display.showOutput("Error: " + error + "\n");
+            return 1;
+        }
+        switch (opts.mastermind_pegs) {
+            case 4: return run_rule<4, MastermindRule<4>>(opts, dictionary);
+            case 5: return run_rule<5, MastermindRule<5>>(opts, dictionary);
+            default:
+                display.showOutput("Error: Mastermind is built for 4 or 5 pegs.\n");
+                return 1;
+        }
+    }
+
+    if (opts.nerdle) {
+        dictionary.load_nerdle();
+    } else if (!dictionary.load(opts.guesses_file, opts.answers_file, opts.fast, error)) {
+        display.showOutput("Error: " + error + "\n");
+        return 1;
+    }
+
+    if (!opts.priors_file.empty() && !dictionary.load_priors(opts.priors_file, error)) {
+        display.showOutput("Error: " + error + "\n");
+        return 1;
+    }
+
+    // Dispatch once on the word length, the solver below is specialised for it
+    switch (dictionary.get_word_length()) {
+        case 4: return run<4>(opts, dictionary);
+        case 5: return run<5>(opts, dictionary);
+        case 6: return run<6>(opts, dictionary);
+        case 7: return run<7>(opts, dictionary);
+        case 8: return run<8>(opts, dictionary);
+        default:
+            display.showOutput("Error: unsupported word length " + std::to_string(dictionary.get_word_length()) + "\n");
+            return 1;
+    }
+}
@@ -1,9 +1,19 @@
+import glob
 import math
+import os
+import sys
 from collections import defaultdict
 from multiprocessing import Pool, cpu_count
 import argparse
 # from tqdm import tqdm
 
+# Native engine (wordle_native CPython extension), built by CMake into <build>/python
+sys.path.extend(glob.glob(os.path.join(os.path.dirname(os.path.abspath(__file__)), "cmake-build-*", "python")))
+try:
+    import wordle_native
+except ImportError:
+    wordle_native = None
+
 
 parser = argparse.ArgumentParser()
 parser.add_argument('-a', '--answers', type=str, default=None, help="Correct word")
@@ -155,6 +165,14 @@ def get_n_step_guess(solutions, all_solutions, guesses_left):
     return best_guess, best_entropy
 
 
+def get_native_guess(engine, solutions):
+    candidates = [engine.word_id(s) for s in solutions]
+    entropies = memoryview(engine.entropies(candidates=candidates))
+
+    best_index = max(range(len(entropies)), key=entropies.__getitem__)
+    return engine.words[best_index], entropies[best_index]
+
+
 ## Todo: change to auto mode interaction, benchmark against c++
 if __name__ == "__main__":
     solved = False
@@ -162,8 +180,14 @@ if __name__ == "__main__":
     solutions = get_solutions("answers.txt")
     guesses = 0
 
+    # Single step scoring runs in the native engine when it is available
+    engine = wordle_native.Engine(all_solutions, solutions) if wordle_native and k == 1 else None
+
     while len(solutions) > 1:
-        best_guess, best_entropy = get_n_step_guess(solutions, all_solutions, k)
+        if engine is not None:
+            best_guess, best_entropy = get_native_guess(engine, solutions)
+        else:
+            best_guess, best_entropy = get_n_step_guess(solutions, all_solutions, k)
         # print(f"Guess: \033[1m{best_guess.upper()}\033[0m | Expected Entropy: {best_entropy:.2f} bits")
 
         # feedback = input("Feedback (\033[1;42;30m G \033[0m|\033[1;43;30m Y \033[0m|\033[1;100;97m B \033[0m, or \033[1;100;97m N \033[0m for an invalid guess): ").upper().strip()
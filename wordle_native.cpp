@@ -0,0 +1,658 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+// CPython extension exposing the solver engine to wordle.py and model.py.
+// Results are returned as buffer objects (usable with memoryview/numpy) that
+// either own their memory or borrow the engine's feedback table, scoring
+// releases the GIL. Env steps batches of self-play games into writable buffers
+// owned by the caller.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include "wordle_solved.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Buffer: 1D/2D read-only array exporting the buffer protocol
+// ---------------------------------------------------------------------------
+
+struct BufferObject {
+    PyObject_HEAD
+    PyObject *owner;      // Keeps borrowed memory alive, null when owned
+    void *data;
+    void *owned;          // PyMem allocation freed with the buffer
+    Py_ssize_t *pins;     // Owner's count of views borrowing its memory, null when not counted
+    Py_ssize_t itemsize;
+    const char *format;
+    int ndim;
+    Py_ssize_t shape[2];
+    Py_ssize_t strides[2];
+};
+
+void buffer_dealloc(BufferObject *self) {
+    if (self->pins) (*self->pins)--;
+    Py_XDECREF(self->owner);
+    PyMem_Free(self->owned);
+    Py_TYPE(self)->tp_free(reinterpret_cast<PyObject *>(self));
+}
+
+int buffer_getbuffer(BufferObject *self, Py_buffer *view, int flags) {
+    if (flags & PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "wordle_native buffers are read-only");
+        return -1;
+    }
+
+    view->obj = reinterpret_cast<PyObject *>(self);
+    Py_INCREF(self);
+    view->buf = self->data;
+    view->itemsize = self->itemsize;
+    view->len = self->itemsize;
+    for (int i = 0; i < self->ndim; ++i) view->len *= self->shape[i];
+    view->readonly = 1;
+    view->ndim = self->ndim;
+    view->format = (flags & PyBUF_FORMAT) ? const_cast<char *>(self->format) : nullptr;
+    view->shape = (flags & PyBUF_ND) ? self->shape : nullptr;
+    view->strides = ((flags & PyBUF_STRIDES) == PyBUF_STRIDES) ? self->strides : nullptr;
+    view->suboffsets = nullptr;
+    view->internal = nullptr;
+    return 0;
+}
+
+Py_ssize_t buffer_length(BufferObject *self) {
+    return self->shape[0];
+}
+
+// Static type objects start zeroed with the header PyVarObject_HEAD_INIT gives, their slots
+// are assigned by name in PyInit_wordle_native
+PyTypeObject static_type() {
+    PyTypeObject type{};
+    Py_SET_REFCNT(reinterpret_cast<PyObject *>(&type), 1);
+    return type;
+}
+
+// Method pointers pass through void(*)(void), which converts to any function type cleanly
+template<class Method>
+PyCFunction method(Method function) {
+    return reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(function));
+}
+
+PyBufferProcs buffer_procs{};
+
+PySequenceMethods buffer_sequence{};
+
+PyTypeObject BufferType = static_type();
+
+// Wrap memory, taking ownership of `owned` or borrowing from `owner`
+PyObject *make_buffer(void *data, void *owned, PyObject *owner, Py_ssize_t itemsize, const char *format,
+                      Py_ssize_t rows, Py_ssize_t cols = -1) {
+    BufferObject *self = PyObject_New(BufferObject, &BufferType);
+    if (!self) {
+        PyMem_Free(owned);
+        return nullptr;
+    }
+    self->owner = owner;
+    Py_XINCREF(owner);
+    self->data = data;
+    self->owned = owned;
+    self->pins = nullptr;
+    self->itemsize = itemsize;
+    self->format = format;
+    self->ndim = cols < 0 ? 1 : 2;
+    self->shape[0] = rows;
+    self->shape[1] = cols < 0 ? 0 : cols;
+    self->strides[0] = cols < 0 ? itemsize : itemsize * cols;
+    self->strides[1] = itemsize;
+    return reinterpret_cast<PyObject *>(self);
+}
+
+// ---------------------------------------------------------------------------
+// Index arguments: any uint32 buffer (array('I'), numpy) or a sequence of ints
+// ---------------------------------------------------------------------------
+
+class IdArray {
+private:
+    Py_buffer view{};
+    bool has_view = false;
+    std::vector<uint32_t> storage;
+
+public:
+    const uint32_t *data = nullptr;
+    size_t size = 0;
+
+    ~IdArray() {
+        if (has_view) PyBuffer_Release(&view);
+    }
+
+    bool parse(PyObject *obj) {
+        if (PyObject_CheckBuffer(obj) &&
+            PyObject_GetBuffer(obj, &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) == 0) {
+            has_view = true;
+            const char *fmt = view.format ? view.format : "B";
+            if (*fmt == '=' || *fmt == '<' || *fmt == '@') ++fmt;
+            if (view.itemsize == 4 && (*fmt == 'I' || *fmt == 'L' || *fmt == 'i' || *fmt == 'l')) {
+                data = static_cast<const uint32_t *>(view.buf);
+                size = static_cast<size_t>(view.len / 4);
+                return true;
+            }
+            PyBuffer_Release(&view);
+            has_view = false;
+        }
+        PyErr_Clear();
+
+        PyObject *seq = PySequence_Fast(obj, "expected a uint32 buffer or a sequence of word ids");
+        if (!seq) return false;
+        Py_ssize_t n = PySequence_Fast_GET_SIZE(seq);
+        storage.resize(static_cast<size_t>(n));
+        for (Py_ssize_t i = 0; i < n; ++i) {
+            unsigned long v = PyLong_AsUnsignedLong(PySequence_Fast_GET_ITEM(seq, i));
+            if (PyErr_Occurred()) {
+                Py_DECREF(seq);
+                return false;
+            }
+            storage[static_cast<size_t>(i)] = static_cast<uint32_t>(v);
+        }
+        Py_DECREF(seq);
+        data = storage.data();
+        size = storage.size();
+        return true;
+    }
+
+    // Default to 0..n-1
+    void iota(size_t n) {
+        storage.resize(n);
+        for (size_t i = 0; i < n; ++i) storage[i] = static_cast<uint32_t>(i);
+        data = storage.data();
+        size = n;
+    }
+
+    void assign(std::vector<uint32_t> ids) {
+        storage = std::move(ids);
+        data = storage.data();
+        size = storage.size();
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Output arguments: writable C contiguous buffers of a fixed item type and length
+// ---------------------------------------------------------------------------
+
+class OutArray {
+private:
+    Py_buffer view{};
+    bool has_view = false;
+
+public:
+    void *data = nullptr;
+
+    ~OutArray() {
+        if (has_view) PyBuffer_Release(&view);
+    }
+
+    // None leaves data null, formats lists the accepted struct codes
+    bool parse(PyObject *obj, const char *name, Py_ssize_t itemsize, const char *formats, size_t count) {
+        if (obj == Py_None) return true;
+        if (PyObject_GetBuffer(obj, &view, PyBUF_WRITABLE | PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) != 0) return false;
+        has_view = true;
+        const char *fmt = view.format ? view.format : "B";
+        if (*fmt == '=' || *fmt == '<' || *fmt == '@') ++fmt;
+        if (view.itemsize != itemsize || !std::strchr(formats, *fmt) ||
+            view.len < static_cast<Py_ssize_t>(count) * itemsize) {
+            PyErr_Format(PyExc_ValueError, "%s must be a writable buffer of at least %zu '%c' items",
+                         name, count, formats[0]);
+            return false;
+        }
+        data = view.buf;
+        return true;
+    }
+};
+
+bool check_status(int status) {
+    if (status >= 0) return true;
+    PyErr_SetString(status == WS_ERR_INVALID_WORD ? PyExc_KeyError : PyExc_ValueError, ws_status_string(status));
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+// Engine
+// ---------------------------------------------------------------------------
+
+struct EngineObject {
+    PyObject_HEAD
+    ws_engine *engine;
+    Py_ssize_t envs;      // Envs holding candidate ids into the loaded lists
+    Py_ssize_t views;     // Buffers borrowing the loaded feedback table
+    Py_ssize_t calls;     // Calls reading the tables with the GIL released
+};
+
+void engine_dealloc(EngineObject *self) {
+    ws_engine_destroy(self->engine);
+    Py_TYPE(self)->tp_free(reinterpret_cast<PyObject *>(self));
+}
+
+// Flatten a sequence of 5 letter str into records
+bool to_records(PyObject *obj, std::string &records, size_t &count) {
+    PyObject *seq = PySequence_Fast(obj, "expected a sequence of 5 letter words");
+    if (!seq) return false;
+    Py_ssize_t n = PySequence_Fast_GET_SIZE(seq);
+    records.clear();
+    records.reserve(static_cast<size_t>(n) * WS_WORD_LENGTH);
+    for (Py_ssize_t i = 0; i < n; ++i) {
+        Py_ssize_t len = 0;
+        const char *word = PyUnicode_AsUTF8AndSize(PySequence_Fast_GET_ITEM(seq, i), &len);
+        if (!word || len != WS_WORD_LENGTH) {
+            Py_DECREF(seq);
+            if (!PyErr_Occurred()) PyErr_SetString(PyExc_ValueError, "words must be 5 letters");
+            return false;
+        }
+        records.append(word, WS_WORD_LENGTH);
+    }
+    Py_DECREF(seq);
+    count = static_cast<size_t>(n);
+    return true;
+}
+
+int engine_init(EngineObject *self, PyObject *args, PyObject *kwargs) {
+    static const char *keywords[] = {"words", "answers", "fast", nullptr};
+    PyObject *words = Py_None, *answers = Py_None;
+    int fast = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|OOp", const_cast<char **>(keywords), &words, &answers, &fast))
+        return -1;
+
+    // Reloading would leave live Envs with ids and pools sized for the old lists,
+    // feedback_matrix views pointing at the freed table and running scores reading it
+    if (self->envs > 0 || self->views > 0 || self->calls > 0) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "Engine cannot be reloaded while Envs, feedback_matrix views or other calls use it");
+        return -1;
+    }
+    if (!self->engine) self->engine = ws_engine_create();
+
+    // Loading keeps the GIL, so no other method can see the tables half replaced
+    int status;
+    if (words == Py_None && answers == Py_None) {
+        status = ws_engine_load_default(self->engine, fast);
+    } else {
+        std::string word_records, answer_records;
+        size_t n_words = 0, n_answers = 0;
+        if (words != Py_None && !to_records(words, word_records, n_words)) return -1;
+        if (answers != Py_None && !to_records(answers, answer_records, n_answers)) return -1;
+
+        status = ws_engine_load_dictionary(self->engine, word_records.data(), n_words,
+                                           answer_records.data(), n_answers);
+    }
+    return check_status(status) ? 0 : -1;
+}
+
+PyObject *engine_words(EngineObject *self, void *) {
+    size_t n = ws_engine_word_count(self->engine);
+    PyObject *list = PyList_New(static_cast<Py_ssize_t>(n));
+    if (!list) return nullptr;
+    char word[WS_WORD_LENGTH];
+    for (size_t i = 0; i < n; ++i) {
+        ws_engine_word(self->engine, static_cast<uint32_t>(i), word);
+        PyList_SET_ITEM(list, static_cast<Py_ssize_t>(i), PyUnicode_FromStringAndSize(word, WS_WORD_LENGTH));
+    }
+    return list;
+}
+
+PyObject *engine_answers(EngineObject *self, void *) {
+    size_t n = ws_engine_answer_count(self->engine);
+    void *owned = PyMem_Malloc(std::max<size_t>(n, 1) * sizeof(uint32_t));
+    if (!owned) return PyErr_NoMemory();
+    ws_engine_answers(self->engine, static_cast<uint32_t *>(owned), n);
+    return make_buffer(owned, owned, nullptr, sizeof(uint32_t), "I", static_cast<Py_ssize_t>(n));
+}
+
+PyObject *engine_word_id(EngineObject *self, PyObject *arg) {
+    Py_ssize_t len = 0;
+    const char *word = PyUnicode_AsUTF8AndSize(arg, &len);
+    if (!word) return nullptr;
+    if (len != WS_WORD_LENGTH) {
+        PyErr_SetString(PyExc_KeyError, "words must be 5 letters");
+        return nullptr;
+    }
+    int64_t id = ws_engine_word_id(self->engine, word);
+    if (!check_status(static_cast<int>(id))) return nullptr;
+    return PyLong_FromLongLong(id);
+}
+
+PyObject *engine_feedback(EngineObject *self, PyObject *args) {
+    unsigned int guess, solution;
+    if (!PyArg_ParseTuple(args, "II", &guess, &solution)) return nullptr;
+    int pattern = ws_feedback(self->engine, guess, solution);
+    if (!check_status(pattern)) return nullptr;
+    return PyLong_FromLong(pattern);
+}
+
+// Zero-copy view of the whole n x n table, rows indexed by guess id.
+// The view keeps the engine alive and loaded until it is released.
+PyObject *engine_feedback_matrix(EngineObject *self, PyObject *) {
+    size_t n = ws_engine_word_count(self->engine);
+    if (n == 0) {
+        check_status(WS_ERR_NOT_LOADED);
+        return nullptr;
+    }
+    const uint8_t *table = ws_feedback_row(self->engine, 0);
+    PyObject *view = make_buffer(const_cast<uint8_t *>(table), nullptr, reinterpret_cast<PyObject *>(self),
+                                 1, "B", static_cast<Py_ssize_t>(n), static_cast<Py_ssize_t>(n));
+    if (!view) return nullptr;
+    reinterpret_cast<BufferObject *>(view)->pins = &self->views;
+    self->views++;
+    return view;
+}
+
+PyObject *engine_filter(EngineObject *self, PyObject *args) {
+    PyObject *candidates_obj;
+    unsigned int guess, pattern;
+    if (!PyArg_ParseTuple(args, "OII", &candidates_obj, &guess, &pattern)) return nullptr;
+
+    IdArray candidates;
+    if (!candidates.parse(candidates_obj)) return nullptr;
+
+    void *owned = PyMem_Malloc(std::max<size_t>(candidates.size, 1) * sizeof(uint32_t));
+    if (!owned) return PyErr_NoMemory();
+
+    int64_t kept = ws_filter(self->engine, candidates.data, candidates.size, guess,
+                             static_cast<uint8_t>(pattern), static_cast<uint32_t *>(owned));
+    if (!check_status(static_cast<int>(std::min<int64_t>(kept, 0)))) {
+        PyMem_Free(owned);
+        return nullptr;
+    }
+    return make_buffer(owned, owned, nullptr, sizeof(uint32_t), "I", static_cast<Py_ssize_t>(kept));
+}
+
+// Entropy of every guess (default: all words) over candidates (default: answers)
+PyObject *engine_entropies(EngineObject *self, PyObject *args, PyObject *kwargs) {
+    static const char *keywords[] = {"candidates", "guesses", nullptr};
+    PyObject *candidates_obj = Py_None, *guesses_obj = Py_None;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", const_cast<char **>(keywords),
+                                     &candidates_obj, &guesses_obj))
+        return nullptr;
+
+    size_t n_words = ws_engine_word_count(self->engine);
+    if (n_words == 0) {
+        check_status(WS_ERR_NOT_LOADED);
+        return nullptr;
+    }
+
+    IdArray candidates, guesses;
+    if (candidates_obj == Py_None) {
+        std::vector<uint32_t> ids(ws_engine_answer_count(self->engine));
+        ws_engine_answers(self->engine, ids.data(), ids.size());
+        candidates.assign(std::move(ids));
+    } else if (!candidates.parse(candidates_obj)) {
+        return nullptr;
+    }
+    if (guesses_obj == Py_None) guesses.iota(n_words);
+    else if (!guesses.parse(guesses_obj)) return nullptr;
+
+    double *scores = static_cast<double *>(PyMem_Malloc(std::max<size_t>(guesses.size, 1) * sizeof(double)));
+    if (!scores) return PyErr_NoMemory();
+
+    int status;
+    self->calls++;
+    Py_BEGIN_ALLOW_THREADS
+    status = ws_score(self->engine, guesses.data, guesses.size, candidates.data, candidates.size, scores);
+    Py_END_ALLOW_THREADS
+    self->calls--;
+
+    if (!check_status(status)) {
+        PyMem_Free(scores);
+        return nullptr;
+    }
+    return make_buffer(scores, scores, nullptr, sizeof(double), "d", static_cast<Py_ssize_t>(guesses.size));
+}
+
+// Ids of the words matching a letter query, see ws_query
+PyObject *engine_query(EngineObject *self, PyObject *args, PyObject *kwargs) {
+    static const char *keywords[] = {"pattern", "contains", "excludes", "not_at", nullptr};
+    const char *pattern = nullptr, *contains = nullptr, *excludes = nullptr, *not_at = nullptr;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|zzzz", const_cast<char **>(keywords),
+                                     &pattern, &contains, &excludes, &not_at))
+        return nullptr;
+
+    int64_t matches = ws_query(self->engine, pattern, contains, excludes, not_at, nullptr, 0);
+    if (!check_status(static_cast<int>(std::min<int64_t>(matches, 0)))) return nullptr;
+
+    void *owned = PyMem_Malloc(std::max<size_t>(static_cast<size_t>(matches), 1) * sizeof(uint32_t));
+    if (!owned) return PyErr_NoMemory();
+    ws_query(self->engine, pattern, contains, excludes, not_at, static_cast<uint32_t *>(owned),
+             static_cast<size_t>(matches));
+    return make_buffer(owned, owned, nullptr, sizeof(uint32_t), "I", static_cast<Py_ssize_t>(matches));
+}
+
+PyMethodDef engine_methods[] = {
+    {"word_id", method(engine_word_id), METH_O,
+     "word_id(word) -> index of word in the engine's word list"},
+    {"feedback", method(engine_feedback), METH_VARARGS,
+     "feedback(guess_id, solution_id) -> Base 3 feedback pattern"},
+    {"feedback_matrix", method(engine_feedback_matrix), METH_NOARGS,
+     "feedback_matrix() -> zero-copy n x n uint8 buffer of cached patterns"},
+    {"filter", method(engine_filter), METH_VARARGS,
+     "filter(candidates, guess_id, pattern) -> uint32 buffer of consistent candidates"},
+    {"entropies", method(engine_entropies), METH_VARARGS | METH_KEYWORDS,
+     "entropies(candidates=answers, guesses=all) -> float64 buffer of single step entropies"},
+    {"query", method(engine_query), METH_VARARGS | METH_KEYWORDS,
+     "query(pattern=None, contains=None, excludes=None, not_at=None) -> uint32 buffer of matching word ids"},
+    {nullptr, nullptr, 0, nullptr},
+};
+
+PyGetSetDef engine_getset[] = {
+    {"words", reinterpret_cast<getter>(engine_words), nullptr, "Word list, indexed by word id", nullptr},
+    {"answers", reinterpret_cast<getter>(engine_answers), nullptr, "uint32 buffer of answer word ids", nullptr},
+    {nullptr, nullptr, nullptr, nullptr, nullptr},
+};
+
+PyTypeObject EngineType = static_type();
+
+// ---------------------------------------------------------------------------
+// Env: batched self-play games, see ws_env_*
+// ---------------------------------------------------------------------------
+
+struct EnvObject {
+    PyObject_HEAD
+    PyObject *engine;     // Keeps the borrowed engine alive
+    ws_env *env;
+};
+
+// Attach to engine, detaching from the previous one
+void env_set_engine(EnvObject *self, PyObject *engine) {
+    if (engine) {
+        Py_INCREF(engine);
+        reinterpret_cast<EngineObject *>(engine)->envs++;
+    }
+    PyObject *previous = self->engine;
+    self->engine = engine;
+    if (previous) {
+        reinterpret_cast<EngineObject *>(previous)->envs--;
+        Py_DECREF(previous);
+    }
+}
+
+void env_dealloc(EnvObject *self) {
+    ws_env_destroy(self->env);
+    env_set_engine(self, nullptr);
+    Py_TYPE(self)->tp_free(reinterpret_cast<PyObject *>(self));
+}
+
+int env_init(EnvObject *self, PyObject *args, PyObject *kwargs) {
+    static const char *keywords[] = {"engine", "n", "max_turns", "seed", nullptr};
+    PyObject *engine;
+    Py_ssize_t n;
+    int max_turns = 6;
+    unsigned long long seed = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O!n|iK", const_cast<char **>(keywords),
+                                     &EngineType, &engine, &n, &max_turns, &seed))
+        return -1;
+    if (n <= 0) {
+        PyErr_SetString(PyExc_ValueError, "n must be positive");
+        return -1;
+    }
+
+    ws_env *env = ws_env_create(reinterpret_cast<EngineObject *>(engine)->engine, static_cast<size_t>(n),
+                                max_turns, seed);
+    if (!env) {
+        check_status(WS_ERR_NOT_LOADED);
+        return -1;
+    }
+    ws_env_destroy(self->env);
+    self->env = env;
+    env_set_engine(self, engine);
+    return 0;
+}
+
+PyObject *env_reset(EnvObject *self, PyObject *args, PyObject *kwargs) {
+    static const char *keywords[] = {"observations", "mask", nullptr};
+    PyObject *observations_obj = Py_None, *mask_obj = Py_None;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", const_cast<char **>(keywords),
+                                     &observations_obj, &mask_obj))
+        return nullptr;
+
+    size_t n = ws_env_count(self->env);
+    OutArray observations, mask;
+    if (!observations.parse(observations_obj, "observations", sizeof(float), "f", n * WS_OBSERVATION_SIZE) ||
+        !mask.parse(mask_obj, "mask", 1, "B?b", n))
+        return nullptr;
+
+    int status = ws_env_reset(self->env, static_cast<const uint8_t *>(mask.data),
+                              static_cast<float *>(observations.data));
+    if (!check_status(status)) return nullptr;
+    Py_RETURN_NONE;
+}
+
+PyObject *env_step(EnvObject *self, PyObject *args, PyObject *kwargs) {
+    static const char *keywords[] = {"guesses", "rewards", "dones", "observations", "patterns", nullptr};
+    PyObject *guesses_obj, *rewards_obj, *dones_obj, *observations_obj = Py_None, *patterns_obj = Py_None;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO|OO", const_cast<char **>(keywords),
+                                     &guesses_obj, &rewards_obj, &dones_obj, &observations_obj, &patterns_obj))
+        return nullptr;
+
+    size_t n = ws_env_count(self->env);
+    IdArray guesses;
+    OutArray rewards, dones, observations, patterns;
+    if (!guesses.parse(guesses_obj) ||
+        !rewards.parse(rewards_obj, "rewards", sizeof(float), "f", n) ||
+        !dones.parse(dones_obj, "dones", 1, "B?b", n) ||
+        !observations.parse(observations_obj, "observations", sizeof(float), "f", n * WS_OBSERVATION_SIZE) ||
+        !patterns.parse(patterns_obj, "patterns", 1, "Bb", n))
+        return nullptr;
+    if (guesses.size < n || !rewards.data || !dones.data) {
+        PyErr_SetString(PyExc_ValueError, "step needs a guess, reward and done slot per env");
+        return nullptr;
+    }
+
+    int status;
+    Py_BEGIN_ALLOW_THREADS
+    status = ws_env_step(self->env, guesses.data,
+                         static_cast<float *>(rewards.data), static_cast<uint8_t *>(dones.data),
+                         static_cast<float *>(observations.data), static_cast<uint8_t *>(patterns.data));
+    Py_END_ALLOW_THREADS
+    if (!check_status(status)) return nullptr;
+    Py_RETURN_NONE;
+}
+
+PyObject *env_candidates(EnvObject *self, PyObject *arg) {
+    Py_ssize_t index = PyLong_AsSsize_t(arg);
+    if (index == -1 && PyErr_Occurred()) return nullptr;
+    if (index < 0 || static_cast<size_t>(index) >= ws_env_count(self->env)) {
+        PyErr_SetString(PyExc_IndexError, "env index out of range");
+        return nullptr;
+    }
+
+    size_t capacity = ws_engine_answer_count(reinterpret_cast<EngineObject *>(self->engine)->engine);
+    void *owned = PyMem_Malloc(std::max<size_t>(capacity, 1) * sizeof(uint32_t));
+    if (!owned) return PyErr_NoMemory();
+    int64_t count = ws_env_candidates(self->env, static_cast<size_t>(index), static_cast<uint32_t *>(owned), capacity);
+    return make_buffer(owned, owned, nullptr, sizeof(uint32_t), "I", static_cast<Py_ssize_t>(count));
+}
+
+Py_ssize_t env_length(EnvObject *self) {
+    return static_cast<Py_ssize_t>(ws_env_count(self->env));
+}
+
+PySequenceMethods env_sequence{};
+
+PyMethodDef env_methods[] = {
+    {"reset", method(env_reset), METH_VARARGS | METH_KEYWORDS,
+     "reset(observations=None, mask=None) -> start new games where mask is set, or in every env"},
+    {"step", method(env_step), METH_VARARGS | METH_KEYWORDS,
+     "step(guesses, rewards, dones, observations=None, patterns=None) -> play one guess id per env"},
+    {"candidates", method(env_candidates), METH_O,
+     "candidates(index) -> uint32 buffer of the answer ids still possible in one env"},
+    {nullptr, nullptr, 0, nullptr},
+};
+
+PyTypeObject EnvType = static_type();
+
+PyModuleDef module_def{};
+
+}
+
+PyMODINIT_FUNC PyInit_wordle_native(void) {
+    buffer_procs.bf_getbuffer = reinterpret_cast<getbufferproc>(buffer_getbuffer);
+    buffer_sequence.sq_length = reinterpret_cast<lenfunc>(buffer_length);
+    env_sequence.sq_length = reinterpret_cast<lenfunc>(env_length);
+
+    BufferType.tp_name = "wordle_native.Buffer";
+    BufferType.tp_basicsize = sizeof(BufferObject);
+    BufferType.tp_dealloc = reinterpret_cast<destructor>(buffer_dealloc);
+    BufferType.tp_as_buffer = &buffer_procs;
+    BufferType.tp_as_sequence = &buffer_sequence;
+    BufferType.tp_flags = Py_TPFLAGS_DEFAULT;
+    BufferType.tp_doc = "Read-only array exported through the buffer protocol";
+
+    EngineType.tp_name = "wordle_native.Engine";
+    EngineType.tp_basicsize = sizeof(EngineObject);
+    EngineType.tp_dealloc = reinterpret_cast<destructor>(engine_dealloc);
+    EngineType.tp_flags = Py_TPFLAGS_DEFAULT;
+    EngineType.tp_doc = "Engine(words=None, answers=None, fast=False)";
+    EngineType.tp_methods = engine_methods;
+    EngineType.tp_getset = engine_getset;
+    EngineType.tp_init = reinterpret_cast<initproc>(engine_init);
+    EngineType.tp_new = PyType_GenericNew;
+
+    EnvType.tp_name = "wordle_native.Env";
+    EnvType.tp_basicsize = sizeof(EnvObject);
+    EnvType.tp_dealloc = reinterpret_cast<destructor>(env_dealloc);
+    EnvType.tp_as_sequence = &env_sequence;
+    EnvType.tp_flags = Py_TPFLAGS_DEFAULT;
+    EnvType.tp_doc = "Env(engine, n, max_turns=6, seed=0), n games stepped together into caller buffers";
+    EnvType.tp_methods = env_methods;
+    EnvType.tp_init = reinterpret_cast<initproc>(env_init);
+    EnvType.tp_new = PyType_GenericNew;
+
+    if (PyType_Ready(&BufferType) < 0 || PyType_Ready(&EngineType) < 0 || PyType_Ready(&EnvType) < 0)
+        return nullptr;
+
+    PyModuleDef_Base module_base = PyModuleDef_HEAD_INIT;
+    module_def.m_base = module_base;
+    module_def.m_name = "wordle_native";
+    module_def.m_doc = "Native wordle_solved engine: feedback tables and entropy scoring.";
+    module_def.m_size = -1;
+
+    PyObject *module = PyModule_Create(&module_def);
+    if (!module) return nullptr;
+
+    Py_INCREF(&EngineType);
+    if (PyModule_AddObject(module, "Engine", reinterpret_cast<PyObject *>(&EngineType)) < 0) {
+        Py_DECREF(&EngineType);
+        Py_DECREF(module);
+        return nullptr;
+    }
+    Py_INCREF(&EnvType);
+    if (PyModule_AddObject(module, "Env", reinterpret_cast<PyObject *>(&EnvType)) < 0) {
+        Py_DECREF(&EnvType);
+        Py_DECREF(module);
+        return nullptr;
+    }
+    PyModule_AddIntConstant(module, "PATTERN_COUNT", WS_PATTERN_COUNT);
+    PyModule_AddIntConstant(module, "OBSERVATION_SIZE", WS_OBSERVATION_SIZE);
+    return module;
+}
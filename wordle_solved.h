@@ -0,0 +1,165 @@
+/*
+ * wordle_solved C API
+ *
+ * Stable C ABI over the solver engine. Words are passed as contiguous
+ * 5 byte records (no terminators) and referred to by their index in the
+ * engine's word list. Every function writing results takes a caller-provided
+ * buffer, nothing returned by the library needs to be freed except the engine.
+ *
+ * Feedback patterns are Base 3 integers, Gray = 0, Yellow = 1, Green = 2,
+ * most significant digit first, so "GGGGG" = 242.
+ *
+ * Engines are independent. Engines loading the same word list share one
+ * reference counted copy of its tables, which is freed with the last of them.
+ * Calls on one engine must not overlap with ws_engine_load_* on that engine.
+ */
+
+#ifndef WORDLE_SOLVED_WORDLE_SOLVED_H
+#define WORDLE_SOLVED_WORDLE_SOLVED_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#  if defined(WORDLE_SOLVED_BUILD)
+#    define WS_API __declspec(dllexport)
+#  elif defined(WORDLE_SOLVED_STATIC)
+#    define WS_API
+#  else
+#    define WS_API __declspec(dllimport)
+#  endif
+#else
+#  define WS_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define WS_WORD_LENGTH 5
+#define WS_PATTERN_COUNT 243
+#define WS_OBSERVATION_SIZE 157
+
+typedef enum ws_status {
+    WS_OK = 0,
+    WS_ERR_ARGUMENT = -1,     /* null pointer, bad length or out of range id */
+    WS_ERR_NOT_LOADED = -2,   /* no dictionary has been loaded */
+    WS_ERR_INVALID_WORD = -3, /* word contains characters other than a-z */
+    WS_ERR_BUFFER = -4        /* output buffer too small */
+} ws_status;
+
+typedef struct ws_engine ws_engine;
+typedef struct ws_env ws_env;
+
+/* Engine lifetime */
+WS_API ws_engine *ws_engine_create(void);
+WS_API void ws_engine_destroy(ws_engine *engine);
+
+/* Load n_words guess records and optional n_answers answer records.
+ * Answers missing from the guess list are appended to it.
+ * Builds the feedback table, which is O(n_words^2). */
+WS_API int ws_engine_load_dictionary(ws_engine *engine,
+                                     const char *words, size_t n_words,
+                                     const char *answers, size_t n_answers);
+
+/* Load the built-in lists, fast = 1 uses the answer list as guesses */
+WS_API int ws_engine_load_default(ws_engine *engine, int fast);
+
+/* Load word lists from text files with one word per line, a null path uses
+ * the built-in list. Returns WS_ERR_INVALID_WORD if a file cannot be read or
+ * holds anything other than 5 letter words. */
+WS_API int ws_engine_load_files(ws_engine *engine, const char *guesses_path, const char *answers_path, int fast);
+
+WS_API size_t ws_engine_word_count(const ws_engine *engine);
+WS_API size_t ws_engine_answer_count(const ws_engine *engine);
+
+/* Copy answer word ids into out, returns the count or a negative ws_status */
+WS_API int64_t ws_engine_answers(const ws_engine *engine, uint32_t *out, size_t capacity);
+
+/* Id of a 5 byte word record, or a negative ws_status if it is not in the list */
+WS_API int64_t ws_engine_word_id(const ws_engine *engine, const char *word);
+
+/* Copy the 5 byte record of a word id into out */
+WS_API int ws_engine_word(const ws_engine *engine, uint32_t id, char *out);
+
+/* Feedback pattern of guess against solution, or a negative ws_status */
+WS_API int ws_feedback(const ws_engine *engine, uint32_t guess, uint32_t solution);
+
+/* Borrowed pointer to the cached feedback row of guess, indexed by solution id.
+ * Valid until the dictionary is reloaded. */
+WS_API const uint8_t *ws_feedback_row(const ws_engine *engine, uint32_t guess);
+
+/* Encode a "GYB" string to a pattern, or a negative ws_status */
+WS_API int ws_pattern_encode(const char *feedback);
+
+/* Keep candidates consistent with guess giving pattern. out may alias candidates.
+ * Returns the number written or a negative ws_status. */
+WS_API int64_t ws_filter(const ws_engine *engine,
+                         const uint32_t *candidates, size_t n_candidates,
+                         uint32_t guess, uint8_t pattern,
+                         uint32_t *out);
+
+/* Single step entropy (bits) of each guess over the candidate set */
+WS_API int ws_score(const ws_engine *engine,
+                    const uint32_t *guesses, size_t n_guesses,
+                    const uint32_t *candidates, size_t n_candidates,
+                    double *out_scores);
+
+/* Pattern histogram of guess over the candidates, out must hold WS_PATTERN_COUNT */
+WS_API int ws_histogram(const ws_engine *engine, uint32_t guess,
+                        const uint32_t *candidates, size_t n_candidates,
+                        uint32_t *out_counts);
+
+/* Word ids matching every given constraint, null strings are ignored. Strings are
+ * UTF-8 in the alphabet of the loaded lists:
+ *   pattern  letters and '?' wildcards, one per position, e.g. "a?e??"
+ *   contains letters that must appear, "ee" requires two copies of e
+ *   excludes letters that must not appear
+ *   not_at   comma separated patterns whose letters must not be at their positions,
+ *            e.g. "?r???" rules out r in position 2
+ * Ids are written to out in ascending order, out may be null to only count.
+ * Returns the number of matches or a negative ws_status. */
+WS_API int64_t ws_query(const ws_engine *engine,
+                        const char *pattern, const char *contains, const char *excludes, const char *not_at,
+                        uint32_t *out, size_t capacity);
+
+/* Batched game environment for self-play: n_envs concurrent games, each against an
+ * answer drawn at random from the engine's answers. The env borrows the engine, which
+ * must outlive it and must not be reloaded while it exists. All memory is allocated
+ * up front, reset and step write into caller-provided contiguous buffers.
+ *
+ * Observations are WS_OBSERVATION_SIZE floats per game describing its candidate set:
+ *   [p * 26 + c]   fraction of candidates with letter c at position p
+ *   [130 + c]      fraction of candidates containing letter c
+ *   [156]          log2 of the candidate count over 16
+ * Every guess is rewarded -1, a game is done once solved or after max_turns guesses.
+ * Returns null if the engine is not loaded or n_envs is 0. */
+WS_API ws_env *ws_env_create(const ws_engine *engine, size_t n_envs, int max_turns, uint64_t seed);
+WS_API void ws_env_destroy(ws_env *env);
+
+WS_API size_t ws_env_count(const ws_env *env);
+
+/* Start new games in the envs where mask is non-zero, every env if mask is null,
+ * e.g. pass the dones of the last step. observations may be null, otherwise it holds
+ * n_envs * WS_OBSERVATION_SIZE floats and the rows of reset envs are written. */
+WS_API int ws_env_reset(ws_env *env, const uint8_t *mask, float *observations);
+
+/* Play one guess id in every env. Envs already done ignore their guess and get a
+ * reward of 0. rewards and dones hold n_envs values, observations (n_envs rows) and
+ * patterns (n_envs feedback patterns) may be null. Envs already done repeat the last
+ * pattern of their game. Nothing is changed if any guess id is out of range. */
+WS_API int ws_env_step(ws_env *env, const uint32_t *guesses,
+                       float *rewards, uint8_t *dones,
+                       float *observations, uint8_t *patterns);
+
+/* Copy the remaining candidate ids of one env into out, returns the count or a
+ * negative ws_status */
+WS_API int64_t ws_env_candidates(const ws_env *env, size_t index, uint32_t *out, size_t capacity);
+
+WS_API const char *ws_status_string(int status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WORDLE_SOLVED_WORDLE_SOLVED_H */
@@ -0,0 +1,378 @@
+//
+// Created by connor on 18/10/2026.
+//
+
+#include "wordle_solved.h"
+#include "Engine.h"
+#include "Entropy.h"
+#include "Dictionary.h"
+#include "StateFeatures.h"
+#include "WordQuery.h"
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+struct ws_engine {
+    Engine engine{true};
+    Feedback &feedback = engine.get_feedback();
+    Entropy entropy{feedback};
+    Alphabet alphabet;
+    std::vector<uint32_t> answers;
+    bool loaded = false;
+};
+
+// Candidates of every game live in one pool, game i owning the n_answers slots from
+// i * n_answers, and are filtered in place so stepping never allocates
+struct ws_env {
+    const ws_engine *engine;
+    size_t n_envs;
+    size_t n_answers;
+    int max_turns;
+    std::vector<uint32_t> pool;
+    std::vector<uint32_t> counts;
+    std::vector<uint32_t> answers;
+    std::vector<uint8_t> turns;
+    std::vector<uint8_t> done;
+    std::vector<uint8_t> patterns;
+    std::vector<float> initial;
+    std::mt19937_64 rng;
+};
+
+static_assert(WS_OBSERVATION_SIZE == BasicStateFeatures<WS_WORD_LENGTH>::kSize,
+              "WS_OBSERVATION_SIZE must match the state features");
+
+namespace {
+    bool valid_record(const char *record) {
+        for (size_t i = 0; i < WS_WORD_LENGTH; ++i)
+            if (record[i] < 'a' || record[i] > 'z') return false;
+        return true;
+    }
+
+    // Records are symbols of alphabet, which queries are encoded with
+    int load(ws_engine *engine, std::vector<std::string> words, const std::vector<std::string> &answers,
+             const Alphabet &alphabet) {
+        std::unordered_set<std::string> seen(words.begin(), words.end());
+        for (const auto &a : answers)
+            if (seen.insert(a).second) words.push_back(a);
+
+        engine->engine.load(std::move(words), answers);
+        engine->alphabet = alphabet;
+
+        engine->answers.clear();
+        for (const auto &a : answers)
+            engine->answers.push_back(static_cast<uint32_t>(engine->feedback.index_of(a)));
+
+        engine->loaded = true;
+        return WS_OK;
+    }
+
+    bool ready(const ws_engine *engine) {
+        return engine && engine->loaded;
+    }
+
+    void observe(const ws_env *env, size_t i, float *out) {
+        const uint32_t *candidates = env->pool.data() + i * env->n_answers;
+        const auto &words = env->engine->feedback.get_words();
+        std::fill(out, out + WS_OBSERVATION_SIZE, 0.0f);
+        for (uint32_t c = 0; c < env->counts[i]; ++c)
+            BasicStateFeatures<WS_WORD_LENGTH>::add(words[candidates[c]], out);
+        BasicStateFeatures<WS_WORD_LENGTH>::finish(out, env->counts[i]);
+    }
+
+    void restart(ws_env *env, size_t i) {
+        std::uniform_int_distribution<size_t> pick(0, env->n_answers - 1);
+        std::copy(env->engine->answers.begin(), env->engine->answers.end(), env->pool.begin() + i * env->n_answers);
+        env->counts[i] = static_cast<uint32_t>(env->n_answers);
+        env->answers[i] = env->engine->answers[pick(env->rng)];
+        env->turns[i] = 0;
+        env->done[i] = 0;
+    }
+}
+
+extern "C" {
+
+ws_engine *ws_engine_create(void) {
+    return new ws_engine();
+}
+
+void ws_engine_destroy(ws_engine *engine) {
+    delete engine;
+}
+
+int ws_engine_load_dictionary(ws_engine *engine,
+                              const char *words, size_t n_words,
+                              const char *answers, size_t n_answers) {
+    if (!engine || (!words && n_words > 0) || (!answers && n_answers > 0) || n_words + n_answers == 0)
+        return WS_ERR_ARGUMENT;
+
+    std::vector<std::string> word_list, answer_list;
+    word_list.reserve(n_words);
+    answer_list.reserve(n_answers);
+
+    for (size_t i = 0; i < n_words; ++i) {
+        const char *record = words + i * WS_WORD_LENGTH;
+        if (!valid_record(record)) return WS_ERR_INVALID_WORD;
+        word_list.emplace_back(record, WS_WORD_LENGTH);
+    }
+    for (size_t i = 0; i < n_answers; ++i) {
+        const char *record = answers + i * WS_WORD_LENGTH;
+        if (!valid_record(record)) return WS_ERR_INVALID_WORD;
+        answer_list.emplace_back(record, WS_WORD_LENGTH);
+    }
+
+    return load(engine, std::move(word_list), answer_list, Alphabet());
+}
+
+int ws_engine_load_default(ws_engine *engine, int fast) {
+    if (!engine) return WS_ERR_ARGUMENT;
+    Dictionary dictionary;
+    dictionary.load_builtin(fast != 0);
+    return load(engine, dictionary.guess_words(), dictionary.answer_words(), dictionary.get_alphabet());
+}
+
+int ws_engine_load_files(ws_engine *engine, const char *guesses_path, const char *answers_path, int fast) {
+    if (!engine) return WS_ERR_ARGUMENT;
+    Dictionary dictionary;
+    std::string error;
+    if (!dictionary.load(guesses_path ? guesses_path : "", answers_path ? answers_path : "", fast != 0, error) ||
+        dictionary.get_word_length() != WS_WORD_LENGTH)
+        return WS_ERR_INVALID_WORD;
+    return load(engine, dictionary.guess_words(), dictionary.answer_words(), dictionary.get_alphabet());
+}
+
+size_t ws_engine_word_count(const ws_engine *engine) {
+    return ready(engine) ? engine->feedback.size() : 0;
+}
+
+size_t ws_engine_answer_count(const ws_engine *engine) {
+    return ready(engine) ? engine->answers.size() : 0;
+}
+
+int64_t ws_engine_answers(const ws_engine *engine, uint32_t *out, size_t capacity) {
+    if (!ready(engine)) return WS_ERR_NOT_LOADED;
+    if (!out) return WS_ERR_ARGUMENT;
+    if (capacity < engine->answers.size()) return WS_ERR_BUFFER;
+    std::copy(engine->answers.begin(), engine->answers.end(), out);
+    return static_cast<int64_t>(engine->answers.size());
+}
+
+int64_t ws_engine_word_id(const ws_engine *engine, const char *word) {
+    if (!ready(engine)) return WS_ERR_NOT_LOADED;
+    if (!word) return WS_ERR_ARGUMENT;
+    long idx = engine->feedback.index_of(std::string(word, WS_WORD_LENGTH));
+    return idx < 0 ? static_cast<int64_t>(WS_ERR_INVALID_WORD) : idx;
+}
+
+int ws_engine_word(const ws_engine *engine, uint32_t id, char *out) {
+    if (!ready(engine)) return WS_ERR_NOT_LOADED;
+    if (!out || id >= engine->feedback.size()) return WS_ERR_ARGUMENT;
+    std::memcpy(out, engine->feedback.get_words()[id].data(), WS_WORD_LENGTH);
+    return WS_OK;
+}
+
+int ws_feedback(const ws_engine *engine, uint32_t guess, uint32_t solution) {
+    if (!ready(engine)) return WS_ERR_NOT_LOADED;
+    size_t n = engine->feedback.size();
+    if (guess >= n || solution >= n) return WS_ERR_ARGUMENT;
+    return engine->feedback.get_feedback_index(guess, solution);
+}
+
+const uint8_t *ws_feedback_row(const ws_engine *engine, uint32_t guess) {
+    if (!ready(engine) || guess >= engine->feedback.size()) return nullptr;
+    return engine->feedback.row(guess);
+}
+
+int ws_pattern_encode(const char *feedback) {
+    if (!feedback) return WS_ERR_ARGUMENT;
+    int pattern = 0;
+    for (size_t i = 0; i < WS_WORD_LENGTH; ++i) {
+        int code;
+        switch (feedback[i]) {
+            case 'G': case 'g': code = 2; break;
+            case 'Y': case 'y': code = 1; break;
+            case 'B': case 'b': code = 0; break;
+            default: return WS_ERR_ARGUMENT;
+        }
+        pattern = pattern * 3 + code;
+    }
+    return pattern;
+}
+
+int64_t ws_filter(const ws_engine *engine,
+                  const uint32_t *candidates, size_t n_candidates,
+                  uint32_t guess, uint8_t pattern,
+                  uint32_t *out) {
+    if (!ready(engine)) return WS_ERR_NOT_LOADED;
+    size_t n = engine->feedback.size();
+    if ((!candidates || !out) && n_candidates > 0) return WS_ERR_ARGUMENT;
+    if (guess >= n || pattern >= WS_PATTERN_COUNT) return WS_ERR_ARGUMENT;
+
+    const uint8_t *row = engine->feedback.row(guess);
+    size_t kept = 0;
+    for (size_t i = 0; i < n_candidates; ++i) {
+        uint32_t c = candidates[i];
+        if (c >= n) return WS_ERR_ARGUMENT;
+        if (row[c] == pattern) out[kept++] = c;
+    }
+    return static_cast<int64_t>(kept);
+}
+
+int ws_score(const ws_engine *engine,
+             const uint32_t *guesses, size_t n_guesses,
+             const uint32_t *candidates, size_t n_candidates,
+             double *out_scores) {
+    if (!ready(engine)) return WS_ERR_NOT_LOADED;
+    if ((!guesses || !out_scores) && n_guesses > 0) return WS_ERR_ARGUMENT;
+    if (!candidates && n_candidates > 0) return WS_ERR_ARGUMENT;
+
+    size_t n = engine->feedback.size();
+    for (size_t i = 0; i < n_guesses; ++i)
+        if (guesses[i] >= n) return WS_ERR_ARGUMENT;
+    for (size_t i = 0; i < n_candidates; ++i)
+        if (candidates[i] >= n) return WS_ERR_ARGUMENT;
+
+    engine->entropy.get_entropy_indices(guesses, n_guesses, candidates, n_candidates, out_scores);
+    return WS_OK;
+}
+
+int ws_histogram(const ws_engine *engine, uint32_t guess,
+                 const uint32_t *candidates, size_t n_candidates,
+                 uint32_t *out_counts) {
+    if (!ready(engine)) return WS_ERR_NOT_LOADED;
+    size_t n = engine->feedback.size();
+    if (!out_counts || (!candidates && n_candidates > 0) || guess >= n) return WS_ERR_ARGUMENT;
+
+    std::fill(out_counts, out_counts + WS_PATTERN_COUNT, 0u);
+    const uint8_t *row = engine->feedback.row(guess);
+    for (size_t i = 0; i < n_candidates; ++i) {
+        if (candidates[i] >= n) return WS_ERR_ARGUMENT;
+        out_counts[row[candidates[i]]]++;
+    }
+    return WS_OK;
+}
+
+int64_t ws_query(const ws_engine *engine,
+                 const char *pattern, const char *contains, const char *excludes, const char *not_at,
+                 uint32_t *out, size_t capacity) {
+    if (!ready(engine)) return WS_ERR_NOT_LOADED;
+
+    const Alphabet &alphabet = engine->alphabet;
+    WordQuery query(WS_WORD_LENGTH);
+    if ((pattern && !query.set_pattern(alphabet, pattern)) ||
+        (contains && !query.add_contains(alphabet, contains)) ||
+        (excludes && !query.add_excludes(alphabet, excludes)) ||
+        (not_at && !query.add_not_at(alphabet, not_at)))
+        return WS_ERR_ARGUMENT;
+
+    LetterIndex::Bits bits = query.match(engine->feedback.get_letter_index());
+    size_t matches = LetterIndex::count(bits);
+    if (out) {
+        if (capacity < matches) return WS_ERR_BUFFER;
+        std::vector<uint32_t> ids = LetterIndex::indices(bits);
+        std::copy(ids.begin(), ids.end(), out);
+    }
+    return static_cast<int64_t>(matches);
+}
+
+ws_env *ws_env_create(const ws_engine *engine, size_t n_envs, int max_turns, uint64_t seed) {
+    if (!ready(engine) || engine->answers.empty() || n_envs == 0) return nullptr;
+
+    auto *env = new ws_env();
+    env->engine = engine;
+    env->n_envs = n_envs;
+    env->n_answers = engine->answers.size();
+    env->max_turns = std::clamp(max_turns, 1, 255);
+    env->pool.resize(n_envs * env->n_answers);
+    env->counts.resize(n_envs);
+    env->answers.resize(n_envs);
+    env->turns.resize(n_envs);
+    env->done.resize(n_envs);
+    env->patterns.resize(n_envs);
+    env->rng.seed(seed);
+
+    // Every game starts from the full answer set, so its observation is computed once
+    for (size_t i = 0; i < n_envs; ++i) restart(env, i);
+    env->initial.resize(WS_OBSERVATION_SIZE);
+    observe(env, 0, env->initial.data());
+    return env;
+}
+
+void ws_env_destroy(ws_env *env) {
+    delete env;
+}
+
+size_t ws_env_count(const ws_env *env) {
+    return env ? env->n_envs : 0;
+}
+
+int ws_env_reset(ws_env *env, const uint8_t *mask, float *observations) {
+    if (!env) return WS_ERR_ARGUMENT;
+    for (size_t i = 0; i < env->n_envs; ++i) {
+        if (mask && !mask[i]) continue;
+        restart(env, i);
+        if (observations)
+            std::copy(env->initial.begin(), env->initial.end(), observations + i * WS_OBSERVATION_SIZE);
+    }
+    return WS_OK;
+}
+
+int ws_env_step(ws_env *env, const uint32_t *guesses,
+                float *rewards, uint8_t *dones,
+                float *observations, uint8_t *patterns) {
+    if (!env || !guesses || !rewards || !dones) return WS_ERR_ARGUMENT;
+    const auto &feedback = env->engine->feedback;
+    size_t n = feedback.size();
+    for (size_t i = 0; i < env->n_envs; ++i)
+        if (!env->done[i] && guesses[i] >= n) return WS_ERR_ARGUMENT;
+
+    const uint8_t solved = static_cast<uint8_t>(WS_PATTERN_COUNT - 1);
+    for (size_t i = 0; i < env->n_envs; ++i) {
+        uint8_t &pattern = env->patterns[i];
+        if (env->done[i]) {
+            rewards[i] = 0.0f;
+        } else {
+            const uint8_t *row = feedback.row(guesses[i]);
+            pattern = row[env->answers[i]];
+
+            uint32_t *candidates = env->pool.data() + i * env->n_answers;
+            uint32_t kept = 0;
+            for (uint32_t c = 0; c < env->counts[i]; ++c)
+                if (row[candidates[c]] == pattern) candidates[kept++] = candidates[c];
+            env->counts[i] = kept;
+
+            env->turns[i]++;
+            env->done[i] = pattern == solved || env->turns[i] >= env->max_turns;
+            rewards[i] = -1.0f;
+        }
+        dones[i] = env->done[i];
+        if (patterns) patterns[i] = pattern;
+        if (observations) observe(env, i, observations + i * WS_OBSERVATION_SIZE);
+    }
+    return WS_OK;
+}
+
+int64_t ws_env_candidates(const ws_env *env, size_t index, uint32_t *out, size_t capacity) {
+    if (!env || index >= env->n_envs) return WS_ERR_ARGUMENT;
+    size_t count = env->counts[index];
+    if (!out) return WS_ERR_ARGUMENT;
+    if (capacity < count) return WS_ERR_BUFFER;
+    const uint32_t *candidates = env->pool.data() + index * env->n_answers;
+    std::copy(candidates, candidates + count, out);
+    return static_cast<int64_t>(count);
+}
+
+const char *ws_status_string(int status) {
+    switch (status) {
+        case WS_OK: return "ok";
+        case WS_ERR_ARGUMENT: return "invalid argument";
+        case WS_ERR_NOT_LOADED: return "no dictionary loaded";
+        case WS_ERR_INVALID_WORD: return "invalid word";
+        case WS_ERR_BUFFER: return "buffer too small";
+        default: return "unknown status";
+    }
+}
+
+}
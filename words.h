@@ -1,17195 +1,17189 @@
 #ifndef WORDS_H
 #define WORDS_H
 
-#include <string>
-#include <vector>
+#include <cstddef>
 
-const char* ALL_WORDS[] = {
-    "aahed",
-    "aalii",
-    "aapas",
-    "aargh",
-    "aarti",
-    "abaca",
-    "abaci",
-    "aback",
-    "abacs",
-    "abaft",
-    "abaht",
-    "abaka",
-    "abamp",
-    "aband",
-    "abase",
-    "abash",
-    "abask",
-    "abate",
-    "abaya",
-    "abbas",
-    "abbed",
-    "abbes",
-    "abbey",
-    "abbot",
-    "abcee",
-    "abeam",
-    "abear",
-    "abeat",
-    "abeer",
-    "abele",
-    "abeng",
-    "abers",
-    "abets",
-    "abeys",
-    "abhor",
-    "abide",
-    "abies",
-    "abius",
-    "abjad",
-    "abjud",
-    "abled",
-    "abler",
-    "ables",
-    "ablet",
-    "ablow",
-    "abmho",
-    "abnet",
-    "abode",
-    "abohm",
-    "aboil",
-    "aboma",
-    "aboon",
-    "abord",
-    "abore",
-    "aborn",
-    "abort",
-    "about",
-    "above",
-    "abram",
-    "abray",
-    "abrim",
-    "abrin",
-    "abris",
-    "absey",
-    "absit",
-    "abuna",
-    "abune",
-    "abura",
-    "aburn",
-    "abuse",
-    "abuts",
-    "abuzz",
-    "abyes",
-    "abysm",
-    "abyss",
-    "acais",
-    "acara",
-    "acari",
-    "accas",
-    "accha",
-    "accoy",
-    "accra",
-    "acedy",
-    "acene",
-    "acerb",
-    "acers",
-    "aceta",
-    "achar",
-    "ached",
-    "acher",
-    "aches",
-    "achey",
-    "achoo",
-    "acids",
-    "acidy",
-    "acies",
-    "acing",
-    "acini",
-    "ackee",
-    "acker",
-    "acmes",
-    "acmic",
-    "acned",
-    "acnes",
-    "acock",
-    "acoel",
-    "acold",
-    "acone",
-    "acorn",
-    "acral",
-    "acred",
-    "acres",
-    "acrid",
-    "acron",
-    "acros",
-    "acryl",
-    "actas",
-    "acted",
-    "actin",
-    "acton",
-    "actor",
-    "actus",
-    "acute",
-    "acyls",
-    "adage",
-    "adapt",
-    "adats",
-    "adawn",
-    "adaws",
-    "adays",
-    "adbot",
-    "addas",
-    "addax",
-    "added",
-    "adder",
-    "addin",
-    "addio",
-    "addle",
-    "addra",
-    "adead",
-    "adeem",
-    "adept",
-    "adhan",
-    "adhoc",
-    "adieu",
-    "adios",
-    "adits",
-    "adlib",
-    "adman",
-    "admen",
-    "admin",
-    "admit",
-    "admix",
-    "adnex",
-    "adobe",
-    "adobo",
-    "adoon",
-    "adopt",
-    "adorb",
-    "adore",
-    "adorn",
-    "adown",
-    "adoze",
-    "adrad",
-    "adraw",
-    "adred",
-    "adret",
-    "adrip",
-    "adsum",
-    "aduki",
-    "adult",
-    "adunc",
-    "adust",
-    "advew",
-    "advts",
-    "adyta",
-    "adyts",
-    "adzed",
-    "adzes",
-    "aecia",
-    "aedes",
-    "aeger",
-    "aegis",
-    "aeons",
-    "aerie",
-    "aeros",
-    "aesir",
-    "aevum",
-    "afald",
-    "afanc",
-    "afara",
-    "afars",
-    "afear",
-    "affix",
-    "affly",
-    "afion",
-    "afire",
-    "afizz",
-    "aflaj",
-    "aflap",
-    "aflow",
-    "afoam",
-    "afoot",
-    "afore",
-    "afoul",
-    "afret",
-    "afrit",
-    "afros",
-    "after",
-    "aftos",
-    "again",
-    "agals",
-    "agama",
-    "agami",
-    "agamy",
-    "agape",
-    "agars",
-    "agasp",
-    "agast",
-    "agate",
-    "agaty",
-    "agave",
-    "agaze",
-    "agbas",
-    "agene",
-    "agent",
-    "agers",
-    "aggag",
-    "agger",
-    "aggie",
-    "aggri",
-    "aggro",
-    "aggry",
-    "aghas",
-    "agidi",
-    "agila",
-    "agile",
-    "aging",
-    "agios",
-    "agism",
-    "agist",
-    "agita",
-    "aglee",
-    "aglet",
-    "agley",
-    "agloo",
-    "aglow",
-    "aglus",
-    "agmas",
-    "agoge",
-    "agogo",
-    "agone",
-    "agons",
-    "agony",
-    "agood",
-    "agora",
-    "agree",
-    "agria",
-    "agrin",
-    "agros",
-    "agrum",
-    "agued",
-    "agues",
-    "aguey",
-    "aguna",
-    "agush",
-    "aguti",
-    "ahead",
-    "aheap",
-    "ahent",
-    "ahigh",
-    "ahind",
-    "ahing",
-    "ahint",
-    "ahold",
-    "ahole",
-    "ahull",
-    "ahuru",
-    "aidas",
-    "aided",
-    "aider",
-    "aides",
-    "aidoi",
-    "aidos",
-    "aiery",
-    "aigas",
-    "aight",
-    "ailed",
-    "aimag",
-    "aimak",
-    "aimed",
-    "aimer",
-    "ainee",
-    "ainga",
-    "aioli",
-    "aired",
-    "airer",
-    "airns",
-    "airth",
-    "airts",
-    "aisle",
-    "aitch",
-    "aitus",
-    "aiver",
-    "aixes",
-    "aiyah",
-    "aiyee",
-    "aiyoh",
-    "aiyoo",
-    "aizle",
-    "ajies",
-    "ajiva",
-    "ajuga",
-    "ajupa",
-    "ajwan",
-    "akara",
-    "akees",
-    "akela",
-    "akene",
-    "aking",
-    "akita",
-    "akkas",
-    "akker",
-    "akoia",
-    "akoja",
-    "akoya",
-    "aksed",
-    "akses",
-    "alaap",
-    "alack",
-    "alala",
-    "alamo",
-    "aland",
-    "alane",
-    "alang",
-    "alans",
-    "alant",
-    "alapa",
-    "alaps",
-    "alarm",
-    "alary",
-    "alata",
-    "alate",
-    "alays",
-    "albas",
-    "albee",
-    "albid",
-    "album",
-    "alcea",
-    "alces",
-    "alcid",
-    "alcos",
-    "aldea",
-    "alder",
-    "aldol",
-    "aleak",
-    "aleck",
-    "alecs",
-    "aleem",
-    "alefs",
-    "aleft",
-    "aleph",
-    "alert",
-    "alews",
-    "aleye",
-    "alfas",
-    "algae",
-    "algal",
-    "algas",
-    "algid",
-    "algin",
-    "algor",
-    "algos",
-    "algum",
-    "alias",
-    "alibi",
-    "alick",
-    "alien",
-    "alifs",
-    "align",
-    "alike",
-    "alims",
-    "aline",
-    "alios",
-    "alist",
-    "alive",
-    "aliya",
-    "alkie",
-    "alkin",
-    "alkos",
-    "alkyd",
-    "alkyl",
-    "allan",
-    "allay",
-    "allee",
-    "allel",
-    "allen",
-    "aller",
-    "alley",
-    "allin",
-    "allis",
-    "allod",
-    "allot",
-    "allow",
-    "alloy",
-    "allus",
-    "allyl",
-    "almah",
-    "almas",
-    "almeh",
-    "almes",
-    "almud",
-    "almug",
-    "alods",
-    "aloed",
-    "aloes",
-    "aloft",
-    "aloha",
-    "aloin",
-    "alone",
-    "along",
-    "aloof",
-    "aloos",
-    "alose",
-    "aloud",
-    "alowe",
-    "alpha",
-    "altar",
-    "alter",
-    "altho",
-    "altos",
-    "alula",
-    "alums",
-    "alumy",
-    "alure",
-    "alurk",
-    "alvar",
-    "alway",
-    "amahs",
-    "amain",
-    "amari",
-    "amaro",
-    "amass",
-    "amate",
-    "amaut",
-    "amaze",
-    "amban",
-    "amber",
-    "ambit",
-    "amble",
-    "ambos",
-    "ambry",
-    "ameba",
-    "ameer",
-    "amend",
-    "amene",
-    "amens",
-    "ament",
-    "amias",
-    "amice",
-    "amici",
-    "amide",
-    "amido",
-    "amids",
-    "amies",
-    "amiga",
-    "amigo",
-    "amine",
-    "amino",
-    "amins",
-    "amirs",
-    "amiss",
-    "amity",
-    "amlas",
-    "amman",
-    "ammas",
-    "ammon",
-    "ammos",
-    "amnia",
-    "amnic",
-    "amnio",
-    "amoks",
-    "amole",
-    "among",
-    "amore",
-    "amort",
-    "amour",
-    "amove",
-    "amowt",
-    "amped",
-    "ample",
-    "amply",
-    "ampul",
-    "amrit",
-    "amuck",
-    "amuse",
-    "amyls",
-    "anana",
-    "anata",
-    "ancho",
-    "ancle",
-    "ancon",
-    "andic",
-    "andro",
-    "anear",
-    "anele",
-    "anent",
-    "angas",
-    "angel",
-    "anger",
-    "angle",
-    "anglo",
-    "angry",
-    "angst",
-    "anigh",
-    "anile",
-    "anils",
-    "anima",
-    "anime",
-    "animi",
-    "anion",
-    "anise",
-    "anker",
-    "ankhs",
-    "ankle",
-    "ankus",
-    "anlas",
-    "annal",
-    "annan",
-    "annas",
-    "annat",
-    "annex",
-    "annoy",
-    "annul",
-    "annum",
-    "annus",
-    "anoas",
-    "anode",
-    "anole",
-    "anomy",
-    "ansae",
-    "ansas",
-    "antae",
-    "antar",
-    "antas",
-    "anted",
-    "antes",
-    "antic",
-    "antis",
-    "antra",
-    "antre",
-    "antsy",
-    "anura",
-    "anvil",
-    "anyon",
-    "aorta",
-    "apace",
-    "apage",
-    "apaid",
-    "apart",
-    "apayd",
-    "apays",
-    "apeak",
-    "apeek",
-    "apers",
-    "apert",
-    "apery",
-    "apgar",
-    "aphid",
-    "aphis",
-    "apian",
-    "aping",
-    "apiol",
-    "apish",
-    "apism",
-    "apnea",
-    "apode",
-    "apods",
-    "apols",
-    "apoop",
-    "aport",
-    "appal",
-    "appam",
-    "appay",
-    "appel",
-    "apple",
-    "apply",
-    "appro",
-    "appts",
-    "appui",
-    "appuy",
-    "apres",
-    "apron",
-    "apses",
-    "apsis",
-    "apsos",
-    "apted",
-    "apter",
-    "aptly",
-    "aquae",
-    "aquas",
-    "araba",
-    "araks",
-    "arame",
-    "arars",
-    "arbah",
-    "arbas",
-    "arbor",
-    "arced",
-    "archi",
-    "arcos",
-    "arcus",
-    "ardeb",
-    "ardor",
-    "ardri",
-    "aread",
-    "areae",
-    "areal",
-    "arear",
-    "areas",
-    "areca",
-    "aredd",
-    "arede",
-    "arefy",
-    "areic",
-    "arena",
-    "arene",
-    "arepa",
-    "arere",
-    "arete",
-    "arets",
-    "arett",
-    "argal",
-    "argan",
-    "argil",
-    "argle",
-    "argol",
-    "argon",
-    "argot",
-    "argue",
-    "argus",
-    "arhat",
-    "arias",
-    "ariel",
-    "ariki",
-    "arils",
-    "ariot",
-    "arise",
-    "arish",
-    "arith",
-    "arked",
-    "arled",
-    "arles",
-    "armed",
-    "armer",
-    "armet",
-    "armil",
-    "armor",
-    "arnas",
-    "arnis",
-    "arnut",
-    "aroba",
-    "aroha",
-    "aroid",
-    "aroma",
-    "arose",
-    "arpas",
-    "arpen",
-    "arrah",
-    "arras",
-    "array",
-    "arret",
-    "arris",
-    "arrow",
-    "arroz",
-    "arsed",
-    "arses",
-    "arsey",
-    "arsis",
-    "arson",
-    "artal",
-    "artel",
-    "arter",
-    "artic",
-    "artis",
-    "artly",
-    "artsy",
-    "aruhe",
-    "arums",
-    "arval",
-    "arvee",
-    "arvos",
-    "aryls",
-    "asada",
-    "asana",
-    "ascon",
-    "ascot",
-    "ascus",
-    "asdic",
-    "ashed",
-    "ashen",
-    "ashes",
-    "ashet",
-    "aside",
-    "asity",
-    "askar",
-    "asked",
-    "asker",
-    "askew",
-    "askoi",
-    "askos",
-    "aspen",
-    "asper",
-    "aspic",
-    "aspie",
-    "aspis",
-    "aspro",
-    "assai",
-    "assam",
-    "assay",
-    "assed",
-    "asses",
-    "asset",
-    "assez",
-    "assot",
-    "aster",
-    "astir",
-    "astun",
-    "asura",
-    "asway",
-    "aswim",
-    "asyla",
-    "ataps",
-    "ataxy",
-    "atigi",
-    "atilt",
-    "atimy",
-    "atlas",
-    "atman",
-    "atmas",
-    "atmos",
-    "atocs",
-    "atoke",
-    "atoks",
-    "atoll",
-    "atoms",
-    "atomy",
-    "atone",
-    "atony",
-    "atopy",
-    "atria",
-    "atrip",
-    "attap",
-    "attar",
-    "attas",
-    "atter",
-    "attic",
-    "atuas",
-    "aucht",
-    "audad",
-    "audax",
-    "audio",
-    "audit",
-    "augen",
-    "auger",
-    "auges",
-    "aught",
-    "augur",
-    "aulas",
-    "aulic",
-    "auloi",
-    "aulos",
-    "aumil",
-    "aunes",
-    "aunts",
-    "aunty",
-    "aurae",
-    "aural",
-    "aurar",
-    "auras",
-    "aurei",
-    "aures",
-    "auric",
-    "auris",
-    "aurum",
-    "autos",
-    "auxin",
-    "avail",
-    "avale",
-    "avant",
-    "avast",
-    "avels",
-    "avens",
-    "avers",
-    "avert",
-    "avgas",
-    "avian",
-    "avine",
-    "avion",
-    "avise",
-    "aviso",
-    "avize",
-    "avoid",
-    "avows",
-    "avyze",
-    "await",
-    "awake",
-    "award",
-    "aware",
-    "awari",
-    "awarn",
-    "awash",
-    "awato",
-    "awave",
-    "aways",
-    "awdls",
-    "aweel",
-    "aweto",
-    "awful",
-    "awing",
-    "awkin",
-    "awmry",
-    "awned",
-    "awner",
-    "awoke",
-    "awols",
-    "awork",
-    "axels",
-    "axial",
-    "axile",
-    "axils",
-    "axing",
-    "axiom",
-    "axion",
-    "axite",
-    "axled",
-    "axles",
-    "axman",
-    "axmen",
-    "axoid",
-    "axone",
-    "axons",
-    "ayahs",
-    "ayaya",
-    "ayelp",
-    "aygre",
-    "ayins",
-    "aymag",
-    "ayont",
-    "ayres",
-    "ayrie",
-    "azans",
-    "azide",
-    "azido",
-    "azine",
-    "azlon",
-    "azoic",
-    "azole",
-    "azons",
-    "azote",
-    "azoth",
-    "azuki",
-    "azure",
-    "azurn",
-    "azury",
-    "azygy",
-    "azyme",
-    "azyms",
-    "baaed",
-    "baals",
-    "baaps",
-    "babas",
-    "babby",
-    "babel",
-    "babes",
-    "babka",
-    "baboo",
-    "babul",
-    "babus",
-    "bacca",
-    "bacco",
-    "baccy",
-    "bacha",
-    "bachs",
-    "backs",
-    "backy",
-    "bacne",
-    "bacon",
-    "badam",
-    "baddy",
-    "badge",
-    "badly",
-    "baels",
-    "baffs",
-    "baffy",
-    "bafta",
-    "bafts",
-    "bagel",
-    "baggy",
-    "baghs",
-    "bagie",
-    "bagsy",
-    "bagua",
-    "bahts",
-    "bahus",
-    "bahut",
-    "baiks",
-    "baile",
-    "bails",
-    "bairn",
-    "baisa",
-    "baith",
-    "baits",
-    "baiza",
-    "baize",
-    "bajan",
-    "bajra",
-    "bajri",
-    "bajus",
-    "baked",
-    "baken",
-    "baker",
-    "bakes",
-    "bakra",
-    "balas",
-    "balds",
-    "baldy",
-    "baled",
-    "baler",
-    "bales",
-    "balks",
-    "balky",
-    "ballo",
-    "balls",
-    "bally",
-    "balms",
-    "balmy",
-    "baloi",
-    "balon",
-    "baloo",
-    "balot",
-    "balsa",
-    "balti",
-    "balun",
-    "balus",
-    "balut",
-    "bamas",
-    "bambi",
-    "bamma",
-    "bammy",
-    "banak",
-    "banal",
-    "banco",
-    "bancs",
-    "banda",
-    "bandh",
-    "bands",
-    "bandy",
-    "baned",
-    "banes",
-    "bangs",
-    "bania",
-    "banjo",
-    "banks",
-    "banky",
-    "banns",
-    "bants",
-    "bantu",
-    "banty",
-    "bantz",
-    "banya",
-    "baons",
-    "baozi",
-    "bappu",
-    "bapus",
-    "barbe",
-    "barbs",
-    "barby",
-    "barca",
-    "barde",
-    "bardo",
-    "bards",
-    "bardy",
-    "bared",
-    "barer",
-    "bares",
-    "barfi",
-    "barfs",
-    "barfy",
-    "barge",
-    "baric",
-    "barks",
-    "barky",
-    "barms",
-    "barmy",
-    "barns",
-    "barny",
-    "baron",
-    "barps",
-    "barra",
-    "barre",
-    "barro",
-    "barry",
-    "barye",
-    "basal",
-    "basan",
-    "basas",
-    "based",
-    "basen",
-    "baser",
-    "bases",
-    "basha",
-    "basho",
-    "basic",
-    "basij",
-    "basil",
-    "basin",
-    "basis",
-    "basks",
-    "bason",
-    "basse",
-    "bassi",
-    "basso",
-    "bassy",
-    "basta",
-    "baste",
-    "basti",
-    "basto",
-    "basts",
-    "batch",
-    "bated",
-    "bates",
-    "bathe",
-    "baths",
-    "batik",
-    "baton",
-    "batos",
-    "batta",
-    "batts",
-    "battu",
-    "batty",
-    "bauds",
-    "bauks",
-    "baulk",
-    "baurs",
-    "bavin",
-    "bawds",
-    "bawdy",
-    "bawks",
-    "bawls",
-    "bawns",
-    "bawrs",
-    "bawty",
-    "bayas",
-    "bayed",
-    "bayer",
-    "bayes",
-    "bayle",
-    "bayou",
-    "bayts",
-    "bazar",
-    "bazas",
-    "bazoo",
-    "bball",
-    "bdays",
-    "beach",
-    "beads",
-    "beady",
-    "beaks",
-    "beaky",
-    "beals",
-    "beams",
-    "beamy",
-    "beano",
-    "beans",
-    "beany",
-    "beard",
-    "beare",
-    "bears",
-    "beast",
-    "beath",
-    "beats",
-    "beaty",
-    "beaus",
-    "beaut",
-    "beaux",
-    "bebop",
-    "becap",
-    "becke",
-    "becks",
-    "bedad",
-    "bedel",
-    "bedes",
-    "bedew",
-    "bedim",
-    "bedye",
-    "beech",
-    "beedi",
-    "beefs",
-    "beefy",
-    "beeps",
-    "beers",
-    "beery",
-    "beets",
-    "befit",
-    "befog",
-    "begad",
-    "began",
-    "begar",
-    "begat",
-    "begem",
-    "beget",
-    "begin",
-    "begob",
-    "begot",
-    "begum",
-    "begun",
-    "beige",
-    "beigy",
-    "being",
-    "beins",
-    "beira",
-    "beisa",
-    "bekah",
-    "belah",
-    "belar",
-    "belay",
-    "belch",
-    "belee",
-    "belga",
-    "belie",
-    "belit",
-    "belle",
-    "belli",
-    "bello",
-    "bells",
-    "belly",
-    "belon",
-    "below",
-    "belts",
-    "belve",
-    "bemad",
-    "bemas",
-    "bemix",
-    "bemud",
-    "bench",
-    "bends",
-    "bendy",
-    "benes",
-    "benet",
-    "benga",
-    "benis",
-    "benji",
-    "benne",
-    "benni",
-    "benny",
-    "bento",
-    "bents",
-    "benty",
-    "bepat",
-    "beray",
-    "beres",
-    "beret",
-    "bergs",
-    "berko",
-    "berks",
-    "berme",
-    "berms",
-    "berob",
-    "berry",
-    "berth",
-    "beryl",
-    "besat",
-    "besaw",
-    "besee",
-    "beses",
-    "beset",
-    "besit",
-    "besom",
-    "besot",
-    "besti",
-    "bests",
-    "betas",
-    "beted",
-    "betel",
-    "betes",
-    "beths",
-    "betid",
-    "beton",
-    "betta",
-    "betty",
-    "bevan",
-    "bevel",
-    "bever",
-    "bevor",
-    "bevue",
-    "bevvy",
-    "bewdy",
-    "bewet",
-    "bewig",
-    "bezel",
-    "bezes",
-    "bezil",
-    "bezzy",
-    "bhais",
-    "bhaji",
-    "bhang",
-    "bhats",
-    "bhava",
-    "bhels",
-    "bhoot",
-    "bhuna",
-    "bhuts",
-    "biach",
-    "biali",
-    "bialy",
-    "bibbs",
-    "bibes",
-    "bibis",
-    "bible",
-    "biccy",
-    "bicep",
-    "bices",
-    "bicky",
-    "biddy",
-    "bided",
-    "bider",
-    "bides",
-    "bidet",
-    "bidis",
-    "bidon",
-    "bidri",
-    "bield",
-    "biers",
-    "biffo",
-    "biffs",
-    "biffy",
-    "bifid",
-    "bigae",
-    "biggs",
-    "biggy",
-    "bigha",
-    "bight",
-    "bigly",
-    "bigos",
-    "bigot",
-    "bihon",
-    "bijou",
-    "biked",
-    "biker",
-    "bikes",
-    "bikie",
-    "bikky",
-    "bilal",
-    "bilat",
-    "bilbo",
-    "bilby",
-    "biled",
-    "biles",
-    "bilge",
-    "bilgy",
-    "bilks",
-    "bills",
-    "billy",
-    "bimah",
-    "bimas",
-    "bimbo",
-    "binal",
-    "bindi",
-    "binds",
-    "biner",
-    "bines",
-    "binge",
-    "bingo",
-    "bings",
-    "bingy",
-    "binit",
-    "binks",
-    "binky",
-    "bints",
-    "biogs",
-    "biome",
-    "bions",
-    "biont",
-    "biose",
-    "biota",
-    "biped",
-    "bipod",
-    "bippy",
-    "birch",
-    "birdo",
-    "birds",
-    "biris",
-    "birks",
-    "birle",
-    "birls",
-    "biros",
-    "birrs",
-    "birse",
-    "birsy",
-    "birth",
-    "birze",
-    "birzz",
-    "bises",
-    "bisks",
-    "bisom",
-    "bison",
-    "bitch",
-    "biter",
-    "bites",
-    "bitey",
-    "bitos",
-    "bitou",
-    "bitsy",
-    "bitte",
-    "bitts",
-    "bitty",
-    "bivia",
-    "bivvy",
-    "bizes",
-    "bizzo",
-    "bizzy",
-    "blabs",
-    "black",
-    "blade",
-    "blads",
-    "blady",
-    "blaer",
-    "blaes",
-    "blaff",
-    "blags",
-    "blahs",
-    "blain",
-    "blame",
-    "blams",
-    "blanc",
-    "bland",
-    "blank",
-    "blare",
-    "blart",
-    "blase",
-    "blash",
-    "blast",
-    "blate",
-    "blats",
-    "blatt",
-    "blaud",
-    "blawn",
-    "blaws",
-    "blays",
-    "blaze",
-    "bleah",
-    "bleak",
-    "blear",
-    "bleat",
-    "blebs",
-    "blech",
-    "bleed",
-    "bleep",
-    "blees",
-    "blend",
-    "blent",
-    "blert",
-    "bless",
-    "blest",
-    "blets",
-    "bleys",
-    "blimp",
-    "blimy",
-    "blind",
-    "bling",
-    "blini",
-    "blink",
-    "blins",
-    "bliny",
-    "blips",
-    "bliss",
-    "blist",
-    "blite",
-    "blits",
-    "blitz",
-    "blive",
-    "bloat",
-    "blobs",
-    "block",
-    "blocs",
-    "blogs",
-    "bloke",
-    "blond",
-    "blonx",
-    "blood",
-    "blook",
-    "bloom",
-    "bloop",
-    "blore",
-    "blots",
-    "blown",
-    "blows",
-    "blowy",
-    "blubs",
-    "blude",
-    "bluds",
-    "bludy",
-    "blued",
-    "bluer",
-    "blues",
-    "bluet",
-    "bluey",
-    "bluff",
-    "bluid",
-    "blume",
-    "blunk",
-    "blunt",
-    "blurb",
-    "blurs",
-    "blurt",
-    "blush",
-    "blype",
-    "boabs",
-    "boaks",
-    "board",
-    "boars",
-    "boart",
-    "boast",
-    "boats",
-    "boaty",
-    "bobac",
-    "bobak",
-    "bobas",
-    "bobby",
-    "bobol",
-    "bobos",
-    "bocca",
-    "bocce",
-    "bocci",
-    "boche",
-    "bocks",
-    "boded",
-    "bodes",
-    "bodge",
-    "bodgy",
-    "bodhi",
-    "bodle",
-    "bodoh",
-    "boeps",
-    "boers",
-    "boeti",
-    "boets",
-    "boeuf",
-    "boffo",
-    "boffs",
-    "bogan",
-    "bogey",
-    "boggy",
-    "bogie",
-    "bogle",
-    "bogue",
-    "bogus",
-    "bohea",
-    "bohos",
-    "boils",
-    "boing",
-    "boink",
-    "boite",
-    "boked",
-    "bokeh",
-    "bokes",
-    "bokos",
-    "bolar",
-    "bolas",
-    "boldo",
-    "bolds",
-    "boles",
-    "bolet",
-    "bolix",
-    "bolks",
-    "bolls",
-    "bolos",
-    "bolts",
-    "bolus",
-    "bomas",
-    "bombe",
-    "bombo",
-    "bombs",
-    "bomoh",
-    "bomor",
-    "bonce",
-    "bonds",
-    "boned",
-    "boner",
-    "bones",
-    "boney",
-    "bongo",
-    "bongs",
-    "bonie",
-    "bonks",
-    "bonne",
-    "bonny",
-    "bonum",
-    "bonus",
-    "bonza",
-    "bonze",
-    "booai",
-    "booay",
-    "boobs",
-    "booby",
-    "boody",
-    "booed",
-    "boofy",
-    "boogy",
-    "boohs",
-    "books",
-    "booky",
-    "bools",
-    "booms",
-    "boomy",
-    "boong",
-    "boons",
-    "boord",
-    "boors",
-    "boose",
-    "boost",
-    "booth",
-    "boots",
-    "booty",
-    "booze",
-    "boozy",
-    "boppy",
-    "borak",
-    "boral",
-    "boras",
-    "borax",
-    "borde",
-    "bords",
-    "bored",
-    "boree",
-    "borek",
-    "borel",
-    "borer",
-    "bores",
-    "borgo",
-    "boric",
-    "borks",
-    "borms",
-    "borna",
-    "borne",
-    "boron",
-    "borts",
-    "borty",
-    "bortz",
-    "bosey",
-    "bosie",
-    "bosks",
-    "bosky",
-    "bosom",
-    "boson",
-    "bossa",
-    "bossy",
-    "bosun",
-    "botas",
-    "botch",
-    "boteh",
-    "botel",
-    "botes",
-    "botew",
-    "bothy",
-    "botos",
-    "botte",
-    "botts",
-    "botty",
-    "bouge",
-    "bough",
-    "bouks",
-    "boule",
-    "boult",
-    "bound",
-    "bouns",
-    "bourd",
-    "bourg",
-    "bourn",
-    "bouse",
-    "bousy",
-    "bouts",
-    "boutu",
-    "bovid",
-    "bowat",
-    "bowed",
-    "bowel",
-    "bower",
-    "bowes",
-    "bowet",
-    "bowie",
-    "bowls",
-    "bowne",
-    "bowrs",
-    "bowse",
-    "boxed",
-    "boxen",
-    "boxer",
-    "boxes",
-    "boxla",
-    "boxty",
-    "boyar",
-    "boyau",
-    "boyed",
-    "boyey",
-    "boyfs",
-    "boygs",
-    "boyla",
-    "boyly",
-    "boyos",
-    "boysy",
-    "bozos",
-    "braai",
-    "brace",
-    "brach",
-    "brack",
-    "bract",
-    "brads",
-    "braes",
-    "brags",
-    "brahs",
-    "braid",
-    "brail",
-    "brain",
-    "brake",
-    "braks",
-    "braky",
-    "brame",
-    "brand",
-    "brane",
-    "brank",
-    "brans",
-    "brant",
-    "brash",
-    "brass",
-    "brast",
-    "brats",
-    "brava",
-    "brave",
-    "bravi",
-    "bravo",
-    "brawl",
-    "brawn",
-    "braws",
-    "braxy",
-    "brays",
-    "braza",
-    "braze",
-    "bread",
-    "break",
-    "bream",
-    "brede",
-    "breds",
-    "breed",
-    "breem",
-    "breer",
-    "brees",
-    "breid",
-    "breis",
-    "breme",
-    "brens",
-    "brent",
-    "brere",
-    "brers",
-    "breve",
-    "brews",
-    "breys",
-    "briar",
-    "bribe",
-    "brick",
-    "bride",
-    "brief",
-    "brier",
-    "bries",
-    "brigs",
-    "briki",
-    "briks",
-    "brill",
-    "brims",
-    "brine",
-    "bring",
-    "brink",
-    "brins",
-    "briny",
-    "brios",
-    "brise",
-    "brisk",
-    "briss",
-    "brith",
-    "brits",
-    "britt",
-    "brize",
-    "broad",
-    "broch",
-    "brock",
-    "brods",
-    "brogh",
-    "brogs",
-    "broil",
-    "broke",
-    "brome",
-    "bromo",
-    "bronc",
-    "brond",
-    "brood",
-    "brook",
-    "brool",
-    "broom",
-    "broos",
-    "brose",
-    "brosy",
-    "broth",
-    "brown",
-    "brows",
-    "bruck",
-    "brugh",
-    "bruhs",
-    "bruin",
-    "bruit",
-    "bruja",
-    "brujo",
-    "brule",
-    "brume",
-    "brung",
-    "brunt",
-    "brush",
-    "brusk",
-    "brust",
-    "brute",
-    "bruts",
-    "bruvs",
-    "buats",
-    "buaze",
-    "bubal",
-    "bubas",
-    "bubba",
-    "bubbe",
-    "bubby",
-    "bubus",
-    "buchu",
-    "bucko",
-    "bucks",
-    "bucku",
-    "budas",
-    "buddy",
-    "buded",
-    "budes",
-    "budge",
-    "budis",
-    "budos",
-    "buena",
-    "buffa",
-    "buffe",
-    "buffi",
-    "buffo",
-    "buffs",
-    "buffy",
-    "bufos",
-    "bufty",
-    "bugan",
-    "buggy",
-    "bugle",
-    "buhls",
-    "buhrs",
-    "buiks",
-    "build",
-    "built",
-    "buist",
-    "bukes",
-    "bukos",
-    "bulbs",
-    "bulge",
-    "bulgy",
-    "bulks",
-    "bulky",
-    "bulla",
-    "bulls",
-    "bully",
-    "bulse",
-    "bumbo",
-    "bumfs",
-    "bumph",
-    "bumps",
-    "bumpy",
-    "bunas",
-    "bunce",
-    "bunch",
-    "bunco",
-    "bunde",
-    "bundh",
-    "bunds",
-    "bundt",
-    "bundu",
-    "bundy",
-    "bungs",
-    "bungy",
-    "bunia",
-    "bunje",
-    "bunjy",
-    "bunko",
-    "bunks",
-    "bunns",
-    "bunny",
-    "bunts",
-    "bunty",
-    "bunya",
-    "buoys",
-    "buppy",
-    "buran",
-    "buras",
-    "burbs",
-    "burds",
-    "buret",
-    "burfi",
-    "burgh",
-    "burgs",
-    "burin",
-    "burka",
-    "burke",
-    "burks",
-    "burls",
-    "burly",
-    "burns",
-    "burnt",
-    "buroo",
-    "burps",
-    "burqa",
-    "burra",
-    "burro",
-    "burrs",
-    "burry",
-    "bursa",
-    "burse",
-    "burst",
-    "busby",
-    "bused",
-    "buses",
-    "bushy",
-    "busks",
-    "busky",
-    "bussu",
-    "busti",
-    "busts",
-    "busty",
-    "butch",
-    "buteo",
-    "butes",
-    "butle",
-    "butoh",
-    "butte",
-    "butts",
-    "butty",
-    "butut",
-    "butyl",
-    "buxom",
-    "buyer",
-    "buyin",
-    "buzzy",
-    "bwana",
-    "bwazi",
-    "byded",
-    "bydes",
-    "byked",
-    "bykes",
-    "bylaw",
-    "byres",
-    "byrls",
-    "byssi",
-    "bytes",
-    "byway",
-    "caaed",
-    "cabal",
-    "cabas",
-    "cabby",
-    "caber",
-    "cabin",
-    "cable",
-    "cabob",
-    "caboc",
-    "cabre",
-    "cacao",
-    "cacas",
-    "cache",
-    "cacks",
-    "cacky",
-    "cacti",
-    "caddy",
-    "cadee",
-    "cades",
-    "cadet",
-    "cadge",
-    "cadgy",
-    "cadie",
-    "cadis",
-    "cadre",
-    "caeca",
-    "caese",
-    "cafes",
-    "caffe",
-    "caffs",
-    "caged",
-    "cager",
-    "cages",
-    "cagey",
-    "cagot",
-    "cahow",
-    "caids",
-    "cains",
-    "caird",
-    "cairn",
-    "cajon",
-    "cajun",
-    "caked",
-    "cakes",
-    "cakey",
-    "calfs",
-    "calid",
-    "calif",
-    "calix",
-    "calks",
-    "calla",
-    "calle",
-    "calls",
-    "calms",
-    "calmy",
-    "calos",
-    "calpa",
-    "calps",
-    "calve",
-    "calyx",
-    "caman",
-    "camas",
-    "camel",
-    "cameo",
-    "cames",
-    "camis",
-    "camos",
-    "campi",
-    "campo",
-    "camps",
-    "campy",
-    "camus",
-    "canal",
-    "cando",
-    "candy",
-    "caned",
-    "caneh",
-    "caner",
-    "canes",
-    "cangs",
-    "canid",
-    "canna",
-    "canns",
-    "canny",
-    "canoe",
-    "canon",
-    "canso",
-    "canst",
-    "canti",
-    "canto",
-    "cants",
-    "canty",
-    "capas",
-    "capax",
-    "caped",
-    "caper",
-    "capes",
-    "capex",
-    "caphs",
-    "capiz",
-    "caple",
-    "capon",
-    "capos",
-    "capot",
-    "capri",
-    "capul",
-    "caput",
-    "carap",
-    "carat",
-    "carbo",
-    "carbs",
-    "carby",
-    "cardi",
-    "cards",
-    "cardy",
-    "cared",
-    "carer",
-    "cares",
-    "caret",
-    "carex",
-    "cargo",
-    "carks",
-    "carle",
-    "carls",
-    "carne",
-    "carns",
-    "carny",
-    "carob",
-    "carol",
-    "carom",
-    "caron",
-    "carpe",
-    "carpi",
-    "carps",
-    "carrs",
-    "carry",
-    "carse",
-    "carta",
-    "carte",
-    "carts",
-    "carve",
-    "carvy",
-    "casas",
-    "casco",
-    "cased",
-    "caser",
-    "cases",
-    "casks",
-    "casky",
-    "caste",
-    "casts",
-    "casus",
-    "catch",
-    "cater",
-    "cates",
-    "catty",
-    "cauda",
-    "cauks",
-    "cauld",
-    "caulk",
-    "cauls",
-    "caums",
-    "caups",
-    "cauri",
-    "causa",
-    "cause",
-    "cavas",
-    "caved",
-    "cavel",
-    "caver",
-    "caves",
-    "cavie",
-    "cavil",
-    "cavus",
-    "cawed",
-    "cawks",
-    "caxon",
-    "cease",
-    "ceaze",
-    "cebid",
-    "cecal",
-    "cecum",
-    "cedar",
-    "ceded",
-    "ceder",
-    "cedes",
-    "cedis",
-    "ceiba",
-    "ceili",
-    "ceils",
-    "celeb",
-    "cella",
-    "celli",
-    "cello",
-    "cells",
-    "celly",
-    "celom",
-    "celts",
-    "cense",
-    "cento",
-    "cents",
-    "centu",
-    "ceorl",
-    "cepes",
-    "cerci",
-    "cered",
-    "ceres",
-    "cerge",
-    "ceria",
-    "ceric",
-    "cerne",
-    "ceroc",
-    "ceros",
-    "certs",
-    "certy",
-    "cesse",
-    "cesta",
-    "cesti",
-    "cetes",
-    "cetyl",
-    "cezve",
-    "chaap",
-    "chaat",
-    "chace",
-    "chack",
-    "chaco",
-    "chado",
-    "chads",
-    "chafe",
-    "chaff",
-    "chaft",
-    "chain",
-    "chair",
-    "chais",
-    "chalk",
-    "chals",
-    "champ",
-    "chams",
-    "chana",
-    "chang",
-    "chank",
-    "chant",
-    "chaos",
-    "chape",
-    "chaps",
-    "chapt",
-    "chara",
-    "chard",
-    "chare",
-    "chark",
-    "charm",
-    "charr",
-    "chars",
-    "chart",
-    "chary",
-    "chase",
-    "chasm",
-    "chats",
-    "chava",
-    "chave",
-    "chavs",
-    "chawk",
-    "chawl",
-    "chaws",
-    "chaya",
-    "chays",
-    "cheap",
-    "cheat",
-    "cheba",
-    "check",
-    "chedi",
-    "cheeb",
-    "cheek",
-    "cheep",
-    "cheer",
-    "cheet",
-    "chefs",
-    "cheka",
-    "chela",
-    "chelp",
-    "chemo",
-    "chems",
-    "chere",
-    "chert",
-    "chess",
-    "chest",
-    "cheth",
-    "chevy",
-    "chews",
-    "chewy",
-    "chiao",
-    "chias",
-    "chiba",
-    "chibs",
-    "chica",
-    "chich",
-    "chick",
-    "chico",
-    "chics",
-    "chide",
-    "chief",
-    "chiel",
-    "chiko",
-    "chiks",
-    "child",
-    "chile",
-    "chili",
-    "chill",
-    "chimb",
-    "chime",
-    "chimo",
-    "chimp",
-    "china",
-    "chine",
-    "ching",
-    "chink",
-    "chino",
-    "chins",
-    "chips",
-    "chirk",
-    "chirl",
-    "chirm",
-    "chiro",
-    "chirp",
-    "chirr",
-    "chirt",
-    "chiru",
-    "chiti",
-    "chits",
-    "chiva",
-    "chive",
-    "chivs",
-    "chivy",
-    "chizz",
-    "chock",
-    "choco",
-    "chocs",
-    "chode",
-    "chogs",
-    "choil",
-    "choir",
-    "choke",
-    "choko",
-    "choky",
-    "chola",
-    "choli",
-    "cholo",
-    "chomp",
-    "chons",
-    "choof",
-    "chook",
-    "choom",
-    "choon",
-    "chops",
-    "chord",
-    "chore",
-    "chose",
-    "choss",
-    "chota",
-    "chott",
-    "chout",
-    "choux",
-    "chowk",
-    "chows",
-    "chubs",
-    "chuck",
-    "chufa",
-    "chuff",
-    "chugs",
-    "chump",
-    "chums",
-    "chunk",
-    "churl",
-    "churn",
-    "churr",
-    "chuse",
-    "chute",
-    "chuts",
-    "chyle",
-    "chyme",
-    "chynd",
-    "cibol",
-    "cided",
-    "cider",
-    "cides",
-    "ciels",
-    "cigar",
-    "ciggy",
-    "cilia",
-    "cills",
-    "cimar",
-    "cimex",
-    "cinch",
-    "cinct",
-    "cines",
-    "cinqs",
-    "cions",
-    "cippi",
-    "circa",
-    "circs",
-    "cires",
-    "cirls",
-    "cirri",
-    "cisco",
-    "cissy",
-    "cists",
-    "cital",
-    "cited",
-    "citee",
-    "citer",
-    "cites",
-    "cives",
-    "civet",
-    "civic",
-    "civie",
-    "civil",
-    "civvy",
-    "clach",
-    "clack",
-    "clade",
-    "clads",
-    "claes",
-    "clags",
-    "claim",
-    "clair",
-    "clame",
-    "clamp",
-    "clams",
-    "clang",
-    "clank",
-    "clans",
-    "claps",
-    "clapt",
-    "claro",
-    "clart",
-    "clary",
-    "clash",
-    "clasp",
-    "class",
-    "clast",
-    "clats",
-    "claut",
-    "clave",
-    "clavi",
-    "claws",
-    "clays",
-    "clean",
-    "clear",
-    "cleat",
-    "cleck",
-    "cleek",
-    "cleep",
-    "clefs",
-    "cleft",
-    "clegs",
-    "cleik",
-    "clems",
-    "clepe",
-    "clept",
-    "clerk",
-    "cleve",
-    "clews",
-    "click",
-    "clied",
-    "clies",
-    "cliff",
-    "clift",
-    "climb",
-    "clime",
-    "cline",
-    "cling",
-    "clink",
-    "clint",
-    "clipe",
-    "clips",
-    "clipt",
-    "clits",
-    "cloak",
-    "cloam",
-    "clock",
-    "clods",
-    "cloff",
-    "clogs",
-    "cloke",
-    "clomb",
-    "clomp",
-    "clone",
-    "clonk",
-    "clons",
-    "cloop",
-    "cloot",
-    "clops",
-    "close",
-    "clote",
-    "cloth",
-    "clots",
-    "cloud",
-    "clour",
-    "clous",
-    "clout",
-    "clove",
-    "clown",
-    "clows",
-    "cloye",
-    "cloys",
-    "cloze",
-    "clubs",
-    "cluck",
-    "clued",
-    "clues",
-    "cluey",
-    "clump",
-    "clung",
-    "clunk",
-    "clype",
-    "cnida",
-    "coach",
-    "coact",
-    "coady",
-    "coala",
-    "coals",
-    "coaly",
-    "coapt",
-    "coarb",
-    "coast",
-    "coate",
-    "coati",
-    "coats",
-    "cobbs",
-    "cobby",
-    "cobia",
-    "coble",
-    "cobot",
-    "cobra",
-    "cobza",
-    "cocas",
-    "cocci",
-    "cocco",
-    "cocks",
-    "cocky",
-    "cocoa",
-    "cocos",
-    "cocus",
-    "codas",
-    "codec",
-    "coded",
-    "coden",
-    "coder",
-    "codes",
-    "codex",
-    "codon",
-    "coeds",
-    "coffs",
-    "cogie",
-    "cogon",
-    "cogue",
-    "cohab",
-    "cohen",
-    "cohoe",
-    "cohog",
-    "cohos",
-    "coifs",
-    "coign",
-    "coils",
-    "coins",
-    "coirs",
-    "coits",
-    "coked",
-    "cokes",
-    "cokey",
-    "colas",
-    "colby",
-    "colds",
-    "coled",
-    "coles",
-    "coley",
-    "colic",
-    "colin",
-    "colle",
-    "colls",
-    "colly",
-    "colog",
-    "colon",
-    "color",
-    "colts",
-    "colza",
-    "comae",
-    "comal",
-    "comas",
-    "combe",
-    "combi",
-    "combo",
-    "combs",
-    "comby",
-    "comer",
-    "comes",
-    "comet",
-    "comfy",
-    "comic",
-    "comix",
-    "comma",
-    "comme",
-    "commo",
-    "comms",
-    "commy",
-    "compo",
-    "comps",
-    "compt",
-    "comte",
-    "comus",
-    "conch",
-    "condo",
-    "coned",
-    "cones",
-    "conex",
-    "coney",
-    "confs",
-    "conga",
-    "conge",
-    "congo",
-    "conia",
-    "conic",
-    "conin",
-    "conks",
-    "conky",
-    "conne",
-    "conns",
-    "conte",
-    "conto",
-    "conus",
-    "convo",
-    "cooch",
-    "cooed",
-    "cooee",
-    "cooer",
-    "cooey",
-    "coofs",
-    "cooks",
-    "cooky",
-    "cools",
-    "cooly",
-    "coomb",
-    "cooms",
-    "coomy",
-    "coons",
-    "coops",
-    "coopt",
-    "coost",
-    "coots",
-    "cooty",
-    "cooze",
-    "copal",
-    "copay",
-    "coped",
-    "copen",
-    "coper",
-    "copes",
-    "copha",
-    "coppy",
-    "copra",
-    "copse",
-    "copsy",
-    "coqui",
-    "coral",
-    "coram",
-    "corbe",
-    "corby",
-    "corda",
-    "cords",
-    "cored",
-    "corer",
-    "cores",
-    "corey",
-    "corgi",
-    "coria",
-    "corks",
-    "corky",
-    "corms",
-    "corni",
-    "corno",
-    "corns",
-    "cornu",
-    "corny",
-    "corps",
-    "corse",
-    "corso",
-    "cosec",
-    "cosed",
-    "coses",
-    "coset",
-    "cosey",
-    "cosie",
-    "costa",
-    "coste",
-    "costs",
-    "cotan",
-    "cotch",
-    "coted",
-    "cotes",
-    "coths",
-    "cotta",
-    "cotts",
-    "couch",
-    "coude",
-    "cough",
-    "could",
-    "count",
-    "coupe",
-    "coups",
-    "courb",
-    "courd",
-    "coure",
-    "cours",
-    "court",
-    "couta",
-    "couth",
-    "coved",
-    "coven",
-    "cover",
-    "coves",
-    "covet",
-    "covey",
-    "covin",
-    "cowal",
-    "cowan",
-    "cowed",
-    "cower",
-    "cowks",
-    "cowls",
-    "cowps",
-    "cowry",
-    "coxae",
-    "coxal",
-    "coxed",
-    "coxes",
-    "coxib",
-    "coyau",
-    "coyed",
-    "coyer",
-    "coyly",
-    "coypu",
-    "cozed",
-    "cozen",
-    "cozes",
-    "cozey",
-    "cozie",
-    "craal",
-    "crabs",
-    "crack",
-    "craft",
-    "crags",
-    "craic",
-    "craig",
-    "crake",
-    "crame",
-    "cramp",
-    "crams",
-    "crane",
-    "crank",
-    "crans",
-    "crape",
-    "craps",
-    "crapy",
-    "crare",
-    "crash",
-    "crass",
-    "crate",
-    "crave",
-    "crawl",
-    "craws",
-    "crays",
-    "craze",
-    "crazy",
-    "creak",
-    "cream",
-    "credo",
-    "creds",
-    "creed",
-    "creek",
-    "creel",
-    "creep",
-    "crees",
-    "crein",
-    "crema",
-    "creme",
-    "crems",
-    "crena",
-    "crepe",
-    "creps",
-    "crept",
-    "crepy",
-    "cress",
-    "crest",
-    "crewe",
-    "crews",
-    "crias",
-    "cribo",
-    "cribs",
-    "crick",
-    "cried",
-    "crier",
-    "cries",
-    "crime",
-    "crimp",
-    "crims",
-    "crine",
-    "crink",
-    "crins",
-    "crios",
-    "cripe",
-    "crips",
-    "crise",
-    "crisp",
-    "criss",
-    "crith",
-    "crits",
-    "croak",
-    "croci",
-    "crock",
-    "crocs",
-    "croft",
-    "crogs",
-    "cromb",
-    "crome",
-    "crone",
-    "cronk",
-    "crons",
-    "crony",
-    "crook",
-    "crool",
-    "croon",
-    "crops",
-    "crore",
-    "cross",
-    "crost",
-    "croup",
-    "crout",
-    "crowd",
-    "crowl",
-    "crown",
-    "crows",
-    "croze",
-    "cruck",
-    "crude",
-    "crudo",
-    "cruds",
-    "crudy",
-    "cruel",
-    "crues",
-    "cruet",
-    "cruft",
-    "crumb",
-    "crump",
-    "crunk",
-    "cruor",
-    "crura",
-    "cruse",
-    "crush",
-    "crust",
-    "crusy",
-    "cruve",
-    "crwth",
-    "cryer",
-    "cryne",
-    "crypt",
-    "ctene",
-    "cubby",
-    "cubeb",
-    "cubed",
-    "cuber",
-    "cubes",
-    "cubic",
-    "cubit",
-    "cucks",
-    "cudda",
-    "cuddy",
-    "cueca",
-    "cuffo",
-    "cuffs",
-    "cuifs",
-    "cuing",
-    "cuish",
-    "cuits",
-    "cukes",
-    "culch",
-    "culet",
-    "culex",
-    "culls",
-    "cully",
-    "culms",
-    "culpa",
-    "culti",
-    "cults",
-    "culty",
-    "cumec",
-    "cumin",
-    "cundy",
-    "cunei",
-    "cunit",
-    "cunny",
-    "cunts",
-    "cupel",
-    "cupid",
-    "cuppa",
-    "cuppy",
-    "cupro",
-    "curat",
-    "curbs",
-    "curch",
-    "curds",
-    "curdy",
-    "cured",
-    "curer",
-    "cures",
-    "curet",
-    "curfs",
-    "curia",
-    "curie",
-    "curio",
-    "curli",
-    "curls",
-    "curly",
-    "curns",
-    "curny",
-    "currs",
-    "curry",
-    "curse",
-    "cursi",
-    "curst",
-    "curve",
-    "curvy",
-    "cusec",
-    "cushy",
-    "cusks",
-    "cusps",
-    "cuspy",
-    "cusso",
-    "cusum",
-    "cutch",
-    "cuter",
-    "cutes",
-    "cutey",
-    "cutie",
-    "cutin",
-    "cutis",
-    "cutto",
-    "cutty",
-    "cutup",
-    "cuvee",
-    "cuzes",
-    "cwtch",
-    "cyano",
-    "cyans",
-    "cyber",
-    "cycad",
-    "cycas",
-    "cycle",
-    "cyclo",
-    "cyder",
-    "cylix",
-    "cymae",
-    "cymar",
-    "cymas",
-    "cymes",
-    "cymol",
-    "cynic",
-    "cysts",
-    "cytes",
-    "cyton",
-    "czars",
-    "daals",
-    "dabba",
-    "daces",
-    "dacha",
-    "dacks",
-    "dadah",
-    "dadas",
-    "daddy",
-    "dadis",
-    "dadla",
-    "dados",
-    "daffs",
-    "daffy",
-    "dagga",
-    "daggy",
-    "dagos",
-    "dahis",
-    "dahls",
-    "daiko",
-    "daily",
-    "daine",
-    "daint",
-    "dairy",
-    "daisy",
-    "daker",
-    "daled",
-    "dalek",
-    "dales",
-    "dalis",
-    "dalle",
-    "dally",
-    "dalts",
-    "daman",
-    "damar",
-    "dames",
-    "damme",
-    "damna",
-    "damns",
-    "damps",
-    "dampy",
-    "dance",
-    "dancy",
-    "danda",
-    "dandy",
-    "dangs",
-    "danio",
-    "danks",
-    "danny",
-    "danse",
-    "dants",
-    "dappy",
-    "daraf",
-    "darbs",
-    "darcy",
-    "dared",
-    "darer",
-    "dares",
-    "darga",
-    "dargs",
-    "daric",
-    "daris",
-    "darks",
-    "darky",
-    "darls",
-    "darns",
-    "darre",
-    "darts",
-    "darzi",
-    "dashi",
-    "dashy",
-    "datal",
-    "dated",
-    "dater",
-    "dates",
-    "datil",
-    "datos",
-    "datto",
-    "datum",
-    "daube",
-    "daubs",
-    "dauby",
-    "dauds",
-    "dault",
-    "daunt",
-    "daurs",
-    "dauts",
-    "daven",
-    "davit",
-    "dawah",
-    "dawds",
-    "dawed",
-    "dawen",
-    "dawgs",
-    "dawks",
-    "dawns",
-    "dawts",
-    "dayal",
-    "dayan",
-    "daych",
-    "daynt",
-    "dazed",
-    "dazer",
-    "dazes",
-    "dbags",
-    "deads",
-    "deair",
-    "deals",
-    "dealt",
-    "deans",
-    "deare",
-    "dearn",
-    "dears",
-    "deary",
-    "deash",
-    "death",
-    "deave",
-    "deaws",
-    "deawy",
-    "debag",
-    "debar",
-    "debby",
-    "debel",
-    "debes",
-    "debit",
-    "debts",
-    "debud",
-    "debug",
-    "debur",
-    "debus",
-    "debut",
-    "debye",
-    "decad",
-    "decaf",
-    "decal",
-    "decan",
-    "decay",
-    "decim",
-    "decko",
-    "decks",
-    "decor",
-    "decos",
-    "decoy",
-    "decry",
-    "decyl",
-    "dedal",
-    "deeds",
-    "deedy",
-    "deely",
-    "deems",
-    "deens",
-    "deeps",
-    "deere",
-    "deers",
-    "deets",
-    "deeve",
-    "deevs",
-    "defat",
-    "defer",
-    "deffo",
-    "defis",
-    "defog",
-    "degas",
-    "degum",
-    "degus",
-    "deice",
-    "deids",
-    "deify",
-    "deign",
-    "deils",
-    "deink",
-    "deism",
-    "deist",
-    "deity",
-    "deked",
-    "dekes",
-    "dekko",
-    "delay",
-    "deled",
-    "deles",
-    "delfs",
-    "delft",
-    "delis",
-    "della",
-    "dells",
-    "delly",
-    "delos",
-    "delph",
-    "delta",
-    "delts",
-    "delve",
-    "deman",
-    "demes",
-    "demic",
-    "demit",
-    "demob",
-    "demoi",
-    "demon",
-    "demos",
-    "demot",
-    "dempt",
-    "demur",
-    "denar",
-    "denay",
-    "dench",
-    "denes",
-    "denet",
-    "denim",
-    "denis",
-    "dense",
-    "dente",
-    "dents",
-    "deoch",
-    "deoxy",
-    "depot",
-    "depth",
-    "derat",
-    "deray",
-    "derby",
-    "dered",
-    "deres",
-    "derig",
-    "derma",
-    "derms",
-    "derns",
-    "derny",
-    "deros",
-    "derpy",
-    "derro",
-    "derry",
-    "derth",
-    "dervs",
-    "desex",
-    "deshi",
-    "desis",
-    "desks",
-    "desse",
-    "detag",
-    "deter",
-    "detox",
-    "deuce",
-    "devas",
-    "devel",
-    "devil",
-    "devis",
-    "devon",
-    "devos",
-    "devot",
-    "dewan",
-    "dewar",
-    "dewax",
-    "dewed",
-    "dexes",
-    "dexie",
-    "dexys",
-    "dhaba",
-    "dhaks",
-    "dhals",
-    "dhikr",
-    "dhobi",
-    "dhole",
-    "dholl",
-    "dhols",
-    "dhoni",
-    "dhoti",
-    "dhows",
-    "dhuti",
-    "diact",
-    "dials",
-    "diana",
-    "diane",
-    "diary",
-    "diazo",
-    "dibbs",
-    "diced",
-    "dicer",
-    "dices",
-    "dicey",
-    "dicht",
-    "dicks",
-    "dicky",
-    "dicot",
-    "dicta",
-    "dicto",
-    "dicts",
-    "dictu",
-    "dicty",
-    "diddy",
-    "didie",
-    "didis",
-    "didos",
-    "didst",
-    "diebs",
-    "diels",
-    "diene",
-    "diets",
-    "diffs",
-    "dight",
-    "digit",
-    "dikas",
-    "diked",
-    "diker",
-    "dikes",
-    "dikey",
-    "dildo",
-    "dilli",
-    "dills",
-    "dilly",
-    "dimbo",
-    "dimer",
-    "dimes",
-    "dimly",
-    "dimps",
-    "dinar",
-    "dined",
-    "diner",
-    "dines",
-    "dinge",
-    "dingo",
-    "dings",
-    "dingy",
-    "dinic",
-    "dinks",
-    "dinky",
-    "dinlo",
-    "dinna",
-    "dinos",
-    "dints",
-    "dioch",
-    "diode",
-    "diols",
-    "diota",
-    "dippy",
-    "dipso",
-    "diram",
-    "direr",
-    "dirge",
-    "dirke",
-    "dirks",
-    "dirls",
-    "dirts",
-    "dirty",
-    "disas",
-    "disci",
-    "disco",
-    "discs",
-    "dishy",
-    "disks",
-    "disme",
-    "dital",
-    "ditas",
-    "ditch",
-    "dited",
-    "dites",
-    "ditsy",
-    "ditto",
-    "ditts",
-    "ditty",
-    "ditzy",
-    "divan",
-    "divas",
-    "dived",
-    "diver",
-    "dives",
-    "divey",
-    "divis",
-    "divna",
-    "divos",
-    "divot",
-    "divvy",
-    "diwan",
-    "dixie",
-    "dixit",
-    "diyas",
-    "dizen",
-    "dizzy",
-    "djinn",
-    "djins",
-    "doabs",
-    "doats",
-    "dobby",
-    "dobes",
-    "dobie",
-    "dobla",
-    "doble",
-    "dobra",
-    "dobro",
-    "docht",
-    "docks",
-    "docos",
-    "docus",
-    "doddy",
-    "dodge",
-    "dodgy",
-    "dodos",
-    "doeks",
-    "doers",
-    "doest",
-    "doeth",
-    "doffs",
-    "dogal",
-    "dogan",
-    "doges",
-    "dogey",
-    "doggo",
-    "doggy",
-    "dogie",
-    "dogly",
-    "dogma",
-    "dohyo",
-    "doilt",
-    "doily",
-    "doing",
-    "doits",
-    "dojos",
-    "dolce",
-    "dolci",
-    "doled",
-    "dolee",
-    "doles",
-    "doley",
-    "dolia",
-    "dolie",
-    "dolls",
-    "dolly",
-    "dolma",
-    "dolor",
-    "dolos",
-    "dolts",
-    "domal",
-    "domed",
-    "domes",
-    "domic",
-    "donah",
-    "donas",
-    "donee",
-    "doner",
-    "donga",
-    "dongs",
-    "donko",
-    "donna",
-    "donne",
-    "donny",
-    "donor",
-    "donsy",
-    "donut",
-    "doobs",
-    "dooce",
-    "doody",
-    "doofs",
-    "dooks",
-    "dooky",
-    "doole",
-    "dools",
-    "dooly",
-    "dooms",
-    "doomy",
-    "doona",
-    "doorn",
-    "doors",
-    "doozy",
-    "dopas",
-    "doped",
-    "doper",
-    "dopes",
-    "dopey",
-    "doppe",
-    "dorad",
-    "dorba",
-    "dorbs",
-    "doree",
-    "dores",
-    "doric",
-    "doris",
-    "dorje",
-    "dorks",
-    "dorky",
-    "dorms",
-    "dormy",
-    "dorps",
-    "dorrs",
-    "dorsa",
-    "dorse",
-    "dorts",
-    "dorty",
-    "dosai",
-    "dosas",
-    "dosed",
-    "doseh",
-    "doser",
-    "doses",
-    "dosha",
-    "dotal",
-    "doted",
-    "doter",
-    "dotes",
-    "dotty",
-    "douar",
-    "doubt",
-    "douce",
-    "doucs",
-    "dough",
-    "douks",
-    "doula",
-    "douma",
-    "doums",
-    "doups",
-    "doura",
-    "douse",
-    "douts",
-    "doved",
-    "doven",
-    "dover",
-    "doves",
-    "dovie",
-    "dowak",
-    "dowar",
-    "dowds",
-    "dowdy",
-    "dowed",
-    "dowel",
-    "dower",
-    "dowfs",
-    "dowie",
-    "dowle",
-    "dowls",
-    "dowly",
-    "downa",
-    "downs",
-    "downy",
-    "dowps",
-    "dowry",
-    "dowse",
-    "dowts",
-    "doxed",
-    "doxes",
-    "doxie",
-    "doyen",
-    "doyly",
-    "dozed",
-    "dozen",
-    "dozer",
-    "dozes",
-    "drabs",
-    "drack",
-    "draco",
-    "draff",
-    "draft",
-    "drags",
-    "drail",
-    "drain",
-    "drake",
-    "drama",
-    "drams",
-    "drank",
-    "drant",
-    "drape",
-    "draps",
-    "drapy",
-    "drats",
-    "drave",
-    "drawl",
-    "drawn",
-    "draws",
-    "drays",
-    "dread",
-    "dream",
-    "drear",
-    "dreck",
-    "dreed",
-    "dreer",
-    "drees",
-    "dregs",
-    "dreks",
-    "drent",
-    "drere",
-    "dress",
-    "drest",
-    "dreys",
-    "dribs",
-    "drice",
-    "dried",
-    "drier",
-    "dries",
-    "drift",
-    "drill",
-    "drily",
-    "drink",
-    "drips",
-    "dript",
-    "drive",
-    "drock",
-    "droid",
-    "droil",
-    "droit",
-    "droke",
-    "drole",
-    "droll",
-    "drome",
-    "drone",
-    "drony",
-    "droob",
-    "droog",
-    "drook",
-    "drool",
-    "droop",
-    "drops",
-    "dropt",
-    "dross",
-    "drouk",
-    "drove",
-    "drown",
-    "drows",
-    "drubs",
-    "drugs",
-    "druid",
-    "drums",
-    "drunk",
-    "drupe",
-    "druse",
-    "drusy",
-    "druxy",
-    "dryad",
-    "dryas",
-    "dryer",
-    "dryly",
-    "dsobo",
-    "dsomo",
-    "duads",
-    "duals",
-    "duans",
-    "duars",
-    "dubbo",
-    "dubby",
-    "ducal",
-    "ducat",
-    "duces",
-    "duchy",
-    "ducks",
-    "ducky",
-    "ducti",
-    "ducts",
-    "duddy",
-    "duded",
-    "dudes",
-    "duels",
-    "duets",
-    "duett",
-    "duffs",
-    "dufus",
-    "duing",
-    "duits",
-    "dukas",
-    "duked",
-    "dukes",
-    "dukka",
-    "dukun",
-    "dulce",
-    "dules",
-    "dulia",
-    "dulls",
-    "dully",
-    "dulse",
-    "dumas",
-    "dumbo",
-    "dumbs",
-    "dumka",
-    "dumky",
-    "dummy",
-    "dumps",
-    "dumpy",
-    "dunam",
-    "dunce",
-    "dunch",
-    "dunes",
-    "dungs",
-    "dungy",
-    "dunks",
-    "dunno",
-    "dunny",
-    "dunsh",
-    "dunts",
-    "duomi",
-    "duomo",
-    "duped",
-    "duper",
-    "dupes",
-    "duple",
-    "duply",
-    "duppy",
-    "dural",
-    "duras",
-    "dured",
-    "dures",
-    "durgy",
-    "durns",
-    "duroc",
-    "duros",
-    "duroy",
-    "durra",
-    "durrs",
-    "durry",
-    "durst",
-    "durum",
-    "durzi",
-    "dusks",
-    "dusky",
-    "dusts",
-    "dusty",
-    "dutch",
-    "duvet",
-    "duxes",
-    "dwaal",
-    "dwale",
-    "dwalm",
-    "dwams",
-    "dwamy",
-    "dwang",
-    "dwarf",
-    "dwaum",
-    "dweeb",
-    "dwell",
-    "dwelt",
-    "dwile",
-    "dwine",
-    "dyads",
-    "dyers",
-    "dying",
-    "dyked",
-    "dykes",
-    "dykey",
-    "dykon",
-    "dynel",
-    "dynes",
-    "dynos",
-    "dzhos",
-    "eager",
-    "eagle",
-    "eagly",
-    "eagre",
-    "ealed",
-    "eales",
-    "eaned",
-    "eards",
-    "eared",
-    "earls",
-    "early",
-    "earns",
-    "earnt",
-    "earst",
-    "earth",
-    "eased",
-    "easel",
-    "easer",
-    "eases",
-    "easle",
-    "easts",
-    "eaten",
-    "eater",
-    "eathe",
-    "eatin",
-    "eaved",
-    "eaver",
-    "eaves",
-    "ebank",
-    "ebbed",
-    "ebbet",
-    "ebena",
-    "ebene",
-    "ebike",
-    "ebons",
-    "ebony",
-    "ebook",
-    "ecads",
-    "ecard",
-    "ecash",
-    "eched",
-    "eches",
-    "echos",
-    "ecigs",
-    "eclat",
-    "ecole",
-    "ecrus",
-    "edema",
-    "edged",
-    "edger",
-    "edges",
-    "edict",
-    "edify",
-    "edile",
-    "edits",
-    "educe",
-    "educt",
-    "eejit",
-    "eensy",
-    "eerie",
-    "eeven",
-    "eever",
-    "eevns",
-    "effed",
-    "effer",
-    "efits",
-    "egads",
-    "egers",
-    "egest",
-    "eggar",
-    "egged",
-    "egger",
-    "egmas",
-    "egret",
-    "ehing",
-    "eider",
-    "eidos",
-    "eight",
-    "eigne",
-    "eiked",
-    "eikon",
-    "eilds",
-    "eiron",
-    "eisel",
-    "eject",
-    "ejido",
-    "ekdam",
-    "eking",
-    "ekkas",
-    "elain",
-    "eland",
-    "elans",
-    "elate",
-    "elbow",
-    "elchi",
-    "elder",
-    "eldin",
-    "elect",
-    "eleet",
-    "elegy",
-    "elemi",
-    "elfed",
-    "elfin",
-    "eliad",
-    "elide",
-    "elint",
-    "elite",
-    "elmen",
-    "eloge",
-    "elogy",
-    "eloin",
-    "elope",
-    "elops",
-    "elpee",
-    "elsin",
-    "elude",
-    "elute",
-    "elvan",
-    "elven",
-    "elver",
-    "elves",
-    "emacs",
-    "email",
-    "embar",
-    "embay",
-    "embed",
-    "ember",
-    "embog",
-    "embow",
-    "embox",
-    "embus",
-    "emcee",
-    "emeer",
-    "emend",
-    "emerg",
-    "emery",
-    "emeus",
-    "emics",
-    "emirs",
-    "emits",
-    "emmas",
-    "emmer",
-    "emmet",
-    "emmew",
-    "emmys",
-    "emoji",
-    "emong",
-    "emote",
-    "emove",
-    "empts",
-    "empty",
-    "emule",
-    "emure",
-    "emyde",
-    "emyds",
-    "enact",
-    "enarm",
-    "enate",
-    "ended",
-    "ender",
-    "endew",
-    "endow",
-    "endue",
-    "enema",
-    "enemy",
-    "enews",
-    "enfix",
-    "eniac",
-    "enjoy",
-    "enlit",
-    "enmew",
-    "ennog",
-    "ennui",
-    "enoki",
-    "enols",
-    "enorm",
-    "enows",
-    "enrol",
-    "ensew",
-    "ensky",
-    "ensue",
-    "enter",
-    "entia",
-    "entre",
-    "entry",
-    "enure",
-    "enurn",
-    "envoi",
-    "envoy",
-    "enzym",
-    "eolid",
-    "eorls",
-    "eosin",
-    "epact",
-    "epees",
-    "epena",
-    "epene",
-    "ephah",
-    "ephas",
-    "ephod",
-    "ephor",
-    "epics",
-    "epoch",
-    "epode",
-    "epopt",
-    "epoxy",
-    "eppie",
-    "epris",
-    "equal",
-    "eques",
-    "equid",
-    "equip",
-    "erase",
-    "erbia",
-    "erect",
-    "erevs",
-    "ergon",
-    "ergos",
-    "ergot",
-    "erhus",
-    "erica",
-    "erick",
-    "erics",
-    "ering",
-    "erned",
-    "ernes",
-    "erode",
-    "erose",
-    "erred",
-    "error",
-    "erses",
-    "eruct",
-    "erugo",
-    "erupt",
-    "eruvs",
-    "erven",
-    "ervil",
-    "escar",
-    "escot",
-    "esile",
-    "eskar",
-    "esker",
-    "esnes",
-    "esrog",
-    "essay",
-    "esses",
-    "ester",
-    "estoc",
-    "estop",
-    "estro",
-    "etage",
-    "etape",
-    "etats",
-    "etens",
-    "ethal",
-    "ether",
-    "ethic",
-    "ethne",
-    "ethos",
-    "ethyl",
-    "etics",
-    "etnas",
-    "etrog",
-    "ettin",
-    "ettle",
-    "etude",
-    "etuis",
-    "etwee",
-    "etyma",
-    "eughs",
-    "euked",
-    "eupad",
-    "euros",
-    "eusol",
-    "evade",
-    "evegs",
-    "evens",
-    "event",
-    "evert",
-    "every",
-    "evets",
-    "evhoe",
-    "evict",
-    "evils",
-    "evite",
-    "evohe",
-    "evoke",
-    "ewers",
-    "ewest",
-    "ewhow",
-    "ewked",
-    "exact",
-    "exalt",
-    "exams",
-    "excel",
-    "exeat",
-    "execs",
-    "exeem",
-    "exeme",
-    "exert",
-    "exfil",
-    "exier",
-    "exies",
-    "exile",
-    "exine",
-    "exing",
-    "exist",
-    "exite",
-    "exits",
-    "exode",
-    "exome",
-    "exons",
-    "expat",
-    "expel",
-    "expos",
-    "extol",
-    "extra",
-    "exude",
-    "exuls",
-    "exult",
-    "exurb",
-    "eyass",
-    "eyers",
-    "eying",
-    "eyots",
-    "eyras",
-    "eyres",
-    "eyrie",
-    "eyrir",
-    "ezine",
-    "fabbo",
-    "fabby",
-    "fable",
-    "faced",
-    "facer",
-    "faces",
-    "facet",
-    "facey",
-    "facia",
-    "facie",
-    "facta",
-    "facto",
-    "facts",
-    "facty",
-    "faddy",
-    "faded",
-    "fader",
-    "fades",
-    "fadge",
-    "fados",
-    "faena",
-    "faery",
-    "faffs",
-    "faffy",
-    "faggy",
-    "fagin",
-    "fagot",
-    "faiks",
-    "fails",
-    "faine",
-    "fains",
-    "faint",
-    "faire",
-    "fairs",
-    "fairy",
-    "faith",
-    "faked",
-    "faker",
-    "fakes",
-    "fakey",
-    "fakie",
-    "fakir",
-    "falaj",
-    "fales",
-    "falls",
-    "false",
-    "falsy",
-    "famed",
-    "fames",
-    "fanal",
-    "fancy",
-    "fands",
-    "fanes",
-    "fanga",
-    "fango",
-    "fangs",
-    "fanks",
-    "fanny",
-    "fanon",
-    "fanos",
-    "fanum",
-    "faqir",
-    "farad",
-    "farce",
-    "farci",
-    "farcy",
-    "fards",
-    "fared",
-    "farer",
-    "fares",
-    "farle",
-    "farls",
-    "farms",
-    "faros",
-    "farro",
-    "farse",
-    "farts",
-    "fasci",
-    "fasti",
-    "fasts",
-    "fatal",
-    "fated",
-    "fates",
-    "fatly",
-    "fatso",
-    "fatty",
-    "fatwa",
-    "fauch",
-    "faugh",
-    "fauld",
-    "fault",
-    "fauna",
-    "fauns",
-    "faurd",
-    "faute",
-    "fauts",
-    "fauve",
-    "favas",
-    "favel",
-    "faver",
-    "faves",
-    "favor",
-    "favus",
-    "fawns",
-    "fawny",
-    "faxed",
-    "faxes",
-    "fayed",
-    "fayer",
-    "fayne",
-    "fayre",
-    "fazed",
-    "fazes",
-    "feals",
-    "feard",
-    "feare",
-    "fears",
-    "feart",
-    "fease",
-    "feast",
-    "feats",
-    "feaze",
-    "fecal",
-    "feces",
-    "fecht",
-    "fecit",
-    "fecks",
-    "fedai",
-    "fedex",
-    "feebs",
-    "feeds",
-    "feels",
-    "feely",
-    "feens",
-    "feers",
-    "feese",
-    "feeze",
-    "fehme",
-    "feign",
-    "feint",
-    "feist",
-    "felch",
-    "felid",
-    "felix",
-    "fella",
-    "fells",
-    "felly",
-    "felon",
-    "felts",
-    "felty",
-    "femal",
-    "femes",
-    "femic",
-    "femme",
-    "femmy",
-    "femur",
-    "fence",
-    "fends",
-    "fendy",
-    "fenis",
-    "fenks",
-    "fenny",
-    "fents",
-    "feods",
-    "feoff",
-    "feral",
-    "ferer",
-    "feres",
-    "feria",
-    "ferly",
-    "fermi",
-    "ferms",
-    "ferns",
-    "ferny",
-    "ferox",
-    "ferry",
-    "fesse",
-    "festa",
-    "fests",
-    "festy",
-    "fetal",
-    "fetas",
-    "fetch",
-    "feted",
-    "fetes",
-    "fetid",
-    "fetor",
-    "fetta",
-    "fetts",
-    "fetus",
-    "fetwa",
-    "feuar",
-    "feuds",
-    "feued",
-    "fever",
-    "fewer",
-    "feyed",
-    "feyer",
-    "feyly",
-    "fezes",
-    "fezzy",
-    "fiars",
-    "fiats",
-    "fiber",
-    "fibre",
-    "fibro",
-    "fices",
-    "fiche",
-    "fichu",
-    "ficin",
-    "ficos",
-    "ficta",
-    "ficus",
-    "fides",
-    "fidge",
-    "fidos",
-    "fidus",
-    "fiefs",
-    "field",
-    "fiend",
-    "fient",
-    "fiere",
-    "fieri",
-    "fiers",
-    "fiery",
-    "fiest",
-    "fifed",
-    "fifer",
-    "fifes",
-    "fifis",
-    "fifth",
-    "fifty",
-    "figgy",
-    "fight",
-    "figos",
-    "fiked",
-    "fikes",
-    "filar",
-    "filch",
-    "filed",
-    "filer",
-    "files",
-    "filet",
-    "filii",
-    "filks",
-    "fille",
-    "fillo",
-    "fills",
-    "filly",
-    "filmi",
-    "films",
-    "filmy",
-    "filon",
-    "filos",
-    "filth",
-    "filum",
-    "final",
-    "finca",
-    "finch",
-    "finds",
-    "fined",
-    "finer",
-    "fines",
-    "finis",
-    "finks",
-    "finny",
-    "finos",
-    "fiord",
-    "fiqhs",
-    "fique",
-    "fired",
-    "firer",
-    "fires",
-    "firie",
-    "firks",
-    "firma",
-    "firms",
-    "firni",
-    "firns",
-    "firry",
-    "first",
-    "firth",
-    "fiscs",
-    "fisho",
-    "fishy",
-    "fisks",
-    "fists",
-    "fisty",
-    "fitch",
-    "fitly",
-    "fitna",
-    "fitte",
-    "fitts",
-    "fiver",
-    "fives",
-    "fixed",
-    "fixer",
-    "fixes",
-    "fixie",
-    "fixit",
-    "fizzy",
-    "fjeld",
-    "fjord",
-    "flabs",
-    "flack",
-    "flaff",
-    "flags",
-    "flail",
-    "flair",
-    "flake",
-    "flaks",
-    "flaky",
-    "flame",
-    "flamm",
-    "flams",
-    "flamy",
-    "flane",
-    "flank",
-    "flans",
-    "flaps",
-    "flare",
-    "flary",
-    "flash",
-    "flask",
-    "flats",
-    "flava",
-    "flawn",
-    "flaws",
-    "flawy",
-    "flaxy",
-    "flays",
-    "fleam",
-    "fleas",
-    "fleck",
-    "fleek",
-    "fleer",
-    "flees",
-    "fleet",
-    "flegs",
-    "fleme",
-    "flesh",
-    "fleur",
-    "flews",
-    "flexi",
-    "flexo",
-    "fleys",
-    "flick",
-    "flics",
-    "flied",
-    "flier",
-    "flies",
-    "flimp",
-    "flims",
-    "fling",
-    "flint",
-    "flips",
-    "flirs",
-    "flirt",
-    "flisk",
-    "flite",
-    "flits",
-    "flitt",
-    "float",
-    "flobs",
-    "flock",
-    "flocs",
-    "floes",
-    "flogs",
-    "flong",
-    "flood",
-    "floor",
-    "flops",
-    "flora",
-    "flore",
-    "flors",
-    "flory",
-    "flosh",
-    "floss",
-    "flota",
-    "flote",
-    "flour",
-    "flout",
-    "flown",
-    "flows",
-    "flowy",
-    "flubs",
-    "flued",
-    "flues",
-    "fluey",
-    "fluff",
-    "fluid",
-    "fluke",
-    "fluky",
-    "flume",
-    "flump",
-    "flung",
-    "flunk",
-    "fluor",
-    "flurr",
-    "flush",
-    "flute",
-    "fluty",
-    "fluyt",
-    "flyby",
-    "flyer",
-    "flyin",
-    "flype",
-    "flyte",
-    "fnarr",
-    "foals",
-    "foams",
-    "foamy",
-    "focal",
-    "focus",
-    "foehn",
-    "fogey",
-    "foggy",
-    "fogie",
-    "fogle",
-    "fogos",
-    "fogou",
-    "fohns",
-    "foids",
-    "foils",
-    "foins",
-    "foist",
-    "folds",
-    "foley",
-    "folia",
-    "folic",
-    "folie",
-    "folio",
-    "folks",
-    "folky",
-    "folly",
-    "fomes",
-    "fonda",
-    "fonds",
-    "fondu",
-    "fones",
-    "fonio",
-    "fonly",
-    "fonts",
-    "foods",
-    "foody",
-    "fools",
-    "foots",
-    "footy",
-    "foram",
-    "foray",
-    "forbs",
-    "forby",
-    "force",
-    "fordo",
-    "fords",
-    "forel",
-    "fores",
-    "forex",
-    "forge",
-    "forgo",
-    "forks",
-    "forky",
-    "forma",
-    "forme",
-    "forms",
-    "forte",
-    "forth",
-    "forts",
-    "forty",
-    "forum",
-    "forza",
-    "forze",
-    "fossa",
-    "fosse",
-    "fouat",
-    "fouds",
-    "fouer",
-    "fouet",
-    "foule",
-    "fouls",
-    "found",
-    "fount",
-    "fours",
-    "fouth",
-    "fovea",
-    "fowls",
-    "fowth",
-    "foxed",
-    "foxes",
-    "foxie",
-    "foyer",
-    "foyle",
-    "foyne",
-    "frabs",
-    "frack",
-    "fract",
-    "frags",
-    "frail",
-    "fraim",
-    "frais",
-    "frame",
-    "franc",
-    "frank",
-    "frape",
-    "fraps",
-    "frass",
-    "frate",
-    "frati",
-    "frats",
-    "fraud",
-    "fraus",
-    "frays",
-    "freak",
-    "freed",
-    "freer",
-    "frees",
-    "freet",
-    "freit",
-    "fremd",
-    "frena",
-    "freon",
-    "frere",
-    "fresh",
-    "frets",
-    "friar",
-    "fribs",
-    "fried",
-    "frier",
-    "fries",
-    "frigs",
-    "frill",
-    "frise",
-    "frisk",
-    "frist",
-    "frita",
-    "frite",
-    "frith",
-    "frits",
-    "fritt",
-    "fritz",
-    "frize",
-    "frizz",
-    "frock",
-    "froes",
-    "frogs",
-    "fromm",
-    "frond",
-    "frons",
-    "front",
-    "froom",
-    "frore",
-    "frorn",
-    "frory",
-    "frosh",
-    "frost",
-    "froth",
-    "frown",
-    "frows",
-    "frowy",
-    "froyo",
-    "froze",
-    "frugs",
-    "fruit",
-    "frump",
-    "frush",
-    "frust",
-    "fryer",
-    "fubar",
-    "fubby",
-    "fubsy",
-    "fucks",
-    "fucus",
-    "fuddy",
-    "fudge",
-    "fudgy",
-    "fuels",
-    "fuero",
-    "fuffs",
-    "fuffy",
-    "fugal",
-    "fuggy",
-    "fugie",
-    "fugio",
-    "fugis",
-    "fugle",
-    "fugly",
-    "fugue",
-    "fugus",
-    "fujis",
-    "fulla",
-    "fulls",
-    "fully",
-    "fulth",
-    "fulwa",
-    "fumed",
-    "fumer",
-    "fumes",
-    "fumet",
-    "funda",
-    "fundi",
-    "fundo",
-    "funds",
-    "fundy",
-    "fungi",
-    "fungo",
-    "fungs",
-    "funic",
-    "funis",
-    "funks",
-    "funky",
-    "funny",
-    "funsy",
-    "funts",
-    "fural",
-    "furan",
-    "furca",
-    "furls",
-    "furol",
-    "furor",
-    "furos",
-    "furrs",
-    "furry",
-    "furth",
-    "furze",
-    "furzy",
-    "fused",
-    "fusee",
-    "fusel",
-    "fuses",
-    "fusil",
-    "fusks",
-    "fussy",
-    "fusts",
-    "fusty",
-    "futon",
-    "fuzed",
-    "fuzee",
-    "fuzes",
-    "fuzil",
-    "fuzzy",
-    "fyces",
-    "fyked",
-    "fykes",
-    "fyles",
-    "fyrds",
-    "fytte",
-    "gabba",
-    "gabby",
-    "gable",
-    "gaddi",
-    "gades",
-    "gadge",
-    "gadgy",
-    "gadid",
-    "gadis",
-    "gadje",
-    "gadjo",
-    "gadso",
-    "gaffe",
-    "gaffs",
-    "gaged",
-    "gager",
-    "gages",
-    "gaids",
-    "gaily",
-    "gains",
-    "gairs",
-    "gaita",
-    "gaits",
-    "gaitt",
-    "gajos",
-    "galah",
-    "galas",
-    "galax",
-    "galea",
-    "galed",
-    "gales",
-    "galia",
-    "galis",
-    "galls",
-    "gally",
-    "galop",
-    "galut",
-    "galvo",
-    "gamas",
-    "gamay",
-    "gamba",
-    "gambe",
-    "gambo",
-    "gambs",
-    "gamed",
-    "gamer",
-    "games",
-    "gamey",
-    "gamic",
-    "gamin",
-    "gamma",
-    "gamme",
-    "gammy",
-    "gamps",
-    "gamut",
-    "ganch",
-    "gandy",
-    "ganef",
-    "ganev",
-    "gangs",
-    "ganja",
-    "ganks",
-    "ganof",
-    "gants",
-    "gaols",
-    "gaped",
-    "gaper",
-    "gapes",
-    "gapos",
-    "gappy",
-    "garam",
-    "garba",
-    "garbe",
-    "garbo",
-    "garbs",
-    "garda",
-    "garde",
-    "gares",
-    "garis",
-    "garms",
-    "garni",
-    "garre",
-    "garri",
-    "garth",
-    "garum",
-    "gases",
-    "gashy",
-    "gasps",
-    "gaspy",
-    "gassy",
-    "gasts",
-    "gatch",
-    "gated",
-    "gater",
-    "gates",
-    "gaths",
-    "gator",
-    "gauch",
-    "gaucy",
-    "gauds",
-    "gaudy",
-    "gauge",
-    "gauje",
-    "gault",
-    "gaums",
-    "gaumy",
-    "gaunt",
-    "gaups",
-    "gaurs",
-    "gauss",
-    "gauze",
-    "gauzy",
-    "gavel",
-    "gavot",
-    "gawcy",
-    "gawds",
-    "gawks",
-    "gawky",
-    "gawps",
-    "gawsy",
-    "gayal",
-    "gayer",
-    "gayly",
-    "gazal",
-    "gazar",
-    "gazed",
-    "gazer",
-    "gazes",
-    "gazon",
-    "gazoo",
-    "geals",
-    "geans",
-    "geare",
-    "gears",
-    "geasa",
-    "geats",
-    "gebur",
-    "gecko",
-    "gecks",
-    "geeks",
-    "geeky",
-    "geeps",
-    "geese",
-    "geest",
-    "geist",
-    "geits",
-    "gelds",
-    "gelee",
-    "gelid",
-    "gelly",
-    "gelts",
-    "gemel",
-    "gemma",
-    "gemmy",
-    "gemot",
-    "genae",
-    "genal",
-    "genas",
-    "genes",
-    "genet",
-    "genic",
-    "genie",
-    "genii",
-    "genin",
-    "genio",
-    "genip",
-    "genny",
-    "genoa",
-    "genom",
-    "genre",
-    "genro",
-    "gents",
-    "genty",
-    "genua",
-    "genus",
-    "geode",
-    "geoid",
-    "gerah",
-    "gerbe",
-    "geres",
-    "gerle",
-    "germs",
-    "germy",
-    "gerne",
-    "gesse",
-    "gesso",
-    "geste",
-    "gests",
-    "getas",
-    "getup",
-    "geums",
-    "geyan",
-    "geyer",
-    "ghast",
-    "ghats",
-    "ghaut",
-    "ghazi",
-    "ghees",
-    "ghest",
-    "ghost",
-    "ghoul",
-    "ghusl",
-    "ghyll",
-    "giant",
-    "gibed",
-    "gibel",
-    "giber",
-    "gibes",
-    "gibli",
-    "gibus",
-    "giddy",
-    "gifts",
-    "gigas",
-    "gighe",
-    "gigot",
-    "gigue",
-    "gilas",
-    "gilds",
-    "gilet",
-    "gilia",
-    "gills",
-    "gilly",
-    "gilpy",
-    "gilts",
-    "gimel",
-    "gimme",
-    "gimps",
-    "gimpy",
-    "ginch",
-    "ginga",
-    "ginge",
-    "gings",
-    "ginks",
-    "ginny",
-    "ginzo",
-    "gipon",
-    "gippo",
-    "gippy",
-    "gipsy",
-    "girds",
-    "girlf",
-    "girls",
-    "girly",
-    "girns",
-    "giron",
-    "giros",
-    "girrs",
-    "girsh",
-    "girth",
-    "girts",
-    "gismo",
-    "gisms",
-    "gists",
-    "gitch",
-    "gites",
-    "giust",
-    "gived",
-    "given",
-    "giver",
-    "gives",
-    "gizmo",
-    "glace",
-    "glade",
-    "glads",
-    "glady",
-    "glaik",
-    "glair",
-    "glamp",
-    "glams",
-    "gland",
-    "glans",
-    "glare",
-    "glary",
-    "glass",
-    "glatt",
-    "glaum",
-    "glaur",
-    "glaze",
-    "glazy",
-    "gleam",
-    "glean",
-    "gleba",
-    "glebe",
-    "gleby",
-    "glede",
-    "gleds",
-    "gleed",
-    "gleek",
-    "glees",
-    "gleet",
-    "gleis",
-    "glens",
-    "glent",
-    "gleys",
-    "glial",
-    "glias",
-    "glibs",
-    "glide",
-    "gliff",
-    "glift",
-    "glike",
-    "glime",
-    "glims",
-    "glint",
-    "glisk",
-    "glits",
-    "glitz",
-    "gloam",
-    "gloat",
-    "globe",
-    "globi",
-    "globs",
-    "globy",
-    "glode",
-    "glogg",
-    "gloms",
-    "gloom",
-    "gloop",
-    "glops",
-    "glory",
-    "gloss",
-    "glost",
-    "glout",
-    "glove",
-    "glows",
-    "glowy",
-    "gloze",
-    "glued",
-    "gluer",
-    "glues",
-    "gluey",
-    "glugg",
-    "glugs",
-    "glume",
-    "glums",
-    "gluon",
-    "glute",
-    "gluts",
-    "glyph",
-    "gnapi",
-    "gnarl",
-    "gnarr",
-    "gnars",
-    "gnash",
-    "gnats",
-    "gnawn",
-    "gnaws",
-    "gnome",
-    "gnows",
-    "goads",
-    "goafs",
-    "goaft",
-    "goals",
-    "goary",
-    "goats",
-    "goaty",
-    "goave",
-    "goban",
-    "gobar",
-    "gobbe",
-    "gobbi",
-    "gobbo",
-    "gobby",
-    "gobis",
-    "gobos",
-    "godet",
-    "godly",
-    "godso",
-    "goels",
-    "goers",
-    "goest",
-    "goeth",
-    "goety",
-    "gofer",
-    "goffs",
-    "gogga",
-    "gogos",
-    "goier",
-    "going",
-    "gojis",
-    "gokes",
-    "golds",
-    "goldy",
-    "golem",
-    "goles",
-    "golfs",
-    "golly",
-    "golpe",
-    "golps",
-    "gombo",
-    "gomer",
-    "gompa",
-    "gonad",
-    "gonch",
-    "gonef",
-    "goner",
-    "gongs",
-    "gonia",
-    "gonif",
-    "gonks",
-    "gonna",
-    "gonof",
-    "gonys",
-    "gonzo",
-    "gooby",
-    "goodo",
-    "goods",
-    "goody",
-    "gooey",
-    "goofs",
-    "goofy",
-    "googs",
-    "gooks",
-    "gooky",
-    "goold",
-    "gools",
-    "gooly",
-    "goomy",
-    "goons",
-    "goony",
-    "goops",
-    "goopy",
-    "goors",
-    "goory",
-    "goose",
-    "goosy",
-    "gopak",
-    "gopik",
-    "goral",
-    "goras",
-    "goray",
-    "gorbs",
-    "gordo",
-    "gored",
-    "gores",
-    "gorge",
-    "goris",
-    "gorms",
-    "gormy",
-    "gorps",
-    "gorse",
-    "gorsy",
-    "gosht",
-    "gosse",
-    "gotch",
-    "goths",
-    "gothy",
-    "gotta",
-    "gouch",
-    "gouge",
-    "gouks",
-    "goura",
-    "gourd",
-    "gouts",
-    "gouty",
-    "goved",
-    "goves",
-    "gowan",
-    "gowds",
-    "gowfs",
-    "gowks",
-    "gowls",
-    "gowns",
-    "goxes",
-    "goyim",
-    "goyle",
-    "graal",
-    "grabs",
-    "grace",
-    "grade",
-    "grads",
-    "graff",
-    "graft",
-    "grail",
-    "grain",
-    "graip",
-    "grama",
-    "grame",
-    "gramp",
-    "grams",
-    "grana",
-    "grand",
-    "grano",
-    "grans",
-    "grant",
-    "grape",
-    "graph",
-    "grapy",
-    "grasp",
-    "grass",
-    "grata",
-    "grate",
-    "grats",
-    "grave",
-    "gravs",
-    "gravy",
-    "grays",
-    "graze",
-    "great",
-    "grebe",
-    "grebo",
-    "grece",
-    "greed",
-    "greek",
-    "green",
-    "grees",
-    "greet",
-    "grege",
-    "grego",
-    "grein",
-    "grens",
-    "greps",
-    "grese",
-    "greve",
-    "grews",
-    "greys",
-    "grice",
-    "gride",
-    "grids",
-    "grief",
-    "griff",
-    "grift",
-    "grigs",
-    "grike",
-    "grill",
-    "grime",
-    "grimy",
-    "grind",
-    "grins",
-    "griot",
-    "gripe",
-    "grips",
-    "gript",
-    "gripy",
-    "grise",
-    "grist",
-    "grisy",
-    "grith",
-    "grits",
-    "grize",
-    "groan",
-    "groat",
-    "grody",
-    "grogs",
-    "groin",
-    "groks",
-    "groma",
-    "groms",
-    "grone",
-    "groof",
-    "groom",
-    "grope",
-    "gross",
-    "grosz",
-    "grots",
-    "grouf",
-    "group",
-    "grout",
-    "grove",
-    "grovy",
-    "growl",
-    "grown",
-    "grows",
-    "grrls",
-    "grrrl",
-    "grubs",
-    "grued",
-    "gruel",
-    "grues",
-    "grufe",
-    "gruff",
-    "grume",
-    "grump",
-    "grund",
-    "grunt",
-    "gryce",
-    "gryde",
-    "gryke",
-    "grype",
-    "grypt",
-    "guaco",
-    "guana",
-    "guano",
-    "guans",
-    "guard",
-    "guars",
-    "guava",
-    "gubba",
-    "gucks",
-    "gucky",
-    "gudes",
-    "guess",
-    "guest",
-    "guffs",
-    "gugas",
-    "guggl",
-    "guide",
-    "guido",
-    "guids",
-    "guild",
-    "guile",
-    "guilt",
-    "guimp",
-    "guiro",
-    "guise",
-    "gulab",
-    "gulag",
-    "gular",
-    "gulas",
-    "gulch",
-    "gules",
-    "gulet",
-    "gulfs",
-    "gulfy",
-    "gulls",
-    "gully",
-    "gulph",
-    "gulps",
-    "gulpy",
-    "gumbo",
-    "gumma",
-    "gummi",
-    "gummy",
-    "gumps",
-    "gunas",
-    "gundi",
-    "gundy",
-    "gunge",
-    "gungy",
-    "gunks",
-    "gunky",
-    "gunny",
-    "guppy",
-    "guqin",
-    "gurdy",
-    "gurge",
-    "gurks",
-    "gurls",
-    "gurly",
-    "gurns",
-    "gurry",
-    "gursh",
-    "gurus",
-    "gushy",
-    "gusla",
-    "gusle",
-    "gusli",
-    "gussy",
-    "gusto",
-    "gusts",
-    "gusty",
-    "gutsy",
-    "gutta",
-    "gutty",
-    "guyed",
-    "guyle",
-    "guyot",
-    "guyse",
-    "gwine",
-    "gyals",
-    "gyans",
-    "gybed",
-    "gybes",
-    "gyeld",
-    "gymps",
-    "gynae",
-    "gynie",
-    "gynny",
-    "gynos",
-    "gyoza",
-    "gypes",
-    "gypos",
-    "gyppo",
-    "gyppy",
-    "gypsy",
-    "gyral",
-    "gyred",
-    "gyres",
-    "gyron",
-    "gyros",
-    "gyrus",
-    "gytes",
-    "gyved",
-    "gyver",
-    "gyves",
-    "haafs",
-    "haars",
-    "haats",
-    "habit",
-    "hable",
-    "habus",
-    "hacek",
-    "hacks",
-    "hacky",
-    "hadal",
-    "haded",
-    "hades",
-    "hadji",
-    "hadst",
-    "haems",
-    "haere",
-    "haets",
-    "haffs",
-    "hafiz",
-    "hafta",
-    "hafts",
-    "haggs",
-    "haham",
-    "hahas",
-    "haick",
-    "haika",
-    "haiks",
-    "haiku",
-    "hails",
-    "haily",
-    "hains",
-    "haint",
-    "hairs",
-    "hairy",
-    "haith",
-    "hajes",
-    "hajis",
-    "hajji",
-    "hakam",
-    "hakas",
-    "hakea",
-    "hakes",
-    "hakim",
-    "hakus",
-    "halal",
-    "haldi",
-    "haled",
-    "haler",
-    "hales",
-    "halfa",
-    "halfs",
-    "halid",
-    "hallo",
-    "halls",
-    "halma",
-    "halms",
-    "halon",
-    "halos",
-    "halse",
-    "halsh",
-    "halts",
-    "halva",
-    "halve",
-    "halwa",
-    "hamal",
-    "hamba",
-    "hamed",
-    "hamel",
-    "hames",
-    "hammy",
-    "hamza",
-    "hanap",
-    "hance",
-    "hanch",
-    "handi",
-    "hands",
-    "handy",
-    "hangi",
-    "hangs",
-    "hanks",
-    "hanky",
-    "hansa",
-    "hanse",
-    "hants",
-    "haole",
-    "haoma",
-    "hapas",
-    "hapax",
-    "haply",
-    "happi",
-    "happy",
-    "hapus",
-    "haram",
-    "hards",
-    "hardy",
-    "hared",
-    "harem",
-    "hares",
-    "harim",
-    "harks",
-    "harls",
-    "harms",
-    "harns",
-    "haros",
-    "harps",
-    "harpy",
-    "harry",
-    "harsh",
-    "harts",
-    "hashy",
-    "hasks",
-    "hasps",
-    "hasta",
-    "haste",
-    "hasty",
-    "hatch",
-    "hated",
-    "hater",
-    "hates",
-    "hatha",
-    "hathi",
-    "hatty",
-    "hauds",
-    "haufs",
-    "haugh",
-    "haugo",
-    "hauld",
-    "haulm",
-    "hauls",
-    "hault",
-    "hauns",
-    "haunt",
-    "hause",
-    "haute",
-    "havan",
-    "havel",
-    "haven",
-    "haver",
-    "haves",
-    "havoc",
-    "hawed",
-    "hawks",
-    "hawms",
-    "hawse",
-    "hayed",
-    "hayer",
-    "hayey",
-    "hayle",
-    "hazan",
-    "hazed",
-    "hazel",
-    "hazer",
-    "hazes",
-    "hazle",
-    "heads",
-    "heady",
-    "heald",
-    "heals",
-    "heame",
-    "heaps",
-    "heapy",
-    "heard",
-    "heare",
-    "hears",
-    "heart",
-    "heast",
-    "heath",
-    "heats",
-    "heaty",
-    "heave",
-    "heavy",
-    "heben",
-    "hebes",
-    "hecht",
-    "hecks",
-    "heder",
-    "hedge",
-    "hedgy",
-    "heeds",
-    "heedy",
-    "heels",
-    "heeze",
-    "hefte",
-    "hefts",
-    "hefty",
-    "heiau",
-    "heids",
-    "heigh",
-    "heils",
-    "heirs",
-    "heist",
-    "hejab",
-    "hejra",
-    "heled",
-    "heles",
-    "helio",
-    "helix",
-    "hella",
-    "hello",
-    "hells",
-    "helly",
-    "helms",
-    "helos",
-    "helot",
-    "helps",
-    "helve",
-    "hemal",
-    "hemes",
-    "hemic",
-    "hemin",
-    "hemps",
-    "hempy",
-    "hence",
-    "hench",
-    "hends",
-    "henge",
-    "henna",
-    "henny",
-    "henry",
-    "hents",
-    "hepar",
-    "herbs",
-    "herby",
-    "herds",
-    "heres",
-    "herls",
-    "herma",
-    "herms",
-    "herns",
-    "heron",
-    "heros",
-    "herps",
-    "herry",
-    "herse",
-    "hertz",
-    "herye",
-    "hesps",
-    "hests",
-    "hetes",
-    "heths",
-    "heuch",
-    "heugh",
-    "hevea",
-    "hevel",
-    "hewed",
-    "hewer",
-    "hewgh",
-    "hexad",
-    "hexed",
-    "hexer",
-    "hexes",
-    "hexyl",
-    "heyed",
-    "hiant",
-    "hibas",
-    "hicks",
-    "hided",
-    "hider",
-    "hides",
-    "hiems",
-    "hifis",
-    "highs",
-    "hight",
-    "hijab",
-    "hijra",
-    "hiked",
-    "hiker",
-    "hikes",
-    "hikoi",
-    "hilar",
-    "hilch",
-    "hillo",
-    "hills",
-    "hilly",
-    "hilsa",
-    "hilts",
-    "hilum",
-    "hilus",
-    "himbo",
-    "hinau",
-    "hinds",
-    "hinge",
-    "hings",
-    "hinky",
-    "hinny",
-    "hints",
-    "hiois",
-    "hiped",
-    "hiper",
-    "hipes",
-    "hiply",
-    "hippo",
-    "hippy",
-    "hired",
-    "hiree",
-    "hirer",
-    "hires",
-    "hissy",
-    "hists",
-    "hitch",
-    "hithe",
-    "hived",
-    "hiver",
-    "hives",
-    "hizen",
-    "hoach",
-    "hoaed",
-    "hoagy",
-    "hoard",
-    "hoars",
-    "hoary",
-    "hoast",
-    "hobby",
-    "hobos",
-    "hocks",
-    "hocus",
-    "hodad",
-    "hodja",
-    "hoers",
-    "hogan",
-    "hogen",
-    "hoggs",
-    "hoghs",
-    "hogoh",
-    "hogos",
-    "hohed",
-    "hoick",
-    "hoied",
-    "hoiks",
-    "hoing",
-    "hoise",
-    "hoist",
-    "hokas",
-    "hoked",
-    "hokes",
-    "hokey",
-    "hokis",
-    "hokku",
-    "hokum",
-    "holds",
-    "holed",
-    "holes",
-    "holey",
-    "holks",
-    "holla",
-    "hollo",
-    "holly",
-    "holme",
-    "holms",
-    "holon",
-    "holos",
-    "holts",
-    "homas",
-    "homed",
-    "homer",
-    "homes",
-    "homey",
-    "homie",
-    "homme",
-    "homos",
-    "honan",
-    "honda",
-    "honds",
-    "honed",
-    "honer",
-    "hones",
-    "honey",
-    "hongi",
-    "hongs",
-    "honks",
-    "honky",
-    "honor",
-    "hooch",
-    "hoods",
-    "hoody",
-    "hooey",
-    "hoofs",
-    "hoogo",
-    "hooha",
-    "hooka",
-    "hooks",
-    "hooky",
-    "hooly",
-    "hoons",
-    "hoops",
-    "hoord",
-    "hoors",
-    "hoosh",
-    "hoots",
-    "hooty",
-    "hoove",
-    "hopak",
-    "hoped",
-    "hoper",
-    "hopes",
-    "hoppy",
-    "horah",
-    "horal",
-    "horas",
-    "horde",
-    "horis",
-    "horks",
-    "horme",
-    "horns",
-    "horny",
-    "horse",
-    "horst",
-    "horsy",
-    "hosed",
-    "hosel",
-    "hosen",
-    "hoser",
-    "hoses",
-    "hosey",
-    "hosta",
-    "hosts",
-    "hotch",
-    "hotel",
-    "hoten",
-    "hotis",
-    "hotly",
-    "hotte",
-    "hotty",
-    "houff",
-    "houfs",
-    "hough",
-    "hound",
-    "houri",
-    "hours",
-    "house",
-    "houts",
-    "hovea",
-    "hoved",
-    "hovel",
-    "hoven",
-    "hover",
-    "hoves",
-    "howay",
-    "howbe",
-    "howdy",
-    "howes",
-    "howff",
-    "howfs",
-    "howks",
-    "howls",
-    "howre",
-    "howso",
-    "howto",
-    "hoxed",
-    "hoxes",
-    "hoyas",
-    "hoyed",
-    "hoyle",
-    "hubba",
-    "hubby",
-    "hucks",
-    "hudna",
-    "hudud",
-    "huers",
-    "huffs",
-    "huffy",
-    "huger",
-    "huggy",
-    "huhus",
-    "huias",
-    "huies",
-    "hukou",
-    "hulas",
-    "hules",
-    "hulks",
-    "hulky",
-    "hullo",
-    "hulls",
-    "hully",
-    "human",
-    "humas",
-    "humfs",
-    "humic",
-    "humid",
-    "humor",
-    "humph",
-    "humps",
-    "humpy",
-    "humus",
-    "hunch",
-    "hundo",
-    "hunks",
-    "hunky",
-    "hunts",
-    "hurds",
-    "hurls",
-    "hurly",
-    "hurra",
-    "hurry",
-    "hurst",
-    "hurts",
-    "hurty",
-    "hushy",
-    "husks",
-    "husky",
-    "husos",
-    "hussy",
-    "hutch",
-    "hutia",
-    "huzza",
-    "huzzy",
-    "hwyls",
-    "hydel",
-    "hydra",
-    "hydro",
-    "hyena",
-    "hyens",
-    "hygge",
-    "hying",
-    "hykes",
-    "hylas",
-    "hyleg",
-    "hyles",
-    "hylic",
-    "hymen",
-    "hymns",
-    "hynde",
-    "hyoid",
-    "hyped",
-    "hyper",
-    "hypes",
-    "hypha",
-    "hyphy",
-    "hypos",
-    "hyrax",
-    "hyson",
-    "hythe",
-    "iambi",
-    "iambs",
-    "ibrik",
-    "icers",
-    "iched",
-    "iches",
-    "ichor",
-    "icier",
-    "icily",
-    "icing",
-    "icker",
-    "ickle",
-    "icons",
-    "ictal",
-    "ictic",
-    "ictus",
-    "idant",
-    "iddah",
-    "iddat",
-    "iddut",
-    "ideal",
-    "ideas",
-    "idees",
-    "ident",
-    "idiom",
-    "idiot",
-    "idled",
-    "idler",
-    "idles",
-    "idlis",
-    "idola",
-    "idols",
-    "idyll",
-    "idyls",
-    "iftar",
-    "igapo",
-    "igged",
-    "igloo",
-    "iglus",
-    "ignis",
-    "ihram",
-    "iiwis",
-    "ikans",
-    "ikats",
-    "ikons",
-    "ileac",
-    "ileal",
-    "ileum",
-    "ileus",
-    "iliac",
-    "iliad",
-    "ilial",
-    "ilium",
-    "iller",
-    "illth",
-    "image",
-    "imago",
-    "imagy",
-    "imams",
-    "imari",
-    "imaum",
-    "imbar",
-    "imbed",
-    "imbos",
-    "imbue",
-    "imide",
-    "imido",
-    "imids",
-    "imine",
-    "imino",
-    "imlis",
-    "immew",
-    "immit",
-    "immix",
-    "imped",
-    "impel",
-    "impis",
-    "imply",
-    "impot",
-    "impro",
-    "imshi",
-    "imshy",
-    "inane",
-    "inapt",
-    "inarm",
-    "inbox",
-    "inbye",
-    "incas",
-    "incel",
-    "incle",
-    "incog",
-    "incur",
-    "incus",
-    "incut",
-    "indew",
-    "index",
-    "india",
-    "indie",
-    "indol",
-    "indow",
-    "indri",
-    "indue",
-    "inept",
-    "inerm",
-    "inert",
-    "infer",
-    "infix",
-    "infos",
-    "infra",
-    "ingan",
-    "ingle",
-    "ingot",
-    "inion",
-    "inked",
-    "inker",
-    "inkle",
-    "inlay",
-    "inlet",
-    "inned",
-    "inner",
-    "innie",
-    "innit",
-    "inorb",
-    "input",
-    "inros",
-    "inrun",
-    "insee",
-    "inset",
-    "inspo",
-    "intel",
-    "inter",
-    "intil",
-    "intis",
-    "intra",
-    "intro",
-    "inula",
-    "inure",
-    "inurn",
-    "inust",
-    "invar",
-    "inver",
-    "inwit",
-    "iodic",
-    "iodid",
-    "iodin",
-    "ionic",
-    "ioras",
-    "iotas",
-    "ippon",
-    "irade",
-    "irate",
-    "irids",
-    "iring",
-    "irked",
-    "iroko",
-    "irone",
-    "irons",
-    "irony",
-    "isbas",
-    "ishes",
-    "isled",
-    "isles",
-    "islet",
-    "isnae",
-    "issei",
-    "issue",
-    "istle",
-    "itchy",
-    "items",
-    "ither",
-    "ivied",
-    "ivies",
-    "ivory",
-    "ixias",
-    "ixnay",
-    "ixora",
-    "ixtle",
-    "izard",
-    "izars",
-    "izzat",
-    "jaaps",
-    "jabot",
-    "jacal",
-    "jacet",
-    "jacks",
-    "jacky",
-    "jaded",
-    "jades",
-    "jafas",
-    "jaffa",
-    "jagas",
-    "jager",
-    "jaggs",
-    "jaggy",
-    "jagir",
-    "jagra",
-    "jails",
-    "jaker",
-    "jakes",
-    "jakey",
-    "jakie",
-    "jalap",
-    "jaleo",
-    "jalop",
-    "jambe",
-    "jambo",
-    "jambs",
-    "jambu",
-    "james",
-    "jammy",
-    "jamon",
-    "jamun",
-    "janes",
-    "janky",
-    "janns",
-    "janny",
-    "janty",
-    "japan",
-    "japed",
-    "japer",
-    "japes",
-    "jarks",
-    "jarls",
-    "jarps",
-    "jarta",
-    "jarul",
-    "jasey",
-    "jaspe",
-    "jasps",
-    "jatha",
-    "jatis",
-    "jatos",
-    "jauks",
-    "jaune",
-    "jaunt",
-    "jaups",
-    "javas",
-    "javel",
-    "jawan",
-    "jawed",
-    "jawns",
-    "jaxie",
-    "jazzy",
-    "jeans",
-    "jeats",
-    "jebel",
-    "jedis",
-    "jeels",
-    "jeely",
-    "jeeps",
-    "jeera",
-    "jeers",
-    "jeeze",
-    "jefes",
-    "jeffs",
-    "jehad",
-    "jehus",
-    "jelab",
-    "jello",
-    "jells",
-    "jelly",
-    "jembe",
-    "jemmy",
-    "jenny",
-    "jeons",
-    "jerid",
-    "jerks",
-    "jerky",
-    "jerry",
-    "jesse",
-    "jessy",
-    "jests",
-    "jesus",
-    "jetee",
-    "jetes",
-    "jeton",
-    "jetty",
-    "jeune",
-    "jewed",
-    "jewel",
-    "jewie",
-    "jhala",
-    "jheel",
-    "jhils",
-    "jiaos",
-    "jibba",
-    "jibbs",
-    "jibed",
-    "jiber",
-    "jibes",
-    "jiffs",
-    "jiffy",
-    "jiggy",
-    "jigot",
-    "jihad",
-    "jills",
-    "jilts",
-    "jimmy",
-    "jimpy",
-    "jingo",
-    "jings",
-    "jinks",
-    "jinne",
-    "jinni",
-    "jinns",
-    "jirds",
-    "jirga",
-    "jirre",
-    "jisms",
-    "jitis",
-    "jitty",
-    "jived",
-    "jiver",
-    "jives",
-    "jivey",
-    "jnana",
-    "jobed",
-    "jobes",
-    "jocko",
-    "jocks",
-    "jocky",
-    "jocos",
-    "jodel",
-    "joeys",
-    "johns",
-    "joins",
-    "joint",
-    "joist",
-    "joked",
-    "joker",
-    "jokes",
-    "jokey",
-    "jokol",
-    "joled",
-    "joles",
-    "jolie",
-    "jollo",
-    "jolls",
-    "jolly",
-    "jolts",
-    "jolty",
-    "jomon",
-    "jomos",
-    "jones",
-    "jongs",
-    "jonty",
-    "jooks",
-    "joram",
-    "jorts",
-    "jorum",
-    "jotas",
-    "jotty",
-    "jotun",
-    "joual",
-    "jougs",
-    "jouks",
-    "joule",
-    "jours",
-    "joust",
-    "jowar",
-    "jowed",
-    "jowls",
-    "jowly",
-    "joyed",
-    "jubas",
-    "jubes",
-    "jucos",
-    "judas",
-    "judge",
-    "judgy",
-    "judos",
-    "jugal",
-    "jugum",
-    "juice",
-    "juicy",
-    "jujus",
-    "juked",
-    "jukes",
-    "jukus",
-    "julep",
-    "julia",
-    "jumar",
-    "jumbo",
-    "jumby",
-    "jumps",
-    "jumpy",
-    "junco",
-    "junks",
-    "junky",
-    "junta",
-    "junto",
-    "jupes",
-    "jupon",
-    "jural",
-    "jurat",
-    "jurel",
-    "jures",
-    "juris",
-    "juror",
-    "juste",
-    "justs",
-    "jutes",
-    "jutty",
-    "juves",
-    "juvie",
-    "kaama",
-    "kabab",
-    "kabar",
-    "kabob",
-    "kacha",
-    "kacks",
-    "kadai",
-    "kades",
-    "kadis",
-    "kafir",
-    "kagos",
-    "kagus",
-    "kahal",
-    "kaiak",
-    "kaids",
-    "kaies",
-    "kaifs",
-    "kaika",
-    "kaiks",
-    "kails",
-    "kaims",
-    "kaing",
-    "kains",
-    "kajal",
-    "kakas",
-    "kakis",
-    "kalam",
-    "kalas",
-    "kales",
-    "kalif",
-    "kalis",
-    "kalpa",
-    "kalua",
-    "kamas",
-    "kames",
-    "kamik",
-    "kamis",
-    "kamme",
-    "kanae",
-    "kanal",
-    "kanas",
-    "kanat",
-    "kandy",
-    "kaneh",
-    "kanes",
-    "kanga",
-    "kangs",
-    "kanji",
-    "kants",
-    "kanzu",
-    "kaons",
-    "kapai",
-    "kapas",
-    "kapha",
-    "kaphs",
-    "kapok",
-    "kapow",
-    "kappa",
-    "kapur",
-    "kapus",
-    "kaput",
-    "karai",
-    "karas",
-    "karat",
-    "karee",
-    "karez",
-    "karks",
-    "karma",
-    "karns",
-    "karoo",
-    "karos",
-    "karri",
-    "karst",
-    "karsy",
-    "karts",
-    "karzy",
-    "kasha",
-    "kasme",
-    "katal",
-    "katas",
-    "katis",
-    "katti",
-    "kaugh",
-    "kauri",
-    "kauru",
-    "kaury",
-    "kaval",
-    "kavas",
-    "kawas",
-    "kawau",
-    "kawed",
-    "kayak",
-    "kayle",
-    "kayos",
-    "kazis",
-    "kazoo",
-    "kbars",
-    "kcals",
-    "keaki",
-    "kebab",
-    "kebar",
-    "kebob",
-    "kecks",
-    "kedge",
-    "kedgy",
-    "keech",
-    "keefs",
-    "keeks",
-    "keels",
-    "keema",
-    "keeno",
-    "keens",
-    "keeps",
-    "keets",
-    "keeve",
-    "kefir",
-    "kehua",
-    "keirs",
-    "kelep",
-    "kelim",
-    "kells",
-    "kelly",
-    "kelps",
-    "kelpy",
-    "kelts",
-    "kelty",
-    "kembo",
-    "kembs",
-    "kemps",
-    "kempt",
-    "kempy",
-    "kenaf",
-    "kench",
-    "kendo",
-    "kenos",
-    "kente",
-    "kents",
-    "kepis",
-    "kerbs",
-    "kerel",
-    "kerfs",
-    "kerky",
-    "kerma",
-    "kerne",
-    "kerns",
-    "keros",
-    "kerry",
-    "kerve",
-    "kesar",
-    "kests",
-    "ketas",
-    "ketch",
-    "ketes",
-    "ketol",
-    "kevel",
-    "kevil",
-    "kexes",
-    "keyed",
-    "keyer",
-    "khadi",
-    "khads",
-    "khafs",
-    "khaki",
-    "khana",
-    "khans",
-    "khaph",
-    "khats",
-    "khaya",
-    "khazi",
-    "kheda",
-    "kheer",
-    "kheth",
-    "khets",
-    "khirs",
-    "khoja",
-    "khors",
-    "khoum",
-    "khuds",
-    "khula",
-    "khyal",
-    "kiaat",
-    "kiack",
-    "kiaki",
-    "kiang",
-    "kiasu",
-    "kibbe",
-    "kibbi",
-    "kibei",
-    "kibes",
-    "kibla",
-    "kicks",
-    "kicky",
-    "kiddo",
-    "kiddy",
-    "kidel",
-    "kideo",
-    "kidge",
-    "kiefs",
-    "kiers",
-    "kieve",
-    "kievs",
-    "kight",
-    "kikay",
-    "kikes",
-    "kikoi",
-    "kiley",
-    "kilig",
-    "kilim",
-    "kills",
-    "kilns",
-    "kilos",
-    "kilps",
-    "kilts",
-    "kilty",
-    "kimbo",
-    "kimet",
-    "kinas",
-    "kinda",
-    "kinds",
-    "kindy",
-    "kines",
-    "kings",
-    "kingy",
-    "kinin",
-    "kinks",
-    "kinky",
-    "kinos",
-    "kiore",
-    "kiosk",
-    "kipah",
-    "kipas",
-    "kipes",
-    "kippa",
-    "kipps",
-    "kipsy",
-    "kirby",
-    "kirks",
-    "kirns",
-    "kirri",
-    "kisan",
-    "kissy",
-    "kists",
-    "kitab",
-    "kited",
-    "kiter",
-    "kites",
-    "kithe",
-    "kiths",
-    "kitke",
-    "kitty",
-    "kitul",
-    "kivas",
-    "kiwis",
-    "klang",
-    "klaps",
-    "klett",
-    "klick",
-    "klieg",
-    "kliks",
-    "klong",
-    "kloof",
-    "kluge",
-    "klutz",
-    "knack",
-    "knags",
-    "knaps",
-    "knarl",
-    "knars",
-    "knaur",
-    "knave",
-    "knawe",
-    "knead",
-    "kneed",
-    "kneel",
-    "knees",
-    "knell",
-    "knelt",
-    "knick",
-    "knife",
-    "knish",
-    "knits",
-    "knive",
-    "knobs",
-    "knock",
-    "knoll",
-    "knoop",
-    "knops",
-    "knosp",
-    "knots",
-    "knoud",
-    "knout",
-    "knowd",
-    "knowe",
-    "known",
-    "knows",
-    "knubs",
-    "knule",
-    "knurl",
-    "knurr",
-    "knurs",
-    "knuts",
-    "koala",
-    "koans",
-    "koaps",
-    "koban",
-    "kobos",
-    "koels",
-    "koffs",
-    "kofta",
-    "kogal",
-    "kohas",
-    "kohen",
-    "kohls",
-    "koine",
-    "koiwi",
-    "kojis",
-    "kokam",
-    "kokas",
-    "koker",
-    "kokra",
-    "kokum",
-    "kolas",
-    "kolos",
-    "kombi",
-    "kombu",
-    "konbu",
-    "kondo",
-    "konks",
-    "kooks",
-    "kooky",
-    "koori",
-    "kopek",
-    "kophs",
-    "kopje",
-    "koppa",
-    "korai",
-    "koran",
-    "koras",
-    "korat",
-    "kores",
-    "koris",
-    "korma",
-    "koros",
-    "korun",
-    "korus",
-    "koses",
-    "kotch",
-    "kotos",
-    "kotow",
-    "koura",
-    "kraal",
-    "krabs",
-    "kraft",
-    "krais",
-    "krait",
-    "krang",
-    "krans",
-    "kranz",
-    "kraut",
-    "krays",
-    "kreef",
-    "kreen",
-    "kreep",
-    "kreng",
-    "krewe",
-    "krill",
-    "kriol",
-    "krona",
-    "krone",
-    "kroon",
-    "krubi",
-    "krump",
-    "krunk",
-    "ksars",
-    "kubie",
-    "kudos",
-    "kudus",
-    "kudzu",
-    "kufis",
-    "kugel",
-    "kuias",
-    "kukri",
-    "kukus",
-    "kulak",
-    "kulan",
-    "kulas",
-    "kulfi",
-    "kumis",
-    "kumys",
-    "kunas",
-    "kunds",
-    "kuris",
-    "kurre",
-    "kurta",
-    "kurus",
-    "kusso",
-    "kusti",
-    "kutai",
-    "kutas",
-    "kutch",
-    "kutis",
-    "kutus",
-    "kuyas",
-    "kuzus",
-    "kvass",
-    "kvell",
-    "kwaai",
-    "kwela",
-    "kwink",
-    "kwirl",
-    "kyack",
-    "kyaks",
-    "kyang",
-    "kyars",
-    "kyats",
-    "kybos",
-    "kydst",
-    "kyles",
-    "kylie",
-    "kylin",
-    "kylix",
-    "kyloe",
-    "kynde",
-    "kynds",
-    "kypes",
-    "kyrie",
-    "kytes",
-    "kythe",
-    "kyudo",
-    "laarf",
-    "laari",
-    "labda",
-    "label",
-    "labia",
-    "labis",
-    "labne",
-    "labor",
-    "labra",
-    "laccy",
-    "laced",
-    "lacer",
-    "laces",
-    "lacet",
-    "lacey",
-    "lacis",
-    "lacka",
-    "lacks",
-    "lacky",
-    "laddu",
-    "laddy",
-    "laded",
-    "ladee",
-    "laden",
-    "lader",
-    "lades",
-    "ladle",
-    "ladoo",
-    "laers",
-    "laevo",
-    "lagan",
-    "lagar",
-    "lager",
-    "laggy",
-    "lahal",
-    "lahar",
-    "laich",
-    "laics",
-    "laide",
-    "laids",
-    "laigh",
-    "laika",
-    "laiks",
-    "laird",
-    "lairs",
-    "lairy",
-    "laith",
-    "laity",
-    "laked",
-    "laker",
-    "lakes",
-    "lakhs",
-    "lakin",
-    "laksa",
-    "laldy",
-    "lalls",
-    "lamas",
-    "lambs",
-    "lamby",
-    "lamed",
-    "lamer",
-    "lames",
-    "lamia",
-    "lammy",
-    "lamps",
-    "lanai",
-    "lanas",
-    "lance",
-    "lanch",
-    "lande",
-    "lands",
-    "laned",
-    "lanes",
-    "lanks",
-    "lanky",
-    "lants",
-    "lapas",
-    "lapel",
-    "lapin",
-    "lapis",
-    "lapje",
-    "lappa",
-    "lappy",
-    "lapse",
-    "larch",
-    "lards",
-    "lardy",
-    "laree",
-    "lares",
-    "larfs",
-    "larga",
-    "large",
-    "largo",
-    "laris",
-    "larks",
-    "larky",
-    "larns",
-    "larnt",
-    "larum",
-    "larva",
-    "lased",
-    "laser",
-    "lases",
-    "lassi",
-    "lasso",
-    "lassu",
-    "lassy",
-    "lasts",
-    "latah",
-    "latch",
-    "lated",
-    "laten",
-    "later",
-    "latex",
-    "lathe",
-    "lathi",
-    "laths",
-    "lathy",
-    "latke",
-    "latte",
-    "latus",
-    "lauan",
-    "lauch",
-    "laude",
-    "lauds",
-    "laufs",
-    "laugh",
-    "laund",
-    "laura",
-    "laval",
-    "lavas",
-    "laved",
-    "laver",
-    "laves",
-    "lavra",
-    "lavvy",
-    "lawed",
-    "lawer",
-    "lawin",
-    "lawks",
-    "lawns",
-    "lawny",
-    "lawsy",
-    "laxed",
-    "laxer",
-    "laxes",
-    "laxly",
-    "layby",
-    "layed",
-    "layer",
-    "layin",
-    "layup",
-    "lazar",
-    "lazed",
-    "lazes",
-    "lazos",
-    "lazzi",
-    "lazzo",
-    "leach",
-    "leads",
-    "leady",
-    "leafs",
-    "leafy",
-    "leaks",
-    "leaky",
-    "leams",
-    "leans",
-    "leant",
-    "leany",
-    "leaps",
-    "leapt",
-    "leare",
-    "learn",
-    "lears",
-    "leary",
-    "lease",
-    "leash",
-    "least",
-    "leats",
-    "leave",
-    "leavy",
-    "leaze",
-    "leben",
-    "leccy",
-    "leche",
-    "ledes",
-    "ledge",
-    "ledgy",
-    "ledum",
-    "leear",
-    "leech",
-    "leeks",
-    "leeps",
-    "leers",
-    "leery",
-    "leese",
-    "leets",
-    "leeze",
-    "lefte",
-    "lefts",
-    "lefty",
-    "legal",
-    "leger",
-    "leges",
-    "legge",
-    "leggo",
-    "leggy",
-    "legit",
-    "legno",
-    "lehrs",
-    "lehua",
-    "leirs",
-    "leish",
-    "leman",
-    "lemed",
-    "lemel",
-    "lemes",
-    "lemma",
-    "lemme",
-    "lemon",
-    "lemur",
-    "lends",
-    "lenes",
-    "lengs",
-    "lenis",
-    "lenos",
-    "lense",
-    "lenti",
-    "lento",
-    "leone",
-    "lepak",
-    "leper",
-    "lepid",
-    "lepra",
-    "lepta",
-    "lered",
-    "leres",
-    "lerps",
-    "lesbo",
-    "leses",
-    "lesos",
-    "lests",
-    "letch",
-    "lethe",
-    "letty",
-    "letup",
-    "leuch",
-    "leuco",
-    "leuds",
-    "leugh",
-    "levas",
-    "levee",
-    "level",
-    "lever",
-    "leves",
-    "levin",
-    "levis",
-    "lewis",
-    "lexes",
-    "lexis",
-    "lezes",
-    "lezza",
-    "lezzo",
-    "lezzy",
-    "liana",
-    "liane",
-    "liang",
-    "liard",
-    "liars",
-    "liart",
-    "libel",
-    "liber",
-    "libor",
-    "libra",
-    "libre",
-    "libri",
-    "licet",
-    "lichi",
-    "licht",
-    "licit",
-    "licks",
-    "lidar",
-    "lidos",
-    "liefs",
-    "liege",
-    "liens",
-    "liers",
-    "lieus",
-    "lieve",
-    "lifer",
-    "lifes",
-    "lifey",
-    "lifts",
-    "ligan",
-    "liger",
-    "ligge",
-    "light",
-    "ligne",
-    "liked",
-    "liken",
-    "liker",
-    "likes",
-    "likin",
-    "lilac",
-    "lills",
-    "lilos",
-    "lilts",
-    "lilty",
-    "liman",
-    "limas",
-    "limax",
-    "limba",
-    "limbi",
-    "limbo",
-    "limbs",
-    "limby",
-    "limed",
-    "limen",
-    "limes",
-    "limey",
-    "limit",
-    "limma",
-    "limns",
-    "limos",
-    "limpa",
-    "limps",
-    "linac",
-    "linch",
-    "linds",
-    "lindy",
-    "lined",
-    "linen",
-    "liner",
-    "lines",
-    "liney",
-    "linga",
-    "lingo",
-    "lings",
-    "lingy",
-    "linin",
-    "links",
-    "linky",
-    "linns",
-    "linny",
-    "linos",
-    "lints",
-    "linty",
-    "linum",
-    "linux",
-    "lions",
-    "lipas",
-    "lipes",
-    "lipid",
-    "lipin",
-    "lipos",
-    "lippy",
-    "liras",
-    "lirks",
-    "lirot",
-    "lises",
-    "lisks",
-    "lisle",
-    "lisps",
-    "lists",
-    "litai",
-    "litas",
-    "lited",
-    "litem",
-    "liter",
-    "lites",
-    "lithe",
-    "litho",
-    "liths",
-    "litie",
-    "litre",
-    "lived",
-    "liven",
-    "liver",
-    "lives",
-    "livid",
-    "livor",
-    "livre",
-    "liwaa",
-    "liwas",
-    "llama",
-    "llano",
-    "loach",
-    "loads",
-    "loafs",
-    "loams",
-    "loamy",
-    "loans",
-    "loast",
-    "loath",
-    "loave",
-    "lobar",
-    "lobby",
-    "lobed",
-    "lobes",
-    "lobos",
-    "lobus",
-    "local",
-    "loche",
-    "lochs",
-    "lochy",
-    "locie",
-    "locis",
-    "locks",
-    "locky",
-    "locos",
-    "locum",
-    "locus",
-    "loden",
-    "lodes",
-    "lodge",
-    "loess",
-    "lofts",
-    "lofty",
-    "logan",
-    "loges",
-    "loggy",
-    "logia",
-    "logic",
-    "logie",
-    "login",
-    "logoi",
-    "logon",
-    "logos",
-    "lohan",
-    "loids",
-    "loins",
-    "loipe",
-    "loirs",
-    "lokes",
-    "lokey",
-    "lokum",
-    "lolas",
-    "loled",
-    "lollo",
-    "lolls",
-    "lolly",
-    "lolog",
-    "lolos",
-    "lomas",
-    "lomed",
-    "lomes",
-    "loner",
-    "longa",
-    "longe",
-    "longs",
-    "looby",
-    "looed",
-    "looey",
-    "loofa",
-    "loofs",
-    "looie",
-    "looks",
-    "looky",
-    "looms",
-    "loons",
-    "loony",
-    "loops",
-    "loopy",
-    "loord",
-    "loose",
-    "loots",
-    "loped",
-    "loper",
-    "lopes",
-    "loppy",
-    "loral",
-    "loran",
-    "lords",
-    "lordy",
-    "lorel",
-    "lores",
-    "loric",
-    "loris",
-    "lorry",
-    "losed",
-    "losel",
-    "losen",
-    "loser",
-    "loses",
-    "lossy",
-    "lotah",
-    "lotas",
-    "lotes",
-    "lotic",
-    "lotos",
-    "lotsa",
-    "lotta",
-    "lotte",
-    "lotto",
-    "lotus",
-    "loued",
-    "lough",
-    "louie",
-    "louis",
-    "louma",
-    "lound",
-    "louns",
-    "loupe",
-    "loups",
-    "loure",
-    "lours",
-    "loury",
-    "louse",
-    "lousy",
-    "louts",
-    "lovat",
-    "loved",
-    "lovee",
-    "lover",
-    "loves",
-    "lovey",
-    "lovie",
-    "lowan",
-    "lowed",
-    "lowen",
-    "lower",
-    "lowes",
-    "lowly",
-    "lownd",
-    "lowne",
-    "lowns",
-    "lowps",
-    "lowry",
-    "lowse",
-    "lowth",
-    "lowts",
-    "loxed",
-    "loxes",
-    "loyal",
-    "lozen",
-    "luach",
-    "luaus",
-    "lubed",
-    "lubes",
-    "lubra",
-    "luces",
-    "lucid",
-    "lucks",
-    "lucky",
-    "lucre",
-    "ludes",
-    "ludic",
-    "ludos",
-    "luffa",
-    "luffs",
-    "luged",
-    "luger",
-    "luges",
-    "lulls",
-    "lulus",
-    "lumas",
-    "lumbi",
-    "lumen",
-    "lumme",
-    "lummy",
-    "lumps",
-    "lumpy",
-    "lunar",
-    "lunas",
-    "lunch",
-    "lunes",
-    "lunet",
-    "lunge",
-    "lungi",
-    "lungs",
-    "lunks",
-    "lunts",
-    "lupin",
-    "lupus",
-    "lurch",
-    "lured",
-    "lurer",
-    "lures",
-    "lurex",
-    "lurgi",
-    "lurgy",
-    "lurid",
-    "lurks",
-    "lurry",
-    "lurve",
-    "luser",
-    "lushy",
-    "lusks",
-    "lusts",
-    "lusty",
-    "lusus",
-    "lutea",
-    "luted",
-    "luter",
-    "lutes",
-    "luvvy",
-    "luxed",
-    "luxer",
-    "luxes",
-    "lweis",
-    "lyams",
-    "lyard",
-    "lyart",
-    "lyase",
-    "lycea",
-    "lycee",
-    "lycra",
-    "lying",
-    "lymes",
-    "lymph",
-    "lynch",
-    "lynes",
-    "lyres",
-    "lyric",
-    "lysed",
-    "lyses",
-    "lysin",
-    "lysis",
-    "lysol",
-    "lyssa",
-    "lyted",
-    "lytes",
-    "lythe",
-    "lytic",
-    "lytta",
-    "maaed",
-    "maare",
-    "maars",
-    "maban",
-    "mabes",
-    "macas",
-    "macaw",
-    "macca",
-    "maced",
-    "macer",
-    "maces",
-    "mache",
-    "machi",
-    "macho",
-    "machs",
-    "macka",
-    "macks",
-    "macle",
-    "macon",
-    "macro",
-    "macte",
-    "madal",
-    "madam",
-    "madar",
-    "maddy",
-    "madge",
-    "madid",
-    "madly",
-    "mados",
-    "madre",
-    "maedi",
-    "maerl",
-    "mafia",
-    "mafic",
-    "mafts",
-    "magas",
-    "mages",
-    "maggs",
-    "magic",
-    "magma",
-    "magna",
-    "magot",
-    "magus",
-    "mahal",
-    "mahem",
-    "mahis",
-    "mahoe",
-    "mahrs",
-    "mahua",
-    "mahwa",
-    "maids",
-    "maiko",
-    "maiks",
-    "maile",
-    "maill",
-    "mailo",
-    "mails",
-    "maims",
-    "mains",
-    "maire",
-    "mairs",
-    "maise",
-    "maist",
-    "maize",
-    "majas",
-    "majat",
-    "majoe",
-    "major",
-    "majos",
-    "makaf",
-    "makai",
-    "makan",
-    "makar",
-    "makee",
-    "maker",
-    "makes",
-    "makie",
-    "makis",
-    "makos",
-    "malae",
-    "malai",
-    "malam",
-    "malar",
-    "malas",
-    "malax",
-    "maleo",
-    "males",
-    "malic",
-    "malik",
-    "malis",
-    "malky",
-    "malls",
-    "malms",
-    "malmy",
-    "malts",
-    "malty",
-    "malus",
-    "malva",
-    "malwa",
-    "mamak",
-    "mamas",
-    "mamba",
-    "mambo",
-    "mambu",
-    "mamee",
-    "mamey",
-    "mamie",
-    "mamil",
-    "mamma",
-    "mammy",
-    "manas",
-    "manat",
-    "mandi",
-    "mands",
-    "mandy",
-    "maneb",
-    "maned",
-    "maneh",
-    "manes",
-    "manet",
-    "manga",
-    "mange",
-    "mangi",
-    "mango",
-    "mangs",
-    "mangy",
-    "mania",
-    "manic",
-    "manie",
-    "manis",
-    "manks",
-    "manky",
-    "manly",
-    "manna",
-    "manny",
-    "manoa",
-    "manor",
-    "manos",
-    "manse",
-    "manso",
-    "manta",
-    "mante",
-    "manto",
-    "mants",
-    "manty",
-    "manul",
-    "manus",
-    "manzo",
-    "mapau",
-    "mapes",
-    "maple",
-    "mapou",
-    "mappy",
-    "maqam",
-    "maqui",
-    "marae",
-    "marah",
-    "maral",
-    "maran",
-    "maras",
-    "maray",
-    "march",
-    "marcs",
-    "mards",
-    "mardy",
-    "mares",
-    "marga",
-    "marge",
-    "margo",
-    "margs",
-    "maria",
-    "marid",
-    "maril",
-    "marka",
-    "marks",
-    "marle",
-    "marls",
-    "marly",
-    "marma",
-    "marms",
-    "maron",
-    "maror",
-    "marra",
-    "marri",
-    "marry",
-    "marse",
-    "marsh",
-    "marts",
-    "marua",
-    "marvy",
-    "masas",
-    "mased",
-    "maser",
-    "mases",
-    "masha",
-    "mashy",
-    "masks",
-    "mason",
-    "massa",
-    "masse",
-    "massy",
-    "masts",
-    "masty",
-    "masur",
-    "masus",
-    "masut",
-    "matai",
-    "match",
-    "mated",
-    "mater",
-    "mates",
-    "matey",
-    "mathe",
-    "maths",
-    "matin",
-    "matlo",
-    "matra",
-    "matsu",
-    "matte",
-    "matts",
-    "matty",
-    "matza",
-    "matzo",
-    "mauby",
-    "mauds",
-    "mauka",
-    "maula",
-    "mauls",
-    "maums",
-    "maumy",
-    "maund",
-    "maunt",
-    "mauri",
-    "mausy",
-    "mauts",
-    "mauve",
-    "mauvy",
-    "mauzy",
-    "maven",
-    "mavie",
-    "mavin",
-    "mavis",
-    "mawed",
-    "mawks",
-    "mawky",
-    "mawla",
-    "mawns",
-    "mawps",
-    "mawrs",
-    "maxed",
-    "maxes",
-    "maxim",
-    "maxis",
-    "mayan",
-    "mayas",
-    "maybe",
-    "mayed",
-    "mayor",
-    "mayos",
-    "mayst",
-    "mazac",
-    "mazak",
-    "mazar",
-    "mazas",
-    "mazed",
-    "mazel",
-    "mazer",
-    "mazes",
-    "mazet",
-    "mazey",
-    "mazut",
-    "mbari",
-    "mbars",
-    "mbila",
-    "mbira",
-    "mbret",
-    "mbube",
-    "mbuga",
-    "meads",
-    "meake",
-    "meaks",
-    "meals",
-    "mealy",
-    "meane",
-    "means",
-    "meant",
-    "meany",
-    "meare",
-    "mease",
-    "meath",
-    "meats",
-    "meaty",
-    "mebbe",
-    "mebos",
-    "mecca",
-    "mecha",
-    "mechs",
-    "mecks",
-    "mecum",
-    "medal",
-    "media",
-    "medic",
-    "medii",
-    "medin",
-    "medle",
-    "meech",
-    "meeds",
-    "meeja",
-    "meeps",
-    "meers",
-    "meets",
-    "meffs",
-    "meids",
-    "meiko",
-    "meils",
-    "meins",
-    "meint",
-    "meiny",
-    "meism",
-    "meith",
-    "mekka",
-    "melam",
-    "melas",
-    "melba",
-    "melch",
-    "melds",
-    "melee",
-    "meles",
-    "melic",
-    "melik",
-    "mells",
-    "meloe",
-    "melon",
-    "melos",
-    "melts",
-    "melty",
-    "memes",
-    "memic",
-    "memos",
-    "menad",
-    "mence",
-    "mends",
-    "mened",
-    "menes",
-    "menge",
-    "mengs",
-    "menil",
-    "mensa",
-    "mense",
-    "mensh",
-    "menta",
-    "mento",
-    "ments",
-    "menus",
-    "meous",
-    "meows",
-    "merch",
-    "mercs",
-    "mercy",
-    "merde",
-    "merds",
-    "mered",
-    "merel",
-    "merer",
-    "meres",
-    "merge",
-    "meril",
-    "meris",
-    "merit",
-    "merks",
-    "merle",
-    "merls",
-    "merry",
-    "merse",
-    "mersk",
-    "mesad",
-    "mesal",
-    "mesas",
-    "mesca",
-    "mesel",
-    "mesem",
-    "meses",
-    "meshy",
-    "mesia",
-    "mesic",
-    "mesne",
-    "meson",
-    "messy",
-    "mesto",
-    "mesyl",
-    "metal",
-    "metas",
-    "meted",
-    "meteg",
-    "metel",
-    "meter",
-    "metes",
-    "methi",
-    "metho",
-    "meths",
-    "methy",
-    "metic",
-    "metif",
-    "metis",
-    "metol",
-    "metre",
-    "metro",
-    "metta",
-    "meums",
-    "meuse",
-    "meved",
-    "meves",
-    "mewed",
-    "mewls",
-    "meynt",
-    "mezes",
-    "mezza",
-    "mezze",
-    "mezzo",
-    "mgals",
-    "mhorr",
-    "miais",
-    "miaou",
-    "miaow",
-    "miasm",
-    "miaul",
-    "micas",
-    "miche",
-    "michi",
-    "micht",
-    "micks",
-    "micky",
-    "micos",
-    "micra",
-    "micro",
-    "middy",
-    "midge",
-    "midgy",
-    "midis",
-    "midst",
-    "miens",
-    "mieux",
-    "mieve",
-    "miffs",
-    "miffy",
-    "mifty",
-    "miggs",
-    "might",
-    "migma",
-    "migod",
-    "mihas",
-    "mihis",
-    "mikan",
-    "miked",
-    "mikes",
-    "mikos",
-    "mikra",
-    "mikva",
-    "milch",
-    "milds",
-    "miler",
-    "miles",
-    "milfs",
-    "milia",
-    "milko",
-    "milks",
-    "milky",
-    "mille",
-    "mills",
-    "milly",
-    "milor",
-    "milos",
-    "milpa",
-    "milts",
-    "milty",
-    "miltz",
-    "mimed",
-    "mimeo",
-    "mimer",
-    "mimes",
-    "mimic",
-    "mimis",
-    "mimsy",
-    "minae",
-    "minar",
-    "minas",
-    "mince",
-    "mincy",
-    "mindi",
-    "minds",
-    "mined",
-    "miner",
-    "mines",
-    "minge",
-    "mingi",
-    "mings",
-    "mingy",
-    "minim",
-    "minis",
-    "minke",
-    "minks",
-    "minny",
-    "minor",
-    "minos",
-    "minse",
-    "mints",
-    "minty",
-    "minus",
-    "minxy",
-    "miraa",
-    "mirah",
-    "mirch",
-    "mired",
-    "mires",
-    "mirex",
-    "mirid",
-    "mirin",
-    "mirkn",
-    "mirks",
-    "mirky",
-    "mirls",
-    "mirly",
-    "miros",
-    "mirrl",
-    "mirrs",
-    "mirth",
-    "mirvs",
-    "mirza",
-    "misal",
-    "misch",
-    "misdo",
-    "miser",
-    "mises",
-    "misgo",
-    "misky",
-    "misls",
-    "misos",
-    "missa",
-    "missy",
-    "misto",
-    "mists",
-    "misty",
-    "mitas",
-    "mitch",
-    "miter",
-    "mites",
-    "mitey",
-    "mitie",
-    "mitis",
-    "mitre",
-    "mitry",
-    "mitta",
-    "mitts",
-    "mivey",
-    "mivvy",
-    "mixed",
-    "mixen",
-    "mixer",
-    "mixes",
-    "mixie",
-    "mixis",
-    "mixte",
-    "mixup",
-    "miyas",
-    "mizen",
-    "mizes",
-    "mizzy",
-    "mmkay",
-    "mneme",
-    "moais",
-    "moaky",
-    "moals",
-    "moana",
-    "moans",
-    "moany",
-    "moars",
-    "moats",
-    "mobby",
-    "mobed",
-    "mobee",
-    "mobes",
-    "mobey",
-    "mobie",
-    "moble",
-    "mobos",
-    "mocap",
-    "mocha",
-    "mochi",
-    "mochs",
-    "mochy",
-    "mocks",
-    "mocky",
-    "mocos",
-    "mocus",
-    "modal",
-    "model",
-    "modem",
-    "moder",
-    "modes",
-    "modge",
-    "modii",
-    "modin",
-    "modoc",
-    "modom",
-    "modus",
-    "moeni",
-    "moers",
-    "mofos",
-    "mogar",
-    "mogas",
-    "moggy",
-    "mogos",
-    "mogra",
-    "mogue",
-    "mogul",
-    "mohar",
-    "mohel",
-    "mohos",
-    "mohrs",
-    "mohua",
-    "mohur",
-    "moile",
-    "moils",
-    "moira",
-    "moire",
-    "moist",
-    "moits",
-    "moity",
-    "mojos",
-    "moker",
-    "mokes",
-    "mokey",
-    "mokis",
-    "mokky",
-    "mokos",
-    "mokus",
-    "molal",
-    "molar",
-    "molas",
-    "molds",
-    "moldy",
-    "moled",
-    "moler",
-    "moles",
-    "moley",
-    "molie",
-    "molla",
-    "molle",
-    "mollo",
-    "molls",
-    "molly",
-    "moloi",
-    "molos",
-    "molto",
-    "molts",
-    "molue",
-    "molvi",
-    "molys",
-    "momes",
-    "momie",
-    "momma",
-    "momme",
-    "mommy",
-    "momos",
-    "mompe",
-    "momus",
-    "monad",
-    "monal",
-    "monas",
-    "monde",
-    "mondo",
-    "moner",
-    "money",
-    "mongo",
-    "mongs",
-    "monic",
-    "monie",
-    "monks",
-    "monos",
-    "monpe",
-    "monte",
-    "month",
-    "monty",
-    "moobs",
-    "mooch",
-    "moods",
-    "moody",
-    "mooed",
-    "mooey",
-    "mooks",
-    "moola",
-    "mooli",
-    "mools",
-    "mooly",
-    "moong",
-    "mooni",
-    "moons",
-    "moony",
-    "moops",
-    "moors",
-    "moory",
-    "moose",
-    "mooth",
-    "moots",
-    "moove",
-    "moped",
-    "moper",
-    "mopes",
-    "mopey",
-    "moppy",
-    "mopsy",
-    "mopus",
-    "morae",
-    "morah",
-    "moral",
-    "moran",
-    "moras",
-    "morat",
-    "moray",
-    "moree",
-    "morel",
-    "mores",
-    "morgy",
-    "moria",
-    "morin",
-    "mormo",
-    "morna",
-    "morne",
-    "morns",
-    "moron",
-    "moror",
-    "morph",
-    "morra",
-    "morro",
-    "morse",
-    "morts",
-    "moruk",
-    "mosed",
-    "moses",
-    "mosey",
-    "mosks",
-    "mosso",
-    "mossy",
-    "moste",
-    "mosto",
-    "mosts",
-    "moted",
-    "motel",
-    "moten",
-    "motes",
-    "motet",
-    "motey",
-    "moths",
-    "mothy",
-    "motif",
-    "motis",
-    "moton",
-    "motor",
-    "motte",
-    "motto",
-    "motts",
-    "motty",
-    "motus",
-    "motza",
-    "mouch",
-    "moues",
-    "moufs",
-    "mould",
-    "moule",
-    "mouls",
-    "moult",
-    "mouly",
-    "mound",
-    "mount",
-    "moups",
-    "mourn",
-    "mouse",
-    "moust",
-    "mousy",
-    "mouth",
-    "moved",
-    "mover",
-    "moves",
-    "movie",
-    "mowas",
-    "mowed",
-    "mower",
-    "mowie",
-    "mowra",
-    "moxas",
-    "moxie",
-    "moyas",
-    "moyle",
-    "moyls",
-    "mozed",
-    "mozes",
-    "mozos",
-    "mpret",
-    "mrads",
-    "msasa",
-    "mtepe",
-    "mucho",
-    "mucic",
-    "mucid",
-    "mucin",
-    "mucko",
-    "mucks",
-    "mucky",
-    "mucor",
-    "mucro",
-    "mucus",
-    "mudar",
-    "muddy",
-    "mudge",
-    "mudif",
-    "mudim",
-    "mudir",
-    "mudra",
-    "muffs",
-    "muffy",
-    "mufti",
-    "mugga",
-    "muggs",
-    "muggy",
-    "mugho",
-    "mugil",
-    "mugos",
-    "muhly",
-    "muids",
-    "muils",
-    "muirs",
-    "muiry",
-    "muist",
-    "mujik",
-    "mukim",
-    "mukti",
-    "mulai",
-    "mulch",
-    "mulct",
-    "muled",
-    "mules",
-    "muley",
-    "mulga",
-    "mulie",
-    "mulla",
-    "mulls",
-    "mulse",
-    "mulsh",
-    "mumbo",
-    "mumms",
-    "mummy",
-    "mumph",
-    "mumps",
-    "mumsy",
-    "mumus",
-    "munch",
-    "munds",
-    "mundu",
-    "munga",
-    "munge",
-    "mungi",
-    "mungo",
-    "mungs",
-    "mungy",
-    "munia",
-    "munis",
-    "munja",
-    "munjs",
-    "munts",
-    "muntu",
-    "muons",
-    "mural",
-    "muras",
-    "mured",
-    "mures",
-    "murex",
-    "murgh",
-    "murgi",
-    "murid",
-    "murks",
-    "murky",
-    "murls",
-    "murly",
-    "murra",
-    "murre",
-    "murri",
-    "murrs",
-    "murry",
-    "murth",
-    "murti",
-    "muruk",
-    "murva",
-    "musar",
-    "musca",
-    "mused",
-    "musee",
-    "muser",
-    "muses",
-    "muset",
-    "musha",
-    "mushy",
-    "music",
-    "musit",
-    "musks",
-    "musky",
-    "musos",
-    "musse",
-    "mussy",
-    "musta",
-    "musth",
-    "musts",
-    "musty",
-    "mutas",
-    "mutch",
-    "muted",
-    "muter",
-    "mutes",
-    "mutha",
-    "mutic",
-    "mutis",
-    "muton",
-    "mutti",
-    "mutts",
-    "mutum",
-    "muvva",
-    "muxed",
-    "muxes",
-    "muzak",
-    "muzzy",
-    "mvula",
-    "mvule",
-    "mvuli",
-    "myall",
-    "myals",
-    "mylar",
-    "mynah",
-    "mynas",
-    "myoid",
-    "myoma",
-    "myons",
-    "myope",
-    "myops",
-    "myopy",
-    "myrrh",
-    "mysid",
-    "mysie",
-    "mythi",
-    "myths",
-    "mythy",
-    "myxos",
-    "mzees",
-    "naams",
-    "naans",
-    "naats",
-    "nabam",
-    "nabby",
-    "nabes",
-    "nabis",
-    "nabks",
-    "nabla",
-    "nabob",
-    "nache",
-    "nacho",
-    "nacre",
-    "nadas",
-    "nadir",
-    "naeve",
-    "naevi",
-    "naffs",
-    "nagar",
-    "nagas",
-    "nages",
-    "naggy",
-    "nagor",
-    "nahal",
-    "naiad",
-    "naibs",
-    "naice",
-    "naids",
-    "naieo",
-    "naifs",
-    "naiks",
-    "nails",
-    "naily",
-    "nains",
-    "naios",
-    "naira",
-    "nairu",
-    "naive",
-    "najib",
-    "nakas",
-    "naked",
-    "naker",
-    "nakfa",
-    "nalas",
-    "naled",
-    "nalla",
-    "namad",
-    "namak",
-    "namaz",
-    "named",
-    "namer",
-    "names",
-    "namma",
-    "namus",
-    "nanas",
-    "nance",
-    "nancy",
-    "nandu",
-    "nanna",
-    "nanny",
-    "nanos",
-    "nante",
-    "nanti",
-    "nanto",
-    "nants",
-    "nanty",
-    "nanua",
-    "napas",
-    "naped",
-    "napes",
-    "napoh",
-    "napoo",
-    "nappa",
-    "nappe",
-    "nappy",
-    "naras",
-    "narco",
-    "narcs",
-    "nards",
-    "nares",
-    "naric",
-    "naris",
-    "narks",
-    "narky",
-    "narod",
-    "narra",
-    "narre",
-    "nasal",
-    "nashi",
-    "nasho",
-    "nasis",
-    "nason",
-    "nasty",
-    "nasus",
-    "natak",
-    "natal",
-    "natch",
-    "nates",
-    "natis",
-    "natto",
-    "natty",
-    "natya",
-    "nauch",
-    "naunt",
-    "naval",
-    "navar",
-    "naved",
-    "navel",
-    "naves",
-    "navew",
-    "navvy",
-    "nawab",
-    "nawal",
-    "nazar",
-    "nazes",
-    "nazir",
-    "nazis",
-    "nazzy",
-    "nduja",
-    "neafe",
-    "neals",
-    "neant",
-    "neaps",
-    "nears",
-    "neath",
-    "neato",
-    "neats",
-    "nebby",
-    "nebek",
-    "nebel",
-    "neche",
-    "necks",
-    "neddy",
-    "neebs",
-    "needs",
-    "needy",
-    "neefs",
-    "neeld",
-    "neele",
-    "neemb",
-    "neems",
-    "neeps",
-    "neese",
-    "neeze",
-    "nefie",
-    "negri",
-    "negro",
-    "negus",
-    "neifs",
-    "neigh",
-    "neist",
-    "neive",
-    "nelia",
-    "nelis",
-    "nelly",
-    "nemas",
-    "nemic",
-    "nemns",
-    "nempt",
-    "nenes",
-    "nenta",
-    "neons",
-    "neosa",
-    "neoza",
-    "neper",
-    "nepit",
-    "neral",
-    "neram",
-    "nerds",
-    "nerdy",
-    "nerfs",
-    "nerka",
-    "nerks",
-    "nerol",
-    "nerts",
-    "nertz",
-    "nerve",
-    "nervy",
-    "neski",
-    "nests",
-    "nesty",
-    "netas",
-    "netes",
-    "netop",
-    "netta",
-    "netts",
-    "netty",
-    "neuks",
-    "neume",
-    "neums",
-    "nevel",
-    "never",
-    "neves",
-    "nevis",
-    "nevus",
-    "nevvy",
-    "newbs",
-    "newed",
-    "newel",
-    "newer",
-    "newie",
-    "newly",
-    "newsy",
-    "newts",
-    "nexal",
-    "nexin",
-    "nexts",
-    "nexum",
-    "nexus",
-    "ngaio",
-    "ngaka",
-    "ngana",
-    "ngapi",
-    "ngati",
-    "ngege",
-    "ngoma",
-    "ngoni",
-    "ngram",
-    "ngwee",
-    "nibby",
-    "nicad",
-    "niced",
-    "nicer",
-    "nicey",
-    "niche",
-    "nicht",
-    "nicks",
-    "nicky",
-    "nicol",
-    "nidal",
-    "nided",
-    "nides",
-    "nidor",
-    "nidus",
-    "niece",
-    "niefs",
-    "niess",
-    "nieve",
-    "nifes",
-    "niffs",
-    "niffy",
-    "nifle",
-    "nifty",
-    "niger",
-    "nigga",
-    "nighs",
-    "night",
-    "nigre",
-    "nigua",
-    "nihil",
-    "nikab",
-    "nikah",
-    "nikau",
-    "nilas",
-    "nills",
-    "nimbi",
-    "nimbs",
-    "nimby",
-    "nimps",
-    "niner",
-    "nines",
-    "ninja",
-    "ninny",
-    "ninon",
-    "ninta",
-    "ninth",
-    "niopo",
-    "nioza",
-    "nipas",
-    "nipet",
-    "nippy",
-    "niqab",
-    "nirls",
-    "nirly",
-    "nisei",
-    "nisin",
-    "nisse",
-    "nisus",
-    "nital",
-    "niter",
-    "nites",
-    "nitid",
-    "niton",
-    "nitre",
-    "nitro",
-    "nitry",
-    "nitta",
-    "nitto",
-    "nitty",
-    "nival",
-    "nivas",
-    "nivel",
-    "nixed",
-    "nixer",
-    "nixes",
-    "nixie",
-    "nizam",
-    "njirl",
-    "nkosi",
-    "nmoli",
-    "nmols",
-    "noahs",
-    "nobby",
-    "noble",
-    "nobly",
-    "nocks",
-    "nodal",
-    "noddy",
-    "noded",
-    "nodes",
-    "nodum",
-    "nodus",
-    "noels",
-    "noema",
-    "noeme",
-    "nogal",
-    "noggs",
-    "noggy",
-    "nohow",
-    "noias",
-    "noils",
-    "noily",
-    "noint",
-    "noire",
-    "noirs",
-    "noise",
-    "noisy",
-    "nokes",
-    "noles",
-    "nolle",
-    "nolls",
-    "nolos",
-    "nomad",
-    "nomas",
-    "nomen",
-    "nomes",
-    "nomic",
-    "nomoi",
-    "nomos",
-    "nonan",
-    "nonas",
-    "nonce",
-    "noncy",
-    "nonda",
-    "nondo",
-    "nones",
-    "nonet",
-    "nongs",
-    "nonic",
-    "nonis",
-    "nonna",
-    "nonno",
-    "nonny",
-    "nonyl",
-    "noobs",
-    "noois",
-    "nooit",
-    "nooks",
-    "nooky",
-    "noone",
-    "noons",
-    "noops",
-    "noose",
-    "noove",
-    "nopal",
-    "noria",
-    "norie",
-    "noris",
-    "norks",
-    "norma",
-    "norms",
-    "north",
-    "nosed",
-    "noser",
-    "noses",
-    "nosey",
-    "noshi",
-    "nosir",
-    "notal",
-    "notam",
-    "notch",
-    "noted",
-    "noter",
-    "notes",
-    "notum",
-    "nougs",
-    "nouja",
-    "nould",
-    "noule",
-    "nouls",
-    "nouns",
-    "nouny",
-    "noups",
-    "noust",
-    "novae",
-    "novas",
-    "novel",
-    "novia",
-    "novio",
-    "novum",
-    "noway",
-    "nowds",
-    "nowed",
-    "nowls",
-    "nowts",
-    "nowty",
-    "noxal",
-    "noxas",
-    "noxes",
-    "noyau",
-    "noyed",
-    "noyes",
-    "nrtta",
-    "nrtya",
-    "nsima",
-    "nubby",
-    "nubia",
-    "nucha",
-    "nucin",
-    "nuddy",
-    "nuder",
-    "nudes",
-    "nudge",
-    "nudgy",
-    "nudie",
-    "nudzh",
-    "nuevo",
-    "nuffs",
-    "nugae",
-    "nujol",
-    "nuked",
-    "nukes",
-    "nulla",
-    "nullo",
-    "nulls",
-    "nully",
-    "numbs",
-    "numen",
-    "nummy",
-    "numps",
-    "nunks",
-    "nunky",
-    "nunny",
-    "nunus",
-    "nuque",
-    "nurds",
-    "nurdy",
-    "nurls",
-    "nurrs",
-    "nurse",
-    "nurts",
-    "nurtz",
-    "nused",
-    "nuses",
-    "nutso",
-    "nutsy",
-    "nutty",
-    "nyaff",
-    "nyala",
-    "nyams",
-    "nying",
-    "nylon",
-    "nymph",
-    "nyong",
-    "nyssa",
-    "nyung",
-    "nyuse",
-    "nyuze",
-    "oafos",
-    "oaked",
-    "oaken",
-    "oaker",
-    "oakum",
-    "oared",
-    "oarer",
-    "oasal",
-    "oases",
-    "oasis",
-    "oasts",
-    "oaten",
-    "oater",
-    "oaths",
-    "oaves",
-    "obang",
-    "obbos",
-    "obeah",
-    "obeli",
-    "obese",
-    "obeys",
-    "obias",
-    "obied",
-    "obiit",
-    "obits",
-    "objet",
-    "oboes",
-    "obole",
-    "oboli",
-    "obols",
-    "occam",
-    "occur",
-    "ocean",
-    "ocher",
-    "oches",
-    "ochre",
-    "ochry",
-    "ocker",
-    "ocote",
-    "ocrea",
-    "octad",
-    "octal",
-    "octan",
-    "octas",
-    "octet",
-    "octic",
-    "octli",
-    "octyl",
-    "oculi",
-    "odahs",
-    "odals",
-    "odder",
-    "oddly",
-    "odeon",
-    "odeum",
-    "odism",
-    "odist",
-    "odium",
-    "odoom",
-    "odors",
-    "odour",
-    "odums",
-    "odyle",
-    "odyls",
-    "ofays",
-    "offal",
-    "offed",
-    "offer",
-    "offie",
-    "oflag",
-    "often",
-    "ofter",
-    "ofuro",
-    "ogams",
-    "ogeed",
-    "ogees",
-    "oggin",
-    "ogham",
-    "ogive",
-    "ogled",
-    "ogler",
-    "ogles",
-    "ogmic",
-    "ogres",
-    "ohelo",
-    "ohias",
-    "ohing",
-    "ohmic",
-    "ohone",
-    "oicks",
-    "oidia",
-    "oiled",
-    "oiler",
-    "oilet",
-    "oinks",
-    "oints",
-    "oiran",
-    "ojime",
-    "okapi",
-    "okays",
-    "okehs",
-    "okies",
-    "oking",
-    "okole",
-    "okras",
-    "okrug",
-    "oktas",
-    "olate",
-    "olden",
-    "older",
-    "oldie",
-    "oldly",
-    "olehs",
-    "oleic",
-    "olein",
-    "olent",
-    "oleos",
-    "oleum",
-    "oleyl",
-    "oligo",
-    "olios",
-    "oliva",
-    "olive",
-    "ollas",
-    "ollav",
-    "oller",
-    "ollie",
-    "ology",
-    "olona",
-    "olpae",
-    "olpes",
-    "omasa",
-    "omber",
-    "ombre",
-    "ombus",
-    "omdah",
-    "omdas",
-    "omdda",
-    "omdeh",
-    "omees",
-    "omega",
-    "omens",
-    "omers",
-    "omiai",
-    "omits",
-    "omlah",
-    "ommel",
-    "ommin",
-    "omnes",
-    "omovs",
-    "omrah",
-    "omuls",
-    "oncer",
-    "onces",
-    "oncet",
-    "oncus",
-    "ondes",
-    "ondol",
-    "onely",
-    "oners",
-    "onery",
-    "ongon",
-    "onion",
-    "onium",
-    "onkus",
-    "onlap",
-    "onlay",
-    "onmun",
-    "onned",
-    "onsen",
-    "onset",
-    "ontal",
-    "ontic",
-    "ooaas",
-    "oobit",
-    "oohed",
-    "ooids",
-    "oojah",
-    "oomph",
-    "oonts",
-    "oopak",
-    "ooped",
-    "oopsy",
-    "oorie",
-    "ooses",
-    "ootid",
-    "ooyah",
-    "oozed",
-    "oozes",
-    "oozie",
-    "oozle",
-    "opahs",
-    "opals",
-    "opens",
-    "opepe",
-    "opera",
-    "opery",
-    "opgaf",
-    "opihi",
-    "opine",
-    "oping",
-    "opium",
-    "oppos",
-    "opsat",
-    "opsin",
-    "opsit",
-    "opted",
-    "opter",
-    "optic",
-    "opzit",
-    "orach",
-    "oracy",
-    "orals",
-    "orang",
-    "orans",
-    "orant",
-    "orate",
-    "orbat",
-    "orbed",
-    "orbic",
-    "orbit",
-    "orcas",
-    "orcin",
-    "order",
-    "ordie",
-    "ordos",
-    "oread",
-    "orfes",
-    "orful",
-    "organ",
-    "orgia",
-    "orgic",
-    "orgue",
-    "oribi",
-    "oriel",
-    "origo",
-    "orixa",
-    "orles",
-    "orlon",
-    "orlop",
-    "ormer",
-    "ornee",
-    "ornis",
-    "orped",
-    "orpin",
-    "orris",
-    "ortet",
-    "ortho",
-    "orval",
-    "orzos",
-    "osars",
-    "oscar",
-    "osetr",
-    "oseys",
-    "oshac",
-    "osier",
-    "oskin",
-    "oslin",
-    "osmic",
-    "osmol",
-    "osone",
-    "ossia",
-    "ostia",
-    "otaku",
-    "otary",
-    "other",
-    "othyl",
-    "otium",
-    "ottar",
-    "otter",
-    "ottos",
-    "oubit",
-    "ouche",
-    "oucht",
-    "oueds",
-    "ouens",
-    "ought",
-    "ouija",
-    "oulks",
-    "oumas",
-    "ounce",
-    "oundy",
-    "oupas",
-    "ouped",
-    "ouphe",
-    "ouphs",
-    "ourey",
-    "ourie",
-    "ousel",
-    "ousia",
-    "ousts",
-    "outby",
-    "outdo",
-    "outed",
-    "outen",
-    "outer",
-    "outgo",
-    "outie",
-    "outre",
-    "outro",
-    "outta",
-    "ouzel",
-    "ouzos",
-    "ovals",
-    "ovary",
-    "ovate",
-    "ovels",
-    "ovens",
-    "overs",
-    "overt",
-    "ovine",
-    "ovism",
-    "ovist",
-    "ovoid",
-    "ovoli",
-    "ovolo",
-    "ovule",
-    "oware",
-    "owari",
-    "owche",
-    "owers",
-    "owies",
-    "owing",
-    "owled",
-    "owler",
-    "owlet",
-    "owned",
-    "owner",
-    "ownio",
-    "owres",
-    "owrie",
-    "owsen",
-    "oxbow",
-    "oxeas",
-    "oxers",
-    "oxeye",
-    "oxide",
-    "oxids",
-    "oxies",
-    "oxime",
-    "oxims",
-    "oxine",
-    "oxlip",
-    "oxman",
-    "oxmen",
-    "oxter",
-    "oyama",
-    "oyers",
-    "ozeki",
-    "ozena",
-    "ozone",
-    "ozzie",
-    "paaho",
-    "paals",
-    "paans",
-    "pacai",
-    "pacas",
-    "pacay",
-    "paced",
-    "pacer",
-    "paces",
-    "pacey",
-    "pacha",
-    "packs",
-    "packy",
-    "pacos",
-    "pacta",
-    "pacts",
-    "padam",
-    "padas",
-    "paddo",
-    "paddy",
-    "padis",
-    "padle",
-    "padma",
-    "padou",
-    "padre",
-    "padri",
-    "paean",
-    "paedo",
-    "paeon",
-    "pagan",
-    "paged",
-    "pager",
-    "pages",
-    "pagle",
-    "pagne",
-    "pagod",
-    "pagri",
-    "pahit",
-    "pahos",
-    "pahus",
-    "paiks",
-    "pails",
-    "pains",
-    "paint",
-    "paipe",
-    "paips",
-    "paire",
-    "pairs",
-    "paisa",
-    "paise",
-    "pakay",
-    "pakka",
-    "pakki",
-    "pakua",
-    "pakul",
-    "palak",
-    "palar",
-    "palas",
-    "palay",
-    "palea",
-    "paled",
-    "paler",
-    "pales",
-    "palet",
-    "palis",
-    "palki",
-    "palla",
-    "palls",
-    "pallu",
-    "pally",
-    "palms",
-    "palmy",
-    "palpi",
-    "palps",
-    "palsa",
-    "palsy",
-    "palus",
-    "pamby",
-    "pampa",
-    "panax",
-    "pance",
-    "panch",
-    "panda",
-    "pands",
-    "pandy",
-    "paned",
-    "panel",
-    "panes",
-    "panga",
-    "pangs",
-    "panic",
-    "panim",
-    "panir",
-    "panko",
-    "panks",
-    "panna",
-    "panne",
-    "panni",
-    "panny",
-    "pansy",
-    "panto",
-    "pants",
-    "panty",
-    "paoli",
-    "paolo",
-    "papad",
-    "papal",
-    "papas",
-    "papaw",
-    "paper",
-    "papes",
-    "papey",
-    "pappi",
-    "pappy",
-    "papri",
-    "parae",
-    "paras",
-    "parch",
-    "parcs",
-    "pardi",
-    "pards",
-    "pardy",
-    "pared",
-    "paren",
-    "pareo",
-    "parer",
-    "pares",
-    "pareu",
-    "parev",
-    "parge",
-    "pargo",
-    "parid",
-    "paris",
-    "parka",
-    "parki",
-    "parks",
-    "parky",
-    "parle",
-    "parly",
-    "parma",
-    "parmo",
-    "parms",
-    "parol",
-    "parps",
-    "parra",
-    "parrs",
-    "parry",
-    "parse",
-    "parte",
-    "parti",
-    "parts",
-    "party",
-    "parve",
-    "parvo",
-    "pasag",
-    "pasar",
-    "pasch",
-    "paseo",
-    "pases",
-    "pasha",
-    "pashm",
-    "paska",
-    "pasmo",
-    "paspy",
-    "passe",
-    "passu",
-    "pasta",
-    "paste",
-    "pasts",
-    "pasty",
-    "patas",
-    "patch",
-    "pated",
-    "patee",
-    "patel",
-    "paten",
-    "pater",
-    "pates",
-    "paths",
-    "patia",
-    "patin",
-    "patio",
-    "patka",
-    "patly",
-    "patsy",
-    "patta",
-    "patte",
-    "pattu",
-    "patty",
-    "patus",
-    "pauas",
-    "pauls",
-    "pause",
-    "pauxi",
-    "pavan",
-    "pavas",
-    "paved",
-    "paven",
-    "paver",
-    "paves",
-    "pavid",
-    "pavie",
-    "pavin",
-    "pavis",
-    "pavon",
-    "pavvy",
-    "pawas",
-    "pawaw",
-    "pawed",
-    "pawer",
-    "pawks",
-    "pawky",
-    "pawls",
-    "pawns",
-    "paxes",
-    "payed",
-    "payee",
-    "payer",
-    "payor",
-    "paysd",
-    "peace",
-    "peach",
-    "peage",
-    "peags",
-    "peake",
-    "peaks",
-    "peaky",
-    "peals",
-    "peans",
-    "peare",
-    "pearl",
-    "pears",
-    "peart",
-    "pease",
-    "peasy",
-    "peats",
-    "peaty",
-    "peavy",
-    "peaze",
-    "pebas",
-    "pecan",
-    "pechs",
-    "pecia",
-    "pecke",
-    "pecks",
-    "pecky",
-    "pects",
-    "pedal",
-    "pedes",
-    "pedis",
-    "pedon",
-    "pedos",
-    "pedro",
-    "peece",
-    "peeks",
-    "peeky",
-    "peels",
-    "peely",
-    "peens",
-    "peent",
-    "peeoy",
-    "peepe",
-    "peeps",
-    "peepy",
-    "peers",
-    "peery",
-    "peeve",
-    "peevo",
-    "peggy",
-    "peghs",
-    "pegma",
-    "pegos",
-    "peine",
-    "peins",
-    "peise",
-    "peisy",
-    "peize",
-    "pekan",
-    "pekau",
-    "pekea",
-    "pekes",
-    "pekid",
-    "pekin",
-    "pekoe",
-    "pelas",
-    "pelau",
-    "pelch",
-    "peles",
-    "pelfs",
-    "pells",
-    "pelma",
-    "pelog",
-    "pelon",
-    "pelsh",
-    "pelta",
-    "pelts",
-    "pelus",
-    "penal",
-    "pence",
-    "pends",
-    "pendu",
-    "pened",
-    "penes",
-    "pengo",
-    "penie",
-    "penis",
-    "penks",
-    "penna",
-    "penne",
-    "penni",
-    "penny",
-    "pense",
-    "pensy",
-    "pents",
-    "peola",
-    "peons",
-    "peony",
-    "pepla",
-    "peple",
-    "pepon",
-    "pepos",
-    "peppy",
-    "pepsi",
-    "pequi",
-    "perae",
-    "perai",
-    "perce",
-    "perch",
-    "percs",
-    "perdu",
-    "perdy",
-    "perea",
-    "peres",
-    "perfs",
-    "peril",
-    "peris",
-    "perks",
-    "perky",
-    "perle",
-    "perls",
-    "perms",
-    "permy",
-    "perne",
-    "perns",
-    "perog",
-    "perps",
-    "perry",
-    "perse",
-    "persp",
-    "perst",
-    "perts",
-    "perve",
-    "pervo",
-    "pervs",
-    "pervy",
-    "pesch",
-    "pesky",
-    "pesos",
-    "pesta",
-    "pesto",
-    "pests",
-    "pesty",
-    "petal",
-    "petar",
-    "peter",
-    "petit",
-    "petos",
-    "petre",
-    "petri",
-    "petti",
-    "petto",
-    "petty",
-    "pewed",
-    "pewee",
-    "pewit",
-    "peyse",
-    "pfftt",
-    "phage",
-    "phang",
-    "phare",
-    "pharm",
-    "phase",
-    "phasm",
-    "pheer",
-    "pheme",
-    "phene",
-    "pheon",
-    "phese",
-    "phial",
-    "phies",
-    "phish",
-    "phizz",
-    "phlox",
-    "phobe",
-    "phoca",
-    "phone",
-    "phono",
-    "phons",
-    "phony",
-    "phooh",
-    "phooo",
-    "phota",
-    "photo",
-    "phots",
-    "photy",
-    "phpht",
-    "phubs",
-    "phuts",
-    "phutu",
-    "phwat",
-    "phyla",
-    "phyle",
-    "phyma",
-    "phynx",
-    "physa",
-    "piais",
-    "piani",
-    "piano",
-    "pians",
-    "pibal",
-    "pical",
-    "picas",
-    "piccy",
-    "picey",
-    "pichi",
-    "picks",
-    "picky",
-    "picon",
-    "picot",
-    "picra",
-    "picul",
-    "piece",
-    "pieds",
-    "piend",
-    "piers",
-    "piert",
-    "pieta",
-    "piets",
-    "piety",
-    "piezo",
-    "piggy",
-    "pight",
-    "pigly",
-    "pigmy",
-    "piing",
-    "pikas",
-    "pikau",
-    "piked",
-    "pikel",
-    "piker",
-    "pikes",
-    "pikey",
-    "pikis",
-    "pikul",
-    "pilae",
-    "pilaf",
-    "pilao",
-    "pilar",
-    "pilau",
-    "pilaw",
-    "pilch",
-    "pilea",
-    "piled",
-    "pilei",
-    "piler",
-    "piles",
-    "piley",
-    "pilin",
-    "pilis",
-    "pills",
-    "pilon",
-    "pilot",
-    "pilow",
-    "pilum",
-    "pilus",
-    "pimas",
-    "pimps",
-    "pinas",
-    "pinax",
-    "pince",
-    "pinch",
-    "pinda",
-    "pinds",
-    "pined",
-    "piner",
-    "pines",
-    "piney",
-    "pinga",
-    "pinge",
-    "pingo",
-    "pings",
-    "pinko",
-    "pinks",
-    "pinky",
-    "pinna",
-    "pinny",
-    "pinol",
-    "pinon",
-    "pinot",
-    "pinta",
-    "pinto",
-    "pints",
-    "pinup",
-    "pions",
-    "piony",
-    "pious",
-    "pioye",
-    "pioys",
-    "pipal",
-    "pipas",
-    "piped",
-    "piper",
-    "pipes",
-    "pipet",
-    "pipid",
-    "pipis",
-    "pipit",
-    "pippy",
-    "pipul",
-    "pique",
-    "piqui",
-    "pirai",
-    "pirks",
-    "pirls",
-    "pirns",
-    "pirog",
-    "pirre",
-    "pirri",
-    "pirrs",
-    "pisco",
-    "pises",
-    "pisky",
-    "pisos",
-    "pissy",
-    "piste",
-    "pitas",
-    "pitch",
-    "piths",
-    "pithy",
-    "piton",
-    "pitot",
-    "pitso",
-    "pitsu",
-    "pitta",
-    "pittu",
-    "piuma",
-    "piums",
-    "pivos",
-    "pivot",
-    "pixel",
-    "pixes",
-    "pixie",
-    "piyut",
-    "pized",
-    "pizer",
-    "pizes",
-    "pizza",
-    "plaas",
-    "place",
-    "plack",
-    "plaga",
-    "plage",
-    "plaid",
-    "plaig",
-    "plain",
-    "plait",
-    "planc",
-    "plane",
-    "planh",
-    "plank",
-    "plans",
-    "plant",
-    "plaps",
-    "plash",
-    "plasm",
-    "plast",
-    "plate",
-    "plats",
-    "platt",
-    "platy",
-    "plaud",
-    "plaur",
-    "plavs",
-    "playa",
-    "plays",
-    "plaza",
-    "plead",
-    "pleas",
-    "pleat",
-    "plebe",
-    "plebs",
-    "pleck",
-    "pleep",
-    "plein",
-    "plena",
-    "plene",
-    "pleno",
-    "pleon",
-    "plesh",
-    "plets",
-    "plews",
-    "plexi",
-    "plica",
-    "plied",
-    "plier",
-    "plies",
-    "pligs",
-    "plims",
-    "pling",
-    "plink",
-    "plips",
-    "plish",
-    "ploat",
-    "ploce",
-    "plock",
-    "plods",
-    "ploit",
-    "plomb",
-    "plong",
-    "plonk",
-    "plook",
-    "ploot",
-    "plops",
-    "plore",
-    "plots",
-    "plotz",
-    "plouk",
-    "plout",
-    "plows",
-    "plowt",
-    "ploye",
-    "ploys",
-    "pluck",
-    "pluds",
-    "plues",
-    "pluff",
-    "plugs",
-    "pluke",
-    "plumb",
-    "plume",
-    "plump",
-    "plums",
-    "plumy",
-    "plung",
-    "plunk",
-    "pluot",
-    "plups",
-    "plush",
-    "plute",
-    "pluto",
-    "pluty",
-    "plyer",
-    "pneus",
-    "poach",
-    "poaka",
-    "poake",
-    "poalo",
-    "pobby",
-    "poboy",
-    "pocan",
-    "poche",
-    "pocho",
-    "pocks",
-    "pocky",
-    "podal",
-    "poddy",
-    "podex",
-    "podge",
-    "podgy",
-    "podia",
-    "podos",
-    "podus",
-    "poems",
-    "poena",
-    "poeps",
-    "poesy",
-    "poete",
-    "poets",
-    "pogey",
-    "pogge",
-    "poggy",
-    "pogos",
-    "pogue",
-    "pohed",
-    "poilu",
-    "poind",
-    "point",
-    "poire",
-    "poise",
-    "pokal",
-    "poked",
-    "poker",
-    "pokes",
-    "pokey",
-    "pokie",
-    "pokit",
-    "polar",
-    "poled",
-    "poler",
-    "poles",
-    "poley",
-    "polio",
-    "polis",
-    "polje",
-    "polka",
-    "polks",
-    "pollo",
-    "polls",
-    "polly",
-    "polos",
-    "polts",
-    "polyp",
-    "polys",
-    "pomas",
-    "pombe",
-    "pomes",
-    "pomme",
-    "pommy",
-    "pomos",
-    "pompa",
-    "pomps",
-    "ponce",
-    "poncy",
-    "ponds",
-    "pondy",
-    "pones",
-    "poney",
-    "ponga",
-    "pongo",
-    "pongs",
-    "pongy",
-    "ponks",
-    "ponor",
-    "ponto",
-    "ponts",
-    "ponty",
-    "ponzu",
-    "pooay",
-    "pooch",
-    "poods",
-    "pooed",
-    "pooey",
-    "poofs",
-    "poofy",
-    "poohs",
-    "poohy",
-    "pooja",
-    "pooka",
-    "pooks",
-    "pools",
-    "pooly",
-    "poons",
-    "poopa",
-    "poops",
-    "poopy",
-    "poori",
-    "poort",
-    "poots",
-    "pooty",
-    "poove",
-    "poovy",
-    "popes",
-    "popia",
-    "popos",
-    "poppa",
-    "poppy",
-    "popsy",
-    "popup",
-    "porae",
-    "poral",
-    "porch",
-    "pored",
-    "porer",
-    "pores",
-    "porey",
-    "porge",
-    "porgy",
-    "porin",
-    "porks",
-    "porky",
-    "porno",
-    "porns",
-    "porny",
-    "porta",
-    "porte",
-    "porth",
-    "ports",
-    "porty",
-    "porus",
-    "posca",
-    "posed",
-    "poser",
-    "poses",
-    "poset",
-    "posey",
-    "posho",
-    "posit",
-    "posol",
-    "posse",
-    "poste",
-    "posts",
-    "potae",
-    "potai",
-    "potch",
-    "poted",
-    "potes",
-    "potin",
-    "potoo",
-    "potro",
-    "potsy",
-    "potto",
-    "potts",
-    "potty",
-    "pouce",
-    "pouch",
-    "pouff",
-    "poufs",
-    "poufy",
-    "pouis",
-    "pouke",
-    "pouks",
-    "poule",
-    "poulp",
-    "poult",
-    "pound",
-    "poupe",
-    "poupt",
-    "pours",
-    "pousy",
-    "pouts",
-    "pouty",
-    "povos",
-    "powan",
-    "power",
-    "powie",
-    "powin",
-    "powis",
-    "powlt",
-    "pownd",
-    "powns",
-    "powny",
-    "powre",
-    "powsy",
-    "poxed",
-    "poxes",
-    "poyas",
-    "poynt",
-    "poyou",
-    "poyse",
-    "pozzy",
-    "praam",
-    "prads",
-    "prags",
-    "prahu",
-    "prams",
-    "prana",
-    "prang",
-    "prank",
-    "praos",
-    "praps",
-    "prase",
-    "prate",
-    "prats",
-    "pratt",
-    "praty",
-    "praus",
-    "prawn",
-    "prays",
-    "preak",
-    "predy",
-    "preed",
-    "preem",
-    "preen",
-    "prees",
-    "preif",
-    "preke",
-    "prems",
-    "premy",
-    "prent",
-    "preon",
-    "preop",
-    "preps",
-    "presa",
-    "prese",
-    "press",
-    "prest",
-    "preta",
-    "preux",
-    "preve",
-    "prexy",
-    "preys",
-    "prial",
-    "prian",
-    "price",
-    "prick",
-    "pricy",
-    "pride",
-    "pridy",
-    "pried",
-    "prief",
-    "prier",
-    "pries",
-    "prigs",
-    "prill",
-    "prima",
-    "prime",
-    "primi",
-    "primo",
-    "primp",
-    "prims",
-    "primy",
-    "pring",
-    "prink",
-    "print",
-    "prion",
-    "prior",
-    "prise",
-    "prism",
-    "priss",
-    "prius",
-    "privy",
-    "prize",
-    "proal",
-    "proas",
-    "probe",
-    "probs",
-    "proby",
-    "prodd",
-    "prods",
-    "proem",
-    "profs",
-    "progs",
-    "proin",
-    "proke",
-    "prole",
-    "proll",
-    "promo",
-    "proms",
-    "prone",
-    "prong",
-    "pronk",
-    "proof",
-    "prook",
-    "proot",
-    "props",
-    "prora",
-    "prore",
-    "prose",
-    "proso",
-    "pross",
-    "prost",
-    "prosy",
-    "proto",
-    "proud",
-    "proul",
-    "prove",
-    "prowk",
-    "prowl",
-    "prows",
-    "proxy",
-    "proyn",
-    "prude",
-    "prune",
-    "pruno",
-    "prunt",
-    "pruny",
-    "pruta",
-    "pryan",
-    "pryer",
-    "pryse",
-    "psalm",
-    "pseud",
-    "pshaw",
-    "pshut",
-    "psias",
-    "psion",
-    "psoae",
-    "psoai",
-    "psoas",
-    "psora",
-    "psych",
-    "psyop",
-    "ptish",
-    "ptype",
-    "pubby",
-    "pubco",
-    "pubes",
-    "pubic",
-    "pubis",
-    "pubsy",
-    "pucan",
-    "pucer",
-    "puces",
-    "pucka",
-    "pucks",
-    "puddy",
-    "pudge",
-    "pudgy",
-    "pudic",
-    "pudor",
-    "pudsy",
-    "pudus",
-    "puers",
-    "puffa",
-    "puffs",
-    "puffy",
-    "puggy",
-    "pugil",
-    "puhas",
-    "pujah",
-    "pujas",
-    "pukas",
-    "puked",
-    "puker",
-    "pukes",
-    "pukey",
-    "pukka",
-    "pukus",
-    "pulao",
-    "pulas",
-    "puled",
-    "puler",
-    "pules",
-    "pulik",
-    "pulis",
-    "pulka",
-    "pulks",
-    "pulli",
-    "pulls",
-    "pully",
-    "pulmo",
-    "pulps",
-    "pulpy",
-    "pulse",
-    "pulus",
-    "pulut",
-    "pumas",
-    "pumie",
-    "pumps",
-    "pumpy",
-    "punas",
-    "punce",
-    "punch",
-    "punga",
-    "pungi",
-    "pungo",
-    "pungs",
-    "pungy",
-    "punim",
-    "punji",
-    "punka",
-    "punks",
-    "punky",
-    "punny",
-    "punto",
-    "punts",
-    "punty",
-    "pupae",
-    "pupal",
-    "pupas",
-    "pupil",
-    "puppa",
-    "puppy",
-    "pupus",
-    "purao",
-    "purau",
-    "purda",
-    "purdy",
-    "pured",
-    "puree",
-    "purer",
-    "pures",
-    "purga",
-    "purge",
-    "purin",
-    "puris",
-    "purls",
-    "puros",
-    "purps",
-    "purpy",
-    "purre",
-    "purrs",
-    "purry",
-    "purse",
-    "pursy",
-    "purty",
-    "puses",
-    "pushy",
-    "pusle",
-    "pussy",
-    "putas",
-    "puter",
-    "putid",
-    "putin",
-    "puton",
-    "putos",
-    "putti",
-    "putto",
-    "putts",
-    "puttu",
-    "putty",
-    "putza",
-    "puuko",
-    "puyas",
-    "puzel",
-    "puzta",
-    "pwned",
-    "pyats",
-    "pyets",
-    "pygal",
-    "pygmy",
-    "pyins",
-    "pylon",
-    "pyned",
-    "pynes",
-    "pyoid",
-    "pyots",
-    "pyral",
-    "pyran",
-    "pyres",
-    "pyrex",
-    "pyric",
-    "pyros",
-    "pyrus",
-    "pyuff",
-    "pyxed",
-    "pyxes",
-    "pyxie",
-    "pyxis",
-    "pzazz",
-    "qadis",
-    "qaids",
-    "qajaq",
-    "qanat",
-    "qapik",
-    "qibla",
-    "qilas",
-    "qipao",
-    "qophs",
-    "qorma",
-    "quabs",
-    "quack",
-    "quads",
-    "quaff",
-    "quags",
-    "quail",
-    "quair",
-    "quais",
-    "quake",
-    "quaky",
-    "quale",
-    "qualm",
-    "qualy",
-    "quank",
-    "quant",
-    "quare",
-    "quark",
-    "quarl",
-    "quart",
-    "quash",
-    "quasi",
-    "quass",
-    "quate",
-    "quats",
-    "quawk",
-    "quaws",
-    "quayd",
-    "quays",
-    "qubit",
-    "quean",
-    "queck",
-    "queek",
-    "queem",
-    "queen",
-    "queer",
-    "quell",
-    "queme",
-    "quena",
-    "quern",
-    "query",
-    "queso",
-    "quest",
-    "quete",
-    "queue",
-    "queyn",
-    "queys",
-    "queyu",
-    "quibs",
-    "quich",
-    "quick",
-    "quids",
-    "quies",
-    "quiet",
-    "quiff",
-    "quila",
-    "quill",
-    "quilt",
-    "quims",
-    "quina",
-    "quine",
-    "quink",
-    "quino",
-    "quins",
-    "quint",
-    "quipo",
-    "quips",
-    "quipu",
-    "quire",
-    "quirk",
-    "quirl",
-    "quirt",
-    "quist",
-    "quite",
-    "quits",
-    "quoad",
-    "quods",
-    "quoif",
-    "quoin",
-    "quois",
-    "quoit",
-    "quoll",
-    "quonk",
-    "quops",
-    "quork",
-    "quorl",
-    "quota",
-    "quote",
-    "quoth",
-    "quouk",
-    "quoys",
-    "quran",
-    "qursh",
-    "quyte",
-    "raads",
-    "raake",
-    "rabat",
-    "rabbi",
-    "rabic",
-    "rabid",
-    "rabis",
-    "raced",
-    "racer",
-    "races",
-    "rache",
-    "racks",
-    "racon",
-    "radar",
-    "raddi",
-    "raddy",
-    "radge",
-    "radgy",
-    "radif",
-    "radii",
-    "radio",
-    "radix",
-    "radon",
-    "rafee",
-    "raffs",
-    "raffy",
-    "rafik",
-    "rafiq",
-    "rafts",
-    "rafty",
-    "ragas",
-    "ragde",
-    "raged",
-    "ragee",
-    "rager",
-    "rages",
-    "ragga",
-    "raggs",
-    "raggy",
-    "ragis",
-    "ragus",
-    "rahed",
-    "rahui",
-    "raiah",
-    "raias",
-    "raids",
-    "raike",
-    "raiks",
-    "raile",
-    "rails",
-    "raine",
-    "rains",
-    "rainy",
-    "raird",
-    "raise",
-    "raita",
-    "raith",
-    "raits",
-    "rajah",
-    "rajas",
-    "rajes",
-    "raked",
-    "rakee",
-    "raker",
-    "rakes",
-    "rakhi",
-    "rakia",
-    "rakis",
-    "rakki",
-    "raksi",
-    "rakus",
-    "rales",
-    "ralli",
-    "rally",
-    "ralph",
-    "ramal",
-    "ramee",
-    "ramen",
-    "rames",
-    "ramet",
-    "ramie",
-    "ramin",
-    "ramis",
-    "rammy",
-    "ramon",
-    "ramps",
-    "ramse",
-    "ramsh",
-    "ramus",
-    "ranas",
-    "rance",
-    "ranch",
-    "rando",
-    "rands",
-    "randy",
-    "raned",
-    "ranee",
-    "ranes",
-    "ranga",
-    "range",
-    "rangi",
-    "rangs",
-    "rangy",
-    "ranid",
-    "ranis",
-    "ranke",
-    "ranks",
-    "ranns",
-    "ranny",
-    "ranse",
-    "rants",
-    "ranty",
-    "raped",
-    "rapee",
-    "raper",
-    "rapes",
-    "raphe",
-    "rapid",
-    "rapin",
-    "rappe",
-    "rapso",
-    "rared",
-    "raree",
-    "rarer",
-    "rares",
-    "rarks",
-    "rasam",
-    "rasas",
-    "rased",
-    "raser",
-    "rases",
-    "rasps",
-    "raspy",
-    "rasse",
-    "rasta",
-    "ratal",
-    "ratan",
-    "ratas",
-    "ratch",
-    "rated",
-    "ratel",
-    "rater",
-    "rates",
-    "ratha",
-    "rathe",
-    "raths",
-    "ratio",
-    "ratoo",
-    "ratos",
-    "ratti",
-    "ratty",
-    "ratus",
-    "rauli",
-    "rauns",
-    "raupo",
-    "raved",
-    "ravel",
-    "raven",
-    "raver",
-    "raves",
-    "ravey",
-    "ravin",
-    "rawdy",
-    "rawer",
-    "rawin",
-    "rawks",
-    "rawly",
-    "rawns",
-    "raxed",
-    "raxes",
-    "rayah",
-    "rayas",
-    "rayed",
-    "rayle",
-    "rayls",
-    "rayne",
-    "rayon",
-    "razai",
-    "razed",
-    "razee",
-    "razer",
-    "razes",
-    "razet",
-    "razoo",
-    "razor",
-    "reach",
-    "react",
-    "readd",
-    "reads",
-    "ready",
-    "reais",
-    "reaks",
-    "realm",
-    "realo",
-    "reals",
-    "reame",
-    "reams",
-    "reamy",
-    "reans",
-    "reaps",
-    "reard",
-    "rearm",
-    "rears",
-    "reast",
-    "reata",
-    "reate",
-    "reave",
-    "rebab",
-    "rebar",
-    "rebbe",
-    "rebec",
-    "rebel",
-    "rebid",
-    "rebit",
-    "rebop",
-    "rebud",
-    "rebus",
-    "rebut",
-    "rebuy",
-    "recal",
-    "recap",
-    "recce",
-    "recco",
-    "reccy",
-    "recep",
-    "recit",
-    "recks",
-    "recon",
-    "recta",
-    "recte",
-    "recti",
-    "recto",
-    "recue",
-    "recur",
-    "recut",
-    "redan",
-    "redds",
-    "reddy",
-    "reded",
-    "redes",
-    "redia",
-    "redid",
-    "redif",
-    "redig",
-    "redip",
-    "redly",
-    "redon",
-    "redos",
-    "redox",
-    "redry",
-    "redub",
-    "redug",
-    "redux",
-    "redye",
-    "reeaf",
-    "reech",
-    "reede",
-    "reeds",
-    "reedy",
-    "reefs",
-    "reefy",
-    "reeks",
-    "reeky",
-    "reels",
-    "reely",
-    "reems",
-    "reens",
-    "reerd",
-    "reest",
-    "reeve",
-    "reeze",
-    "refan",
-    "refed",
-    "refel",
-    "refer",
-    "reffo",
-    "refis",
-    "refit",
-    "refix",
-    "refly",
-    "refry",
-    "regal",
-    "regar",
-    "reges",
-    "reget",
-    "regex",
-    "reggo",
-    "regia",
-    "regie",
-    "regle",
-    "regma",
-    "regna",
-    "regos",
-    "regot",
-    "regur",
-    "rehab",
-    "rehem",
-    "reifs",
-    "reify",
-    "reign",
-    "reiki",
-    "reiks",
-    "reine",
-    "reing",
-    "reink",
-    "reins",
-    "reird",
-    "reist",
-    "reive",
-    "rejas",
-    "rejig",
-    "rejon",
-    "reked",
-    "rekes",
-    "rekey",
-    "relax",
-    "relay",
-    "relet",
-    "relic",
-    "relie",
-    "relit",
-    "rello",
-    "relos",
-    "reman",
-    "remap",
-    "remen",
-    "remet",
-    "remex",
-    "remit",
-    "remix",
-    "remou",
-    "renal",
-    "renay",
-    "rends",
-    "rendu",
-    "renew",
-    "reney",
-    "renga",
-    "rengs",
-    "renig",
-    "renin",
-    "renks",
-    "renne",
-    "renos",
-    "rente",
-    "rents",
-    "reoil",
-    "reorg",
-    "repas",
-    "repat",
-    "repay",
-    "repeg",
-    "repel",
-    "repen",
-    "repin",
-    "repla",
-    "reply",
-    "repos",
-    "repot",
-    "repps",
-    "repro",
-    "repun",
-    "reput",
-    "reran",
-    "rerig",
-    "rerun",
-    "resam",
-    "resat",
-    "resaw",
-    "resay",
-    "resee",
-    "reses",
-    "reset",
-    "resew",
-    "resid",
-    "resin",
-    "resit",
-    "resod",
-    "resol",
-    "resow",
-    "resto",
-    "rests",
-    "resty",
-    "resue",
-    "resus",
-    "retag",
-    "retam",
-    "retax",
-    "retch",
-    "retem",
-    "retia",
-    "retie",
-    "retin",
-    "retip",
-    "retox",
-    "retro",
-    "retry",
-    "reune",
-    "reups",
-    "reuse",
-    "revel",
-    "revet",
-    "revie",
-    "revow",
-    "revue",
-    "rewan",
-    "rewax",
-    "rewed",
-    "rewet",
-    "rewin",
-    "rewon",
-    "rewth",
-    "rexes",
-    "rezes",
-    "rhabd",
-    "rheas",
-    "rheid",
-    "rheme",
-    "rheum",
-    "rhies",
-    "rhime",
-    "rhine",
-    "rhino",
-    "rhody",
-    "rhomb",
-    "rhone",
-    "rhumb",
-    "rhyme",
-    "rhymy",
-    "rhyne",
-    "rhyta",
-    "riads",
-    "rials",
-    "riant",
-    "riata",
-    "riato",
-    "ribas",
-    "ribby",
-    "ribes",
-    "riced",
-    "ricer",
-    "rices",
-    "ricey",
-    "riche",
-    "richt",
-    "ricin",
-    "ricks",
-    "rider",
-    "rides",
-    "ridge",
-    "ridgy",
-    "ridic",
-    "riels",
-    "riems",
-    "rieve",
-    "rifer",
-    "riffs",
-    "riffy",
-    "rifle",
-    "rifte",
-    "rifts",
-    "rifty",
-    "riggs",
-    "right",
-    "rigid",
-    "rigmo",
-    "rigol",
-    "rigor",
-    "rikka",
-    "rikwa",
-    "riled",
-    "riles",
-    "riley",
-    "rille",
-    "rills",
-    "rilly",
-    "rimae",
-    "rimed",
-    "rimer",
-    "rimes",
-    "rimon",
-    "rimus",
-    "rince",
-    "rinds",
-    "rindy",
-    "rines",
-    "ringe",
-    "rings",
-    "ringy",
-    "rinks",
-    "rinse",
-    "rioja",
-    "rione",
-    "riots",
-    "rioty",
-    "riped",
-    "ripen",
-    "riper",
-    "ripes",
-    "ripps",
-    "riqqs",
-    "risen",
-    "riser",
-    "rises",
-    "rishi",
-    "risks",
-    "risky",
-    "risps",
-    "rists",
-    "risus",
-    "rites",
-    "rithe",
-    "ritts",
-    "ritzy",
-    "rival",
-    "rivas",
-    "rived",
-    "rivel",
-    "riven",
-    "river",
-    "rives",
-    "rivet",
-    "riyal",
-    "rizas",
-    "roach",
-    "roads",
-    "roady",
-    "roake",
-    "roaky",
-    "roams",
-    "roans",
-    "roany",
-    "roars",
-    "roary",
-    "roast",
-    "roate",
-    "robbo",
-    "robed",
-    "rober",
-    "robes",
-    "robin",
-    "roble",
-    "robot",
-    "robug",
-    "robur",
-    "roche",
-    "rocks",
-    "rocky",
-    "roded",
-    "rodeo",
-    "rodes",
-    "rodny",
-    "roers",
-    "rogan",
-    "roger",
-    "rogue",
-    "roguy",
-    "rohan",
-    "rohes",
-    "rohun",
-    "rohus",
-    "roids",
-    "roils",
-    "roily",
-    "roins",
-    "roist",
-    "rojak",
-    "rojis",
-    "roked",
-    "roker",
-    "rokes",
-    "rokey",
-    "rokos",
-    "rolag",
-    "roleo",
-    "roles",
-    "rolfs",
-    "rolls",
-    "rolly",
-    "romal",
-    "roman",
-    "romeo",
-    "romer",
-    "romps",
-    "rompu",
-    "rompy",
-    "ronde",
-    "rondo",
-    "roneo",
-    "rones",
-    "ronin",
-    "ronne",
-    "ronte",
-    "ronts",
-    "ronuk",
-    "roods",
-    "roofs",
-    "roofy",
-    "rooks",
-    "rooky",
-    "rooms",
-    "roomy",
-    "roons",
-    "roops",
-    "roopy",
-    "roosa",
-    "roose",
-    "roost",
-    "roots",
-    "rooty",
-    "roped",
-    "roper",
-    "ropes",
-    "ropey",
-    "roque",
-    "roral",
-    "rores",
-    "roric",
-    "rorid",
-    "rorie",
-    "rorts",
-    "rorty",
-    "rosal",
-    "rosco",
-    "rosed",
-    "roses",
-    "roset",
-    "rosha",
-    "roshi",
-    "rosin",
-    "rosit",
-    "rosps",
-    "rossa",
-    "rosso",
-    "rosti",
-    "rosts",
-    "rotal",
-    "rotan",
-    "rotas",
-    "rotch",
-    "roted",
-    "rotes",
-    "rotis",
-    "rotls",
-    "roton",
-    "rotor",
-    "rotos",
-    "rotta",
-    "rotte",
-    "rotto",
-    "rotty",
-    "rouen",
-    "roues",
-    "rouet",
-    "roufs",
-    "rouge",
-    "rough",
-    "rougy",
-    "rouks",
-    "rouky",
-    "roule",
-    "rouls",
-    "roums",
-    "round",
-    "roups",
-    "roupy",
-    "rouse",
-    "roust",
-    "route",
-    "routh",
-    "routs",
-    "roved",
-    "roven",
-    "rover",
-    "roves",
-    "rowan",
-    "rowdy",
-    "rowed",
-    "rowel",
-    "rowen",
-    "rower",
-    "rowet",
-    "rowie",
-    "rowme",
-    "rownd",
-    "rowns",
-    "rowth",
-    "rowts",
-    "royal",
-    "royet",
-    "royne",
-    "royst",
-    "rozes",
-    "rozet",
-    "rozit",
-    "ruach",
-    "ruana",
-    "rubai",
-    "ruban",
-    "rubby",
-    "rubel",
-    "rubes",
-    "rubin",
-    "rubio",
-    "ruble",
-    "rubli",
-    "rubor",
-    "rubus",
-    "ruche",
-    "ruchy",
-    "rucks",
-    "rudas",
-    "rudds",
-    "ruddy",
-    "ruder",
-    "rudes",
-    "rudie",
-    "rudis",
-    "rueda",
-    "ruers",
-    "ruffe",
-    "ruffs",
-    "ruffy",
-    "rufus",
-    "rugae",
-    "rugal",
-    "rugas",
-    "rugby",
-    "ruggy",
-    "ruice",
-    "ruing",
-    "ruins",
-    "rukhs",
-    "ruled",
-    "ruler",
-    "rules",
-    "rully",
-    "rumal",
-    "rumba",
-    "rumbo",
-    "rumen",
-    "rumes",
-    "rumly",
-    "rummy",
-    "rumor",
-    "rumpo",
-    "rumps",
-    "rumpy",
-    "runce",
-    "runch",
-    "runds",
-    "runed",
-    "runer",
-    "runes",
-    "rungs",
-    "runic",
-    "runny",
-    "runos",
-    "runts",
-    "runty",
-    "runup",
-    "ruote",
-    "rupee",
-    "rupia",
-    "rural",
-    "rurps",
-    "rurus",
-    "rusas",
-    "ruses",
-    "rushy",
-    "rusks",
-    "rusky",
-    "rusma",
-    "russe",
-    "rusts",
-    "rusty",
-    "ruths",
-    "rutin",
-    "rutty",
-    "ruvid",
-    "ryals",
-    "rybat",
-    "ryiji",
-    "ryijy",
-    "ryked",
-    "rykes",
-    "rymer",
-    "rymme",
-    "rynds",
-    "ryoti",
-    "ryots",
-    "ryper",
-    "rypin",
-    "rythe",
-    "ryugi",
-    "saags",
-    "sabal",
-    "sabed",
-    "saber",
-    "sabes",
-    "sabha",
-    "sabin",
-    "sabir",
-    "sabji",
-    "sable",
-    "sabos",
-    "sabot",
-    "sabra",
-    "sabre",
-    "sabzi",
-    "sacks",
-    "sacra",
-    "sacre",
-    "saddo",
-    "saddy",
-    "sades",
-    "sadhe",
-    "sadhu",
-    "sadic",
-    "sadis",
-    "sadly",
-    "sados",
-    "sadza",
-    "saeta",
-    "safed",
-    "safer",
-    "safes",
-    "sagar",
-    "sagas",
-    "sager",
-    "sages",
-    "saggy",
-    "sagos",
-    "sagum",
-    "sahab",
-    "saheb",
-    "sahib",
-    "saice",
-    "saick",
-    "saics",
-    "saids",
-    "saiga",
-    "sails",
-    "saims",
-    "saine",
-    "sains",
-    "saint",
-    "sairs",
-    "saist",
-    "saith",
-    "sajou",
-    "sakai",
-    "saker",
-    "sakes",
-    "sakia",
-    "sakis",
-    "sakti",
-    "salad",
-    "salal",
-    "salas",
-    "salat",
-    "salep",
-    "sales",
-    "salet",
-    "salic",
-    "salis",
-    "salix",
-    "salle",
-    "sally",
-    "salmi",
-    "salol",
-    "salon",
-    "salop",
-    "salpa",
-    "salps",
-    "salsa",
-    "salse",
-    "salto",
-    "salts",
-    "salty",
-    "salud",
-    "salue",
-    "salut",
-    "salve",
-    "salvo",
-    "saman",
-    "samas",
-    "samba",
-    "sambo",
-    "samek",
-    "samel",
-    "samen",
-    "sames",
-    "samey",
-    "samfi",
-    "samfu",
-    "sammy",
-    "sampi",
-    "samps",
-    "sanad",
-    "sands",
-    "sandy",
-    "saned",
-    "saner",
-    "sanes",
-    "sanga",
-    "sangh",
-    "sango",
-    "sangs",
-    "sanko",
-    "sansa",
-    "santo",
-    "sants",
-    "saola",
-    "sapan",
-    "sapid",
-    "sapor",
-    "sappy",
-    "saran",
-    "sards",
-    "sared",
-    "saree",
-    "sarge",
-    "sargo",
-    "sarin",
-    "sarir",
-    "saris",
-    "sarks",
-    "sarky",
-    "sarod",
-    "saros",
-    "sarus",
-    "sarvo",
-    "saser",
-    "sasin",
-    "sasse",
-    "sassy",
-    "satai",
-    "satay",
-    "sated",
-    "satem",
-    "sater",
-    "sates",
-    "satin",
-    "satis",
-    "satyr",
-    "sauba",
-    "sauce",
-    "sauch",
-    "saucy",
-    "saugh",
-    "sauls",
-    "sault",
-    "sauna",
-    "saunf",
-    "saunt",
-    "saury",
-    "saute",
-    "sauts",
-    "sauve",
-    "saved",
-    "saver",
-    "saves",
-    "savey",
-    "savin",
-    "savor",
-    "savoy",
-    "savvy",
-    "sawah",
-    "sawed",
-    "sawer",
-    "saxes",
-    "sayas",
-    "sayed",
-    "sayee",
-    "sayer",
-    "sayid",
-    "sayne",
-    "sayon",
-    "sayst",
-    "sazes",
-    "scabs",
-    "scads",
-    "scaff",
-    "scags",
-    "scail",
-    "scala",
-    "scald",
-    "scale",
-    "scall",
-    "scalp",
-    "scaly",
-    "scamp",
-    "scams",
-    "scand",
-    "scans",
-    "scant",
-    "scapa",
-    "scape",
-    "scapi",
-    "scare",
-    "scarf",
-    "scarp",
-    "scars",
-    "scart",
-    "scary",
-    "scath",
-    "scats",
-    "scatt",
-    "scaud",
-    "scaup",
-    "scaur",
-    "scaws",
-    "sceat",
-    "scena",
-    "scend",
-    "scene",
-    "scent",
-    "schav",
-    "schif",
-    "schmo",
-    "schul",
-    "schwa",
-    "scifi",
-    "scind",
-    "scion",
-    "scire",
-    "sclim",
-    "scobe",
-    "scody",
-    "scoff",
-    "scogs",
-    "scold",
-    "scone",
-    "scoog",
-    "scoop",
-    "scoot",
-    "scopa",
-    "scope",
-    "scops",
-    "score",
-    "scorn",
-    "scorp",
-    "scote",
-    "scots",
-    "scoug",
-    "scoup",
-    "scour",
-    "scout",
-    "scowl",
-    "scowp",
-    "scows",
-    "scrab",
-    "scrae",
-    "scrag",
-    "scram",
-    "scran",
-    "scrap",
-    "scrat",
-    "scraw",
-    "scray",
-    "scree",
-    "screw",
-    "scrim",
-    "scrip",
-    "scrob",
-    "scrod",
-    "scrog",
-    "scroo",
-    "scrow",
-    "scrub",
-    "scrum",
-    "scuba",
-    "scudi",
-    "scudo",
-    "scuds",
-    "scuff",
-    "scuft",
-    "scugs",
-    "sculk",
-    "scull",
-    "sculp",
-    "sculs",
-    "scums",
-    "scups",
-    "scurf",
-    "scurs",
-    "scuse",
-    "scuta",
-    "scute",
-    "scuts",
-    "scuzz",
-    "scyes",
-    "sdayn",
-    "sdein",
-    "seals",
-    "seame",
-    "seams",
-    "seamy",
-    "seans",
-    "seare",
-    "sears",
-    "sease",
-    "seats",
-    "seaze",
-    "sebum",
-    "secco",
-    "sechs",
-    "sects",
-    "sedan",
-    "seder",
-    "sedes",
-    "sedge",
-    "sedgy",
-    "sedum",
-    "seeds",
-    "seedy",
-    "seeks",
-    "seeld",
-    "seels",
-    "seely",
-    "seems",
-    "seeps",
-    "seepy",
-    "seers",
-    "sefer",
-    "segar",
-    "segas",
-    "segni",
-    "segno",
-    "segol",
-    "segos",
-    "segue",
-    "sehri",
-    "seifs",
-    "seils",
-    "seine",
-    "seirs",
-    "seise",
-    "seism",
-    "seity",
-    "seiza",
-    "seize",
-    "sekos",
-    "sekts",
-    "selah",
-    "seles",
-    "selfs",
-    "selfy",
-    "selky",
-    "sella",
-    "selle",
-    "sells",
-    "selva",
-    "semas",
-    "semee",
-    "semen",
-    "semes",
-    "semie",
-    "semis",
-    "senas",
-    "sends",
-    "senes",
-    "senex",
-    "sengi",
-    "senna",
-    "senor",
-    "sensa",
-    "sense",
-    "sensi",
-    "sensu",
-    "sente",
-    "senti",
-    "sents",
-    "senvy",
-    "senza",
-    "sepad",
-    "sepal",
-    "sepia",
-    "sepic",
-    "sepoy",
-    "seppo",
-    "septa",
-    "septs",
-    "serac",
-    "serai",
-    "seral",
-    "sered",
-    "serer",
-    "seres",
-    "serfs",
-    "serge",
-    "seria",
-    "seric",
-    "serif",
-    "serin",
-    "serir",
-    "serks",
-    "seron",
-    "serow",
-    "serra",
-    "serre",
-    "serrs",
-    "serry",
-    "serum",
-    "serve",
-    "servo",
-    "sesey",
-    "sessa",
-    "setae",
-    "setal",
-    "seter",
-    "seths",
-    "seton",
-    "setts",
-    "setup",
-    "sevak",
-    "seven",
-    "sever",
-    "sevir",
-    "sewan",
-    "sewar",
-    "sewed",
-    "sewel",
-    "sewen",
-    "sewer",
-    "sewin",
-    "sexed",
-    "sexer",
-    "sexes",
-    "sexor",
-    "sexto",
-    "sexts",
-    "seyen",
-    "sezes",
-    "shack",
-    "shade",
-    "shads",
-    "shady",
-    "shaft",
-    "shags",
-    "shahs",
-    "shaka",
-    "shake",
-    "shako",
-    "shakt",
-    "shaky",
-    "shale",
-    "shall",
-    "shalm",
-    "shalt",
-    "shaly",
-    "shama",
-    "shame",
-    "shams",
-    "shand",
-    "shank",
-    "shans",
-    "shape",
-    "shaps",
-    "shard",
-    "share",
-    "shark",
-    "sharn",
-    "sharp",
-    "shart",
-    "shash",
-    "shaul",
-    "shave",
-    "shawl",
-    "shawm",
-    "shawn",
-    "shaws",
-    "shaya",
-    "shays",
-    "shchi",
-    "sheaf",
-    "sheal",
-    "shear",
-    "sheas",
-    "sheds",
-    "sheel",
-    "sheen",
-    "sheep",
-    "sheer",
-    "sheet",
-    "sheik",
-    "shelf",
-    "shell",
-    "shend",
-    "sheng",
-    "shent",
-    "sheol",
-    "sherd",
-    "shere",
-    "shero",
-    "shets",
-    "sheva",
-    "shewn",
-    "shews",
-    "shiai",
-    "shied",
-    "shiel",
-    "shier",
-    "shies",
-    "shift",
-    "shill",
-    "shily",
-    "shims",
-    "shine",
-    "shins",
-    "shiny",
-    "shiok",
-    "ships",
-    "shire",
-    "shirk",
-    "shirr",
-    "shirs",
-    "shirt",
-    "shish",
-    "shiso",
-    "shist",
-    "shite",
-    "shits",
-    "shiur",
-    "shiva",
-    "shive",
-    "shivs",
-    "shlep",
-    "shlub",
-    "shmek",
-    "shmoe",
-    "shoal",
-    "shoat",
-    "shock",
-    "shoed",
-    "shoer",
-    "shoes",
-    "shogi",
-    "shogs",
-    "shoji",
-    "shojo",
-    "shola",
-    "shone",
-    "shonk",
-    "shook",
-    "shool",
-    "shoon",
-    "shoos",
-    "shoot",
-    "shope",
-    "shops",
-    "shore",
-    "shorl",
-    "shorn",
-    "short",
-    "shote",
-    "shots",
-    "shott",
-    "shoud",
-    "shout",
-    "shove",
-    "showd",
-    "shown",
-    "shows",
-    "showy",
-    "shoyu",
-    "shred",
-    "shrew",
-    "shris",
-    "shrow",
-    "shrub",
-    "shrug",
-    "shtar",
-    "shtik",
-    "shtum",
-    "shtup",
-    "shuba",
-    "shuck",
-    "shule",
-    "shuln",
-    "shuls",
-    "shuns",
-    "shunt",
-    "shura",
-    "shush",
-    "shute",
-    "shuts",
-    "shwas",
-    "shyer",
-    "shyly",
-    "sials",
-    "sibbs",
-    "sibia",
-    "sibyl",
-    "sices",
-    "sicht",
-    "sicko",
-    "sicks",
-    "sicky",
-    "sidas",
-    "sided",
-    "sider",
-    "sides",
-    "sidey",
-    "sidha",
-    "sidhe",
-    "sidle",
-    "siege",
-    "sield",
-    "siens",
-    "sient",
-    "sieth",
-    "sieur",
-    "sieve",
-    "sifts",
-    "sighs",
-    "sight",
-    "sigil",
-    "sigla",
-    "sigma",
-    "signa",
-    "signs",
-    "sigri",
-    "sijos",
-    "sikas",
-    "siker",
-    "sikes",
-    "silds",
-    "siled",
-    "silen",
-    "siler",
-    "siles",
-    "silex",
-    "silks",
-    "silky",
-    "sills",
-    "silly",
-    "silos",
-    "silts",
-    "silty",
-    "silva",
-    "simar",
-    "simas",
-    "simba",
-    "simis",
-    "simps",
-    "simul",
-    "since",
-    "sinds",
-    "sined",
-    "sines",
-    "sinew",
-    "singe",
-    "sings",
-    "sinhs",
-    "sinks",
-    "sinky",
-    "sinsi",
-    "sinus",
-    "siped",
-    "sipes",
-    "sippy",
-    "sired",
-    "siree",
-    "siren",
-    "sires",
-    "sirih",
-    "siris",
-    "siroc",
-    "sirra",
-    "sirup",
-    "sisal",
-    "sises",
-    "sissy",
-    "sista",
-    "sists",
-    "sitar",
-    "sitch",
-    "sited",
-    "sites",
-    "sithe",
-    "sitka",
-    "situp",
-    "situs",
-    "siver",
-    "sixer",
-    "sixes",
-    "sixmo",
-    "sixte",
-    "sixth",
-    "sixty",
-    "sizar",
-    "sized",
-    "sizel",
-    "sizer",
-    "sizes",
-    "skags",
-    "skail",
-    "skald",
-    "skank",
-    "skarn",
-    "skart",
-    "skate",
-    "skats",
-    "skatt",
-    "skaws",
-    "skean",
-    "skear",
-    "skeds",
-    "skeed",
-    "skeef",
-    "skeen",
-    "skeer",
-    "skees",
-    "skeet",
-    "skeev",
-    "skeez",
-    "skegg",
-    "skegs",
-    "skein",
-    "skelf",
-    "skell",
-    "skelm",
-    "skelp",
-    "skene",
-    "skens",
-    "skeos",
-    "skeps",
-    "skerm",
-    "skers",
-    "skets",
-    "skews",
-    "skids",
-    "skied",
-    "skier",
-    "skies",
-    "skiey",
-    "skiff",
-    "skill",
-    "skimo",
-    "skimp",
-    "skims",
-    "skink",
-    "skins",
-    "skint",
-    "skios",
-    "skips",
-    "skirl",
-    "skirr",
-    "skirt",
-    "skite",
-    "skits",
-    "skive",
-    "skivy",
-    "sklim",
-    "skoal",
-    "skobe",
-    "skody",
-    "skoff",
-    "skofs",
-    "skogs",
-    "skols",
-    "skool",
-    "skort",
-    "skosh",
-    "skran",
-    "skrik",
-    "skroo",
-    "skuas",
-    "skugs",
-    "skulk",
-    "skull",
-    "skunk",
-    "skyed",
-    "skyer",
-    "skyey",
-    "skyfs",
-    "skyre",
-    "skyrs",
-    "skyte",
-    "slabs",
-    "slack",
-    "slade",
-    "slaes",
-    "slags",
-    "slaid",
-    "slain",
-    "slake",
-    "slams",
-    "slane",
-    "slang",
-    "slank",
-    "slant",
-    "slaps",
-    "slart",
-    "slash",
-    "slate",
-    "slats",
-    "slaty",
-    "slave",
-    "slaws",
-    "slays",
-    "slebs",
-    "sleds",
-    "sleek",
-    "sleep",
-    "sleer",
-    "sleet",
-    "slept",
-    "slews",
-    "sleys",
-    "slice",
-    "slick",
-    "slide",
-    "slier",
-    "slily",
-    "slime",
-    "slims",
-    "slimy",
-    "sling",
-    "slink",
-    "slipe",
-    "slips",
-    "slipt",
-    "slish",
-    "slits",
-    "slive",
-    "sloan",
-    "slobs",
-    "sloes",
-    "slogs",
-    "sloid",
-    "slojd",
-    "sloka",
-    "slomo",
-    "sloom",
-    "sloop",
-    "sloot",
-    "slope",
-    "slops",
-    "slopy",
-    "slorm",
-    "slosh",
-    "sloth",
-    "slots",
-    "slove",
-    "slows",
-    "sloyd",
-    "slubb",
-    "slubs",
-    "slued",
-    "slues",
-    "sluff",
-    "slugs",
-    "sluit",
-    "slump",
-    "slums",
-    "slung",
-    "slunk",
-    "slurb",
-    "slurp",
-    "slurs",
-    "sluse",
-    "slush",
-    "sluts",
-    "slyer",
-    "slyly",
-    "slype",
-    "smaak",
-    "smack",
-    "smaik",
-    "small",
-    "smalm",
-    "smalt",
-    "smarm",
-    "smart",
-    "smash",
-    "smaze",
-    "smear",
-    "smeek",
-    "smees",
-    "smeik",
-    "smeke",
-    "smell",
-    "smelt",
-    "smerk",
-    "smews",
-    "smick",
-    "smile",
-    "smily",
-    "smirk",
-    "smirr",
-    "smirs",
-    "smite",
-    "smith",
-    "smits",
-    "smize",
-    "smock",
-    "smogs",
-    "smoke",
-    "smoko",
-    "smoky",
-    "smolt",
-    "smoor",
-    "smoot",
-    "smore",
-    "smorg",
-    "smote",
-    "smout",
-    "smowt",
-    "smugs",
-    "smurs",
-    "smush",
-    "smuts",
-    "snabs",
-    "snack",
-    "snafu",
-    "snags",
-    "snail",
-    "snake",
-    "snaky",
-    "snaps",
-    "snare",
-    "snarf",
-    "snark",
-    "snarl",
-    "snars",
-    "snary",
-    "snash",
-    "snath",
-    "snaws",
-    "snead",
-    "sneak",
-    "sneap",
-    "snebs",
-    "sneck",
-    "sneds",
-    "sneed",
-    "sneer",
-    "snees",
-    "snell",
-    "snibs",
-    "snick",
-    "snide",
-    "snied",
-    "snies",
-    "sniff",
-    "snift",
-    "snigs",
-    "snipe",
-    "snips",
-    "snipy",
-    "snirt",
-    "snits",
-    "snive",
-    "snobs",
-    "snods",
-    "snoek",
-    "snoep",
-    "snogs",
-    "snoke",
-    "snood",
-    "snook",
-    "snool",
-    "snoop",
-    "snoot",
-    "snore",
-    "snort",
-    "snots",
-    "snout",
-    "snowk",
-    "snows",
-    "snowy",
-    "snubs",
-    "snuck",
-    "snuff",
-    "snugs",
-    "snush",
-    "snyes",
-    "soaks",
-    "soaps",
-    "soapy",
-    "soare",
-    "soars",
-    "soave",
-    "sobas",
-    "sober",
-    "socas",
-    "soces",
-    "socia",
-    "socko",
-    "socks",
-    "socle",
-    "sodas",
-    "soddy",
-    "sodic",
-    "sodom",
-    "sofar",
-    "sofas",
-    "softa",
-    "softs",
-    "softy",
-    "soger",
-    "soggy",
-    "sohur",
-    "soils",
-    "soily",
-    "sojas",
-    "sojus",
-    "sokah",
-    "soken",
-    "sokes",
-    "sokol",
-    "solah",
-    "solan",
-    "solar",
-    "solas",
-    "solde",
-    "soldi",
-    "soldo",
-    "solds",
-    "soled",
-    "solei",
-    "soler",
-    "soles",
-    "solid",
-    "solon",
-    "solos",
-    "solum",
-    "solus",
-    "solve",
-    "soman",
-    "somas",
-    "sonar",
-    "sonce",
-    "sonde",
-    "sones",
-    "songo",
-    "songs",
-    "songy",
-    "sonic",
-    "sonly",
-    "sonne",
-    "sonny",
-    "sonse",
-    "sonsy",
-    "sooey",
-    "sooks",
-    "sooky",
-    "soole",
-    "sools",
-    "sooms",
-    "soops",
-    "soote",
-    "sooth",
-    "soots",
-    "sooty",
-    "sophs",
-    "sophy",
-    "sopor",
-    "soppy",
-    "sopra",
-    "soral",
-    "soras",
-    "sorbi",
-    "sorbo",
-    "sorbs",
-    "sorda",
-    "sordo",
-    "sords",
-    "sored",
-    "soree",
-    "sorel",
-    "sorer",
-    "sores",
-    "sorex",
-    "sorgo",
-    "sorns",
-    "sorra",
-    "sorry",
-    "sorta",
-    "sorts",
-    "sorus",
-    "soths",
-    "sotol",
-    "sotto",
-    "souce",
-    "souct",
-    "sough",
-    "souks",
-    "souls",
-    "souly",
-    "soums",
-    "sound",
-    "soups",
-    "soupy",
-    "sours",
-    "souse",
-    "south",
-    "souts",
-    "sowar",
-    "sowce",
-    "sowed",
-    "sower",
-    "sowff",
-    "sowfs",
-    "sowle",
-    "sowls",
-    "sowms",
-    "sownd",
-    "sowne",
-    "sowps",
-    "sowse",
-    "sowth",
-    "soxes",
-    "soyas",
-    "soyle",
-    "soyuz",
-    "sozin",
-    "space",
-    "spack",
-    "spacy",
-    "spade",
-    "spado",
-    "spads",
-    "spaed",
-    "spaer",
-    "spaes",
-    "spags",
-    "spahi",
-    "spail",
-    "spain",
-    "spait",
-    "spake",
-    "spald",
-    "spale",
-    "spall",
-    "spalt",
-    "spams",
-    "spane",
-    "spang",
-    "spank",
-    "spans",
-    "spard",
-    "spare",
-    "spark",
-    "spars",
-    "spart",
-    "spasm",
-    "spate",
-    "spats",
-    "spaul",
-    "spawl",
-    "spawn",
-    "spaws",
-    "spayd",
-    "spays",
-    "spaza",
-    "spazz",
-    "speak",
-    "speal",
-    "spean",
-    "spear",
-    "speat",
-    "speck",
-    "specs",
-    "spect",
-    "speed",
-    "speel",
-    "speer",
-    "speil",
-    "speir",
-    "speks",
-    "speld",
-    "spelk",
-    "spell",
-    "spelt",
-    "spend",
-    "spent",
-    "speos",
-    "sperm",
-    "spesh",
-    "spets",
-    "speug",
-    "spews",
-    "spewy",
-    "spial",
-    "spica",
-    "spice",
-    "spick",
-    "spics",
-    "spicy",
-    "spide",
-    "spied",
-    "spiel",
-    "spier",
-    "spies",
-    "spiff",
-    "spifs",
-    "spike",
-    "spiks",
-    "spiky",
-    "spile",
-    "spill",
-    "spilt",
-    "spims",
-    "spina",
-    "spine",
-    "spink",
-    "spins",
-    "spiny",
-    "spire",
-    "spirt",
-    "spiry",
-    "spite",
-    "spits",
-    "spitz",
-    "spivs",
-    "splat",
-    "splay",
-    "split",
-    "splog",
-    "spode",
-    "spods",
-    "spoil",
-    "spoke",
-    "spoof",
-    "spook",
-    "spool",
-    "spoom",
-    "spoon",
-    "spoor",
-    "spoot",
-    "spore",
-    "spork",
-    "sport",
-    "sposa",
-    "sposh",
-    "sposo",
-    "spots",
-    "spout",
-    "sprad",
-    "sprag",
-    "sprat",
-    "spray",
-    "spred",
-    "spree",
-    "sprew",
-    "sprig",
-    "sprit",
-    "sprod",
-    "sprog",
-    "sprue",
-    "sprug",
-    "spuds",
-    "spued",
-    "spuer",
-    "spues",
-    "spugs",
-    "spule",
-    "spume",
-    "spumy",
-    "spunk",
-    "spurn",
-    "spurs",
-    "spurt",
-    "sputa",
-    "spyal",
-    "spyre",
-    "squab",
-    "squad",
-    "squat",
-    "squaw",
-    "squee",
-    "squeg",
-    "squib",
-    "squid",
-    "squit",
-    "squiz",
-    "srsly",
-    "stabs",
-    "stack",
-    "stade",
-    "staff",
-    "stage",
-    "stags",
-    "stagy",
-    "staid",
-    "staig",
-    "stain",
-    "stair",
-    "stake",
-    "stale",
-    "stalk",
-    "stall",
-    "stamp",
-    "stand",
-    "stane",
-    "stang",
-    "stank",
-    "stans",
-    "staph",
-    "staps",
-    "stare",
-    "stark",
-    "starn",
-    "starr",
-    "stars",
-    "start",
-    "stary",
-    "stash",
-    "state",
-    "stats",
-    "statu",
-    "staun",
-    "stave",
-    "staws",
-    "stays",
-    "stead",
-    "steak",
-    "steal",
-    "steam",
-    "stean",
-    "stear",
-    "stedd",
-    "stede",
-    "steds",
-    "steed",
-    "steek",
-    "steel",
-    "steem",
-    "steen",
-    "steep",
-    "steer",
-    "steez",
-    "steik",
-    "steil",
-    "stein",
-    "stela",
-    "stele",
-    "stell",
-    "steme",
-    "stems",
-    "stend",
-    "steno",
-    "stens",
-    "stent",
-    "steps",
-    "stept",
-    "stere",
-    "stern",
-    "stets",
-    "stews",
-    "stewy",
-    "steys",
-    "stich",
-    "stick",
-    "stied",
-    "sties",
-    "stiff",
-    "stilb",
-    "stile",
-    "still",
-    "stilt",
-    "stime",
-    "stims",
-    "stimy",
-    "sting",
-    "stink",
-    "stint",
-    "stipa",
-    "stipe",
-    "stire",
-    "stirk",
-    "stirp",
-    "stirs",
-    "stive",
-    "stivy",
-    "stoae",
-    "stoai",
-    "stoas",
-    "stoat",
-    "stobs",
-    "stock",
-    "stoep",
-    "stogs",
-    "stogy",
-    "stoic",
-    "stoit",
-    "stoke",
-    "stole",
-    "stoln",
-    "stoma",
-    "stomp",
-    "stond",
-    "stone",
-    "stong",
-    "stonk",
-    "stonn",
-    "stony",
-    "stood",
-    "stook",
-    "stool",
-    "stoop",
-    "stoor",
-    "stope",
-    "stops",
-    "stopt",
-    "store",
-    "stork",
-    "storm",
-    "story",
-    "stoss",
-    "stots",
-    "stott",
-    "stoun",
-    "stoup",
-    "stour",
-    "stout",
-    "stove",
-    "stown",
-    "stowp",
-    "stows",
-    "strad",
-    "strae",
-    "strag",
-    "strak",
-    "strap",
-    "straw",
-    "stray",
-    "strep",
-    "strew",
-    "stria",
-    "strig",
-    "strim",
-    "strip",
-    "strop",
-    "strow",
-    "stroy",
-    "strum",
-    "strut",
-    "stubs",
-    "stuck",
-    "stucs",
-    "stude",
-    "studs",
-    "study",
-    "stuff",
-    "stull",
-    "stulm",
-    "stumm",
-    "stump",
-    "stums",
-    "stung",
-    "stunk",
-    "stuns",
-    "stunt",
-    "stupa",
-    "stupe",
-    "sture",
-    "sturt",
-    "stush",
-    "styed",
-    "styes",
-    "style",
-    "styli",
-    "stylo",
-    "styme",
-    "stymy",
-    "styre",
-    "styte",
-    "suave",
-    "subah",
-    "subak",
-    "subas",
-    "subby",
-    "suber",
-    "subha",
-    "succi",
-    "sucks",
-    "sucky",
-    "sucre",
-    "sudan",
-    "sudds",
-    "sudor",
-    "sudsy",
-    "suede",
-    "suent",
-    "suers",
-    "suete",
-    "suets",
-    "suety",
-    "sugan",
-    "sugar",
-    "sughs",
-    "sugos",
-    "suhur",
-    "suids",
-    "suing",
-    "suint",
-    "suite",
-    "suits",
-    "sujee",
-    "sukhs",
-    "sukis",
-    "sukuk",
-    "sulci",
-    "sulfa",
-    "sulfo",
-    "sulks",
-    "sulky",
-    "sulls",
-    "sully",
-    "sulph",
-    "sulus",
-    "sumac",
-    "sumis",
-    "summa",
-    "sumos",
-    "sumph",
-    "sumps",
-    "sunis",
-    "sunks",
-    "sunna",
-    "sunns",
-    "sunny",
-    "sunts",
-    "sunup",
-    "suona",
-    "suped",
-    "super",
-    "supes",
-    "supra",
-    "surah",
-    "sural",
-    "suras",
-    "surat",
-    "surds",
-    "sured",
-    "surer",
-    "sures",
-    "surfs",
-    "surfy",
-    "surge",
-    "surgy",
-    "surly",
-    "surra",
-    "sused",
-    "suses",
-    "sushi",
-    "susus",
-    "sutor",
-    "sutra",
-    "sutta",
-    "swabs",
-    "swack",
-    "swads",
-    "swage",
-    "swags",
-    "swail",
-    "swain",
-    "swale",
-    "swaly",
-    "swami",
-    "swamp",
-    "swamy",
-    "swang",
-    "swank",
-    "swans",
-    "swaps",
-    "swapt",
-    "sward",
-    "sware",
-    "swarf",
-    "swarm",
-    "swart",
-    "swash",
-    "swath",
-    "swats",
-    "swayl",
-    "sways",
-    "sweal",
-    "swear",
-    "sweat",
-    "swede",
-    "sweed",
-    "sweel",
-    "sweep",
-    "sweer",
-    "swees",
-    "sweet",
-    "sweir",
-    "swell",
-    "swelt",
-    "swept",
-    "swerf",
-    "sweys",
-    "swies",
-    "swift",
-    "swigs",
-    "swile",
-    "swill",
-    "swims",
-    "swine",
-    "swing",
-    "swink",
-    "swipe",
-    "swire",
-    "swirl",
-    "swish",
-    "swiss",
-    "swith",
-    "swits",
-    "swive",
-    "swizz",
-    "swobs",
-    "swole",
-    "swoll",
-    "swoln",
-    "swoon",
-    "swoop",
-    "swops",
-    "swopt",
-    "sword",
-    "swore",
-    "sworn",
-    "swots",
-    "swoun",
-    "swung",
-    "sybbe",
-    "sybil",
-    "syboe",
-    "sybow",
-    "sycee",
-    "syces",
-    "sycon",
-    "syeds",
-    "syens",
-    "syker",
-    "sykes",
-    "sylis",
-    "sylph",
-    "sylva",
-    "symar",
-    "synch",
-    "syncs",
-    "synds",
-    "syned",
-    "synes",
-    "synod",
-    "synth",
-    "syped",
-    "sypes",
-    "syphs",
-    "syrah",
-    "syren",
-    "syrup",
-    "sysop",
-    "sythe",
-    "syver",
-    "taals",
-    "taata",
-    "tabac",
-    "tabby",
-    "taber",
-    "tabes",
-    "tabid",
-    "tabis",
-    "tabla",
-    "table",
-    "tabls",
-    "taboo",
-    "tabor",
-    "tabos",
-    "tabun",
-    "tabus",
-    "tacan",
-    "taces",
-    "tacet",
-    "tache",
-    "tachi",
-    "tacho",
-    "tachs",
-    "tacit",
-    "tacks",
-    "tacky",
-    "tacos",
-    "tacts",
-    "tadah",
-    "taels",
-    "taffy",
-    "tafia",
-    "taggy",
-    "tagma",
-    "tagua",
-    "tahas",
-    "tahrs",
-    "taiga",
-    "taigs",
-    "taiko",
-    "tails",
-    "tains",
-    "taint",
-    "taira",
-    "taish",
-    "taits",
-    "tajes",
-    "takas",
-    "taken",
-    "taker",
-    "takes",
-    "takhi",
-    "takht",
-    "takin",
-    "takis",
-    "takky",
-    "talak",
-    "talaq",
-    "talar",
-    "talas",
-    "talcs",
-    "talcy",
-    "talea",
-    "taler",
-    "tales",
-    "talik",
-    "talks",
-    "talky",
-    "talls",
-    "tally",
-    "talma",
-    "talon",
-    "talpa",
-    "taluk",
-    "talus",
-    "tamal",
-    "tamas",
-    "tamed",
-    "tamer",
-    "tames",
-    "tamin",
-    "tamis",
-    "tammy",
-    "tamps",
-    "tanas",
-    "tanga",
-    "tangi",
-    "tango",
-    "tangs",
-    "tangy",
-    "tanhs",
-    "tania",
-    "tanka",
-    "tanks",
-    "tanky",
-    "tanna",
-    "tansu",
-    "tansy",
-    "tante",
-    "tanti",
-    "tanto",
-    "tanty",
-    "tapas",
-    "taped",
-    "tapen",
-    "taper",
-    "tapes",
-    "tapet",
-    "tapir",
-    "tapis",
-    "tappa",
-    "tapus",
-    "taras",
-    "tardo",
-    "tards",
-    "tardy",
-    "tared",
-    "tares",
-    "targa",
-    "targe",
-    "tarka",
-    "tarns",
-    "taroc",
-    "tarok",
-    "taros",
-    "tarot",
-    "tarps",
-    "tarre",
-    "tarry",
-    "tarse",
-    "tarsi",
-    "tarte",
-    "tarts",
-    "tarty",
-    "tarzy",
-    "tasar",
-    "tasca",
-    "tased",
-    "taser",
-    "tases",
-    "tasks",
-    "tassa",
-    "tasse",
-    "tasso",
-    "taste",
-    "tasto",
-    "tasty",
-    "tatar",
-    "tater",
-    "tates",
-    "taths",
-    "tatie",
-    "tatou",
-    "tatts",
-    "tatty",
-    "tatus",
-    "taube",
-    "tauld",
-    "taunt",
-    "tauon",
-    "taupe",
-    "tauts",
-    "tauty",
-    "tavah",
-    "tavas",
-    "taver",
-    "tawaf",
-    "tawai",
-    "tawas",
-    "tawed",
-    "tawer",
-    "tawie",
-    "tawny",
-    "tawse",
-    "tawts",
-    "taxed",
-    "taxer",
-    "taxes",
-    "taxis",
-    "taxol",
-    "taxon",
-    "taxor",
-    "taxus",
-    "tayra",
-    "tazza",
-    "tazze",
-    "teach",
-    "teade",
-    "teads",
-    "teaed",
-    "teaks",
-    "teals",
-    "teams",
-    "tears",
-    "teary",
-    "tease",
-    "teats",
-    "teaze",
-    "techs",
-    "techy",
-    "tecta",
-    "tecum",
-    "teddy",
-    "teels",
-    "teems",
-    "teend",
-    "teene",
-    "teens",
-    "teeny",
-    "teers",
-    "teeth",
-    "teets",
-    "teffs",
-    "teggs",
-    "tegua",
-    "tegus",
-    "tehee",
-    "tehrs",
-    "teiid",
-    "teils",
-    "teind",
-    "teins",
-    "tekke",
-    "telae",
-    "telco",
-    "teles",
-    "telex",
-    "telia",
-    "telic",
-    "tells",
-    "telly",
-    "teloi",
-    "telos",
-    "temed",
-    "temes",
-    "tempi",
-    "tempo",
-    "temps",
-    "tempt",
-    "temse",
-    "tench",
-    "tends",
-    "tendu",
-    "tenes",
-    "tenet",
-    "tenge",
-    "tenia",
-    "tenne",
-    "tenno",
-    "tenny",
-    "tenon",
-    "tenor",
-    "tense",
-    "tenth",
-    "tents",
-    "tenty",
-    "tenue",
-    "tepal",
-    "tepas",
-    "tepee",
-    "tepid",
-    "tepoy",
-    "terai",
-    "teras",
-    "terce",
-    "terek",
-    "teres",
-    "terfe",
-    "terfs",
-    "terga",
-    "terms",
-    "terne",
-    "terns",
-    "terra",
-    "terre",
-    "terry",
-    "terse",
-    "terts",
-    "terza",
-    "tesla",
-    "testa",
-    "teste",
-    "tests",
-    "testy",
-    "tetes",
-    "teths",
-    "tetra",
-    "tetri",
-    "teuch",
-    "teugh",
-    "tewed",
-    "tewel",
-    "tewit",
-    "texas",
-    "texes",
-    "texta",
-    "texts",
-    "thack",
-    "thagi",
-    "thaim",
-    "thale",
-    "thali",
-    "thana",
-    "thane",
-    "thang",
-    "thank",
-    "thans",
-    "thanx",
-    "tharm",
-    "thars",
-    "thaws",
-    "thawt",
-    "thawy",
-    "thebe",
-    "theca",
-    "theed",
-    "theek",
-    "thees",
-    "theft",
-    "thegn",
-    "theic",
-    "thein",
-    "their",
-    "thelf",
-    "thema",
-    "theme",
-    "thens",
-    "theor",
-    "theow",
-    "there",
-    "therm",
-    "these",
-    "thesp",
-    "theta",
-    "thete",
-    "thews",
-    "thewy",
-    "thick",
-    "thief",
-    "thigh",
-    "thigs",
-    "thilk",
-    "thill",
-    "thine",
-    "thing",
-    "think",
-    "thins",
-    "thiol",
-    "third",
-    "thirl",
-    "thoft",
-    "thole",
-    "tholi",
-    "thong",
-    "thorn",
-    "thoro",
-    "thorp",
-    "those",
-    "thots",
-    "thous",
-    "thowl",
-    "thrae",
-    "thraw",
-    "three",
-    "threw",
-    "thrid",
-    "thrip",
-    "throb",
-    "throe",
-    "throw",
-    "thrum",
-    "thuds",
-    "thugs",
-    "thuja",
-    "thumb",
-    "thump",
-    "thunk",
-    "thurl",
-    "thuya",
-    "thyme",
-    "thymi",
-    "thymy",
-    "tians",
-    "tiara",
-    "tiare",
-    "tiars",
-    "tibia",
-    "tical",
-    "ticca",
-    "ticed",
-    "tices",
-    "tichy",
-    "ticks",
-    "ticky",
-    "tidal",
-    "tiddy",
-    "tided",
-    "tides",
-    "tiefs",
-    "tiers",
-    "tiffs",
-    "tifos",
-    "tifts",
-    "tiger",
-    "tiges",
-    "tight",
-    "tigon",
-    "tikas",
-    "tikes",
-    "tikia",
-    "tikis",
-    "tikka",
-    "tilak",
-    "tilde",
-    "tiled",
-    "tiler",
-    "tiles",
-    "tills",
-    "tilly",
-    "tilth",
-    "tilts",
-    "timbo",
-    "timed",
-    "timer",
-    "times",
-    "timid",
-    "timon",
-    "timps",
-    "tinas",
-    "tinct",
-    "tinds",
-    "tinea",
-    "tined",
-    "tines",
-    "tinge",
-    "tings",
-    "tinks",
-    "tinny",
-    "tinto",
-    "tints",
-    "tinty",
-    "tipis",
-    "tippy",
-    "tipsy",
-    "tipup",
-    "tired",
-    "tires",
-    "tirls",
-    "tiros",
-    "tirrs",
-    "tirth",
-    "titan",
-    "titar",
-    "titas",
-    "titch",
-    "titer",
-    "tithe",
-    "tithi",
-    "titin",
-    "titir",
-    "titis",
-    "title",
-    "titre",
-    "titty",
-    "titup",
-    "tiyin",
-    "tiyns",
-    "tizes",
-    "tizzy",
-    "toads",
-    "toady",
-    "toast",
-    "toaze",
-    "tocks",
-    "tocky",
-    "tocos",
-    "today",
-    "todde",
-    "toddy",
-    "todea",
-    "todos",
-    "toeas",
-    "toffs",
-    "toffy",
-    "tofts",
-    "tofus",
-    "togae",
-    "togas",
-    "toged",
-    "toges",
-    "togue",
-    "tohos",
-    "toidy",
-    "toile",
-    "toils",
-    "toing",
-    "toise",
-    "toits",
-    "toity",
-    "tokay",
-    "toked",
-    "token",
-    "toker",
-    "tokes",
-    "tokos",
-    "tolan",
-    "tolar",
-    "tolas",
-    "toled",
-    "toles",
-    "tolls",
-    "tolly",
-    "tolts",
-    "tolus",
-    "tolyl",
-    "toman",
-    "tombo",
-    "tombs",
-    "tomen",
-    "tomes",
-    "tomia",
-    "tomin",
-    "tomme",
-    "tommy",
-    "tomos",
-    "tomoz",
-    "tonal",
-    "tondi",
-    "tondo",
-    "toned",
-    "toner",
-    "tones",
-    "toney",
-    "tonga",
-    "tongs",
-    "tonic",
-    "tonka",
-    "tonks",
-    "tonne",
-    "tonus",
-    "tools",
-    "tooms",
-    "toons",
-    "tooth",
-    "toots",
-    "topaz",
-    "toped",
-    "topee",
-    "topek",
-    "toper",
-    "topes",
-    "tophe",
-    "tophi",
-    "tophs",
-    "topic",
-    "topis",
-    "topoi",
-    "topos",
-    "toppy",
-    "toque",
-    "torah",
-    "toran",
-    "toras",
-    "torch",
-    "torcs",
-    "tores",
-    "toric",
-    "torii",
-    "toros",
-    "torot",
-    "torrs",
-    "torse",
-    "torsi",
-    "torsk",
-    "torso",
-    "torta",
-    "torte",
-    "torts",
-    "torus",
-    "tosas",
-    "tosed",
-    "toses",
-    "toshy",
-    "tossy",
-    "tosyl",
-    "total",
-    "toted",
-    "totem",
-    "toter",
-    "totes",
-    "totty",
-    "touch",
-    "tough",
-    "touks",
-    "touns",
-    "tours",
-    "touse",
-    "tousy",
-    "touts",
-    "touze",
-    "touzy",
-    "towai",
-    "towed",
-    "towel",
-    "tower",
-    "towie",
-    "towno",
-    "towns",
-    "towny",
-    "towse",
-    "towsy",
-    "towts",
-    "towze",
-    "towzy",
-    "toxic",
-    "toxin",
-    "toyed",
-    "toyer",
-    "toyon",
-    "toyos",
-    "tozed",
-    "tozes",
-    "tozie",
-    "trabs",
-    "trace",
-    "track",
-    "tract",
-    "trade",
-    "trads",
-    "trady",
-    "traga",
-    "tragi",
-    "trags",
-    "tragu",
-    "traik",
-    "trail",
-    "train",
-    "trait",
-    "tramp",
-    "trams",
-    "trank",
-    "tranq",
-    "trans",
-    "trant",
-    "trape",
-    "trapo",
-    "traps",
-    "trapt",
-    "trash",
-    "trass",
-    "trats",
-    "tratt",
-    "trave",
-    "trawl",
-    "trayf",
-    "trays",
-    "tread",
-    "treat",
-    "treck",
-    "treed",
-    "treen",
-    "trees",
-    "trefa",
-    "treif",
-    "treks",
-    "trema",
-    "trems",
-    "trend",
-    "tress",
-    "trest",
-    "trets",
-    "trews",
-    "treyf",
-    "treys",
-    "triac",
-    "triad",
-    "trial",
-    "tribe",
-    "trice",
-    "trick",
-    "tride",
-    "tried",
-    "trier",
-    "tries",
-    "trifa",
-    "triff",
-    "trigo",
-    "trigs",
-    "trike",
-    "trild",
-    "trill",
-    "trims",
-    "trine",
-    "trins",
-    "triol",
-    "trior",
-    "trios",
-    "tripe",
-    "trips",
-    "tripy",
-    "trist",
-    "trite",
-    "troad",
-    "troak",
-    "troat",
-    "trock",
-    "trode",
-    "trods",
-    "trogs",
-    "trois",
-    "troke",
-    "troll",
-    "tromp",
-    "trona",
-    "tronc",
-    "trone",
-    "tronk",
-    "trons",
-    "troop",
-    "trooz",
-    "trope",
-    "tropo",
-    "troth",
-    "trots",
-    "trout",
-    "trove",
-    "trows",
-    "troys",
-    "truce",
-    "truck",
-    "trued",
-    "truer",
-    "trues",
-    "trugo",
-    "trugs",
-    "trull",
-    "truly",
-    "trump",
-    "trunk",
-    "truss",
-    "trust",
-    "truth",
-    "tryer",
-    "tryke",
-    "tryma",
-    "tryps",
-    "tryst",
-    "tsade",
-    "tsadi",
-    "tsars",
-    "tsked",
-    "tsuba",
-    "tsubo",
-    "tuans",
-    "tuart",
-    "tuath",
-    "tubae",
-    "tubal",
-    "tubar",
-    "tubas",
-    "tubby",
-    "tubed",
-    "tuber",
-    "tubes",
-    "tucks",
-    "tufas",
-    "tuffe",
-    "tuffs",
-    "tufts",
-    "tufty",
-    "tugra",
-    "tuile",
-    "tuina",
-    "tuism",
-    "tuktu",
-    "tules",
-    "tulip",
-    "tulle",
-    "tulpa",
-    "tulps",
-    "tulsi",
-    "tumid",
-    "tummy",
-    "tumor",
-    "tumps",
-    "tumpy",
-    "tunas",
-    "tunds",
-    "tuned",
-    "tuner",
-    "tunes",
-    "tungs",
-    "tunic",
-    "tunny",
-    "tupek",
-    "tupik",
-    "tuple",
-    "tuque",
-    "turbo",
-    "turds",
-    "turfs",
-    "turfy",
-    "turks",
-    "turme",
-    "turms",
-    "turns",
-    "turnt",
-    "turon",
-    "turps",
-    "turrs",
-    "tushy",
-    "tusks",
-    "tusky",
-    "tutee",
-    "tutes",
-    "tutor",
-    "tutti",
-    "tutty",
-    "tutus",
-    "tuxes",
-    "tuyer",
-    "twaes",
-    "twain",
-    "twals",
-    "twang",
-    "twank",
-    "twats",
-    "tways",
-    "tweak",
-    "tweed",
-    "tweel",
-    "tween",
-    "tweep",
-    "tweer",
-    "tweet",
-    "twerk",
-    "twerp",
-    "twice",
-    "twier",
-    "twigs",
-    "twill",
-    "twilt",
-    "twine",
-    "twink",
-    "twins",
-    "twiny",
-    "twire",
-    "twirk",
-    "twirl",
-    "twirp",
-    "twist",
-    "twite",
-    "twits",
-    "twixt",
-    "twocs",
-    "twoer",
-    "twonk",
-    "twyer",
-    "tyees",
-    "tyers",
-    "tying",
-    "tyiyn",
-    "tykes",
-    "tyler",
-    "tymps",
-    "tynde",
-    "tyned",
-    "tynes",
-    "typal",
-    "typed",
-    "types",
-    "typey",
-    "typic",
-    "typos",
-    "typps",
-    "typto",
-    "tyran",
-    "tyred",
-    "tyres",
-    "tyros",
-    "tythe",
-    "tzars",
-    "ubacs",
-    "ubity",
-    "udals",
-    "udder",
-    "udons",
-    "udyog",
-    "ugali",
-    "ugged",
-    "uhlan",
-    "uhuru",
-    "ukase",
-    "ulama",
-    "ulans",
-    "ulcer",
-    "ulema",
-    "ulmin",
-    "ulmos",
-    "ulnad",
-    "ulnae",
-    "ulnar",
-    "ulnas",
-    "ulpan",
-    "ultra",
-    "ulvas",
-    "ulyie",
-    "ulzie",
-    "umami",
-    "umbel",
-    "umber",
-    "umble",
-    "umbos",
-    "umbra",
-    "umbre",
-    "umiac",
-    "umiak",
-    "umiaq",
-    "ummah",
-    "ummas",
-    "ummed",
-    "umped",
-    "umphs",
-    "umpie",
-    "umpty",
-    "umrah",
-    "umras",
-    "unagi",
-    "unais",
-    "unapt",
-    "unarm",
-    "unary",
-    "unaus",
-    "unbag",
-    "unban",
-    "unbar",
-    "unbed",
-    "unbid",
-    "unbox",
-    "uncap",
-    "unces",
-    "uncia",
-    "uncle",
-    "uncos",
-    "uncoy",
-    "uncus",
-    "uncut",
-    "undam",
-    "undee",
-    "under",
-    "undid",
-    "undos",
-    "undue",
-    "undug",
-    "uneth",
-    "unfed",
-    "unfit",
-    "unfix",
-    "ungag",
-    "unget",
-    "ungod",
-    "ungot",
-    "ungum",
-    "unhat",
-    "unhip",
-    "unica",
-    "unify",
-    "union",
-    "unios",
-    "unite",
-    "units",
-    "unity",
-    "unjam",
-    "unked",
-    "unket",
-    "unkey",
-    "unkid",
-    "unkut",
-    "unlap",
-    "unlaw",
-    "unlay",
-    "unled",
-    "unleg",
-    "unlet",
-    "unlid",
-    "unlit",
-    "unmad",
-    "unman",
-    "unmet",
-    "unmew",
-    "unmix",
-    "unode",
-    "unold",
-    "unown",
-    "unpay",
-    "unpeg",
-    "unpen",
-    "unpin",
-    "unply",
-    "unpot",
-    "unput",
-    "unred",
-    "unrid",
-    "unrig",
-    "unrip",
-    "unsaw",
-    "unsay",
-    "unsee",
-    "unset",
-    "unsew",
-    "unsex",
-    "unsod",
-    "unsub",
-    "untag",
-    "untax",
-    "untie",
-    "until",
-    "untin",
-    "unwed",
-    "unwet",
-    "unwit",
-    "unwon",
-    "unzip",
-    "upbow",
-    "upbye",
-    "updos",
-    "updry",
-    "upend",
-    "upful",
-    "upjet",
-    "uplay",
-    "upled",
-    "uplit",
-    "upped",
-    "upper",
-    "upran",
-    "uprun",
-    "upsee",
-    "upset",
-    "upsey",
-    "uptak",
-    "upter",
-    "uptie",
-    "uraei",
-    "urali",
-    "uraos",
-    "urare",
-    "urari",
-    "urase",
-    "urate",
-    "urban",
-    "urbex",
-    "urbia",
-    "urdee",
-    "ureal",
-    "ureas",
-    "uredo",
-    "ureic",
-    "ureid",
-    "urena",
-    "urent",
-    "urged",
-    "urger",
-    "urges",
-    "urial",
-    "urine",
-    "urite",
-    "urman",
-    "urnal",
-    "urned",
-    "urped",
-    "ursae",
-    "ursid",
-    "urson",
-    "urubu",
-    "urupa",
-    "urvas",
-    "usage",
-    "usens",
-    "users",
-    "useta",
-    "usher",
-    "using",
-    "usnea",
-    "usnic",
-    "usque",
-    "ustad",
-    "uster",
-    "usual",
-    "usure",
-    "usurp",
-    "usury",
-    "uteri",
-    "utero",
-    "utile",
-    "utter",
-    "uveal",
-    "uveas",
-    "uvula",
-    "vacas",
-    "vacay",
-    "vacua",
-    "vacui",
-    "vacuo",
-    "vadas",
-    "vaded",
-    "vades",
-    "vadge",
-    "vagal",
-    "vague",
-    "vagus",
-    "vaids",
-    "vails",
-    "vaire",
-    "vairs",
-    "vairy",
-    "vajra",
-    "vakas",
-    "vakil",
-    "vales",
-    "valet",
-    "valid",
-    "valis",
-    "valli",
-    "valor",
-    "valse",
-    "value",
-    "valve",
-    "vamps",
-    "vampy",
-    "vanda",
-    "vaned",
-    "vanes",
-    "vanga",
-    "vangs",
-    "vants",
-    "vaped",
-    "vaper",
-    "vapes",
-    "vapid",
-    "vapor",
-    "varan",
-    "varas",
-    "varda",
-    "vardo",
-    "vardy",
-    "varec",
-    "vares",
-    "varia",
-    "varix",
-    "varna",
-    "varus",
-    "varve",
-    "vasal",
-    "vases",
-    "vasts",
-    "vasty",
-    "vatas",
-    "vatha",
-    "vatic",
-    "vatje",
-    "vatos",
-    "vatus",
-    "vauch",
-    "vault",
-    "vaunt",
-    "vaute",
-    "vauts",
-    "vawte",
-    "vaxes",
-    "veale",
-    "veals",
-    "vealy",
-    "veena",
-    "veeps",
-    "veers",
-    "veery",
-    "vegan",
-    "vegas",
-    "veges",
-    "veggo",
-    "vegie",
-    "vegos",
-    "vehme",
-    "veils",
-    "veily",
-    "veins",
-    "veiny",
-    "velar",
-    "velds",
-    "veldt",
-    "veles",
-    "vells",
-    "velum",
-    "venae",
-    "venal",
-    "venas",
-    "vends",
-    "vendu",
-    "veney",
-    "venge",
-    "venin",
-    "venom",
-    "venti",
-    "vents",
-    "venue",
-    "venus",
-    "verba",
-    "verbs",
-    "verde",
-    "verge",
-    "verra",
-    "verre",
-    "verry",
-    "versa",
-    "verse",
-    "verso",
-    "verst",
-    "verte",
-    "verts",
-    "vertu",
-    "verve",
-    "vespa",
-    "vesta",
-    "vests",
-    "vetch",
-    "veuve",
-    "veves",
-    "vexed",
-    "vexer",
-    "vexes",
-    "vexil",
-    "vezir",
-    "vials",
-    "viand",
-    "vibed",
-    "vibes",
-    "vibex",
-    "vibey",
-    "vicar",
-    "viced",
-    "vices",
-    "vichy",
-    "vicus",
-    "video",
-    "viers",
-    "vieux",
-    "views",
-    "viewy",
-    "vifda",
-    "viffs",
-    "vigas",
-    "vigia",
-    "vigil",
-    "vigor",
-    "vilde",
-    "viler",
-    "villa",
-    "ville",
-    "villi",
-    "vills",
-    "vimen",
-    "vinal",
-    "vinas",
-    "vinca",
-    "vined",
-    "viner",
-    "vines",
-    "vinew",
-    "vinho",
-    "vinic",
-    "vinny",
-    "vinos",
-    "vints",
-    "vinyl",
-    "viola",
-    "viold",
-    "viols",
-    "viper",
-    "viral",
-    "vired",
-    "vireo",
-    "vires",
-    "virga",
-    "virge",
-    "virgo",
-    "virid",
-    "virls",
-    "virtu",
-    "virus",
-    "visas",
-    "vised",
-    "vises",
-    "visie",
-    "visit",
-    "visna",
-    "visne",
-    "vison",
-    "visor",
-    "vista",
-    "visto",
-    "vitae",
-    "vital",
-    "vitas",
-    "vitex",
-    "vitro",
-    "vitta",
-    "vivas",
-    "vivat",
-    "vivda",
-    "viver",
-    "vives",
-    "vivid",
-    "vivos",
-    "vivre",
-    "vixen",
-    "vizir",
-    "vizor",
-    "vlast",
-    "vleis",
-    "vlies",
-    "vlogs",
-    "voars",
-    "vobla",
-    "vocab",
-    "vocal",
-    "voces",
-    "voddy",
-    "vodka",
-    "vodou",
-    "vodun",
-    "voema",
-    "vogie",
-    "vogue",
-    "voice",
-    "voici",
-    "voids",
-    "voila",
-    "voile",
-    "voips",
-    "volae",
-    "volar",
-    "voled",
-    "voles",
-    "volet",
-    "volke",
-    "volks",
-    "volta",
-    "volte",
-    "volti",
-    "volts",
-    "volva",
-    "volve",
-    "vomer",
-    "vomit",
-    "voted",
-    "voter",
-    "votes",
-    "vouch",
-    "vouge",
-    "voulu",
-    "vowed",
-    "vowel",
-    "vower",
-    "voxel",
-    "voxes",
-    "vozhd",
-    "vraic",
-    "vrils",
-    "vroom",
-    "vrous",
-    "vrouw",
-    "vrows",
-    "vuggs",
-    "vuggy",
-    "vughs",
-    "vughy",
-    "vulgo",
-    "vulns",
-    "vulva",
-    "vutty",
-    "vygie",
-    "vying",
-    "waacs",
-    "wacke",
-    "wacko",
-    "wacks",
-    "wacky",
-    "wadas",
-    "wadds",
-    "waddy",
-    "waded",
-    "wader",
-    "wades",
-    "wadge",
-    "wadis",
-    "wadts",
-    "wafer",
-    "waffs",
-    "wafts",
-    "waged",
-    "wager",
-    "wages",
-    "wagga",
-    "wagon",
-    "wagyu",
-    "wahay",
-    "wahey",
-    "wahoo",
-    "waide",
-    "waifs",
-    "waift",
-    "wails",
-    "wains",
-    "wairs",
-    "waist",
-    "waite",
-    "waits",
-    "waive",
-    "wakas",
-    "waked",
-    "waken",
-    "waker",
-    "wakes",
-    "wakfs",
-    "waldo",
-    "walds",
-    "waled",
-    "waler",
-    "wales",
-    "walie",
-    "walis",
-    "walks",
-    "walla",
-    "walls",
-    "wally",
-    "walty",
-    "waltz",
-    "wamed",
-    "wames",
-    "wamus",
-    "wands",
-    "waned",
-    "wanes",
-    "waney",
-    "wangs",
-    "wanks",
-    "wanky",
-    "wanle",
-    "wanly",
-    "wanna",
-    "wanta",
-    "wants",
-    "wanty",
-    "wanze",
-    "waqfs",
-    "warbs",
-    "warby",
-    "wards",
-    "wared",
-    "wares",
-    "warez",
-    "warks",
-    "warms",
-    "warns",
-    "warps",
-    "warre",
-    "warst",
-    "warts",
-    "warty",
-    "wases",
-    "washi",
-    "washy",
-    "wasms",
-    "wasps",
-    "waspy",
-    "waste",
-    "wasts",
-    "watap",
-    "watch",
-    "water",
-    "watts",
-    "wauff",
-    "waugh",
-    "wauks",
-    "waulk",
-    "wauls",
-    "waurs",
-    "waved",
-    "waver",
-    "waves",
-    "wavey",
-    "wawas",
-    "wawes",
-    "wawls",
-    "waxed",
-    "waxen",
-    "waxer",
-    "waxes",
-    "wayed",
-    "wazir",
-    "wazoo",
-    "weald",
-    "weals",
-    "weamb",
-    "weans",
-    "wears",
-    "weary",
-    "weave",
-    "webby",
-    "weber",
-    "wecht",
-    "wedel",
-    "wedge",
-    "wedgy",
-    "weeds",
-    "weedy",
-    "weeis",
-    "weeke",
-    "weeks",
-    "weels",
-    "weems",
-    "weens",
-    "weeny",
-    "weeps",
-    "weepy",
-    "weest",
-    "weete",
-    "weets",
-    "wefte",
-    "wefts",
-    "weids",
-    "weigh",
-    "weils",
-    "weird",
-    "weirs",
-    "weise",
-    "weize",
-    "wekas",
-    "welch",
-    "welds",
-    "welke",
-    "welks",
-    "welkt",
-    "wells",
-    "welly",
-    "welsh",
-    "welts",
-    "wembs",
-    "wench",
-    "wends",
-    "wenge",
-    "wenny",
-    "wents",
-    "werfs",
-    "weros",
-    "wersh",
-    "wests",
-    "wetas",
-    "wetly",
-    "wexed",
-    "wexes",
-    "whack",
-    "whale",
-    "whamo",
-    "whams",
-    "whang",
-    "whaps",
-    "whare",
-    "wharf",
-    "whata",
-    "whats",
-    "whaup",
-    "whaur",
-    "wheal",
-    "whear",
-    "wheat",
-    "wheek",
-    "wheel",
-    "wheen",
-    "wheep",
-    "wheft",
-    "whelk",
-    "whelm",
-    "whelp",
-    "whens",
-    "where",
-    "whets",
-    "whews",
-    "wheys",
-    "which",
-    "whids",
-    "whies",
-    "whiff",
-    "whift",
-    "whigs",
-    "while",
-    "whilk",
-    "whims",
-    "whine",
-    "whins",
-    "whiny",
-    "whios",
-    "whips",
-    "whipt",
-    "whirl",
-    "whirr",
-    "whirs",
-    "whish",
-    "whisk",
-    "whiss",
-    "whist",
-    "white",
-    "whits",
-    "whity",
-    "whizz",
-    "whole",
-    "whomp",
-    "whoof",
-    "whoop",
-    "whoot",
-    "whops",
-    "whore",
-    "whorl",
-    "whort",
-    "whose",
-    "whoso",
-    "whows",
-    "whump",
-    "whups",
-    "whyda",
-    "wicca",
-    "wicks",
-    "wicky",
-    "widdy",
-    "widen",
-    "wider",
-    "wides",
-    "widow",
-    "width",
-    "wield",
-    "wiels",
-    "wifed",
-    "wifes",
-    "wifey",
-    "wifie",
-    "wifts",
-    "wifty",
-    "wigan",
-    "wigga",
-    "wiggy",
-    "wight",
-    "wikis",
-    "wilco",
-    "wilds",
-    "wiled",
-    "wiles",
-    "wilga",
-    "wilis",
-    "wilja",
-    "wills",
-    "willy",
-    "wilts",
-    "wimps",
-    "wimpy",
-    "wince",
-    "winch",
-    "winds",
-    "windy",
-    "wined",
-    "wines",
-    "winey",
-    "winge",
-    "wings",
-    "wingy",
-    "winks",
-    "winky",
-    "winna",
-    "winns",
-    "winos",
-    "winze",
-    "wiped",
-    "wiper",
-    "wipes",
-    "wired",
-    "wirer",
-    "wires",
-    "wirra",
-    "wirri",
-    "wised",
-    "wiser",
-    "wises",
-    "wisha",
-    "wisht",
-    "wisps",
-    "wispy",
-    "wists",
-    "witan",
-    "witch",
-    "wited",
-    "wites",
-    "withe",
-    "withs",
-    "withy",
-    "witty",
-    "wived",
-    "wiver",
-    "wives",
-    "wizen",
-    "wizes",
-    "wizzo",
-    "woads",
-    "woady",
-    "woald",
-    "wocks",
-    "wodge",
-    "wodgy",
-    "woful",
-    "wojus",
-    "woken",
-    "woker",
-    "wokka",
-    "wolds",
-    "wolfs",
-    "wolly",
-    "wolve",
-    "woman",
-    "womas",
-    "wombs",
-    "womby",
-    "women",
-    "womyn",
-    "wonga",
-    "wongi",
-    "wonks",
-    "wonky",
-    "wonts",
-    "woods",
-    "woody",
-    "wooed",
-    "wooer",
-    "woofs",
-    "woofy",
-    "woold",
-    "wools",
-    "wooly",
-    "woons",
-    "woops",
-    "woopy",
-    "woose",
-    "woosh",
-    "wootz",
-    "woozy",
-    "words",
-    "wordy",
-    "works",
-    "worky",
-    "world",
-    "worms",
-    "wormy",
-    "worry",
-    "worse",
-    "worst",
-    "worth",
-    "worts",
-    "would",
-    "wound",
-    "woven",
-    "wowed",
-    "wowee",
-    "wowse",
-    "woxen",
-    "wrack",
-    "wrang",
-    "wraps",
-    "wrapt",
-    "wrast",
-    "wrate",
-    "wrath",
-    "wrawl",
-    "wreak",
-    "wreck",
-    "wrens",
-    "wrest",
-    "wrick",
-    "wried",
-    "wrier",
-    "wries",
-    "wring",
-    "wrist",
-    "write",
-    "writs",
-    "wroke",
-    "wrong",
-    "wroot",
-    "wrote",
-    "wroth",
-    "wrung",
-    "wryer",
-    "wryly",
-    "wuddy",
-    "wudus",
-    "wuffs",
-    "wulls",
-    "wunga",
-    "wurst",
-    "wuses",
-    "wushu",
-    "wussy",
-    "wuxia",
-    "wyled",
-    "wyles",
-    "wynds",
-    "wynns",
-    "wyted",
-    "wytes",
-    "wythe",
-    "xebec",
-    "xenia",
-    "xenic",
-    "xenon",
-    "xeric",
-    "xerox",
-    "xerus",
-    "xoana",
-    "xolos",
-    "xrays",
-    "xviii",
-    "xylan",
-    "xylem",
-    "xylic",
-    "xylol",
-    "xylyl",
-    "xysti",
-    "xysts",
-    "yaars",
-    "yaass",
-    "yabas",
-    "yabba",
-    "yabby",
-    "yacca",
-    "yacht",
-    "yacka",
-    "yacks",
-    "yadda",
-    "yaffs",
-    "yager",
-    "yages",
-    "yagis",
-    "yagna",
-    "yahoo",
-    "yaird",
-    "yajna",
-    "yakka",
-    "yakow",
-    "yales",
-    "yamen",
-    "yampa",
-    "yampy",
-    "yamun",
-    "yandy",
-    "yangs",
-    "yanks",
-    "yapok",
-    "yapon",
-    "yapps",
-    "yappy",
-    "yarak",
-    "yarco",
-    "yards",
-    "yarer",
-    "yarfa",
-    "yarks",
-    "yarns",
-    "yarra",
-    "yarrs",
-    "yarta",
-    "yarto",
-    "yates",
-    "yatra",
-    "yauds",
-    "yauld",
-    "yaups",
-    "yawed",
-    "yawey",
-    "yawls",
-    "yawns",
-    "yawny",
-    "yawps",
-    "yayas",
-    "ybore",
-    "yclad",
-    "ycled",
-    "ycond",
-    "ydrad",
-    "ydred",
-    "yeads",
-    "yeahs",
-    "yealm",
-    "yeans",
-    "yeard",
-    "yearn",
-    "years",
-    "yeast",
-    "yecch",
-    "yechs",
-    "yechy",
-    "yedes",
-    "yeeds",
-    "yeeek",
-    "yeesh",
-    "yeggs",
-    "yelks",
-    "yells",
-    "yelms",
-    "yelps",
-    "yelts",
-    "yenta",
-    "yente",
-    "yerba",
-    "yerds",
-    "yerks",
-    "yeses",
-    "yesks",
-    "yests",
-    "yesty",
-    "yetis",
-    "yetts",
-    "yeuch",
-    "yeuks",
-    "yeuky",
-    "yeven",
-    "yeves",
-    "yewen",
-    "yexed",
-    "yexes",
-    "yfere",
-    "yield",
-    "yiked",
-    "yikes",
-    "yills",
-    "yince",
-    "yipes",
-    "yippy",
-    "yirds",
-    "yirks",
-    "yirrs",
-    "yirth",
-    "yites",
-    "yitie",
-    "ylems",
-    "ylide",
-    "ylids",
-    "ylike",
-    "ylkes",
-    "ymolt",
-    "ympes",
-    "yobbo",
-    "yobby",
-    "yocks",
-    "yodel",
-    "yodhs",
-    "yodle",
-    "yogas",
-    "yogee",
-    "yoghs",
-    "yogic",
-    "yogin",
-    "yogis",
-    "yohah",
-    "yohay",
-    "yoick",
-    "yojan",
-    "yokan",
-    "yoked",
-    "yokeg",
-    "yokel",
-    "yoker",
-    "yokes",
-    "yokul",
-    "yolks",
-    "yolky",
-    "yolps",
-    "yomim",
-    "yomps",
-    "yonic",
-    "yonis",
-    "yonks",
-    "yonny",
-    "yoofs",
-    "yoops",
-    "yopos",
-    "yoppo",
-    "yores",
-    "yorga",
-    "yorks",
-    "yorps",
-    "youks",
-    "young",
-    "yourn",
-    "yours",
-    "yourt",
-    "youse",
-    "youth",
-    "yowed",
-    "yowes",
-    "yowie",
-    "yowls",
-    "yowsa",
-    "yowza",
-    "yoyos",
-    "yrapt",
-    "yrent",
-    "yrivd",
-    "yrneh",
-    "ysame",
-    "ytost",
-    "yuans",
-    "yucas",
-    "yucca",
-    "yucch",
-    "yucko",
-    "yucks",
-    "yucky",
-    "yufts",
-    "yugas",
-    "yuked",
-    "yukes",
-    "yukky",
-    "yukos",
-    "yulan",
-    "yules",
-    "yummo",
-    "yummy",
-    "yumps",
-    "yupon",
-    "yuppy",
-    "yurta",
-    "yurts",
-    "yuzus",
-    "zabra",
-    "zacks",
-    "zaida",
-    "zaide",
-    "zaidy",
-    "zaire",
-    "zakat",
-    "zamac",
-    "zamak",
-    "zaman",
-    "zambo",
-    "zamia",
-    "zamis",
-    "zanja",
-    "zante",
-    "zanza",
-    "zanze",
-    "zappy",
-    "zarda",
-    "zarfs",
-    "zaris",
-    "zatis",
-    "zawns",
-    "zaxes",
-    "zayde",
-    "zayin",
-    "zazen",
-    "zeals",
-    "zebec",
-    "zebra",
-    "zebub",
-    "zebus",
-    "zedas",
-    "zeera",
-    "zeins",
-    "zendo",
-    "zerda",
-    "zerks",
-    "zeros",
-    "zests",
-    "zesty",
-    "zetas",
-    "zexes",
-    "zezes",
-    "zhomo",
-    "zhush",
-    "zhuzh",
-    "zibet",
-    "ziffs",
-    "zigan",
-    "zikrs",
-    "zilas",
-    "zilch",
-    "zilla",
-    "zills",
-    "zimbi",
-    "zimbs",
-    "zinco",
-    "zincs",
-    "zincy",
-    "zineb",
-    "zines",
-    "zings",
-    "zingy",
-    "zinke",
-    "zinky",
-    "zinos",
-    "zippo",
-    "zippy",
-    "ziram",
-    "zitis",
-    "zitty",
-    "zizel",
-    "zizit",
-    "zlote",
-    "zloty",
-    "zoaea",
-    "zobos",
-    "zobus",
-    "zocco",
-    "zoeae",
-    "zoeal",
-    "zoeas",
-    "zoism",
-    "zoist",
-    "zokor",
-    "zolle",
-    "zombi",
-    "zonae",
-    "zonal",
-    "zonda",
-    "zoned",
-    "zoner",
-    "zones",
-    "zonks",
-    "zooea",
-    "zooey",
-    "zooid",
-    "zooks",
-    "zooms",
-    "zoomy",
-    "zoons",
-    "zooty",
-    "zoppa",
-    "zoppo",
-    "zoril",
-    "zoris",
-    "zorro",
-    "zorse",
-    "zouks",
-    "zowee",
-    "zowie",
-    "zulus",
-    "zupan",
-    "zupas",
-    "zuppa",
-    "zurfs",
-    "zuzim",
-    "zygal",
-    "zygon",
-    "zymes",
-    "zymic"
+// Built-in word lists as contiguous 5 byte records, sorted and unique.
+// Only Dictionary.cpp includes this header.
+
+const char ALL_WORDS[][5] = {
+    {'a','a','h','e','d'},
+    {'a','a','l','i','i'},
+    {'a','a','p','a','s'},
+    {'a','a','r','g','h'},
+    {'a','a','r','t','i'},
+    {'a','b','a','c','a'},
+    {'a','b','a','c','i'},
+    {'a','b','a','c','k'},
+    {'a','b','a','c','s'},
+    {'a','b','a','f','t'},
+    {'a','b','a','h','t'},
+    {'a','b','a','k','a'},
+    {'a','b','a','m','p'},
+    {'a','b','a','n','d'},
+    {'a','b','a','s','e'},
+    {'a','b','a','s','h'},
+    {'a','b','a','s','k'},
+    {'a','b','a','t','e'},
+    {'a','b','a','y','a'},
+    {'a','b','b','a','s'},
+    {'a','b','b','e','d'},
+    {'a','b','b','e','s'},
+    {'a','b','b','e','y'},
+    {'a','b','b','o','t'},
+    {'a','b','c','e','e'},
+    {'a','b','e','a','m'},
+    {'a','b','e','a','r'},
+    {'a','b','e','a','t'},
+    {'a','b','e','e','r'},
+    {'a','b','e','l','e'},
+    {'a','b','e','n','g'},
+    {'a','b','e','r','s'},
+    {'a','b','e','t','s'},
+    {'a','b','e','y','s'},
+    {'a','b','h','o','r'},
+    {'a','b','i','d','e'},
+    {'a','b','i','e','s'},
+    {'a','b','i','u','s'},
+    {'a','b','j','a','d'},
+    {'a','b','j','u','d'},
+    {'a','b','l','e','d'},
+    {'a','b','l','e','r'},
+    {'a','b','l','e','s'},
+    {'a','b','l','e','t'},
+    {'a','b','l','o','w'},
+    {'a','b','m','h','o'},
+    {'a','b','n','e','t'},
+    {'a','b','o','d','e'},
+    {'a','b','o','h','m'},
+    {'a','b','o','i','l'},
+    {'a','b','o','m','a'},
+    {'a','b','o','o','n'},
+    {'a','b','o','r','d'},
+    {'a','b','o','r','e'},
+    {'a','b','o','r','n'},
+    {'a','b','o','r','t'},
+    {'a','b','o','u','t'},
+    {'a','b','o','v','e'},
+    {'a','b','r','a','m'},
+    {'a','b','r','a','y'},
+    {'a','b','r','i','m'},
+    {'a','b','r','i','n'},
+    {'a','b','r','i','s'},
+    {'a','b','s','e','y'},
+    {'a','b','s','i','t'},
+    {'a','b','u','n','a'},
+    {'a','b','u','n','e'},
+    {'a','b','u','r','a'},
+    {'a','b','u','r','n'},
+    {'a','b','u','s','e'},
+    {'a','b','u','t','s'},
+    {'a','b','u','z','z'},
+    {'a','b','y','e','s'},
+    {'a','b','y','s','m'},
+    {'a','b','y','s','s'},
+    {'a','c','a','i','s'},
+    {'a','c','a','r','a'},
+    {'a','c','a','r','i'},
+    {'a','c','c','a','s'},
+    {'a','c','c','h','a'},
+    {'a','c','c','o','y'},
+    {'a','c','c','r','a'},
+    {'a','c','e','d','y'},
+    {'a','c','e','n','e'},
+    {'a','c','e','r','b'},
+    {'a','c','e','r','s'},
+    {'a','c','e','t','a'},
+    {'a','c','h','a','r'},
+    {'a','c','h','e','d'},
+    {'a','c','h','e','r'},
+    {'a','c','h','e','s'},
+    {'a','c','h','e','y'},
+    {'a','c','h','o','o'},
+    {'a','c','i','d','s'},
+    {'a','c','i','d','y'},
+    {'a','c','i','e','s'},
+    {'a','c','i','n','g'},
+    {'a','c','i','n','i'},
+    {'a','c','k','e','e'},
+    {'a','c','k','e','r'},
+    {'a','c','m','e','s'},
+    {'a','c','m','i','c'},
+    {'a','c','n','e','d'},
+    {'a','c','n','e','s'},
+    {'a','c','o','c','k'},
+    {'a','c','o','e','l'},
+    {'a','c','o','l','d'},
+    {'a','c','o','n','e'},
+    {'a','c','o','r','n'},
+    {'a','c','r','a','l'},
+    {'a','c','r','e','d'},
+    {'a','c','r','e','s'},
+    {'a','c','r','i','d'},
+    {'a','c','r','o','n'},
+    {'a','c','r','o','s'},
+    {'a','c','r','y','l'},
+    {'a','c','t','a','s'},
+    {'a','c','t','e','d'},
+    {'a','c','t','i','n'},
+    {'a','c','t','o','n'},
+    {'a','c','t','o','r'},
+    {'a','c','t','u','s'},
+    {'a','c','u','t','e'},
+    {'a','c','y','l','s'},
+    {'a','d','a','g','e'},
+    {'a','d','a','p','t'},
+    {'a','d','a','t','s'},
+    {'a','d','a','w','n'},
+    {'a','d','a','w','s'},
+    {'a','d','a','y','s'},
+    {'a','d','b','o','t'},
+    {'a','d','d','a','s'},
+    {'a','d','d','a','x'},
+    {'a','d','d','e','d'},
+    {'a','d','d','e','r'},
+    {'a','d','d','i','n'},
+    {'a','d','d','i','o'},
+    {'a','d','d','l','e'},
+    {'a','d','d','r','a'},
+    {'a','d','e','a','d'},
+    {'a','d','e','e','m'},
+    {'a','d','e','p','t'},
+    {'a','d','h','a','n'},
+    {'a','d','h','o','c'},
+    {'a','d','i','e','u'},
+    {'a','d','i','o','s'},
+    {'a','d','i','t','s'},
+    {'a','d','l','i','b'},
+    {'a','d','m','a','n'},
+    {'a','d','m','e','n'},
+    {'a','d','m','i','n'},
+    {'a','d','m','i','t'},
+    {'a','d','m','i','x'},
+    {'a','d','n','e','x'},
+    {'a','d','o','b','e'},
+    {'a','d','o','b','o'},
+    {'a','d','o','o','n'},
+    {'a','d','o','p','t'},
+    {'a','d','o','r','b'},
+    {'a','d','o','r','e'},
+    {'a','d','o','r','n'},
+    {'a','d','o','w','n'},
+    {'a','d','o','z','e'},
+    {'a','d','r','a','d'},
+    {'a','d','r','a','w'},
+    {'a','d','r','e','d'},
+    {'a','d','r','e','t'},
+    {'a','d','r','i','p'},
+    {'a','d','s','u','m'},
+    {'a','d','u','k','i'},
+    {'a','d','u','l','t'},
+    {'a','d','u','n','c'},
+    {'a','d','u','s','t'},
+    {'a','d','v','e','w'},
+    {'a','d','v','t','s'},
+    {'a','d','y','t','a'},
+    {'a','d','y','t','s'},
+    {'a','d','z','e','d'},
+    {'a','d','z','e','s'},
+    {'a','e','c','i','a'},
+    {'a','e','d','e','s'},
+    {'a','e','g','e','r'},
+    {'a','e','g','i','s'},
+    {'a','e','o','n','s'},
+    {'a','e','r','i','e'},
+    {'a','e','r','o','s'},
+    {'a','e','s','i','r'},
+    {'a','e','v','u','m'},
+    {'a','f','a','l','d'},
+    {'a','f','a','n','c'},
+    {'a','f','a','r','a'},
+    {'a','f','a','r','s'},
+    {'a','f','e','a','r'},
+    {'a','f','f','i','x'},
+    {'a','f','f','l','y'},
+    {'a','f','i','o','n'},
+    {'a','f','i','r','e'},
+    {'a','f','i','z','z'},
+    {'a','f','l','a','j'},
+    {'a','f','l','a','p'},
+    {'a','f','l','o','w'},
+    {'a','f','o','a','m'},
+    {'a','f','o','o','t'},
+    {'a','f','o','r','e'},
+    {'a','f','o','u','l'},
+    {'a','f','r','e','t'},
+    {'a','f','r','i','t'},
+    {'a','f','r','o','s'},
+    {'a','f','t','e','r'},
+    {'a','f','t','o','s'},
+    {'a','g','a','i','n'},
+    {'a','g','a','l','s'},
+    {'a','g','a','m','a'},
+    {'a','g','a','m','i'},
+    {'a','g','a','m','y'},
+    {'a','g','a','p','e'},
+    {'a','g','a','r','s'},
+    {'a','g','a','s','p'},
+    {'a','g','a','s','t'},
+    {'a','g','a','t','e'},
+    {'a','g','a','t','y'},
+    {'a','g','a','v','e'},
+    {'a','g','a','z','e'},
+    {'a','g','b','a','s'},
+    {'a','g','e','n','e'},
+    {'a','g','e','n','t'},
+    {'a','g','e','r','s'},
+    {'a','g','g','a','g'},
+    {'a','g','g','e','r'},
+    {'a','g','g','i','e'},
+    {'a','g','g','r','i'},
+    {'a','g','g','r','o'},
+    {'a','g','g','r','y'},
+    {'a','g','h','a','s'},
+    {'a','g','i','d','i'},
+    {'a','g','i','l','a'},
+    {'a','g','i','l','e'},
+    {'a','g','i','n','g'},
+    {'a','g','i','o','s'},
+    {'a','g','i','s','m'},
+    {'a','g','i','s','t'},
+    {'a','g','i','t','a'},
+    {'a','g','l','e','e'},
+    {'a','g','l','e','t'},
+    {'a','g','l','e','y'},
+    {'a','g','l','o','o'},
+    {'a','g','l','o','w'},
+    {'a','g','l','u','s'},
+    {'a','g','m','a','s'},
+    {'a','g','o','g','e'},
+    {'a','g','o','g','o'},
+    {'a','g','o','n','e'},
+    {'a','g','o','n','s'},
+    {'a','g','o','n','y'},
+    {'a','g','o','o','d'},
+    {'a','g','o','r','a'},
+    {'a','g','r','e','e'},
+    {'a','g','r','i','a'},
+    {'a','g','r','i','n'},
+    {'a','g','r','o','s'},
+    {'a','g','r','u','m'},
+    {'a','g','u','e','d'},
+    {'a','g','u','e','s'},
+    {'a','g','u','e','y'},
+    {'a','g','u','n','a'},
+    {'a','g','u','s','h'},
+    {'a','g','u','t','i'},
+    {'a','h','e','a','d'},
+    {'a','h','e','a','p'},
+    {'a','h','e','n','t'},
+    {'a','h','i','g','h'},
+    {'a','h','i','n','d'},
+    {'a','h','i','n','g'},
+    {'a','h','i','n','t'},
+    {'a','h','o','l','d'},
+    {'a','h','o','l','e'},
+    {'a','h','u','l','l'},
+    {'a','h','u','r','u'},
+    {'a','i','d','a','s'},
+    {'a','i','d','e','d'},
+    {'a','i','d','e','r'},
+    {'a','i','d','e','s'},
+    {'a','i','d','o','i'},
+    {'a','i','d','o','s'},
+    {'a','i','e','r','y'},
+    {'a','i','g','a','s'},
+    {'a','i','g','h','t'},
+    {'a','i','l','e','d'},
+    {'a','i','m','a','g'},
+    {'a','i','m','a','k'},
+    {'a','i','m','e','d'},
+    {'a','i','m','e','r'},
+    {'a','i','n','e','e'},
+    {'a','i','n','g','a'},
+    {'a','i','o','l','i'},
+    {'a','i','r','e','d'},
+    {'a','i','r','e','r'},
+    {'a','i','r','n','s'},
+    {'a','i','r','t','h'},
+    {'a','i','r','t','s'},
+    {'a','i','s','l','e'},
+    {'a','i','t','c','h'},
+    {'a','i','t','u','s'},
+    {'a','i','v','e','r'},
+    {'a','i','x','e','s'},
+    {'a','i','y','a','h'},
+    {'a','i','y','e','e'},
+    {'a','i','y','o','h'},
+    {'a','i','y','o','o'},
+    {'a','i','z','l','e'},
+    {'a','j','i','e','s'},
+    {'a','j','i','v','a'},
+    {'a','j','u','g','a'},
+    {'a','j','u','p','a'},
+    {'a','j','w','a','n'},
+    {'a','k','a','r','a'},
+    {'a','k','e','e','s'},
+    {'a','k','e','l','a'},
+    {'a','k','e','n','e'},
+    {'a','k','i','n','g'},
+    {'a','k','i','t','a'},
+    {'a','k','k','a','s'},
+    {'a','k','k','e','r'},
+    {'a','k','o','i','a'},
+    {'a','k','o','j','a'},
+    {'a','k','o','y','a'},
+    {'a','k','s','e','d'},
+    {'a','k','s','e','s'},
+    {'a','l','a','a','p'},
+    {'a','l','a','c','k'},
+    {'a','l','a','l','a'},
+    {'a','l','a','m','o'},
+    {'a','l','a','n','d'},
+    {'a','l','a','n','e'},
+    {'a','l','a','n','g'},
+    {'a','l','a','n','s'},
+    {'a','l','a','n','t'},
+    {'a','l','a','p','a'},
+    {'a','l','a','p','s'},
+    {'a','l','a','r','m'},
+    {'a','l','a','r','y'},
+    {'a','l','a','t','a'},
+    {'a','l','a','t','e'},
+    {'a','l','a','y','s'},
+    {'a','l','b','a','s'},
+    {'a','l','b','e','e'},
+    {'a','l','b','i','d'},
+    {'a','l','b','u','m'},
+    {'a','l','c','e','a'},
+    {'a','l','c','e','s'},
+    {'a','l','c','i','d'},
+    {'a','l','c','o','s'},
+    {'a','l','d','e','a'},
+    {'a','l','d','e','r'},
+    {'a','l','d','o','l'},
+    {'a','l','e','a','k'},
+    {'a','l','e','c','k'},
+    {'a','l','e','c','s'},
+    {'a','l','e','e','m'},
+    {'a','l','e','f','s'},
+    {'a','l','e','f','t'},
+    {'a','l','e','p','h'},
+    {'a','l','e','r','t'},
+    {'a','l','e','w','s'},
+    {'a','l','e','y','e'},
+    {'a','l','f','a','s'},
+    {'a','l','g','a','e'},
+    {'a','l','g','a','l'},
+    {'a','l','g','a','s'},
+    {'a','l','g','i','d'},
+    {'a','l','g','i','n'},
+    {'a','l','g','o','r'},
+    {'a','l','g','o','s'},
+    {'a','l','g','u','m'},
+    {'a','l','i','a','s'},
+    {'a','l','i','b','i'},
+    {'a','l','i','c','k'},
+    {'a','l','i','e','n'},
+    {'a','l','i','f','s'},
+    {'a','l','i','g','n'},
+    {'a','l','i','k','e'},
+    {'a','l','i','m','s'},
+    {'a','l','i','n','e'},
+    {'a','l','i','o','s'},
+    {'a','l','i','s','t'},
+    {'a','l','i','v','e'},
+    {'a','l','i','y','a'},
+    {'a','l','k','i','e'},
+    {'a','l','k','i','n'},
+    {'a','l','k','o','s'},
+    {'a','l','k','y','d'},
+    {'a','l','k','y','l'},
+    {'a','l','l','a','n'},
+    {'a','l','l','a','y'},
+    {'a','l','l','e','e'},
+    {'a','l','l','e','l'},
+    {'a','l','l','e','n'},
+    {'a','l','l','e','r'},
+    {'a','l','l','e','y'},
+    {'a','l','l','i','n'},
+    {'a','l','l','i','s'},
+    {'a','l','l','o','d'},
+    {'a','l','l','o','t'},
+    {'a','l','l','o','w'},
+    {'a','l','l','o','y'},
+    {'a','l','l','u','s'},
+    {'a','l','l','y','l'},
+    {'a','l','m','a','h'},
+    {'a','l','m','a','s'},
+    {'a','l','m','e','h'},
+    {'a','l','m','e','s'},
+    {'a','l','m','u','d'},
+    {'a','l','m','u','g'},
+    {'a','l','o','d','s'},
+    {'a','l','o','e','d'},
+    {'a','l','o','e','s'},
+    {'a','l','o','f','t'},
+    {'a','l','o','h','a'},
+    {'a','l','o','i','n'},
+    {'a','l','o','n','e'},
+    {'a','l','o','n','g'},
+    {'a','l','o','o','f'},
+    {'a','l','o','o','s'},
+    {'a','l','o','s','e'},
+    {'a','l','o','u','d'},
+    {'a','l','o','w','e'},
+    {'a','l','p','h','a'},
+    {'a','l','t','a','r'},
+    {'a','l','t','e','r'},
+    {'a','l','t','h','o'},
+    {'a','l','t','o','s'},
+    {'a','l','u','l','a'},
+    {'a','l','u','m','s'},
+    {'a','l','u','m','y'},
+    {'a','l','u','r','e'},
+    {'a','l','u','r','k'},
+    {'a','l','v','a','r'},
+    {'a','l','w','a','y'},
+    {'a','m','a','h','s'},
+    {'a','m','a','i','n'},
+    {'a','m','a','r','i'},
+    {'a','m','a','r','o'},
+    {'a','m','a','s','s'},
+    {'a','m','a','t','e'},
+    {'a','m','a','u','t'},
+    {'a','m','a','z','e'},
+    {'a','m','b','a','n'},
+    {'a','m','b','e','r'},
+    {'a','m','b','i','t'},
+    {'a','m','b','l','e'},
+    {'a','m','b','o','s'},
+    {'a','m','b','r','y'},
+    {'a','m','e','b','a'},
+    {'a','m','e','e','r'},
+    {'a','m','e','n','d'},
+    {'a','m','e','n','e'},
+    {'a','m','e','n','s'},
+    {'a','m','e','n','t'},
+    {'a','m','i','a','s'},
+    {'a','m','i','c','e'},
+    {'a','m','i','c','i'},
+    {'a','m','i','d','e'},
+    {'a','m','i','d','o'},
+    {'a','m','i','d','s'},
+    {'a','m','i','e','s'},
+    {'a','m','i','g','a'},
+    {'a','m','i','g','o'},
+    {'a','m','i','n','e'},
+    {'a','m','i','n','o'},
+    {'a','m','i','n','s'},
+    {'a','m','i','r','s'},
+    {'a','m','i','s','s'},
+    {'a','m','i','t','y'},
+    {'a','m','l','a','s'},
+    {'a','m','m','a','n'},
+    {'a','m','m','a','s'},
+    {'a','m','m','o','n'},
+    {'a','m','m','o','s'},
+    {'a','m','n','i','a'},
+    {'a','m','n','i','c'},
+    {'a','m','n','i','o'},
+    {'a','m','o','k','s'},
+    {'a','m','o','l','e'},
+    {'a','m','o','n','g'},
+    {'a','m','o','r','e'},
+    {'a','m','o','r','t'},
+    {'a','m','o','u','r'},
+    {'a','m','o','v','e'},
+    {'a','m','o','w','t'},
+    {'a','m','p','e','d'},
+    {'a','m','p','l','e'},
+    {'a','m','p','l','y'},
+    {'a','m','p','u','l'},
+    {'a','m','r','i','t'},
+    {'a','m','u','c','k'},
+    {'a','m','u','s','e'},
+    {'a','m','y','l','s'},
+    {'a','n','a','n','a'},
+    {'a','n','a','t','a'},
+    {'a','n','c','h','o'},
+    {'a','n','c','l','e'},
+    {'a','n','c','o','n'},
+    {'a','n','d','i','c'},
+    {'a','n','d','r','o'},
+    {'a','n','e','a','r'},
+    {'a','n','e','l','e'},
+    {'a','n','e','n','t'},
+    {'a','n','g','a','s'},
+    {'a','n','g','e','l'},
+    {'a','n','g','e','r'},
+    {'a','n','g','l','e'},
+    {'a','n','g','l','o'},
+    {'a','n','g','r','y'},
+    {'a','n','g','s','t'},
+    {'a','n','i','g','h'},
+    {'a','n','i','l','e'},
+    {'a','n','i','l','s'},
+    {'a','n','i','m','a'},
+    {'a','n','i','m','e'},
+    {'a','n','i','m','i'},
+    {'a','n','i','o','n'},
+    {'a','n','i','s','e'},
+    {'a','n','k','e','r'},
+    {'a','n','k','h','s'},
+    {'a','n','k','l','e'},
+    {'a','n','k','u','s'},
+    {'a','n','l','a','s'},
+    {'a','n','n','a','l'},
+    {'a','n','n','a','n'},
+    {'a','n','n','a','s'},
+    {'a','n','n','a','t'},
+    {'a','n','n','e','x'},
+    {'a','n','n','o','y'},
+    {'a','n','n','u','l'},
+    {'a','n','n','u','m'},
+    {'a','n','n','u','s'},
+    {'a','n','o','a','s'},
+    {'a','n','o','d','e'},
+    {'a','n','o','l','e'},
+    {'a','n','o','m','y'},
+    {'a','n','s','a','e'},
+    {'a','n','s','a','s'},
+    {'a','n','t','a','e'},
+    {'a','n','t','a','r'},
+    {'a','n','t','a','s'},
+    {'a','n','t','e','d'},
+    {'a','n','t','e','s'},
+    {'a','n','t','i','c'},
+    {'a','n','t','i','s'},
+    {'a','n','t','r','a'},
+    {'a','n','t','r','e'},
+    {'a','n','t','s','y'},
+    {'a','n','u','r','a'},
+    {'a','n','v','i','l'},
+    {'a','n','y','o','n'},
+    {'a','o','r','t','a'},
+    {'a','p','a','c','e'},
+    {'a','p','a','g','e'},
+    {'a','p','a','i','d'},
+    {'a','p','a','r','t'},
+    {'a','p','a','y','d'},
+    {'a','p','a','y','s'},
+    {'a','p','e','a','k'},
+    {'a','p','e','e','k'},
+    {'a','p','e','r','s'},
+    {'a','p','e','r','t'},
+    {'a','p','e','r','y'},
+    {'a','p','g','a','r'},
+    {'a','p','h','i','d'},
+    {'a','p','h','i','s'},
+    {'a','p','i','a','n'},
+    {'a','p','i','n','g'},
+    {'a','p','i','o','l'},
+    {'a','p','i','s','h'},
+    {'a','p','i','s','m'},
+    {'a','p','n','e','a'},
+    {'a','p','o','d','e'},
+    {'a','p','o','d','s'},
+    {'a','p','o','l','s'},
+    {'a','p','o','o','p'},
+    {'a','p','o','r','t'},
+    {'a','p','p','a','l'},
+    {'a','p','p','a','m'},
+    {'a','p','p','a','y'},
+    {'a','p','p','e','l'},
+    {'a','p','p','l','e'},
+    {'a','p','p','l','y'},
+    {'a','p','p','r','o'},
+    {'a','p','p','t','s'},
+    {'a','p','p','u','i'},
+    {'a','p','p','u','y'},
+    {'a','p','r','e','s'},
+    {'a','p','r','o','n'},
+    {'a','p','s','e','s'},
+    {'a','p','s','i','s'},
+    {'a','p','s','o','s'},
+    {'a','p','t','e','d'},
+    {'a','p','t','e','r'},
+    {'a','p','t','l','y'},
+    {'a','q','u','a','e'},
+    {'a','q','u','a','s'},
+    {'a','r','a','b','a'},
+    {'a','r','a','k','s'},
+    {'a','r','a','m','e'},
+    {'a','r','a','r','s'},
+    {'a','r','b','a','h'},
+    {'a','r','b','a','s'},
+    {'a','r','b','o','r'},
+    {'a','r','c','e','d'},
+    {'a','r','c','h','i'},
+    {'a','r','c','o','s'},
+    {'a','r','c','u','s'},
+    {'a','r','d','e','b'},
+    {'a','r','d','o','r'},
+    {'a','r','d','r','i'},
+    {'a','r','e','a','d'},
+    {'a','r','e','a','e'},
+    {'a','r','e','a','l'},
+    {'a','r','e','a','r'},
+    {'a','r','e','a','s'},
+    {'a','r','e','c','a'},
+    {'a','r','e','d','d'},
+    {'a','r','e','d','e'},
+    {'a','r','e','f','y'},
+    {'a','r','e','i','c'},
+    {'a','r','e','n','a'},
+    {'a','r','e','n','e'},
+    {'a','r','e','p','a'},
+    {'a','r','e','r','e'},
+    {'a','r','e','t','e'},
+    {'a','r','e','t','s'},
+    {'a','r','e','t','t'},
+    {'a','r','g','a','l'},
+    {'a','r','g','a','n'},
+    {'a','r','g','i','l'},
+    {'a','r','g','l','e'},
+    {'a','r','g','o','l'},
+    {'a','r','g','o','n'},
+    {'a','r','g','o','t'},
+    {'a','r','g','u','e'},
+    {'a','r','g','u','s'},
+    {'a','r','h','a','t'},
+    {'a','r','i','a','s'},
+    {'a','r','i','e','l'},
+    {'a','r','i','k','i'},
+    {'a','r','i','l','s'},
+    {'a','r','i','o','t'},
+    {'a','r','i','s','e'},
+    {'a','r','i','s','h'},
+    {'a','r','i','t','h'},
+    {'a','r','k','e','d'},
+    {'a','r','l','e','d'},
+    {'a','r','l','e','s'},
+    {'a','r','m','e','d'},
+    {'a','r','m','e','r'},
+    {'a','r','m','e','t'},
+    {'a','r','m','i','l'},
+    {'a','r','m','o','r'},
+    {'a','r','n','a','s'},
+    {'a','r','n','i','s'},
+    {'a','r','n','u','t'},
+    {'a','r','o','b','a'},
+    {'a','r','o','h','a'},
+    {'a','r','o','i','d'},
+    {'a','r','o','m','a'},
+    {'a','r','o','s','e'},
+    {'a','r','p','a','s'},
+    {'a','r','p','e','n'},
+    {'a','r','r','a','h'},
+    {'a','r','r','a','s'},
+    {'a','r','r','a','y'},
+    {'a','r','r','e','t'},
+    {'a','r','r','i','s'},
+    {'a','r','r','o','w'},
+    {'a','r','r','o','z'},
+    {'a','r','s','e','d'},
+    {'a','r','s','e','s'},
+    {'a','r','s','e','y'},
+    {'a','r','s','i','s'},
+    {'a','r','s','o','n'},
+    {'a','r','t','a','l'},
+    {'a','r','t','e','l'},
+    {'a','r','t','e','r'},
+    {'a','r','t','i','c'},
+    {'a','r','t','i','s'},
+    {'a','r','t','l','y'},
+    {'a','r','t','s','y'},
+    {'a','r','u','h','e'},
+    {'a','r','u','m','s'},
+    {'a','r','v','a','l'},
+    {'a','r','v','e','e'},
+    {'a','r','v','o','s'},
+    {'a','r','y','l','s'},
+    {'a','s','a','d','a'},
+    {'a','s','a','n','a'},
+    {'a','s','c','o','n'},
+    {'a','s','c','o','t'},
+    {'a','s','c','u','s'},
+    {'a','s','d','i','c'},
+    {'a','s','h','e','d'},
+    {'a','s','h','e','n'},
+    {'a','s','h','e','s'},
+    {'a','s','h','e','t'},
+    {'a','s','i','d','e'},
+    {'a','s','i','t','y'},
+    {'a','s','k','a','r'},
+    {'a','s','k','e','d'},
+    {'a','s','k','e','r'},
+    {'a','s','k','e','w'},
+    {'a','s','k','o','i'},
+    {'a','s','k','o','s'},
+    {'a','s','p','e','n'},
+    {'a','s','p','e','r'},
+    {'a','s','p','i','c'},
+    {'a','s','p','i','e'},
+    {'a','s','p','i','s'},
+    {'a','s','p','r','o'},
+    {'a','s','s','a','i'},
+    {'a','s','s','a','m'},
+    {'a','s','s','a','y'},
+    {'a','s','s','e','d'},
+    {'a','s','s','e','s'},
+    {'a','s','s','e','t'},
+    {'a','s','s','e','z'},
+    {'a','s','s','o','t'},
+    {'a','s','t','e','r'},
+    {'a','s','t','i','r'},
+    {'a','s','t','u','n'},
+    {'a','s','u','r','a'},
+    {'a','s','w','a','y'},
+    {'a','s','w','i','m'},
+    {'a','s','y','l','a'},
+    {'a','t','a','p','s'},
+    {'a','t','a','x','y'},
+    {'a','t','i','g','i'},
+    {'a','t','i','l','t'},
+    {'a','t','i','m','y'},
+    {'a','t','l','a','s'},
+    {'a','t','m','a','n'},
+    {'a','t','m','a','s'},
+    {'a','t','m','o','s'},
+    {'a','t','o','c','s'},
+    {'a','t','o','k','e'},
+    {'a','t','o','k','s'},
+    {'a','t','o','l','l'},
+    {'a','t','o','m','s'},
+    {'a','t','o','m','y'},
+    {'a','t','o','n','e'},
+    {'a','t','o','n','y'},
+    {'a','t','o','p','y'},
+    {'a','t','r','i','a'},
+    {'a','t','r','i','p'},
+    {'a','t','t','a','p'},
+    {'a','t','t','a','r'},
+    {'a','t','t','a','s'},
+    {'a','t','t','e','r'},
+    {'a','t','t','i','c'},
+    {'a','t','u','a','s'},
+    {'a','u','c','h','t'},
+    {'a','u','d','a','d'},
+    {'a','u','d','a','x'},
+    {'a','u','d','i','o'},
+    {'a','u','d','i','t'},
+    {'a','u','g','e','n'},
+    {'a','u','g','e','r'},
+    {'a','u','g','e','s'},
+    {'a','u','g','h','t'},
+    {'a','u','g','u','r'},
+    {'a','u','l','a','s'},
+    {'a','u','l','i','c'},
+    {'a','u','l','o','i'},
+    {'a','u','l','o','s'},
+    {'a','u','m','i','l'},
+    {'a','u','n','e','s'},
+    {'a','u','n','t','s'},
+    {'a','u','n','t','y'},
+    {'a','u','r','a','e'},
+    {'a','u','r','a','l'},
+    {'a','u','r','a','r'},
+    {'a','u','r','a','s'},
+    {'a','u','r','e','i'},
+    {'a','u','r','e','s'},
+    {'a','u','r','i','c'},
+    {'a','u','r','i','s'},
+    {'a','u','r','u','m'},
+    {'a','u','t','o','s'},
+    {'a','u','x','i','n'},
+    {'a','v','a','i','l'},
+    {'a','v','a','l','e'},
+    {'a','v','a','n','t'},
+    {'a','v','a','s','t'},
+    {'a','v','e','l','s'},
+    {'a','v','e','n','s'},
+    {'a','v','e','r','s'},
+    {'a','v','e','r','t'},
+    {'a','v','g','a','s'},
+    {'a','v','i','a','n'},
+    {'a','v','i','n','e'},
+    {'a','v','i','o','n'},
+    {'a','v','i','s','e'},
+    {'a','v','i','s','o'},
+    {'a','v','i','z','e'},
+    {'a','v','o','i','d'},
+    {'a','v','o','w','s'},
+    {'a','v','y','z','e'},
+    {'a','w','a','i','t'},
+    {'a','w','a','k','e'},
+    {'a','w','a','r','d'},
+    {'a','w','a','r','e'},
+    {'a','w','a','r','i'},
+    {'a','w','a','r','n'},
+    {'a','w','a','s','h'},
+    {'a','w','a','t','o'},
+    {'a','w','a','v','e'},
+    {'a','w','a','y','s'},
+    {'a','w','d','l','s'},
+    {'a','w','e','e','l'},
+    {'a','w','e','t','o'},
+    {'a','w','f','u','l'},
+    {'a','w','i','n','g'},
+    {'a','w','k','i','n'},
+    {'a','w','m','r','y'},
+    {'a','w','n','e','d'},
+    {'a','w','n','e','r'},
+    {'a','w','o','k','e'},
+    {'a','w','o','l','s'},
+    {'a','w','o','r','k'},
+    {'a','x','e','l','s'},
+    {'a','x','i','a','l'},
+    {'a','x','i','l','e'},
+    {'a','x','i','l','s'},
+    {'a','x','i','n','g'},
+    {'a','x','i','o','m'},
+    {'a','x','i','o','n'},
+    {'a','x','i','t','e'},
+    {'a','x','l','e','d'},
+    {'a','x','l','e','s'},
+    {'a','x','m','a','n'},
+    {'a','x','m','e','n'},
+    {'a','x','o','i','d'},
+    {'a','x','o','n','e'},
+    {'a','x','o','n','s'},
+    {'a','y','a','h','s'},
+    {'a','y','a','y','a'},
+    {'a','y','e','l','p'},
+    {'a','y','g','r','e'},
+    {'a','y','i','n','s'},
+    {'a','y','m','a','g'},
+    {'a','y','o','n','t'},
+    {'a','y','r','e','s'},
+    {'a','y','r','i','e'},
+    {'a','z','a','n','s'},
+    {'a','z','i','d','e'},
+    {'a','z','i','d','o'},
+    {'a','z','i','n','e'},
+    {'a','z','l','o','n'},
+    {'a','z','o','i','c'},
+    {'a','z','o','l','e'},
+    {'a','z','o','n','s'},
+    {'a','z','o','t','e'},
+    {'a','z','o','t','h'},
+    {'a','z','u','k','i'},
+    {'a','z','u','r','e'},
+    {'a','z','u','r','n'},
+    {'a','z','u','r','y'},
+    {'a','z','y','g','y'},
+    {'a','z','y','m','e'},
+    {'a','z','y','m','s'},
+    {'b','a','a','e','d'},
+    {'b','a','a','l','s'},
+    {'b','a','a','p','s'},
+    {'b','a','b','a','s'},
+    {'b','a','b','b','y'},
+    {'b','a','b','e','l'},
+    {'b','a','b','e','s'},
+    {'b','a','b','k','a'},
+    {'b','a','b','o','o'},
+    {'b','a','b','u','l'},
+    {'b','a','b','u','s'},
+    {'b','a','c','c','a'},
+    {'b','a','c','c','o'},
+    {'b','a','c','c','y'},
+    {'b','a','c','h','a'},
+    {'b','a','c','h','s'},
+    {'b','a','c','k','s'},
+    {'b','a','c','k','y'},
+    {'b','a','c','n','e'},
+    {'b','a','c','o','n'},
+    {'b','a','d','a','m'},
+    {'b','a','d','d','y'},
+    {'b','a','d','g','e'},
+    {'b','a','d','l','y'},
+    {'b','a','e','l','s'},
+    {'b','a','f','f','s'},
+    {'b','a','f','f','y'},
+    {'b','a','f','t','a'},
+    {'b','a','f','t','s'},
+    {'b','a','g','e','l'},
+    {'b','a','g','g','y'},
+    {'b','a','g','h','s'},
+    {'b','a','g','i','e'},
+    {'b','a','g','s','y'},
+    {'b','a','g','u','a'},
+    {'b','a','h','t','s'},
+    {'b','a','h','u','s'},
+    {'b','a','h','u','t'},
+    {'b','a','i','k','s'},
+    {'b','a','i','l','e'},
+    {'b','a','i','l','s'},
+    {'b','a','i','r','n'},
+    {'b','a','i','s','a'},
+    {'b','a','i','t','h'},
+    {'b','a','i','t','s'},
+    {'b','a','i','z','a'},
+    {'b','a','i','z','e'},
+    {'b','a','j','a','n'},
+    {'b','a','j','r','a'},
+    {'b','a','j','r','i'},
+    {'b','a','j','u','s'},
+    {'b','a','k','e','d'},
+    {'b','a','k','e','n'},
+    {'b','a','k','e','r'},
+    {'b','a','k','e','s'},
+    {'b','a','k','r','a'},
+    {'b','a','l','a','s'},
+    {'b','a','l','d','s'},
+    {'b','a','l','d','y'},
+    {'b','a','l','e','d'},
+    {'b','a','l','e','r'},
+    {'b','a','l','e','s'},
+    {'b','a','l','k','s'},
+    {'b','a','l','k','y'},
+    {'b','a','l','l','o'},
+    {'b','a','l','l','s'},
+    {'b','a','l','l','y'},
+    {'b','a','l','m','s'},
+    {'b','a','l','m','y'},
+    {'b','a','l','o','i'},
+    {'b','a','l','o','n'},
+    {'b','a','l','o','o'},
+    {'b','a','l','o','t'},
+    {'b','a','l','s','a'},
+    {'b','a','l','t','i'},
+    {'b','a','l','u','n'},
+    {'b','a','l','u','s'},
+    {'b','a','l','u','t'},
+    {'b','a','m','a','s'},
+    {'b','a','m','b','i'},
+    {'b','a','m','m','a'},
+    {'b','a','m','m','y'},
+    {'b','a','n','a','k'},
+    {'b','a','n','a','l'},
+    {'b','a','n','c','o'},
+    {'b','a','n','c','s'},
+    {'b','a','n','d','a'},
+    {'b','a','n','d','h'},
+    {'b','a','n','d','s'},
+    {'b','a','n','d','y'},
+    {'b','a','n','e','d'},
+    {'b','a','n','e','s'},
+    {'b','a','n','g','s'},
+    {'b','a','n','i','a'},
+    {'b','a','n','j','o'},
+    {'b','a','n','k','s'},
+    {'b','a','n','k','y'},
+    {'b','a','n','n','s'},
+    {'b','a','n','t','s'},
+    {'b','a','n','t','u'},
+    {'b','a','n','t','y'},
+    {'b','a','n','t','z'},
+    {'b','a','n','y','a'},
+    {'b','a','o','n','s'},
+    {'b','a','o','z','i'},
+    {'b','a','p','p','u'},
+    {'b','a','p','u','s'},
+    {'b','a','r','b','e'},
+    {'b','a','r','b','s'},
+    {'b','a','r','b','y'},
+    {'b','a','r','c','a'},
+    {'b','a','r','d','e'},
+    {'b','a','r','d','o'},
+    {'b','a','r','d','s'},
+    {'b','a','r','d','y'},
+    {'b','a','r','e','d'},
+    {'b','a','r','e','r'},
+    {'b','a','r','e','s'},
+    {'b','a','r','f','i'},
+    {'b','a','r','f','s'},
+    {'b','a','r','f','y'},
+    {'b','a','r','g','e'},
+    {'b','a','r','i','c'},
+    {'b','a','r','k','s'},
+    {'b','a','r','k','y'},
+    {'b','a','r','m','s'},
+    {'b','a','r','m','y'},
+    {'b','a','r','n','s'},
+    {'b','a','r','n','y'},
+    {'b','a','r','o','n'},
+    {'b','a','r','p','s'},
+    {'b','a','r','r','a'},
+    {'b','a','r','r','e'},
+    {'b','a','r','r','o'},
+    {'b','a','r','r','y'},
+    {'b','a','r','y','e'},
+    {'b','a','s','a','l'},
+    {'b','a','s','a','n'},
+    {'b','a','s','a','s'},
+    {'b','a','s','e','d'},
+    {'b','a','s','e','n'},
+    {'b','a','s','e','r'},
+    {'b','a','s','e','s'},
+    {'b','a','s','h','a'},
+    {'b','a','s','h','o'},
+    {'b','a','s','i','c'},
+    {'b','a','s','i','j'},
+    {'b','a','s','i','l'},
+    {'b','a','s','i','n'},
+    {'b','a','s','i','s'},
+    {'b','a','s','k','s'},
+    {'b','a','s','o','n'},
+    {'b','a','s','s','e'},
+    {'b','a','s','s','i'},
+    {'b','a','s','s','o'},
+    {'b','a','s','s','y'},
+    {'b','a','s','t','a'},
+    {'b','a','s','t','e'},
+    {'b','a','s','t','i'},
+    {'b','a','s','t','o'},
+    {'b','a','s','t','s'},
+    {'b','a','t','c','h'},
+    {'b','a','t','e','d'},
+    {'b','a','t','e','s'},
+    {'b','a','t','h','e'},
+    {'b','a','t','h','s'},
+    {'b','a','t','i','k'},
+    {'b','a','t','o','n'},
+    {'b','a','t','o','s'},
+    {'b','a','t','t','a'},
+    {'b','a','t','t','s'},
+    {'b','a','t','t','u'},
+    {'b','a','t','t','y'},
+    {'b','a','u','d','s'},
+    {'b','a','u','k','s'},
+    {'b','a','u','l','k'},
+    {'b','a','u','r','s'},
+    {'b','a','v','i','n'},
+    {'b','a','w','d','s'},
+    {'b','a','w','d','y'},
+    {'b','a','w','k','s'},
+    {'b','a','w','l','s'},
+    {'b','a','w','n','s'},
+    {'b','a','w','r','s'},
+    {'b','a','w','t','y'},
+    {'b','a','y','a','s'},
+    {'b','a','y','e','d'},
+    {'b','a','y','e','r'},
+    {'b','a','y','e','s'},
+    {'b','a','y','l','e'},
+    {'b','a','y','o','u'},
+    {'b','a','y','t','s'},
+    {'b','a','z','a','r'},
+    {'b','a','z','a','s'},
+    {'b','a','z','o','o'},
+    {'b','b','a','l','l'},
+    {'b','d','a','y','s'},
+    {'b','e','a','c','h'},
+    {'b','e','a','d','s'},
+    {'b','e','a','d','y'},
+    {'b','e','a','k','s'},
+    {'b','e','a','k','y'},
+    {'b','e','a','l','s'},
+    {'b','e','a','m','s'},
+    {'b','e','a','m','y'},
+    {'b','e','a','n','o'},
+    {'b','e','a','n','s'},
+    {'b','e','a','n','y'},
+    {'b','e','a','r','d'},
+    {'b','e','a','r','e'},
+    {'b','e','a','r','s'},
+    {'b','e','a','s','t'},
+    {'b','e','a','t','h'},
+    {'b','e','a','t','s'},
+    {'b','e','a','t','y'},
+    {'b','e','a','u','s'},
+    {'b','e','a','u','t'},
+    {'b','e','a','u','x'},
+    {'b','e','b','o','p'},
+    {'b','e','c','a','p'},
+    {'b','e','c','k','e'},
+    {'b','e','c','k','s'},
+    {'b','e','d','a','d'},
+    {'b','e','d','e','l'},
+    {'b','e','d','e','s'},
+    {'b','e','d','e','w'},
+    {'b','e','d','i','m'},
+    {'b','e','d','y','e'},
+    {'b','e','e','c','h'},
+    {'b','e','e','d','i'},
+    {'b','e','e','f','s'},
+    {'b','e','e','f','y'},
+    {'b','e','e','p','s'},
+    {'b','e','e','r','s'},
+    {'b','e','e','r','y'},
+    {'b','e','e','t','s'},
+    {'b','e','f','i','t'},
+    {'b','e','f','o','g'},
+    {'b','e','g','a','d'},
+    {'b','e','g','a','n'},
+    {'b','e','g','a','r'},
+    {'b','e','g','a','t'},
+    {'b','e','g','e','m'},
+    {'b','e','g','e','t'},
+    {'b','e','g','i','n'},
+    {'b','e','g','o','b'},
+    {'b','e','g','o','t'},
+    {'b','e','g','u','m'},
+    {'b','e','g','u','n'},
+    {'b','e','i','g','e'},
+    {'b','e','i','g','y'},
+    {'b','e','i','n','g'},
+    {'b','e','i','n','s'},
+    {'b','e','i','r','a'},
+    {'b','e','i','s','a'},
+    {'b','e','k','a','h'},
+    {'b','e','l','a','h'},
+    {'b','e','l','a','r'},
+    {'b','e','l','a','y'},
+    {'b','e','l','c','h'},
+    {'b','e','l','e','e'},
+    {'b','e','l','g','a'},
+    {'b','e','l','i','e'},
+    {'b','e','l','i','t'},
+    {'b','e','l','l','e'},
+    {'b','e','l','l','i'},
+    {'b','e','l','l','o'},
+    {'b','e','l','l','s'},
+    {'b','e','l','l','y'},
+    {'b','e','l','o','n'},
+    {'b','e','l','o','w'},
+    {'b','e','l','t','s'},
+    {'b','e','l','v','e'},
+    {'b','e','m','a','d'},
+    {'b','e','m','a','s'},
+    {'b','e','m','i','x'},
+    {'b','e','m','u','d'},
+    {'b','e','n','c','h'},
+    {'b','e','n','d','s'},
+    {'b','e','n','d','y'},
+    {'b','e','n','e','s'},
+    {'b','e','n','e','t'},
+    {'b','e','n','g','a'},
+    {'b','e','n','i','s'},
+    {'b','e','n','j','i'},
+    {'b','e','n','n','e'},
+    {'b','e','n','n','i'},
+    {'b','e','n','n','y'},
+    {'b','e','n','t','o'},
+    {'b','e','n','t','s'},
+    {'b','e','n','t','y'},
+    {'b','e','p','a','t'},
+    {'b','e','r','a','y'},
+    {'b','e','r','e','s'},
+    {'b','e','r','e','t'},
+    {'b','e','r','g','s'},
+    {'b','e','r','k','o'},
+    {'b','e','r','k','s'},
+    {'b','e','r','m','e'},
+    {'b','e','r','m','s'},
+    {'b','e','r','o','b'},
+    {'b','e','r','r','y'},
+    {'b','e','r','t','h'},
+    {'b','e','r','y','l'},
+    {'b','e','s','a','t'},
+    {'b','e','s','a','w'},
+    {'b','e','s','e','e'},
+    {'b','e','s','e','s'},
+    {'b','e','s','e','t'},
+    {'b','e','s','i','t'},
+    {'b','e','s','o','m'},
+    {'b','e','s','o','t'},
+    {'b','e','s','t','i'},
+    {'b','e','s','t','s'},
+    {'b','e','t','a','s'},
+    {'b','e','t','e','d'},
+    {'b','e','t','e','l'},
+    {'b','e','t','e','s'},
+    {'b','e','t','h','s'},
+    {'b','e','t','i','d'},
+    {'b','e','t','o','n'},
+    {'b','e','t','t','a'},
+    {'b','e','t','t','y'},
+    {'b','e','v','a','n'},
+    {'b','e','v','e','l'},
+    {'b','e','v','e','r'},
+    {'b','e','v','o','r'},
+    {'b','e','v','u','e'},
+    {'b','e','v','v','y'},
+    {'b','e','w','d','y'},
+    {'b','e','w','e','t'},
+    {'b','e','w','i','g'},
+    {'b','e','z','e','l'},
+    {'b','e','z','e','s'},
+    {'b','e','z','i','l'},
+    {'b','e','z','z','y'},
+    {'b','h','a','i','s'},
+    {'b','h','a','j','i'},
+    {'b','h','a','n','g'},
+    {'b','h','a','t','s'},
+    {'b','h','a','v','a'},
+    {'b','h','e','l','s'},
+    {'b','h','o','o','t'},
+    {'b','h','u','n','a'},
+    {'b','h','u','t','s'},
+    {'b','i','a','c','h'},
+    {'b','i','a','l','i'},
+    {'b','i','a','l','y'},
+    {'b','i','b','b','s'},
+    {'b','i','b','e','s'},
+    {'b','i','b','i','s'},
+    {'b','i','b','l','e'},
+    {'b','i','c','c','y'},
+    {'b','i','c','e','p'},
+    {'b','i','c','e','s'},
+    {'b','i','c','k','y'},
+    {'b','i','d','d','y'},
+    {'b','i','d','e','d'},
+    {'b','i','d','e','r'},
+    {'b','i','d','e','s'},
+    {'b','i','d','e','t'},
+    {'b','i','d','i','s'},
+    {'b','i','d','o','n'},
+    {'b','i','d','r','i'},
+    {'b','i','e','l','d'},
+    {'b','i','e','r','s'},
+    {'b','i','f','f','o'},
+    {'b','i','f','f','s'},
+    {'b','i','f','f','y'},
+    {'b','i','f','i','d'},
+    {'b','i','g','a','e'},
+    {'b','i','g','g','s'},
+    {'b','i','g','g','y'},
+    {'b','i','g','h','a'},
+    {'b','i','g','h','t'},
+    {'b','i','g','l','y'},
+    {'b','i','g','o','s'},
+    {'b','i','g','o','t'},
+    {'b','i','h','o','n'},
+    {'b','i','j','o','u'},
+    {'b','i','k','e','d'},
+    {'b','i','k','e','r'},
+    {'b','i','k','e','s'},
+    {'b','i','k','i','e'},
+    {'b','i','k','k','y'},
+    {'b','i','l','a','l'},
+    {'b','i','l','a','t'},
+    {'b','i','l','b','o'},
+    {'b','i','l','b','y'},
+    {'b','i','l','e','d'},
+    {'b','i','l','e','s'},
+    {'b','i','l','g','e'},
+    {'b','i','l','g','y'},
+    {'b','i','l','k','s'},
+    {'b','i','l','l','s'},
+    {'b','i','l','l','y'},
+    {'b','i','m','a','h'},
+    {'b','i','m','a','s'},
+    {'b','i','m','b','o'},
+    {'b','i','n','a','l'},
+    {'b','i','n','d','i'},
+    {'b','i','n','d','s'},
+    {'b','i','n','e','r'},
+    {'b','i','n','e','s'},
+    {'b','i','n','g','e'},
+    {'b','i','n','g','o'},
+    {'b','i','n','g','s'},
+    {'b','i','n','g','y'},
+    {'b','i','n','i','t'},
+    {'b','i','n','k','s'},
+    {'b','i','n','k','y'},
+    {'b','i','n','t','s'},
+    {'b','i','o','g','s'},
+    {'b','i','o','m','e'},
+    {'b','i','o','n','s'},
+    {'b','i','o','n','t'},
+    {'b','i','o','s','e'},
+    {'b','i','o','t','a'},
+    {'b','i','p','e','d'},
+    {'b','i','p','o','d'},
+    {'b','i','p','p','y'},
+    {'b','i','r','c','h'},
+    {'b','i','r','d','o'},
+    {'b','i','r','d','s'},
+    {'b','i','r','i','s'},
+    {'b','i','r','k','s'},
+    {'b','i','r','l','e'},
+    {'b','i','r','l','s'},
+    {'b','i','r','o','s'},
+    {'b','i','r','r','s'},
+    {'b','i','r','s','e'},
+    {'b','i','r','s','y'},
+    {'b','i','r','t','h'},
+    {'b','i','r','z','e'},
+    {'b','i','r','z','z'},
+    {'b','i','s','e','s'},
+    {'b','i','s','k','s'},
+    {'b','i','s','o','m'},
+    {'b','i','s','o','n'},
+    {'b','i','t','c','h'},
+    {'b','i','t','e','r'},
+    {'b','i','t','e','s'},
+    {'b','i','t','e','y'},
+    {'b','i','t','o','s'},
+    {'b','i','t','o','u'},
+    {'b','i','t','s','y'},
+    {'b','i','t','t','e'},
+    {'b','i','t','t','s'},
+    {'b','i','t','t','y'},
+    {'b','i','v','i','a'},
+    {'b','i','v','v','y'},
+    {'b','i','z','e','s'},
+    {'b','i','z','z','o'},
+    {'b','i','z','z','y'},
+    {'b','l','a','b','s'},
+    {'b','l','a','c','k'},
+    {'b','l','a','d','e'},
+    {'b','l','a','d','s'},
+    {'b','l','a','d','y'},
+    {'b','l','a','e','r'},
+    {'b','l','a','e','s'},
+    {'b','l','a','f','f'},
+    {'b','l','a','g','s'},
+    {'b','l','a','h','s'},
+    {'b','l','a','i','n'},
+    {'b','l','a','m','e'},
+    {'b','l','a','m','s'},
+    {'b','l','a','n','c'},
+    {'b','l','a','n','d'},
+    {'b','l','a','n','k'},
+    {'b','l','a','r','e'},
+    {'b','l','a','r','t'},
+    {'b','l','a','s','e'},
+    {'b','l','a','s','h'},
+    {'b','l','a','s','t'},
+    {'b','l','a','t','e'},
+    {'b','l','a','t','s'},
+    {'b','l','a','t','t'},
+    {'b','l','a','u','d'},
+    {'b','l','a','w','n'},
+    {'b','l','a','w','s'},
+    {'b','l','a','y','s'},
+    {'b','l','a','z','e'},
+    {'b','l','e','a','h'},
+    {'b','l','e','a','k'},
+    {'b','l','e','a','r'},
+    {'b','l','e','a','t'},
+    {'b','l','e','b','s'},
+    {'b','l','e','c','h'},
+    {'b','l','e','e','d'},
+    {'b','l','e','e','p'},
+    {'b','l','e','e','s'},
+    {'b','l','e','n','d'},
+    {'b','l','e','n','t'},
+    {'b','l','e','r','t'},
+    {'b','l','e','s','s'},
+    {'b','l','e','s','t'},
+    {'b','l','e','t','s'},
+    {'b','l','e','y','s'},
+    {'b','l','i','m','p'},
+    {'b','l','i','m','y'},
+    {'b','l','i','n','d'},
+    {'b','l','i','n','g'},
+    {'b','l','i','n','i'},
+    {'b','l','i','n','k'},
+    {'b','l','i','n','s'},
+    {'b','l','i','n','y'},
+    {'b','l','i','p','s'},
+    {'b','l','i','s','s'},
+    {'b','l','i','s','t'},
+    {'b','l','i','t','e'},
+    {'b','l','i','t','s'},
+    {'b','l','i','t','z'},
+    {'b','l','i','v','e'},
+    {'b','l','o','a','t'},
+    {'b','l','o','b','s'},
+    {'b','l','o','c','k'},
+    {'b','l','o','c','s'},
+    {'b','l','o','g','s'},
+    {'b','l','o','k','e'},
+    {'b','l','o','n','d'},
+    {'b','l','o','n','x'},
+    {'b','l','o','o','d'},
+    {'b','l','o','o','k'},
+    {'b','l','o','o','m'},
+    {'b','l','o','o','p'},
+    {'b','l','o','r','e'},
+    {'b','l','o','t','s'},
+    {'b','l','o','w','n'},
+    {'b','l','o','w','s'},
+    {'b','l','o','w','y'},
+    {'b','l','u','b','s'},
+    {'b','l','u','d','e'},
+    {'b','l','u','d','s'},
+    {'b','l','u','d','y'},
+    {'b','l','u','e','d'},
+    {'b','l','u','e','r'},
+    {'b','l','u','e','s'},
+    {'b','l','u','e','t'},
+    {'b','l','u','e','y'},
+    {'b','l','u','f','f'},
+    {'b','l','u','i','d'},
+    {'b','l','u','m','e'},
+    {'b','l','u','n','k'},
+    {'b','l','u','n','t'},
+    {'b','l','u','r','b'},
+    {'b','l','u','r','s'},
+    {'b','l','u','r','t'},
+    {'b','l','u','s','h'},
+    {'b','l','y','p','e'},
+    {'b','o','a','b','s'},
+    {'b','o','a','k','s'},
+    {'b','o','a','r','d'},
+    {'b','o','a','r','s'},
+    {'b','o','a','r','t'},
+    {'b','o','a','s','t'},
+    {'b','o','a','t','s'},
+    {'b','o','a','t','y'},
+    {'b','o','b','a','c'},
+    {'b','o','b','a','k'},
+    {'b','o','b','a','s'},
+    {'b','o','b','b','y'},
+    {'b','o','b','o','l'},
+    {'b','o','b','o','s'},
+    {'b','o','c','c','a'},
+    {'b','o','c','c','e'},
+    {'b','o','c','c','i'},
+    {'b','o','c','h','e'},
+    {'b','o','c','k','s'},
+    {'b','o','d','e','d'},
+    {'b','o','d','e','s'},
+    {'b','o','d','g','e'},
+    {'b','o','d','g','y'},
+    {'b','o','d','h','i'},
+    {'b','o','d','l','e'},
+    {'b','o','d','o','h'},
+    {'b','o','e','p','s'},
+    {'b','o','e','r','s'},
+    {'b','o','e','t','i'},
+    {'b','o','e','t','s'},
+    {'b','o','e','u','f'},
+    {'b','o','f','f','o'},
+    {'b','o','f','f','s'},
+    {'b','o','g','a','n'},
+    {'b','o','g','e','y'},
+    {'b','o','g','g','y'},
+    {'b','o','g','i','e'},
+    {'b','o','g','l','e'},
+    {'b','o','g','u','e'},
+    {'b','o','g','u','s'},
+    {'b','o','h','e','a'},
+    {'b','o','h','o','s'},
+    {'b','o','i','l','s'},
+    {'b','o','i','n','g'},
+    {'b','o','i','n','k'},
+    {'b','o','i','t','e'},
+    {'b','o','k','e','d'},
+    {'b','o','k','e','h'},
+    {'b','o','k','e','s'},
+    {'b','o','k','o','s'},
+    {'b','o','l','a','r'},
+    {'b','o','l','a','s'},
+    {'b','o','l','d','o'},
+    {'b','o','l','d','s'},
+    {'b','o','l','e','s'},
+    {'b','o','l','e','t'},
+    {'b','o','l','i','x'},
+    {'b','o','l','k','s'},
+    {'b','o','l','l','s'},
+    {'b','o','l','o','s'},
+    {'b','o','l','t','s'},
+    {'b','o','l','u','s'},
+    {'b','o','m','a','s'},
+    {'b','o','m','b','e'},
+    {'b','o','m','b','o'},
+    {'b','o','m','b','s'},
+    {'b','o','m','o','h'},
+    {'b','o','m','o','r'},
+    {'b','o','n','c','e'},
+    {'b','o','n','d','s'},
+    {'b','o','n','e','d'},
+    {'b','o','n','e','r'},
+    {'b','o','n','e','s'},
+    {'b','o','n','e','y'},
+    {'b','o','n','g','o'},
+    {'b','o','n','g','s'},
+    {'b','o','n','i','e'},
+    {'b','o','n','k','s'},
+    {'b','o','n','n','e'},
+    {'b','o','n','n','y'},
+    {'b','o','n','u','m'},
+    {'b','o','n','u','s'},
+    {'b','o','n','z','a'},
+    {'b','o','n','z','e'},
+    {'b','o','o','a','i'},
+    {'b','o','o','a','y'},
+    {'b','o','o','b','s'},
+    {'b','o','o','b','y'},
+    {'b','o','o','d','y'},
+    {'b','o','o','e','d'},
+    {'b','o','o','f','y'},
+    {'b','o','o','g','y'},
+    {'b','o','o','h','s'},
+    {'b','o','o','k','s'},
+    {'b','o','o','k','y'},
+    {'b','o','o','l','s'},
+    {'b','o','o','m','s'},
+    {'b','o','o','m','y'},
+    {'b','o','o','n','g'},
+    {'b','o','o','n','s'},
+    {'b','o','o','r','d'},
+    {'b','o','o','r','s'},
+    {'b','o','o','s','e'},
+    {'b','o','o','s','t'},
+    {'b','o','o','t','h'},
+    {'b','o','o','t','s'},
+    {'b','o','o','t','y'},
+    {'b','o','o','z','e'},
+    {'b','o','o','z','y'},
+    {'b','o','p','p','y'},
+    {'b','o','r','a','k'},
+    {'b','o','r','a','l'},
+    {'b','o','r','a','s'},
+    {'b','o','r','a','x'},
+    {'b','o','r','d','e'},
+    {'b','o','r','d','s'},
+    {'b','o','r','e','d'},
+    {'b','o','r','e','e'},
+    {'b','o','r','e','k'},
+    {'b','o','r','e','l'},
+    {'b','o','r','e','r'},
+    {'b','o','r','e','s'},
+    {'b','o','r','g','o'},
+    {'b','o','r','i','c'},
+    {'b','o','r','k','s'},
+    {'b','o','r','m','s'},
+    {'b','o','r','n','a'},
+    {'b','o','r','n','e'},
+    {'b','o','r','o','n'},
+    {'b','o','r','t','s'},
+    {'b','o','r','t','y'},
+    {'b','o','r','t','z'},
+    {'b','o','s','e','y'},
+    {'b','o','s','i','e'},
+    {'b','o','s','k','s'},
+    {'b','o','s','k','y'},
+    {'b','o','s','o','m'},
+    {'b','o','s','o','n'},
+    {'b','o','s','s','a'},
+    {'b','o','s','s','y'},
+    {'b','o','s','u','n'},
+    {'b','o','t','a','s'},
+    {'b','o','t','c','h'},
+    {'b','o','t','e','h'},
+    {'b','o','t','e','l'},
+    {'b','o','t','e','s'},
+    {'b','o','t','e','w'},
+    {'b','o','t','h','y'},
+    {'b','o','t','o','s'},
+    {'b','o','t','t','e'},
+    {'b','o','t','t','s'},
+    {'b','o','t','t','y'},
+    {'b','o','u','g','e'},
+    {'b','o','u','g','h'},
+    {'b','o','u','k','s'},
+    {'b','o','u','l','e'},
+    {'b','o','u','l','t'},
+    {'b','o','u','n','d'},
+    {'b','o','u','n','s'},
+    {'b','o','u','r','d'},
+    {'b','o','u','r','g'},
+    {'b','o','u','r','n'},
+    {'b','o','u','s','e'},
+    {'b','o','u','s','y'},
+    {'b','o','u','t','s'},
+    {'b','o','u','t','u'},
+    {'b','o','v','i','d'},
+    {'b','o','w','a','t'},
+    {'b','o','w','e','d'},
+    {'b','o','w','e','l'},
+    {'b','o','w','e','r'},
+    {'b','o','w','e','s'},
+    {'b','o','w','e','t'},
+    {'b','o','w','i','e'},
+    {'b','o','w','l','s'},
+    {'b','o','w','n','e'},
+    {'b','o','w','r','s'},
+    {'b','o','w','s','e'},
+    {'b','o','x','e','d'},
+    {'b','o','x','e','n'},
+    {'b','o','x','e','r'},
+    {'b','o','x','e','s'},
+    {'b','o','x','l','a'},
+    {'b','o','x','t','y'},
+    {'b','o','y','a','r'},
+    {'b','o','y','a','u'},
+    {'b','o','y','e','d'},
+    {'b','o','y','e','y'},
+    {'b','o','y','f','s'},
+    {'b','o','y','g','s'},
+    {'b','o','y','l','a'},
+    {'b','o','y','l','y'},
+    {'b','o','y','o','s'},
+    {'b','o','y','s','y'},
+    {'b','o','z','o','s'},
+    {'b','r','a','a','i'},
+    {'b','r','a','c','e'},
+    {'b','r','a','c','h'},
+    {'b','r','a','c','k'},
+    {'b','r','a','c','t'},
+    {'b','r','a','d','s'},
+    {'b','r','a','e','s'},
+    {'b','r','a','g','s'},
+    {'b','r','a','h','s'},
+    {'b','r','a','i','d'},
+    {'b','r','a','i','l'},
+    {'b','r','a','i','n'},
+    {'b','r','a','k','e'},
+    {'b','r','a','k','s'},
+    {'b','r','a','k','y'},
+    {'b','r','a','m','e'},
+    {'b','r','a','n','d'},
+    {'b','r','a','n','e'},
+    {'b','r','a','n','k'},
+    {'b','r','a','n','s'},
+    {'b','r','a','n','t'},
+    {'b','r','a','s','h'},
+    {'b','r','a','s','s'},
+    {'b','r','a','s','t'},
+    {'b','r','a','t','s'},
+    {'b','r','a','v','a'},
+    {'b','r','a','v','e'},
+    {'b','r','a','v','i'},
+    {'b','r','a','v','o'},
+    {'b','r','a','w','l'},
+    {'b','r','a','w','n'},
+    {'b','r','a','w','s'},
+    {'b','r','a','x','y'},
+    {'b','r','a','y','s'},
+    {'b','r','a','z','a'},
+    {'b','r','a','z','e'},
+    {'b','r','e','a','d'},
+    {'b','r','e','a','k'},
+    {'b','r','e','a','m'},
+    {'b','r','e','d','e'},
+    {'b','r','e','d','s'},
+    {'b','r','e','e','d'},
+    {'b','r','e','e','m'},
+    {'b','r','e','e','r'},
+    {'b','r','e','e','s'},
+    {'b','r','e','i','d'},
+    {'b','r','e','i','s'},
+    {'b','r','e','m','e'},
+    {'b','r','e','n','s'},
+    {'b','r','e','n','t'},
+    {'b','r','e','r','e'},
+    {'b','r','e','r','s'},
+    {'b','r','e','v','e'},
+    {'b','r','e','w','s'},
+    {'b','r','e','y','s'},
+    {'b','r','i','a','r'},
+    {'b','r','i','b','e'},
+    {'b','r','i','c','k'},
+    {'b','r','i','d','e'},
+    {'b','r','i','e','f'},
+    {'b','r','i','e','r'},
+    {'b','r','i','e','s'},
+    {'b','r','i','g','s'},
+    {'b','r','i','k','i'},
+    {'b','r','i','k','s'},
+    {'b','r','i','l','l'},
+    {'b','r','i','m','s'},
+    {'b','r','i','n','e'},
+    {'b','r','i','n','g'},
+    {'b','r','i','n','k'},
+    {'b','r','i','n','s'},
+    {'b','r','i','n','y'},
+    {'b','r','i','o','s'},
+    {'b','r','i','s','e'},
+    {'b','r','i','s','k'},
+    {'b','r','i','s','s'},
+    {'b','r','i','t','h'},
+    {'b','r','i','t','s'},
+    {'b','r','i','t','t'},
+    {'b','r','i','z','e'},
+    {'b','r','o','a','d'},
+    {'b','r','o','c','h'},
+    {'b','r','o','c','k'},
+    {'b','r','o','d','s'},
+    {'b','r','o','g','h'},
+    {'b','r','o','g','s'},
+    {'b','r','o','i','l'},
+    {'b','r','o','k','e'},
+    {'b','r','o','m','e'},
+    {'b','r','o','m','o'},
+    {'b','r','o','n','c'},
+    {'b','r','o','n','d'},
+    {'b','r','o','o','d'},
+    {'b','r','o','o','k'},
+    {'b','r','o','o','l'},
+    {'b','r','o','o','m'},
+    {'b','r','o','o','s'},
+    {'b','r','o','s','e'},
+    {'b','r','o','s','y'},
+    {'b','r','o','t','h'},
+    {'b','r','o','w','n'},
+    {'b','r','o','w','s'},
+    {'b','r','u','c','k'},
+    {'b','r','u','g','h'},
+    {'b','r','u','h','s'},
+    {'b','r','u','i','n'},
+    {'b','r','u','i','t'},
+    {'b','r','u','j','a'},
+    {'b','r','u','j','o'},
+    {'b','r','u','l','e'},
+    {'b','r','u','m','e'},
+    {'b','r','u','n','g'},
+    {'b','r','u','n','t'},
+    {'b','r','u','s','h'},
+    {'b','r','u','s','k'},
+    {'b','r','u','s','t'},
+    {'b','r','u','t','e'},
+    {'b','r','u','t','s'},
+    {'b','r','u','v','s'},
+    {'b','u','a','t','s'},
+    {'b','u','a','z','e'},
+    {'b','u','b','a','l'},
+    {'b','u','b','a','s'},
+    {'b','u','b','b','a'},
+    {'b','u','b','b','e'},
+    {'b','u','b','b','y'},
+    {'b','u','b','u','s'},
+    {'b','u','c','h','u'},
+    {'b','u','c','k','o'},
+    {'b','u','c','k','s'},
+    {'b','u','c','k','u'},
+    {'b','u','d','a','s'},
+    {'b','u','d','d','y'},
+    {'b','u','d','e','d'},
+    {'b','u','d','e','s'},
+    {'b','u','d','g','e'},
+    {'b','u','d','i','s'},
+    {'b','u','d','o','s'},
+    {'b','u','e','n','a'},
+    {'b','u','f','f','a'},
+    {'b','u','f','f','e'},
+    {'b','u','f','f','i'},
+    {'b','u','f','f','o'},
+    {'b','u','f','f','s'},
+    {'b','u','f','f','y'},
+    {'b','u','f','o','s'},
+    {'b','u','f','t','y'},
+    {'b','u','g','a','n'},
+    {'b','u','g','g','y'},
+    {'b','u','g','l','e'},
+    {'b','u','h','l','s'},
+    {'b','u','h','r','s'},
+    {'b','u','i','k','s'},
+    {'b','u','i','l','d'},
+    {'b','u','i','l','t'},
+    {'b','u','i','s','t'},
+    {'b','u','k','e','s'},
+    {'b','u','k','o','s'},
+    {'b','u','l','b','s'},
+    {'b','u','l','g','e'},
+    {'b','u','l','g','y'},
+    {'b','u','l','k','s'},
+    {'b','u','l','k','y'},
+    {'b','u','l','l','a'},
+    {'b','u','l','l','s'},
+    {'b','u','l','l','y'},
+    {'b','u','l','s','e'},
+    {'b','u','m','b','o'},
+    {'b','u','m','f','s'},
+    {'b','u','m','p','h'},
+    {'b','u','m','p','s'},
+    {'b','u','m','p','y'},
+    {'b','u','n','a','s'},
+    {'b','u','n','c','e'},
+    {'b','u','n','c','h'},
+    {'b','u','n','c','o'},
+    {'b','u','n','d','e'},
+    {'b','u','n','d','h'},
+    {'b','u','n','d','s'},
+    {'b','u','n','d','t'},
+    {'b','u','n','d','u'},
+    {'b','u','n','d','y'},
+    {'b','u','n','g','s'},
+    {'b','u','n','g','y'},
+    {'b','u','n','i','a'},
+    {'b','u','n','j','e'},
+    {'b','u','n','j','y'},
+    {'b','u','n','k','o'},
+    {'b','u','n','k','s'},
+    {'b','u','n','n','s'},
+    {'b','u','n','n','y'},
+    {'b','u','n','t','s'},
+    {'b','u','n','t','y'},
+    {'b','u','n','y','a'},
+    {'b','u','o','y','s'},
+    {'b','u','p','p','y'},
+    {'b','u','r','a','n'},
+    {'b','u','r','a','s'},
+    {'b','u','r','b','s'},
+    {'b','u','r','d','s'},
+    {'b','u','r','e','t'},
+    {'b','u','r','f','i'},
+    {'b','u','r','g','h'},
+    {'b','u','r','g','s'},
+    {'b','u','r','i','n'},
+    {'b','u','r','k','a'},
+    {'b','u','r','k','e'},
+    {'b','u','r','k','s'},
+    {'b','u','r','l','s'},
+    {'b','u','r','l','y'},
+    {'b','u','r','n','s'},
+    {'b','u','r','n','t'},
+    {'b','u','r','o','o'},
+    {'b','u','r','p','s'},
+    {'b','u','r','q','a'},
+    {'b','u','r','r','a'},
+    {'b','u','r','r','o'},
+    {'b','u','r','r','s'},
+    {'b','u','r','r','y'},
+    {'b','u','r','s','a'},
+    {'b','u','r','s','e'},
+    {'b','u','r','s','t'},
+    {'b','u','s','b','y'},
+    {'b','u','s','e','d'},
+    {'b','u','s','e','s'},
+    {'b','u','s','h','y'},
+    {'b','u','s','k','s'},
+    {'b','u','s','k','y'},
+    {'b','u','s','s','u'},
+    {'b','u','s','t','i'},
+    {'b','u','s','t','s'},
+    {'b','u','s','t','y'},
+    {'b','u','t','c','h'},
+    {'b','u','t','e','o'},
+    {'b','u','t','e','s'},
+    {'b','u','t','l','e'},
+    {'b','u','t','o','h'},
+    {'b','u','t','t','e'},
+    {'b','u','t','t','s'},
+    {'b','u','t','t','y'},
+    {'b','u','t','u','t'},
+    {'b','u','t','y','l'},
+    {'b','u','x','o','m'},
+    {'b','u','y','e','r'},
+    {'b','u','y','i','n'},
+    {'b','u','z','z','y'},
+    {'b','w','a','n','a'},
+    {'b','w','a','z','i'},
+    {'b','y','d','e','d'},
+    {'b','y','d','e','s'},
+    {'b','y','k','e','d'},
+    {'b','y','k','e','s'},
+    {'b','y','l','a','w'},
+    {'b','y','r','e','s'},
+    {'b','y','r','l','s'},
+    {'b','y','s','s','i'},
+    {'b','y','t','e','s'},
+    {'b','y','w','a','y'},
+    {'c','a','a','e','d'},
+    {'c','a','b','a','l'},
+    {'c','a','b','a','s'},
+    {'c','a','b','b','y'},
+    {'c','a','b','e','r'},
+    {'c','a','b','i','n'},
+    {'c','a','b','l','e'},
+    {'c','a','b','o','b'},
+    {'c','a','b','o','c'},
+    {'c','a','b','r','e'},
+    {'c','a','c','a','o'},
+    {'c','a','c','a','s'},
+    {'c','a','c','h','e'},
+    {'c','a','c','k','s'},
+    {'c','a','c','k','y'},
+    {'c','a','c','t','i'},
+    {'c','a','d','d','y'},
+    {'c','a','d','e','e'},
+    {'c','a','d','e','s'},
+    {'c','a','d','e','t'},
+    {'c','a','d','g','e'},
+    {'c','a','d','g','y'},
+    {'c','a','d','i','e'},
+    {'c','a','d','i','s'},
+    {'c','a','d','r','e'},
+    {'c','a','e','c','a'},
+    {'c','a','e','s','e'},
+    {'c','a','f','e','s'},
+    {'c','a','f','f','e'},
+    {'c','a','f','f','s'},
+    {'c','a','g','e','d'},
+    {'c','a','g','e','r'},
+    {'c','a','g','e','s'},
+    {'c','a','g','e','y'},
+    {'c','a','g','o','t'},
+    {'c','a','h','o','w'},
+    {'c','a','i','d','s'},
+    {'c','a','i','n','s'},
+    {'c','a','i','r','d'},
+    {'c','a','i','r','n'},
+    {'c','a','j','o','n'},
+    {'c','a','j','u','n'},
+    {'c','a','k','e','d'},
+    {'c','a','k','e','s'},
+    {'c','a','k','e','y'},
+    {'c','a','l','f','s'},
+    {'c','a','l','i','d'},
+    {'c','a','l','i','f'},
+    {'c','a','l','i','x'},
+    {'c','a','l','k','s'},
+    {'c','a','l','l','a'},
+    {'c','a','l','l','e'},
+    {'c','a','l','l','s'},
+    {'c','a','l','m','s'},
+    {'c','a','l','m','y'},
+    {'c','a','l','o','s'},
+    {'c','a','l','p','a'},
+    {'c','a','l','p','s'},
+    {'c','a','l','v','e'},
+    {'c','a','l','y','x'},
+    {'c','a','m','a','n'},
+    {'c','a','m','a','s'},
+    {'c','a','m','e','l'},
+    {'c','a','m','e','o'},
+    {'c','a','m','e','s'},
+    {'c','a','m','i','s'},
+    {'c','a','m','o','s'},
+    {'c','a','m','p','i'},
+    {'c','a','m','p','o'},
+    {'c','a','m','p','s'},
+    {'c','a','m','p','y'},
+    {'c','a','m','u','s'},
+    {'c','a','n','a','l'},
+    {'c','a','n','d','o'},
+    {'c','a','n','d','y'},
+    {'c','a','n','e','d'},
+    {'c','a','n','e','h'},
+    {'c','a','n','e','r'},
+    {'c','a','n','e','s'},
+    {'c','a','n','g','s'},
+    {'c','a','n','i','d'},
+    {'c','a','n','n','a'},
+    {'c','a','n','n','s'},
+    {'c','a','n','n','y'},
+    {'c','a','n','o','e'},
+    {'c','a','n','o','n'},
+    {'c','a','n','s','o'},
+    {'c','a','n','s','t'},
+    {'c','a','n','t','i'},
+    {'c','a','n','t','o'},
+    {'c','a','n','t','s'},
+    {'c','a','n','t','y'},
+    {'c','a','p','a','s'},
+    {'c','a','p','a','x'},
+    {'c','a','p','e','d'},
+    {'c','a','p','e','r'},
+    {'c','a','p','e','s'},
+    {'c','a','p','e','x'},
+    {'c','a','p','h','s'},
+    {'c','a','p','i','z'},
+    {'c','a','p','l','e'},
+    {'c','a','p','o','n'},
+    {'c','a','p','o','s'},
+    {'c','a','p','o','t'},
+    {'c','a','p','r','i'},
+    {'c','a','p','u','l'},
+    {'c','a','p','u','t'},
+    {'c','a','r','a','p'},
+    {'c','a','r','a','t'},
+    {'c','a','r','b','o'},
+    {'c','a','r','b','s'},
+    {'c','a','r','b','y'},
+    {'c','a','r','d','i'},
+    {'c','a','r','d','s'},
+    {'c','a','r','d','y'},
+    {'c','a','r','e','d'},
+    {'c','a','r','e','r'},
+    {'c','a','r','e','s'},
+    {'c','a','r','e','t'},
+    {'c','a','r','e','x'},
+    {'c','a','r','g','o'},
+    {'c','a','r','k','s'},
+    {'c','a','r','l','e'},
+    {'c','a','r','l','s'},
+    {'c','a','r','n','e'},
+    {'c','a','r','n','s'},
+    {'c','a','r','n','y'},
+    {'c','a','r','o','b'},
+    {'c','a','r','o','l'},
+    {'c','a','r','o','m'},
+    {'c','a','r','o','n'},
+    {'c','a','r','p','e'},
+    {'c','a','r','p','i'},
+    {'c','a','r','p','s'},
+    {'c','a','r','r','s'},
+    {'c','a','r','r','y'},
+    {'c','a','r','s','e'},
+    {'c','a','r','t','a'},
+    {'c','a','r','t','e'},
+    {'c','a','r','t','s'},
+    {'c','a','r','v','e'},
+    {'c','a','r','v','y'},
+    {'c','a','s','a','s'},
+    {'c','a','s','c','o'},
+    {'c','a','s','e','d'},
+    {'c','a','s','e','r'},
+    {'c','a','s','e','s'},
+    {'c','a','s','k','s'},
+    {'c','a','s','k','y'},
+    {'c','a','s','t','e'},
+    {'c','a','s','t','s'},
+    {'c','a','s','u','s'},
+    {'c','a','t','c','h'},
+    {'c','a','t','e','r'},
+    {'c','a','t','e','s'},
+    {'c','a','t','t','y'},
+    {'c','a','u','d','a'},
+    {'c','a','u','k','s'},
+    {'c','a','u','l','d'},
+    {'c','a','u','l','k'},
+    {'c','a','u','l','s'},
+    {'c','a','u','m','s'},
+    {'c','a','u','p','s'},
+    {'c','a','u','r','i'},
+    {'c','a','u','s','a'},
+    {'c','a','u','s','e'},
+    {'c','a','v','a','s'},
+    {'c','a','v','e','d'},
+    {'c','a','v','e','l'},
+    {'c','a','v','e','r'},
+    {'c','a','v','e','s'},
+    {'c','a','v','i','e'},
+    {'c','a','v','i','l'},
+    {'c','a','v','u','s'},
+    {'c','a','w','e','d'},
+    {'c','a','w','k','s'},
+    {'c','a','x','o','n'},
+    {'c','e','a','s','e'},
+    {'c','e','a','z','e'},
+    {'c','e','b','i','d'},
+    {'c','e','c','a','l'},
+    {'c','e','c','u','m'},
+    {'c','e','d','a','r'},
+    {'c','e','d','e','d'},
+    {'c','e','d','e','r'},
+    {'c','e','d','e','s'},
+    {'c','e','d','i','s'},
+    {'c','e','i','b','a'},
+    {'c','e','i','l','i'},
+    {'c','e','i','l','s'},
+    {'c','e','l','e','b'},
+    {'c','e','l','l','a'},
+    {'c','e','l','l','i'},
+    {'c','e','l','l','o'},
+    {'c','e','l','l','s'},
+    {'c','e','l','l','y'},
+    {'c','e','l','o','m'},
+    {'c','e','l','t','s'},
+    {'c','e','n','s','e'},
+    {'c','e','n','t','o'},
+    {'c','e','n','t','s'},
+    {'c','e','n','t','u'},
+    {'c','e','o','r','l'},
+    {'c','e','p','e','s'},
+    {'c','e','r','c','i'},
+    {'c','e','r','e','d'},
+    {'c','e','r','e','s'},
+    {'c','e','r','g','e'},
+    {'c','e','r','i','a'},
+    {'c','e','r','i','c'},
+    {'c','e','r','n','e'},
+    {'c','e','r','o','c'},
+    {'c','e','r','o','s'},
+    {'c','e','r','t','s'},
+    {'c','e','r','t','y'},
+    {'c','e','s','s','e'},
+    {'c','e','s','t','a'},
+    {'c','e','s','t','i'},
+    {'c','e','t','e','s'},
+    {'c','e','t','y','l'},
+    {'c','e','z','v','e'},
+    {'c','h','a','a','p'},
+    {'c','h','a','a','t'},
+    {'c','h','a','c','e'},
+    {'c','h','a','c','k'},
+    {'c','h','a','c','o'},
+    {'c','h','a','d','o'},
+    {'c','h','a','d','s'},
+    {'c','h','a','f','e'},
+    {'c','h','a','f','f'},
+    {'c','h','a','f','t'},
+    {'c','h','a','i','n'},
+    {'c','h','a','i','r'},
+    {'c','h','a','i','s'},
+    {'c','h','a','l','k'},
+    {'c','h','a','l','s'},
+    {'c','h','a','m','p'},
+    {'c','h','a','m','s'},
+    {'c','h','a','n','a'},
+    {'c','h','a','n','g'},
+    {'c','h','a','n','k'},
+    {'c','h','a','n','t'},
+    {'c','h','a','o','s'},
+    {'c','h','a','p','e'},
+    {'c','h','a','p','s'},
+    {'c','h','a','p','t'},
+    {'c','h','a','r','a'},
+    {'c','h','a','r','d'},
+    {'c','h','a','r','e'},
+    {'c','h','a','r','k'},
+    {'c','h','a','r','m'},
+    {'c','h','a','r','r'},
+    {'c','h','a','r','s'},
+    {'c','h','a','r','t'},
+    {'c','h','a','r','y'},
+    {'c','h','a','s','e'},
+    {'c','h','a','s','m'},
+    {'c','h','a','t','s'},
+    {'c','h','a','v','a'},
+    {'c','h','a','v','e'},
+    {'c','h','a','v','s'},
+    {'c','h','a','w','k'},
+    {'c','h','a','w','l'},
+    {'c','h','a','w','s'},
+    {'c','h','a','y','a'},
+    {'c','h','a','y','s'},
+    {'c','h','e','a','p'},
+    {'c','h','e','a','t'},
+    {'c','h','e','b','a'},
+    {'c','h','e','c','k'},
+    {'c','h','e','d','i'},
+    {'c','h','e','e','b'},
+    {'c','h','e','e','k'},
+    {'c','h','e','e','p'},
+    {'c','h','e','e','r'},
+    {'c','h','e','e','t'},
+    {'c','h','e','f','s'},
+    {'c','h','e','k','a'},
+    {'c','h','e','l','a'},
+    {'c','h','e','l','p'},
+    {'c','h','e','m','o'},
+    {'c','h','e','m','s'},
+    {'c','h','e','r','e'},
+    {'c','h','e','r','t'},
+    {'c','h','e','s','s'},
+    {'c','h','e','s','t'},
+    {'c','h','e','t','h'},
+    {'c','h','e','v','y'},
+    {'c','h','e','w','s'},
+    {'c','h','e','w','y'},
+    {'c','h','i','a','o'},
+    {'c','h','i','a','s'},
+    {'c','h','i','b','a'},
+    {'c','h','i','b','s'},
+    {'c','h','i','c','a'},
+    {'c','h','i','c','h'},
+    {'c','h','i','c','k'},
+    {'c','h','i','c','o'},
+    {'c','h','i','c','s'},
+    {'c','h','i','d','e'},
+    {'c','h','i','e','f'},
+    {'c','h','i','e','l'},
+    {'c','h','i','k','o'},
+    {'c','h','i','k','s'},
+    {'c','h','i','l','d'},
+    {'c','h','i','l','e'},
+    {'c','h','i','l','i'},
+    {'c','h','i','l','l'},
+    {'c','h','i','m','b'},
+    {'c','h','i','m','e'},
+    {'c','h','i','m','o'},
+    {'c','h','i','m','p'},
+    {'c','h','i','n','a'},
+    {'c','h','i','n','e'},
+    {'c','h','i','n','g'},
+    {'c','h','i','n','k'},
+    {'c','h','i','n','o'},
+    {'c','h','i','n','s'},
+    {'c','h','i','p','s'},
+    {'c','h','i','r','k'},
+    {'c','h','i','r','l'},
+    {'c','h','i','r','m'},
+    {'c','h','i','r','o'},
+    {'c','h','i','r','p'},
+    {'c','h','i','r','r'},
+    {'c','h','i','r','t'},
+    {'c','h','i','r','u'},
+    {'c','h','i','t','i'},
+    {'c','h','i','t','s'},
+    {'c','h','i','v','a'},
+    {'c','h','i','v','e'},
+    {'c','h','i','v','s'},
+    {'c','h','i','v','y'},
+    {'c','h','i','z','z'},
+    {'c','h','o','c','k'},
+    {'c','h','o','c','o'},
+    {'c','h','o','c','s'},
+    {'c','h','o','d','e'},
+    {'c','h','o','g','s'},
+    {'c','h','o','i','l'},
+    {'c','h','o','i','r'},
+    {'c','h','o','k','e'},
+    {'c','h','o','k','o'},
+    {'c','h','o','k','y'},
+    {'c','h','o','l','a'},
+    {'c','h','o','l','i'},
+    {'c','h','o','l','o'},
+    {'c','h','o','m','p'},
+    {'c','h','o','n','s'},
+    {'c','h','o','o','f'},
+    {'c','h','o','o','k'},
+    {'c','h','o','o','m'},
+    {'c','h','o','o','n'},
+    {'c','h','o','p','s'},
+    {'c','h','o','r','d'},
+    {'c','h','o','r','e'},
+    {'c','h','o','s','e'},
+    {'c','h','o','s','s'},
+    {'c','h','o','t','a'},
+    {'c','h','o','t','t'},
+    {'c','h','o','u','t'},
+    {'c','h','o','u','x'},
+    {'c','h','o','w','k'},
+    {'c','h','o','w','s'},
+    {'c','h','u','b','s'},
+    {'c','h','u','c','k'},
+    {'c','h','u','f','a'},
+    {'c','h','u','f','f'},
+    {'c','h','u','g','s'},
+    {'c','h','u','m','p'},
+    {'c','h','u','m','s'},
+    {'c','h','u','n','k'},
+    {'c','h','u','r','l'},
+    {'c','h','u','r','n'},
+    {'c','h','u','r','r'},
+    {'c','h','u','s','e'},
+    {'c','h','u','t','e'},
+    {'c','h','u','t','s'},
+    {'c','h','y','l','e'},
+    {'c','h','y','m','e'},
+    {'c','h','y','n','d'},
+    {'c','i','b','o','l'},
+    {'c','i','d','e','d'},
+    {'c','i','d','e','r'},
+    {'c','i','d','e','s'},
+    {'c','i','e','l','s'},
+    {'c','i','g','a','r'},
+    {'c','i','g','g','y'},
+    {'c','i','l','i','a'},
+    {'c','i','l','l','s'},
+    {'c','i','m','a','r'},
+    {'c','i','m','e','x'},
+    {'c','i','n','c','h'},
+    {'c','i','n','c','t'},
+    {'c','i','n','e','s'},
+    {'c','i','n','q','s'},
+    {'c','i','o','n','s'},
+    {'c','i','p','p','i'},
+    {'c','i','r','c','a'},
+    {'c','i','r','c','s'},
+    {'c','i','r','e','s'},
+    {'c','i','r','l','s'},
+    {'c','i','r','r','i'},
+    {'c','i','s','c','o'},
+    {'c','i','s','s','y'},
+    {'c','i','s','t','s'},
+    {'c','i','t','a','l'},
+    {'c','i','t','e','d'},
+    {'c','i','t','e','e'},
+    {'c','i','t','e','r'},
+    {'c','i','t','e','s'},
+    {'c','i','v','e','s'},
+    {'c','i','v','e','t'},
+    {'c','i','v','i','c'},
+    {'c','i','v','i','e'},
+    {'c','i','v','i','l'},
+    {'c','i','v','v','y'},
+    {'c','l','a','c','h'},
+    {'c','l','a','c','k'},
+    {'c','l','a','d','e'},
+    {'c','l','a','d','s'},
+    {'c','l','a','e','s'},
+    {'c','l','a','g','s'},
+    {'c','l','a','i','m'},
+    {'c','l','a','i','r'},
+    {'c','l','a','m','e'},
+    {'c','l','a','m','p'},
+    {'c','l','a','m','s'},
+    {'c','l','a','n','g'},
+    {'c','l','a','n','k'},
+    {'c','l','a','n','s'},
+    {'c','l','a','p','s'},
+    {'c','l','a','p','t'},
+    {'c','l','a','r','o'},
+    {'c','l','a','r','t'},
+    {'c','l','a','r','y'},
+    {'c','l','a','s','h'},
+    {'c','l','a','s','p'},
+    {'c','l','a','s','s'},
+    {'c','l','a','s','t'},
+    {'c','l','a','t','s'},
+    {'c','l','a','u','t'},
+    {'c','l','a','v','e'},
+    {'c','l','a','v','i'},
+    {'c','l','a','w','s'},
+    {'c','l','a','y','s'},
+    {'c','l','e','a','n'},
+    {'c','l','e','a','r'},
+    {'c','l','e','a','t'},
+    {'c','l','e','c','k'},
+    {'c','l','e','e','k'},
+    {'c','l','e','e','p'},
+    {'c','l','e','f','s'},
+    {'c','l','e','f','t'},
+    {'c','l','e','g','s'},
+    {'c','l','e','i','k'},
+    {'c','l','e','m','s'},
+    {'c','l','e','p','e'},
+    {'c','l','e','p','t'},
+    {'c','l','e','r','k'},
+    {'c','l','e','v','e'},
+    {'c','l','e','w','s'},
+    {'c','l','i','c','k'},
+    {'c','l','i','e','d'},
+    {'c','l','i','e','s'},
+    {'c','l','i','f','f'},
+    {'c','l','i','f','t'},
+    {'c','l','i','m','b'},
+    {'c','l','i','m','e'},
+    {'c','l','i','n','e'},
+    {'c','l','i','n','g'},
+    {'c','l','i','n','k'},
+    {'c','l','i','n','t'},
+    {'c','l','i','p','e'},
+    {'c','l','i','p','s'},
+    {'c','l','i','p','t'},
+    {'c','l','i','t','s'},
+    {'c','l','o','a','k'},
+    {'c','l','o','a','m'},
+    {'c','l','o','c','k'},
+    {'c','l','o','d','s'},
+    {'c','l','o','f','f'},
+    {'c','l','o','g','s'},
+    {'c','l','o','k','e'},
+    {'c','l','o','m','b'},
+    {'c','l','o','m','p'},
+    {'c','l','o','n','e'},
+    {'c','l','o','n','k'},
+    {'c','l','o','n','s'},
+    {'c','l','o','o','p'},
+    {'c','l','o','o','t'},
+    {'c','l','o','p','s'},
+    {'c','l','o','s','e'},
+    {'c','l','o','t','e'},
+    {'c','l','o','t','h'},
+    {'c','l','o','t','s'},
+    {'c','l','o','u','d'},
+    {'c','l','o','u','r'},
+    {'c','l','o','u','s'},
+    {'c','l','o','u','t'},
+    {'c','l','o','v','e'},
+    {'c','l','o','w','n'},
+    {'c','l','o','w','s'},
+    {'c','l','o','y','e'},
+    {'c','l','o','y','s'},
+    {'c','l','o','z','e'},
+    {'c','l','u','b','s'},
+    {'c','l','u','c','k'},
+    {'c','l','u','e','d'},
+    {'c','l','u','e','s'},
+    {'c','l','u','e','y'},
+    {'c','l','u','m','p'},
+    {'c','l','u','n','g'},
+    {'c','l','u','n','k'},
+    {'c','l','y','p','e'},
+    {'c','n','i','d','a'},
+    {'c','o','a','c','h'},
+    {'c','o','a','c','t'},
+    {'c','o','a','d','y'},
+    {'c','o','a','l','a'},
+    {'c','o','a','l','s'},
+    {'c','o','a','l','y'},
+    {'c','o','a','p','t'},
+    {'c','o','a','r','b'},
+    {'c','o','a','s','t'},
+    {'c','o','a','t','e'},
+    {'c','o','a','t','i'},
+    {'c','o','a','t','s'},
+    {'c','o','b','b','s'},
+    {'c','o','b','b','y'},
+    {'c','o','b','i','a'},
+    {'c','o','b','l','e'},
+    {'c','o','b','o','t'},
+    {'c','o','b','r','a'},
+    {'c','o','b','z','a'},
+    {'c','o','c','a','s'},
+    {'c','o','c','c','i'},
+    {'c','o','c','c','o'},
+    {'c','o','c','k','s'},
+    {'c','o','c','k','y'},
+    {'c','o','c','o','a'},
+    {'c','o','c','o','s'},
+    {'c','o','c','u','s'},
+    {'c','o','d','a','s'},
+    {'c','o','d','e','c'},
+    {'c','o','d','e','d'},
+    {'c','o','d','e','n'},
+    {'c','o','d','e','r'},
+    {'c','o','d','e','s'},
+    {'c','o','d','e','x'},
+    {'c','o','d','o','n'},
+    {'c','o','e','d','s'},
+    {'c','o','f','f','s'},
+    {'c','o','g','i','e'},
+    {'c','o','g','o','n'},
+    {'c','o','g','u','e'},
+    {'c','o','h','a','b'},
+    {'c','o','h','e','n'},
+    {'c','o','h','o','e'},
+    {'c','o','h','o','g'},
+    {'c','o','h','o','s'},
+    {'c','o','i','f','s'},
+    {'c','o','i','g','n'},
+    {'c','o','i','l','s'},
+    {'c','o','i','n','s'},
+    {'c','o','i','r','s'},
+    {'c','o','i','t','s'},
+    {'c','o','k','e','d'},
+    {'c','o','k','e','s'},
+    {'c','o','k','e','y'},
+    {'c','o','l','a','s'},
+    {'c','o','l','b','y'},
+    {'c','o','l','d','s'},
+    {'c','o','l','e','d'},
+    {'c','o','l','e','s'},
+    {'c','o','l','e','y'},
+    {'c','o','l','i','c'},
+    {'c','o','l','i','n'},
+    {'c','o','l','l','e'},
+    {'c','o','l','l','s'},
+    {'c','o','l','l','y'},
+    {'c','o','l','o','g'},
+    {'c','o','l','o','n'},
+    {'c','o','l','o','r'},
+    {'c','o','l','t','s'},
+    {'c','o','l','z','a'},
+    {'c','o','m','a','e'},
+    {'c','o','m','a','l'},
+    {'c','o','m','a','s'},
+    {'c','o','m','b','e'},
+    {'c','o','m','b','i'},
+    {'c','o','m','b','o'},
+    {'c','o','m','b','s'},
+    {'c','o','m','b','y'},
+    {'c','o','m','e','r'},
+    {'c','o','m','e','s'},
+    {'c','o','m','e','t'},
+    {'c','o','m','f','y'},
+    {'c','o','m','i','c'},
+    {'c','o','m','i','x'},
+    {'c','o','m','m','a'},
+    {'c','o','m','m','e'},
+    {'c','o','m','m','o'},
+    {'c','o','m','m','s'},
+    {'c','o','m','m','y'},
+    {'c','o','m','p','o'},
+    {'c','o','m','p','s'},
+    {'c','o','m','p','t'},
+    {'c','o','m','t','e'},
+    {'c','o','m','u','s'},
+    {'c','o','n','c','h'},
+    {'c','o','n','d','o'},
+    {'c','o','n','e','d'},
+    {'c','o','n','e','s'},
+    {'c','o','n','e','x'},
+    {'c','o','n','e','y'},
+    {'c','o','n','f','s'},
+    {'c','o','n','g','a'},
+    {'c','o','n','g','e'},
+    {'c','o','n','g','o'},
+    {'c','o','n','i','a'},
+    {'c','o','n','i','c'},
+    {'c','o','n','i','n'},
+    {'c','o','n','k','s'},
+    {'c','o','n','k','y'},
+    {'c','o','n','n','e'},
+    {'c','o','n','n','s'},
+    {'c','o','n','t','e'},
+    {'c','o','n','t','o'},
+    {'c','o','n','u','s'},
+    {'c','o','n','v','o'},
+    {'c','o','o','c','h'},
+    {'c','o','o','e','d'},
+    {'c','o','o','e','e'},
+    {'c','o','o','e','r'},
+    {'c','o','o','e','y'},
+    {'c','o','o','f','s'},
+    {'c','o','o','k','s'},
+    {'c','o','o','k','y'},
+    {'c','o','o','l','s'},
+    {'c','o','o','l','y'},
+    {'c','o','o','m','b'},
+    {'c','o','o','m','s'},
+    {'c','o','o','m','y'},
+    {'c','o','o','n','s'},
+    {'c','o','o','p','s'},
+    {'c','o','o','p','t'},
+    {'c','o','o','s','t'},
+    {'c','o','o','t','s'},
+    {'c','o','o','t','y'},
+    {'c','o','o','z','e'},
+    {'c','o','p','a','l'},
+    {'c','o','p','a','y'},
+    {'c','o','p','e','d'},
+    {'c','o','p','e','n'},
+    {'c','o','p','e','r'},
+    {'c','o','p','e','s'},
+    {'c','o','p','h','a'},
+    {'c','o','p','p','y'},
+    {'c','o','p','r','a'},
+    {'c','o','p','s','e'},
+    {'c','o','p','s','y'},
+    {'c','o','q','u','i'},
+    {'c','o','r','a','l'},
+    {'c','o','r','a','m'},
+    {'c','o','r','b','e'},
+    {'c','o','r','b','y'},
+    {'c','o','r','d','a'},
+    {'c','o','r','d','s'},
+    {'c','o','r','e','d'},
+    {'c','o','r','e','r'},
+    {'c','o','r','e','s'},
+    {'c','o','r','e','y'},
+    {'c','o','r','g','i'},
+    {'c','o','r','i','a'},
+    {'c','o','r','k','s'},
+    {'c','o','r','k','y'},
+    {'c','o','r','m','s'},
+    {'c','o','r','n','i'},
+    {'c','o','r','n','o'},
+    {'c','o','r','n','s'},
+    {'c','o','r','n','u'},
+    {'c','o','r','n','y'},
+    {'c','o','r','p','s'},
+    {'c','o','r','s','e'},
+    {'c','o','r','s','o'},
+    {'c','o','s','e','c'},
+    {'c','o','s','e','d'},
+    {'c','o','s','e','s'},
+    {'c','o','s','e','t'},
+    {'c','o','s','e','y'},
+    {'c','o','s','i','e'},
+    {'c','o','s','t','a'},
+    {'c','o','s','t','e'},
+    {'c','o','s','t','s'},
+    {'c','o','t','a','n'},
+    {'c','o','t','c','h'},
+    {'c','o','t','e','d'},
+    {'c','o','t','e','s'},
+    {'c','o','t','h','s'},
+    {'c','o','t','t','a'},
+    {'c','o','t','t','s'},
+    {'c','o','u','c','h'},
+    {'c','o','u','d','e'},
+    {'c','o','u','g','h'},
+    {'c','o','u','l','d'},
+    {'c','o','u','n','t'},
+    {'c','o','u','p','e'},
+    {'c','o','u','p','s'},
+    {'c','o','u','r','b'},
+    {'c','o','u','r','d'},
+    {'c','o','u','r','e'},
+    {'c','o','u','r','s'},
+    {'c','o','u','r','t'},
+    {'c','o','u','t','a'},
+    {'c','o','u','t','h'},
+    {'c','o','v','e','d'},
+    {'c','o','v','e','n'},
+    {'c','o','v','e','r'},
+    {'c','o','v','e','s'},
+    {'c','o','v','e','t'},
+    {'c','o','v','e','y'},
+    {'c','o','v','i','n'},
+    {'c','o','w','a','l'},
+    {'c','o','w','a','n'},
+    {'c','o','w','e','d'},
+    {'c','o','w','e','r'},
+    {'c','o','w','k','s'},
+    {'c','o','w','l','s'},
+    {'c','o','w','p','s'},
+    {'c','o','w','r','y'},
+    {'c','o','x','a','e'},
+    {'c','o','x','a','l'},
+    {'c','o','x','e','d'},
+    {'c','o','x','e','s'},
+    {'c','o','x','i','b'},
+    {'c','o','y','a','u'},
+    {'c','o','y','e','d'},
+    {'c','o','y','e','r'},
+    {'c','o','y','l','y'},
+    {'c','o','y','p','u'},
+    {'c','o','z','e','d'},
+    {'c','o','z','e','n'},
+    {'c','o','z','e','s'},
+    {'c','o','z','e','y'},
+    {'c','o','z','i','e'},
+    {'c','r','a','a','l'},
+    {'c','r','a','b','s'},
+    {'c','r','a','c','k'},
+    {'c','r','a','f','t'},
+    {'c','r','a','g','s'},
+    {'c','r','a','i','c'},
+    {'c','r','a','i','g'},
+    {'c','r','a','k','e'},
+    {'c','r','a','m','e'},
+    {'c','r','a','m','p'},
+    {'c','r','a','m','s'},
+    {'c','r','a','n','e'},
+    {'c','r','a','n','k'},
+    {'c','r','a','n','s'},
+    {'c','r','a','p','e'},
+    {'c','r','a','p','s'},
+    {'c','r','a','p','y'},
+    {'c','r','a','r','e'},
+    {'c','r','a','s','h'},
+    {'c','r','a','s','s'},
+    {'c','r','a','t','e'},
+    {'c','r','a','v','e'},
+    {'c','r','a','w','l'},
+    {'c','r','a','w','s'},
+    {'c','r','a','y','s'},
+    {'c','r','a','z','e'},
+    {'c','r','a','z','y'},
+    {'c','r','e','a','k'},
+    {'c','r','e','a','m'},
+    {'c','r','e','d','o'},
+    {'c','r','e','d','s'},
+    {'c','r','e','e','d'},
+    {'c','r','e','e','k'},
+    {'c','r','e','e','l'},
+    {'c','r','e','e','p'},
+    {'c','r','e','e','s'},
+    {'c','r','e','i','n'},
+    {'c','r','e','m','a'},
+    {'c','r','e','m','e'},
+    {'c','r','e','m','s'},
+    {'c','r','e','n','a'},
+    {'c','r','e','p','e'},
+    {'c','r','e','p','s'},
+    {'c','r','e','p','t'},
+    {'c','r','e','p','y'},
+    {'c','r','e','s','s'},
+    {'c','r','e','s','t'},
+    {'c','r','e','w','e'},
+    {'c','r','e','w','s'},
+    {'c','r','i','a','s'},
+    {'c','r','i','b','o'},
+    {'c','r','i','b','s'},
+    {'c','r','i','c','k'},
+    {'c','r','i','e','d'},
+    {'c','r','i','e','r'},
+    {'c','r','i','e','s'},
+    {'c','r','i','m','e'},
+    {'c','r','i','m','p'},
+    {'c','r','i','m','s'},
+    {'c','r','i','n','e'},
+    {'c','r','i','n','k'},
+    {'c','r','i','n','s'},
+    {'c','r','i','o','s'},
+    {'c','r','i','p','e'},
+    {'c','r','i','p','s'},
+    {'c','r','i','s','e'},
+    {'c','r','i','s','p'},
+    {'c','r','i','s','s'},
+    {'c','r','i','t','h'},
+    {'c','r','i','t','s'},
+    {'c','r','o','a','k'},
+    {'c','r','o','c','i'},
+    {'c','r','o','c','k'},
+    {'c','r','o','c','s'},
+    {'c','r','o','f','t'},
+    {'c','r','o','g','s'},
+    {'c','r','o','m','b'},
+    {'c','r','o','m','e'},
+    {'c','r','o','n','e'},
+    {'c','r','o','n','k'},
+    {'c','r','o','n','s'},
+    {'c','r','o','n','y'},
+    {'c','r','o','o','k'},
+    {'c','r','o','o','l'},
+    {'c','r','o','o','n'},
+    {'c','r','o','p','s'},
+    {'c','r','o','r','e'},
+    {'c','r','o','s','s'},
+    {'c','r','o','s','t'},
+    {'c','r','o','u','p'},
+    {'c','r','o','u','t'},
+    {'c','r','o','w','d'},
+    {'c','r','o','w','l'},
+    {'c','r','o','w','n'},
+    {'c','r','o','w','s'},
+    {'c','r','o','z','e'},
+    {'c','r','u','c','k'},
+    {'c','r','u','d','e'},
+    {'c','r','u','d','o'},
+    {'c','r','u','d','s'},
+    {'c','r','u','d','y'},
+    {'c','r','u','e','l'},
+    {'c','r','u','e','s'},
+    {'c','r','u','e','t'},
+    {'c','r','u','f','t'},
+    {'c','r','u','m','b'},
+    {'c','r','u','m','p'},
+    {'c','r','u','n','k'},
+    {'c','r','u','o','r'},
+    {'c','r','u','r','a'},
+    {'c','r','u','s','e'},
+    {'c','r','u','s','h'},
+    {'c','r','u','s','t'},
+    {'c','r','u','s','y'},
+    {'c','r','u','v','e'},
+    {'c','r','w','t','h'},
+    {'c','r','y','e','r'},
+    {'c','r','y','n','e'},
+    {'c','r','y','p','t'},
+    {'c','t','e','n','e'},
+    {'c','u','b','b','y'},
+    {'c','u','b','e','b'},
+    {'c','u','b','e','d'},
+    {'c','u','b','e','r'},
+    {'c','u','b','e','s'},
+    {'c','u','b','i','c'},
+    {'c','u','b','i','t'},
+    {'c','u','c','k','s'},
+    {'c','u','d','d','a'},
+    {'c','u','d','d','y'},
+    {'c','u','e','c','a'},
+    {'c','u','f','f','o'},
+    {'c','u','f','f','s'},
+    {'c','u','i','f','s'},
+    {'c','u','i','n','g'},
+    {'c','u','i','s','h'},
+    {'c','u','i','t','s'},
+    {'c','u','k','e','s'},
+    {'c','u','l','c','h'},
+    {'c','u','l','e','t'},
+    {'c','u','l','e','x'},
+    {'c','u','l','l','s'},
+    {'c','u','l','l','y'},
+    {'c','u','l','m','s'},
+    {'c','u','l','p','a'},
+    {'c','u','l','t','i'},
+    {'c','u','l','t','s'},
+    {'c','u','l','t','y'},
+    {'c','u','m','e','c'},
+    {'c','u','m','i','n'},
+    {'c','u','n','d','y'},
+    {'c','u','n','e','i'},
+    {'c','u','n','i','t'},
+    {'c','u','n','n','y'},
+    {'c','u','n','t','s'},
+    {'c','u','p','e','l'},
+    {'c','u','p','i','d'},
+    {'c','u','p','p','a'},
+    {'c','u','p','p','y'},
+    {'c','u','p','r','o'},
+    {'c','u','r','a','t'},
+    {'c','u','r','b','s'},
+    {'c','u','r','c','h'},
+    {'c','u','r','d','s'},
+    {'c','u','r','d','y'},
+    {'c','u','r','e','d'},
+    {'c','u','r','e','r'},
+    {'c','u','r','e','s'},
+    {'c','u','r','e','t'},
+    {'c','u','r','f','s'},
+    {'c','u','r','i','a'},
+    {'c','u','r','i','e'},
+    {'c','u','r','i','o'},
+    {'c','u','r','l','i'},
+    {'c','u','r','l','s'},
+    {'c','u','r','l','y'},
+    {'c','u','r','n','s'},
+    {'c','u','r','n','y'},
+    {'c','u','r','r','s'},
+    {'c','u','r','r','y'},
+    {'c','u','r','s','e'},
+    {'c','u','r','s','i'},
+    {'c','u','r','s','t'},
+    {'c','u','r','v','e'},
+    {'c','u','r','v','y'},
+    {'c','u','s','e','c'},
+    {'c','u','s','h','y'},
+    {'c','u','s','k','s'},
+    {'c','u','s','p','s'},
+    {'c','u','s','p','y'},
+    {'c','u','s','s','o'},
+    {'c','u','s','u','m'},
+    {'c','u','t','c','h'},
+    {'c','u','t','e','r'},
+    {'c','u','t','e','s'},
+    {'c','u','t','e','y'},
+    {'c','u','t','i','e'},
+    {'c','u','t','i','n'},
+    {'c','u','t','i','s'},
+    {'c','u','t','t','o'},
+    {'c','u','t','t','y'},
+    {'c','u','t','u','p'},
+    {'c','u','v','e','e'},
+    {'c','u','z','e','s'},
+    {'c','w','t','c','h'},
+    {'c','y','a','n','o'},
+    {'c','y','a','n','s'},
+    {'c','y','b','e','r'},
+    {'c','y','c','a','d'},
+    {'c','y','c','a','s'},
+    {'c','y','c','l','e'},
+    {'c','y','c','l','o'},
+    {'c','y','d','e','r'},
+    {'c','y','l','i','x'},
+    {'c','y','m','a','e'},
+    {'c','y','m','a','r'},
+    {'c','y','m','a','s'},
+    {'c','y','m','e','s'},
+    {'c','y','m','o','l'},
+    {'c','y','n','i','c'},
+    {'c','y','s','t','s'},
+    {'c','y','t','e','s'},
+    {'c','y','t','o','n'},
+    {'c','z','a','r','s'},
+    {'d','a','a','l','s'},
+    {'d','a','b','b','a'},
+    {'d','a','c','e','s'},
+    {'d','a','c','h','a'},
+    {'d','a','c','k','s'},
+    {'d','a','d','a','h'},
+    {'d','a','d','a','s'},
+    {'d','a','d','d','y'},
+    {'d','a','d','i','s'},
+    {'d','a','d','l','a'},
+    {'d','a','d','o','s'},
+    {'d','a','f','f','s'},
+    {'d','a','f','f','y'},
+    {'d','a','g','g','a'},
+    {'d','a','g','g','y'},
+    {'d','a','g','o','s'},
+    {'d','a','h','i','s'},
+    {'d','a','h','l','s'},
+    {'d','a','i','k','o'},
+    {'d','a','i','l','y'},
+    {'d','a','i','n','e'},
+    {'d','a','i','n','t'},
+    {'d','a','i','r','y'},
+    {'d','a','i','s','y'},
+    {'d','a','k','e','r'},
+    {'d','a','l','e','d'},
+    {'d','a','l','e','k'},
+    {'d','a','l','e','s'},
+    {'d','a','l','i','s'},
+    {'d','a','l','l','e'},
+    {'d','a','l','l','y'},
+    {'d','a','l','t','s'},
+    {'d','a','m','a','n'},
+    {'d','a','m','a','r'},
+    {'d','a','m','e','s'},
+    {'d','a','m','m','e'},
+    {'d','a','m','n','a'},
+    {'d','a','m','n','s'},
+    {'d','a','m','p','s'},
+    {'d','a','m','p','y'},
+    {'d','a','n','c','e'},
+    {'d','a','n','c','y'},
+    {'d','a','n','d','a'},
+    {'d','a','n','d','y'},
+    {'d','a','n','g','s'},
+    {'d','a','n','i','o'},
+    {'d','a','n','k','s'},
+    {'d','a','n','n','y'},
+    {'d','a','n','s','e'},
+    {'d','a','n','t','s'},
+    {'d','a','p','p','y'},
+    {'d','a','r','a','f'},
+    {'d','a','r','b','s'},
+    {'d','a','r','c','y'},
+    {'d','a','r','e','d'},
+    {'d','a','r','e','r'},
+    {'d','a','r','e','s'},
+    {'d','a','r','g','a'},
+    {'d','a','r','g','s'},
+    {'d','a','r','i','c'},
+    {'d','a','r','i','s'},
+    {'d','a','r','k','s'},
+    {'d','a','r','k','y'},
+    {'d','a','r','l','s'},
+    {'d','a','r','n','s'},
+    {'d','a','r','r','e'},
+    {'d','a','r','t','s'},
+    {'d','a','r','z','i'},
+    {'d','a','s','h','i'},
+    {'d','a','s','h','y'},
+    {'d','a','t','a','l'},
+    {'d','a','t','e','d'},
+    {'d','a','t','e','r'},
+    {'d','a','t','e','s'},
+    {'d','a','t','i','l'},
+    {'d','a','t','o','s'},
+    {'d','a','t','t','o'},
+    {'d','a','t','u','m'},
+    {'d','a','u','b','e'},
+    {'d','a','u','b','s'},
+    {'d','a','u','b','y'},
+    {'d','a','u','d','s'},
+    {'d','a','u','l','t'},
+    {'d','a','u','n','t'},
+    {'d','a','u','r','s'},
+    {'d','a','u','t','s'},
+    {'d','a','v','e','n'},
+    {'d','a','v','i','t'},
+    {'d','a','w','a','h'},
+    {'d','a','w','d','s'},
+    {'d','a','w','e','d'},
+    {'d','a','w','e','n'},
+    {'d','a','w','g','s'},
+    {'d','a','w','k','s'},
+    {'d','a','w','n','s'},
+    {'d','a','w','t','s'},
+    {'d','a','y','a','l'},
+    {'d','a','y','a','n'},
+    {'d','a','y','c','h'},
+    {'d','a','y','n','t'},
+    {'d','a','z','e','d'},
+    {'d','a','z','e','r'},
+    {'d','a','z','e','s'},
+    {'d','b','a','g','s'},
+    {'d','e','a','d','s'},
+    {'d','e','a','i','r'},
+    {'d','e','a','l','s'},
+    {'d','e','a','l','t'},
+    {'d','e','a','n','s'},
+    {'d','e','a','r','e'},
+    {'d','e','a','r','n'},
+    {'d','e','a','r','s'},
+    {'d','e','a','r','y'},
+    {'d','e','a','s','h'},
+    {'d','e','a','t','h'},
+    {'d','e','a','v','e'},
+    {'d','e','a','w','s'},
+    {'d','e','a','w','y'},
+    {'d','e','b','a','g'},
+    {'d','e','b','a','r'},
+    {'d','e','b','b','y'},
+    {'d','e','b','e','l'},
+    {'d','e','b','e','s'},
+    {'d','e','b','i','t'},
+    {'d','e','b','t','s'},
+    {'d','e','b','u','d'},
+    {'d','e','b','u','g'},
+    {'d','e','b','u','r'},
+    {'d','e','b','u','s'},
+    {'d','e','b','u','t'},
+    {'d','e','b','y','e'},
+    {'d','e','c','a','d'},
+    {'d','e','c','a','f'},
+    {'d','e','c','a','l'},
+    {'d','e','c','a','n'},
+    {'d','e','c','a','y'},
+    {'d','e','c','i','m'},
+    {'d','e','c','k','o'},
+    {'d','e','c','k','s'},
+    {'d','e','c','o','r'},
+    {'d','e','c','o','s'},
+    {'d','e','c','o','y'},
+    {'d','e','c','r','y'},
+    {'d','e','c','y','l'},
+    {'d','e','d','a','l'},
+    {'d','e','e','d','s'},
+    {'d','e','e','d','y'},
+    {'d','e','e','l','y'},
+    {'d','e','e','m','s'},
+    {'d','e','e','n','s'},
+    {'d','e','e','p','s'},
+    {'d','e','e','r','e'},
+    {'d','e','e','r','s'},
+    {'d','e','e','t','s'},
+    {'d','e','e','v','e'},
+    {'d','e','e','v','s'},
+    {'d','e','f','a','t'},
+    {'d','e','f','e','r'},
+    {'d','e','f','f','o'},
+    {'d','e','f','i','s'},
+    {'d','e','f','o','g'},
+    {'d','e','g','a','s'},
+    {'d','e','g','u','m'},
+    {'d','e','g','u','s'},
+    {'d','e','i','c','e'},
+    {'d','e','i','d','s'},
+    {'d','e','i','f','y'},
+    {'d','e','i','g','n'},
+    {'d','e','i','l','s'},
+    {'d','e','i','n','k'},
+    {'d','e','i','s','m'},
+    {'d','e','i','s','t'},
+    {'d','e','i','t','y'},
+    {'d','e','k','e','d'},
+    {'d','e','k','e','s'},
+    {'d','e','k','k','o'},
+    {'d','e','l','a','y'},
+    {'d','e','l','e','d'},
+    {'d','e','l','e','s'},
+    {'d','e','l','f','s'},
+    {'d','e','l','f','t'},
+    {'d','e','l','i','s'},
+    {'d','e','l','l','a'},
+    {'d','e','l','l','s'},
+    {'d','e','l','l','y'},
+    {'d','e','l','o','s'},
+    {'d','e','l','p','h'},
+    {'d','e','l','t','a'},
+    {'d','e','l','t','s'},
+    {'d','e','l','v','e'},
+    {'d','e','m','a','n'},
+    {'d','e','m','e','s'},
+    {'d','e','m','i','c'},
+    {'d','e','m','i','t'},
+    {'d','e','m','o','b'},
+    {'d','e','m','o','i'},
+    {'d','e','m','o','n'},
+    {'d','e','m','o','s'},
+    {'d','e','m','o','t'},
+    {'d','e','m','p','t'},
+    {'d','e','m','u','r'},
+    {'d','e','n','a','r'},
+    {'d','e','n','a','y'},
+    {'d','e','n','c','h'},
+    {'d','e','n','e','s'},
+    {'d','e','n','e','t'},
+    {'d','e','n','i','m'},
+    {'d','e','n','i','s'},
+    {'d','e','n','s','e'},
+    {'d','e','n','t','e'},
+    {'d','e','n','t','s'},
+    {'d','e','o','c','h'},
+    {'d','e','o','x','y'},
+    {'d','e','p','o','t'},
+    {'d','e','p','t','h'},
+    {'d','e','r','a','t'},
+    {'d','e','r','a','y'},
+    {'d','e','r','b','y'},
+    {'d','e','r','e','d'},
+    {'d','e','r','e','s'},
+    {'d','e','r','i','g'},
+    {'d','e','r','m','a'},
+    {'d','e','r','m','s'},
+    {'d','e','r','n','s'},
+    {'d','e','r','n','y'},
+    {'d','e','r','o','s'},
+    {'d','e','r','p','y'},
+    {'d','e','r','r','o'},
+    {'d','e','r','r','y'},
+    {'d','e','r','t','h'},
+    {'d','e','r','v','s'},
+    {'d','e','s','e','x'},
+    {'d','e','s','h','i'},
+    {'d','e','s','i','s'},
+    {'d','e','s','k','s'},
+    {'d','e','s','s','e'},
+    {'d','e','t','a','g'},
+    {'d','e','t','e','r'},
+    {'d','e','t','o','x'},
+    {'d','e','u','c','e'},
+    {'d','e','v','a','s'},
+    {'d','e','v','e','l'},
+    {'d','e','v','i','l'},
+    {'d','e','v','i','s'},
+    {'d','e','v','o','n'},
+    {'d','e','v','o','s'},
+    {'d','e','v','o','t'},
+    {'d','e','w','a','n'},
+    {'d','e','w','a','r'},
+    {'d','e','w','a','x'},
+    {'d','e','w','e','d'},
+    {'d','e','x','e','s'},
+    {'d','e','x','i','e'},
+    {'d','e','x','y','s'},
+    {'d','h','a','b','a'},
+    {'d','h','a','k','s'},
+    {'d','h','a','l','s'},
+    {'d','h','i','k','r'},
+    {'d','h','o','b','i'},
+    {'d','h','o','l','e'},
+    {'d','h','o','l','l'},
+    {'d','h','o','l','s'},
+    {'d','h','o','n','i'},
+    {'d','h','o','t','i'},
+    {'d','h','o','w','s'},
+    {'d','h','u','t','i'},
+    {'d','i','a','c','t'},
+    {'d','i','a','l','s'},
+    {'d','i','a','n','a'},
+    {'d','i','a','n','e'},
+    {'d','i','a','r','y'},
+    {'d','i','a','z','o'},
+    {'d','i','b','b','s'},
+    {'d','i','c','e','d'},
+    {'d','i','c','e','r'},
+    {'d','i','c','e','s'},
+    {'d','i','c','e','y'},
+    {'d','i','c','h','t'},
+    {'d','i','c','k','s'},
+    {'d','i','c','k','y'},
+    {'d','i','c','o','t'},
+    {'d','i','c','t','a'},
+    {'d','i','c','t','o'},
+    {'d','i','c','t','s'},
+    {'d','i','c','t','u'},
+    {'d','i','c','t','y'},
+    {'d','i','d','d','y'},
+    {'d','i','d','i','e'},
+    {'d','i','d','i','s'},
+    {'d','i','d','o','s'},
+    {'d','i','d','s','t'},
+    {'d','i','e','b','s'},
+    {'d','i','e','l','s'},
+    {'d','i','e','n','e'},
+    {'d','i','e','t','s'},
+    {'d','i','f','f','s'},
+    {'d','i','g','h','t'},
+    {'d','i','g','i','t'},
+    {'d','i','k','a','s'},
+    {'d','i','k','e','d'},
+    {'d','i','k','e','r'},
+    {'d','i','k','e','s'},
+    {'d','i','k','e','y'},
+    {'d','i','l','d','o'},
+    {'d','i','l','l','i'},
+    {'d','i','l','l','s'},
+    {'d','i','l','l','y'},
+    {'d','i','m','b','o'},
+    {'d','i','m','e','r'},
+    {'d','i','m','e','s'},
+    {'d','i','m','l','y'},
+    {'d','i','m','p','s'},
+    {'d','i','n','a','r'},
+    {'d','i','n','e','d'},
+    {'d','i','n','e','r'},
+    {'d','i','n','e','s'},
+    {'d','i','n','g','e'},
+    {'d','i','n','g','o'},
+    {'d','i','n','g','s'},
+    {'d','i','n','g','y'},
+    {'d','i','n','i','c'},
+    {'d','i','n','k','s'},
+    {'d','i','n','k','y'},
+    {'d','i','n','l','o'},
+    {'d','i','n','n','a'},
+    {'d','i','n','o','s'},
+    {'d','i','n','t','s'},
+    {'d','i','o','c','h'},
+    {'d','i','o','d','e'},
+    {'d','i','o','l','s'},
+    {'d','i','o','t','a'},
+    {'d','i','p','p','y'},
+    {'d','i','p','s','o'},
+    {'d','i','r','a','m'},
+    {'d','i','r','e','r'},
+    {'d','i','r','g','e'},
+    {'d','i','r','k','e'},
+    {'d','i','r','k','s'},
+    {'d','i','r','l','s'},
+    {'d','i','r','t','s'},
+    {'d','i','r','t','y'},
+    {'d','i','s','a','s'},
+    {'d','i','s','c','i'},
+    {'d','i','s','c','o'},
+    {'d','i','s','c','s'},
+    {'d','i','s','h','y'},
+    {'d','i','s','k','s'},
+    {'d','i','s','m','e'},
+    {'d','i','t','a','l'},
+    {'d','i','t','a','s'},
+    {'d','i','t','c','h'},
+    {'d','i','t','e','d'},
+    {'d','i','t','e','s'},
+    {'d','i','t','s','y'},
+    {'d','i','t','t','o'},
+    {'d','i','t','t','s'},
+    {'d','i','t','t','y'},
+    {'d','i','t','z','y'},
+    {'d','i','v','a','n'},
+    {'d','i','v','a','s'},
+    {'d','i','v','e','d'},
+    {'d','i','v','e','r'},
+    {'d','i','v','e','s'},
+    {'d','i','v','e','y'},
+    {'d','i','v','i','s'},
+    {'d','i','v','n','a'},
+    {'d','i','v','o','s'},
+    {'d','i','v','o','t'},
+    {'d','i','v','v','y'},
+    {'d','i','w','a','n'},
+    {'d','i','x','i','e'},
+    {'d','i','x','i','t'},
+    {'d','i','y','a','s'},
+    {'d','i','z','e','n'},
+    {'d','i','z','z','y'},
+    {'d','j','i','n','n'},
+    {'d','j','i','n','s'},
+    {'d','o','a','b','s'},
+    {'d','o','a','t','s'},
+    {'d','o','b','b','y'},
+    {'d','o','b','e','s'},
+    {'d','o','b','i','e'},
+    {'d','o','b','l','a'},
+    {'d','o','b','l','e'},
+    {'d','o','b','r','a'},
+    {'d','o','b','r','o'},
+    {'d','o','c','h','t'},
+    {'d','o','c','k','s'},
+    {'d','o','c','o','s'},
+    {'d','o','c','u','s'},
+    {'d','o','d','d','y'},
+    {'d','o','d','g','e'},
+    {'d','o','d','g','y'},
+    {'d','o','d','o','s'},
+    {'d','o','e','k','s'},
+    {'d','o','e','r','s'},
+    {'d','o','e','s','t'},
+    {'d','o','e','t','h'},
+    {'d','o','f','f','s'},
+    {'d','o','g','a','l'},
+    {'d','o','g','a','n'},
+    {'d','o','g','e','s'},
+    {'d','o','g','e','y'},
+    {'d','o','g','g','o'},
+    {'d','o','g','g','y'},
+    {'d','o','g','i','e'},
+    {'d','o','g','l','y'},
+    {'d','o','g','m','a'},
+    {'d','o','h','y','o'},
+    {'d','o','i','l','t'},
+    {'d','o','i','l','y'},
+    {'d','o','i','n','g'},
+    {'d','o','i','t','s'},
+    {'d','o','j','o','s'},
+    {'d','o','l','c','e'},
+    {'d','o','l','c','i'},
+    {'d','o','l','e','d'},
+    {'d','o','l','e','e'},
+    {'d','o','l','e','s'},
+    {'d','o','l','e','y'},
+    {'d','o','l','i','a'},
+    {'d','o','l','i','e'},
+    {'d','o','l','l','s'},
+    {'d','o','l','l','y'},
+    {'d','o','l','m','a'},
+    {'d','o','l','o','r'},
+    {'d','o','l','o','s'},
+    {'d','o','l','t','s'},
+    {'d','o','m','a','l'},
+    {'d','o','m','e','d'},
+    {'d','o','m','e','s'},
+    {'d','o','m','i','c'},
+    {'d','o','n','a','h'},
+    {'d','o','n','a','s'},
+    {'d','o','n','e','e'},
+    {'d','o','n','e','r'},
+    {'d','o','n','g','a'},
+    {'d','o','n','g','s'},
+    {'d','o','n','k','o'},
+    {'d','o','n','n','a'},
+    {'d','o','n','n','e'},
+    {'d','o','n','n','y'},
+    {'d','o','n','o','r'},
+    {'d','o','n','s','y'},
+    {'d','o','n','u','t'},
+    {'d','o','o','b','s'},
+    {'d','o','o','c','e'},
+    {'d','o','o','d','y'},
+    {'d','o','o','f','s'},
+    {'d','o','o','k','s'},
+    {'d','o','o','k','y'},
+    {'d','o','o','l','e'},
+    {'d','o','o','l','s'},
+    {'d','o','o','l','y'},
+    {'d','o','o','m','s'},
+    {'d','o','o','m','y'},
+    {'d','o','o','n','a'},
+    {'d','o','o','r','n'},
+    {'d','o','o','r','s'},
+    {'d','o','o','z','y'},
+    {'d','o','p','a','s'},
+    {'d','o','p','e','d'},
+    {'d','o','p','e','r'},
+    {'d','o','p','e','s'},
+    {'d','o','p','e','y'},
+    {'d','o','p','p','e'},
+    {'d','o','r','a','d'},
+    {'d','o','r','b','a'},
+    {'d','o','r','b','s'},
+    {'d','o','r','e','e'},
+    {'d','o','r','e','s'},
+    {'d','o','r','i','c'},
+    {'d','o','r','i','s'},
+    {'d','o','r','j','e'},
+    {'d','o','r','k','s'},
+    {'d','o','r','k','y'},
+    {'d','o','r','m','s'},
+    {'d','o','r','m','y'},
+    {'d','o','r','p','s'},
+    {'d','o','r','r','s'},
+    {'d','o','r','s','a'},
+    {'d','o','r','s','e'},
+    {'d','o','r','t','s'},
+    {'d','o','r','t','y'},
+    {'d','o','s','a','i'},
+    {'d','o','s','a','s'},
+    {'d','o','s','e','d'},
+    {'d','o','s','e','h'},
+    {'d','o','s','e','r'},
+    {'d','o','s','e','s'},
+    {'d','o','s','h','a'},
+    {'d','o','t','a','l'},
+    {'d','o','t','e','d'},
+    {'d','o','t','e','r'},
+    {'d','o','t','e','s'},
+    {'d','o','t','t','y'},
+    {'d','o','u','a','r'},
+    {'d','o','u','b','t'},
+    {'d','o','u','c','e'},
+    {'d','o','u','c','s'},
+    {'d','o','u','g','h'},
+    {'d','o','u','k','s'},
+    {'d','o','u','l','a'},
+    {'d','o','u','m','a'},
+    {'d','o','u','m','s'},
+    {'d','o','u','p','s'},
+    {'d','o','u','r','a'},
+    {'d','o','u','s','e'},
+    {'d','o','u','t','s'},
+    {'d','o','v','e','d'},
+    {'d','o','v','e','n'},
+    {'d','o','v','e','r'},
+    {'d','o','v','e','s'},
+    {'d','o','v','i','e'},
+    {'d','o','w','a','k'},
+    {'d','o','w','a','r'},
+    {'d','o','w','d','s'},
+    {'d','o','w','d','y'},
+    {'d','o','w','e','d'},
+    {'d','o','w','e','l'},
+    {'d','o','w','e','r'},
+    {'d','o','w','f','s'},
+    {'d','o','w','i','e'},
+    {'d','o','w','l','e'},
+    {'d','o','w','l','s'},
+    {'d','o','w','l','y'},
+    {'d','o','w','n','a'},
+    {'d','o','w','n','s'},
+    {'d','o','w','n','y'},
+    {'d','o','w','p','s'},
+    {'d','o','w','r','y'},
+    {'d','o','w','s','e'},
+    {'d','o','w','t','s'},
+    {'d','o','x','e','d'},
+    {'d','o','x','e','s'},
+    {'d','o','x','i','e'},
+    {'d','o','y','e','n'},
+    {'d','o','y','l','y'},
+    {'d','o','z','e','d'},
+    {'d','o','z','e','n'},
+    {'d','o','z','e','r'},
+    {'d','o','z','e','s'},
+    {'d','r','a','b','s'},
+    {'d','r','a','c','k'},
+    {'d','r','a','c','o'},
+    {'d','r','a','f','f'},
+    {'d','r','a','f','t'},
+    {'d','r','a','g','s'},
+    {'d','r','a','i','l'},
+    {'d','r','a','i','n'},
+    {'d','r','a','k','e'},
+    {'d','r','a','m','a'},
+    {'d','r','a','m','s'},
+    {'d','r','a','n','k'},
+    {'d','r','a','n','t'},
+    {'d','r','a','p','e'},
+    {'d','r','a','p','s'},
+    {'d','r','a','p','y'},
+    {'d','r','a','t','s'},
+    {'d','r','a','v','e'},
+    {'d','r','a','w','l'},
+    {'d','r','a','w','n'},
+    {'d','r','a','w','s'},
+    {'d','r','a','y','s'},
+    {'d','r','e','a','d'},
+    {'d','r','e','a','m'},
+    {'d','r','e','a','r'},
+    {'d','r','e','c','k'},
+    {'d','r','e','e','d'},
+    {'d','r','e','e','r'},
+    {'d','r','e','e','s'},
+    {'d','r','e','g','s'},
+    {'d','r','e','k','s'},
+    {'d','r','e','n','t'},
+    {'d','r','e','r','e'},
+    {'d','r','e','s','s'},
+    {'d','r','e','s','t'},
+    {'d','r','e','y','s'},
+    {'d','r','i','b','s'},
+    {'d','r','i','c','e'},
+    {'d','r','i','e','d'},
+    {'d','r','i','e','r'},
+    {'d','r','i','e','s'},
+    {'d','r','i','f','t'},
+    {'d','r','i','l','l'},
+    {'d','r','i','l','y'},
+    {'d','r','i','n','k'},
+    {'d','r','i','p','s'},
+    {'d','r','i','p','t'},
+    {'d','r','i','v','e'},
+    {'d','r','o','c','k'},
+    {'d','r','o','i','d'},
+    {'d','r','o','i','l'},
+    {'d','r','o','i','t'},
+    {'d','r','o','k','e'},
+    {'d','r','o','l','e'},
+    {'d','r','o','l','l'},
+    {'d','r','o','m','e'},
+    {'d','r','o','n','e'},
+    {'d','r','o','n','y'},
+    {'d','r','o','o','b'},
+    {'d','r','o','o','g'},
+    {'d','r','o','o','k'},
+    {'d','r','o','o','l'},
+    {'d','r','o','o','p'},
+    {'d','r','o','p','s'},
+    {'d','r','o','p','t'},
+    {'d','r','o','s','s'},
+    {'d','r','o','u','k'},
+    {'d','r','o','v','e'},
+    {'d','r','o','w','n'},
+    {'d','r','o','w','s'},
+    {'d','r','u','b','s'},
+    {'d','r','u','g','s'},
+    {'d','r','u','i','d'},
+    {'d','r','u','m','s'},
+    {'d','r','u','n','k'},
+    {'d','r','u','p','e'},
+    {'d','r','u','s','e'},
+    {'d','r','u','s','y'},
+    {'d','r','u','x','y'},
+    {'d','r','y','a','d'},
+    {'d','r','y','a','s'},
+    {'d','r','y','e','r'},
+    {'d','r','y','l','y'},
+    {'d','s','o','b','o'},
+    {'d','s','o','m','o'},
+    {'d','u','a','d','s'},
+    {'d','u','a','l','s'},
+    {'d','u','a','n','s'},
+    {'d','u','a','r','s'},
+    {'d','u','b','b','o'},
+    {'d','u','b','b','y'},
+    {'d','u','c','a','l'},
+    {'d','u','c','a','t'},
+    {'d','u','c','e','s'},
+    {'d','u','c','h','y'},
+    {'d','u','c','k','s'},
+    {'d','u','c','k','y'},
+    {'d','u','c','t','i'},
+    {'d','u','c','t','s'},
+    {'d','u','d','d','y'},
+    {'d','u','d','e','d'},
+    {'d','u','d','e','s'},
+    {'d','u','e','l','s'},
+    {'d','u','e','t','s'},
+    {'d','u','e','t','t'},
+    {'d','u','f','f','s'},
+    {'d','u','f','u','s'},
+    {'d','u','i','n','g'},
+    {'d','u','i','t','s'},
+    {'d','u','k','a','s'},
+    {'d','u','k','e','d'},
+    {'d','u','k','e','s'},
+    {'d','u','k','k','a'},
+    {'d','u','k','u','n'},
+    {'d','u','l','c','e'},
+    {'d','u','l','e','s'},
+    {'d','u','l','i','a'},
+    {'d','u','l','l','s'},
+    {'d','u','l','l','y'},
+    {'d','u','l','s','e'},
+    {'d','u','m','a','s'},
+    {'d','u','m','b','o'},
+    {'d','u','m','b','s'},
+    {'d','u','m','k','a'},
+    {'d','u','m','k','y'},
+    {'d','u','m','m','y'},
+    {'d','u','m','p','s'},
+    {'d','u','m','p','y'},
+    {'d','u','n','a','m'},
+    {'d','u','n','c','e'},
+    {'d','u','n','c','h'},
+    {'d','u','n','e','s'},
+    {'d','u','n','g','s'},
+    {'d','u','n','g','y'},
+    {'d','u','n','k','s'},
+    {'d','u','n','n','o'},
+    {'d','u','n','n','y'},
+    {'d','u','n','s','h'},
+    {'d','u','n','t','s'},
+    {'d','u','o','m','i'},
+    {'d','u','o','m','o'},
+    {'d','u','p','e','d'},
+    {'d','u','p','e','r'},
+    {'d','u','p','e','s'},
+    {'d','u','p','l','e'},
+    {'d','u','p','l','y'},
+    {'d','u','p','p','y'},
+    {'d','u','r','a','l'},
+    {'d','u','r','a','s'},
+    {'d','u','r','e','d'},
+    {'d','u','r','e','s'},
+    {'d','u','r','g','y'},
+    {'d','u','r','n','s'},
+    {'d','u','r','o','c'},
+    {'d','u','r','o','s'},
+    {'d','u','r','o','y'},
+    {'d','u','r','r','a'},
+    {'d','u','r','r','s'},
+    {'d','u','r','r','y'},
+    {'d','u','r','s','t'},
+    {'d','u','r','u','m'},
+    {'d','u','r','z','i'},
+    {'d','u','s','k','s'},
+    {'d','u','s','k','y'},
+    {'d','u','s','t','s'},
+    {'d','u','s','t','y'},
+    {'d','u','t','c','h'},
+    {'d','u','v','e','t'},
+    {'d','u','x','e','s'},
+    {'d','w','a','a','l'},
+    {'d','w','a','l','e'},
+    {'d','w','a','l','m'},
+    {'d','w','a','m','s'},
+    {'d','w','a','m','y'},
+    {'d','w','a','n','g'},
+    {'d','w','a','r','f'},
+    {'d','w','a','u','m'},
+    {'d','w','e','e','b'},
+    {'d','w','e','l','l'},
+    {'d','w','e','l','t'},
+    {'d','w','i','l','e'},
+    {'d','w','i','n','e'},
+    {'d','y','a','d','s'},
+    {'d','y','e','r','s'},
+    {'d','y','i','n','g'},
+    {'d','y','k','e','d'},
+    {'d','y','k','e','s'},
+    {'d','y','k','e','y'},
+    {'d','y','k','o','n'},
+    {'d','y','n','e','l'},
+    {'d','y','n','e','s'},
+    {'d','y','n','o','s'},
+    {'d','z','h','o','s'},
+    {'e','a','g','e','r'},
+    {'e','a','g','l','e'},
+    {'e','a','g','l','y'},
+    {'e','a','g','r','e'},
+    {'e','a','l','e','d'},
+    {'e','a','l','e','s'},
+    {'e','a','n','e','d'},
+    {'e','a','r','d','s'},
+    {'e','a','r','e','d'},
+    {'e','a','r','l','s'},
+    {'e','a','r','l','y'},
+    {'e','a','r','n','s'},
+    {'e','a','r','n','t'},
+    {'e','a','r','s','t'},
+    {'e','a','r','t','h'},
+    {'e','a','s','e','d'},
+    {'e','a','s','e','l'},
+    {'e','a','s','e','r'},
+    {'e','a','s','e','s'},
+    {'e','a','s','l','e'},
+    {'e','a','s','t','s'},
+    {'e','a','t','e','n'},
+    {'e','a','t','e','r'},
+    {'e','a','t','h','e'},
+    {'e','a','t','i','n'},
+    {'e','a','v','e','d'},
+    {'e','a','v','e','r'},
+    {'e','a','v','e','s'},
+    {'e','b','a','n','k'},
+    {'e','b','b','e','d'},
+    {'e','b','b','e','t'},
+    {'e','b','e','n','a'},
+    {'e','b','e','n','e'},
+    {'e','b','i','k','e'},
+    {'e','b','o','n','s'},
+    {'e','b','o','n','y'},
+    {'e','b','o','o','k'},
+    {'e','c','a','d','s'},
+    {'e','c','a','r','d'},
+    {'e','c','a','s','h'},
+    {'e','c','h','e','d'},
+    {'e','c','h','e','s'},
+    {'e','c','h','o','s'},
+    {'e','c','i','g','s'},
+    {'e','c','l','a','t'},
+    {'e','c','o','l','e'},
+    {'e','c','r','u','s'},
+    {'e','d','e','m','a'},
+    {'e','d','g','e','d'},
+    {'e','d','g','e','r'},
+    {'e','d','g','e','s'},
+    {'e','d','i','c','t'},
+    {'e','d','i','f','y'},
+    {'e','d','i','l','e'},
+    {'e','d','i','t','s'},
+    {'e','d','u','c','e'},
+    {'e','d','u','c','t'},
+    {'e','e','j','i','t'},
+    {'e','e','n','s','y'},
+    {'e','e','r','i','e'},
+    {'e','e','v','e','n'},
+    {'e','e','v','e','r'},
+    {'e','e','v','n','s'},
+    {'e','f','f','e','d'},
+    {'e','f','f','e','r'},
+    {'e','f','i','t','s'},
+    {'e','g','a','d','s'},
+    {'e','g','e','r','s'},
+    {'e','g','e','s','t'},
+    {'e','g','g','a','r'},
+    {'e','g','g','e','d'},
+    {'e','g','g','e','r'},
+    {'e','g','m','a','s'},
+    {'e','g','r','e','t'},
+    {'e','h','i','n','g'},
+    {'e','i','d','e','r'},
+    {'e','i','d','o','s'},
+    {'e','i','g','h','t'},
+    {'e','i','g','n','e'},
+    {'e','i','k','e','d'},
+    {'e','i','k','o','n'},
+    {'e','i','l','d','s'},
+    {'e','i','r','o','n'},
+    {'e','i','s','e','l'},
+    {'e','j','e','c','t'},
+    {'e','j','i','d','o'},
+    {'e','k','d','a','m'},
+    {'e','k','i','n','g'},
+    {'e','k','k','a','s'},
+    {'e','l','a','i','n'},
+    {'e','l','a','n','d'},
+    {'e','l','a','n','s'},
+    {'e','l','a','t','e'},
+    {'e','l','b','o','w'},
+    {'e','l','c','h','i'},
+    {'e','l','d','e','r'},
+    {'e','l','d','i','n'},
+    {'e','l','e','c','t'},
+    {'e','l','e','e','t'},
+    {'e','l','e','g','y'},
+    {'e','l','e','m','i'},
+    {'e','l','f','e','d'},
+    {'e','l','f','i','n'},
+    {'e','l','i','a','d'},
+    {'e','l','i','d','e'},
+    {'e','l','i','n','t'},
+    {'e','l','i','t','e'},
+    {'e','l','m','e','n'},
+    {'e','l','o','g','e'},
+    {'e','l','o','g','y'},
+    {'e','l','o','i','n'},
+    {'e','l','o','p','e'},
+    {'e','l','o','p','s'},
+    {'e','l','p','e','e'},
+    {'e','l','s','i','n'},
+    {'e','l','u','d','e'},
+    {'e','l','u','t','e'},
+    {'e','l','v','a','n'},
+    {'e','l','v','e','n'},
+    {'e','l','v','e','r'},
+    {'e','l','v','e','s'},
+    {'e','m','a','c','s'},
+    {'e','m','a','i','l'},
+    {'e','m','b','a','r'},
+    {'e','m','b','a','y'},
+    {'e','m','b','e','d'},
+    {'e','m','b','e','r'},
+    {'e','m','b','o','g'},
+    {'e','m','b','o','w'},
+    {'e','m','b','o','x'},
+    {'e','m','b','u','s'},
+    {'e','m','c','e','e'},
+    {'e','m','e','e','r'},
+    {'e','m','e','n','d'},
+    {'e','m','e','r','g'},
+    {'e','m','e','r','y'},
+    {'e','m','e','u','s'},
+    {'e','m','i','c','s'},
+    {'e','m','i','r','s'},
+    {'e','m','i','t','s'},
+    {'e','m','m','a','s'},
+    {'e','m','m','e','r'},
+    {'e','m','m','e','t'},
+    {'e','m','m','e','w'},
+    {'e','m','m','y','s'},
+    {'e','m','o','j','i'},
+    {'e','m','o','n','g'},
+    {'e','m','o','t','e'},
+    {'e','m','o','v','e'},
+    {'e','m','p','t','s'},
+    {'e','m','p','t','y'},
+    {'e','m','u','l','e'},
+    {'e','m','u','r','e'},
+    {'e','m','y','d','e'},
+    {'e','m','y','d','s'},
+    {'e','n','a','c','t'},
+    {'e','n','a','r','m'},
+    {'e','n','a','t','e'},
+    {'e','n','d','e','d'},
+    {'e','n','d','e','r'},
+    {'e','n','d','e','w'},
+    {'e','n','d','o','w'},
+    {'e','n','d','u','e'},
+    {'e','n','e','m','a'},
+    {'e','n','e','m','y'},
+    {'e','n','e','w','s'},
+    {'e','n','f','i','x'},
+    {'e','n','i','a','c'},
+    {'e','n','j','o','y'},
+    {'e','n','l','i','t'},
+    {'e','n','m','e','w'},
+    {'e','n','n','o','g'},
+    {'e','n','n','u','i'},
+    {'e','n','o','k','i'},
+    {'e','n','o','l','s'},
+    {'e','n','o','r','m'},
+    {'e','n','o','w','s'},
+    {'e','n','r','o','l'},
+    {'e','n','s','e','w'},
+    {'e','n','s','k','y'},
+    {'e','n','s','u','e'},
+    {'e','n','t','e','r'},
+    {'e','n','t','i','a'},
+    {'e','n','t','r','e'},
+    {'e','n','t','r','y'},
+    {'e','n','u','r','e'},
+    {'e','n','u','r','n'},
+    {'e','n','v','o','i'},
+    {'e','n','v','o','y'},
+    {'e','n','z','y','m'},
+    {'e','o','l','i','d'},
+    {'e','o','r','l','s'},
+    {'e','o','s','i','n'},
+    {'e','p','a','c','t'},
+    {'e','p','e','e','s'},
+    {'e','p','e','n','a'},
+    {'e','p','e','n','e'},
+    {'e','p','h','a','h'},
+    {'e','p','h','a','s'},
+    {'e','p','h','o','d'},
+    {'e','p','h','o','r'},
+    {'e','p','i','c','s'},
+    {'e','p','o','c','h'},
+    {'e','p','o','d','e'},
+    {'e','p','o','p','t'},
+    {'e','p','o','x','y'},
+    {'e','p','p','i','e'},
+    {'e','p','r','i','s'},
+    {'e','q','u','a','l'},
+    {'e','q','u','e','s'},
+    {'e','q','u','i','d'},
+    {'e','q','u','i','p'},
+    {'e','r','a','s','e'},
+    {'e','r','b','i','a'},
+    {'e','r','e','c','t'},
+    {'e','r','e','v','s'},
+    {'e','r','g','o','n'},
+    {'e','r','g','o','s'},
+    {'e','r','g','o','t'},
+    {'e','r','h','u','s'},
+    {'e','r','i','c','a'},
+    {'e','r','i','c','k'},
+    {'e','r','i','c','s'},
+    {'e','r','i','n','g'},
+    {'e','r','n','e','d'},
+    {'e','r','n','e','s'},
+    {'e','r','o','d','e'},
+    {'e','r','o','s','e'},
+    {'e','r','r','e','d'},
+    {'e','r','r','o','r'},
+    {'e','r','s','e','s'},
+    {'e','r','u','c','t'},
+    {'e','r','u','g','o'},
+    {'e','r','u','p','t'},
+    {'e','r','u','v','s'},
+    {'e','r','v','e','n'},
+    {'e','r','v','i','l'},
+    {'e','s','c','a','r'},
+    {'e','s','c','o','t'},
+    {'e','s','i','l','e'},
+    {'e','s','k','a','r'},
+    {'e','s','k','e','r'},
+    {'e','s','n','e','s'},
+    {'e','s','r','o','g'},
+    {'e','s','s','a','y'},
+    {'e','s','s','e','s'},
+    {'e','s','t','e','r'},
+    {'e','s','t','o','c'},
+    {'e','s','t','o','p'},
+    {'e','s','t','r','o'},
+    {'e','t','a','g','e'},
+    {'e','t','a','p','e'},
+    {'e','t','a','t','s'},
+    {'e','t','e','n','s'},
+    {'e','t','h','a','l'},
+    {'e','t','h','e','r'},
+    {'e','t','h','i','c'},
+    {'e','t','h','n','e'},
+    {'e','t','h','o','s'},
+    {'e','t','h','y','l'},
+    {'e','t','i','c','s'},
+    {'e','t','n','a','s'},
+    {'e','t','r','o','g'},
+    {'e','t','t','i','n'},
+    {'e','t','t','l','e'},
+    {'e','t','u','d','e'},
+    {'e','t','u','i','s'},
+    {'e','t','w','e','e'},
+    {'e','t','y','m','a'},
+    {'e','u','g','h','s'},
+    {'e','u','k','e','d'},
+    {'e','u','p','a','d'},
+    {'e','u','r','o','s'},
+    {'e','u','s','o','l'},
+    {'e','v','a','d','e'},
+    {'e','v','e','g','s'},
+    {'e','v','e','n','s'},
+    {'e','v','e','n','t'},
+    {'e','v','e','r','t'},
+    {'e','v','e','r','y'},
+    {'e','v','e','t','s'},
+    {'e','v','h','o','e'},
+    {'e','v','i','c','t'},
+    {'e','v','i','l','s'},
+    {'e','v','i','t','e'},
+    {'e','v','o','h','e'},
+    {'e','v','o','k','e'},
+    {'e','w','e','r','s'},
+    {'e','w','e','s','t'},
+    {'e','w','h','o','w'},
+    {'e','w','k','e','d'},
+    {'e','x','a','c','t'},
+    {'e','x','a','l','t'},
+    {'e','x','a','m','s'},
+    {'e','x','c','e','l'},
+    {'e','x','e','a','t'},
+    {'e','x','e','c','s'},
+    {'e','x','e','e','m'},
+    {'e','x','e','m','e'},
+    {'e','x','e','r','t'},
+    {'e','x','f','i','l'},
+    {'e','x','i','e','r'},
+    {'e','x','i','e','s'},
+    {'e','x','i','l','e'},
+    {'e','x','i','n','e'},
+    {'e','x','i','n','g'},
+    {'e','x','i','s','t'},
+    {'e','x','i','t','e'},
+    {'e','x','i','t','s'},
+    {'e','x','o','d','e'},
+    {'e','x','o','m','e'},
+    {'e','x','o','n','s'},
+    {'e','x','p','a','t'},
+    {'e','x','p','e','l'},
+    {'e','x','p','o','s'},
+    {'e','x','t','o','l'},
+    {'e','x','t','r','a'},
+    {'e','x','u','d','e'},
+    {'e','x','u','l','s'},
+    {'e','x','u','l','t'},
+    {'e','x','u','r','b'},
+    {'e','y','a','s','s'},
+    {'e','y','e','r','s'},
+    {'e','y','i','n','g'},
+    {'e','y','o','t','s'},
+    {'e','y','r','a','s'},
+    {'e','y','r','e','s'},
+    {'e','y','r','i','e'},
+    {'e','y','r','i','r'},
+    {'e','z','i','n','e'},
+    {'f','a','b','b','o'},
+    {'f','a','b','b','y'},
+    {'f','a','b','l','e'},
+    {'f','a','c','e','d'},
+    {'f','a','c','e','r'},
+    {'f','a','c','e','s'},
+    {'f','a','c','e','t'},
+    {'f','a','c','e','y'},
+    {'f','a','c','i','a'},
+    {'f','a','c','i','e'},
+    {'f','a','c','t','a'},
+    {'f','a','c','t','o'},
+    {'f','a','c','t','s'},
+    {'f','a','c','t','y'},
+    {'f','a','d','d','y'},
+    {'f','a','d','e','d'},
+    {'f','a','d','e','r'},
+    {'f','a','d','e','s'},
+    {'f','a','d','g','e'},
+    {'f','a','d','o','s'},
+    {'f','a','e','n','a'},
+    {'f','a','e','r','y'},
+    {'f','a','f','f','s'},
+    {'f','a','f','f','y'},
+    {'f','a','g','g','y'},
+    {'f','a','g','i','n'},
+    {'f','a','g','o','t'},
+    {'f','a','i','k','s'},
+    {'f','a','i','l','s'},
+    {'f','a','i','n','e'},
+    {'f','a','i','n','s'},
+    {'f','a','i','n','t'},
+    {'f','a','i','r','e'},
+    {'f','a','i','r','s'},
+    {'f','a','i','r','y'},
+    {'f','a','i','t','h'},
+    {'f','a','k','e','d'},
+    {'f','a','k','e','r'},
+    {'f','a','k','e','s'},
+    {'f','a','k','e','y'},
+    {'f','a','k','i','e'},
+    {'f','a','k','i','r'},
+    {'f','a','l','a','j'},
+    {'f','a','l','e','s'},
+    {'f','a','l','l','s'},
+    {'f','a','l','s','e'},
+    {'f','a','l','s','y'},
+    {'f','a','m','e','d'},
+    {'f','a','m','e','s'},
+    {'f','a','n','a','l'},
+    {'f','a','n','c','y'},
+    {'f','a','n','d','s'},
+    {'f','a','n','e','s'},
+    {'f','a','n','g','a'},
+    {'f','a','n','g','o'},
+    {'f','a','n','g','s'},
+    {'f','a','n','k','s'},
+    {'f','a','n','n','y'},
+    {'f','a','n','o','n'},
+    {'f','a','n','o','s'},
+    {'f','a','n','u','m'},
+    {'f','a','q','i','r'},
+    {'f','a','r','a','d'},
+    {'f','a','r','c','e'},
+    {'f','a','r','c','i'},
+    {'f','a','r','c','y'},
+    {'f','a','r','d','s'},
+    {'f','a','r','e','d'},
+    {'f','a','r','e','r'},
+    {'f','a','r','e','s'},
+    {'f','a','r','l','e'},
+    {'f','a','r','l','s'},
+    {'f','a','r','m','s'},
+    {'f','a','r','o','s'},
+    {'f','a','r','r','o'},
+    {'f','a','r','s','e'},
+    {'f','a','r','t','s'},
+    {'f','a','s','c','i'},
+    {'f','a','s','t','i'},
+    {'f','a','s','t','s'},
+    {'f','a','t','a','l'},
+    {'f','a','t','e','d'},
+    {'f','a','t','e','s'},
+    {'f','a','t','l','y'},
+    {'f','a','t','s','o'},
+    {'f','a','t','t','y'},
+    {'f','a','t','w','a'},
+    {'f','a','u','c','h'},
+    {'f','a','u','g','h'},
+    {'f','a','u','l','d'},
+    {'f','a','u','l','t'},
+    {'f','a','u','n','a'},
+    {'f','a','u','n','s'},
+    {'f','a','u','r','d'},
+    {'f','a','u','t','e'},
+    {'f','a','u','t','s'},
+    {'f','a','u','v','e'},
+    {'f','a','v','a','s'},
+    {'f','a','v','e','l'},
+    {'f','a','v','e','r'},
+    {'f','a','v','e','s'},
+    {'f','a','v','o','r'},
+    {'f','a','v','u','s'},
+    {'f','a','w','n','s'},
+    {'f','a','w','n','y'},
+    {'f','a','x','e','d'},
+    {'f','a','x','e','s'},
+    {'f','a','y','e','d'},
+    {'f','a','y','e','r'},
+    {'f','a','y','n','e'},
+    {'f','a','y','r','e'},
+    {'f','a','z','e','d'},
+    {'f','a','z','e','s'},
+    {'f','e','a','l','s'},
+    {'f','e','a','r','d'},
+    {'f','e','a','r','e'},
+    {'f','e','a','r','s'},
+    {'f','e','a','r','t'},
+    {'f','e','a','s','e'},
+    {'f','e','a','s','t'},
+    {'f','e','a','t','s'},
+    {'f','e','a','z','e'},
+    {'f','e','c','a','l'},
+    {'f','e','c','e','s'},
+    {'f','e','c','h','t'},
+    {'f','e','c','i','t'},
+    {'f','e','c','k','s'},
+    {'f','e','d','a','i'},
+    {'f','e','d','e','x'},
+    {'f','e','e','b','s'},
+    {'f','e','e','d','s'},
+    {'f','e','e','l','s'},
+    {'f','e','e','l','y'},
+    {'f','e','e','n','s'},
+    {'f','e','e','r','s'},
+    {'f','e','e','s','e'},
+    {'f','e','e','z','e'},
+    {'f','e','h','m','e'},
+    {'f','e','i','g','n'},
+    {'f','e','i','n','t'},
+    {'f','e','i','s','t'},
+    {'f','e','l','c','h'},
+    {'f','e','l','i','d'},
+    {'f','e','l','i','x'},
+    {'f','e','l','l','a'},
+    {'f','e','l','l','s'},
+    {'f','e','l','l','y'},
+    {'f','e','l','o','n'},
+    {'f','e','l','t','s'},
+    {'f','e','l','t','y'},
+    {'f','e','m','a','l'},
+    {'f','e','m','e','s'},
+    {'f','e','m','i','c'},
+    {'f','e','m','m','e'},
+    {'f','e','m','m','y'},
+    {'f','e','m','u','r'},
+    {'f','e','n','c','e'},
+    {'f','e','n','d','s'},
+    {'f','e','n','d','y'},
+    {'f','e','n','i','s'},
+    {'f','e','n','k','s'},
+    {'f','e','n','n','y'},
+    {'f','e','n','t','s'},
+    {'f','e','o','d','s'},
+    {'f','e','o','f','f'},
+    {'f','e','r','a','l'},
+    {'f','e','r','e','r'},
+    {'f','e','r','e','s'},
+    {'f','e','r','i','a'},
+    {'f','e','r','l','y'},
+    {'f','e','r','m','i'},
+    {'f','e','r','m','s'},
+    {'f','e','r','n','s'},
+    {'f','e','r','n','y'},
+    {'f','e','r','o','x'},
+    {'f','e','r','r','y'},
+    {'f','e','s','s','e'},
+    {'f','e','s','t','a'},
+    {'f','e','s','t','s'},
+    {'f','e','s','t','y'},
+    {'f','e','t','a','l'},
+    {'f','e','t','a','s'},
+    {'f','e','t','c','h'},
+    {'f','e','t','e','d'},
+    {'f','e','t','e','s'},
+    {'f','e','t','i','d'},
+    {'f','e','t','o','r'},
+    {'f','e','t','t','a'},
+    {'f','e','t','t','s'},
+    {'f','e','t','u','s'},
+    {'f','e','t','w','a'},
+    {'f','e','u','a','r'},
+    {'f','e','u','d','s'},
+    {'f','e','u','e','d'},
+    {'f','e','v','e','r'},
+    {'f','e','w','e','r'},
+    {'f','e','y','e','d'},
+    {'f','e','y','e','r'},
+    {'f','e','y','l','y'},
+    {'f','e','z','e','s'},
+    {'f','e','z','z','y'},
+    {'f','i','a','r','s'},
+    {'f','i','a','t','s'},
+    {'f','i','b','e','r'},
+    {'f','i','b','r','e'},
+    {'f','i','b','r','o'},
+    {'f','i','c','e','s'},
+    {'f','i','c','h','e'},
+    {'f','i','c','h','u'},
+    {'f','i','c','i','n'},
+    {'f','i','c','o','s'},
+    {'f','i','c','t','a'},
+    {'f','i','c','u','s'},
+    {'f','i','d','e','s'},
+    {'f','i','d','g','e'},
+    {'f','i','d','o','s'},
+    {'f','i','d','u','s'},
+    {'f','i','e','f','s'},
+    {'f','i','e','l','d'},
+    {'f','i','e','n','d'},
+    {'f','i','e','n','t'},
+    {'f','i','e','r','e'},
+    {'f','i','e','r','i'},
+    {'f','i','e','r','s'},
+    {'f','i','e','r','y'},
+    {'f','i','e','s','t'},
+    {'f','i','f','e','d'},
+    {'f','i','f','e','r'},
+    {'f','i','f','e','s'},
+    {'f','i','f','i','s'},
+    {'f','i','f','t','h'},
+    {'f','i','f','t','y'},
+    {'f','i','g','g','y'},
+    {'f','i','g','h','t'},
+    {'f','i','g','o','s'},
+    {'f','i','k','e','d'},
+    {'f','i','k','e','s'},
+    {'f','i','l','a','r'},
+    {'f','i','l','c','h'},
+    {'f','i','l','e','d'},
+    {'f','i','l','e','r'},
+    {'f','i','l','e','s'},
+    {'f','i','l','e','t'},
+    {'f','i','l','i','i'},
+    {'f','i','l','k','s'},
+    {'f','i','l','l','e'},
+    {'f','i','l','l','o'},
+    {'f','i','l','l','s'},
+    {'f','i','l','l','y'},
+    {'f','i','l','m','i'},
+    {'f','i','l','m','s'},
+    {'f','i','l','m','y'},
+    {'f','i','l','o','n'},
+    {'f','i','l','o','s'},
+    {'f','i','l','t','h'},
+    {'f','i','l','u','m'},
+    {'f','i','n','a','l'},
+    {'f','i','n','c','a'},
+    {'f','i','n','c','h'},
+    {'f','i','n','d','s'},
+    {'f','i','n','e','d'},
+    {'f','i','n','e','r'},
+    {'f','i','n','e','s'},
+    {'f','i','n','i','s'},
+    {'f','i','n','k','s'},
+    {'f','i','n','n','y'},
+    {'f','i','n','o','s'},
+    {'f','i','o','r','d'},
+    {'f','i','q','h','s'},
+    {'f','i','q','u','e'},
+    {'f','i','r','e','d'},
+    {'f','i','r','e','r'},
+    {'f','i','r','e','s'},
+    {'f','i','r','i','e'},
+    {'f','i','r','k','s'},
+    {'f','i','r','m','a'},
+    {'f','i','r','m','s'},
+    {'f','i','r','n','i'},
+    {'f','i','r','n','s'},
+    {'f','i','r','r','y'},
+    {'f','i','r','s','t'},
+    {'f','i','r','t','h'},
+    {'f','i','s','c','s'},
+    {'f','i','s','h','o'},
+    {'f','i','s','h','y'},
+    {'f','i','s','k','s'},
+    {'f','i','s','t','s'},
+    {'f','i','s','t','y'},
+    {'f','i','t','c','h'},
+    {'f','i','t','l','y'},
+    {'f','i','t','n','a'},
+    {'f','i','t','t','e'},
+    {'f','i','t','t','s'},
+    {'f','i','v','e','r'},
+    {'f','i','v','e','s'},
+    {'f','i','x','e','d'},
+    {'f','i','x','e','r'},
+    {'f','i','x','e','s'},
+    {'f','i','x','i','e'},
+    {'f','i','x','i','t'},
+    {'f','i','z','z','y'},
+    {'f','j','e','l','d'},
+    {'f','j','o','r','d'},
+    {'f','l','a','b','s'},
+    {'f','l','a','c','k'},
+    {'f','l','a','f','f'},
+    {'f','l','a','g','s'},
+    {'f','l','a','i','l'},
+    {'f','l','a','i','r'},
+    {'f','l','a','k','e'},
+    {'f','l','a','k','s'},
+    {'f','l','a','k','y'},
+    {'f','l','a','m','e'},
+    {'f','l','a','m','m'},
+    {'f','l','a','m','s'},
+    {'f','l','a','m','y'},
+    {'f','l','a','n','e'},
+    {'f','l','a','n','k'},
+    {'f','l','a','n','s'},
+    {'f','l','a','p','s'},
+    {'f','l','a','r','e'},
+    {'f','l','a','r','y'},
+    {'f','l','a','s','h'},
+    {'f','l','a','s','k'},
+    {'f','l','a','t','s'},
+    {'f','l','a','v','a'},
+    {'f','l','a','w','n'},
+    {'f','l','a','w','s'},
+    {'f','l','a','w','y'},
+    {'f','l','a','x','y'},
+    {'f','l','a','y','s'},
+    {'f','l','e','a','m'},
+    {'f','l','e','a','s'},
+    {'f','l','e','c','k'},
+    {'f','l','e','e','k'},
+    {'f','l','e','e','r'},
+    {'f','l','e','e','s'},
+    {'f','l','e','e','t'},
+    {'f','l','e','g','s'},
+    {'f','l','e','m','e'},
+    {'f','l','e','s','h'},
+    {'f','l','e','u','r'},
+    {'f','l','e','w','s'},
+    {'f','l','e','x','i'},
+    {'f','l','e','x','o'},
+    {'f','l','e','y','s'},
+    {'f','l','i','c','k'},
+    {'f','l','i','c','s'},
+    {'f','l','i','e','d'},
+    {'f','l','i','e','r'},
+    {'f','l','i','e','s'},
+    {'f','l','i','m','p'},
+    {'f','l','i','m','s'},
+    {'f','l','i','n','g'},
+    {'f','l','i','n','t'},
+    {'f','l','i','p','s'},
+    {'f','l','i','r','s'},
+    {'f','l','i','r','t'},
+    {'f','l','i','s','k'},
+    {'f','l','i','t','e'},
+    {'f','l','i','t','s'},
+    {'f','l','i','t','t'},
+    {'f','l','o','a','t'},
+    {'f','l','o','b','s'},
+    {'f','l','o','c','k'},
+    {'f','l','o','c','s'},
+    {'f','l','o','e','s'},
+    {'f','l','o','g','s'},
+    {'f','l','o','n','g'},
+    {'f','l','o','o','d'},
+    {'f','l','o','o','r'},
+    {'f','l','o','p','s'},
+    {'f','l','o','r','a'},
+    {'f','l','o','r','e'},
+    {'f','l','o','r','s'},
+    {'f','l','o','r','y'},
+    {'f','l','o','s','h'},
+    {'f','l','o','s','s'},
+    {'f','l','o','t','a'},
+    {'f','l','o','t','e'},
+    {'f','l','o','u','r'},
+    {'f','l','o','u','t'},
+    {'f','l','o','w','n'},
+    {'f','l','o','w','s'},
+    {'f','l','o','w','y'},
+    {'f','l','u','b','s'},
+    {'f','l','u','e','d'},
+    {'f','l','u','e','s'},
+    {'f','l','u','e','y'},
+    {'f','l','u','f','f'},
+    {'f','l','u','i','d'},
+    {'f','l','u','k','e'},
+    {'f','l','u','k','y'},
+    {'f','l','u','m','e'},
+    {'f','l','u','m','p'},
+    {'f','l','u','n','g'},
+    {'f','l','u','n','k'},
+    {'f','l','u','o','r'},
+    {'f','l','u','r','r'},
+    {'f','l','u','s','h'},
+    {'f','l','u','t','e'},
+    {'f','l','u','t','y'},
+    {'f','l','u','y','t'},
+    {'f','l','y','b','y'},
+    {'f','l','y','e','r'},
+    {'f','l','y','i','n'},
+    {'f','l','y','p','e'},
+    {'f','l','y','t','e'},
+    {'f','n','a','r','r'},
+    {'f','o','a','l','s'},
+    {'f','o','a','m','s'},
+    {'f','o','a','m','y'},
+    {'f','o','c','a','l'},
+    {'f','o','c','u','s'},
+    {'f','o','e','h','n'},
+    {'f','o','g','e','y'},
+    {'f','o','g','g','y'},
+    {'f','o','g','i','e'},
+    {'f','o','g','l','e'},
+    {'f','o','g','o','s'},
+    {'f','o','g','o','u'},
+    {'f','o','h','n','s'},
+    {'f','o','i','d','s'},
+    {'f','o','i','l','s'},
+    {'f','o','i','n','s'},
+    {'f','o','i','s','t'},
+    {'f','o','l','d','s'},
+    {'f','o','l','e','y'},
+    {'f','o','l','i','a'},
+    {'f','o','l','i','c'},
+    {'f','o','l','i','e'},
+    {'f','o','l','i','o'},
+    {'f','o','l','k','s'},
+    {'f','o','l','k','y'},
+    {'f','o','l','l','y'},
+    {'f','o','m','e','s'},
+    {'f','o','n','d','a'},
+    {'f','o','n','d','s'},
+    {'f','o','n','d','u'},
+    {'f','o','n','e','s'},
+    {'f','o','n','i','o'},
+    {'f','o','n','l','y'},
+    {'f','o','n','t','s'},
+    {'f','o','o','d','s'},
+    {'f','o','o','d','y'},
+    {'f','o','o','l','s'},
+    {'f','o','o','t','s'},
+    {'f','o','o','t','y'},
+    {'f','o','r','a','m'},
+    {'f','o','r','a','y'},
+    {'f','o','r','b','s'},
+    {'f','o','r','b','y'},
+    {'f','o','r','c','e'},
+    {'f','o','r','d','o'},
+    {'f','o','r','d','s'},
+    {'f','o','r','e','l'},
+    {'f','o','r','e','s'},
+    {'f','o','r','e','x'},
+    {'f','o','r','g','e'},
+    {'f','o','r','g','o'},
+    {'f','o','r','k','s'},
+    {'f','o','r','k','y'},
+    {'f','o','r','m','a'},
+    {'f','o','r','m','e'},
+    {'f','o','r','m','s'},
+    {'f','o','r','t','e'},
+    {'f','o','r','t','h'},
+    {'f','o','r','t','s'},
+    {'f','o','r','t','y'},
+    {'f','o','r','u','m'},
+    {'f','o','r','z','a'},
+    {'f','o','r','z','e'},
+    {'f','o','s','s','a'},
+    {'f','o','s','s','e'},
+    {'f','o','u','a','t'},
+    {'f','o','u','d','s'},
+    {'f','o','u','e','r'},
+    {'f','o','u','e','t'},
+    {'f','o','u','l','e'},
+    {'f','o','u','l','s'},
+    {'f','o','u','n','d'},
+    {'f','o','u','n','t'},
+    {'f','o','u','r','s'},
+    {'f','o','u','t','h'},
+    {'f','o','v','e','a'},
+    {'f','o','w','l','s'},
+    {'f','o','w','t','h'},
+    {'f','o','x','e','d'},
+    {'f','o','x','e','s'},
+    {'f','o','x','i','e'},
+    {'f','o','y','e','r'},
+    {'f','o','y','l','e'},
+    {'f','o','y','n','e'},
+    {'f','r','a','b','s'},
+    {'f','r','a','c','k'},
+    {'f','r','a','c','t'},
+    {'f','r','a','g','s'},
+    {'f','r','a','i','l'},
+    {'f','r','a','i','m'},
+    {'f','r','a','i','s'},
+    {'f','r','a','m','e'},
+    {'f','r','a','n','c'},
+    {'f','r','a','n','k'},
+    {'f','r','a','p','e'},
+    {'f','r','a','p','s'},
+    {'f','r','a','s','s'},
+    {'f','r','a','t','e'},
+    {'f','r','a','t','i'},
+    {'f','r','a','t','s'},
+    {'f','r','a','u','d'},
+    {'f','r','a','u','s'},
+    {'f','r','a','y','s'},
+    {'f','r','e','a','k'},
+    {'f','r','e','e','d'},
+    {'f','r','e','e','r'},
+    {'f','r','e','e','s'},
+    {'f','r','e','e','t'},
+    {'f','r','e','i','t'},
+    {'f','r','e','m','d'},
+    {'f','r','e','n','a'},
+    {'f','r','e','o','n'},
+    {'f','r','e','r','e'},
+    {'f','r','e','s','h'},
+    {'f','r','e','t','s'},
+    {'f','r','i','a','r'},
+    {'f','r','i','b','s'},
+    {'f','r','i','e','d'},
+    {'f','r','i','e','r'},
+    {'f','r','i','e','s'},
+    {'f','r','i','g','s'},
+    {'f','r','i','l','l'},
+    {'f','r','i','s','e'},
+    {'f','r','i','s','k'},
+    {'f','r','i','s','t'},
+    {'f','r','i','t','a'},
+    {'f','r','i','t','e'},
+    {'f','r','i','t','h'},
+    {'f','r','i','t','s'},
+    {'f','r','i','t','t'},
+    {'f','r','i','t','z'},
+    {'f','r','i','z','e'},
+    {'f','r','i','z','z'},
+    {'f','r','o','c','k'},
+    {'f','r','o','e','s'},
+    {'f','r','o','g','s'},
+    {'f','r','o','m','m'},
+    {'f','r','o','n','d'},
+    {'f','r','o','n','s'},
+    {'f','r','o','n','t'},
+    {'f','r','o','o','m'},
+    {'f','r','o','r','e'},
+    {'f','r','o','r','n'},
+    {'f','r','o','r','y'},
+    {'f','r','o','s','h'},
+    {'f','r','o','s','t'},
+    {'f','r','o','t','h'},
+    {'f','r','o','w','n'},
+    {'f','r','o','w','s'},
+    {'f','r','o','w','y'},
+    {'f','r','o','y','o'},
+    {'f','r','o','z','e'},
+    {'f','r','u','g','s'},
+    {'f','r','u','i','t'},
+    {'f','r','u','m','p'},
+    {'f','r','u','s','h'},
+    {'f','r','u','s','t'},
+    {'f','r','y','e','r'},
+    {'f','u','b','a','r'},
+    {'f','u','b','b','y'},
+    {'f','u','b','s','y'},
+    {'f','u','c','k','s'},
+    {'f','u','c','u','s'},
+    {'f','u','d','d','y'},
+    {'f','u','d','g','e'},
+    {'f','u','d','g','y'},
+    {'f','u','e','l','s'},
+    {'f','u','e','r','o'},
+    {'f','u','f','f','s'},
+    {'f','u','f','f','y'},
+    {'f','u','g','a','l'},
+    {'f','u','g','g','y'},
+    {'f','u','g','i','e'},
+    {'f','u','g','i','o'},
+    {'f','u','g','i','s'},
+    {'f','u','g','l','e'},
+    {'f','u','g','l','y'},
+    {'f','u','g','u','e'},
+    {'f','u','g','u','s'},
+    {'f','u','j','i','s'},
+    {'f','u','l','l','a'},
+    {'f','u','l','l','s'},
+    {'f','u','l','l','y'},
+    {'f','u','l','t','h'},
+    {'f','u','l','w','a'},
+    {'f','u','m','e','d'},
+    {'f','u','m','e','r'},
+    {'f','u','m','e','s'},
+    {'f','u','m','e','t'},
+    {'f','u','n','d','a'},
+    {'f','u','n','d','i'},
+    {'f','u','n','d','o'},
+    {'f','u','n','d','s'},
+    {'f','u','n','d','y'},
+    {'f','u','n','g','i'},
+    {'f','u','n','g','o'},
+    {'f','u','n','g','s'},
+    {'f','u','n','i','c'},
+    {'f','u','n','i','s'},
+    {'f','u','n','k','s'},
+    {'f','u','n','k','y'},
+    {'f','u','n','n','y'},
+    {'f','u','n','s','y'},
+    {'f','u','n','t','s'},
+    {'f','u','r','a','l'},
+    {'f','u','r','a','n'},
+    {'f','u','r','c','a'},
+    {'f','u','r','l','s'},
+    {'f','u','r','o','l'},
+    {'f','u','r','o','r'},
+    {'f','u','r','o','s'},
+    {'f','u','r','r','s'},
+    {'f','u','r','r','y'},
+    {'f','u','r','t','h'},
+    {'f','u','r','z','e'},
+    {'f','u','r','z','y'},
+    {'f','u','s','e','d'},
+    {'f','u','s','e','e'},
+    {'f','u','s','e','l'},
+    {'f','u','s','e','s'},
+    {'f','u','s','i','l'},
+    {'f','u','s','k','s'},
+    {'f','u','s','s','y'},
+    {'f','u','s','t','s'},
+    {'f','u','s','t','y'},
+    {'f','u','t','o','n'},
+    {'f','u','z','e','d'},
+    {'f','u','z','e','e'},
+    {'f','u','z','e','s'},
+    {'f','u','z','i','l'},
+    {'f','u','z','z','y'},
+    {'f','y','c','e','s'},
+    {'f','y','k','e','d'},
+    {'f','y','k','e','s'},
+    {'f','y','l','e','s'},
+    {'f','y','r','d','s'},
+    {'f','y','t','t','e'},
+    {'g','a','b','b','a'},
+    {'g','a','b','b','y'},
+    {'g','a','b','l','e'},
+    {'g','a','d','d','i'},
+    {'g','a','d','e','s'},
+    {'g','a','d','g','e'},
+    {'g','a','d','g','y'},
+    {'g','a','d','i','d'},
+    {'g','a','d','i','s'},
+    {'g','a','d','j','e'},
+    {'g','a','d','j','o'},
+    {'g','a','d','s','o'},
+    {'g','a','f','f','e'},
+    {'g','a','f','f','s'},
+    {'g','a','g','e','d'},
+    {'g','a','g','e','r'},
+    {'g','a','g','e','s'},
+    {'g','a','i','d','s'},
+    {'g','a','i','l','y'},
+    {'g','a','i','n','s'},
+    {'g','a','i','r','s'},
+    {'g','a','i','t','a'},
+    {'g','a','i','t','s'},
+    {'g','a','i','t','t'},
+    {'g','a','j','o','s'},
+    {'g','a','l','a','h'},
+    {'g','a','l','a','s'},
+    {'g','a','l','a','x'},
+    {'g','a','l','e','a'},
+    {'g','a','l','e','d'},
+    {'g','a','l','e','s'},
+    {'g','a','l','i','a'},
+    {'g','a','l','i','s'},
+    {'g','a','l','l','s'},
+    {'g','a','l','l','y'},
+    {'g','a','l','o','p'},
+    {'g','a','l','u','t'},
+    {'g','a','l','v','o'},
+    {'g','a','m','a','s'},
+    {'g','a','m','a','y'},
+    {'g','a','m','b','a'},
+    {'g','a','m','b','e'},
+    {'g','a','m','b','o'},
+    {'g','a','m','b','s'},
+    {'g','a','m','e','d'},
+    {'g','a','m','e','r'},
+    {'g','a','m','e','s'},
+    {'g','a','m','e','y'},
+    {'g','a','m','i','c'},
+    {'g','a','m','i','n'},
+    {'g','a','m','m','a'},
+    {'g','a','m','m','e'},
+    {'g','a','m','m','y'},
+    {'g','a','m','p','s'},
+    {'g','a','m','u','t'},
+    {'g','a','n','c','h'},
+    {'g','a','n','d','y'},
+    {'g','a','n','e','f'},
+    {'g','a','n','e','v'},
+    {'g','a','n','g','s'},
+    {'g','a','n','j','a'},
+    {'g','a','n','k','s'},
+    {'g','a','n','o','f'},
+    {'g','a','n','t','s'},
+    {'g','a','o','l','s'},
+    {'g','a','p','e','d'},
+    {'g','a','p','e','r'},
+    {'g','a','p','e','s'},
+    {'g','a','p','o','s'},
+    {'g','a','p','p','y'},
+    {'g','a','r','a','m'},
+    {'g','a','r','b','a'},
+    {'g','a','r','b','e'},
+    {'g','a','r','b','o'},
+    {'g','a','r','b','s'},
+    {'g','a','r','d','a'},
+    {'g','a','r','d','e'},
+    {'g','a','r','e','s'},
+    {'g','a','r','i','s'},
+    {'g','a','r','m','s'},
+    {'g','a','r','n','i'},
+    {'g','a','r','r','e'},
+    {'g','a','r','r','i'},
+    {'g','a','r','t','h'},
+    {'g','a','r','u','m'},
+    {'g','a','s','e','s'},
+    {'g','a','s','h','y'},
+    {'g','a','s','p','s'},
+    {'g','a','s','p','y'},
+    {'g','a','s','s','y'},
+    {'g','a','s','t','s'},
+    {'g','a','t','c','h'},
+    {'g','a','t','e','d'},
+    {'g','a','t','e','r'},
+    {'g','a','t','e','s'},
+    {'g','a','t','h','s'},
+    {'g','a','t','o','r'},
+    {'g','a','u','c','h'},
+    {'g','a','u','c','y'},
+    {'g','a','u','d','s'},
+    {'g','a','u','d','y'},
+    {'g','a','u','g','e'},
+    {'g','a','u','j','e'},
+    {'g','a','u','l','t'},
+    {'g','a','u','m','s'},
+    {'g','a','u','m','y'},
+    {'g','a','u','n','t'},
+    {'g','a','u','p','s'},
+    {'g','a','u','r','s'},
+    {'g','a','u','s','s'},
+    {'g','a','u','z','e'},
+    {'g','a','u','z','y'},
+    {'g','a','v','e','l'},
+    {'g','a','v','o','t'},
+    {'g','a','w','c','y'},
+    {'g','a','w','d','s'},
+    {'g','a','w','k','s'},
+    {'g','a','w','k','y'},
+    {'g','a','w','p','s'},
+    {'g','a','w','s','y'},
+    {'g','a','y','a','l'},
+    {'g','a','y','e','r'},
+    {'g','a','y','l','y'},
+    {'g','a','z','a','l'},
+    {'g','a','z','a','r'},
+    {'g','a','z','e','d'},
+    {'g','a','z','e','r'},
+    {'g','a','z','e','s'},
+    {'g','a','z','o','n'},
+    {'g','a','z','o','o'},
+    {'g','e','a','l','s'},
+    {'g','e','a','n','s'},
+    {'g','e','a','r','e'},
+    {'g','e','a','r','s'},
+    {'g','e','a','s','a'},
+    {'g','e','a','t','s'},
+    {'g','e','b','u','r'},
+    {'g','e','c','k','o'},
+    {'g','e','c','k','s'},
+    {'g','e','e','k','s'},
+    {'g','e','e','k','y'},
+    {'g','e','e','p','s'},
+    {'g','e','e','s','e'},
+    {'g','e','e','s','t'},
+    {'g','e','i','s','t'},
+    {'g','e','i','t','s'},
+    {'g','e','l','d','s'},
+    {'g','e','l','e','e'},
+    {'g','e','l','i','d'},
+    {'g','e','l','l','y'},
+    {'g','e','l','t','s'},
+    {'g','e','m','e','l'},
+    {'g','e','m','m','a'},
+    {'g','e','m','m','y'},
+    {'g','e','m','o','t'},
+    {'g','e','n','a','e'},
+    {'g','e','n','a','l'},
+    {'g','e','n','a','s'},
+    {'g','e','n','e','s'},
+    {'g','e','n','e','t'},
+    {'g','e','n','i','c'},
+    {'g','e','n','i','e'},
+    {'g','e','n','i','i'},
+    {'g','e','n','i','n'},
+    {'g','e','n','i','o'},
+    {'g','e','n','i','p'},
+    {'g','e','n','n','y'},
+    {'g','e','n','o','a'},
+    {'g','e','n','o','m'},
+    {'g','e','n','r','e'},
+    {'g','e','n','r','o'},
+    {'g','e','n','t','s'},
+    {'g','e','n','t','y'},
+    {'g','e','n','u','a'},
+    {'g','e','n','u','s'},
+    {'g','e','o','d','e'},
+    {'g','e','o','i','d'},
+    {'g','e','r','a','h'},
+    {'g','e','r','b','e'},
+    {'g','e','r','e','s'},
+    {'g','e','r','l','e'},
+    {'g','e','r','m','s'},
+    {'g','e','r','m','y'},
+    {'g','e','r','n','e'},
+    {'g','e','s','s','e'},
+    {'g','e','s','s','o'},
+    {'g','e','s','t','e'},
+    {'g','e','s','t','s'},
+    {'g','e','t','a','s'},
+    {'g','e','t','u','p'},
+    {'g','e','u','m','s'},
+    {'g','e','y','a','n'},
+    {'g','e','y','e','r'},
+    {'g','h','a','s','t'},
+    {'g','h','a','t','s'},
+    {'g','h','a','u','t'},
+    {'g','h','a','z','i'},
+    {'g','h','e','e','s'},
+    {'g','h','e','s','t'},
+    {'g','h','o','s','t'},
+    {'g','h','o','u','l'},
+    {'g','h','u','s','l'},
+    {'g','h','y','l','l'},
+    {'g','i','a','n','t'},
+    {'g','i','b','e','d'},
+    {'g','i','b','e','l'},
+    {'g','i','b','e','r'},
+    {'g','i','b','e','s'},
+    {'g','i','b','l','i'},
+    {'g','i','b','u','s'},
+    {'g','i','d','d','y'},
+    {'g','i','f','t','s'},
+    {'g','i','g','a','s'},
+    {'g','i','g','h','e'},
+    {'g','i','g','o','t'},
+    {'g','i','g','u','e'},
+    {'g','i','l','a','s'},
+    {'g','i','l','d','s'},
+    {'g','i','l','e','t'},
+    {'g','i','l','i','a'},
+    {'g','i','l','l','s'},
+    {'g','i','l','l','y'},
+    {'g','i','l','p','y'},
+    {'g','i','l','t','s'},
+    {'g','i','m','e','l'},
+    {'g','i','m','m','e'},
+    {'g','i','m','p','s'},
+    {'g','i','m','p','y'},
+    {'g','i','n','c','h'},
+    {'g','i','n','g','a'},
+    {'g','i','n','g','e'},
+    {'g','i','n','g','s'},
+    {'g','i','n','k','s'},
+    {'g','i','n','n','y'},
+    {'g','i','n','z','o'},
+    {'g','i','p','o','n'},
+    {'g','i','p','p','o'},
+    {'g','i','p','p','y'},
+    {'g','i','p','s','y'},
+    {'g','i','r','d','s'},
+    {'g','i','r','l','f'},
+    {'g','i','r','l','s'},
+    {'g','i','r','l','y'},
+    {'g','i','r','n','s'},
+    {'g','i','r','o','n'},
+    {'g','i','r','o','s'},
+    {'g','i','r','r','s'},
+    {'g','i','r','s','h'},
+    {'g','i','r','t','h'},
+    {'g','i','r','t','s'},
+    {'g','i','s','m','o'},
+    {'g','i','s','m','s'},
+    {'g','i','s','t','s'},
+    {'g','i','t','c','h'},
+    {'g','i','t','e','s'},
+    {'g','i','u','s','t'},
+    {'g','i','v','e','d'},
+    {'g','i','v','e','n'},
+    {'g','i','v','e','r'},
+    {'g','i','v','e','s'},
+    {'g','i','z','m','o'},
+    {'g','l','a','c','e'},
+    {'g','l','a','d','e'},
+    {'g','l','a','d','s'},
+    {'g','l','a','d','y'},
+    {'g','l','a','i','k'},
+    {'g','l','a','i','r'},
+    {'g','l','a','m','p'},
+    {'g','l','a','m','s'},
+    {'g','l','a','n','d'},
+    {'g','l','a','n','s'},
+    {'g','l','a','r','e'},
+    {'g','l','a','r','y'},
+    {'g','l','a','s','s'},
+    {'g','l','a','t','t'},
+    {'g','l','a','u','m'},
+    {'g','l','a','u','r'},
+    {'g','l','a','z','e'},
+    {'g','l','a','z','y'},
+    {'g','l','e','a','m'},
+    {'g','l','e','a','n'},
+    {'g','l','e','b','a'},
+    {'g','l','e','b','e'},
+    {'g','l','e','b','y'},
+    {'g','l','e','d','e'},
+    {'g','l','e','d','s'},
+    {'g','l','e','e','d'},
+    {'g','l','e','e','k'},
+    {'g','l','e','e','s'},
+    {'g','l','e','e','t'},
+    {'g','l','e','i','s'},
+    {'g','l','e','n','s'},
+    {'g','l','e','n','t'},
+    {'g','l','e','y','s'},
+    {'g','l','i','a','l'},
+    {'g','l','i','a','s'},
+    {'g','l','i','b','s'},
+    {'g','l','i','d','e'},
+    {'g','l','i','f','f'},
+    {'g','l','i','f','t'},
+    {'g','l','i','k','e'},
+    {'g','l','i','m','e'},
+    {'g','l','i','m','s'},
+    {'g','l','i','n','t'},
+    {'g','l','i','s','k'},
+    {'g','l','i','t','s'},
+    {'g','l','i','t','z'},
+    {'g','l','o','a','m'},
+    {'g','l','o','a','t'},
+    {'g','l','o','b','e'},
+    {'g','l','o','b','i'},
+    {'g','l','o','b','s'},
+    {'g','l','o','b','y'},
+    {'g','l','o','d','e'},
+    {'g','l','o','g','g'},
+    {'g','l','o','m','s'},
+    {'g','l','o','o','m'},
+    {'g','l','o','o','p'},
+    {'g','l','o','p','s'},
+    {'g','l','o','r','y'},
+    {'g','l','o','s','s'},
+    {'g','l','o','s','t'},
+    {'g','l','o','u','t'},
+    {'g','l','o','v','e'},
+    {'g','l','o','w','s'},
+    {'g','l','o','w','y'},
+    {'g','l','o','z','e'},
+    {'g','l','u','e','d'},
+    {'g','l','u','e','r'},
+    {'g','l','u','e','s'},
+    {'g','l','u','e','y'},
+    {'g','l','u','g','g'},
+    {'g','l','u','g','s'},
+    {'g','l','u','m','e'},
+    {'g','l','u','m','s'},
+    {'g','l','u','o','n'},
+    {'g','l','u','t','e'},
+    {'g','l','u','t','s'},
+    {'g','l','y','p','h'},
+    {'g','n','a','p','i'},
+    {'g','n','a','r','l'},
+    {'g','n','a','r','r'},
+    {'g','n','a','r','s'},
+    {'g','n','a','s','h'},
+    {'g','n','a','t','s'},
+    {'g','n','a','w','n'},
+    {'g','n','a','w','s'},
+    {'g','n','o','m','e'},
+    {'g','n','o','w','s'},
+    {'g','o','a','d','s'},
+    {'g','o','a','f','s'},
+    {'g','o','a','f','t'},
+    {'g','o','a','l','s'},
+    {'g','o','a','r','y'},
+    {'g','o','a','t','s'},
+    {'g','o','a','t','y'},
+    {'g','o','a','v','e'},
+    {'g','o','b','a','n'},
+    {'g','o','b','a','r'},
+    {'g','o','b','b','e'},
+    {'g','o','b','b','i'},
+    {'g','o','b','b','o'},
+    {'g','o','b','b','y'},
+    {'g','o','b','i','s'},
+    {'g','o','b','o','s'},
+    {'g','o','d','e','t'},
+    {'g','o','d','l','y'},
+    {'g','o','d','s','o'},
+    {'g','o','e','l','s'},
+    {'g','o','e','r','s'},
+    {'g','o','e','s','t'},
+    {'g','o','e','t','h'},
+    {'g','o','e','t','y'},
+    {'g','o','f','e','r'},
+    {'g','o','f','f','s'},
+    {'g','o','g','g','a'},
+    {'g','o','g','o','s'},
+    {'g','o','i','e','r'},
+    {'g','o','i','n','g'},
+    {'g','o','j','i','s'},
+    {'g','o','k','e','s'},
+    {'g','o','l','d','s'},
+    {'g','o','l','d','y'},
+    {'g','o','l','e','m'},
+    {'g','o','l','e','s'},
+    {'g','o','l','f','s'},
+    {'g','o','l','l','y'},
+    {'g','o','l','p','e'},
+    {'g','o','l','p','s'},
+    {'g','o','m','b','o'},
+    {'g','o','m','e','r'},
+    {'g','o','m','p','a'},
+    {'g','o','n','a','d'},
+    {'g','o','n','c','h'},
+    {'g','o','n','e','f'},
+    {'g','o','n','e','r'},
+    {'g','o','n','g','s'},
+    {'g','o','n','i','a'},
+    {'g','o','n','i','f'},
+    {'g','o','n','k','s'},
+    {'g','o','n','n','a'},
+    {'g','o','n','o','f'},
+    {'g','o','n','y','s'},
+    {'g','o','n','z','o'},
+    {'g','o','o','b','y'},
+    {'g','o','o','d','o'},
+    {'g','o','o','d','s'},
+    {'g','o','o','d','y'},
+    {'g','o','o','e','y'},
+    {'g','o','o','f','s'},
+    {'g','o','o','f','y'},
+    {'g','o','o','g','s'},
+    {'g','o','o','k','s'},
+    {'g','o','o','k','y'},
+    {'g','o','o','l','d'},
+    {'g','o','o','l','s'},
+    {'g','o','o','l','y'},
+    {'g','o','o','m','y'},
+    {'g','o','o','n','s'},
+    {'g','o','o','n','y'},
+    {'g','o','o','p','s'},
+    {'g','o','o','p','y'},
+    {'g','o','o','r','s'},
+    {'g','o','o','r','y'},
+    {'g','o','o','s','e'},
+    {'g','o','o','s','y'},
+    {'g','o','p','a','k'},
+    {'g','o','p','i','k'},
+    {'g','o','r','a','l'},
+    {'g','o','r','a','s'},
+    {'g','o','r','a','y'},
+    {'g','o','r','b','s'},
+    {'g','o','r','d','o'},
+    {'g','o','r','e','d'},
+    {'g','o','r','e','s'},
+    {'g','o','r','g','e'},
+    {'g','o','r','i','s'},
+    {'g','o','r','m','s'},
+    {'g','o','r','m','y'},
+    {'g','o','r','p','s'},
+    {'g','o','r','s','e'},
+    {'g','o','r','s','y'},
+    {'g','o','s','h','t'},
+    {'g','o','s','s','e'},
+    {'g','o','t','c','h'},
+    {'g','o','t','h','s'},
+    {'g','o','t','h','y'},
+    {'g','o','t','t','a'},
+    {'g','o','u','c','h'},
+    {'g','o','u','g','e'},
+    {'g','o','u','k','s'},
+    {'g','o','u','r','a'},
+    {'g','o','u','r','d'},
+    {'g','o','u','t','s'},
+    {'g','o','u','t','y'},
+    {'g','o','v','e','d'},
+    {'g','o','v','e','s'},
+    {'g','o','w','a','n'},
+    {'g','o','w','d','s'},
+    {'g','o','w','f','s'},
+    {'g','o','w','k','s'},
+    {'g','o','w','l','s'},
+    {'g','o','w','n','s'},
+    {'g','o','x','e','s'},
+    {'g','o','y','i','m'},
+    {'g','o','y','l','e'},
+    {'g','r','a','a','l'},
+    {'g','r','a','b','s'},
+    {'g','r','a','c','e'},
+    {'g','r','a','d','e'},
+    {'g','r','a','d','s'},
+    {'g','r','a','f','f'},
+    {'g','r','a','f','t'},
+    {'g','r','a','i','l'},
+    {'g','r','a','i','n'},
+    {'g','r','a','i','p'},
+    {'g','r','a','m','a'},
+    {'g','r','a','m','e'},
+    {'g','r','a','m','p'},
+    {'g','r','a','m','s'},
+    {'g','r','a','n','a'},
+    {'g','r','a','n','d'},
+    {'g','r','a','n','o'},
+    {'g','r','a','n','s'},
+    {'g','r','a','n','t'},
+    {'g','r','a','p','e'},
+    {'g','r','a','p','h'},
+    {'g','r','a','p','y'},
+    {'g','r','a','s','p'},
+    {'g','r','a','s','s'},
+    {'g','r','a','t','a'},
+    {'g','r','a','t','e'},
+    {'g','r','a','t','s'},
+    {'g','r','a','v','e'},
+    {'g','r','a','v','s'},
+    {'g','r','a','v','y'},
+    {'g','r','a','y','s'},
+    {'g','r','a','z','e'},
+    {'g','r','e','a','t'},
+    {'g','r','e','b','e'},
+    {'g','r','e','b','o'},
+    {'g','r','e','c','e'},
+    {'g','r','e','e','d'},
+    {'g','r','e','e','k'},
+    {'g','r','e','e','n'},
+    {'g','r','e','e','s'},
+    {'g','r','e','e','t'},
+    {'g','r','e','g','e'},
+    {'g','r','e','g','o'},
+    {'g','r','e','i','n'},
+    {'g','r','e','n','s'},
+    {'g','r','e','p','s'},
+    {'g','r','e','s','e'},
+    {'g','r','e','v','e'},
+    {'g','r','e','w','s'},
+    {'g','r','e','y','s'},
+    {'g','r','i','c','e'},
+    {'g','r','i','d','e'},
+    {'g','r','i','d','s'},
+    {'g','r','i','e','f'},
+    {'g','r','i','f','f'},
+    {'g','r','i','f','t'},
+    {'g','r','i','g','s'},
+    {'g','r','i','k','e'},
+    {'g','r','i','l','l'},
+    {'g','r','i','m','e'},
+    {'g','r','i','m','y'},
+    {'g','r','i','n','d'},
+    {'g','r','i','n','s'},
+    {'g','r','i','o','t'},
+    {'g','r','i','p','e'},
+    {'g','r','i','p','s'},
+    {'g','r','i','p','t'},
+    {'g','r','i','p','y'},
+    {'g','r','i','s','e'},
+    {'g','r','i','s','t'},
+    {'g','r','i','s','y'},
+    {'g','r','i','t','h'},
+    {'g','r','i','t','s'},
+    {'g','r','i','z','e'},
+    {'g','r','o','a','n'},
+    {'g','r','o','a','t'},
+    {'g','r','o','d','y'},
+    {'g','r','o','g','s'},
+    {'g','r','o','i','n'},
+    {'g','r','o','k','s'},
+    {'g','r','o','m','a'},
+    {'g','r','o','m','s'},
+    {'g','r','o','n','e'},
+    {'g','r','o','o','f'},
+    {'g','r','o','o','m'},
+    {'g','r','o','p','e'},
+    {'g','r','o','s','s'},
+    {'g','r','o','s','z'},
+    {'g','r','o','t','s'},
+    {'g','r','o','u','f'},
+    {'g','r','o','u','p'},
+    {'g','r','o','u','t'},
+    {'g','r','o','v','e'},
+    {'g','r','o','v','y'},
+    {'g','r','o','w','l'},
+    {'g','r','o','w','n'},
+    {'g','r','o','w','s'},
+    {'g','r','r','l','s'},
+    {'g','r','r','r','l'},
+    {'g','r','u','b','s'},
+    {'g','r','u','e','d'},
+    {'g','r','u','e','l'},
+    {'g','r','u','e','s'},
+    {'g','r','u','f','e'},
+    {'g','r','u','f','f'},
+    {'g','r','u','m','e'},
+    {'g','r','u','m','p'},
+    {'g','r','u','n','d'},
+    {'g','r','u','n','t'},
+    {'g','r','y','c','e'},
+    {'g','r','y','d','e'},
+    {'g','r','y','k','e'},
+    {'g','r','y','p','e'},
+    {'g','r','y','p','t'},
+    {'g','u','a','c','o'},
+    {'g','u','a','n','a'},
+    {'g','u','a','n','o'},
+    {'g','u','a','n','s'},
+    {'g','u','a','r','d'},
+    {'g','u','a','r','s'},
+    {'g','u','a','v','a'},
+    {'g','u','b','b','a'},
+    {'g','u','c','k','s'},
+    {'g','u','c','k','y'},
+    {'g','u','d','e','s'},
+    {'g','u','e','s','s'},
+    {'g','u','e','s','t'},
+    {'g','u','f','f','s'},
+    {'g','u','g','a','s'},
+    {'g','u','g','g','l'},
+    {'g','u','i','d','e'},
+    {'g','u','i','d','o'},
+    {'g','u','i','d','s'},
+    {'g','u','i','l','d'},
+    {'g','u','i','l','e'},
+    {'g','u','i','l','t'},
+    {'g','u','i','m','p'},
+    {'g','u','i','r','o'},
+    {'g','u','i','s','e'},
+    {'g','u','l','a','b'},
+    {'g','u','l','a','g'},
+    {'g','u','l','a','r'},
+    {'g','u','l','a','s'},
+    {'g','u','l','c','h'},
+    {'g','u','l','e','s'},
+    {'g','u','l','e','t'},
+    {'g','u','l','f','s'},
+    {'g','u','l','f','y'},
+    {'g','u','l','l','s'},
+    {'g','u','l','l','y'},
+    {'g','u','l','p','h'},
+    {'g','u','l','p','s'},
+    {'g','u','l','p','y'},
+    {'g','u','m','b','o'},
+    {'g','u','m','m','a'},
+    {'g','u','m','m','i'},
+    {'g','u','m','m','y'},
+    {'g','u','m','p','s'},
+    {'g','u','n','a','s'},
+    {'g','u','n','d','i'},
+    {'g','u','n','d','y'},
+    {'g','u','n','g','e'},
+    {'g','u','n','g','y'},
+    {'g','u','n','k','s'},
+    {'g','u','n','k','y'},
+    {'g','u','n','n','y'},
+    {'g','u','p','p','y'},
+    {'g','u','q','i','n'},
+    {'g','u','r','d','y'},
+    {'g','u','r','g','e'},
+    {'g','u','r','k','s'},
+    {'g','u','r','l','s'},
+    {'g','u','r','l','y'},
+    {'g','u','r','n','s'},
+    {'g','u','r','r','y'},
+    {'g','u','r','s','h'},
+    {'g','u','r','u','s'},
+    {'g','u','s','h','y'},
+    {'g','u','s','l','a'},
+    {'g','u','s','l','e'},
+    {'g','u','s','l','i'},
+    {'g','u','s','s','y'},
+    {'g','u','s','t','o'},
+    {'g','u','s','t','s'},
+    {'g','u','s','t','y'},
+    {'g','u','t','s','y'},
+    {'g','u','t','t','a'},
+    {'g','u','t','t','y'},
+    {'g','u','y','e','d'},
+    {'g','u','y','l','e'},
+    {'g','u','y','o','t'},
+    {'g','u','y','s','e'},
+    {'g','w','i','n','e'},
+    {'g','y','a','l','s'},
+    {'g','y','a','n','s'},
+    {'g','y','b','e','d'},
+    {'g','y','b','e','s'},
+    {'g','y','e','l','d'},
+    {'g','y','m','p','s'},
+    {'g','y','n','a','e'},
+    {'g','y','n','i','e'},
+    {'g','y','n','n','y'},
+    {'g','y','n','o','s'},
+    {'g','y','o','z','a'},
+    {'g','y','p','e','s'},
+    {'g','y','p','o','s'},
+    {'g','y','p','p','o'},
+    {'g','y','p','p','y'},
+    {'g','y','p','s','y'},
+    {'g','y','r','a','l'},
+    {'g','y','r','e','d'},
+    {'g','y','r','e','s'},
+    {'g','y','r','o','n'},
+    {'g','y','r','o','s'},
+    {'g','y','r','u','s'},
+    {'g','y','t','e','s'},
+    {'g','y','v','e','d'},
+    {'g','y','v','e','r'},
+    {'g','y','v','e','s'},
+    {'h','a','a','f','s'},
+    {'h','a','a','r','s'},
+    {'h','a','a','t','s'},
+    {'h','a','b','i','t'},
+    {'h','a','b','l','e'},
+    {'h','a','b','u','s'},
+    {'h','a','c','e','k'},
+    {'h','a','c','k','s'},
+    {'h','a','c','k','y'},
+    {'h','a','d','a','l'},
+    {'h','a','d','e','d'},
+    {'h','a','d','e','s'},
+    {'h','a','d','j','i'},
+    {'h','a','d','s','t'},
+    {'h','a','e','m','s'},
+    {'h','a','e','r','e'},
+    {'h','a','e','t','s'},
+    {'h','a','f','f','s'},
+    {'h','a','f','i','z'},
+    {'h','a','f','t','a'},
+    {'h','a','f','t','s'},
+    {'h','a','g','g','s'},
+    {'h','a','h','a','m'},
+    {'h','a','h','a','s'},
+    {'h','a','i','c','k'},
+    {'h','a','i','k','a'},
+    {'h','a','i','k','s'},
+    {'h','a','i','k','u'},
+    {'h','a','i','l','s'},
+    {'h','a','i','l','y'},
+    {'h','a','i','n','s'},
+    {'h','a','i','n','t'},
+    {'h','a','i','r','s'},
+    {'h','a','i','r','y'},
+    {'h','a','i','t','h'},
+    {'h','a','j','e','s'},
+    {'h','a','j','i','s'},
+    {'h','a','j','j','i'},
+    {'h','a','k','a','m'},
+    {'h','a','k','a','s'},
+    {'h','a','k','e','a'},
+    {'h','a','k','e','s'},
+    {'h','a','k','i','m'},
+    {'h','a','k','u','s'},
+    {'h','a','l','a','l'},
+    {'h','a','l','d','i'},
+    {'h','a','l','e','d'},
+    {'h','a','l','e','r'},
+    {'h','a','l','e','s'},
+    {'h','a','l','f','a'},
+    {'h','a','l','f','s'},
+    {'h','a','l','i','d'},
+    {'h','a','l','l','o'},
+    {'h','a','l','l','s'},
+    {'h','a','l','m','a'},
+    {'h','a','l','m','s'},
+    {'h','a','l','o','n'},
+    {'h','a','l','o','s'},
+    {'h','a','l','s','e'},
+    {'h','a','l','s','h'},
+    {'h','a','l','t','s'},
+    {'h','a','l','v','a'},
+    {'h','a','l','v','e'},
+    {'h','a','l','w','a'},
+    {'h','a','m','a','l'},
+    {'h','a','m','b','a'},
+    {'h','a','m','e','d'},
+    {'h','a','m','e','l'},
+    {'h','a','m','e','s'},
+    {'h','a','m','m','y'},
+    {'h','a','m','z','a'},
+    {'h','a','n','a','p'},
+    {'h','a','n','c','e'},
+    {'h','a','n','c','h'},
+    {'h','a','n','d','i'},
+    {'h','a','n','d','s'},
+    {'h','a','n','d','y'},
+    {'h','a','n','g','i'},
+    {'h','a','n','g','s'},
+    {'h','a','n','k','s'},
+    {'h','a','n','k','y'},
+    {'h','a','n','s','a'},
+    {'h','a','n','s','e'},
+    {'h','a','n','t','s'},
+    {'h','a','o','l','e'},
+    {'h','a','o','m','a'},
+    {'h','a','p','a','s'},
+    {'h','a','p','a','x'},
+    {'h','a','p','l','y'},
+    {'h','a','p','p','i'},
+    {'h','a','p','p','y'},
+    {'h','a','p','u','s'},
+    {'h','a','r','a','m'},
+    {'h','a','r','d','s'},
+    {'h','a','r','d','y'},
+    {'h','a','r','e','d'},
+    {'h','a','r','e','m'},
+    {'h','a','r','e','s'},
+    {'h','a','r','i','m'},
+    {'h','a','r','k','s'},
+    {'h','a','r','l','s'},
+    {'h','a','r','m','s'},
+    {'h','a','r','n','s'},
+    {'h','a','r','o','s'},
+    {'h','a','r','p','s'},
+    {'h','a','r','p','y'},
+    {'h','a','r','r','y'},
+    {'h','a','r','s','h'},
+    {'h','a','r','t','s'},
+    {'h','a','s','h','y'},
+    {'h','a','s','k','s'},
+    {'h','a','s','p','s'},
+    {'h','a','s','t','a'},
+    {'h','a','s','t','e'},
+    {'h','a','s','t','y'},
+    {'h','a','t','c','h'},
+    {'h','a','t','e','d'},
+    {'h','a','t','e','r'},
+    {'h','a','t','e','s'},
+    {'h','a','t','h','a'},
+    {'h','a','t','h','i'},
+    {'h','a','t','t','y'},
+    {'h','a','u','d','s'},
+    {'h','a','u','f','s'},
+    {'h','a','u','g','h'},
+    {'h','a','u','g','o'},
+    {'h','a','u','l','d'},
+    {'h','a','u','l','m'},
+    {'h','a','u','l','s'},
+    {'h','a','u','l','t'},
+    {'h','a','u','n','s'},
+    {'h','a','u','n','t'},
+    {'h','a','u','s','e'},
+    {'h','a','u','t','e'},
+    {'h','a','v','a','n'},
+    {'h','a','v','e','l'},
+    {'h','a','v','e','n'},
+    {'h','a','v','e','r'},
+    {'h','a','v','e','s'},
+    {'h','a','v','o','c'},
+    {'h','a','w','e','d'},
+    {'h','a','w','k','s'},
+    {'h','a','w','m','s'},
+    {'h','a','w','s','e'},
+    {'h','a','y','e','d'},
+    {'h','a','y','e','r'},
+    {'h','a','y','e','y'},
+    {'h','a','y','l','e'},
+    {'h','a','z','a','n'},
+    {'h','a','z','e','d'},
+    {'h','a','z','e','l'},
+    {'h','a','z','e','r'},
+    {'h','a','z','e','s'},
+    {'h','a','z','l','e'},
+    {'h','e','a','d','s'},
+    {'h','e','a','d','y'},
+    {'h','e','a','l','d'},
+    {'h','e','a','l','s'},
+    {'h','e','a','m','e'},
+    {'h','e','a','p','s'},
+    {'h','e','a','p','y'},
+    {'h','e','a','r','d'},
+    {'h','e','a','r','e'},
+    {'h','e','a','r','s'},
+    {'h','e','a','r','t'},
+    {'h','e','a','s','t'},
+    {'h','e','a','t','h'},
+    {'h','e','a','t','s'},
+    {'h','e','a','t','y'},
+    {'h','e','a','v','e'},
+    {'h','e','a','v','y'},
+    {'h','e','b','e','n'},
+    {'h','e','b','e','s'},
+    {'h','e','c','h','t'},
+    {'h','e','c','k','s'},
+    {'h','e','d','e','r'},
+    {'h','e','d','g','e'},
+    {'h','e','d','g','y'},
+    {'h','e','e','d','s'},
+    {'h','e','e','d','y'},
+    {'h','e','e','l','s'},
+    {'h','e','e','z','e'},
+    {'h','e','f','t','e'},
+    {'h','e','f','t','s'},
+    {'h','e','f','t','y'},
+    {'h','e','i','a','u'},
+    {'h','e','i','d','s'},
+    {'h','e','i','g','h'},
+    {'h','e','i','l','s'},
+    {'h','e','i','r','s'},
+    {'h','e','i','s','t'},
+    {'h','e','j','a','b'},
+    {'h','e','j','r','a'},
+    {'h','e','l','e','d'},
+    {'h','e','l','e','s'},
+    {'h','e','l','i','o'},
+    {'h','e','l','i','x'},
+    {'h','e','l','l','a'},
+    {'h','e','l','l','o'},
+    {'h','e','l','l','s'},
+    {'h','e','l','l','y'},
+    {'h','e','l','m','s'},
+    {'h','e','l','o','s'},
+    {'h','e','l','o','t'},
+    {'h','e','l','p','s'},
+    {'h','e','l','v','e'},
+    {'h','e','m','a','l'},
+    {'h','e','m','e','s'},
+    {'h','e','m','i','c'},
+    {'h','e','m','i','n'},
+    {'h','e','m','p','s'},
+    {'h','e','m','p','y'},
+    {'h','e','n','c','e'},
+    {'h','e','n','c','h'},
+    {'h','e','n','d','s'},
+    {'h','e','n','g','e'},
+    {'h','e','n','n','a'},
+    {'h','e','n','n','y'},
+    {'h','e','n','r','y'},
+    {'h','e','n','t','s'},
+    {'h','e','p','a','r'},
+    {'h','e','r','b','s'},
+    {'h','e','r','b','y'},
+    {'h','e','r','d','s'},
+    {'h','e','r','e','s'},
+    {'h','e','r','l','s'},
+    {'h','e','r','m','a'},
+    {'h','e','r','m','s'},
+    {'h','e','r','n','s'},
+    {'h','e','r','o','n'},
+    {'h','e','r','o','s'},
+    {'h','e','r','p','s'},
+    {'h','e','r','r','y'},
+    {'h','e','r','s','e'},
+    {'h','e','r','t','z'},
+    {'h','e','r','y','e'},
+    {'h','e','s','p','s'},
+    {'h','e','s','t','s'},
+    {'h','e','t','e','s'},
+    {'h','e','t','h','s'},
+    {'h','e','u','c','h'},
+    {'h','e','u','g','h'},
+    {'h','e','v','e','a'},
+    {'h','e','v','e','l'},
+    {'h','e','w','e','d'},
+    {'h','e','w','e','r'},
+    {'h','e','w','g','h'},
+    {'h','e','x','a','d'},
+    {'h','e','x','e','d'},
+    {'h','e','x','e','r'},
+    {'h','e','x','e','s'},
+    {'h','e','x','y','l'},
+    {'h','e','y','e','d'},
+    {'h','i','a','n','t'},
+    {'h','i','b','a','s'},
+    {'h','i','c','k','s'},
+    {'h','i','d','e','d'},
+    {'h','i','d','e','r'},
+    {'h','i','d','e','s'},
+    {'h','i','e','m','s'},
+    {'h','i','f','i','s'},
+    {'h','i','g','h','s'},
+    {'h','i','g','h','t'},
+    {'h','i','j','a','b'},
+    {'h','i','j','r','a'},
+    {'h','i','k','e','d'},
+    {'h','i','k','e','r'},
+    {'h','i','k','e','s'},
+    {'h','i','k','o','i'},
+    {'h','i','l','a','r'},
+    {'h','i','l','c','h'},
+    {'h','i','l','l','o'},
+    {'h','i','l','l','s'},
+    {'h','i','l','l','y'},
+    {'h','i','l','s','a'},
+    {'h','i','l','t','s'},
+    {'h','i','l','u','m'},
+    {'h','i','l','u','s'},
+    {'h','i','m','b','o'},
+    {'h','i','n','a','u'},
+    {'h','i','n','d','s'},
+    {'h','i','n','g','e'},
+    {'h','i','n','g','s'},
+    {'h','i','n','k','y'},
+    {'h','i','n','n','y'},
+    {'h','i','n','t','s'},
+    {'h','i','o','i','s'},
+    {'h','i','p','e','d'},
+    {'h','i','p','e','r'},
+    {'h','i','p','e','s'},
+    {'h','i','p','l','y'},
+    {'h','i','p','p','o'},
+    {'h','i','p','p','y'},
+    {'h','i','r','e','d'},
+    {'h','i','r','e','e'},
+    {'h','i','r','e','r'},
+    {'h','i','r','e','s'},
+    {'h','i','s','s','y'},
+    {'h','i','s','t','s'},
+    {'h','i','t','c','h'},
+    {'h','i','t','h','e'},
+    {'h','i','v','e','d'},
+    {'h','i','v','e','r'},
+    {'h','i','v','e','s'},
+    {'h','i','z','e','n'},
+    {'h','o','a','c','h'},
+    {'h','o','a','e','d'},
+    {'h','o','a','g','y'},
+    {'h','o','a','r','d'},
+    {'h','o','a','r','s'},
+    {'h','o','a','r','y'},
+    {'h','o','a','s','t'},
+    {'h','o','b','b','y'},
+    {'h','o','b','o','s'},
+    {'h','o','c','k','s'},
+    {'h','o','c','u','s'},
+    {'h','o','d','a','d'},
+    {'h','o','d','j','a'},
+    {'h','o','e','r','s'},
+    {'h','o','g','a','n'},
+    {'h','o','g','e','n'},
+    {'h','o','g','g','s'},
+    {'h','o','g','h','s'},
+    {'h','o','g','o','h'},
+    {'h','o','g','o','s'},
+    {'h','o','h','e','d'},
+    {'h','o','i','c','k'},
+    {'h','o','i','e','d'},
+    {'h','o','i','k','s'},
+    {'h','o','i','n','g'},
+    {'h','o','i','s','e'},
+    {'h','o','i','s','t'},
+    {'h','o','k','a','s'},
+    {'h','o','k','e','d'},
+    {'h','o','k','e','s'},
+    {'h','o','k','e','y'},
+    {'h','o','k','i','s'},
+    {'h','o','k','k','u'},
+    {'h','o','k','u','m'},
+    {'h','o','l','d','s'},
+    {'h','o','l','e','d'},
+    {'h','o','l','e','s'},
+    {'h','o','l','e','y'},
+    {'h','o','l','k','s'},
+    {'h','o','l','l','a'},
+    {'h','o','l','l','o'},
+    {'h','o','l','l','y'},
+    {'h','o','l','m','e'},
+    {'h','o','l','m','s'},
+    {'h','o','l','o','n'},
+    {'h','o','l','o','s'},
+    {'h','o','l','t','s'},
+    {'h','o','m','a','s'},
+    {'h','o','m','e','d'},
+    {'h','o','m','e','r'},
+    {'h','o','m','e','s'},
+    {'h','o','m','e','y'},
+    {'h','o','m','i','e'},
+    {'h','o','m','m','e'},
+    {'h','o','m','o','s'},
+    {'h','o','n','a','n'},
+    {'h','o','n','d','a'},
+    {'h','o','n','d','s'},
+    {'h','o','n','e','d'},
+    {'h','o','n','e','r'},
+    {'h','o','n','e','s'},
+    {'h','o','n','e','y'},
+    {'h','o','n','g','i'},
+    {'h','o','n','g','s'},
+    {'h','o','n','k','s'},
+    {'h','o','n','k','y'},
+    {'h','o','n','o','r'},
+    {'h','o','o','c','h'},
+    {'h','o','o','d','s'},
+    {'h','o','o','d','y'},
+    {'h','o','o','e','y'},
+    {'h','o','o','f','s'},
+    {'h','o','o','g','o'},
+    {'h','o','o','h','a'},
+    {'h','o','o','k','a'},
+    {'h','o','o','k','s'},
+    {'h','o','o','k','y'},
+    {'h','o','o','l','y'},
+    {'h','o','o','n','s'},
+    {'h','o','o','p','s'},
+    {'h','o','o','r','d'},
+    {'h','o','o','r','s'},
+    {'h','o','o','s','h'},
+    {'h','o','o','t','s'},
+    {'h','o','o','t','y'},
+    {'h','o','o','v','e'},
+    {'h','o','p','a','k'},
+    {'h','o','p','e','d'},
+    {'h','o','p','e','r'},
+    {'h','o','p','e','s'},
+    {'h','o','p','p','y'},
+    {'h','o','r','a','h'},
+    {'h','o','r','a','l'},
+    {'h','o','r','a','s'},
+    {'h','o','r','d','e'},
+    {'h','o','r','i','s'},
+    {'h','o','r','k','s'},
+    {'h','o','r','m','e'},
+    {'h','o','r','n','s'},
+    {'h','o','r','n','y'},
+    {'h','o','r','s','e'},
+    {'h','o','r','s','t'},
+    {'h','o','r','s','y'},
+    {'h','o','s','e','d'},
+    {'h','o','s','e','l'},
+    {'h','o','s','e','n'},
+    {'h','o','s','e','r'},
+    {'h','o','s','e','s'},
+    {'h','o','s','e','y'},
+    {'h','o','s','t','a'},
+    {'h','o','s','t','s'},
+    {'h','o','t','c','h'},
+    {'h','o','t','e','l'},
+    {'h','o','t','e','n'},
+    {'h','o','t','i','s'},
+    {'h','o','t','l','y'},
+    {'h','o','t','t','e'},
+    {'h','o','t','t','y'},
+    {'h','o','u','f','f'},
+    {'h','o','u','f','s'},
+    {'h','o','u','g','h'},
+    {'h','o','u','n','d'},
+    {'h','o','u','r','i'},
+    {'h','o','u','r','s'},
+    {'h','o','u','s','e'},
+    {'h','o','u','t','s'},
+    {'h','o','v','e','a'},
+    {'h','o','v','e','d'},
+    {'h','o','v','e','l'},
+    {'h','o','v','e','n'},
+    {'h','o','v','e','r'},
+    {'h','o','v','e','s'},
+    {'h','o','w','a','y'},
+    {'h','o','w','b','e'},
+    {'h','o','w','d','y'},
+    {'h','o','w','e','s'},
+    {'h','o','w','f','f'},
+    {'h','o','w','f','s'},
+    {'h','o','w','k','s'},
+    {'h','o','w','l','s'},
+    {'h','o','w','r','e'},
+    {'h','o','w','s','o'},
+    {'h','o','w','t','o'},
+    {'h','o','x','e','d'},
+    {'h','o','x','e','s'},
+    {'h','o','y','a','s'},
+    {'h','o','y','e','d'},
+    {'h','o','y','l','e'},
+    {'h','u','b','b','a'},
+    {'h','u','b','b','y'},
+    {'h','u','c','k','s'},
+    {'h','u','d','n','a'},
+    {'h','u','d','u','d'},
+    {'h','u','e','r','s'},
+    {'h','u','f','f','s'},
+    {'h','u','f','f','y'},
+    {'h','u','g','e','r'},
+    {'h','u','g','g','y'},
+    {'h','u','h','u','s'},
+    {'h','u','i','a','s'},
+    {'h','u','i','e','s'},
+    {'h','u','k','o','u'},
+    {'h','u','l','a','s'},
+    {'h','u','l','e','s'},
+    {'h','u','l','k','s'},
+    {'h','u','l','k','y'},
+    {'h','u','l','l','o'},
+    {'h','u','l','l','s'},
+    {'h','u','l','l','y'},
+    {'h','u','m','a','n'},
+    {'h','u','m','a','s'},
+    {'h','u','m','f','s'},
+    {'h','u','m','i','c'},
+    {'h','u','m','i','d'},
+    {'h','u','m','o','r'},
+    {'h','u','m','p','h'},
+    {'h','u','m','p','s'},
+    {'h','u','m','p','y'},
+    {'h','u','m','u','s'},
+    {'h','u','n','c','h'},
+    {'h','u','n','d','o'},
+    {'h','u','n','k','s'},
+    {'h','u','n','k','y'},
+    {'h','u','n','t','s'},
+    {'h','u','r','d','s'},
+    {'h','u','r','l','s'},
+    {'h','u','r','l','y'},
+    {'h','u','r','r','a'},
+    {'h','u','r','r','y'},
+    {'h','u','r','s','t'},
+    {'h','u','r','t','s'},
+    {'h','u','r','t','y'},
+    {'h','u','s','h','y'},
+    {'h','u','s','k','s'},
+    {'h','u','s','k','y'},
+    {'h','u','s','o','s'},
+    {'h','u','s','s','y'},
+    {'h','u','t','c','h'},
+    {'h','u','t','i','a'},
+    {'h','u','z','z','a'},
+    {'h','u','z','z','y'},
+    {'h','w','y','l','s'},
+    {'h','y','d','e','l'},
+    {'h','y','d','r','a'},
+    {'h','y','d','r','o'},
+    {'h','y','e','n','a'},
+    {'h','y','e','n','s'},
+    {'h','y','g','g','e'},
+    {'h','y','i','n','g'},
+    {'h','y','k','e','s'},
+    {'h','y','l','a','s'},
+    {'h','y','l','e','g'},
+    {'h','y','l','e','s'},
+    {'h','y','l','i','c'},
+    {'h','y','m','e','n'},
+    {'h','y','m','n','s'},
+    {'h','y','n','d','e'},
+    {'h','y','o','i','d'},
+    {'h','y','p','e','d'},
+    {'h','y','p','e','r'},
+    {'h','y','p','e','s'},
+    {'h','y','p','h','a'},
+    {'h','y','p','h','y'},
+    {'h','y','p','o','s'},
+    {'h','y','r','a','x'},
+    {'h','y','s','o','n'},
+    {'h','y','t','h','e'},
+    {'i','a','m','b','i'},
+    {'i','a','m','b','s'},
+    {'i','b','r','i','k'},
+    {'i','c','e','r','s'},
+    {'i','c','h','e','d'},
+    {'i','c','h','e','s'},
+    {'i','c','h','o','r'},
+    {'i','c','i','e','r'},
+    {'i','c','i','l','y'},
+    {'i','c','i','n','g'},
+    {'i','c','k','e','r'},
+    {'i','c','k','l','e'},
+    {'i','c','o','n','s'},
+    {'i','c','t','a','l'},
+    {'i','c','t','i','c'},
+    {'i','c','t','u','s'},
+    {'i','d','a','n','t'},
+    {'i','d','d','a','h'},
+    {'i','d','d','a','t'},
+    {'i','d','d','u','t'},
+    {'i','d','e','a','l'},
+    {'i','d','e','a','s'},
+    {'i','d','e','e','s'},
+    {'i','d','e','n','t'},
+    {'i','d','i','o','m'},
+    {'i','d','i','o','t'},
+    {'i','d','l','e','d'},
+    {'i','d','l','e','r'},
+    {'i','d','l','e','s'},
+    {'i','d','l','i','s'},
+    {'i','d','o','l','a'},
+    {'i','d','o','l','s'},
+    {'i','d','y','l','l'},
+    {'i','d','y','l','s'},
+    {'i','f','t','a','r'},
+    {'i','g','a','p','o'},
+    {'i','g','g','e','d'},
+    {'i','g','l','o','o'},
+    {'i','g','l','u','s'},
+    {'i','g','n','i','s'},
+    {'i','h','r','a','m'},
+    {'i','i','w','i','s'},
+    {'i','k','a','n','s'},
+    {'i','k','a','t','s'},
+    {'i','k','o','n','s'},
+    {'i','l','e','a','c'},
+    {'i','l','e','a','l'},
+    {'i','l','e','u','m'},
+    {'i','l','e','u','s'},
+    {'i','l','i','a','c'},
+    {'i','l','i','a','d'},
+    {'i','l','i','a','l'},
+    {'i','l','i','u','m'},
+    {'i','l','l','e','r'},
+    {'i','l','l','t','h'},
+    {'i','m','a','g','e'},
+    {'i','m','a','g','o'},
+    {'i','m','a','g','y'},
+    {'i','m','a','m','s'},
+    {'i','m','a','r','i'},
+    {'i','m','a','u','m'},
+    {'i','m','b','a','r'},
+    {'i','m','b','e','d'},
+    {'i','m','b','o','s'},
+    {'i','m','b','u','e'},
+    {'i','m','i','d','e'},
+    {'i','m','i','d','o'},
+    {'i','m','i','d','s'},
+    {'i','m','i','n','e'},
+    {'i','m','i','n','o'},
+    {'i','m','l','i','s'},
+    {'i','m','m','e','w'},
+    {'i','m','m','i','t'},
+    {'i','m','m','i','x'},
+    {'i','m','p','e','d'},
+    {'i','m','p','e','l'},
+    {'i','m','p','i','s'},
+    {'i','m','p','l','y'},
+    {'i','m','p','o','t'},
+    {'i','m','p','r','o'},
+    {'i','m','s','h','i'},
+    {'i','m','s','h','y'},
+    {'i','n','a','n','e'},
+    {'i','n','a','p','t'},
+    {'i','n','a','r','m'},
+    {'i','n','b','o','x'},
+    {'i','n','b','y','e'},
+    {'i','n','c','a','s'},
+    {'i','n','c','e','l'},
+    {'i','n','c','l','e'},
+    {'i','n','c','o','g'},
+    {'i','n','c','u','r'},
+    {'i','n','c','u','s'},
+    {'i','n','c','u','t'},
+    {'i','n','d','e','w'},
+    {'i','n','d','e','x'},
+    {'i','n','d','i','a'},
+    {'i','n','d','i','e'},
+    {'i','n','d','o','l'},
+    {'i','n','d','o','w'},
+    {'i','n','d','r','i'},
+    {'i','n','d','u','e'},
+    {'i','n','e','p','t'},
+    {'i','n','e','r','m'},
+    {'i','n','e','r','t'},
+    {'i','n','f','e','r'},
+    {'i','n','f','i','x'},
+    {'i','n','f','o','s'},
+    {'i','n','f','r','a'},
+    {'i','n','g','a','n'},
+    {'i','n','g','l','e'},
+    {'i','n','g','o','t'},
+    {'i','n','i','o','n'},
+    {'i','n','k','e','d'},
+    {'i','n','k','e','r'},
+    {'i','n','k','l','e'},
+    {'i','n','l','a','y'},
+    {'i','n','l','e','t'},
+    {'i','n','n','e','d'},
+    {'i','n','n','e','r'},
+    {'i','n','n','i','e'},
+    {'i','n','n','i','t'},
+    {'i','n','o','r','b'},
+    {'i','n','p','u','t'},
+    {'i','n','r','o','s'},
+    {'i','n','r','u','n'},
+    {'i','n','s','e','e'},
+    {'i','n','s','e','t'},
+    {'i','n','s','p','o'},
+    {'i','n','t','e','l'},
+    {'i','n','t','e','r'},
+    {'i','n','t','i','l'},
+    {'i','n','t','i','s'},
+    {'i','n','t','r','a'},
+    {'i','n','t','r','o'},
+    {'i','n','u','l','a'},
+    {'i','n','u','r','e'},
+    {'i','n','u','r','n'},
+    {'i','n','u','s','t'},
+    {'i','n','v','a','r'},
+    {'i','n','v','e','r'},
+    {'i','n','w','i','t'},
+    {'i','o','d','i','c'},
+    {'i','o','d','i','d'},
+    {'i','o','d','i','n'},
+    {'i','o','n','i','c'},
+    {'i','o','r','a','s'},
+    {'i','o','t','a','s'},
+    {'i','p','p','o','n'},
+    {'i','r','a','d','e'},
+    {'i','r','a','t','e'},
+    {'i','r','i','d','s'},
+    {'i','r','i','n','g'},
+    {'i','r','k','e','d'},
+    {'i','r','o','k','o'},
+    {'i','r','o','n','e'},
+    {'i','r','o','n','s'},
+    {'i','r','o','n','y'},
+    {'i','s','b','a','s'},
+    {'i','s','h','e','s'},
+    {'i','s','l','e','d'},
+    {'i','s','l','e','s'},
+    {'i','s','l','e','t'},
+    {'i','s','n','a','e'},
+    {'i','s','s','e','i'},
+    {'i','s','s','u','e'},
+    {'i','s','t','l','e'},
+    {'i','t','c','h','y'},
+    {'i','t','e','m','s'},
+    {'i','t','h','e','r'},
+    {'i','v','i','e','d'},
+    {'i','v','i','e','s'},
+    {'i','v','o','r','y'},
+    {'i','x','i','a','s'},
+    {'i','x','n','a','y'},
+    {'i','x','o','r','a'},
+    {'i','x','t','l','e'},
+    {'i','z','a','r','d'},
+    {'i','z','a','r','s'},
+    {'i','z','z','a','t'},
+    {'j','a','a','p','s'},
+    {'j','a','b','o','t'},
+    {'j','a','c','a','l'},
+    {'j','a','c','e','t'},
+    {'j','a','c','k','s'},
+    {'j','a','c','k','y'},
+    {'j','a','d','e','d'},
+    {'j','a','d','e','s'},
+    {'j','a','f','a','s'},
+    {'j','a','f','f','a'},
+    {'j','a','g','a','s'},
+    {'j','a','g','e','r'},
+    {'j','a','g','g','s'},
+    {'j','a','g','g','y'},
+    {'j','a','g','i','r'},
+    {'j','a','g','r','a'},
+    {'j','a','i','l','s'},
+    {'j','a','k','e','r'},
+    {'j','a','k','e','s'},
+    {'j','a','k','e','y'},
+    {'j','a','k','i','e'},
+    {'j','a','l','a','p'},
+    {'j','a','l','e','o'},
+    {'j','a','l','o','p'},
+    {'j','a','m','b','e'},
+    {'j','a','m','b','o'},
+    {'j','a','m','b','s'},
+    {'j','a','m','b','u'},
+    {'j','a','m','e','s'},
+    {'j','a','m','m','y'},
+    {'j','a','m','o','n'},
+    {'j','a','m','u','n'},
+    {'j','a','n','e','s'},
+    {'j','a','n','k','y'},
+    {'j','a','n','n','s'},
+    {'j','a','n','n','y'},
+    {'j','a','n','t','y'},
+    {'j','a','p','a','n'},
+    {'j','a','p','e','d'},
+    {'j','a','p','e','r'},
+    {'j','a','p','e','s'},
+    {'j','a','r','k','s'},
+    {'j','a','r','l','s'},
+    {'j','a','r','p','s'},
+    {'j','a','r','t','a'},
+    {'j','a','r','u','l'},
+    {'j','a','s','e','y'},
+    {'j','a','s','p','e'},
+    {'j','a','s','p','s'},
+    {'j','a','t','h','a'},
+    {'j','a','t','i','s'},
+    {'j','a','t','o','s'},
+    {'j','a','u','k','s'},
+    {'j','a','u','n','e'},
+    {'j','a','u','n','t'},
+    {'j','a','u','p','s'},
+    {'j','a','v','a','s'},
+    {'j','a','v','e','l'},
+    {'j','a','w','a','n'},
+    {'j','a','w','e','d'},
+    {'j','a','w','n','s'},
+    {'j','a','x','i','e'},
+    {'j','a','z','z','y'},
+    {'j','e','a','n','s'},
+    {'j','e','a','t','s'},
+    {'j','e','b','e','l'},
+    {'j','e','d','i','s'},
+    {'j','e','e','l','s'},
+    {'j','e','e','l','y'},
+    {'j','e','e','p','s'},
+    {'j','e','e','r','a'},
+    {'j','e','e','r','s'},
+    {'j','e','e','z','e'},
+    {'j','e','f','e','s'},
+    {'j','e','f','f','s'},
+    {'j','e','h','a','d'},
+    {'j','e','h','u','s'},
+    {'j','e','l','a','b'},
+    {'j','e','l','l','o'},
+    {'j','e','l','l','s'},
+    {'j','e','l','l','y'},
+    {'j','e','m','b','e'},
+    {'j','e','m','m','y'},
+    {'j','e','n','n','y'},
+    {'j','e','o','n','s'},
+    {'j','e','r','i','d'},
+    {'j','e','r','k','s'},
+    {'j','e','r','k','y'},
+    {'j','e','r','r','y'},
+    {'j','e','s','s','e'},
+    {'j','e','s','s','y'},
+    {'j','e','s','t','s'},
+    {'j','e','s','u','s'},
+    {'j','e','t','e','e'},
+    {'j','e','t','e','s'},
+    {'j','e','t','o','n'},
+    {'j','e','t','t','y'},
+    {'j','e','u','n','e'},
+    {'j','e','w','e','d'},
+    {'j','e','w','e','l'},
+    {'j','e','w','i','e'},
+    {'j','h','a','l','a'},
+    {'j','h','e','e','l'},
+    {'j','h','i','l','s'},
+    {'j','i','a','o','s'},
+    {'j','i','b','b','a'},
+    {'j','i','b','b','s'},
+    {'j','i','b','e','d'},
+    {'j','i','b','e','r'},
+    {'j','i','b','e','s'},
+    {'j','i','f','f','s'},
+    {'j','i','f','f','y'},
+    {'j','i','g','g','y'},
+    {'j','i','g','o','t'},
+    {'j','i','h','a','d'},
+    {'j','i','l','l','s'},
+    {'j','i','l','t','s'},
+    {'j','i','m','m','y'},
+    {'j','i','m','p','y'},
+    {'j','i','n','g','o'},
+    {'j','i','n','g','s'},
+    {'j','i','n','k','s'},
+    {'j','i','n','n','e'},
+    {'j','i','n','n','i'},
+    {'j','i','n','n','s'},
+    {'j','i','r','d','s'},
+    {'j','i','r','g','a'},
+    {'j','i','r','r','e'},
+    {'j','i','s','m','s'},
+    {'j','i','t','i','s'},
+    {'j','i','t','t','y'},
+    {'j','i','v','e','d'},
+    {'j','i','v','e','r'},
+    {'j','i','v','e','s'},
+    {'j','i','v','e','y'},
+    {'j','n','a','n','a'},
+    {'j','o','b','e','d'},
+    {'j','o','b','e','s'},
+    {'j','o','c','k','o'},
+    {'j','o','c','k','s'},
+    {'j','o','c','k','y'},
+    {'j','o','c','o','s'},
+    {'j','o','d','e','l'},
+    {'j','o','e','y','s'},
+    {'j','o','h','n','s'},
+    {'j','o','i','n','s'},
+    {'j','o','i','n','t'},
+    {'j','o','i','s','t'},
+    {'j','o','k','e','d'},
+    {'j','o','k','e','r'},
+    {'j','o','k','e','s'},
+    {'j','o','k','e','y'},
+    {'j','o','k','o','l'},
+    {'j','o','l','e','d'},
+    {'j','o','l','e','s'},
+    {'j','o','l','i','e'},
+    {'j','o','l','l','o'},
+    {'j','o','l','l','s'},
+    {'j','o','l','l','y'},
+    {'j','o','l','t','s'},
+    {'j','o','l','t','y'},
+    {'j','o','m','o','n'},
+    {'j','o','m','o','s'},
+    {'j','o','n','e','s'},
+    {'j','o','n','g','s'},
+    {'j','o','n','t','y'},
+    {'j','o','o','k','s'},
+    {'j','o','r','a','m'},
+    {'j','o','r','t','s'},
+    {'j','o','r','u','m'},
+    {'j','o','t','a','s'},
+    {'j','o','t','t','y'},
+    {'j','o','t','u','n'},
+    {'j','o','u','a','l'},
+    {'j','o','u','g','s'},
+    {'j','o','u','k','s'},
+    {'j','o','u','l','e'},
+    {'j','o','u','r','s'},
+    {'j','o','u','s','t'},
+    {'j','o','w','a','r'},
+    {'j','o','w','e','d'},
+    {'j','o','w','l','s'},
+    {'j','o','w','l','y'},
+    {'j','o','y','e','d'},
+    {'j','u','b','a','s'},
+    {'j','u','b','e','s'},
+    {'j','u','c','o','s'},
+    {'j','u','d','a','s'},
+    {'j','u','d','g','e'},
+    {'j','u','d','g','y'},
+    {'j','u','d','o','s'},
+    {'j','u','g','a','l'},
+    {'j','u','g','u','m'},
+    {'j','u','i','c','e'},
+    {'j','u','i','c','y'},
+    {'j','u','j','u','s'},
+    {'j','u','k','e','d'},
+    {'j','u','k','e','s'},
+    {'j','u','k','u','s'},
+    {'j','u','l','e','p'},
+    {'j','u','l','i','a'},
+    {'j','u','m','a','r'},
+    {'j','u','m','b','o'},
+    {'j','u','m','b','y'},
+    {'j','u','m','p','s'},
+    {'j','u','m','p','y'},
+    {'j','u','n','c','o'},
+    {'j','u','n','k','s'},
+    {'j','u','n','k','y'},
+    {'j','u','n','t','a'},
+    {'j','u','n','t','o'},
+    {'j','u','p','e','s'},
+    {'j','u','p','o','n'},
+    {'j','u','r','a','l'},
+    {'j','u','r','a','t'},
+    {'j','u','r','e','l'},
+    {'j','u','r','e','s'},
+    {'j','u','r','i','s'},
+    {'j','u','r','o','r'},
+    {'j','u','s','t','e'},
+    {'j','u','s','t','s'},
+    {'j','u','t','e','s'},
+    {'j','u','t','t','y'},
+    {'j','u','v','e','s'},
+    {'j','u','v','i','e'},
+    {'k','a','a','m','a'},
+    {'k','a','b','a','b'},
+    {'k','a','b','a','r'},
+    {'k','a','b','o','b'},
+    {'k','a','c','h','a'},
+    {'k','a','c','k','s'},
+    {'k','a','d','a','i'},
+    {'k','a','d','e','s'},
+    {'k','a','d','i','s'},
+    {'k','a','f','i','r'},
+    {'k','a','g','o','s'},
+    {'k','a','g','u','s'},
+    {'k','a','h','a','l'},
+    {'k','a','i','a','k'},
+    {'k','a','i','d','s'},
+    {'k','a','i','e','s'},
+    {'k','a','i','f','s'},
+    {'k','a','i','k','a'},
+    {'k','a','i','k','s'},
+    {'k','a','i','l','s'},
+    {'k','a','i','m','s'},
+    {'k','a','i','n','g'},
+    {'k','a','i','n','s'},
+    {'k','a','j','a','l'},
+    {'k','a','k','a','s'},
+    {'k','a','k','i','s'},
+    {'k','a','l','a','m'},
+    {'k','a','l','a','s'},
+    {'k','a','l','e','s'},
+    {'k','a','l','i','f'},
+    {'k','a','l','i','s'},
+    {'k','a','l','p','a'},
+    {'k','a','l','u','a'},
+    {'k','a','m','a','s'},
+    {'k','a','m','e','s'},
+    {'k','a','m','i','k'},
+    {'k','a','m','i','s'},
+    {'k','a','m','m','e'},
+    {'k','a','n','a','e'},
+    {'k','a','n','a','l'},
+    {'k','a','n','a','s'},
+    {'k','a','n','a','t'},
+    {'k','a','n','d','y'},
+    {'k','a','n','e','h'},
+    {'k','a','n','e','s'},
+    {'k','a','n','g','a'},
+    {'k','a','n','g','s'},
+    {'k','a','n','j','i'},
+    {'k','a','n','t','s'},
+    {'k','a','n','z','u'},
+    {'k','a','o','n','s'},
+    {'k','a','p','a','i'},
+    {'k','a','p','a','s'},
+    {'k','a','p','h','a'},
+    {'k','a','p','h','s'},
+    {'k','a','p','o','k'},
+    {'k','a','p','o','w'},
+    {'k','a','p','p','a'},
+    {'k','a','p','u','r'},
+    {'k','a','p','u','s'},
+    {'k','a','p','u','t'},
+    {'k','a','r','a','i'},
+    {'k','a','r','a','s'},
+    {'k','a','r','a','t'},
+    {'k','a','r','e','e'},
+    {'k','a','r','e','z'},
+    {'k','a','r','k','s'},
+    {'k','a','r','m','a'},
+    {'k','a','r','n','s'},
+    {'k','a','r','o','o'},
+    {'k','a','r','o','s'},
+    {'k','a','r','r','i'},
+    {'k','a','r','s','t'},
+    {'k','a','r','s','y'},
+    {'k','a','r','t','s'},
+    {'k','a','r','z','y'},
+    {'k','a','s','h','a'},
+    {'k','a','s','m','e'},
+    {'k','a','t','a','l'},
+    {'k','a','t','a','s'},
+    {'k','a','t','i','s'},
+    {'k','a','t','t','i'},
+    {'k','a','u','g','h'},
+    {'k','a','u','r','i'},
+    {'k','a','u','r','u'},
+    {'k','a','u','r','y'},
+    {'k','a','v','a','l'},
+    {'k','a','v','a','s'},
+    {'k','a','w','a','s'},
+    {'k','a','w','a','u'},
+    {'k','a','w','e','d'},
+    {'k','a','y','a','k'},
+    {'k','a','y','l','e'},
+    {'k','a','y','o','s'},
+    {'k','a','z','i','s'},
+    {'k','a','z','o','o'},
+    {'k','b','a','r','s'},
+    {'k','c','a','l','s'},
+    {'k','e','a','k','i'},
+    {'k','e','b','a','b'},
+    {'k','e','b','a','r'},
+    {'k','e','b','o','b'},
+    {'k','e','c','k','s'},
+    {'k','e','d','g','e'},
+    {'k','e','d','g','y'},
+    {'k','e','e','c','h'},
+    {'k','e','e','f','s'},
+    {'k','e','e','k','s'},
+    {'k','e','e','l','s'},
+    {'k','e','e','m','a'},
+    {'k','e','e','n','o'},
+    {'k','e','e','n','s'},
+    {'k','e','e','p','s'},
+    {'k','e','e','t','s'},
+    {'k','e','e','v','e'},
+    {'k','e','f','i','r'},
+    {'k','e','h','u','a'},
+    {'k','e','i','r','s'},
+    {'k','e','l','e','p'},
+    {'k','e','l','i','m'},
+    {'k','e','l','l','s'},
+    {'k','e','l','l','y'},
+    {'k','e','l','p','s'},
+    {'k','e','l','p','y'},
+    {'k','e','l','t','s'},
+    {'k','e','l','t','y'},
+    {'k','e','m','b','o'},
+    {'k','e','m','b','s'},
+    {'k','e','m','p','s'},
+    {'k','e','m','p','t'},
+    {'k','e','m','p','y'},
+    {'k','e','n','a','f'},
+    {'k','e','n','c','h'},
+    {'k','e','n','d','o'},
+    {'k','e','n','o','s'},
+    {'k','e','n','t','e'},
+    {'k','e','n','t','s'},
+    {'k','e','p','i','s'},
+    {'k','e','r','b','s'},
+    {'k','e','r','e','l'},
+    {'k','e','r','f','s'},
+    {'k','e','r','k','y'},
+    {'k','e','r','m','a'},
+    {'k','e','r','n','e'},
+    {'k','e','r','n','s'},
+    {'k','e','r','o','s'},
+    {'k','e','r','r','y'},
+    {'k','e','r','v','e'},
+    {'k','e','s','a','r'},
+    {'k','e','s','t','s'},
+    {'k','e','t','a','s'},
+    {'k','e','t','c','h'},
+    {'k','e','t','e','s'},
+    {'k','e','t','o','l'},
+    {'k','e','v','e','l'},
+    {'k','e','v','i','l'},
+    {'k','e','x','e','s'},
+    {'k','e','y','e','d'},
+    {'k','e','y','e','r'},
+    {'k','h','a','d','i'},
+    {'k','h','a','d','s'},
+    {'k','h','a','f','s'},
+    {'k','h','a','k','i'},
+    {'k','h','a','n','a'},
+    {'k','h','a','n','s'},
+    {'k','h','a','p','h'},
+    {'k','h','a','t','s'},
+    {'k','h','a','y','a'},
+    {'k','h','a','z','i'},
+    {'k','h','e','d','a'},
+    {'k','h','e','e','r'},
+    {'k','h','e','t','h'},
+    {'k','h','e','t','s'},
+    {'k','h','i','r','s'},
+    {'k','h','o','j','a'},
+    {'k','h','o','r','s'},
+    {'k','h','o','u','m'},
+    {'k','h','u','d','s'},
+    {'k','h','u','l','a'},
+    {'k','h','y','a','l'},
+    {'k','i','a','a','t'},
+    {'k','i','a','c','k'},
+    {'k','i','a','k','i'},
+    {'k','i','a','n','g'},
+    {'k','i','a','s','u'},
+    {'k','i','b','b','e'},
+    {'k','i','b','b','i'},
+    {'k','i','b','e','i'},
+    {'k','i','b','e','s'},
+    {'k','i','b','l','a'},
+    {'k','i','c','k','s'},
+    {'k','i','c','k','y'},
+    {'k','i','d','d','o'},
+    {'k','i','d','d','y'},
+    {'k','i','d','e','l'},
+    {'k','i','d','e','o'},
+    {'k','i','d','g','e'},
+    {'k','i','e','f','s'},
+    {'k','i','e','r','s'},
+    {'k','i','e','v','e'},
+    {'k','i','e','v','s'},
+    {'k','i','g','h','t'},
+    {'k','i','k','a','y'},
+    {'k','i','k','e','s'},
+    {'k','i','k','o','i'},
+    {'k','i','l','e','y'},
+    {'k','i','l','i','g'},
+    {'k','i','l','i','m'},
+    {'k','i','l','l','s'},
+    {'k','i','l','n','s'},
+    {'k','i','l','o','s'},
+    {'k','i','l','p','s'},
+    {'k','i','l','t','s'},
+    {'k','i','l','t','y'},
+    {'k','i','m','b','o'},
+    {'k','i','m','e','t'},
+    {'k','i','n','a','s'},
+    {'k','i','n','d','a'},
+    {'k','i','n','d','s'},
+    {'k','i','n','d','y'},
+    {'k','i','n','e','s'},
+    {'k','i','n','g','s'},
+    {'k','i','n','g','y'},
+    {'k','i','n','i','n'},
+    {'k','i','n','k','s'},
+    {'k','i','n','k','y'},
+    {'k','i','n','o','s'},
+    {'k','i','o','r','e'},
+    {'k','i','o','s','k'},
+    {'k','i','p','a','h'},
+    {'k','i','p','a','s'},
+    {'k','i','p','e','s'},
+    {'k','i','p','p','a'},
+    {'k','i','p','p','s'},
+    {'k','i','p','s','y'},
+    {'k','i','r','b','y'},
+    {'k','i','r','k','s'},
+    {'k','i','r','n','s'},
+    {'k','i','r','r','i'},
+    {'k','i','s','a','n'},
+    {'k','i','s','s','y'},
+    {'k','i','s','t','s'},
+    {'k','i','t','a','b'},
+    {'k','i','t','e','d'},
+    {'k','i','t','e','r'},
+    {'k','i','t','e','s'},
+    {'k','i','t','h','e'},
+    {'k','i','t','h','s'},
+    {'k','i','t','k','e'},
+    {'k','i','t','t','y'},
+    {'k','i','t','u','l'},
+    {'k','i','v','a','s'},
+    {'k','i','w','i','s'},
+    {'k','l','a','n','g'},
+    {'k','l','a','p','s'},
+    {'k','l','e','t','t'},
+    {'k','l','i','c','k'},
+    {'k','l','i','e','g'},
+    {'k','l','i','k','s'},
+    {'k','l','o','n','g'},
+    {'k','l','o','o','f'},
+    {'k','l','u','g','e'},
+    {'k','l','u','t','z'},
+    {'k','n','a','c','k'},
+    {'k','n','a','g','s'},
+    {'k','n','a','p','s'},
+    {'k','n','a','r','l'},
+    {'k','n','a','r','s'},
+    {'k','n','a','u','r'},
+    {'k','n','a','v','e'},
+    {'k','n','a','w','e'},
+    {'k','n','e','a','d'},
+    {'k','n','e','e','d'},
+    {'k','n','e','e','l'},
+    {'k','n','e','e','s'},
+    {'k','n','e','l','l'},
+    {'k','n','e','l','t'},
+    {'k','n','i','c','k'},
+    {'k','n','i','f','e'},
+    {'k','n','i','s','h'},
+    {'k','n','i','t','s'},
+    {'k','n','i','v','e'},
+    {'k','n','o','b','s'},
+    {'k','n','o','c','k'},
+    {'k','n','o','l','l'},
+    {'k','n','o','o','p'},
+    {'k','n','o','p','s'},
+    {'k','n','o','s','p'},
+    {'k','n','o','t','s'},
+    {'k','n','o','u','d'},
+    {'k','n','o','u','t'},
+    {'k','n','o','w','d'},
+    {'k','n','o','w','e'},
+    {'k','n','o','w','n'},
+    {'k','n','o','w','s'},
+    {'k','n','u','b','s'},
+    {'k','n','u','l','e'},
+    {'k','n','u','r','l'},
+    {'k','n','u','r','r'},
+    {'k','n','u','r','s'},
+    {'k','n','u','t','s'},
+    {'k','o','a','l','a'},
+    {'k','o','a','n','s'},
+    {'k','o','a','p','s'},
+    {'k','o','b','a','n'},
+    {'k','o','b','o','s'},
+    {'k','o','e','l','s'},
+    {'k','o','f','f','s'},
+    {'k','o','f','t','a'},
+    {'k','o','g','a','l'},
+    {'k','o','h','a','s'},
+    {'k','o','h','e','n'},
+    {'k','o','h','l','s'},
+    {'k','o','i','n','e'},
+    {'k','o','i','w','i'},
+    {'k','o','j','i','s'},
+    {'k','o','k','a','m'},
+    {'k','o','k','a','s'},
+    {'k','o','k','e','r'},
+    {'k','o','k','r','a'},
+    {'k','o','k','u','m'},
+    {'k','o','l','a','s'},
+    {'k','o','l','o','s'},
+    {'k','o','m','b','i'},
+    {'k','o','m','b','u'},
+    {'k','o','n','b','u'},
+    {'k','o','n','d','o'},
+    {'k','o','n','k','s'},
+    {'k','o','o','k','s'},
+    {'k','o','o','k','y'},
+    {'k','o','o','r','i'},
+    {'k','o','p','e','k'},
+    {'k','o','p','h','s'},
+    {'k','o','p','j','e'},
+    {'k','o','p','p','a'},
+    {'k','o','r','a','i'},
+    {'k','o','r','a','n'},
+    {'k','o','r','a','s'},
+    {'k','o','r','a','t'},
+    {'k','o','r','e','s'},
+    {'k','o','r','i','s'},
+    {'k','o','r','m','a'},
+    {'k','o','r','o','s'},
+    {'k','o','r','u','n'},
+    {'k','o','r','u','s'},
+    {'k','o','s','e','s'},
+    {'k','o','t','c','h'},
+    {'k','o','t','o','s'},
+    {'k','o','t','o','w'},
+    {'k','o','u','r','a'},
+    {'k','r','a','a','l'},
+    {'k','r','a','b','s'},
+    {'k','r','a','f','t'},
+    {'k','r','a','i','s'},
+    {'k','r','a','i','t'},
+    {'k','r','a','n','g'},
+    {'k','r','a','n','s'},
+    {'k','r','a','n','z'},
+    {'k','r','a','u','t'},
+    {'k','r','a','y','s'},
+    {'k','r','e','e','f'},
+    {'k','r','e','e','n'},
+    {'k','r','e','e','p'},
+    {'k','r','e','n','g'},
+    {'k','r','e','w','e'},
+    {'k','r','i','l','l'},
+    {'k','r','i','o','l'},
+    {'k','r','o','n','a'},
+    {'k','r','o','n','e'},
+    {'k','r','o','o','n'},
+    {'k','r','u','b','i'},
+    {'k','r','u','m','p'},
+    {'k','r','u','n','k'},
+    {'k','s','a','r','s'},
+    {'k','u','b','i','e'},
+    {'k','u','d','o','s'},
+    {'k','u','d','u','s'},
+    {'k','u','d','z','u'},
+    {'k','u','f','i','s'},
+    {'k','u','g','e','l'},
+    {'k','u','i','a','s'},
+    {'k','u','k','r','i'},
+    {'k','u','k','u','s'},
+    {'k','u','l','a','k'},
+    {'k','u','l','a','n'},
+    {'k','u','l','a','s'},
+    {'k','u','l','f','i'},
+    {'k','u','m','i','s'},
+    {'k','u','m','y','s'},
+    {'k','u','n','a','s'},
+    {'k','u','n','d','s'},
+    {'k','u','r','i','s'},
+    {'k','u','r','r','e'},
+    {'k','u','r','t','a'},
+    {'k','u','r','u','s'},
+    {'k','u','s','s','o'},
+    {'k','u','s','t','i'},
+    {'k','u','t','a','i'},
+    {'k','u','t','a','s'},
+    {'k','u','t','c','h'},
+    {'k','u','t','i','s'},
+    {'k','u','t','u','s'},
+    {'k','u','y','a','s'},
+    {'k','u','z','u','s'},
+    {'k','v','a','s','s'},
+    {'k','v','e','l','l'},
+    {'k','w','a','a','i'},
+    {'k','w','e','l','a'},
+    {'k','w','i','n','k'},
+    {'k','w','i','r','l'},
+    {'k','y','a','c','k'},
+    {'k','y','a','k','s'},
+    {'k','y','a','n','g'},
+    {'k','y','a','r','s'},
+    {'k','y','a','t','s'},
+    {'k','y','b','o','s'},
+    {'k','y','d','s','t'},
+    {'k','y','l','e','s'},
+    {'k','y','l','i','e'},
+    {'k','y','l','i','n'},
+    {'k','y','l','i','x'},
+    {'k','y','l','o','e'},
+    {'k','y','n','d','e'},
+    {'k','y','n','d','s'},
+    {'k','y','p','e','s'},
+    {'k','y','r','i','e'},
+    {'k','y','t','e','s'},
+    {'k','y','t','h','e'},
+    {'k','y','u','d','o'},
+    {'l','a','a','r','f'},
+    {'l','a','a','r','i'},
+    {'l','a','b','d','a'},
+    {'l','a','b','e','l'},
+    {'l','a','b','i','a'},
+    {'l','a','b','i','s'},
+    {'l','a','b','n','e'},
+    {'l','a','b','o','r'},
+    {'l','a','b','r','a'},
+    {'l','a','c','c','y'},
+    {'l','a','c','e','d'},
+    {'l','a','c','e','r'},
+    {'l','a','c','e','s'},
+    {'l','a','c','e','t'},
+    {'l','a','c','e','y'},
+    {'l','a','c','i','s'},
+    {'l','a','c','k','a'},
+    {'l','a','c','k','s'},
+    {'l','a','c','k','y'},
+    {'l','a','d','d','u'},
+    {'l','a','d','d','y'},
+    {'l','a','d','e','d'},
+    {'l','a','d','e','e'},
+    {'l','a','d','e','n'},
+    {'l','a','d','e','r'},
+    {'l','a','d','e','s'},
+    {'l','a','d','l','e'},
+    {'l','a','d','o','o'},
+    {'l','a','e','r','s'},
+    {'l','a','e','v','o'},
+    {'l','a','g','a','n'},
+    {'l','a','g','a','r'},
+    {'l','a','g','e','r'},
+    {'l','a','g','g','y'},
+    {'l','a','h','a','l'},
+    {'l','a','h','a','r'},
+    {'l','a','i','c','h'},
+    {'l','a','i','c','s'},
+    {'l','a','i','d','e'},
+    {'l','a','i','d','s'},
+    {'l','a','i','g','h'},
+    {'l','a','i','k','a'},
+    {'l','a','i','k','s'},
+    {'l','a','i','r','d'},
+    {'l','a','i','r','s'},
+    {'l','a','i','r','y'},
+    {'l','a','i','t','h'},
+    {'l','a','i','t','y'},
+    {'l','a','k','e','d'},
+    {'l','a','k','e','r'},
+    {'l','a','k','e','s'},
+    {'l','a','k','h','s'},
+    {'l','a','k','i','n'},
+    {'l','a','k','s','a'},
+    {'l','a','l','d','y'},
+    {'l','a','l','l','s'},
+    {'l','a','m','a','s'},
+    {'l','a','m','b','s'},
+    {'l','a','m','b','y'},
+    {'l','a','m','e','d'},
+    {'l','a','m','e','r'},
+    {'l','a','m','e','s'},
+    {'l','a','m','i','a'},
+    {'l','a','m','m','y'},
+    {'l','a','m','p','s'},
+    {'l','a','n','a','i'},
+    {'l','a','n','a','s'},
+    {'l','a','n','c','e'},
+    {'l','a','n','c','h'},
+    {'l','a','n','d','e'},
+    {'l','a','n','d','s'},
+    {'l','a','n','e','d'},
+    {'l','a','n','e','s'},
+    {'l','a','n','k','s'},
+    {'l','a','n','k','y'},
+    {'l','a','n','t','s'},
+    {'l','a','p','a','s'},
+    {'l','a','p','e','l'},
+    {'l','a','p','i','n'},
+    {'l','a','p','i','s'},
+    {'l','a','p','j','e'},
+    {'l','a','p','p','a'},
+    {'l','a','p','p','y'},
+    {'l','a','p','s','e'},
+    {'l','a','r','c','h'},
+    {'l','a','r','d','s'},
+    {'l','a','r','d','y'},
+    {'l','a','r','e','e'},
+    {'l','a','r','e','s'},
+    {'l','a','r','f','s'},
+    {'l','a','r','g','a'},
+    {'l','a','r','g','e'},
+    {'l','a','r','g','o'},
+    {'l','a','r','i','s'},
+    {'l','a','r','k','s'},
+    {'l','a','r','k','y'},
+    {'l','a','r','n','s'},
+    {'l','a','r','n','t'},
+    {'l','a','r','u','m'},
+    {'l','a','r','v','a'},
+    {'l','a','s','e','d'},
+    {'l','a','s','e','r'},
+    {'l','a','s','e','s'},
+    {'l','a','s','s','i'},
+    {'l','a','s','s','o'},
+    {'l','a','s','s','u'},
+    {'l','a','s','s','y'},
+    {'l','a','s','t','s'},
+    {'l','a','t','a','h'},
+    {'l','a','t','c','h'},
+    {'l','a','t','e','d'},
+    {'l','a','t','e','n'},
+    {'l','a','t','e','r'},
+    {'l','a','t','e','x'},
+    {'l','a','t','h','e'},
+    {'l','a','t','h','i'},
+    {'l','a','t','h','s'},
+    {'l','a','t','h','y'},
+    {'l','a','t','k','e'},
+    {'l','a','t','t','e'},
+    {'l','a','t','u','s'},
+    {'l','a','u','a','n'},
+    {'l','a','u','c','h'},
+    {'l','a','u','d','e'},
+    {'l','a','u','d','s'},
+    {'l','a','u','f','s'},
+    {'l','a','u','g','h'},
+    {'l','a','u','n','d'},
+    {'l','a','u','r','a'},
+    {'l','a','v','a','l'},
+    {'l','a','v','a','s'},
+    {'l','a','v','e','d'},
+    {'l','a','v','e','r'},
+    {'l','a','v','e','s'},
+    {'l','a','v','r','a'},
+    {'l','a','v','v','y'},
+    {'l','a','w','e','d'},
+    {'l','a','w','e','r'},
+    {'l','a','w','i','n'},
+    {'l','a','w','k','s'},
+    {'l','a','w','n','s'},
+    {'l','a','w','n','y'},
+    {'l','a','w','s','y'},
+    {'l','a','x','e','d'},
+    {'l','a','x','e','r'},
+    {'l','a','x','e','s'},
+    {'l','a','x','l','y'},
+    {'l','a','y','b','y'},
+    {'l','a','y','e','d'},
+    {'l','a','y','e','r'},
+    {'l','a','y','i','n'},
+    {'l','a','y','u','p'},
+    {'l','a','z','a','r'},
+    {'l','a','z','e','d'},
+    {'l','a','z','e','s'},
+    {'l','a','z','o','s'},
+    {'l','a','z','z','i'},
+    {'l','a','z','z','o'},
+    {'l','e','a','c','h'},
+    {'l','e','a','d','s'},
+    {'l','e','a','d','y'},
+    {'l','e','a','f','s'},
+    {'l','e','a','f','y'},
+    {'l','e','a','k','s'},
+    {'l','e','a','k','y'},
+    {'l','e','a','m','s'},
+    {'l','e','a','n','s'},
+    {'l','e','a','n','t'},
+    {'l','e','a','n','y'},
+    {'l','e','a','p','s'},
+    {'l','e','a','p','t'},
+    {'l','e','a','r','e'},
+    {'l','e','a','r','n'},
+    {'l','e','a','r','s'},
+    {'l','e','a','r','y'},
+    {'l','e','a','s','e'},
+    {'l','e','a','s','h'},
+    {'l','e','a','s','t'},
+    {'l','e','a','t','s'},
+    {'l','e','a','v','e'},
+    {'l','e','a','v','y'},
+    {'l','e','a','z','e'},
+    {'l','e','b','e','n'},
+    {'l','e','c','c','y'},
+    {'l','e','c','h','e'},
+    {'l','e','d','e','s'},
+    {'l','e','d','g','e'},
+    {'l','e','d','g','y'},
+    {'l','e','d','u','m'},
+    {'l','e','e','a','r'},
+    {'l','e','e','c','h'},
+    {'l','e','e','k','s'},
+    {'l','e','e','p','s'},
+    {'l','e','e','r','s'},
+    {'l','e','e','r','y'},
+    {'l','e','e','s','e'},
+    {'l','e','e','t','s'},
+    {'l','e','e','z','e'},
+    {'l','e','f','t','e'},
+    {'l','e','f','t','s'},
+    {'l','e','f','t','y'},
+    {'l','e','g','a','l'},
+    {'l','e','g','e','r'},
+    {'l','e','g','e','s'},
+    {'l','e','g','g','e'},
+    {'l','e','g','g','o'},
+    {'l','e','g','g','y'},
+    {'l','e','g','i','t'},
+    {'l','e','g','n','o'},
+    {'l','e','h','r','s'},
+    {'l','e','h','u','a'},
+    {'l','e','i','r','s'},
+    {'l','e','i','s','h'},
+    {'l','e','m','a','n'},
+    {'l','e','m','e','d'},
+    {'l','e','m','e','l'},
+    {'l','e','m','e','s'},
+    {'l','e','m','m','a'},
+    {'l','e','m','m','e'},
+    {'l','e','m','o','n'},
+    {'l','e','m','u','r'},
+    {'l','e','n','d','s'},
+    {'l','e','n','e','s'},
+    {'l','e','n','g','s'},
+    {'l','e','n','i','s'},
+    {'l','e','n','o','s'},
+    {'l','e','n','s','e'},
+    {'l','e','n','t','i'},
+    {'l','e','n','t','o'},
+    {'l','e','o','n','e'},
+    {'l','e','p','a','k'},
+    {'l','e','p','e','r'},
+    {'l','e','p','i','d'},
+    {'l','e','p','r','a'},
+    {'l','e','p','t','a'},
+    {'l','e','r','e','d'},
+    {'l','e','r','e','s'},
+    {'l','e','r','p','s'},
+    {'l','e','s','b','o'},
+    {'l','e','s','e','s'},
+    {'l','e','s','o','s'},
+    {'l','e','s','t','s'},
+    {'l','e','t','c','h'},
+    {'l','e','t','h','e'},
+    {'l','e','t','t','y'},
+    {'l','e','t','u','p'},
+    {'l','e','u','c','h'},
+    {'l','e','u','c','o'},
+    {'l','e','u','d','s'},
+    {'l','e','u','g','h'},
+    {'l','e','v','a','s'},
+    {'l','e','v','e','e'},
+    {'l','e','v','e','l'},
+    {'l','e','v','e','r'},
+    {'l','e','v','e','s'},
+    {'l','e','v','i','n'},
+    {'l','e','v','i','s'},
+    {'l','e','w','i','s'},
+    {'l','e','x','e','s'},
+    {'l','e','x','i','s'},
+    {'l','e','z','e','s'},
+    {'l','e','z','z','a'},
+    {'l','e','z','z','o'},
+    {'l','e','z','z','y'},
+    {'l','i','a','n','a'},
+    {'l','i','a','n','e'},
+    {'l','i','a','n','g'},
+    {'l','i','a','r','d'},
+    {'l','i','a','r','s'},
+    {'l','i','a','r','t'},
+    {'l','i','b','e','l'},
+    {'l','i','b','e','r'},
+    {'l','i','b','o','r'},
+    {'l','i','b','r','a'},
+    {'l','i','b','r','e'},
+    {'l','i','b','r','i'},
+    {'l','i','c','e','t'},
+    {'l','i','c','h','i'},
+    {'l','i','c','h','t'},
+    {'l','i','c','i','t'},
+    {'l','i','c','k','s'},
+    {'l','i','d','a','r'},
+    {'l','i','d','o','s'},
+    {'l','i','e','f','s'},
+    {'l','i','e','g','e'},
+    {'l','i','e','n','s'},
+    {'l','i','e','r','s'},
+    {'l','i','e','u','s'},
+    {'l','i','e','v','e'},
+    {'l','i','f','e','r'},
+    {'l','i','f','e','s'},
+    {'l','i','f','e','y'},
+    {'l','i','f','t','s'},
+    {'l','i','g','a','n'},
+    {'l','i','g','e','r'},
+    {'l','i','g','g','e'},
+    {'l','i','g','h','t'},
+    {'l','i','g','n','e'},
+    {'l','i','k','e','d'},
+    {'l','i','k','e','n'},
+    {'l','i','k','e','r'},
+    {'l','i','k','e','s'},
+    {'l','i','k','i','n'},
+    {'l','i','l','a','c'},
+    {'l','i','l','l','s'},
+    {'l','i','l','o','s'},
+    {'l','i','l','t','s'},
+    {'l','i','l','t','y'},
+    {'l','i','m','a','n'},
+    {'l','i','m','a','s'},
+    {'l','i','m','a','x'},
+    {'l','i','m','b','a'},
+    {'l','i','m','b','i'},
+    {'l','i','m','b','o'},
+    {'l','i','m','b','s'},
+    {'l','i','m','b','y'},
+    {'l','i','m','e','d'},
+    {'l','i','m','e','n'},
+    {'l','i','m','e','s'},
+    {'l','i','m','e','y'},
+    {'l','i','m','i','t'},
+    {'l','i','m','m','a'},
+    {'l','i','m','n','s'},
+    {'l','i','m','o','s'},
+    {'l','i','m','p','a'},
+    {'l','i','m','p','s'},
+    {'l','i','n','a','c'},
+    {'l','i','n','c','h'},
+    {'l','i','n','d','s'},
+    {'l','i','n','d','y'},
+    {'l','i','n','e','d'},
+    {'l','i','n','e','n'},
+    {'l','i','n','e','r'},
+    {'l','i','n','e','s'},
+    {'l','i','n','e','y'},
+    {'l','i','n','g','a'},
+    {'l','i','n','g','o'},
+    {'l','i','n','g','s'},
+    {'l','i','n','g','y'},
+    {'l','i','n','i','n'},
+    {'l','i','n','k','s'},
+    {'l','i','n','k','y'},
+    {'l','i','n','n','s'},
+    {'l','i','n','n','y'},
+    {'l','i','n','o','s'},
+    {'l','i','n','t','s'},
+    {'l','i','n','t','y'},
+    {'l','i','n','u','m'},
+    {'l','i','n','u','x'},
+    {'l','i','o','n','s'},
+    {'l','i','p','a','s'},
+    {'l','i','p','e','s'},
+    {'l','i','p','i','d'},
+    {'l','i','p','i','n'},
+    {'l','i','p','o','s'},
+    {'l','i','p','p','y'},
+    {'l','i','r','a','s'},
+    {'l','i','r','k','s'},
+    {'l','i','r','o','t'},
+    {'l','i','s','e','s'},
+    {'l','i','s','k','s'},
+    {'l','i','s','l','e'},
+    {'l','i','s','p','s'},
+    {'l','i','s','t','s'},
+    {'l','i','t','a','i'},
+    {'l','i','t','a','s'},
+    {'l','i','t','e','d'},
+    {'l','i','t','e','m'},
+    {'l','i','t','e','r'},
+    {'l','i','t','e','s'},
+    {'l','i','t','h','e'},
+    {'l','i','t','h','o'},
+    {'l','i','t','h','s'},
+    {'l','i','t','i','e'},
+    {'l','i','t','r','e'},
+    {'l','i','v','e','d'},
+    {'l','i','v','e','n'},
+    {'l','i','v','e','r'},
+    {'l','i','v','e','s'},
+    {'l','i','v','i','d'},
+    {'l','i','v','o','r'},
+    {'l','i','v','r','e'},
+    {'l','i','w','a','a'},
+    {'l','i','w','a','s'},
+    {'l','l','a','m','a'},
+    {'l','l','a','n','o'},
+    {'l','o','a','c','h'},
+    {'l','o','a','d','s'},
+    {'l','o','a','f','s'},
+    {'l','o','a','m','s'},
+    {'l','o','a','m','y'},
+    {'l','o','a','n','s'},
+    {'l','o','a','s','t'},
+    {'l','o','a','t','h'},
+    {'l','o','a','v','e'},
+    {'l','o','b','a','r'},
+    {'l','o','b','b','y'},
+    {'l','o','b','e','d'},
+    {'l','o','b','e','s'},
+    {'l','o','b','o','s'},
+    {'l','o','b','u','s'},
+    {'l','o','c','a','l'},
+    {'l','o','c','h','e'},
+    {'l','o','c','h','s'},
+    {'l','o','c','h','y'},
+    {'l','o','c','i','e'},
+    {'l','o','c','i','s'},
+    {'l','o','c','k','s'},
+    {'l','o','c','k','y'},
+    {'l','o','c','o','s'},
+    {'l','o','c','u','m'},
+    {'l','o','c','u','s'},
+    {'l','o','d','e','n'},
+    {'l','o','d','e','s'},
+    {'l','o','d','g','e'},
+    {'l','o','e','s','s'},
+    {'l','o','f','t','s'},
+    {'l','o','f','t','y'},
+    {'l','o','g','a','n'},
+    {'l','o','g','e','s'},
+    {'l','o','g','g','y'},
+    {'l','o','g','i','a'},
+    {'l','o','g','i','c'},
+    {'l','o','g','i','e'},
+    {'l','o','g','i','n'},
+    {'l','o','g','o','i'},
+    {'l','o','g','o','n'},
+    {'l','o','g','o','s'},
+    {'l','o','h','a','n'},
+    {'l','o','i','d','s'},
+    {'l','o','i','n','s'},
+    {'l','o','i','p','e'},
+    {'l','o','i','r','s'},
+    {'l','o','k','e','s'},
+    {'l','o','k','e','y'},
+    {'l','o','k','u','m'},
+    {'l','o','l','a','s'},
+    {'l','o','l','e','d'},
+    {'l','o','l','l','o'},
+    {'l','o','l','l','s'},
+    {'l','o','l','l','y'},
+    {'l','o','l','o','g'},
+    {'l','o','l','o','s'},
+    {'l','o','m','a','s'},
+    {'l','o','m','e','d'},
+    {'l','o','m','e','s'},
+    {'l','o','n','e','r'},
+    {'l','o','n','g','a'},
+    {'l','o','n','g','e'},
+    {'l','o','n','g','s'},
+    {'l','o','o','b','y'},
+    {'l','o','o','e','d'},
+    {'l','o','o','e','y'},
+    {'l','o','o','f','a'},
+    {'l','o','o','f','s'},
+    {'l','o','o','i','e'},
+    {'l','o','o','k','s'},
+    {'l','o','o','k','y'},
+    {'l','o','o','m','s'},
+    {'l','o','o','n','s'},
+    {'l','o','o','n','y'},
+    {'l','o','o','p','s'},
+    {'l','o','o','p','y'},
+    {'l','o','o','r','d'},
+    {'l','o','o','s','e'},
+    {'l','o','o','t','s'},
+    {'l','o','p','e','d'},
+    {'l','o','p','e','r'},
+    {'l','o','p','e','s'},
+    {'l','o','p','p','y'},
+    {'l','o','r','a','l'},
+    {'l','o','r','a','n'},
+    {'l','o','r','d','s'},
+    {'l','o','r','d','y'},
+    {'l','o','r','e','l'},
+    {'l','o','r','e','s'},
+    {'l','o','r','i','c'},
+    {'l','o','r','i','s'},
+    {'l','o','r','r','y'},
+    {'l','o','s','e','d'},
+    {'l','o','s','e','l'},
+    {'l','o','s','e','n'},
+    {'l','o','s','e','r'},
+    {'l','o','s','e','s'},
+    {'l','o','s','s','y'},
+    {'l','o','t','a','h'},
+    {'l','o','t','a','s'},
+    {'l','o','t','e','s'},
+    {'l','o','t','i','c'},
+    {'l','o','t','o','s'},
+    {'l','o','t','s','a'},
+    {'l','o','t','t','a'},
+    {'l','o','t','t','e'},
+    {'l','o','t','t','o'},
+    {'l','o','t','u','s'},
+    {'l','o','u','e','d'},
+    {'l','o','u','g','h'},
+    {'l','o','u','i','e'},
+    {'l','o','u','i','s'},
+    {'l','o','u','m','a'},
+    {'l','o','u','n','d'},
+    {'l','o','u','n','s'},
+    {'l','o','u','p','e'},
+    {'l','o','u','p','s'},
+    {'l','o','u','r','e'},
+    {'l','o','u','r','s'},
+    {'l','o','u','r','y'},
+    {'l','o','u','s','e'},
+    {'l','o','u','s','y'},
+    {'l','o','u','t','s'},
+    {'l','o','v','a','t'},
+    {'l','o','v','e','d'},
+    {'l','o','v','e','e'},
+    {'l','o','v','e','r'},
+    {'l','o','v','e','s'},
+    {'l','o','v','e','y'},
+    {'l','o','v','i','e'},
+    {'l','o','w','a','n'},
+    {'l','o','w','e','d'},
+    {'l','o','w','e','n'},
+    {'l','o','w','e','r'},
+    {'l','o','w','e','s'},
+    {'l','o','w','l','y'},
+    {'l','o','w','n','d'},
+    {'l','o','w','n','e'},
+    {'l','o','w','n','s'},
+    {'l','o','w','p','s'},
+    {'l','o','w','r','y'},
+    {'l','o','w','s','e'},
+    {'l','o','w','t','h'},
+    {'l','o','w','t','s'},
+    {'l','o','x','e','d'},
+    {'l','o','x','e','s'},
+    {'l','o','y','a','l'},
+    {'l','o','z','e','n'},
+    {'l','u','a','c','h'},
+    {'l','u','a','u','s'},
+    {'l','u','b','e','d'},
+    {'l','u','b','e','s'},
+    {'l','u','b','r','a'},
+    {'l','u','c','e','s'},
+    {'l','u','c','i','d'},
+    {'l','u','c','k','s'},
+    {'l','u','c','k','y'},
+    {'l','u','c','r','e'},
+    {'l','u','d','e','s'},
+    {'l','u','d','i','c'},
+    {'l','u','d','o','s'},
+    {'l','u','f','f','a'},
+    {'l','u','f','f','s'},
+    {'l','u','g','e','d'},
+    {'l','u','g','e','r'},
+    {'l','u','g','e','s'},
+    {'l','u','l','l','s'},
+    {'l','u','l','u','s'},
+    {'l','u','m','a','s'},
+    {'l','u','m','b','i'},
+    {'l','u','m','e','n'},
+    {'l','u','m','m','e'},
+    {'l','u','m','m','y'},
+    {'l','u','m','p','s'},
+    {'l','u','m','p','y'},
+    {'l','u','n','a','r'},
+    {'l','u','n','a','s'},
+    {'l','u','n','c','h'},
+    {'l','u','n','e','s'},
+    {'l','u','n','e','t'},
+    {'l','u','n','g','e'},
+    {'l','u','n','g','i'},
+    {'l','u','n','g','s'},
+    {'l','u','n','k','s'},
+    {'l','u','n','t','s'},
+    {'l','u','p','i','n'},
+    {'l','u','p','u','s'},
+    {'l','u','r','c','h'},
+    {'l','u','r','e','d'},
+    {'l','u','r','e','r'},
+    {'l','u','r','e','s'},
+    {'l','u','r','e','x'},
+    {'l','u','r','g','i'},
+    {'l','u','r','g','y'},
+    {'l','u','r','i','d'},
+    {'l','u','r','k','s'},
+    {'l','u','r','r','y'},
+    {'l','u','r','v','e'},
+    {'l','u','s','e','r'},
+    {'l','u','s','h','y'},
+    {'l','u','s','k','s'},
+    {'l','u','s','t','s'},
+    {'l','u','s','t','y'},
+    {'l','u','s','u','s'},
+    {'l','u','t','e','a'},
+    {'l','u','t','e','d'},
+    {'l','u','t','e','r'},
+    {'l','u','t','e','s'},
+    {'l','u','v','v','y'},
+    {'l','u','x','e','d'},
+    {'l','u','x','e','r'},
+    {'l','u','x','e','s'},
+    {'l','w','e','i','s'},
+    {'l','y','a','m','s'},
+    {'l','y','a','r','d'},
+    {'l','y','a','r','t'},
+    {'l','y','a','s','e'},
+    {'l','y','c','e','a'},
+    {'l','y','c','e','e'},
+    {'l','y','c','r','a'},
+    {'l','y','i','n','g'},
+    {'l','y','m','e','s'},
+    {'l','y','m','p','h'},
+    {'l','y','n','c','h'},
+    {'l','y','n','e','s'},
+    {'l','y','r','e','s'},
+    {'l','y','r','i','c'},
+    {'l','y','s','e','d'},
+    {'l','y','s','e','s'},
+    {'l','y','s','i','n'},
+    {'l','y','s','i','s'},
+    {'l','y','s','o','l'},
+    {'l','y','s','s','a'},
+    {'l','y','t','e','d'},
+    {'l','y','t','e','s'},
+    {'l','y','t','h','e'},
+    {'l','y','t','i','c'},
+    {'l','y','t','t','a'},
+    {'m','a','a','e','d'},
+    {'m','a','a','r','e'},
+    {'m','a','a','r','s'},
+    {'m','a','b','a','n'},
+    {'m','a','b','e','s'},
+    {'m','a','c','a','s'},
+    {'m','a','c','a','w'},
+    {'m','a','c','c','a'},
+    {'m','a','c','e','d'},
+    {'m','a','c','e','r'},
+    {'m','a','c','e','s'},
+    {'m','a','c','h','e'},
+    {'m','a','c','h','i'},
+    {'m','a','c','h','o'},
+    {'m','a','c','h','s'},
+    {'m','a','c','k','a'},
+    {'m','a','c','k','s'},
+    {'m','a','c','l','e'},
+    {'m','a','c','o','n'},
+    {'m','a','c','r','o'},
+    {'m','a','c','t','e'},
+    {'m','a','d','a','l'},
+    {'m','a','d','a','m'},
+    {'m','a','d','a','r'},
+    {'m','a','d','d','y'},
+    {'m','a','d','g','e'},
+    {'m','a','d','i','d'},
+    {'m','a','d','l','y'},
+    {'m','a','d','o','s'},
+    {'m','a','d','r','e'},
+    {'m','a','e','d','i'},
+    {'m','a','e','r','l'},
+    {'m','a','f','i','a'},
+    {'m','a','f','i','c'},
+    {'m','a','f','t','s'},
+    {'m','a','g','a','s'},
+    {'m','a','g','e','s'},
+    {'m','a','g','g','s'},
+    {'m','a','g','i','c'},
+    {'m','a','g','m','a'},
+    {'m','a','g','n','a'},
+    {'m','a','g','o','t'},
+    {'m','a','g','u','s'},
+    {'m','a','h','a','l'},
+    {'m','a','h','e','m'},
+    {'m','a','h','i','s'},
+    {'m','a','h','o','e'},
+    {'m','a','h','r','s'},
+    {'m','a','h','u','a'},
+    {'m','a','h','w','a'},
+    {'m','a','i','d','s'},
+    {'m','a','i','k','o'},
+    {'m','a','i','k','s'},
+    {'m','a','i','l','e'},
+    {'m','a','i','l','l'},
+    {'m','a','i','l','o'},
+    {'m','a','i','l','s'},
+    {'m','a','i','m','s'},
+    {'m','a','i','n','s'},
+    {'m','a','i','r','e'},
+    {'m','a','i','r','s'},
+    {'m','a','i','s','e'},
+    {'m','a','i','s','t'},
+    {'m','a','i','z','e'},
+    {'m','a','j','a','s'},
+    {'m','a','j','a','t'},
+    {'m','a','j','o','e'},
+    {'m','a','j','o','r'},
+    {'m','a','j','o','s'},
+    {'m','a','k','a','f'},
+    {'m','a','k','a','i'},
+    {'m','a','k','a','n'},
+    {'m','a','k','a','r'},
+    {'m','a','k','e','e'},
+    {'m','a','k','e','r'},
+    {'m','a','k','e','s'},
+    {'m','a','k','i','e'},
+    {'m','a','k','i','s'},
+    {'m','a','k','o','s'},
+    {'m','a','l','a','e'},
+    {'m','a','l','a','i'},
+    {'m','a','l','a','m'},
+    {'m','a','l','a','r'},
+    {'m','a','l','a','s'},
+    {'m','a','l','a','x'},
+    {'m','a','l','e','o'},
+    {'m','a','l','e','s'},
+    {'m','a','l','i','c'},
+    {'m','a','l','i','k'},
+    {'m','a','l','i','s'},
+    {'m','a','l','k','y'},
+    {'m','a','l','l','s'},
+    {'m','a','l','m','s'},
+    {'m','a','l','m','y'},
+    {'m','a','l','t','s'},
+    {'m','a','l','t','y'},
+    {'m','a','l','u','s'},
+    {'m','a','l','v','a'},
+    {'m','a','l','w','a'},
+    {'m','a','m','a','k'},
+    {'m','a','m','a','s'},
+    {'m','a','m','b','a'},
+    {'m','a','m','b','o'},
+    {'m','a','m','b','u'},
+    {'m','a','m','e','e'},
+    {'m','a','m','e','y'},
+    {'m','a','m','i','e'},
+    {'m','a','m','i','l'},
+    {'m','a','m','m','a'},
+    {'m','a','m','m','y'},
+    {'m','a','n','a','s'},
+    {'m','a','n','a','t'},
+    {'m','a','n','d','i'},
+    {'m','a','n','d','s'},
+    {'m','a','n','d','y'},
+    {'m','a','n','e','b'},
+    {'m','a','n','e','d'},
+    {'m','a','n','e','h'},
+    {'m','a','n','e','s'},
+    {'m','a','n','e','t'},
+    {'m','a','n','g','a'},
+    {'m','a','n','g','e'},
+    {'m','a','n','g','i'},
+    {'m','a','n','g','o'},
+    {'m','a','n','g','s'},
+    {'m','a','n','g','y'},
+    {'m','a','n','i','a'},
+    {'m','a','n','i','c'},
+    {'m','a','n','i','e'},
+    {'m','a','n','i','s'},
+    {'m','a','n','k','s'},
+    {'m','a','n','k','y'},
+    {'m','a','n','l','y'},
+    {'m','a','n','n','a'},
+    {'m','a','n','n','y'},
+    {'m','a','n','o','a'},
+    {'m','a','n','o','r'},
+    {'m','a','n','o','s'},
+    {'m','a','n','s','e'},
+    {'m','a','n','s','o'},
+    {'m','a','n','t','a'},
+    {'m','a','n','t','e'},
+    {'m','a','n','t','o'},
+    {'m','a','n','t','s'},
+    {'m','a','n','t','y'},
+    {'m','a','n','u','l'},
+    {'m','a','n','u','s'},
+    {'m','a','n','z','o'},
+    {'m','a','p','a','u'},
+    {'m','a','p','e','s'},
+    {'m','a','p','l','e'},
+    {'m','a','p','o','u'},
+    {'m','a','p','p','y'},
+    {'m','a','q','a','m'},
+    {'m','a','q','u','i'},
+    {'m','a','r','a','e'},
+    {'m','a','r','a','h'},
+    {'m','a','r','a','l'},
+    {'m','a','r','a','n'},
+    {'m','a','r','a','s'},
+    {'m','a','r','a','y'},
+    {'m','a','r','c','h'},
+    {'m','a','r','c','s'},
+    {'m','a','r','d','s'},
+    {'m','a','r','d','y'},
+    {'m','a','r','e','s'},
+    {'m','a','r','g','a'},
+    {'m','a','r','g','e'},
+    {'m','a','r','g','o'},
+    {'m','a','r','g','s'},
+    {'m','a','r','i','a'},
+    {'m','a','r','i','d'},
+    {'m','a','r','i','l'},
+    {'m','a','r','k','a'},
+    {'m','a','r','k','s'},
+    {'m','a','r','l','e'},
+    {'m','a','r','l','s'},
+    {'m','a','r','l','y'},
+    {'m','a','r','m','a'},
+    {'m','a','r','m','s'},
+    {'m','a','r','o','n'},
+    {'m','a','r','o','r'},
+    {'m','a','r','r','a'},
+    {'m','a','r','r','i'},
+    {'m','a','r','r','y'},
+    {'m','a','r','s','e'},
+    {'m','a','r','s','h'},
+    {'m','a','r','t','s'},
+    {'m','a','r','u','a'},
+    {'m','a','r','v','y'},
+    {'m','a','s','a','s'},
+    {'m','a','s','e','d'},
+    {'m','a','s','e','r'},
+    {'m','a','s','e','s'},
+    {'m','a','s','h','a'},
+    {'m','a','s','h','y'},
+    {'m','a','s','k','s'},
+    {'m','a','s','o','n'},
+    {'m','a','s','s','a'},
+    {'m','a','s','s','e'},
+    {'m','a','s','s','y'},
+    {'m','a','s','t','s'},
+    {'m','a','s','t','y'},
+    {'m','a','s','u','r'},
+    {'m','a','s','u','s'},
+    {'m','a','s','u','t'},
+    {'m','a','t','a','i'},
+    {'m','a','t','c','h'},
+    {'m','a','t','e','d'},
+    {'m','a','t','e','r'},
+    {'m','a','t','e','s'},
+    {'m','a','t','e','y'},
+    {'m','a','t','h','e'},
+    {'m','a','t','h','s'},
+    {'m','a','t','i','n'},
+    {'m','a','t','l','o'},
+    {'m','a','t','r','a'},
+    {'m','a','t','s','u'},
+    {'m','a','t','t','e'},
+    {'m','a','t','t','s'},
+    {'m','a','t','t','y'},
+    {'m','a','t','z','a'},
+    {'m','a','t','z','o'},
+    {'m','a','u','b','y'},
+    {'m','a','u','d','s'},
+    {'m','a','u','k','a'},
+    {'m','a','u','l','a'},
+    {'m','a','u','l','s'},
+    {'m','a','u','m','s'},
+    {'m','a','u','m','y'},
+    {'m','a','u','n','d'},
+    {'m','a','u','n','t'},
+    {'m','a','u','r','i'},
+    {'m','a','u','s','y'},
+    {'m','a','u','t','s'},
+    {'m','a','u','v','e'},
+    {'m','a','u','v','y'},
+    {'m','a','u','z','y'},
+    {'m','a','v','e','n'},
+    {'m','a','v','i','e'},
+    {'m','a','v','i','n'},
+    {'m','a','v','i','s'},
+    {'m','a','w','e','d'},
+    {'m','a','w','k','s'},
+    {'m','a','w','k','y'},
+    {'m','a','w','l','a'},
+    {'m','a','w','n','s'},
+    {'m','a','w','p','s'},
+    {'m','a','w','r','s'},
+    {'m','a','x','e','d'},
+    {'m','a','x','e','s'},
+    {'m','a','x','i','m'},
+    {'m','a','x','i','s'},
+    {'m','a','y','a','n'},
+    {'m','a','y','a','s'},
+    {'m','a','y','b','e'},
+    {'m','a','y','e','d'},
+    {'m','a','y','o','r'},
+    {'m','a','y','o','s'},
+    {'m','a','y','s','t'},
+    {'m','a','z','a','c'},
+    {'m','a','z','a','k'},
+    {'m','a','z','a','r'},
+    {'m','a','z','a','s'},
+    {'m','a','z','e','d'},
+    {'m','a','z','e','l'},
+    {'m','a','z','e','r'},
+    {'m','a','z','e','s'},
+    {'m','a','z','e','t'},
+    {'m','a','z','e','y'},
+    {'m','a','z','u','t'},
+    {'m','b','a','r','i'},
+    {'m','b','a','r','s'},
+    {'m','b','i','l','a'},
+    {'m','b','i','r','a'},
+    {'m','b','r','e','t'},
+    {'m','b','u','b','e'},
+    {'m','b','u','g','a'},
+    {'m','e','a','d','s'},
+    {'m','e','a','k','e'},
+    {'m','e','a','k','s'},
+    {'m','e','a','l','s'},
+    {'m','e','a','l','y'},
+    {'m','e','a','n','e'},
+    {'m','e','a','n','s'},
+    {'m','e','a','n','t'},
+    {'m','e','a','n','y'},
+    {'m','e','a','r','e'},
+    {'m','e','a','s','e'},
+    {'m','e','a','t','h'},
+    {'m','e','a','t','s'},
+    {'m','e','a','t','y'},
+    {'m','e','b','b','e'},
+    {'m','e','b','o','s'},
+    {'m','e','c','c','a'},
+    {'m','e','c','h','a'},
+    {'m','e','c','h','s'},
+    {'m','e','c','k','s'},
+    {'m','e','c','u','m'},
+    {'m','e','d','a','l'},
+    {'m','e','d','i','a'},
+    {'m','e','d','i','c'},
+    {'m','e','d','i','i'},
+    {'m','e','d','i','n'},
+    {'m','e','d','l','e'},
+    {'m','e','e','c','h'},
+    {'m','e','e','d','s'},
+    {'m','e','e','j','a'},
+    {'m','e','e','p','s'},
+    {'m','e','e','r','s'},
+    {'m','e','e','t','s'},
+    {'m','e','f','f','s'},
+    {'m','e','i','d','s'},
+    {'m','e','i','k','o'},
+    {'m','e','i','l','s'},
+    {'m','e','i','n','s'},
+    {'m','e','i','n','t'},
+    {'m','e','i','n','y'},
+    {'m','e','i','s','m'},
+    {'m','e','i','t','h'},
+    {'m','e','k','k','a'},
+    {'m','e','l','a','m'},
+    {'m','e','l','a','s'},
+    {'m','e','l','b','a'},
+    {'m','e','l','c','h'},
+    {'m','e','l','d','s'},
+    {'m','e','l','e','e'},
+    {'m','e','l','e','s'},
+    {'m','e','l','i','c'},
+    {'m','e','l','i','k'},
+    {'m','e','l','l','s'},
+    {'m','e','l','o','e'},
+    {'m','e','l','o','n'},
+    {'m','e','l','o','s'},
+    {'m','e','l','t','s'},
+    {'m','e','l','t','y'},
+    {'m','e','m','e','s'},
+    {'m','e','m','i','c'},
+    {'m','e','m','o','s'},
+    {'m','e','n','a','d'},
+    {'m','e','n','c','e'},
+    {'m','e','n','d','s'},
+    {'m','e','n','e','d'},
+    {'m','e','n','e','s'},
+    {'m','e','n','g','e'},
+    {'m','e','n','g','s'},
+    {'m','e','n','i','l'},
+    {'m','e','n','s','a'},
+    {'m','e','n','s','e'},
+    {'m','e','n','s','h'},
+    {'m','e','n','t','a'},
+    {'m','e','n','t','o'},
+    {'m','e','n','t','s'},
+    {'m','e','n','u','s'},
+    {'m','e','o','u','s'},
+    {'m','e','o','w','s'},
+    {'m','e','r','c','h'},
+    {'m','e','r','c','s'},
+    {'m','e','r','c','y'},
+    {'m','e','r','d','e'},
+    {'m','e','r','d','s'},
+    {'m','e','r','e','d'},
+    {'m','e','r','e','l'},
+    {'m','e','r','e','r'},
+    {'m','e','r','e','s'},
+    {'m','e','r','g','e'},
+    {'m','e','r','i','l'},
+    {'m','e','r','i','s'},
+    {'m','e','r','i','t'},
+    {'m','e','r','k','s'},
+    {'m','e','r','l','e'},
+    {'m','e','r','l','s'},
+    {'m','e','r','r','y'},
+    {'m','e','r','s','e'},
+    {'m','e','r','s','k'},
+    {'m','e','s','a','d'},
+    {'m','e','s','a','l'},
+    {'m','e','s','a','s'},
+    {'m','e','s','c','a'},
+    {'m','e','s','e','l'},
+    {'m','e','s','e','m'},
+    {'m','e','s','e','s'},
+    {'m','e','s','h','y'},
+    {'m','e','s','i','a'},
+    {'m','e','s','i','c'},
+    {'m','e','s','n','e'},
+    {'m','e','s','o','n'},
+    {'m','e','s','s','y'},
+    {'m','e','s','t','o'},
+    {'m','e','s','y','l'},
+    {'m','e','t','a','l'},
+    {'m','e','t','a','s'},
+    {'m','e','t','e','d'},
+    {'m','e','t','e','g'},
+    {'m','e','t','e','l'},
+    {'m','e','t','e','r'},
+    {'m','e','t','e','s'},
+    {'m','e','t','h','i'},
+    {'m','e','t','h','o'},
+    {'m','e','t','h','s'},
+    {'m','e','t','h','y'},
+    {'m','e','t','i','c'},
+    {'m','e','t','i','f'},
+    {'m','e','t','i','s'},
+    {'m','e','t','o','l'},
+    {'m','e','t','r','e'},
+    {'m','e','t','r','o'},
+    {'m','e','t','t','a'},
+    {'m','e','u','m','s'},
+    {'m','e','u','s','e'},
+    {'m','e','v','e','d'},
+    {'m','e','v','e','s'},
+    {'m','e','w','e','d'},
+    {'m','e','w','l','s'},
+    {'m','e','y','n','t'},
+    {'m','e','z','e','s'},
+    {'m','e','z','z','a'},
+    {'m','e','z','z','e'},
+    {'m','e','z','z','o'},
+    {'m','g','a','l','s'},
+    {'m','h','o','r','r'},
+    {'m','i','a','i','s'},
+    {'m','i','a','o','u'},
+    {'m','i','a','o','w'},
+    {'m','i','a','s','m'},
+    {'m','i','a','u','l'},
+    {'m','i','c','a','s'},
+    {'m','i','c','h','e'},
+    {'m','i','c','h','i'},
+    {'m','i','c','h','t'},
+    {'m','i','c','k','s'},
+    {'m','i','c','k','y'},
+    {'m','i','c','o','s'},
+    {'m','i','c','r','a'},
+    {'m','i','c','r','o'},
+    {'m','i','d','d','y'},
+    {'m','i','d','g','e'},
+    {'m','i','d','g','y'},
+    {'m','i','d','i','s'},
+    {'m','i','d','s','t'},
+    {'m','i','e','n','s'},
+    {'m','i','e','u','x'},
+    {'m','i','e','v','e'},
+    {'m','i','f','f','s'},
+    {'m','i','f','f','y'},
+    {'m','i','f','t','y'},
+    {'m','i','g','g','s'},
+    {'m','i','g','h','t'},
+    {'m','i','g','m','a'},
+    {'m','i','g','o','d'},
+    {'m','i','h','a','s'},
+    {'m','i','h','i','s'},
+    {'m','i','k','a','n'},
+    {'m','i','k','e','d'},
+    {'m','i','k','e','s'},
+    {'m','i','k','o','s'},
+    {'m','i','k','r','a'},
+    {'m','i','k','v','a'},
+    {'m','i','l','c','h'},
+    {'m','i','l','d','s'},
+    {'m','i','l','e','r'},
+    {'m','i','l','e','s'},
+    {'m','i','l','f','s'},
+    {'m','i','l','i','a'},
+    {'m','i','l','k','o'},
+    {'m','i','l','k','s'},
+    {'m','i','l','k','y'},
+    {'m','i','l','l','e'},
+    {'m','i','l','l','s'},
+    {'m','i','l','l','y'},
+    {'m','i','l','o','r'},
+    {'m','i','l','o','s'},
+    {'m','i','l','p','a'},
+    {'m','i','l','t','s'},
+    {'m','i','l','t','y'},
+    {'m','i','l','t','z'},
+    {'m','i','m','e','d'},
+    {'m','i','m','e','o'},
+    {'m','i','m','e','r'},
+    {'m','i','m','e','s'},
+    {'m','i','m','i','c'},
+    {'m','i','m','i','s'},
+    {'m','i','m','s','y'},
+    {'m','i','n','a','e'},
+    {'m','i','n','a','r'},
+    {'m','i','n','a','s'},
+    {'m','i','n','c','e'},
+    {'m','i','n','c','y'},
+    {'m','i','n','d','i'},
+    {'m','i','n','d','s'},
+    {'m','i','n','e','d'},
+    {'m','i','n','e','r'},
+    {'m','i','n','e','s'},
+    {'m','i','n','g','e'},
+    {'m','i','n','g','i'},
+    {'m','i','n','g','s'},
+    {'m','i','n','g','y'},
+    {'m','i','n','i','m'},
+    {'m','i','n','i','s'},
+    {'m','i','n','k','e'},
+    {'m','i','n','k','s'},
+    {'m','i','n','n','y'},
+    {'m','i','n','o','r'},
+    {'m','i','n','o','s'},
+    {'m','i','n','s','e'},
+    {'m','i','n','t','s'},
+    {'m','i','n','t','y'},
+    {'m','i','n','u','s'},
+    {'m','i','n','x','y'},
+    {'m','i','r','a','a'},
+    {'m','i','r','a','h'},
+    {'m','i','r','c','h'},
+    {'m','i','r','e','d'},
+    {'m','i','r','e','s'},
+    {'m','i','r','e','x'},
+    {'m','i','r','i','d'},
+    {'m','i','r','i','n'},
+    {'m','i','r','k','n'},
+    {'m','i','r','k','s'},
+    {'m','i','r','k','y'},
+    {'m','i','r','l','s'},
+    {'m','i','r','l','y'},
+    {'m','i','r','o','s'},
+    {'m','i','r','r','l'},
+    {'m','i','r','r','s'},
+    {'m','i','r','t','h'},
+    {'m','i','r','v','s'},
+    {'m','i','r','z','a'},
+    {'m','i','s','a','l'},
+    {'m','i','s','c','h'},
+    {'m','i','s','d','o'},
+    {'m','i','s','e','r'},
+    {'m','i','s','e','s'},
+    {'m','i','s','g','o'},
+    {'m','i','s','k','y'},
+    {'m','i','s','l','s'},
+    {'m','i','s','o','s'},
+    {'m','i','s','s','a'},
+    {'m','i','s','s','y'},
+    {'m','i','s','t','o'},
+    {'m','i','s','t','s'},
+    {'m','i','s','t','y'},
+    {'m','i','t','a','s'},
+    {'m','i','t','c','h'},
+    {'m','i','t','e','r'},
+    {'m','i','t','e','s'},
+    {'m','i','t','e','y'},
+    {'m','i','t','i','e'},
+    {'m','i','t','i','s'},
+    {'m','i','t','r','e'},
+    {'m','i','t','r','y'},
+    {'m','i','t','t','a'},
+    {'m','i','t','t','s'},
+    {'m','i','v','e','y'},
+    {'m','i','v','v','y'},
+    {'m','i','x','e','d'},
+    {'m','i','x','e','n'},
+    {'m','i','x','e','r'},
+    {'m','i','x','e','s'},
+    {'m','i','x','i','e'},
+    {'m','i','x','i','s'},
+    {'m','i','x','t','e'},
+    {'m','i','x','u','p'},
+    {'m','i','y','a','s'},
+    {'m','i','z','e','n'},
+    {'m','i','z','e','s'},
+    {'m','i','z','z','y'},
+    {'m','m','k','a','y'},
+    {'m','n','e','m','e'},
+    {'m','o','a','i','s'},
+    {'m','o','a','k','y'},
+    {'m','o','a','l','s'},
+    {'m','o','a','n','a'},
+    {'m','o','a','n','s'},
+    {'m','o','a','n','y'},
+    {'m','o','a','r','s'},
+    {'m','o','a','t','s'},
+    {'m','o','b','b','y'},
+    {'m','o','b','e','d'},
+    {'m','o','b','e','e'},
+    {'m','o','b','e','s'},
+    {'m','o','b','e','y'},
+    {'m','o','b','i','e'},
+    {'m','o','b','l','e'},
+    {'m','o','b','o','s'},
+    {'m','o','c','a','p'},
+    {'m','o','c','h','a'},
+    {'m','o','c','h','i'},
+    {'m','o','c','h','s'},
+    {'m','o','c','h','y'},
+    {'m','o','c','k','s'},
+    {'m','o','c','k','y'},
+    {'m','o','c','o','s'},
+    {'m','o','c','u','s'},
+    {'m','o','d','a','l'},
+    {'m','o','d','e','l'},
+    {'m','o','d','e','m'},
+    {'m','o','d','e','r'},
+    {'m','o','d','e','s'},
+    {'m','o','d','g','e'},
+    {'m','o','d','i','i'},
+    {'m','o','d','i','n'},
+    {'m','o','d','o','c'},
+    {'m','o','d','o','m'},
+    {'m','o','d','u','s'},
+    {'m','o','e','n','i'},
+    {'m','o','e','r','s'},
+    {'m','o','f','o','s'},
+    {'m','o','g','a','r'},
+    {'m','o','g','a','s'},
+    {'m','o','g','g','y'},
+    {'m','o','g','o','s'},
+    {'m','o','g','r','a'},
+    {'m','o','g','u','e'},
+    {'m','o','g','u','l'},
+    {'m','o','h','a','r'},
+    {'m','o','h','e','l'},
+    {'m','o','h','o','s'},
+    {'m','o','h','r','s'},
+    {'m','o','h','u','a'},
+    {'m','o','h','u','r'},
+    {'m','o','i','l','e'},
+    {'m','o','i','l','s'},
+    {'m','o','i','r','a'},
+    {'m','o','i','r','e'},
+    {'m','o','i','s','t'},
+    {'m','o','i','t','s'},
+    {'m','o','i','t','y'},
+    {'m','o','j','o','s'},
+    {'m','o','k','e','r'},
+    {'m','o','k','e','s'},
+    {'m','o','k','e','y'},
+    {'m','o','k','i','s'},
+    {'m','o','k','k','y'},
+    {'m','o','k','o','s'},
+    {'m','o','k','u','s'},
+    {'m','o','l','a','l'},
+    {'m','o','l','a','r'},
+    {'m','o','l','a','s'},
+    {'m','o','l','d','s'},
+    {'m','o','l','d','y'},
+    {'m','o','l','e','d'},
+    {'m','o','l','e','r'},
+    {'m','o','l','e','s'},
+    {'m','o','l','e','y'},
+    {'m','o','l','i','e'},
+    {'m','o','l','l','a'},
+    {'m','o','l','l','e'},
+    {'m','o','l','l','o'},
+    {'m','o','l','l','s'},
+    {'m','o','l','l','y'},
+    {'m','o','l','o','i'},
+    {'m','o','l','o','s'},
+    {'m','o','l','t','o'},
+    {'m','o','l','t','s'},
+    {'m','o','l','u','e'},
+    {'m','o','l','v','i'},
+    {'m','o','l','y','s'},
+    {'m','o','m','e','s'},
+    {'m','o','m','i','e'},
+    {'m','o','m','m','a'},
+    {'m','o','m','m','e'},
+    {'m','o','m','m','y'},
+    {'m','o','m','o','s'},
+    {'m','o','m','p','e'},
+    {'m','o','m','u','s'},
+    {'m','o','n','a','d'},
+    {'m','o','n','a','l'},
+    {'m','o','n','a','s'},
+    {'m','o','n','d','e'},
+    {'m','o','n','d','o'},
+    {'m','o','n','e','r'},
+    {'m','o','n','e','y'},
+    {'m','o','n','g','o'},
+    {'m','o','n','g','s'},
+    {'m','o','n','i','c'},
+    {'m','o','n','i','e'},
+    {'m','o','n','k','s'},
+    {'m','o','n','o','s'},
+    {'m','o','n','p','e'},
+    {'m','o','n','t','e'},
+    {'m','o','n','t','h'},
+    {'m','o','n','t','y'},
+    {'m','o','o','b','s'},
+    {'m','o','o','c','h'},
+    {'m','o','o','d','s'},
+    {'m','o','o','d','y'},
+    {'m','o','o','e','d'},
+    {'m','o','o','e','y'},
+    {'m','o','o','k','s'},
+    {'m','o','o','l','a'},
+    {'m','o','o','l','i'},
+    {'m','o','o','l','s'},
+    {'m','o','o','l','y'},
+    {'m','o','o','n','g'},
+    {'m','o','o','n','i'},
+    {'m','o','o','n','s'},
+    {'m','o','o','n','y'},
+    {'m','o','o','p','s'},
+    {'m','o','o','r','s'},
+    {'m','o','o','r','y'},
+    {'m','o','o','s','e'},
+    {'m','o','o','t','h'},
+    {'m','o','o','t','s'},
+    {'m','o','o','v','e'},
+    {'m','o','p','e','d'},
+    {'m','o','p','e','r'},
+    {'m','o','p','e','s'},
+    {'m','o','p','e','y'},
+    {'m','o','p','p','y'},
+    {'m','o','p','s','y'},
+    {'m','o','p','u','s'},
+    {'m','o','r','a','e'},
+    {'m','o','r','a','h'},
+    {'m','o','r','a','l'},
+    {'m','o','r','a','n'},
+    {'m','o','r','a','s'},
+    {'m','o','r','a','t'},
+    {'m','o','r','a','y'},
+    {'m','o','r','e','e'},
+    {'m','o','r','e','l'},
+    {'m','o','r','e','s'},
+    {'m','o','r','g','y'},
+    {'m','o','r','i','a'},
+    {'m','o','r','i','n'},
+    {'m','o','r','m','o'},
+    {'m','o','r','n','a'},
+    {'m','o','r','n','e'},
+    {'m','o','r','n','s'},
+    {'m','o','r','o','n'},
+    {'m','o','r','o','r'},
+    {'m','o','r','p','h'},
+    {'m','o','r','r','a'},
+    {'m','o','r','r','o'},
+    {'m','o','r','s','e'},
+    {'m','o','r','t','s'},
+    {'m','o','r','u','k'},
+    {'m','o','s','e','d'},
+    {'m','o','s','e','s'},
+    {'m','o','s','e','y'},
+    {'m','o','s','k','s'},
+    {'m','o','s','s','o'},
+    {'m','o','s','s','y'},
+    {'m','o','s','t','e'},
+    {'m','o','s','t','o'},
+    {'m','o','s','t','s'},
+    {'m','o','t','e','d'},
+    {'m','o','t','e','l'},
+    {'m','o','t','e','n'},
+    {'m','o','t','e','s'},
+    {'m','o','t','e','t'},
+    {'m','o','t','e','y'},
+    {'m','o','t','h','s'},
+    {'m','o','t','h','y'},
+    {'m','o','t','i','f'},
+    {'m','o','t','i','s'},
+    {'m','o','t','o','n'},
+    {'m','o','t','o','r'},
+    {'m','o','t','t','e'},
+    {'m','o','t','t','o'},
+    {'m','o','t','t','s'},
+    {'m','o','t','t','y'},
+    {'m','o','t','u','s'},
+    {'m','o','t','z','a'},
+    {'m','o','u','c','h'},
+    {'m','o','u','e','s'},
+    {'m','o','u','f','s'},
+    {'m','o','u','l','d'},
+    {'m','o','u','l','e'},
+    {'m','o','u','l','s'},
+    {'m','o','u','l','t'},
+    {'m','o','u','l','y'},
+    {'m','o','u','n','d'},
+    {'m','o','u','n','t'},
+    {'m','o','u','p','s'},
+    {'m','o','u','r','n'},
+    {'m','o','u','s','e'},
+    {'m','o','u','s','t'},
+    {'m','o','u','s','y'},
+    {'m','o','u','t','h'},
+    {'m','o','v','e','d'},
+    {'m','o','v','e','r'},
+    {'m','o','v','e','s'},
+    {'m','o','v','i','e'},
+    {'m','o','w','a','s'},
+    {'m','o','w','e','d'},
+    {'m','o','w','e','r'},
+    {'m','o','w','i','e'},
+    {'m','o','w','r','a'},
+    {'m','o','x','a','s'},
+    {'m','o','x','i','e'},
+    {'m','o','y','a','s'},
+    {'m','o','y','l','e'},
+    {'m','o','y','l','s'},
+    {'m','o','z','e','d'},
+    {'m','o','z','e','s'},
+    {'m','o','z','o','s'},
+    {'m','p','r','e','t'},
+    {'m','r','a','d','s'},
+    {'m','s','a','s','a'},
+    {'m','t','e','p','e'},
+    {'m','u','c','h','o'},
+    {'m','u','c','i','c'},
+    {'m','u','c','i','d'},
+    {'m','u','c','i','n'},
+    {'m','u','c','k','o'},
+    {'m','u','c','k','s'},
+    {'m','u','c','k','y'},
+    {'m','u','c','o','r'},
+    {'m','u','c','r','o'},
+    {'m','u','c','u','s'},
+    {'m','u','d','a','r'},
+    {'m','u','d','d','y'},
+    {'m','u','d','g','e'},
+    {'m','u','d','i','f'},
+    {'m','u','d','i','m'},
+    {'m','u','d','i','r'},
+    {'m','u','d','r','a'},
+    {'m','u','f','f','s'},
+    {'m','u','f','f','y'},
+    {'m','u','f','t','i'},
+    {'m','u','g','g','a'},
+    {'m','u','g','g','s'},
+    {'m','u','g','g','y'},
+    {'m','u','g','h','o'},
+    {'m','u','g','i','l'},
+    {'m','u','g','o','s'},
+    {'m','u','h','l','y'},
+    {'m','u','i','d','s'},
+    {'m','u','i','l','s'},
+    {'m','u','i','r','s'},
+    {'m','u','i','r','y'},
+    {'m','u','i','s','t'},
+    {'m','u','j','i','k'},
+    {'m','u','k','i','m'},
+    {'m','u','k','t','i'},
+    {'m','u','l','a','i'},
+    {'m','u','l','c','h'},
+    {'m','u','l','c','t'},
+    {'m','u','l','e','d'},
+    {'m','u','l','e','s'},
+    {'m','u','l','e','y'},
+    {'m','u','l','g','a'},
+    {'m','u','l','i','e'},
+    {'m','u','l','l','a'},
+    {'m','u','l','l','s'},
+    {'m','u','l','s','e'},
+    {'m','u','l','s','h'},
+    {'m','u','m','b','o'},
+    {'m','u','m','m','s'},
+    {'m','u','m','m','y'},
+    {'m','u','m','p','h'},
+    {'m','u','m','p','s'},
+    {'m','u','m','s','y'},
+    {'m','u','m','u','s'},
+    {'m','u','n','c','h'},
+    {'m','u','n','d','s'},
+    {'m','u','n','d','u'},
+    {'m','u','n','g','a'},
+    {'m','u','n','g','e'},
+    {'m','u','n','g','i'},
+    {'m','u','n','g','o'},
+    {'m','u','n','g','s'},
+    {'m','u','n','g','y'},
+    {'m','u','n','i','a'},
+    {'m','u','n','i','s'},
+    {'m','u','n','j','a'},
+    {'m','u','n','j','s'},
+    {'m','u','n','t','s'},
+    {'m','u','n','t','u'},
+    {'m','u','o','n','s'},
+    {'m','u','r','a','l'},
+    {'m','u','r','a','s'},
+    {'m','u','r','e','d'},
+    {'m','u','r','e','s'},
+    {'m','u','r','e','x'},
+    {'m','u','r','g','h'},
+    {'m','u','r','g','i'},
+    {'m','u','r','i','d'},
+    {'m','u','r','k','s'},
+    {'m','u','r','k','y'},
+    {'m','u','r','l','s'},
+    {'m','u','r','l','y'},
+    {'m','u','r','r','a'},
+    {'m','u','r','r','e'},
+    {'m','u','r','r','i'},
+    {'m','u','r','r','s'},
+    {'m','u','r','r','y'},
+    {'m','u','r','t','h'},
+    {'m','u','r','t','i'},
+    {'m','u','r','u','k'},
+    {'m','u','r','v','a'},
+    {'m','u','s','a','r'},
+    {'m','u','s','c','a'},
+    {'m','u','s','e','d'},
+    {'m','u','s','e','e'},
+    {'m','u','s','e','r'},
+    {'m','u','s','e','s'},
+    {'m','u','s','e','t'},
+    {'m','u','s','h','a'},
+    {'m','u','s','h','y'},
+    {'m','u','s','i','c'},
+    {'m','u','s','i','t'},
+    {'m','u','s','k','s'},
+    {'m','u','s','k','y'},
+    {'m','u','s','o','s'},
+    {'m','u','s','s','e'},
+    {'m','u','s','s','y'},
+    {'m','u','s','t','a'},
+    {'m','u','s','t','h'},
+    {'m','u','s','t','s'},
+    {'m','u','s','t','y'},
+    {'m','u','t','a','s'},
+    {'m','u','t','c','h'},
+    {'m','u','t','e','d'},
+    {'m','u','t','e','r'},
+    {'m','u','t','e','s'},
+    {'m','u','t','h','a'},
+    {'m','u','t','i','c'},
+    {'m','u','t','i','s'},
+    {'m','u','t','o','n'},
+    {'m','u','t','t','i'},
+    {'m','u','t','t','s'},
+    {'m','u','t','u','m'},
+    {'m','u','v','v','a'},
+    {'m','u','x','e','d'},
+    {'m','u','x','e','s'},
+    {'m','u','z','a','k'},
+    {'m','u','z','z','y'},
+    {'m','v','u','l','a'},
+    {'m','v','u','l','e'},
+    {'m','v','u','l','i'},
+    {'m','y','a','l','l'},
+    {'m','y','a','l','s'},
+    {'m','y','l','a','r'},
+    {'m','y','n','a','h'},
+    {'m','y','n','a','s'},
+    {'m','y','o','i','d'},
+    {'m','y','o','m','a'},
+    {'m','y','o','n','s'},
+    {'m','y','o','p','e'},
+    {'m','y','o','p','s'},
+    {'m','y','o','p','y'},
+    {'m','y','r','r','h'},
+    {'m','y','s','i','d'},
+    {'m','y','s','i','e'},
+    {'m','y','t','h','i'},
+    {'m','y','t','h','s'},
+    {'m','y','t','h','y'},
+    {'m','y','x','o','s'},
+    {'m','z','e','e','s'},
+    {'n','a','a','m','s'},
+    {'n','a','a','n','s'},
+    {'n','a','a','t','s'},
+    {'n','a','b','a','m'},
+    {'n','a','b','b','y'},
+    {'n','a','b','e','s'},
+    {'n','a','b','i','s'},
+    {'n','a','b','k','s'},
+    {'n','a','b','l','a'},
+    {'n','a','b','o','b'},
+    {'n','a','c','h','e'},
+    {'n','a','c','h','o'},
+    {'n','a','c','r','e'},
+    {'n','a','d','a','s'},
+    {'n','a','d','i','r'},
+    {'n','a','e','v','e'},
+    {'n','a','e','v','i'},
+    {'n','a','f','f','s'},
+    {'n','a','g','a','r'},
+    {'n','a','g','a','s'},
+    {'n','a','g','e','s'},
+    {'n','a','g','g','y'},
+    {'n','a','g','o','r'},
+    {'n','a','h','a','l'},
+    {'n','a','i','a','d'},
+    {'n','a','i','b','s'},
+    {'n','a','i','c','e'},
+    {'n','a','i','d','s'},
+    {'n','a','i','e','o'},
+    {'n','a','i','f','s'},
+    {'n','a','i','k','s'},
+    {'n','a','i','l','s'},
+    {'n','a','i','l','y'},
+    {'n','a','i','n','s'},
+    {'n','a','i','o','s'},
+    {'n','a','i','r','a'},
+    {'n','a','i','r','u'},
+    {'n','a','i','v','e'},
+    {'n','a','j','i','b'},
+    {'n','a','k','a','s'},
+    {'n','a','k','e','d'},
+    {'n','a','k','e','r'},
+    {'n','a','k','f','a'},
+    {'n','a','l','a','s'},
+    {'n','a','l','e','d'},
+    {'n','a','l','l','a'},
+    {'n','a','m','a','d'},
+    {'n','a','m','a','k'},
+    {'n','a','m','a','z'},
+    {'n','a','m','e','d'},
+    {'n','a','m','e','r'},
+    {'n','a','m','e','s'},
+    {'n','a','m','m','a'},
+    {'n','a','m','u','s'},
+    {'n','a','n','a','s'},
+    {'n','a','n','c','e'},
+    {'n','a','n','c','y'},
+    {'n','a','n','d','u'},
+    {'n','a','n','n','a'},
+    {'n','a','n','n','y'},
+    {'n','a','n','o','s'},
+    {'n','a','n','t','e'},
+    {'n','a','n','t','i'},
+    {'n','a','n','t','o'},
+    {'n','a','n','t','s'},
+    {'n','a','n','t','y'},
+    {'n','a','n','u','a'},
+    {'n','a','p','a','s'},
+    {'n','a','p','e','d'},
+    {'n','a','p','e','s'},
+    {'n','a','p','o','h'},
+    {'n','a','p','o','o'},
+    {'n','a','p','p','a'},
+    {'n','a','p','p','e'},
+    {'n','a','p','p','y'},
+    {'n','a','r','a','s'},
+    {'n','a','r','c','o'},
+    {'n','a','r','c','s'},
+    {'n','a','r','d','s'},
+    {'n','a','r','e','s'},
+    {'n','a','r','i','c'},
+    {'n','a','r','i','s'},
+    {'n','a','r','k','s'},
+    {'n','a','r','k','y'},
+    {'n','a','r','o','d'},
+    {'n','a','r','r','a'},
+    {'n','a','r','r','e'},
+    {'n','a','s','a','l'},
+    {'n','a','s','h','i'},
+    {'n','a','s','h','o'},
+    {'n','a','s','i','s'},
+    {'n','a','s','o','n'},
+    {'n','a','s','t','y'},
+    {'n','a','s','u','s'},
+    {'n','a','t','a','k'},
+    {'n','a','t','a','l'},
+    {'n','a','t','c','h'},
+    {'n','a','t','e','s'},
+    {'n','a','t','i','s'},
+    {'n','a','t','t','o'},
+    {'n','a','t','t','y'},
+    {'n','a','t','y','a'},
+    {'n','a','u','c','h'},
+    {'n','a','u','n','t'},
+    {'n','a','v','a','l'},
+    {'n','a','v','a','r'},
+    {'n','a','v','e','d'},
+    {'n','a','v','e','l'},
+    {'n','a','v','e','s'},
+    {'n','a','v','e','w'},
+    {'n','a','v','v','y'},
+    {'n','a','w','a','b'},
+    {'n','a','w','a','l'},
+    {'n','a','z','a','r'},
+    {'n','a','z','e','s'},
+    {'n','a','z','i','r'},
+    {'n','a','z','i','s'},
+    {'n','a','z','z','y'},
+    {'n','d','u','j','a'},
+    {'n','e','a','f','e'},
+    {'n','e','a','l','s'},
+    {'n','e','a','n','t'},
+    {'n','e','a','p','s'},
+    {'n','e','a','r','s'},
+    {'n','e','a','t','h'},
+    {'n','e','a','t','o'},
+    {'n','e','a','t','s'},
+    {'n','e','b','b','y'},
+    {'n','e','b','e','k'},
+    {'n','e','b','e','l'},
+    {'n','e','c','h','e'},
+    {'n','e','c','k','s'},
+    {'n','e','d','d','y'},
+    {'n','e','e','b','s'},
+    {'n','e','e','d','s'},
+    {'n','e','e','d','y'},
+    {'n','e','e','f','s'},
+    {'n','e','e','l','d'},
+    {'n','e','e','l','e'},
+    {'n','e','e','m','b'},
+    {'n','e','e','m','s'},
+    {'n','e','e','p','s'},
+    {'n','e','e','s','e'},
+    {'n','e','e','z','e'},
+    {'n','e','f','i','e'},
+    {'n','e','g','r','i'},
+    {'n','e','g','r','o'},
+    {'n','e','g','u','s'},
+    {'n','e','i','f','s'},
+    {'n','e','i','g','h'},
+    {'n','e','i','s','t'},
+    {'n','e','i','v','e'},
+    {'n','e','l','i','a'},
+    {'n','e','l','i','s'},
+    {'n','e','l','l','y'},
+    {'n','e','m','a','s'},
+    {'n','e','m','i','c'},
+    {'n','e','m','n','s'},
+    {'n','e','m','p','t'},
+    {'n','e','n','e','s'},
+    {'n','e','n','t','a'},
+    {'n','e','o','n','s'},
+    {'n','e','o','s','a'},
+    {'n','e','o','z','a'},
+    {'n','e','p','e','r'},
+    {'n','e','p','i','t'},
+    {'n','e','r','a','l'},
+    {'n','e','r','a','m'},
+    {'n','e','r','d','s'},
+    {'n','e','r','d','y'},
+    {'n','e','r','f','s'},
+    {'n','e','r','k','a'},
+    {'n','e','r','k','s'},
+    {'n','e','r','o','l'},
+    {'n','e','r','t','s'},
+    {'n','e','r','t','z'},
+    {'n','e','r','v','e'},
+    {'n','e','r','v','y'},
+    {'n','e','s','k','i'},
+    {'n','e','s','t','s'},
+    {'n','e','s','t','y'},
+    {'n','e','t','a','s'},
+    {'n','e','t','e','s'},
+    {'n','e','t','o','p'},
+    {'n','e','t','t','a'},
+    {'n','e','t','t','s'},
+    {'n','e','t','t','y'},
+    {'n','e','u','k','s'},
+    {'n','e','u','m','e'},
+    {'n','e','u','m','s'},
+    {'n','e','v','e','l'},
+    {'n','e','v','e','r'},
+    {'n','e','v','e','s'},
+    {'n','e','v','i','s'},
+    {'n','e','v','u','s'},
+    {'n','e','v','v','y'},
+    {'n','e','w','b','s'},
+    {'n','e','w','e','d'},
+    {'n','e','w','e','l'},
+    {'n','e','w','e','r'},
+    {'n','e','w','i','e'},
+    {'n','e','w','l','y'},
+    {'n','e','w','s','y'},
+    {'n','e','w','t','s'},
+    {'n','e','x','a','l'},
+    {'n','e','x','i','n'},
+    {'n','e','x','t','s'},
+    {'n','e','x','u','m'},
+    {'n','e','x','u','s'},
+    {'n','g','a','i','o'},
+    {'n','g','a','k','a'},
+    {'n','g','a','n','a'},
+    {'n','g','a','p','i'},
+    {'n','g','a','t','i'},
+    {'n','g','e','g','e'},
+    {'n','g','o','m','a'},
+    {'n','g','o','n','i'},
+    {'n','g','r','a','m'},
+    {'n','g','w','e','e'},
+    {'n','i','b','b','y'},
+    {'n','i','c','a','d'},
+    {'n','i','c','e','d'},
+    {'n','i','c','e','r'},
+    {'n','i','c','e','y'},
+    {'n','i','c','h','e'},
+    {'n','i','c','h','t'},
+    {'n','i','c','k','s'},
+    {'n','i','c','k','y'},
+    {'n','i','c','o','l'},
+    {'n','i','d','a','l'},
+    {'n','i','d','e','d'},
+    {'n','i','d','e','s'},
+    {'n','i','d','o','r'},
+    {'n','i','d','u','s'},
+    {'n','i','e','c','e'},
+    {'n','i','e','f','s'},
+    {'n','i','e','s','s'},
+    {'n','i','e','v','e'},
+    {'n','i','f','e','s'},
+    {'n','i','f','f','s'},
+    {'n','i','f','f','y'},
+    {'n','i','f','l','e'},
+    {'n','i','f','t','y'},
+    {'n','i','g','e','r'},
+    {'n','i','g','g','a'},
+    {'n','i','g','h','s'},
+    {'n','i','g','h','t'},
+    {'n','i','g','r','e'},
+    {'n','i','g','u','a'},
+    {'n','i','h','i','l'},
+    {'n','i','k','a','b'},
+    {'n','i','k','a','h'},
+    {'n','i','k','a','u'},
+    {'n','i','l','a','s'},
+    {'n','i','l','l','s'},
+    {'n','i','m','b','i'},
+    {'n','i','m','b','s'},
+    {'n','i','m','b','y'},
+    {'n','i','m','p','s'},
+    {'n','i','n','e','r'},
+    {'n','i','n','e','s'},
+    {'n','i','n','j','a'},
+    {'n','i','n','n','y'},
+    {'n','i','n','o','n'},
+    {'n','i','n','t','a'},
+    {'n','i','n','t','h'},
+    {'n','i','o','p','o'},
+    {'n','i','o','z','a'},
+    {'n','i','p','a','s'},
+    {'n','i','p','e','t'},
+    {'n','i','p','p','y'},
+    {'n','i','q','a','b'},
+    {'n','i','r','l','s'},
+    {'n','i','r','l','y'},
+    {'n','i','s','e','i'},
+    {'n','i','s','i','n'},
+    {'n','i','s','s','e'},
+    {'n','i','s','u','s'},
+    {'n','i','t','a','l'},
+    {'n','i','t','e','r'},
+    {'n','i','t','e','s'},
+    {'n','i','t','i','d'},
+    {'n','i','t','o','n'},
+    {'n','i','t','r','e'},
+    {'n','i','t','r','o'},
+    {'n','i','t','r','y'},
+    {'n','i','t','t','a'},
+    {'n','i','t','t','o'},
+    {'n','i','t','t','y'},
+    {'n','i','v','a','l'},
+    {'n','i','v','a','s'},
+    {'n','i','v','e','l'},
+    {'n','i','x','e','d'},
+    {'n','i','x','e','r'},
+    {'n','i','x','e','s'},
+    {'n','i','x','i','e'},
+    {'n','i','z','a','m'},
+    {'n','j','i','r','l'},
+    {'n','k','o','s','i'},
+    {'n','m','o','l','i'},
+    {'n','m','o','l','s'},
+    {'n','o','a','h','s'},
+    {'n','o','b','b','y'},
+    {'n','o','b','l','e'},
+    {'n','o','b','l','y'},
+    {'n','o','c','k','s'},
+    {'n','o','d','a','l'},
+    {'n','o','d','d','y'},
+    {'n','o','d','e','d'},
+    {'n','o','d','e','s'},
+    {'n','o','d','u','m'},
+    {'n','o','d','u','s'},
+    {'n','o','e','l','s'},
+    {'n','o','e','m','a'},
+    {'n','o','e','m','e'},
+    {'n','o','g','a','l'},
+    {'n','o','g','g','s'},
+    {'n','o','g','g','y'},
+    {'n','o','h','o','w'},
+    {'n','o','i','a','s'},
+    {'n','o','i','l','s'},
+    {'n','o','i','l','y'},
+    {'n','o','i','n','t'},
+    {'n','o','i','r','e'},
+    {'n','o','i','r','s'},
+    {'n','o','i','s','e'},
+    {'n','o','i','s','y'},
+    {'n','o','k','e','s'},
+    {'n','o','l','e','s'},
+    {'n','o','l','l','e'},
+    {'n','o','l','l','s'},
+    {'n','o','l','o','s'},
+    {'n','o','m','a','d'},
+    {'n','o','m','a','s'},
+    {'n','o','m','e','n'},
+    {'n','o','m','e','s'},
+    {'n','o','m','i','c'},
+    {'n','o','m','o','i'},
+    {'n','o','m','o','s'},
+    {'n','o','n','a','n'},
+    {'n','o','n','a','s'},
+    {'n','o','n','c','e'},
+    {'n','o','n','c','y'},
+    {'n','o','n','d','a'},
+    {'n','o','n','d','o'},
+    {'n','o','n','e','s'},
+    {'n','o','n','e','t'},
+    {'n','o','n','g','s'},
+    {'n','o','n','i','c'},
+    {'n','o','n','i','s'},
+    {'n','o','n','n','a'},
+    {'n','o','n','n','o'},
+    {'n','o','n','n','y'},
+    {'n','o','n','y','l'},
+    {'n','o','o','b','s'},
+    {'n','o','o','i','s'},
+    {'n','o','o','i','t'},
+    {'n','o','o','k','s'},
+    {'n','o','o','k','y'},
+    {'n','o','o','n','e'},
+    {'n','o','o','n','s'},
+    {'n','o','o','p','s'},
+    {'n','o','o','s','e'},
+    {'n','o','o','v','e'},
+    {'n','o','p','a','l'},
+    {'n','o','r','i','a'},
+    {'n','o','r','i','e'},
+    {'n','o','r','i','s'},
+    {'n','o','r','k','s'},
+    {'n','o','r','m','a'},
+    {'n','o','r','m','s'},
+    {'n','o','r','t','h'},
+    {'n','o','s','e','d'},
+    {'n','o','s','e','r'},
+    {'n','o','s','e','s'},
+    {'n','o','s','e','y'},
+    {'n','o','s','h','i'},
+    {'n','o','s','i','r'},
+    {'n','o','t','a','l'},
+    {'n','o','t','a','m'},
+    {'n','o','t','c','h'},
+    {'n','o','t','e','d'},
+    {'n','o','t','e','r'},
+    {'n','o','t','e','s'},
+    {'n','o','t','u','m'},
+    {'n','o','u','g','s'},
+    {'n','o','u','j','a'},
+    {'n','o','u','l','d'},
+    {'n','o','u','l','e'},
+    {'n','o','u','l','s'},
+    {'n','o','u','n','s'},
+    {'n','o','u','n','y'},
+    {'n','o','u','p','s'},
+    {'n','o','u','s','t'},
+    {'n','o','v','a','e'},
+    {'n','o','v','a','s'},
+    {'n','o','v','e','l'},
+    {'n','o','v','i','a'},
+    {'n','o','v','i','o'},
+    {'n','o','v','u','m'},
+    {'n','o','w','a','y'},
+    {'n','o','w','d','s'},
+    {'n','o','w','e','d'},
+    {'n','o','w','l','s'},
+    {'n','o','w','t','s'},
+    {'n','o','w','t','y'},
+    {'n','o','x','a','l'},
+    {'n','o','x','a','s'},
+    {'n','o','x','e','s'},
+    {'n','o','y','a','u'},
+    {'n','o','y','e','d'},
+    {'n','o','y','e','s'},
+    {'n','r','t','t','a'},
+    {'n','r','t','y','a'},
+    {'n','s','i','m','a'},
+    {'n','u','b','b','y'},
+    {'n','u','b','i','a'},
+    {'n','u','c','h','a'},
+    {'n','u','c','i','n'},
+    {'n','u','d','d','y'},
+    {'n','u','d','e','r'},
+    {'n','u','d','e','s'},
+    {'n','u','d','g','e'},
+    {'n','u','d','g','y'},
+    {'n','u','d','i','e'},
+    {'n','u','d','z','h'},
+    {'n','u','e','v','o'},
+    {'n','u','f','f','s'},
+    {'n','u','g','a','e'},
+    {'n','u','j','o','l'},
+    {'n','u','k','e','d'},
+    {'n','u','k','e','s'},
+    {'n','u','l','l','a'},
+    {'n','u','l','l','o'},
+    {'n','u','l','l','s'},
+    {'n','u','l','l','y'},
+    {'n','u','m','b','s'},
+    {'n','u','m','e','n'},
+    {'n','u','m','m','y'},
+    {'n','u','m','p','s'},
+    {'n','u','n','k','s'},
+    {'n','u','n','k','y'},
+    {'n','u','n','n','y'},
+    {'n','u','n','u','s'},
+    {'n','u','q','u','e'},
+    {'n','u','r','d','s'},
+    {'n','u','r','d','y'},
+    {'n','u','r','l','s'},
+    {'n','u','r','r','s'},
+    {'n','u','r','s','e'},
+    {'n','u','r','t','s'},
+    {'n','u','r','t','z'},
+    {'n','u','s','e','d'},
+    {'n','u','s','e','s'},
+    {'n','u','t','s','o'},
+    {'n','u','t','s','y'},
+    {'n','u','t','t','y'},
+    {'n','y','a','f','f'},
+    {'n','y','a','l','a'},
+    {'n','y','a','m','s'},
+    {'n','y','i','n','g'},
+    {'n','y','l','o','n'},
+    {'n','y','m','p','h'},
+    {'n','y','o','n','g'},
+    {'n','y','s','s','a'},
+    {'n','y','u','n','g'},
+    {'n','y','u','s','e'},
+    {'n','y','u','z','e'},
+    {'o','a','f','o','s'},
+    {'o','a','k','e','d'},
+    {'o','a','k','e','n'},
+    {'o','a','k','e','r'},
+    {'o','a','k','u','m'},
+    {'o','a','r','e','d'},
+    {'o','a','r','e','r'},
+    {'o','a','s','a','l'},
+    {'o','a','s','e','s'},
+    {'o','a','s','i','s'},
+    {'o','a','s','t','s'},
+    {'o','a','t','e','n'},
+    {'o','a','t','e','r'},
+    {'o','a','t','h','s'},
+    {'o','a','v','e','s'},
+    {'o','b','a','n','g'},
+    {'o','b','b','o','s'},
+    {'o','b','e','a','h'},
+    {'o','b','e','l','i'},
+    {'o','b','e','s','e'},
+    {'o','b','e','y','s'},
+    {'o','b','i','a','s'},
+    {'o','b','i','e','d'},
+    {'o','b','i','i','t'},
+    {'o','b','i','t','s'},
+    {'o','b','j','e','t'},
+    {'o','b','o','e','s'},
+    {'o','b','o','l','e'},
+    {'o','b','o','l','i'},
+    {'o','b','o','l','s'},
+    {'o','c','c','a','m'},
+    {'o','c','c','u','r'},
+    {'o','c','e','a','n'},
+    {'o','c','h','e','r'},
+    {'o','c','h','e','s'},
+    {'o','c','h','r','e'},
+    {'o','c','h','r','y'},
+    {'o','c','k','e','r'},
+    {'o','c','o','t','e'},
+    {'o','c','r','e','a'},
+    {'o','c','t','a','d'},
+    {'o','c','t','a','l'},
+    {'o','c','t','a','n'},
+    {'o','c','t','a','s'},
+    {'o','c','t','e','t'},
+    {'o','c','t','i','c'},
+    {'o','c','t','l','i'},
+    {'o','c','t','y','l'},
+    {'o','c','u','l','i'},
+    {'o','d','a','h','s'},
+    {'o','d','a','l','s'},
+    {'o','d','d','e','r'},
+    {'o','d','d','l','y'},
+    {'o','d','e','o','n'},
+    {'o','d','e','u','m'},
+    {'o','d','i','s','m'},
+    {'o','d','i','s','t'},
+    {'o','d','i','u','m'},
+    {'o','d','o','o','m'},
+    {'o','d','o','r','s'},
+    {'o','d','o','u','r'},
+    {'o','d','u','m','s'},
+    {'o','d','y','l','e'},
+    {'o','d','y','l','s'},
+    {'o','f','a','y','s'},
+    {'o','f','f','a','l'},
+    {'o','f','f','e','d'},
+    {'o','f','f','e','r'},
+    {'o','f','f','i','e'},
+    {'o','f','l','a','g'},
+    {'o','f','t','e','n'},
+    {'o','f','t','e','r'},
+    {'o','f','u','r','o'},
+    {'o','g','a','m','s'},
+    {'o','g','e','e','d'},
+    {'o','g','e','e','s'},
+    {'o','g','g','i','n'},
+    {'o','g','h','a','m'},
+    {'o','g','i','v','e'},
+    {'o','g','l','e','d'},
+    {'o','g','l','e','r'},
+    {'o','g','l','e','s'},
+    {'o','g','m','i','c'},
+    {'o','g','r','e','s'},
+    {'o','h','e','l','o'},
+    {'o','h','i','a','s'},
+    {'o','h','i','n','g'},
+    {'o','h','m','i','c'},
+    {'o','h','o','n','e'},
+    {'o','i','c','k','s'},
+    {'o','i','d','i','a'},
+    {'o','i','l','e','d'},
+    {'o','i','l','e','r'},
+    {'o','i','l','e','t'},
+    {'o','i','n','k','s'},
+    {'o','i','n','t','s'},
+    {'o','i','r','a','n'},
+    {'o','j','i','m','e'},
+    {'o','k','a','p','i'},
+    {'o','k','a','y','s'},
+    {'o','k','e','h','s'},
+    {'o','k','i','e','s'},
+    {'o','k','i','n','g'},
+    {'o','k','o','l','e'},
+    {'o','k','r','a','s'},
+    {'o','k','r','u','g'},
+    {'o','k','t','a','s'},
+    {'o','l','a','t','e'},
+    {'o','l','d','e','n'},
+    {'o','l','d','e','r'},
+    {'o','l','d','i','e'},
+    {'o','l','d','l','y'},
+    {'o','l','e','h','s'},
+    {'o','l','e','i','c'},
+    {'o','l','e','i','n'},
+    {'o','l','e','n','t'},
+    {'o','l','e','o','s'},
+    {'o','l','e','u','m'},
+    {'o','l','e','y','l'},
+    {'o','l','i','g','o'},
+    {'o','l','i','o','s'},
+    {'o','l','i','v','a'},
+    {'o','l','i','v','e'},
+    {'o','l','l','a','s'},
+    {'o','l','l','a','v'},
+    {'o','l','l','e','r'},
+    {'o','l','l','i','e'},
+    {'o','l','o','g','y'},
+    {'o','l','o','n','a'},
+    {'o','l','p','a','e'},
+    {'o','l','p','e','s'},
+    {'o','m','a','s','a'},
+    {'o','m','b','e','r'},
+    {'o','m','b','r','e'},
+    {'o','m','b','u','s'},
+    {'o','m','d','a','h'},
+    {'o','m','d','a','s'},
+    {'o','m','d','d','a'},
+    {'o','m','d','e','h'},
+    {'o','m','e','e','s'},
+    {'o','m','e','g','a'},
+    {'o','m','e','n','s'},
+    {'o','m','e','r','s'},
+    {'o','m','i','a','i'},
+    {'o','m','i','t','s'},
+    {'o','m','l','a','h'},
+    {'o','m','m','e','l'},
+    {'o','m','m','i','n'},
+    {'o','m','n','e','s'},
+    {'o','m','o','v','s'},
+    {'o','m','r','a','h'},
+    {'o','m','u','l','s'},
+    {'o','n','c','e','r'},
+    {'o','n','c','e','s'},
+    {'o','n','c','e','t'},
+    {'o','n','c','u','s'},
+    {'o','n','d','e','s'},
+    {'o','n','d','o','l'},
+    {'o','n','e','l','y'},
+    {'o','n','e','r','s'},
+    {'o','n','e','r','y'},
+    {'o','n','g','o','n'},
+    {'o','n','i','o','n'},
+    {'o','n','i','u','m'},
+    {'o','n','k','u','s'},
+    {'o','n','l','a','p'},
+    {'o','n','l','a','y'},
+    {'o','n','m','u','n'},
+    {'o','n','n','e','d'},
+    {'o','n','s','e','n'},
+    {'o','n','s','e','t'},
+    {'o','n','t','a','l'},
+    {'o','n','t','i','c'},
+    {'o','o','a','a','s'},
+    {'o','o','b','i','t'},
+    {'o','o','h','e','d'},
+    {'o','o','i','d','s'},
+    {'o','o','j','a','h'},
+    {'o','o','m','p','h'},
+    {'o','o','n','t','s'},
+    {'o','o','p','a','k'},
+    {'o','o','p','e','d'},
+    {'o','o','p','s','y'},
+    {'o','o','r','i','e'},
+    {'o','o','s','e','s'},
+    {'o','o','t','i','d'},
+    {'o','o','y','a','h'},
+    {'o','o','z','e','d'},
+    {'o','o','z','e','s'},
+    {'o','o','z','i','e'},
+    {'o','o','z','l','e'},
+    {'o','p','a','h','s'},
+    {'o','p','a','l','s'},
+    {'o','p','e','n','s'},
+    {'o','p','e','p','e'},
+    {'o','p','e','r','a'},
+    {'o','p','e','r','y'},
+    {'o','p','g','a','f'},
+    {'o','p','i','h','i'},
+    {'o','p','i','n','e'},
+    {'o','p','i','n','g'},
+    {'o','p','i','u','m'},
+    {'o','p','p','o','s'},
+    {'o','p','s','a','t'},
+    {'o','p','s','i','n'},
+    {'o','p','s','i','t'},
+    {'o','p','t','e','d'},
+    {'o','p','t','e','r'},
+    {'o','p','t','i','c'},
+    {'o','p','z','i','t'},
+    {'o','r','a','c','h'},
+    {'o','r','a','c','y'},
+    {'o','r','a','l','s'},
+    {'o','r','a','n','g'},
+    {'o','r','a','n','s'},
+    {'o','r','a','n','t'},
+    {'o','r','a','t','e'},
+    {'o','r','b','a','t'},
+    {'o','r','b','e','d'},
+    {'o','r','b','i','c'},
+    {'o','r','b','i','t'},
+    {'o','r','c','a','s'},
+    {'o','r','c','i','n'},
+    {'o','r','d','e','r'},
+    {'o','r','d','i','e'},
+    {'o','r','d','o','s'},
+    {'o','r','e','a','d'},
+    {'o','r','f','e','s'},
+    {'o','r','f','u','l'},
+    {'o','r','g','a','n'},
+    {'o','r','g','i','a'},
+    {'o','r','g','i','c'},
+    {'o','r','g','u','e'},
+    {'o','r','i','b','i'},
+    {'o','r','i','e','l'},
+    {'o','r','i','g','o'},
+    {'o','r','i','x','a'},
+    {'o','r','l','e','s'},
+    {'o','r','l','o','n'},
+    {'o','r','l','o','p'},
+    {'o','r','m','e','r'},
+    {'o','r','n','e','e'},
+    {'o','r','n','i','s'},
+    {'o','r','p','e','d'},
+    {'o','r','p','i','n'},
+    {'o','r','r','i','s'},
+    {'o','r','t','e','t'},
+    {'o','r','t','h','o'},
+    {'o','r','v','a','l'},
+    {'o','r','z','o','s'},
+    {'o','s','a','r','s'},
+    {'o','s','c','a','r'},
+    {'o','s','e','t','r'},
+    {'o','s','e','y','s'},
+    {'o','s','h','a','c'},
+    {'o','s','i','e','r'},
+    {'o','s','k','i','n'},
+    {'o','s','l','i','n'},
+    {'o','s','m','i','c'},
+    {'o','s','m','o','l'},
+    {'o','s','o','n','e'},
+    {'o','s','s','i','a'},
+    {'o','s','t','i','a'},
+    {'o','t','a','k','u'},
+    {'o','t','a','r','y'},
+    {'o','t','h','e','r'},
+    {'o','t','h','y','l'},
+    {'o','t','i','u','m'},
+    {'o','t','t','a','r'},
+    {'o','t','t','e','r'},
+    {'o','t','t','o','s'},
+    {'o','u','b','i','t'},
+    {'o','u','c','h','e'},
+    {'o','u','c','h','t'},
+    {'o','u','e','d','s'},
+    {'o','u','e','n','s'},
+    {'o','u','g','h','t'},
+    {'o','u','i','j','a'},
+    {'o','u','l','k','s'},
+    {'o','u','m','a','s'},
+    {'o','u','n','c','e'},
+    {'o','u','n','d','y'},
+    {'o','u','p','a','s'},
+    {'o','u','p','e','d'},
+    {'o','u','p','h','e'},
+    {'o','u','p','h','s'},
+    {'o','u','r','e','y'},
+    {'o','u','r','i','e'},
+    {'o','u','s','e','l'},
+    {'o','u','s','i','a'},
+    {'o','u','s','t','s'},
+    {'o','u','t','b','y'},
+    {'o','u','t','d','o'},
+    {'o','u','t','e','d'},
+    {'o','u','t','e','n'},
+    {'o','u','t','e','r'},
+    {'o','u','t','g','o'},
+    {'o','u','t','i','e'},
+    {'o','u','t','r','e'},
+    {'o','u','t','r','o'},
+    {'o','u','t','t','a'},
+    {'o','u','z','e','l'},
+    {'o','u','z','o','s'},
+    {'o','v','a','l','s'},
+    {'o','v','a','r','y'},
+    {'o','v','a','t','e'},
+    {'o','v','e','l','s'},
+    {'o','v','e','n','s'},
+    {'o','v','e','r','s'},
+    {'o','v','e','r','t'},
+    {'o','v','i','n','e'},
+    {'o','v','i','s','m'},
+    {'o','v','i','s','t'},
+    {'o','v','o','i','d'},
+    {'o','v','o','l','i'},
+    {'o','v','o','l','o'},
+    {'o','v','u','l','e'},
+    {'o','w','a','r','e'},
+    {'o','w','a','r','i'},
+    {'o','w','c','h','e'},
+    {'o','w','e','r','s'},
+    {'o','w','i','e','s'},
+    {'o','w','i','n','g'},
+    {'o','w','l','e','d'},
+    {'o','w','l','e','r'},
+    {'o','w','l','e','t'},
+    {'o','w','n','e','d'},
+    {'o','w','n','e','r'},
+    {'o','w','n','i','o'},
+    {'o','w','r','e','s'},
+    {'o','w','r','i','e'},
+    {'o','w','s','e','n'},
+    {'o','x','b','o','w'},
+    {'o','x','e','a','s'},
+    {'o','x','e','r','s'},
+    {'o','x','e','y','e'},
+    {'o','x','i','d','e'},
+    {'o','x','i','d','s'},
+    {'o','x','i','e','s'},
+    {'o','x','i','m','e'},
+    {'o','x','i','m','s'},
+    {'o','x','i','n','e'},
+    {'o','x','l','i','p'},
+    {'o','x','m','a','n'},
+    {'o','x','m','e','n'},
+    {'o','x','t','e','r'},
+    {'o','y','a','m','a'},
+    {'o','y','e','r','s'},
+    {'o','z','e','k','i'},
+    {'o','z','e','n','a'},
+    {'o','z','o','n','e'},
+    {'o','z','z','i','e'},
+    {'p','a','a','h','o'},
+    {'p','a','a','l','s'},
+    {'p','a','a','n','s'},
+    {'p','a','c','a','i'},
+    {'p','a','c','a','s'},
+    {'p','a','c','a','y'},
+    {'p','a','c','e','d'},
+    {'p','a','c','e','r'},
+    {'p','a','c','e','s'},
+    {'p','a','c','e','y'},
+    {'p','a','c','h','a'},
+    {'p','a','c','k','s'},
+    {'p','a','c','k','y'},
+    {'p','a','c','o','s'},
+    {'p','a','c','t','a'},
+    {'p','a','c','t','s'},
+    {'p','a','d','a','m'},
+    {'p','a','d','a','s'},
+    {'p','a','d','d','o'},
+    {'p','a','d','d','y'},
+    {'p','a','d','i','s'},
+    {'p','a','d','l','e'},
+    {'p','a','d','m','a'},
+    {'p','a','d','o','u'},
+    {'p','a','d','r','e'},
+    {'p','a','d','r','i'},
+    {'p','a','e','a','n'},
+    {'p','a','e','d','o'},
+    {'p','a','e','o','n'},
+    {'p','a','g','a','n'},
+    {'p','a','g','e','d'},
+    {'p','a','g','e','r'},
+    {'p','a','g','e','s'},
+    {'p','a','g','l','e'},
+    {'p','a','g','n','e'},
+    {'p','a','g','o','d'},
+    {'p','a','g','r','i'},
+    {'p','a','h','i','t'},
+    {'p','a','h','o','s'},
+    {'p','a','h','u','s'},
+    {'p','a','i','k','s'},
+    {'p','a','i','l','s'},
+    {'p','a','i','n','s'},
+    {'p','a','i','n','t'},
+    {'p','a','i','p','e'},
+    {'p','a','i','p','s'},
+    {'p','a','i','r','e'},
+    {'p','a','i','r','s'},
+    {'p','a','i','s','a'},
+    {'p','a','i','s','e'},
+    {'p','a','k','a','y'},
+    {'p','a','k','k','a'},
+    {'p','a','k','k','i'},
+    {'p','a','k','u','a'},
+    {'p','a','k','u','l'},
+    {'p','a','l','a','k'},
+    {'p','a','l','a','r'},
+    {'p','a','l','a','s'},
+    {'p','a','l','a','y'},
+    {'p','a','l','e','a'},
+    {'p','a','l','e','d'},
+    {'p','a','l','e','r'},
+    {'p','a','l','e','s'},
+    {'p','a','l','e','t'},
+    {'p','a','l','i','s'},
+    {'p','a','l','k','i'},
+    {'p','a','l','l','a'},
+    {'p','a','l','l','s'},
+    {'p','a','l','l','u'},
+    {'p','a','l','l','y'},
+    {'p','a','l','m','s'},
+    {'p','a','l','m','y'},
+    {'p','a','l','p','i'},
+    {'p','a','l','p','s'},
+    {'p','a','l','s','a'},
+    {'p','a','l','s','y'},
+    {'p','a','l','u','s'},
+    {'p','a','m','b','y'},
+    {'p','a','m','p','a'},
+    {'p','a','n','a','x'},
+    {'p','a','n','c','e'},
+    {'p','a','n','c','h'},
+    {'p','a','n','d','a'},
+    {'p','a','n','d','s'},
+    {'p','a','n','d','y'},
+    {'p','a','n','e','d'},
+    {'p','a','n','e','l'},
+    {'p','a','n','e','s'},
+    {'p','a','n','g','a'},
+    {'p','a','n','g','s'},
+    {'p','a','n','i','c'},
+    {'p','a','n','i','m'},
+    {'p','a','n','i','r'},
+    {'p','a','n','k','o'},
+    {'p','a','n','k','s'},
+    {'p','a','n','n','a'},
+    {'p','a','n','n','e'},
+    {'p','a','n','n','i'},
+    {'p','a','n','n','y'},
+    {'p','a','n','s','y'},
+    {'p','a','n','t','o'},
+    {'p','a','n','t','s'},
+    {'p','a','n','t','y'},
+    {'p','a','o','l','i'},
+    {'p','a','o','l','o'},
+    {'p','a','p','a','d'},
+    {'p','a','p','a','l'},
+    {'p','a','p','a','s'},
+    {'p','a','p','a','w'},
+    {'p','a','p','e','r'},
+    {'p','a','p','e','s'},
+    {'p','a','p','e','y'},
+    {'p','a','p','p','i'},
+    {'p','a','p','p','y'},
+    {'p','a','p','r','i'},
+    {'p','a','r','a','e'},
+    {'p','a','r','a','s'},
+    {'p','a','r','c','h'},
+    {'p','a','r','c','s'},
+    {'p','a','r','d','i'},
+    {'p','a','r','d','s'},
+    {'p','a','r','d','y'},
+    {'p','a','r','e','d'},
+    {'p','a','r','e','n'},
+    {'p','a','r','e','o'},
+    {'p','a','r','e','r'},
+    {'p','a','r','e','s'},
+    {'p','a','r','e','u'},
+    {'p','a','r','e','v'},
+    {'p','a','r','g','e'},
+    {'p','a','r','g','o'},
+    {'p','a','r','i','d'},
+    {'p','a','r','i','s'},
+    {'p','a','r','k','a'},
+    {'p','a','r','k','i'},
+    {'p','a','r','k','s'},
+    {'p','a','r','k','y'},
+    {'p','a','r','l','e'},
+    {'p','a','r','l','y'},
+    {'p','a','r','m','a'},
+    {'p','a','r','m','o'},
+    {'p','a','r','m','s'},
+    {'p','a','r','o','l'},
+    {'p','a','r','p','s'},
+    {'p','a','r','r','a'},
+    {'p','a','r','r','s'},
+    {'p','a','r','r','y'},
+    {'p','a','r','s','e'},
+    {'p','a','r','t','e'},
+    {'p','a','r','t','i'},
+    {'p','a','r','t','s'},
+    {'p','a','r','t','y'},
+    {'p','a','r','v','e'},
+    {'p','a','r','v','o'},
+    {'p','a','s','a','g'},
+    {'p','a','s','a','r'},
+    {'p','a','s','c','h'},
+    {'p','a','s','e','o'},
+    {'p','a','s','e','s'},
+    {'p','a','s','h','a'},
+    {'p','a','s','h','m'},
+    {'p','a','s','k','a'},
+    {'p','a','s','m','o'},
+    {'p','a','s','p','y'},
+    {'p','a','s','s','e'},
+    {'p','a','s','s','u'},
+    {'p','a','s','t','a'},
+    {'p','a','s','t','e'},
+    {'p','a','s','t','s'},
+    {'p','a','s','t','y'},
+    {'p','a','t','a','s'},
+    {'p','a','t','c','h'},
+    {'p','a','t','e','d'},
+    {'p','a','t','e','e'},
+    {'p','a','t','e','l'},
+    {'p','a','t','e','n'},
+    {'p','a','t','e','r'},
+    {'p','a','t','e','s'},
+    {'p','a','t','h','s'},
+    {'p','a','t','i','a'},
+    {'p','a','t','i','n'},
+    {'p','a','t','i','o'},
+    {'p','a','t','k','a'},
+    {'p','a','t','l','y'},
+    {'p','a','t','s','y'},
+    {'p','a','t','t','a'},
+    {'p','a','t','t','e'},
+    {'p','a','t','t','u'},
+    {'p','a','t','t','y'},
+    {'p','a','t','u','s'},
+    {'p','a','u','a','s'},
+    {'p','a','u','l','s'},
+    {'p','a','u','s','e'},
+    {'p','a','u','x','i'},
+    {'p','a','v','a','n'},
+    {'p','a','v','a','s'},
+    {'p','a','v','e','d'},
+    {'p','a','v','e','n'},
+    {'p','a','v','e','r'},
+    {'p','a','v','e','s'},
+    {'p','a','v','i','d'},
+    {'p','a','v','i','e'},
+    {'p','a','v','i','n'},
+    {'p','a','v','i','s'},
+    {'p','a','v','o','n'},
+    {'p','a','v','v','y'},
+    {'p','a','w','a','s'},
+    {'p','a','w','a','w'},
+    {'p','a','w','e','d'},
+    {'p','a','w','e','r'},
+    {'p','a','w','k','s'},
+    {'p','a','w','k','y'},
+    {'p','a','w','l','s'},
+    {'p','a','w','n','s'},
+    {'p','a','x','e','s'},
+    {'p','a','y','e','d'},
+    {'p','a','y','e','e'},
+    {'p','a','y','e','r'},
+    {'p','a','y','o','r'},
+    {'p','a','y','s','d'},
+    {'p','e','a','c','e'},
+    {'p','e','a','c','h'},
+    {'p','e','a','g','e'},
+    {'p','e','a','g','s'},
+    {'p','e','a','k','e'},
+    {'p','e','a','k','s'},
+    {'p','e','a','k','y'},
+    {'p','e','a','l','s'},
+    {'p','e','a','n','s'},
+    {'p','e','a','r','e'},
+    {'p','e','a','r','l'},
+    {'p','e','a','r','s'},
+    {'p','e','a','r','t'},
+    {'p','e','a','s','e'},
+    {'p','e','a','s','y'},
+    {'p','e','a','t','s'},
+    {'p','e','a','t','y'},
+    {'p','e','a','v','y'},
+    {'p','e','a','z','e'},
+    {'p','e','b','a','s'},
+    {'p','e','c','a','n'},
+    {'p','e','c','h','s'},
+    {'p','e','c','i','a'},
+    {'p','e','c','k','e'},
+    {'p','e','c','k','s'},
+    {'p','e','c','k','y'},
+    {'p','e','c','t','s'},
+    {'p','e','d','a','l'},
+    {'p','e','d','e','s'},
+    {'p','e','d','i','s'},
+    {'p','e','d','o','n'},
+    {'p','e','d','o','s'},
+    {'p','e','d','r','o'},
+    {'p','e','e','c','e'},
+    {'p','e','e','k','s'},
+    {'p','e','e','k','y'},
+    {'p','e','e','l','s'},
+    {'p','e','e','l','y'},
+    {'p','e','e','n','s'},
+    {'p','e','e','n','t'},
+    {'p','e','e','o','y'},
+    {'p','e','e','p','e'},
+    {'p','e','e','p','s'},
+    {'p','e','e','p','y'},
+    {'p','e','e','r','s'},
+    {'p','e','e','r','y'},
+    {'p','e','e','v','e'},
+    {'p','e','e','v','o'},
+    {'p','e','g','g','y'},
+    {'p','e','g','h','s'},
+    {'p','e','g','m','a'},
+    {'p','e','g','o','s'},
+    {'p','e','i','n','e'},
+    {'p','e','i','n','s'},
+    {'p','e','i','s','e'},
+    {'p','e','i','s','y'},
+    {'p','e','i','z','e'},
+    {'p','e','k','a','n'},
+    {'p','e','k','a','u'},
+    {'p','e','k','e','a'},
+    {'p','e','k','e','s'},
+    {'p','e','k','i','d'},
+    {'p','e','k','i','n'},
+    {'p','e','k','o','e'},
+    {'p','e','l','a','s'},
+    {'p','e','l','a','u'},
+    {'p','e','l','c','h'},
+    {'p','e','l','e','s'},
+    {'p','e','l','f','s'},
+    {'p','e','l','l','s'},
+    {'p','e','l','m','a'},
+    {'p','e','l','o','g'},
+    {'p','e','l','o','n'},
+    {'p','e','l','s','h'},
+    {'p','e','l','t','a'},
+    {'p','e','l','t','s'},
+    {'p','e','l','u','s'},
+    {'p','e','n','a','l'},
+    {'p','e','n','c','e'},
+    {'p','e','n','d','s'},
+    {'p','e','n','d','u'},
+    {'p','e','n','e','d'},
+    {'p','e','n','e','s'},
+    {'p','e','n','g','o'},
+    {'p','e','n','i','e'},
+    {'p','e','n','i','s'},
+    {'p','e','n','k','s'},
+    {'p','e','n','n','a'},
+    {'p','e','n','n','e'},
+    {'p','e','n','n','i'},
+    {'p','e','n','n','y'},
+    {'p','e','n','s','e'},
+    {'p','e','n','s','y'},
+    {'p','e','n','t','s'},
+    {'p','e','o','l','a'},
+    {'p','e','o','n','s'},
+    {'p','e','o','n','y'},
+    {'p','e','p','l','a'},
+    {'p','e','p','l','e'},
+    {'p','e','p','o','n'},
+    {'p','e','p','o','s'},
+    {'p','e','p','p','y'},
+    {'p','e','p','s','i'},
+    {'p','e','q','u','i'},
+    {'p','e','r','a','e'},
+    {'p','e','r','a','i'},
+    {'p','e','r','c','e'},
+    {'p','e','r','c','h'},
+    {'p','e','r','c','s'},
+    {'p','e','r','d','u'},
+    {'p','e','r','d','y'},
+    {'p','e','r','e','a'},
+    {'p','e','r','e','s'},
+    {'p','e','r','f','s'},
+    {'p','e','r','i','l'},
+    {'p','e','r','i','s'},
+    {'p','e','r','k','s'},
+    {'p','e','r','k','y'},
+    {'p','e','r','l','e'},
+    {'p','e','r','l','s'},
+    {'p','e','r','m','s'},
+    {'p','e','r','m','y'},
+    {'p','e','r','n','e'},
+    {'p','e','r','n','s'},
+    {'p','e','r','o','g'},
+    {'p','e','r','p','s'},
+    {'p','e','r','r','y'},
+    {'p','e','r','s','e'},
+    {'p','e','r','s','p'},
+    {'p','e','r','s','t'},
+    {'p','e','r','t','s'},
+    {'p','e','r','v','e'},
+    {'p','e','r','v','o'},
+    {'p','e','r','v','s'},
+    {'p','e','r','v','y'},
+    {'p','e','s','c','h'},
+    {'p','e','s','k','y'},
+    {'p','e','s','o','s'},
+    {'p','e','s','t','a'},
+    {'p','e','s','t','o'},
+    {'p','e','s','t','s'},
+    {'p','e','s','t','y'},
+    {'p','e','t','a','l'},
+    {'p','e','t','a','r'},
+    {'p','e','t','e','r'},
+    {'p','e','t','i','t'},
+    {'p','e','t','o','s'},
+    {'p','e','t','r','e'},
+    {'p','e','t','r','i'},
+    {'p','e','t','t','i'},
+    {'p','e','t','t','o'},
+    {'p','e','t','t','y'},
+    {'p','e','w','e','d'},
+    {'p','e','w','e','e'},
+    {'p','e','w','i','t'},
+    {'p','e','y','s','e'},
+    {'p','f','f','t','t'},
+    {'p','h','a','g','e'},
+    {'p','h','a','n','g'},
+    {'p','h','a','r','e'},
+    {'p','h','a','r','m'},
+    {'p','h','a','s','e'},
+    {'p','h','a','s','m'},
+    {'p','h','e','e','r'},
+    {'p','h','e','m','e'},
+    {'p','h','e','n','e'},
+    {'p','h','e','o','n'},
+    {'p','h','e','s','e'},
+    {'p','h','i','a','l'},
+    {'p','h','i','e','s'},
+    {'p','h','i','s','h'},
+    {'p','h','i','z','z'},
+    {'p','h','l','o','x'},
+    {'p','h','o','b','e'},
+    {'p','h','o','c','a'},
+    {'p','h','o','n','e'},
+    {'p','h','o','n','o'},
+    {'p','h','o','n','s'},
+    {'p','h','o','n','y'},
+    {'p','h','o','o','h'},
+    {'p','h','o','o','o'},
+    {'p','h','o','t','a'},
+    {'p','h','o','t','o'},
+    {'p','h','o','t','s'},
+    {'p','h','o','t','y'},
+    {'p','h','p','h','t'},
+    {'p','h','u','b','s'},
+    {'p','h','u','t','s'},
+    {'p','h','u','t','u'},
+    {'p','h','w','a','t'},
+    {'p','h','y','l','a'},
+    {'p','h','y','l','e'},
+    {'p','h','y','m','a'},
+    {'p','h','y','n','x'},
+    {'p','h','y','s','a'},
+    {'p','i','a','i','s'},
+    {'p','i','a','n','i'},
+    {'p','i','a','n','o'},
+    {'p','i','a','n','s'},
+    {'p','i','b','a','l'},
+    {'p','i','c','a','l'},
+    {'p','i','c','a','s'},
+    {'p','i','c','c','y'},
+    {'p','i','c','e','y'},
+    {'p','i','c','h','i'},
+    {'p','i','c','k','s'},
+    {'p','i','c','k','y'},
+    {'p','i','c','o','n'},
+    {'p','i','c','o','t'},
+    {'p','i','c','r','a'},
+    {'p','i','c','u','l'},
+    {'p','i','e','c','e'},
+    {'p','i','e','d','s'},
+    {'p','i','e','n','d'},
+    {'p','i','e','r','s'},
+    {'p','i','e','r','t'},
+    {'p','i','e','t','a'},
+    {'p','i','e','t','s'},
+    {'p','i','e','t','y'},
+    {'p','i','e','z','o'},
+    {'p','i','g','g','y'},
+    {'p','i','g','h','t'},
+    {'p','i','g','l','y'},
+    {'p','i','g','m','y'},
+    {'p','i','i','n','g'},
+    {'p','i','k','a','s'},
+    {'p','i','k','a','u'},
+    {'p','i','k','e','d'},
+    {'p','i','k','e','l'},
+    {'p','i','k','e','r'},
+    {'p','i','k','e','s'},
+    {'p','i','k','e','y'},
+    {'p','i','k','i','s'},
+    {'p','i','k','u','l'},
+    {'p','i','l','a','e'},
+    {'p','i','l','a','f'},
+    {'p','i','l','a','o'},
+    {'p','i','l','a','r'},
+    {'p','i','l','a','u'},
+    {'p','i','l','a','w'},
+    {'p','i','l','c','h'},
+    {'p','i','l','e','a'},
+    {'p','i','l','e','d'},
+    {'p','i','l','e','i'},
+    {'p','i','l','e','r'},
+    {'p','i','l','e','s'},
+    {'p','i','l','e','y'},
+    {'p','i','l','i','n'},
+    {'p','i','l','i','s'},
+    {'p','i','l','l','s'},
+    {'p','i','l','o','n'},
+    {'p','i','l','o','t'},
+    {'p','i','l','o','w'},
+    {'p','i','l','u','m'},
+    {'p','i','l','u','s'},
+    {'p','i','m','a','s'},
+    {'p','i','m','p','s'},
+    {'p','i','n','a','s'},
+    {'p','i','n','a','x'},
+    {'p','i','n','c','e'},
+    {'p','i','n','c','h'},
+    {'p','i','n','d','a'},
+    {'p','i','n','d','s'},
+    {'p','i','n','e','d'},
+    {'p','i','n','e','r'},
+    {'p','i','n','e','s'},
+    {'p','i','n','e','y'},
+    {'p','i','n','g','a'},
+    {'p','i','n','g','e'},
+    {'p','i','n','g','o'},
+    {'p','i','n','g','s'},
+    {'p','i','n','k','o'},
+    {'p','i','n','k','s'},
+    {'p','i','n','k','y'},
+    {'p','i','n','n','a'},
+    {'p','i','n','n','y'},
+    {'p','i','n','o','l'},
+    {'p','i','n','o','n'},
+    {'p','i','n','o','t'},
+    {'p','i','n','t','a'},
+    {'p','i','n','t','o'},
+    {'p','i','n','t','s'},
+    {'p','i','n','u','p'},
+    {'p','i','o','n','s'},
+    {'p','i','o','n','y'},
+    {'p','i','o','u','s'},
+    {'p','i','o','y','e'},
+    {'p','i','o','y','s'},
+    {'p','i','p','a','l'},
+    {'p','i','p','a','s'},
+    {'p','i','p','e','d'},
+    {'p','i','p','e','r'},
+    {'p','i','p','e','s'},
+    {'p','i','p','e','t'},
+    {'p','i','p','i','d'},
+    {'p','i','p','i','s'},
+    {'p','i','p','i','t'},
+    {'p','i','p','p','y'},
+    {'p','i','p','u','l'},
+    {'p','i','q','u','e'},
+    {'p','i','q','u','i'},
+    {'p','i','r','a','i'},
+    {'p','i','r','k','s'},
+    {'p','i','r','l','s'},
+    {'p','i','r','n','s'},
+    {'p','i','r','o','g'},
+    {'p','i','r','r','e'},
+    {'p','i','r','r','i'},
+    {'p','i','r','r','s'},
+    {'p','i','s','c','o'},
+    {'p','i','s','e','s'},
+    {'p','i','s','k','y'},
+    {'p','i','s','o','s'},
+    {'p','i','s','s','y'},
+    {'p','i','s','t','e'},
+    {'p','i','t','a','s'},
+    {'p','i','t','c','h'},
+    {'p','i','t','h','s'},
+    {'p','i','t','h','y'},
+    {'p','i','t','o','n'},
+    {'p','i','t','o','t'},
+    {'p','i','t','s','o'},
+    {'p','i','t','s','u'},
+    {'p','i','t','t','a'},
+    {'p','i','t','t','u'},
+    {'p','i','u','m','a'},
+    {'p','i','u','m','s'},
+    {'p','i','v','o','s'},
+    {'p','i','v','o','t'},
+    {'p','i','x','e','l'},
+    {'p','i','x','e','s'},
+    {'p','i','x','i','e'},
+    {'p','i','y','u','t'},
+    {'p','i','z','e','d'},
+    {'p','i','z','e','r'},
+    {'p','i','z','e','s'},
+    {'p','i','z','z','a'},
+    {'p','l','a','a','s'},
+    {'p','l','a','c','e'},
+    {'p','l','a','c','k'},
+    {'p','l','a','g','a'},
+    {'p','l','a','g','e'},
+    {'p','l','a','i','d'},
+    {'p','l','a','i','g'},
+    {'p','l','a','i','n'},
+    {'p','l','a','i','t'},
+    {'p','l','a','n','c'},
+    {'p','l','a','n','e'},
+    {'p','l','a','n','h'},
+    {'p','l','a','n','k'},
+    {'p','l','a','n','s'},
+    {'p','l','a','n','t'},
+    {'p','l','a','p','s'},
+    {'p','l','a','s','h'},
+    {'p','l','a','s','m'},
+    {'p','l','a','s','t'},
+    {'p','l','a','t','e'},
+    {'p','l','a','t','s'},
+    {'p','l','a','t','t'},
+    {'p','l','a','t','y'},
+    {'p','l','a','u','d'},
+    {'p','l','a','u','r'},
+    {'p','l','a','v','s'},
+    {'p','l','a','y','a'},
+    {'p','l','a','y','s'},
+    {'p','l','a','z','a'},
+    {'p','l','e','a','d'},
+    {'p','l','e','a','s'},
+    {'p','l','e','a','t'},
+    {'p','l','e','b','e'},
+    {'p','l','e','b','s'},
+    {'p','l','e','c','k'},
+    {'p','l','e','e','p'},
+    {'p','l','e','i','n'},
+    {'p','l','e','n','a'},
+    {'p','l','e','n','e'},
+    {'p','l','e','n','o'},
+    {'p','l','e','o','n'},
+    {'p','l','e','s','h'},
+    {'p','l','e','t','s'},
+    {'p','l','e','w','s'},
+    {'p','l','e','x','i'},
+    {'p','l','i','c','a'},
+    {'p','l','i','e','d'},
+    {'p','l','i','e','r'},
+    {'p','l','i','e','s'},
+    {'p','l','i','g','s'},
+    {'p','l','i','m','s'},
+    {'p','l','i','n','g'},
+    {'p','l','i','n','k'},
+    {'p','l','i','p','s'},
+    {'p','l','i','s','h'},
+    {'p','l','o','a','t'},
+    {'p','l','o','c','e'},
+    {'p','l','o','c','k'},
+    {'p','l','o','d','s'},
+    {'p','l','o','i','t'},
+    {'p','l','o','m','b'},
+    {'p','l','o','n','g'},
+    {'p','l','o','n','k'},
+    {'p','l','o','o','k'},
+    {'p','l','o','o','t'},
+    {'p','l','o','p','s'},
+    {'p','l','o','r','e'},
+    {'p','l','o','t','s'},
+    {'p','l','o','t','z'},
+    {'p','l','o','u','k'},
+    {'p','l','o','u','t'},
+    {'p','l','o','w','s'},
+    {'p','l','o','w','t'},
+    {'p','l','o','y','e'},
+    {'p','l','o','y','s'},
+    {'p','l','u','c','k'},
+    {'p','l','u','d','s'},
+    {'p','l','u','e','s'},
+    {'p','l','u','f','f'},
+    {'p','l','u','g','s'},
+    {'p','l','u','k','e'},
+    {'p','l','u','m','b'},
+    {'p','l','u','m','e'},
+    {'p','l','u','m','p'},
+    {'p','l','u','m','s'},
+    {'p','l','u','m','y'},
+    {'p','l','u','n','g'},
+    {'p','l','u','n','k'},
+    {'p','l','u','o','t'},
+    {'p','l','u','p','s'},
+    {'p','l','u','s','h'},
+    {'p','l','u','t','e'},
+    {'p','l','u','t','o'},
+    {'p','l','u','t','y'},
+    {'p','l','y','e','r'},
+    {'p','n','e','u','s'},
+    {'p','o','a','c','h'},
+    {'p','o','a','k','a'},
+    {'p','o','a','k','e'},
+    {'p','o','a','l','o'},
+    {'p','o','b','b','y'},
+    {'p','o','b','o','y'},
+    {'p','o','c','a','n'},
+    {'p','o','c','h','e'},
+    {'p','o','c','h','o'},
+    {'p','o','c','k','s'},
+    {'p','o','c','k','y'},
+    {'p','o','d','a','l'},
+    {'p','o','d','d','y'},
+    {'p','o','d','e','x'},
+    {'p','o','d','g','e'},
+    {'p','o','d','g','y'},
+    {'p','o','d','i','a'},
+    {'p','o','d','o','s'},
+    {'p','o','d','u','s'},
+    {'p','o','e','m','s'},
+    {'p','o','e','n','a'},
+    {'p','o','e','p','s'},
+    {'p','o','e','s','y'},
+    {'p','o','e','t','e'},
+    {'p','o','e','t','s'},
+    {'p','o','g','e','y'},
+    {'p','o','g','g','e'},
+    {'p','o','g','g','y'},
+    {'p','o','g','o','s'},
+    {'p','o','g','u','e'},
+    {'p','o','h','e','d'},
+    {'p','o','i','l','u'},
+    {'p','o','i','n','d'},
+    {'p','o','i','n','t'},
+    {'p','o','i','r','e'},
+    {'p','o','i','s','e'},
+    {'p','o','k','a','l'},
+    {'p','o','k','e','d'},
+    {'p','o','k','e','r'},
+    {'p','o','k','e','s'},
+    {'p','o','k','e','y'},
+    {'p','o','k','i','e'},
+    {'p','o','k','i','t'},
+    {'p','o','l','a','r'},
+    {'p','o','l','e','d'},
+    {'p','o','l','e','r'},
+    {'p','o','l','e','s'},
+    {'p','o','l','e','y'},
+    {'p','o','l','i','o'},
+    {'p','o','l','i','s'},
+    {'p','o','l','j','e'},
+    {'p','o','l','k','a'},
+    {'p','o','l','k','s'},
+    {'p','o','l','l','o'},
+    {'p','o','l','l','s'},
+    {'p','o','l','l','y'},
+    {'p','o','l','o','s'},
+    {'p','o','l','t','s'},
+    {'p','o','l','y','p'},
+    {'p','o','l','y','s'},
+    {'p','o','m','a','s'},
+    {'p','o','m','b','e'},
+    {'p','o','m','e','s'},
+    {'p','o','m','m','e'},
+    {'p','o','m','m','y'},
+    {'p','o','m','o','s'},
+    {'p','o','m','p','a'},
+    {'p','o','m','p','s'},
+    {'p','o','n','c','e'},
+    {'p','o','n','c','y'},
+    {'p','o','n','d','s'},
+    {'p','o','n','d','y'},
+    {'p','o','n','e','s'},
+    {'p','o','n','e','y'},
+    {'p','o','n','g','a'},
+    {'p','o','n','g','o'},
+    {'p','o','n','g','s'},
+    {'p','o','n','g','y'},
+    {'p','o','n','k','s'},
+    {'p','o','n','o','r'},
+    {'p','o','n','t','o'},
+    {'p','o','n','t','s'},
+    {'p','o','n','t','y'},
+    {'p','o','n','z','u'},
+    {'p','o','o','a','y'},
+    {'p','o','o','c','h'},
+    {'p','o','o','d','s'},
+    {'p','o','o','e','d'},
+    {'p','o','o','e','y'},
+    {'p','o','o','f','s'},
+    {'p','o','o','f','y'},
+    {'p','o','o','h','s'},
+    {'p','o','o','h','y'},
+    {'p','o','o','j','a'},
+    {'p','o','o','k','a'},
+    {'p','o','o','k','s'},
+    {'p','o','o','l','s'},
+    {'p','o','o','l','y'},
+    {'p','o','o','n','s'},
+    {'p','o','o','p','a'},
+    {'p','o','o','p','s'},
+    {'p','o','o','p','y'},
+    {'p','o','o','r','i'},
+    {'p','o','o','r','t'},
+    {'p','o','o','t','s'},
+    {'p','o','o','t','y'},
+    {'p','o','o','v','e'},
+    {'p','o','o','v','y'},
+    {'p','o','p','e','s'},
+    {'p','o','p','i','a'},
+    {'p','o','p','o','s'},
+    {'p','o','p','p','a'},
+    {'p','o','p','p','y'},
+    {'p','o','p','s','y'},
+    {'p','o','p','u','p'},
+    {'p','o','r','a','e'},
+    {'p','o','r','a','l'},
+    {'p','o','r','c','h'},
+    {'p','o','r','e','d'},
+    {'p','o','r','e','r'},
+    {'p','o','r','e','s'},
+    {'p','o','r','e','y'},
+    {'p','o','r','g','e'},
+    {'p','o','r','g','y'},
+    {'p','o','r','i','n'},
+    {'p','o','r','k','s'},
+    {'p','o','r','k','y'},
+    {'p','o','r','n','o'},
+    {'p','o','r','n','s'},
+    {'p','o','r','n','y'},
+    {'p','o','r','t','a'},
+    {'p','o','r','t','e'},
+    {'p','o','r','t','h'},
+    {'p','o','r','t','s'},
+    {'p','o','r','t','y'},
+    {'p','o','r','u','s'},
+    {'p','o','s','c','a'},
+    {'p','o','s','e','d'},
+    {'p','o','s','e','r'},
+    {'p','o','s','e','s'},
+    {'p','o','s','e','t'},
+    {'p','o','s','e','y'},
+    {'p','o','s','h','o'},
+    {'p','o','s','i','t'},
+    {'p','o','s','o','l'},
+    {'p','o','s','s','e'},
+    {'p','o','s','t','e'},
+    {'p','o','s','t','s'},
+    {'p','o','t','a','e'},
+    {'p','o','t','a','i'},
+    {'p','o','t','c','h'},
+    {'p','o','t','e','d'},
+    {'p','o','t','e','s'},
+    {'p','o','t','i','n'},
+    {'p','o','t','o','o'},
+    {'p','o','t','r','o'},
+    {'p','o','t','s','y'},
+    {'p','o','t','t','o'},
+    {'p','o','t','t','s'},
+    {'p','o','t','t','y'},
+    {'p','o','u','c','e'},
+    {'p','o','u','c','h'},
+    {'p','o','u','f','f'},
+    {'p','o','u','f','s'},
+    {'p','o','u','f','y'},
+    {'p','o','u','i','s'},
+    {'p','o','u','k','e'},
+    {'p','o','u','k','s'},
+    {'p','o','u','l','e'},
+    {'p','o','u','l','p'},
+    {'p','o','u','l','t'},
+    {'p','o','u','n','d'},
+    {'p','o','u','p','e'},
+    {'p','o','u','p','t'},
+    {'p','o','u','r','s'},
+    {'p','o','u','s','y'},
+    {'p','o','u','t','s'},
+    {'p','o','u','t','y'},
+    {'p','o','v','o','s'},
+    {'p','o','w','a','n'},
+    {'p','o','w','e','r'},
+    {'p','o','w','i','e'},
+    {'p','o','w','i','n'},
+    {'p','o','w','i','s'},
+    {'p','o','w','l','t'},
+    {'p','o','w','n','d'},
+    {'p','o','w','n','s'},
+    {'p','o','w','n','y'},
+    {'p','o','w','r','e'},
+    {'p','o','w','s','y'},
+    {'p','o','x','e','d'},
+    {'p','o','x','e','s'},
+    {'p','o','y','a','s'},
+    {'p','o','y','n','t'},
+    {'p','o','y','o','u'},
+    {'p','o','y','s','e'},
+    {'p','o','z','z','y'},
+    {'p','r','a','a','m'},
+    {'p','r','a','d','s'},
+    {'p','r','a','g','s'},
+    {'p','r','a','h','u'},
+    {'p','r','a','m','s'},
+    {'p','r','a','n','a'},
+    {'p','r','a','n','g'},
+    {'p','r','a','n','k'},
+    {'p','r','a','o','s'},
+    {'p','r','a','p','s'},
+    {'p','r','a','s','e'},
+    {'p','r','a','t','e'},
+    {'p','r','a','t','s'},
+    {'p','r','a','t','t'},
+    {'p','r','a','t','y'},
+    {'p','r','a','u','s'},
+    {'p','r','a','w','n'},
+    {'p','r','a','y','s'},
+    {'p','r','e','a','k'},
+    {'p','r','e','d','y'},
+    {'p','r','e','e','d'},
+    {'p','r','e','e','m'},
+    {'p','r','e','e','n'},
+    {'p','r','e','e','s'},
+    {'p','r','e','i','f'},
+    {'p','r','e','k','e'},
+    {'p','r','e','m','s'},
+    {'p','r','e','m','y'},
+    {'p','r','e','n','t'},
+    {'p','r','e','o','n'},
+    {'p','r','e','o','p'},
+    {'p','r','e','p','s'},
+    {'p','r','e','s','a'},
+    {'p','r','e','s','e'},
+    {'p','r','e','s','s'},
+    {'p','r','e','s','t'},
+    {'p','r','e','t','a'},
+    {'p','r','e','u','x'},
+    {'p','r','e','v','e'},
+    {'p','r','e','x','y'},
+    {'p','r','e','y','s'},
+    {'p','r','i','a','l'},
+    {'p','r','i','a','n'},
+    {'p','r','i','c','e'},
+    {'p','r','i','c','k'},
+    {'p','r','i','c','y'},
+    {'p','r','i','d','e'},
+    {'p','r','i','d','y'},
+    {'p','r','i','e','d'},
+    {'p','r','i','e','f'},
+    {'p','r','i','e','r'},
+    {'p','r','i','e','s'},
+    {'p','r','i','g','s'},
+    {'p','r','i','l','l'},
+    {'p','r','i','m','a'},
+    {'p','r','i','m','e'},
+    {'p','r','i','m','i'},
+    {'p','r','i','m','o'},
+    {'p','r','i','m','p'},
+    {'p','r','i','m','s'},
+    {'p','r','i','m','y'},
+    {'p','r','i','n','g'},
+    {'p','r','i','n','k'},
+    {'p','r','i','n','t'},
+    {'p','r','i','o','n'},
+    {'p','r','i','o','r'},
+    {'p','r','i','s','e'},
+    {'p','r','i','s','m'},
+    {'p','r','i','s','s'},
+    {'p','r','i','u','s'},
+    {'p','r','i','v','y'},
+    {'p','r','i','z','e'},
+    {'p','r','o','a','l'},
+    {'p','r','o','a','s'},
+    {'p','r','o','b','e'},
+    {'p','r','o','b','s'},
+    {'p','r','o','b','y'},
+    {'p','r','o','d','d'},
+    {'p','r','o','d','s'},
+    {'p','r','o','e','m'},
+    {'p','r','o','f','s'},
+    {'p','r','o','g','s'},
+    {'p','r','o','i','n'},
+    {'p','r','o','k','e'},
+    {'p','r','o','l','e'},
+    {'p','r','o','l','l'},
+    {'p','r','o','m','o'},
+    {'p','r','o','m','s'},
+    {'p','r','o','n','e'},
+    {'p','r','o','n','g'},
+    {'p','r','o','n','k'},
+    {'p','r','o','o','f'},
+    {'p','r','o','o','k'},
+    {'p','r','o','o','t'},
+    {'p','r','o','p','s'},
+    {'p','r','o','r','a'},
+    {'p','r','o','r','e'},
+    {'p','r','o','s','e'},
+    {'p','r','o','s','o'},
+    {'p','r','o','s','s'},
+    {'p','r','o','s','t'},
+    {'p','r','o','s','y'},
+    {'p','r','o','t','o'},
+    {'p','r','o','u','d'},
+    {'p','r','o','u','l'},
+    {'p','r','o','v','e'},
+    {'p','r','o','w','k'},
+    {'p','r','o','w','l'},
+    {'p','r','o','w','s'},
+    {'p','r','o','x','y'},
+    {'p','r','o','y','n'},
+    {'p','r','u','d','e'},
+    {'p','r','u','n','e'},
+    {'p','r','u','n','o'},
+    {'p','r','u','n','t'},
+    {'p','r','u','n','y'},
+    {'p','r','u','t','a'},
+    {'p','r','y','a','n'},
+    {'p','r','y','e','r'},
+    {'p','r','y','s','e'},
+    {'p','s','a','l','m'},
+    {'p','s','e','u','d'},
+    {'p','s','h','a','w'},
+    {'p','s','h','u','t'},
+    {'p','s','i','a','s'},
+    {'p','s','i','o','n'},
+    {'p','s','o','a','e'},
+    {'p','s','o','a','i'},
+    {'p','s','o','a','s'},
+    {'p','s','o','r','a'},
+    {'p','s','y','c','h'},
+    {'p','s','y','o','p'},
+    {'p','t','i','s','h'},
+    {'p','t','y','p','e'},
+    {'p','u','b','b','y'},
+    {'p','u','b','c','o'},
+    {'p','u','b','e','s'},
+    {'p','u','b','i','c'},
+    {'p','u','b','i','s'},
+    {'p','u','b','s','y'},
+    {'p','u','c','a','n'},
+    {'p','u','c','e','r'},
+    {'p','u','c','e','s'},
+    {'p','u','c','k','a'},
+    {'p','u','c','k','s'},
+    {'p','u','d','d','y'},
+    {'p','u','d','g','e'},
+    {'p','u','d','g','y'},
+    {'p','u','d','i','c'},
+    {'p','u','d','o','r'},
+    {'p','u','d','s','y'},
+    {'p','u','d','u','s'},
+    {'p','u','e','r','s'},
+    {'p','u','f','f','a'},
+    {'p','u','f','f','s'},
+    {'p','u','f','f','y'},
+    {'p','u','g','g','y'},
+    {'p','u','g','i','l'},
+    {'p','u','h','a','s'},
+    {'p','u','j','a','h'},
+    {'p','u','j','a','s'},
+    {'p','u','k','a','s'},
+    {'p','u','k','e','d'},
+    {'p','u','k','e','r'},
+    {'p','u','k','e','s'},
+    {'p','u','k','e','y'},
+    {'p','u','k','k','a'},
+    {'p','u','k','u','s'},
+    {'p','u','l','a','o'},
+    {'p','u','l','a','s'},
+    {'p','u','l','e','d'},
+    {'p','u','l','e','r'},
+    {'p','u','l','e','s'},
+    {'p','u','l','i','k'},
+    {'p','u','l','i','s'},
+    {'p','u','l','k','a'},
+    {'p','u','l','k','s'},
+    {'p','u','l','l','i'},
+    {'p','u','l','l','s'},
+    {'p','u','l','l','y'},
+    {'p','u','l','m','o'},
+    {'p','u','l','p','s'},
+    {'p','u','l','p','y'},
+    {'p','u','l','s','e'},
+    {'p','u','l','u','s'},
+    {'p','u','l','u','t'},
+    {'p','u','m','a','s'},
+    {'p','u','m','i','e'},
+    {'p','u','m','p','s'},
+    {'p','u','m','p','y'},
+    {'p','u','n','a','s'},
+    {'p','u','n','c','e'},
+    {'p','u','n','c','h'},
+    {'p','u','n','g','a'},
+    {'p','u','n','g','i'},
+    {'p','u','n','g','o'},
+    {'p','u','n','g','s'},
+    {'p','u','n','g','y'},
+    {'p','u','n','i','m'},
+    {'p','u','n','j','i'},
+    {'p','u','n','k','a'},
+    {'p','u','n','k','s'},
+    {'p','u','n','k','y'},
+    {'p','u','n','n','y'},
+    {'p','u','n','t','o'},
+    {'p','u','n','t','s'},
+    {'p','u','n','t','y'},
+    {'p','u','p','a','e'},
+    {'p','u','p','a','l'},
+    {'p','u','p','a','s'},
+    {'p','u','p','i','l'},
+    {'p','u','p','p','a'},
+    {'p','u','p','p','y'},
+    {'p','u','p','u','s'},
+    {'p','u','r','a','o'},
+    {'p','u','r','a','u'},
+    {'p','u','r','d','a'},
+    {'p','u','r','d','y'},
+    {'p','u','r','e','d'},
+    {'p','u','r','e','e'},
+    {'p','u','r','e','r'},
+    {'p','u','r','e','s'},
+    {'p','u','r','g','a'},
+    {'p','u','r','g','e'},
+    {'p','u','r','i','n'},
+    {'p','u','r','i','s'},
+    {'p','u','r','l','s'},
+    {'p','u','r','o','s'},
+    {'p','u','r','p','s'},
+    {'p','u','r','p','y'},
+    {'p','u','r','r','e'},
+    {'p','u','r','r','s'},
+    {'p','u','r','r','y'},
+    {'p','u','r','s','e'},
+    {'p','u','r','s','y'},
+    {'p','u','r','t','y'},
+    {'p','u','s','e','s'},
+    {'p','u','s','h','y'},
+    {'p','u','s','l','e'},
+    {'p','u','s','s','y'},
+    {'p','u','t','a','s'},
+    {'p','u','t','e','r'},
+    {'p','u','t','i','d'},
+    {'p','u','t','i','n'},
+    {'p','u','t','o','n'},
+    {'p','u','t','o','s'},
+    {'p','u','t','t','i'},
+    {'p','u','t','t','o'},
+    {'p','u','t','t','s'},
+    {'p','u','t','t','u'},
+    {'p','u','t','t','y'},
+    {'p','u','t','z','a'},
+    {'p','u','u','k','o'},
+    {'p','u','y','a','s'},
+    {'p','u','z','e','l'},
+    {'p','u','z','t','a'},
+    {'p','w','n','e','d'},
+    {'p','y','a','t','s'},
+    {'p','y','e','t','s'},
+    {'p','y','g','a','l'},
+    {'p','y','g','m','y'},
+    {'p','y','i','n','s'},
+    {'p','y','l','o','n'},
+    {'p','y','n','e','d'},
+    {'p','y','n','e','s'},
+    {'p','y','o','i','d'},
+    {'p','y','o','t','s'},
+    {'p','y','r','a','l'},
+    {'p','y','r','a','n'},
+    {'p','y','r','e','s'},
+    {'p','y','r','e','x'},
+    {'p','y','r','i','c'},
+    {'p','y','r','o','s'},
+    {'p','y','r','u','s'},
+    {'p','y','u','f','f'},
+    {'p','y','x','e','d'},
+    {'p','y','x','e','s'},
+    {'p','y','x','i','e'},
+    {'p','y','x','i','s'},
+    {'p','z','a','z','z'},
+    {'q','a','d','i','s'},
+    {'q','a','i','d','s'},
+    {'q','a','j','a','q'},
+    {'q','a','n','a','t'},
+    {'q','a','p','i','k'},
+    {'q','i','b','l','a'},
+    {'q','i','l','a','s'},
+    {'q','i','p','a','o'},
+    {'q','o','p','h','s'},
+    {'q','o','r','m','a'},
+    {'q','u','a','b','s'},
+    {'q','u','a','c','k'},
+    {'q','u','a','d','s'},
+    {'q','u','a','f','f'},
+    {'q','u','a','g','s'},
+    {'q','u','a','i','l'},
+    {'q','u','a','i','r'},
+    {'q','u','a','i','s'},
+    {'q','u','a','k','e'},
+    {'q','u','a','k','y'},
+    {'q','u','a','l','e'},
+    {'q','u','a','l','m'},
+    {'q','u','a','l','y'},
+    {'q','u','a','n','k'},
+    {'q','u','a','n','t'},
+    {'q','u','a','r','e'},
+    {'q','u','a','r','k'},
+    {'q','u','a','r','l'},
+    {'q','u','a','r','t'},
+    {'q','u','a','s','h'},
+    {'q','u','a','s','i'},
+    {'q','u','a','s','s'},
+    {'q','u','a','t','e'},
+    {'q','u','a','t','s'},
+    {'q','u','a','w','k'},
+    {'q','u','a','w','s'},
+    {'q','u','a','y','d'},
+    {'q','u','a','y','s'},
+    {'q','u','b','i','t'},
+    {'q','u','e','a','n'},
+    {'q','u','e','c','k'},
+    {'q','u','e','e','k'},
+    {'q','u','e','e','m'},
+    {'q','u','e','e','n'},
+    {'q','u','e','e','r'},
+    {'q','u','e','l','l'},
+    {'q','u','e','m','e'},
+    {'q','u','e','n','a'},
+    {'q','u','e','r','n'},
+    {'q','u','e','r','y'},
+    {'q','u','e','s','o'},
+    {'q','u','e','s','t'},
+    {'q','u','e','t','e'},
+    {'q','u','e','u','e'},
+    {'q','u','e','y','n'},
+    {'q','u','e','y','s'},
+    {'q','u','e','y','u'},
+    {'q','u','i','b','s'},
+    {'q','u','i','c','h'},
+    {'q','u','i','c','k'},
+    {'q','u','i','d','s'},
+    {'q','u','i','e','s'},
+    {'q','u','i','e','t'},
+    {'q','u','i','f','f'},
+    {'q','u','i','l','a'},
+    {'q','u','i','l','l'},
+    {'q','u','i','l','t'},
+    {'q','u','i','m','s'},
+    {'q','u','i','n','a'},
+    {'q','u','i','n','e'},
+    {'q','u','i','n','k'},
+    {'q','u','i','n','o'},
+    {'q','u','i','n','s'},
+    {'q','u','i','n','t'},
+    {'q','u','i','p','o'},
+    {'q','u','i','p','s'},
+    {'q','u','i','p','u'},
+    {'q','u','i','r','e'},
+    {'q','u','i','r','k'},
+    {'q','u','i','r','l'},
+    {'q','u','i','r','t'},
+    {'q','u','i','s','t'},
+    {'q','u','i','t','e'},
+    {'q','u','i','t','s'},
+    {'q','u','o','a','d'},
+    {'q','u','o','d','s'},
+    {'q','u','o','i','f'},
+    {'q','u','o','i','n'},
+    {'q','u','o','i','s'},
+    {'q','u','o','i','t'},
+    {'q','u','o','l','l'},
+    {'q','u','o','n','k'},
+    {'q','u','o','p','s'},
+    {'q','u','o','r','k'},
+    {'q','u','o','r','l'},
+    {'q','u','o','t','a'},
+    {'q','u','o','t','e'},
+    {'q','u','o','t','h'},
+    {'q','u','o','u','k'},
+    {'q','u','o','y','s'},
+    {'q','u','r','a','n'},
+    {'q','u','r','s','h'},
+    {'q','u','y','t','e'},
+    {'r','a','a','d','s'},
+    {'r','a','a','k','e'},
+    {'r','a','b','a','t'},
+    {'r','a','b','b','i'},
+    {'r','a','b','i','c'},
+    {'r','a','b','i','d'},
+    {'r','a','b','i','s'},
+    {'r','a','c','e','d'},
+    {'r','a','c','e','r'},
+    {'r','a','c','e','s'},
+    {'r','a','c','h','e'},
+    {'r','a','c','k','s'},
+    {'r','a','c','o','n'},
+    {'r','a','d','a','r'},
+    {'r','a','d','d','i'},
+    {'r','a','d','d','y'},
+    {'r','a','d','g','e'},
+    {'r','a','d','g','y'},
+    {'r','a','d','i','f'},
+    {'r','a','d','i','i'},
+    {'r','a','d','i','o'},
+    {'r','a','d','i','x'},
+    {'r','a','d','o','n'},
+    {'r','a','f','e','e'},
+    {'r','a','f','f','s'},
+    {'r','a','f','f','y'},
+    {'r','a','f','i','k'},
+    {'r','a','f','i','q'},
+    {'r','a','f','t','s'},
+    {'r','a','f','t','y'},
+    {'r','a','g','a','s'},
+    {'r','a','g','d','e'},
+    {'r','a','g','e','d'},
+    {'r','a','g','e','e'},
+    {'r','a','g','e','r'},
+    {'r','a','g','e','s'},
+    {'r','a','g','g','a'},
+    {'r','a','g','g','s'},
+    {'r','a','g','g','y'},
+    {'r','a','g','i','s'},
+    {'r','a','g','u','s'},
+    {'r','a','h','e','d'},
+    {'r','a','h','u','i'},
+    {'r','a','i','a','h'},
+    {'r','a','i','a','s'},
+    {'r','a','i','d','s'},
+    {'r','a','i','k','e'},
+    {'r','a','i','k','s'},
+    {'r','a','i','l','e'},
+    {'r','a','i','l','s'},
+    {'r','a','i','n','e'},
+    {'r','a','i','n','s'},
+    {'r','a','i','n','y'},
+    {'r','a','i','r','d'},
+    {'r','a','i','s','e'},
+    {'r','a','i','t','a'},
+    {'r','a','i','t','h'},
+    {'r','a','i','t','s'},
+    {'r','a','j','a','h'},
+    {'r','a','j','a','s'},
+    {'r','a','j','e','s'},
+    {'r','a','k','e','d'},
+    {'r','a','k','e','e'},
+    {'r','a','k','e','r'},
+    {'r','a','k','e','s'},
+    {'r','a','k','h','i'},
+    {'r','a','k','i','a'},
+    {'r','a','k','i','s'},
+    {'r','a','k','k','i'},
+    {'r','a','k','s','i'},
+    {'r','a','k','u','s'},
+    {'r','a','l','e','s'},
+    {'r','a','l','l','i'},
+    {'r','a','l','l','y'},
+    {'r','a','l','p','h'},
+    {'r','a','m','a','l'},
+    {'r','a','m','e','e'},
+    {'r','a','m','e','n'},
+    {'r','a','m','e','s'},
+    {'r','a','m','e','t'},
+    {'r','a','m','i','e'},
+    {'r','a','m','i','n'},
+    {'r','a','m','i','s'},
+    {'r','a','m','m','y'},
+    {'r','a','m','o','n'},
+    {'r','a','m','p','s'},
+    {'r','a','m','s','e'},
+    {'r','a','m','s','h'},
+    {'r','a','m','u','s'},
+    {'r','a','n','a','s'},
+    {'r','a','n','c','e'},
+    {'r','a','n','c','h'},
+    {'r','a','n','d','o'},
+    {'r','a','n','d','s'},
+    {'r','a','n','d','y'},
+    {'r','a','n','e','d'},
+    {'r','a','n','e','e'},
+    {'r','a','n','e','s'},
+    {'r','a','n','g','a'},
+    {'r','a','n','g','e'},
+    {'r','a','n','g','i'},
+    {'r','a','n','g','s'},
+    {'r','a','n','g','y'},
+    {'r','a','n','i','d'},
+    {'r','a','n','i','s'},
+    {'r','a','n','k','e'},
+    {'r','a','n','k','s'},
+    {'r','a','n','n','s'},
+    {'r','a','n','n','y'},
+    {'r','a','n','s','e'},
+    {'r','a','n','t','s'},
+    {'r','a','n','t','y'},
+    {'r','a','p','e','d'},
+    {'r','a','p','e','e'},
+    {'r','a','p','e','r'},
+    {'r','a','p','e','s'},
+    {'r','a','p','h','e'},
+    {'r','a','p','i','d'},
+    {'r','a','p','i','n'},
+    {'r','a','p','p','e'},
+    {'r','a','p','s','o'},
+    {'r','a','r','e','d'},
+    {'r','a','r','e','e'},
+    {'r','a','r','e','r'},
+    {'r','a','r','e','s'},
+    {'r','a','r','k','s'},
+    {'r','a','s','a','m'},
+    {'r','a','s','a','s'},
+    {'r','a','s','e','d'},
+    {'r','a','s','e','r'},
+    {'r','a','s','e','s'},
+    {'r','a','s','p','s'},
+    {'r','a','s','p','y'},
+    {'r','a','s','s','e'},
+    {'r','a','s','t','a'},
+    {'r','a','t','a','l'},
+    {'r','a','t','a','n'},
+    {'r','a','t','a','s'},
+    {'r','a','t','c','h'},
+    {'r','a','t','e','d'},
+    {'r','a','t','e','l'},
+    {'r','a','t','e','r'},
+    {'r','a','t','e','s'},
+    {'r','a','t','h','a'},
+    {'r','a','t','h','e'},
+    {'r','a','t','h','s'},
+    {'r','a','t','i','o'},
+    {'r','a','t','o','o'},
+    {'r','a','t','o','s'},
+    {'r','a','t','t','i'},
+    {'r','a','t','t','y'},
+    {'r','a','t','u','s'},
+    {'r','a','u','l','i'},
+    {'r','a','u','n','s'},
+    {'r','a','u','p','o'},
+    {'r','a','v','e','d'},
+    {'r','a','v','e','l'},
+    {'r','a','v','e','n'},
+    {'r','a','v','e','r'},
+    {'r','a','v','e','s'},
+    {'r','a','v','e','y'},
+    {'r','a','v','i','n'},
+    {'r','a','w','d','y'},
+    {'r','a','w','e','r'},
+    {'r','a','w','i','n'},
+    {'r','a','w','k','s'},
+    {'r','a','w','l','y'},
+    {'r','a','w','n','s'},
+    {'r','a','x','e','d'},
+    {'r','a','x','e','s'},
+    {'r','a','y','a','h'},
+    {'r','a','y','a','s'},
+    {'r','a','y','e','d'},
+    {'r','a','y','l','e'},
+    {'r','a','y','l','s'},
+    {'r','a','y','n','e'},
+    {'r','a','y','o','n'},
+    {'r','a','z','a','i'},
+    {'r','a','z','e','d'},
+    {'r','a','z','e','e'},
+    {'r','a','z','e','r'},
+    {'r','a','z','e','s'},
+    {'r','a','z','e','t'},
+    {'r','a','z','o','o'},
+    {'r','a','z','o','r'},
+    {'r','e','a','c','h'},
+    {'r','e','a','c','t'},
+    {'r','e','a','d','d'},
+    {'r','e','a','d','s'},
+    {'r','e','a','d','y'},
+    {'r','e','a','i','s'},
+    {'r','e','a','k','s'},
+    {'r','e','a','l','m'},
+    {'r','e','a','l','o'},
+    {'r','e','a','l','s'},
+    {'r','e','a','m','e'},
+    {'r','e','a','m','s'},
+    {'r','e','a','m','y'},
+    {'r','e','a','n','s'},
+    {'r','e','a','p','s'},
+    {'r','e','a','r','d'},
+    {'r','e','a','r','m'},
+    {'r','e','a','r','s'},
+    {'r','e','a','s','t'},
+    {'r','e','a','t','a'},
+    {'r','e','a','t','e'},
+    {'r','e','a','v','e'},
+    {'r','e','b','a','b'},
+    {'r','e','b','a','r'},
+    {'r','e','b','b','e'},
+    {'r','e','b','e','c'},
+    {'r','e','b','e','l'},
+    {'r','e','b','i','d'},
+    {'r','e','b','i','t'},
+    {'r','e','b','o','p'},
+    {'r','e','b','u','d'},
+    {'r','e','b','u','s'},
+    {'r','e','b','u','t'},
+    {'r','e','b','u','y'},
+    {'r','e','c','a','l'},
+    {'r','e','c','a','p'},
+    {'r','e','c','c','e'},
+    {'r','e','c','c','o'},
+    {'r','e','c','c','y'},
+    {'r','e','c','e','p'},
+    {'r','e','c','i','t'},
+    {'r','e','c','k','s'},
+    {'r','e','c','o','n'},
+    {'r','e','c','t','a'},
+    {'r','e','c','t','e'},
+    {'r','e','c','t','i'},
+    {'r','e','c','t','o'},
+    {'r','e','c','u','e'},
+    {'r','e','c','u','r'},
+    {'r','e','c','u','t'},
+    {'r','e','d','a','n'},
+    {'r','e','d','d','s'},
+    {'r','e','d','d','y'},
+    {'r','e','d','e','d'},
+    {'r','e','d','e','s'},
+    {'r','e','d','i','a'},
+    {'r','e','d','i','d'},
+    {'r','e','d','i','f'},
+    {'r','e','d','i','g'},
+    {'r','e','d','i','p'},
+    {'r','e','d','l','y'},
+    {'r','e','d','o','n'},
+    {'r','e','d','o','s'},
+    {'r','e','d','o','x'},
+    {'r','e','d','r','y'},
+    {'r','e','d','u','b'},
+    {'r','e','d','u','g'},
+    {'r','e','d','u','x'},
+    {'r','e','d','y','e'},
+    {'r','e','e','a','f'},
+    {'r','e','e','c','h'},
+    {'r','e','e','d','e'},
+    {'r','e','e','d','s'},
+    {'r','e','e','d','y'},
+    {'r','e','e','f','s'},
+    {'r','e','e','f','y'},
+    {'r','e','e','k','s'},
+    {'r','e','e','k','y'},
+    {'r','e','e','l','s'},
+    {'r','e','e','l','y'},
+    {'r','e','e','m','s'},
+    {'r','e','e','n','s'},
+    {'r','e','e','r','d'},
+    {'r','e','e','s','t'},
+    {'r','e','e','v','e'},
+    {'r','e','e','z','e'},
+    {'r','e','f','a','n'},
+    {'r','e','f','e','d'},
+    {'r','e','f','e','l'},
+    {'r','e','f','e','r'},
+    {'r','e','f','f','o'},
+    {'r','e','f','i','s'},
+    {'r','e','f','i','t'},
+    {'r','e','f','i','x'},
+    {'r','e','f','l','y'},
+    {'r','e','f','r','y'},
+    {'r','e','g','a','l'},
+    {'r','e','g','a','r'},
+    {'r','e','g','e','s'},
+    {'r','e','g','e','t'},
+    {'r','e','g','e','x'},
+    {'r','e','g','g','o'},
+    {'r','e','g','i','a'},
+    {'r','e','g','i','e'},
+    {'r','e','g','l','e'},
+    {'r','e','g','m','a'},
+    {'r','e','g','n','a'},
+    {'r','e','g','o','s'},
+    {'r','e','g','o','t'},
+    {'r','e','g','u','r'},
+    {'r','e','h','a','b'},
+    {'r','e','h','e','m'},
+    {'r','e','i','f','s'},
+    {'r','e','i','f','y'},
+    {'r','e','i','g','n'},
+    {'r','e','i','k','i'},
+    {'r','e','i','k','s'},
+    {'r','e','i','n','e'},
+    {'r','e','i','n','g'},
+    {'r','e','i','n','k'},
+    {'r','e','i','n','s'},
+    {'r','e','i','r','d'},
+    {'r','e','i','s','t'},
+    {'r','e','i','v','e'},
+    {'r','e','j','a','s'},
+    {'r','e','j','i','g'},
+    {'r','e','j','o','n'},
+    {'r','e','k','e','d'},
+    {'r','e','k','e','s'},
+    {'r','e','k','e','y'},
+    {'r','e','l','a','x'},
+    {'r','e','l','a','y'},
+    {'r','e','l','e','t'},
+    {'r','e','l','i','c'},
+    {'r','e','l','i','e'},
+    {'r','e','l','i','t'},
+    {'r','e','l','l','o'},
+    {'r','e','l','o','s'},
+    {'r','e','m','a','n'},
+    {'r','e','m','a','p'},
+    {'r','e','m','e','n'},
+    {'r','e','m','e','t'},
+    {'r','e','m','e','x'},
+    {'r','e','m','i','t'},
+    {'r','e','m','i','x'},
+    {'r','e','m','o','u'},
+    {'r','e','n','a','l'},
+    {'r','e','n','a','y'},
+    {'r','e','n','d','s'},
+    {'r','e','n','d','u'},
+    {'r','e','n','e','w'},
+    {'r','e','n','e','y'},
+    {'r','e','n','g','a'},
+    {'r','e','n','g','s'},
+    {'r','e','n','i','g'},
+    {'r','e','n','i','n'},
+    {'r','e','n','k','s'},
+    {'r','e','n','n','e'},
+    {'r','e','n','o','s'},
+    {'r','e','n','t','e'},
+    {'r','e','n','t','s'},
+    {'r','e','o','i','l'},
+    {'r','e','o','r','g'},
+    {'r','e','p','a','s'},
+    {'r','e','p','a','t'},
+    {'r','e','p','a','y'},
+    {'r','e','p','e','g'},
+    {'r','e','p','e','l'},
+    {'r','e','p','e','n'},
+    {'r','e','p','i','n'},
+    {'r','e','p','l','a'},
+    {'r','e','p','l','y'},
+    {'r','e','p','o','s'},
+    {'r','e','p','o','t'},
+    {'r','e','p','p','s'},
+    {'r','e','p','r','o'},
+    {'r','e','p','u','n'},
+    {'r','e','p','u','t'},
+    {'r','e','r','a','n'},
+    {'r','e','r','i','g'},
+    {'r','e','r','u','n'},
+    {'r','e','s','a','m'},
+    {'r','e','s','a','t'},
+    {'r','e','s','a','w'},
+    {'r','e','s','a','y'},
+    {'r','e','s','e','e'},
+    {'r','e','s','e','s'},
+    {'r','e','s','e','t'},
+    {'r','e','s','e','w'},
+    {'r','e','s','i','d'},
+    {'r','e','s','i','n'},
+    {'r','e','s','i','t'},
+    {'r','e','s','o','d'},
+    {'r','e','s','o','l'},
+    {'r','e','s','o','w'},
+    {'r','e','s','t','o'},
+    {'r','e','s','t','s'},
+    {'r','e','s','t','y'},
+    {'r','e','s','u','e'},
+    {'r','e','s','u','s'},
+    {'r','e','t','a','g'},
+    {'r','e','t','a','m'},
+    {'r','e','t','a','x'},
+    {'r','e','t','c','h'},
+    {'r','e','t','e','m'},
+    {'r','e','t','i','a'},
+    {'r','e','t','i','e'},
+    {'r','e','t','i','n'},
+    {'r','e','t','i','p'},
+    {'r','e','t','o','x'},
+    {'r','e','t','r','o'},
+    {'r','e','t','r','y'},
+    {'r','e','u','n','e'},
+    {'r','e','u','p','s'},
+    {'r','e','u','s','e'},
+    {'r','e','v','e','l'},
+    {'r','e','v','e','t'},
+    {'r','e','v','i','e'},
+    {'r','e','v','o','w'},
+    {'r','e','v','u','e'},
+    {'r','e','w','a','n'},
+    {'r','e','w','a','x'},
+    {'r','e','w','e','d'},
+    {'r','e','w','e','t'},
+    {'r','e','w','i','n'},
+    {'r','e','w','o','n'},
+    {'r','e','w','t','h'},
+    {'r','e','x','e','s'},
+    {'r','e','z','e','s'},
+    {'r','h','a','b','d'},
+    {'r','h','e','a','s'},
+    {'r','h','e','i','d'},
+    {'r','h','e','m','e'},
+    {'r','h','e','u','m'},
+    {'r','h','i','e','s'},
+    {'r','h','i','m','e'},
+    {'r','h','i','n','e'},
+    {'r','h','i','n','o'},
+    {'r','h','o','d','y'},
+    {'r','h','o','m','b'},
+    {'r','h','o','n','e'},
+    {'r','h','u','m','b'},
+    {'r','h','y','m','e'},
+    {'r','h','y','m','y'},
+    {'r','h','y','n','e'},
+    {'r','h','y','t','a'},
+    {'r','i','a','d','s'},
+    {'r','i','a','l','s'},
+    {'r','i','a','n','t'},
+    {'r','i','a','t','a'},
+    {'r','i','a','t','o'},
+    {'r','i','b','a','s'},
+    {'r','i','b','b','y'},
+    {'r','i','b','e','s'},
+    {'r','i','c','e','d'},
+    {'r','i','c','e','r'},
+    {'r','i','c','e','s'},
+    {'r','i','c','e','y'},
+    {'r','i','c','h','e'},
+    {'r','i','c','h','t'},
+    {'r','i','c','i','n'},
+    {'r','i','c','k','s'},
+    {'r','i','d','e','r'},
+    {'r','i','d','e','s'},
+    {'r','i','d','g','e'},
+    {'r','i','d','g','y'},
+    {'r','i','d','i','c'},
+    {'r','i','e','l','s'},
+    {'r','i','e','m','s'},
+    {'r','i','e','v','e'},
+    {'r','i','f','e','r'},
+    {'r','i','f','f','s'},
+    {'r','i','f','f','y'},
+    {'r','i','f','l','e'},
+    {'r','i','f','t','e'},
+    {'r','i','f','t','s'},
+    {'r','i','f','t','y'},
+    {'r','i','g','g','s'},
+    {'r','i','g','h','t'},
+    {'r','i','g','i','d'},
+    {'r','i','g','m','o'},
+    {'r','i','g','o','l'},
+    {'r','i','g','o','r'},
+    {'r','i','k','k','a'},
+    {'r','i','k','w','a'},
+    {'r','i','l','e','d'},
+    {'r','i','l','e','s'},
+    {'r','i','l','e','y'},
+    {'r','i','l','l','e'},
+    {'r','i','l','l','s'},
+    {'r','i','l','l','y'},
+    {'r','i','m','a','e'},
+    {'r','i','m','e','d'},
+    {'r','i','m','e','r'},
+    {'r','i','m','e','s'},
+    {'r','i','m','o','n'},
+    {'r','i','m','u','s'},
+    {'r','i','n','c','e'},
+    {'r','i','n','d','s'},
+    {'r','i','n','d','y'},
+    {'r','i','n','e','s'},
+    {'r','i','n','g','e'},
+    {'r','i','n','g','s'},
+    {'r','i','n','g','y'},
+    {'r','i','n','k','s'},
+    {'r','i','n','s','e'},
+    {'r','i','o','j','a'},
+    {'r','i','o','n','e'},
+    {'r','i','o','t','s'},
+    {'r','i','o','t','y'},
+    {'r','i','p','e','d'},
+    {'r','i','p','e','n'},
+    {'r','i','p','e','r'},
+    {'r','i','p','e','s'},
+    {'r','i','p','p','s'},
+    {'r','i','q','q','s'},
+    {'r','i','s','e','n'},
+    {'r','i','s','e','r'},
+    {'r','i','s','e','s'},
+    {'r','i','s','h','i'},
+    {'r','i','s','k','s'},
+    {'r','i','s','k','y'},
+    {'r','i','s','p','s'},
+    {'r','i','s','t','s'},
+    {'r','i','s','u','s'},
+    {'r','i','t','e','s'},
+    {'r','i','t','h','e'},
+    {'r','i','t','t','s'},
+    {'r','i','t','z','y'},
+    {'r','i','v','a','l'},
+    {'r','i','v','a','s'},
+    {'r','i','v','e','d'},
+    {'r','i','v','e','l'},
+    {'r','i','v','e','n'},
+    {'r','i','v','e','r'},
+    {'r','i','v','e','s'},
+    {'r','i','v','e','t'},
+    {'r','i','y','a','l'},
+    {'r','i','z','a','s'},
+    {'r','o','a','c','h'},
+    {'r','o','a','d','s'},
+    {'r','o','a','d','y'},
+    {'r','o','a','k','e'},
+    {'r','o','a','k','y'},
+    {'r','o','a','m','s'},
+    {'r','o','a','n','s'},
+    {'r','o','a','n','y'},
+    {'r','o','a','r','s'},
+    {'r','o','a','r','y'},
+    {'r','o','a','s','t'},
+    {'r','o','a','t','e'},
+    {'r','o','b','b','o'},
+    {'r','o','b','e','d'},
+    {'r','o','b','e','r'},
+    {'r','o','b','e','s'},
+    {'r','o','b','i','n'},
+    {'r','o','b','l','e'},
+    {'r','o','b','o','t'},
+    {'r','o','b','u','g'},
+    {'r','o','b','u','r'},
+    {'r','o','c','h','e'},
+    {'r','o','c','k','s'},
+    {'r','o','c','k','y'},
+    {'r','o','d','e','d'},
+    {'r','o','d','e','o'},
+    {'r','o','d','e','s'},
+    {'r','o','d','n','y'},
+    {'r','o','e','r','s'},
+    {'r','o','g','a','n'},
+    {'r','o','g','e','r'},
+    {'r','o','g','u','e'},
+    {'r','o','g','u','y'},
+    {'r','o','h','a','n'},
+    {'r','o','h','e','s'},
+    {'r','o','h','u','n'},
+    {'r','o','h','u','s'},
+    {'r','o','i','d','s'},
+    {'r','o','i','l','s'},
+    {'r','o','i','l','y'},
+    {'r','o','i','n','s'},
+    {'r','o','i','s','t'},
+    {'r','o','j','a','k'},
+    {'r','o','j','i','s'},
+    {'r','o','k','e','d'},
+    {'r','o','k','e','r'},
+    {'r','o','k','e','s'},
+    {'r','o','k','e','y'},
+    {'r','o','k','o','s'},
+    {'r','o','l','a','g'},
+    {'r','o','l','e','o'},
+    {'r','o','l','e','s'},
+    {'r','o','l','f','s'},
+    {'r','o','l','l','s'},
+    {'r','o','l','l','y'},
+    {'r','o','m','a','l'},
+    {'r','o','m','a','n'},
+    {'r','o','m','e','o'},
+    {'r','o','m','e','r'},
+    {'r','o','m','p','s'},
+    {'r','o','m','p','u'},
+    {'r','o','m','p','y'},
+    {'r','o','n','d','e'},
+    {'r','o','n','d','o'},
+    {'r','o','n','e','o'},
+    {'r','o','n','e','s'},
+    {'r','o','n','i','n'},
+    {'r','o','n','n','e'},
+    {'r','o','n','t','e'},
+    {'r','o','n','t','s'},
+    {'r','o','n','u','k'},
+    {'r','o','o','d','s'},
+    {'r','o','o','f','s'},
+    {'r','o','o','f','y'},
+    {'r','o','o','k','s'},
+    {'r','o','o','k','y'},
+    {'r','o','o','m','s'},
+    {'r','o','o','m','y'},
+    {'r','o','o','n','s'},
+    {'r','o','o','p','s'},
+    {'r','o','o','p','y'},
+    {'r','o','o','s','a'},
+    {'r','o','o','s','e'},
+    {'r','o','o','s','t'},
+    {'r','o','o','t','s'},
+    {'r','o','o','t','y'},
+    {'r','o','p','e','d'},
+    {'r','o','p','e','r'},
+    {'r','o','p','e','s'},
+    {'r','o','p','e','y'},
+    {'r','o','q','u','e'},
+    {'r','o','r','a','l'},
+    {'r','o','r','e','s'},
+    {'r','o','r','i','c'},
+    {'r','o','r','i','d'},
+    {'r','o','r','i','e'},
+    {'r','o','r','t','s'},
+    {'r','o','r','t','y'},
+    {'r','o','s','a','l'},
+    {'r','o','s','c','o'},
+    {'r','o','s','e','d'},
+    {'r','o','s','e','s'},
+    {'r','o','s','e','t'},
+    {'r','o','s','h','a'},
+    {'r','o','s','h','i'},
+    {'r','o','s','i','n'},
+    {'r','o','s','i','t'},
+    {'r','o','s','p','s'},
+    {'r','o','s','s','a'},
+    {'r','o','s','s','o'},
+    {'r','o','s','t','i'},
+    {'r','o','s','t','s'},
+    {'r','o','t','a','l'},
+    {'r','o','t','a','n'},
+    {'r','o','t','a','s'},
+    {'r','o','t','c','h'},
+    {'r','o','t','e','d'},
+    {'r','o','t','e','s'},
+    {'r','o','t','i','s'},
+    {'r','o','t','l','s'},
+    {'r','o','t','o','n'},
+    {'r','o','t','o','r'},
+    {'r','o','t','o','s'},
+    {'r','o','t','t','a'},
+    {'r','o','t','t','e'},
+    {'r','o','t','t','o'},
+    {'r','o','t','t','y'},
+    {'r','o','u','e','n'},
+    {'r','o','u','e','s'},
+    {'r','o','u','e','t'},
+    {'r','o','u','f','s'},
+    {'r','o','u','g','e'},
+    {'r','o','u','g','h'},
+    {'r','o','u','g','y'},
+    {'r','o','u','k','s'},
+    {'r','o','u','k','y'},
+    {'r','o','u','l','e'},
+    {'r','o','u','l','s'},
+    {'r','o','u','m','s'},
+    {'r','o','u','n','d'},
+    {'r','o','u','p','s'},
+    {'r','o','u','p','y'},
+    {'r','o','u','s','e'},
+    {'r','o','u','s','t'},
+    {'r','o','u','t','e'},
+    {'r','o','u','t','h'},
+    {'r','o','u','t','s'},
+    {'r','o','v','e','d'},
+    {'r','o','v','e','n'},
+    {'r','o','v','e','r'},
+    {'r','o','v','e','s'},
+    {'r','o','w','a','n'},
+    {'r','o','w','d','y'},
+    {'r','o','w','e','d'},
+    {'r','o','w','e','l'},
+    {'r','o','w','e','n'},
+    {'r','o','w','e','r'},
+    {'r','o','w','e','t'},
+    {'r','o','w','i','e'},
+    {'r','o','w','m','e'},
+    {'r','o','w','n','d'},
+    {'r','o','w','n','s'},
+    {'r','o','w','t','h'},
+    {'r','o','w','t','s'},
+    {'r','o','y','a','l'},
+    {'r','o','y','e','t'},
+    {'r','o','y','n','e'},
+    {'r','o','y','s','t'},
+    {'r','o','z','e','s'},
+    {'r','o','z','e','t'},
+    {'r','o','z','i','t'},
+    {'r','u','a','c','h'},
+    {'r','u','a','n','a'},
+    {'r','u','b','a','i'},
+    {'r','u','b','a','n'},
+    {'r','u','b','b','y'},
+    {'r','u','b','e','l'},
+    {'r','u','b','e','s'},
+    {'r','u','b','i','n'},
+    {'r','u','b','i','o'},
+    {'r','u','b','l','e'},
+    {'r','u','b','l','i'},
+    {'r','u','b','o','r'},
+    {'r','u','b','u','s'},
+    {'r','u','c','h','e'},
+    {'r','u','c','h','y'},
+    {'r','u','c','k','s'},
+    {'r','u','d','a','s'},
+    {'r','u','d','d','s'},
+    {'r','u','d','d','y'},
+    {'r','u','d','e','r'},
+    {'r','u','d','e','s'},
+    {'r','u','d','i','e'},
+    {'r','u','d','i','s'},
+    {'r','u','e','d','a'},
+    {'r','u','e','r','s'},
+    {'r','u','f','f','e'},
+    {'r','u','f','f','s'},
+    {'r','u','f','f','y'},
+    {'r','u','f','u','s'},
+    {'r','u','g','a','e'},
+    {'r','u','g','a','l'},
+    {'r','u','g','a','s'},
+    {'r','u','g','b','y'},
+    {'r','u','g','g','y'},
+    {'r','u','i','c','e'},
+    {'r','u','i','n','g'},
+    {'r','u','i','n','s'},
+    {'r','u','k','h','s'},
+    {'r','u','l','e','d'},
+    {'r','u','l','e','r'},
+    {'r','u','l','e','s'},
+    {'r','u','l','l','y'},
+    {'r','u','m','a','l'},
+    {'r','u','m','b','a'},
+    {'r','u','m','b','o'},
+    {'r','u','m','e','n'},
+    {'r','u','m','e','s'},
+    {'r','u','m','l','y'},
+    {'r','u','m','m','y'},
+    {'r','u','m','o','r'},
+    {'r','u','m','p','o'},
+    {'r','u','m','p','s'},
+    {'r','u','m','p','y'},
+    {'r','u','n','c','e'},
+    {'r','u','n','c','h'},
+    {'r','u','n','d','s'},
+    {'r','u','n','e','d'},
+    {'r','u','n','e','r'},
+    {'r','u','n','e','s'},
+    {'r','u','n','g','s'},
+    {'r','u','n','i','c'},
+    {'r','u','n','n','y'},
+    {'r','u','n','o','s'},
+    {'r','u','n','t','s'},
+    {'r','u','n','t','y'},
+    {'r','u','n','u','p'},
+    {'r','u','o','t','e'},
+    {'r','u','p','e','e'},
+    {'r','u','p','i','a'},
+    {'r','u','r','a','l'},
+    {'r','u','r','p','s'},
+    {'r','u','r','u','s'},
+    {'r','u','s','a','s'},
+    {'r','u','s','e','s'},
+    {'r','u','s','h','y'},
+    {'r','u','s','k','s'},
+    {'r','u','s','k','y'},
+    {'r','u','s','m','a'},
+    {'r','u','s','s','e'},
+    {'r','u','s','t','s'},
+    {'r','u','s','t','y'},
+    {'r','u','t','h','s'},
+    {'r','u','t','i','n'},
+    {'r','u','t','t','y'},
+    {'r','u','v','i','d'},
+    {'r','y','a','l','s'},
+    {'r','y','b','a','t'},
+    {'r','y','i','j','i'},
+    {'r','y','i','j','y'},
+    {'r','y','k','e','d'},
+    {'r','y','k','e','s'},
+    {'r','y','m','e','r'},
+    {'r','y','m','m','e'},
+    {'r','y','n','d','s'},
+    {'r','y','o','t','i'},
+    {'r','y','o','t','s'},
+    {'r','y','p','e','r'},
+    {'r','y','p','i','n'},
+    {'r','y','t','h','e'},
+    {'r','y','u','g','i'},
+    {'s','a','a','g','s'},
+    {'s','a','b','a','l'},
+    {'s','a','b','e','d'},
+    {'s','a','b','e','r'},
+    {'s','a','b','e','s'},
+    {'s','a','b','h','a'},
+    {'s','a','b','i','n'},
+    {'s','a','b','i','r'},
+    {'s','a','b','j','i'},
+    {'s','a','b','l','e'},
+    {'s','a','b','o','s'},
+    {'s','a','b','o','t'},
+    {'s','a','b','r','a'},
+    {'s','a','b','r','e'},
+    {'s','a','b','z','i'},
+    {'s','a','c','k','s'},
+    {'s','a','c','r','a'},
+    {'s','a','c','r','e'},
+    {'s','a','d','d','o'},
+    {'s','a','d','d','y'},
+    {'s','a','d','e','s'},
+    {'s','a','d','h','e'},
+    {'s','a','d','h','u'},
+    {'s','a','d','i','c'},
+    {'s','a','d','i','s'},
+    {'s','a','d','l','y'},
+    {'s','a','d','o','s'},
+    {'s','a','d','z','a'},
+    {'s','a','e','t','a'},
+    {'s','a','f','e','d'},
+    {'s','a','f','e','r'},
+    {'s','a','f','e','s'},
+    {'s','a','g','a','r'},
+    {'s','a','g','a','s'},
+    {'s','a','g','e','r'},
+    {'s','a','g','e','s'},
+    {'s','a','g','g','y'},
+    {'s','a','g','o','s'},
+    {'s','a','g','u','m'},
+    {'s','a','h','a','b'},
+    {'s','a','h','e','b'},
+    {'s','a','h','i','b'},
+    {'s','a','i','c','e'},
+    {'s','a','i','c','k'},
+    {'s','a','i','c','s'},
+    {'s','a','i','d','s'},
+    {'s','a','i','g','a'},
+    {'s','a','i','l','s'},
+    {'s','a','i','m','s'},
+    {'s','a','i','n','e'},
+    {'s','a','i','n','s'},
+    {'s','a','i','n','t'},
+    {'s','a','i','r','s'},
+    {'s','a','i','s','t'},
+    {'s','a','i','t','h'},
+    {'s','a','j','o','u'},
+    {'s','a','k','a','i'},
+    {'s','a','k','e','r'},
+    {'s','a','k','e','s'},
+    {'s','a','k','i','a'},
+    {'s','a','k','i','s'},
+    {'s','a','k','t','i'},
+    {'s','a','l','a','d'},
+    {'s','a','l','a','l'},
+    {'s','a','l','a','s'},
+    {'s','a','l','a','t'},
+    {'s','a','l','e','p'},
+    {'s','a','l','e','s'},
+    {'s','a','l','e','t'},
+    {'s','a','l','i','c'},
+    {'s','a','l','i','s'},
+    {'s','a','l','i','x'},
+    {'s','a','l','l','e'},
+    {'s','a','l','l','y'},
+    {'s','a','l','m','i'},
+    {'s','a','l','o','l'},
+    {'s','a','l','o','n'},
+    {'s','a','l','o','p'},
+    {'s','a','l','p','a'},
+    {'s','a','l','p','s'},
+    {'s','a','l','s','a'},
+    {'s','a','l','s','e'},
+    {'s','a','l','t','o'},
+    {'s','a','l','t','s'},
+    {'s','a','l','t','y'},
+    {'s','a','l','u','d'},
+    {'s','a','l','u','e'},
+    {'s','a','l','u','t'},
+    {'s','a','l','v','e'},
+    {'s','a','l','v','o'},
+    {'s','a','m','a','n'},
+    {'s','a','m','a','s'},
+    {'s','a','m','b','a'},
+    {'s','a','m','b','o'},
+    {'s','a','m','e','k'},
+    {'s','a','m','e','l'},
+    {'s','a','m','e','n'},
+    {'s','a','m','e','s'},
+    {'s','a','m','e','y'},
+    {'s','a','m','f','i'},
+    {'s','a','m','f','u'},
+    {'s','a','m','m','y'},
+    {'s','a','m','p','i'},
+    {'s','a','m','p','s'},
+    {'s','a','n','a','d'},
+    {'s','a','n','d','s'},
+    {'s','a','n','d','y'},
+    {'s','a','n','e','d'},
+    {'s','a','n','e','r'},
+    {'s','a','n','e','s'},
+    {'s','a','n','g','a'},
+    {'s','a','n','g','h'},
+    {'s','a','n','g','o'},
+    {'s','a','n','g','s'},
+    {'s','a','n','k','o'},
+    {'s','a','n','s','a'},
+    {'s','a','n','t','o'},
+    {'s','a','n','t','s'},
+    {'s','a','o','l','a'},
+    {'s','a','p','a','n'},
+    {'s','a','p','i','d'},
+    {'s','a','p','o','r'},
+    {'s','a','p','p','y'},
+    {'s','a','r','a','n'},
+    {'s','a','r','d','s'},
+    {'s','a','r','e','d'},
+    {'s','a','r','e','e'},
+    {'s','a','r','g','e'},
+    {'s','a','r','g','o'},
+    {'s','a','r','i','n'},
+    {'s','a','r','i','r'},
+    {'s','a','r','i','s'},
+    {'s','a','r','k','s'},
+    {'s','a','r','k','y'},
+    {'s','a','r','o','d'},
+    {'s','a','r','o','s'},
+    {'s','a','r','u','s'},
+    {'s','a','r','v','o'},
+    {'s','a','s','e','r'},
+    {'s','a','s','i','n'},
+    {'s','a','s','s','e'},
+    {'s','a','s','s','y'},
+    {'s','a','t','a','i'},
+    {'s','a','t','a','y'},
+    {'s','a','t','e','d'},
+    {'s','a','t','e','m'},
+    {'s','a','t','e','r'},
+    {'s','a','t','e','s'},
+    {'s','a','t','i','n'},
+    {'s','a','t','i','s'},
+    {'s','a','t','y','r'},
+    {'s','a','u','b','a'},
+    {'s','a','u','c','e'},
+    {'s','a','u','c','h'},
+    {'s','a','u','c','y'},
+    {'s','a','u','g','h'},
+    {'s','a','u','l','s'},
+    {'s','a','u','l','t'},
+    {'s','a','u','n','a'},
+    {'s','a','u','n','f'},
+    {'s','a','u','n','t'},
+    {'s','a','u','r','y'},
+    {'s','a','u','t','e'},
+    {'s','a','u','t','s'},
+    {'s','a','u','v','e'},
+    {'s','a','v','e','d'},
+    {'s','a','v','e','r'},
+    {'s','a','v','e','s'},
+    {'s','a','v','e','y'},
+    {'s','a','v','i','n'},
+    {'s','a','v','o','r'},
+    {'s','a','v','o','y'},
+    {'s','a','v','v','y'},
+    {'s','a','w','a','h'},
+    {'s','a','w','e','d'},
+    {'s','a','w','e','r'},
+    {'s','a','x','e','s'},
+    {'s','a','y','a','s'},
+    {'s','a','y','e','d'},
+    {'s','a','y','e','e'},
+    {'s','a','y','e','r'},
+    {'s','a','y','i','d'},
+    {'s','a','y','n','e'},
+    {'s','a','y','o','n'},
+    {'s','a','y','s','t'},
+    {'s','a','z','e','s'},
+    {'s','c','a','b','s'},
+    {'s','c','a','d','s'},
+    {'s','c','a','f','f'},
+    {'s','c','a','g','s'},
+    {'s','c','a','i','l'},
+    {'s','c','a','l','a'},
+    {'s','c','a','l','d'},
+    {'s','c','a','l','e'},
+    {'s','c','a','l','l'},
+    {'s','c','a','l','p'},
+    {'s','c','a','l','y'},
+    {'s','c','a','m','p'},
+    {'s','c','a','m','s'},
+    {'s','c','a','n','d'},
+    {'s','c','a','n','s'},
+    {'s','c','a','n','t'},
+    {'s','c','a','p','a'},
+    {'s','c','a','p','e'},
+    {'s','c','a','p','i'},
+    {'s','c','a','r','e'},
+    {'s','c','a','r','f'},
+    {'s','c','a','r','p'},
+    {'s','c','a','r','s'},
+    {'s','c','a','r','t'},
+    {'s','c','a','r','y'},
+    {'s','c','a','t','h'},
+    {'s','c','a','t','s'},
+    {'s','c','a','t','t'},
+    {'s','c','a','u','d'},
+    {'s','c','a','u','p'},
+    {'s','c','a','u','r'},
+    {'s','c','a','w','s'},
+    {'s','c','e','a','t'},
+    {'s','c','e','n','a'},
+    {'s','c','e','n','d'},
+    {'s','c','e','n','e'},
+    {'s','c','e','n','t'},
+    {'s','c','h','a','v'},
+    {'s','c','h','i','f'},
+    {'s','c','h','m','o'},
+    {'s','c','h','u','l'},
+    {'s','c','h','w','a'},
+    {'s','c','i','f','i'},
+    {'s','c','i','n','d'},
+    {'s','c','i','o','n'},
+    {'s','c','i','r','e'},
+    {'s','c','l','i','m'},
+    {'s','c','o','b','e'},
+    {'s','c','o','d','y'},
+    {'s','c','o','f','f'},
+    {'s','c','o','g','s'},
+    {'s','c','o','l','d'},
+    {'s','c','o','n','e'},
+    {'s','c','o','o','g'},
+    {'s','c','o','o','p'},
+    {'s','c','o','o','t'},
+    {'s','c','o','p','a'},
+    {'s','c','o','p','e'},
+    {'s','c','o','p','s'},
+    {'s','c','o','r','e'},
+    {'s','c','o','r','n'},
+    {'s','c','o','r','p'},
+    {'s','c','o','t','e'},
+    {'s','c','o','t','s'},
+    {'s','c','o','u','g'},
+    {'s','c','o','u','p'},
+    {'s','c','o','u','r'},
+    {'s','c','o','u','t'},
+    {'s','c','o','w','l'},
+    {'s','c','o','w','p'},
+    {'s','c','o','w','s'},
+    {'s','c','r','a','b'},
+    {'s','c','r','a','e'},
+    {'s','c','r','a','g'},
+    {'s','c','r','a','m'},
+    {'s','c','r','a','n'},
+    {'s','c','r','a','p'},
+    {'s','c','r','a','t'},
+    {'s','c','r','a','w'},
+    {'s','c','r','a','y'},
+    {'s','c','r','e','e'},
+    {'s','c','r','e','w'},
+    {'s','c','r','i','m'},
+    {'s','c','r','i','p'},
+    {'s','c','r','o','b'},
+    {'s','c','r','o','d'},
+    {'s','c','r','o','g'},
+    {'s','c','r','o','o'},
+    {'s','c','r','o','w'},
+    {'s','c','r','u','b'},
+    {'s','c','r','u','m'},
+    {'s','c','u','b','a'},
+    {'s','c','u','d','i'},
+    {'s','c','u','d','o'},
+    {'s','c','u','d','s'},
+    {'s','c','u','f','f'},
+    {'s','c','u','f','t'},
+    {'s','c','u','g','s'},
+    {'s','c','u','l','k'},
+    {'s','c','u','l','l'},
+    {'s','c','u','l','p'},
+    {'s','c','u','l','s'},
+    {'s','c','u','m','s'},
+    {'s','c','u','p','s'},
+    {'s','c','u','r','f'},
+    {'s','c','u','r','s'},
+    {'s','c','u','s','e'},
+    {'s','c','u','t','a'},
+    {'s','c','u','t','e'},
+    {'s','c','u','t','s'},
+    {'s','c','u','z','z'},
+    {'s','c','y','e','s'},
+    {'s','d','a','y','n'},
+    {'s','d','e','i','n'},
+    {'s','e','a','l','s'},
+    {'s','e','a','m','e'},
+    {'s','e','a','m','s'},
+    {'s','e','a','m','y'},
+    {'s','e','a','n','s'},
+    {'s','e','a','r','e'},
+    {'s','e','a','r','s'},
+    {'s','e','a','s','e'},
+    {'s','e','a','t','s'},
+    {'s','e','a','z','e'},
+    {'s','e','b','u','m'},
+    {'s','e','c','c','o'},
+    {'s','e','c','h','s'},
+    {'s','e','c','t','s'},
+    {'s','e','d','a','n'},
+    {'s','e','d','e','r'},
+    {'s','e','d','e','s'},
+    {'s','e','d','g','e'},
+    {'s','e','d','g','y'},
+    {'s','e','d','u','m'},
+    {'s','e','e','d','s'},
+    {'s','e','e','d','y'},
+    {'s','e','e','k','s'},
+    {'s','e','e','l','d'},
+    {'s','e','e','l','s'},
+    {'s','e','e','l','y'},
+    {'s','e','e','m','s'},
+    {'s','e','e','p','s'},
+    {'s','e','e','p','y'},
+    {'s','e','e','r','s'},
+    {'s','e','f','e','r'},
+    {'s','e','g','a','r'},
+    {'s','e','g','a','s'},
+    {'s','e','g','n','i'},
+    {'s','e','g','n','o'},
+    {'s','e','g','o','l'},
+    {'s','e','g','o','s'},
+    {'s','e','g','u','e'},
+    {'s','e','h','r','i'},
+    {'s','e','i','f','s'},
+    {'s','e','i','l','s'},
+    {'s','e','i','n','e'},
+    {'s','e','i','r','s'},
+    {'s','e','i','s','e'},
+    {'s','e','i','s','m'},
+    {'s','e','i','t','y'},
+    {'s','e','i','z','a'},
+    {'s','e','i','z','e'},
+    {'s','e','k','o','s'},
+    {'s','e','k','t','s'},
+    {'s','e','l','a','h'},
+    {'s','e','l','e','s'},
+    {'s','e','l','f','s'},
+    {'s','e','l','f','y'},
+    {'s','e','l','k','y'},
+    {'s','e','l','l','a'},
+    {'s','e','l','l','e'},
+    {'s','e','l','l','s'},
+    {'s','e','l','v','a'},
+    {'s','e','m','a','s'},
+    {'s','e','m','e','e'},
+    {'s','e','m','e','n'},
+    {'s','e','m','e','s'},
+    {'s','e','m','i','e'},
+    {'s','e','m','i','s'},
+    {'s','e','n','a','s'},
+    {'s','e','n','d','s'},
+    {'s','e','n','e','s'},
+    {'s','e','n','e','x'},
+    {'s','e','n','g','i'},
+    {'s','e','n','n','a'},
+    {'s','e','n','o','r'},
+    {'s','e','n','s','a'},
+    {'s','e','n','s','e'},
+    {'s','e','n','s','i'},
+    {'s','e','n','s','u'},
+    {'s','e','n','t','e'},
+    {'s','e','n','t','i'},
+    {'s','e','n','t','s'},
+    {'s','e','n','v','y'},
+    {'s','e','n','z','a'},
+    {'s','e','p','a','d'},
+    {'s','e','p','a','l'},
+    {'s','e','p','i','a'},
+    {'s','e','p','i','c'},
+    {'s','e','p','o','y'},
+    {'s','e','p','p','o'},
+    {'s','e','p','t','a'},
+    {'s','e','p','t','s'},
+    {'s','e','r','a','c'},
+    {'s','e','r','a','i'},
+    {'s','e','r','a','l'},
+    {'s','e','r','e','d'},
+    {'s','e','r','e','r'},
+    {'s','e','r','e','s'},
+    {'s','e','r','f','s'},
+    {'s','e','r','g','e'},
+    {'s','e','r','i','a'},
+    {'s','e','r','i','c'},
+    {'s','e','r','i','f'},
+    {'s','e','r','i','n'},
+    {'s','e','r','i','r'},
+    {'s','e','r','k','s'},
+    {'s','e','r','o','n'},
+    {'s','e','r','o','w'},
+    {'s','e','r','r','a'},
+    {'s','e','r','r','e'},
+    {'s','e','r','r','s'},
+    {'s','e','r','r','y'},
+    {'s','e','r','u','m'},
+    {'s','e','r','v','e'},
+    {'s','e','r','v','o'},
+    {'s','e','s','e','y'},
+    {'s','e','s','s','a'},
+    {'s','e','t','a','e'},
+    {'s','e','t','a','l'},
+    {'s','e','t','e','r'},
+    {'s','e','t','h','s'},
+    {'s','e','t','o','n'},
+    {'s','e','t','t','s'},
+    {'s','e','t','u','p'},
+    {'s','e','v','a','k'},
+    {'s','e','v','e','n'},
+    {'s','e','v','e','r'},
+    {'s','e','v','i','r'},
+    {'s','e','w','a','n'},
+    {'s','e','w','a','r'},
+    {'s','e','w','e','d'},
+    {'s','e','w','e','l'},
+    {'s','e','w','e','n'},
+    {'s','e','w','e','r'},
+    {'s','e','w','i','n'},
+    {'s','e','x','e','d'},
+    {'s','e','x','e','r'},
+    {'s','e','x','e','s'},
+    {'s','e','x','o','r'},
+    {'s','e','x','t','o'},
+    {'s','e','x','t','s'},
+    {'s','e','y','e','n'},
+    {'s','e','z','e','s'},
+    {'s','h','a','c','k'},
+    {'s','h','a','d','e'},
+    {'s','h','a','d','s'},
+    {'s','h','a','d','y'},
+    {'s','h','a','f','t'},
+    {'s','h','a','g','s'},
+    {'s','h','a','h','s'},
+    {'s','h','a','k','a'},
+    {'s','h','a','k','e'},
+    {'s','h','a','k','o'},
+    {'s','h','a','k','t'},
+    {'s','h','a','k','y'},
+    {'s','h','a','l','e'},
+    {'s','h','a','l','l'},
+    {'s','h','a','l','m'},
+    {'s','h','a','l','t'},
+    {'s','h','a','l','y'},
+    {'s','h','a','m','a'},
+    {'s','h','a','m','e'},
+    {'s','h','a','m','s'},
+    {'s','h','a','n','d'},
+    {'s','h','a','n','k'},
+    {'s','h','a','n','s'},
+    {'s','h','a','p','e'},
+    {'s','h','a','p','s'},
+    {'s','h','a','r','d'},
+    {'s','h','a','r','e'},
+    {'s','h','a','r','k'},
+    {'s','h','a','r','n'},
+    {'s','h','a','r','p'},
+    {'s','h','a','r','t'},
+    {'s','h','a','s','h'},
+    {'s','h','a','u','l'},
+    {'s','h','a','v','e'},
+    {'s','h','a','w','l'},
+    {'s','h','a','w','m'},
+    {'s','h','a','w','n'},
+    {'s','h','a','w','s'},
+    {'s','h','a','y','a'},
+    {'s','h','a','y','s'},
+    {'s','h','c','h','i'},
+    {'s','h','e','a','f'},
+    {'s','h','e','a','l'},
+    {'s','h','e','a','r'},
+    {'s','h','e','a','s'},
+    {'s','h','e','d','s'},
+    {'s','h','e','e','l'},
+    {'s','h','e','e','n'},
+    {'s','h','e','e','p'},
+    {'s','h','e','e','r'},
+    {'s','h','e','e','t'},
+    {'s','h','e','i','k'},
+    {'s','h','e','l','f'},
+    {'s','h','e','l','l'},
+    {'s','h','e','n','d'},
+    {'s','h','e','n','g'},
+    {'s','h','e','n','t'},
+    {'s','h','e','o','l'},
+    {'s','h','e','r','d'},
+    {'s','h','e','r','e'},
+    {'s','h','e','r','o'},
+    {'s','h','e','t','s'},
+    {'s','h','e','v','a'},
+    {'s','h','e','w','n'},
+    {'s','h','e','w','s'},
+    {'s','h','i','a','i'},
+    {'s','h','i','e','d'},
+    {'s','h','i','e','l'},
+    {'s','h','i','e','r'},
+    {'s','h','i','e','s'},
+    {'s','h','i','f','t'},
+    {'s','h','i','l','l'},
+    {'s','h','i','l','y'},
+    {'s','h','i','m','s'},
+    {'s','h','i','n','e'},
+    {'s','h','i','n','s'},
+    {'s','h','i','n','y'},
+    {'s','h','i','o','k'},
+    {'s','h','i','p','s'},
+    {'s','h','i','r','e'},
+    {'s','h','i','r','k'},
+    {'s','h','i','r','r'},
+    {'s','h','i','r','s'},
+    {'s','h','i','r','t'},
+    {'s','h','i','s','h'},
+    {'s','h','i','s','o'},
+    {'s','h','i','s','t'},
+    {'s','h','i','t','e'},
+    {'s','h','i','t','s'},
+    {'s','h','i','u','r'},
+    {'s','h','i','v','a'},
+    {'s','h','i','v','e'},
+    {'s','h','i','v','s'},
+    {'s','h','l','e','p'},
+    {'s','h','l','u','b'},
+    {'s','h','m','e','k'},
+    {'s','h','m','o','e'},
+    {'s','h','o','a','l'},
+    {'s','h','o','a','t'},
+    {'s','h','o','c','k'},
+    {'s','h','o','e','d'},
+    {'s','h','o','e','r'},
+    {'s','h','o','e','s'},
+    {'s','h','o','g','i'},
+    {'s','h','o','g','s'},
+    {'s','h','o','j','i'},
+    {'s','h','o','j','o'},
+    {'s','h','o','l','a'},
+    {'s','h','o','n','e'},
+    {'s','h','o','n','k'},
+    {'s','h','o','o','k'},
+    {'s','h','o','o','l'},
+    {'s','h','o','o','n'},
+    {'s','h','o','o','s'},
+    {'s','h','o','o','t'},
+    {'s','h','o','p','e'},
+    {'s','h','o','p','s'},
+    {'s','h','o','r','e'},
+    {'s','h','o','r','l'},
+    {'s','h','o','r','n'},
+    {'s','h','o','r','t'},
+    {'s','h','o','t','e'},
+    {'s','h','o','t','s'},
+    {'s','h','o','t','t'},
+    {'s','h','o','u','d'},
+    {'s','h','o','u','t'},
+    {'s','h','o','v','e'},
+    {'s','h','o','w','d'},
+    {'s','h','o','w','n'},
+    {'s','h','o','w','s'},
+    {'s','h','o','w','y'},
+    {'s','h','o','y','u'},
+    {'s','h','r','e','d'},
+    {'s','h','r','e','w'},
+    {'s','h','r','i','s'},
+    {'s','h','r','o','w'},
+    {'s','h','r','u','b'},
+    {'s','h','r','u','g'},
+    {'s','h','t','a','r'},
+    {'s','h','t','i','k'},
+    {'s','h','t','u','m'},
+    {'s','h','t','u','p'},
+    {'s','h','u','b','a'},
+    {'s','h','u','c','k'},
+    {'s','h','u','l','e'},
+    {'s','h','u','l','n'},
+    {'s','h','u','l','s'},
+    {'s','h','u','n','s'},
+    {'s','h','u','n','t'},
+    {'s','h','u','r','a'},
+    {'s','h','u','s','h'},
+    {'s','h','u','t','e'},
+    {'s','h','u','t','s'},
+    {'s','h','w','a','s'},
+    {'s','h','y','e','r'},
+    {'s','h','y','l','y'},
+    {'s','i','a','l','s'},
+    {'s','i','b','b','s'},
+    {'s','i','b','i','a'},
+    {'s','i','b','y','l'},
+    {'s','i','c','e','s'},
+    {'s','i','c','h','t'},
+    {'s','i','c','k','o'},
+    {'s','i','c','k','s'},
+    {'s','i','c','k','y'},
+    {'s','i','d','a','s'},
+    {'s','i','d','e','d'},
+    {'s','i','d','e','r'},
+    {'s','i','d','e','s'},
+    {'s','i','d','e','y'},
+    {'s','i','d','h','a'},
+    {'s','i','d','h','e'},
+    {'s','i','d','l','e'},
+    {'s','i','e','g','e'},
+    {'s','i','e','l','d'},
+    {'s','i','e','n','s'},
+    {'s','i','e','n','t'},
+    {'s','i','e','t','h'},
+    {'s','i','e','u','r'},
+    {'s','i','e','v','e'},
+    {'s','i','f','t','s'},
+    {'s','i','g','h','s'},
+    {'s','i','g','h','t'},
+    {'s','i','g','i','l'},
+    {'s','i','g','l','a'},
+    {'s','i','g','m','a'},
+    {'s','i','g','n','a'},
+    {'s','i','g','n','s'},
+    {'s','i','g','r','i'},
+    {'s','i','j','o','s'},
+    {'s','i','k','a','s'},
+    {'s','i','k','e','r'},
+    {'s','i','k','e','s'},
+    {'s','i','l','d','s'},
+    {'s','i','l','e','d'},
+    {'s','i','l','e','n'},
+    {'s','i','l','e','r'},
+    {'s','i','l','e','s'},
+    {'s','i','l','e','x'},
+    {'s','i','l','k','s'},
+    {'s','i','l','k','y'},
+    {'s','i','l','l','s'},
+    {'s','i','l','l','y'},
+    {'s','i','l','o','s'},
+    {'s','i','l','t','s'},
+    {'s','i','l','t','y'},
+    {'s','i','l','v','a'},
+    {'s','i','m','a','r'},
+    {'s','i','m','a','s'},
+    {'s','i','m','b','a'},
+    {'s','i','m','i','s'},
+    {'s','i','m','p','s'},
+    {'s','i','m','u','l'},
+    {'s','i','n','c','e'},
+    {'s','i','n','d','s'},
+    {'s','i','n','e','d'},
+    {'s','i','n','e','s'},
+    {'s','i','n','e','w'},
+    {'s','i','n','g','e'},
+    {'s','i','n','g','s'},
+    {'s','i','n','h','s'},
+    {'s','i','n','k','s'},
+    {'s','i','n','k','y'},
+    {'s','i','n','s','i'},
+    {'s','i','n','u','s'},
+    {'s','i','p','e','d'},
+    {'s','i','p','e','s'},
+    {'s','i','p','p','y'},
+    {'s','i','r','e','d'},
+    {'s','i','r','e','e'},
+    {'s','i','r','e','n'},
+    {'s','i','r','e','s'},
+    {'s','i','r','i','h'},
+    {'s','i','r','i','s'},
+    {'s','i','r','o','c'},
+    {'s','i','r','r','a'},
+    {'s','i','r','u','p'},
+    {'s','i','s','a','l'},
+    {'s','i','s','e','s'},
+    {'s','i','s','s','y'},
+    {'s','i','s','t','a'},
+    {'s','i','s','t','s'},
+    {'s','i','t','a','r'},
+    {'s','i','t','c','h'},
+    {'s','i','t','e','d'},
+    {'s','i','t','e','s'},
+    {'s','i','t','h','e'},
+    {'s','i','t','k','a'},
+    {'s','i','t','u','p'},
+    {'s','i','t','u','s'},
+    {'s','i','v','e','r'},
+    {'s','i','x','e','r'},
+    {'s','i','x','e','s'},
+    {'s','i','x','m','o'},
+    {'s','i','x','t','e'},
+    {'s','i','x','t','h'},
+    {'s','i','x','t','y'},
+    {'s','i','z','a','r'},
+    {'s','i','z','e','d'},
+    {'s','i','z','e','l'},
+    {'s','i','z','e','r'},
+    {'s','i','z','e','s'},
+    {'s','k','a','g','s'},
+    {'s','k','a','i','l'},
+    {'s','k','a','l','d'},
+    {'s','k','a','n','k'},
+    {'s','k','a','r','n'},
+    {'s','k','a','r','t'},
+    {'s','k','a','t','e'},
+    {'s','k','a','t','s'},
+    {'s','k','a','t','t'},
+    {'s','k','a','w','s'},
+    {'s','k','e','a','n'},
+    {'s','k','e','a','r'},
+    {'s','k','e','d','s'},
+    {'s','k','e','e','d'},
+    {'s','k','e','e','f'},
+    {'s','k','e','e','n'},
+    {'s','k','e','e','r'},
+    {'s','k','e','e','s'},
+    {'s','k','e','e','t'},
+    {'s','k','e','e','v'},
+    {'s','k','e','e','z'},
+    {'s','k','e','g','g'},
+    {'s','k','e','g','s'},
+    {'s','k','e','i','n'},
+    {'s','k','e','l','f'},
+    {'s','k','e','l','l'},
+    {'s','k','e','l','m'},
+    {'s','k','e','l','p'},
+    {'s','k','e','n','e'},
+    {'s','k','e','n','s'},
+    {'s','k','e','o','s'},
+    {'s','k','e','p','s'},
+    {'s','k','e','r','m'},
+    {'s','k','e','r','s'},
+    {'s','k','e','t','s'},
+    {'s','k','e','w','s'},
+    {'s','k','i','d','s'},
+    {'s','k','i','e','d'},
+    {'s','k','i','e','r'},
+    {'s','k','i','e','s'},
+    {'s','k','i','e','y'},
+    {'s','k','i','f','f'},
+    {'s','k','i','l','l'},
+    {'s','k','i','m','o'},
+    {'s','k','i','m','p'},
+    {'s','k','i','m','s'},
+    {'s','k','i','n','k'},
+    {'s','k','i','n','s'},
+    {'s','k','i','n','t'},
+    {'s','k','i','o','s'},
+    {'s','k','i','p','s'},
+    {'s','k','i','r','l'},
+    {'s','k','i','r','r'},
+    {'s','k','i','r','t'},
+    {'s','k','i','t','e'},
+    {'s','k','i','t','s'},
+    {'s','k','i','v','e'},
+    {'s','k','i','v','y'},
+    {'s','k','l','i','m'},
+    {'s','k','o','a','l'},
+    {'s','k','o','b','e'},
+    {'s','k','o','d','y'},
+    {'s','k','o','f','f'},
+    {'s','k','o','f','s'},
+    {'s','k','o','g','s'},
+    {'s','k','o','l','s'},
+    {'s','k','o','o','l'},
+    {'s','k','o','r','t'},
+    {'s','k','o','s','h'},
+    {'s','k','r','a','n'},
+    {'s','k','r','i','k'},
+    {'s','k','r','o','o'},
+    {'s','k','u','a','s'},
+    {'s','k','u','g','s'},
+    {'s','k','u','l','k'},
+    {'s','k','u','l','l'},
+    {'s','k','u','n','k'},
+    {'s','k','y','e','d'},
+    {'s','k','y','e','r'},
+    {'s','k','y','e','y'},
+    {'s','k','y','f','s'},
+    {'s','k','y','r','e'},
+    {'s','k','y','r','s'},
+    {'s','k','y','t','e'},
+    {'s','l','a','b','s'},
+    {'s','l','a','c','k'},
+    {'s','l','a','d','e'},
+    {'s','l','a','e','s'},
+    {'s','l','a','g','s'},
+    {'s','l','a','i','d'},
+    {'s','l','a','i','n'},
+    {'s','l','a','k','e'},
+    {'s','l','a','m','s'},
+    {'s','l','a','n','e'},
+    {'s','l','a','n','g'},
+    {'s','l','a','n','k'},
+    {'s','l','a','n','t'},
+    {'s','l','a','p','s'},
+    {'s','l','a','r','t'},
+    {'s','l','a','s','h'},
+    {'s','l','a','t','e'},
+    {'s','l','a','t','s'},
+    {'s','l','a','t','y'},
+    {'s','l','a','v','e'},
+    {'s','l','a','w','s'},
+    {'s','l','a','y','s'},
+    {'s','l','e','b','s'},
+    {'s','l','e','d','s'},
+    {'s','l','e','e','k'},
+    {'s','l','e','e','p'},
+    {'s','l','e','e','r'},
+    {'s','l','e','e','t'},
+    {'s','l','e','p','t'},
+    {'s','l','e','w','s'},
+    {'s','l','e','y','s'},
+    {'s','l','i','c','e'},
+    {'s','l','i','c','k'},
+    {'s','l','i','d','e'},
+    {'s','l','i','e','r'},
+    {'s','l','i','l','y'},
+    {'s','l','i','m','e'},
+    {'s','l','i','m','s'},
+    {'s','l','i','m','y'},
+    {'s','l','i','n','g'},
+    {'s','l','i','n','k'},
+    {'s','l','i','p','e'},
+    {'s','l','i','p','s'},
+    {'s','l','i','p','t'},
+    {'s','l','i','s','h'},
+    {'s','l','i','t','s'},
+    {'s','l','i','v','e'},
+    {'s','l','o','a','n'},
+    {'s','l','o','b','s'},
+    {'s','l','o','e','s'},
+    {'s','l','o','g','s'},
+    {'s','l','o','i','d'},
+    {'s','l','o','j','d'},
+    {'s','l','o','k','a'},
+    {'s','l','o','m','o'},
+    {'s','l','o','o','m'},
+    {'s','l','o','o','p'},
+    {'s','l','o','o','t'},
+    {'s','l','o','p','e'},
+    {'s','l','o','p','s'},
+    {'s','l','o','p','y'},
+    {'s','l','o','r','m'},
+    {'s','l','o','s','h'},
+    {'s','l','o','t','h'},
+    {'s','l','o','t','s'},
+    {'s','l','o','v','e'},
+    {'s','l','o','w','s'},
+    {'s','l','o','y','d'},
+    {'s','l','u','b','b'},
+    {'s','l','u','b','s'},
+    {'s','l','u','e','d'},
+    {'s','l','u','e','s'},
+    {'s','l','u','f','f'},
+    {'s','l','u','g','s'},
+    {'s','l','u','i','t'},
+    {'s','l','u','m','p'},
+    {'s','l','u','m','s'},
+    {'s','l','u','n','g'},
+    {'s','l','u','n','k'},
+    {'s','l','u','r','b'},
+    {'s','l','u','r','p'},
+    {'s','l','u','r','s'},
+    {'s','l','u','s','e'},
+    {'s','l','u','s','h'},
+    {'s','l','u','t','s'},
+    {'s','l','y','e','r'},
+    {'s','l','y','l','y'},
+    {'s','l','y','p','e'},
+    {'s','m','a','a','k'},
+    {'s','m','a','c','k'},
+    {'s','m','a','i','k'},
+    {'s','m','a','l','l'},
+    {'s','m','a','l','m'},
+    {'s','m','a','l','t'},
+    {'s','m','a','r','m'},
+    {'s','m','a','r','t'},
+    {'s','m','a','s','h'},
+    {'s','m','a','z','e'},
+    {'s','m','e','a','r'},
+    {'s','m','e','e','k'},
+    {'s','m','e','e','s'},
+    {'s','m','e','i','k'},
+    {'s','m','e','k','e'},
+    {'s','m','e','l','l'},
+    {'s','m','e','l','t'},
+    {'s','m','e','r','k'},
+    {'s','m','e','w','s'},
+    {'s','m','i','c','k'},
+    {'s','m','i','l','e'},
+    {'s','m','i','l','y'},
+    {'s','m','i','r','k'},
+    {'s','m','i','r','r'},
+    {'s','m','i','r','s'},
+    {'s','m','i','t','e'},
+    {'s','m','i','t','h'},
+    {'s','m','i','t','s'},
+    {'s','m','i','z','e'},
+    {'s','m','o','c','k'},
+    {'s','m','o','g','s'},
+    {'s','m','o','k','e'},
+    {'s','m','o','k','o'},
+    {'s','m','o','k','y'},
+    {'s','m','o','l','t'},
+    {'s','m','o','o','r'},
+    {'s','m','o','o','t'},
+    {'s','m','o','r','e'},
+    {'s','m','o','r','g'},
+    {'s','m','o','t','e'},
+    {'s','m','o','u','t'},
+    {'s','m','o','w','t'},
+    {'s','m','u','g','s'},
+    {'s','m','u','r','s'},
+    {'s','m','u','s','h'},
+    {'s','m','u','t','s'},
+    {'s','n','a','b','s'},
+    {'s','n','a','c','k'},
+    {'s','n','a','f','u'},
+    {'s','n','a','g','s'},
+    {'s','n','a','i','l'},
+    {'s','n','a','k','e'},
+    {'s','n','a','k','y'},
+    {'s','n','a','p','s'},
+    {'s','n','a','r','e'},
+    {'s','n','a','r','f'},
+    {'s','n','a','r','k'},
+    {'s','n','a','r','l'},
+    {'s','n','a','r','s'},
+    {'s','n','a','r','y'},
+    {'s','n','a','s','h'},
+    {'s','n','a','t','h'},
+    {'s','n','a','w','s'},
+    {'s','n','e','a','d'},
+    {'s','n','e','a','k'},
+    {'s','n','e','a','p'},
+    {'s','n','e','b','s'},
+    {'s','n','e','c','k'},
+    {'s','n','e','d','s'},
+    {'s','n','e','e','d'},
+    {'s','n','e','e','r'},
+    {'s','n','e','e','s'},
+    {'s','n','e','l','l'},
+    {'s','n','i','b','s'},
+    {'s','n','i','c','k'},
+    {'s','n','i','d','e'},
+    {'s','n','i','e','d'},
+    {'s','n','i','e','s'},
+    {'s','n','i','f','f'},
+    {'s','n','i','f','t'},
+    {'s','n','i','g','s'},
+    {'s','n','i','p','e'},
+    {'s','n','i','p','s'},
+    {'s','n','i','p','y'},
+    {'s','n','i','r','t'},
+    {'s','n','i','t','s'},
+    {'s','n','i','v','e'},
+    {'s','n','o','b','s'},
+    {'s','n','o','d','s'},
+    {'s','n','o','e','k'},
+    {'s','n','o','e','p'},
+    {'s','n','o','g','s'},
+    {'s','n','o','k','e'},
+    {'s','n','o','o','d'},
+    {'s','n','o','o','k'},
+    {'s','n','o','o','l'},
+    {'s','n','o','o','p'},
+    {'s','n','o','o','t'},
+    {'s','n','o','r','e'},
+    {'s','n','o','r','t'},
+    {'s','n','o','t','s'},
+    {'s','n','o','u','t'},
+    {'s','n','o','w','k'},
+    {'s','n','o','w','s'},
+    {'s','n','o','w','y'},
+    {'s','n','u','b','s'},
+    {'s','n','u','c','k'},
+    {'s','n','u','f','f'},
+    {'s','n','u','g','s'},
+    {'s','n','u','s','h'},
+    {'s','n','y','e','s'},
+    {'s','o','a','k','s'},
+    {'s','o','a','p','s'},
+    {'s','o','a','p','y'},
+    {'s','o','a','r','e'},
+    {'s','o','a','r','s'},
+    {'s','o','a','v','e'},
+    {'s','o','b','a','s'},
+    {'s','o','b','e','r'},
+    {'s','o','c','a','s'},
+    {'s','o','c','e','s'},
+    {'s','o','c','i','a'},
+    {'s','o','c','k','o'},
+    {'s','o','c','k','s'},
+    {'s','o','c','l','e'},
+    {'s','o','d','a','s'},
+    {'s','o','d','d','y'},
+    {'s','o','d','i','c'},
+    {'s','o','d','o','m'},
+    {'s','o','f','a','r'},
+    {'s','o','f','a','s'},
+    {'s','o','f','t','a'},
+    {'s','o','f','t','s'},
+    {'s','o','f','t','y'},
+    {'s','o','g','e','r'},
+    {'s','o','g','g','y'},
+    {'s','o','h','u','r'},
+    {'s','o','i','l','s'},
+    {'s','o','i','l','y'},
+    {'s','o','j','a','s'},
+    {'s','o','j','u','s'},
+    {'s','o','k','a','h'},
+    {'s','o','k','e','n'},
+    {'s','o','k','e','s'},
+    {'s','o','k','o','l'},
+    {'s','o','l','a','h'},
+    {'s','o','l','a','n'},
+    {'s','o','l','a','r'},
+    {'s','o','l','a','s'},
+    {'s','o','l','d','e'},
+    {'s','o','l','d','i'},
+    {'s','o','l','d','o'},
+    {'s','o','l','d','s'},
+    {'s','o','l','e','d'},
+    {'s','o','l','e','i'},
+    {'s','o','l','e','r'},
+    {'s','o','l','e','s'},
+    {'s','o','l','i','d'},
+    {'s','o','l','o','n'},
+    {'s','o','l','o','s'},
+    {'s','o','l','u','m'},
+    {'s','o','l','u','s'},
+    {'s','o','l','v','e'},
+    {'s','o','m','a','n'},
+    {'s','o','m','a','s'},
+    {'s','o','n','a','r'},
+    {'s','o','n','c','e'},
+    {'s','o','n','d','e'},
+    {'s','o','n','e','s'},
+    {'s','o','n','g','o'},
+    {'s','o','n','g','s'},
+    {'s','o','n','g','y'},
+    {'s','o','n','i','c'},
+    {'s','o','n','l','y'},
+    {'s','o','n','n','e'},
+    {'s','o','n','n','y'},
+    {'s','o','n','s','e'},
+    {'s','o','n','s','y'},
+    {'s','o','o','e','y'},
+    {'s','o','o','k','s'},
+    {'s','o','o','k','y'},
+    {'s','o','o','l','e'},
+    {'s','o','o','l','s'},
+    {'s','o','o','m','s'},
+    {'s','o','o','p','s'},
+    {'s','o','o','t','e'},
+    {'s','o','o','t','h'},
+    {'s','o','o','t','s'},
+    {'s','o','o','t','y'},
+    {'s','o','p','h','s'},
+    {'s','o','p','h','y'},
+    {'s','o','p','o','r'},
+    {'s','o','p','p','y'},
+    {'s','o','p','r','a'},
+    {'s','o','r','a','l'},
+    {'s','o','r','a','s'},
+    {'s','o','r','b','i'},
+    {'s','o','r','b','o'},
+    {'s','o','r','b','s'},
+    {'s','o','r','d','a'},
+    {'s','o','r','d','o'},
+    {'s','o','r','d','s'},
+    {'s','o','r','e','d'},
+    {'s','o','r','e','e'},
+    {'s','o','r','e','l'},
+    {'s','o','r','e','r'},
+    {'s','o','r','e','s'},
+    {'s','o','r','e','x'},
+    {'s','o','r','g','o'},
+    {'s','o','r','n','s'},
+    {'s','o','r','r','a'},
+    {'s','o','r','r','y'},
+    {'s','o','r','t','a'},
+    {'s','o','r','t','s'},
+    {'s','o','r','u','s'},
+    {'s','o','t','h','s'},
+    {'s','o','t','o','l'},
+    {'s','o','t','t','o'},
+    {'s','o','u','c','e'},
+    {'s','o','u','c','t'},
+    {'s','o','u','g','h'},
+    {'s','o','u','k','s'},
+    {'s','o','u','l','s'},
+    {'s','o','u','l','y'},
+    {'s','o','u','m','s'},
+    {'s','o','u','n','d'},
+    {'s','o','u','p','s'},
+    {'s','o','u','p','y'},
+    {'s','o','u','r','s'},
+    {'s','o','u','s','e'},
+    {'s','o','u','t','h'},
+    {'s','o','u','t','s'},
+    {'s','o','w','a','r'},
+    {'s','o','w','c','e'},
+    {'s','o','w','e','d'},
+    {'s','o','w','e','r'},
+    {'s','o','w','f','f'},
+    {'s','o','w','f','s'},
+    {'s','o','w','l','e'},
+    {'s','o','w','l','s'},
+    {'s','o','w','m','s'},
+    {'s','o','w','n','d'},
+    {'s','o','w','n','e'},
+    {'s','o','w','p','s'},
+    {'s','o','w','s','e'},
+    {'s','o','w','t','h'},
+    {'s','o','x','e','s'},
+    {'s','o','y','a','s'},
+    {'s','o','y','l','e'},
+    {'s','o','y','u','z'},
+    {'s','o','z','i','n'},
+    {'s','p','a','c','e'},
+    {'s','p','a','c','k'},
+    {'s','p','a','c','y'},
+    {'s','p','a','d','e'},
+    {'s','p','a','d','o'},
+    {'s','p','a','d','s'},
+    {'s','p','a','e','d'},
+    {'s','p','a','e','r'},
+    {'s','p','a','e','s'},
+    {'s','p','a','g','s'},
+    {'s','p','a','h','i'},
+    {'s','p','a','i','l'},
+    {'s','p','a','i','n'},
+    {'s','p','a','i','t'},
+    {'s','p','a','k','e'},
+    {'s','p','a','l','d'},
+    {'s','p','a','l','e'},
+    {'s','p','a','l','l'},
+    {'s','p','a','l','t'},
+    {'s','p','a','m','s'},
+    {'s','p','a','n','e'},
+    {'s','p','a','n','g'},
+    {'s','p','a','n','k'},
+    {'s','p','a','n','s'},
+    {'s','p','a','r','d'},
+    {'s','p','a','r','e'},
+    {'s','p','a','r','k'},
+    {'s','p','a','r','s'},
+    {'s','p','a','r','t'},
+    {'s','p','a','s','m'},
+    {'s','p','a','t','e'},
+    {'s','p','a','t','s'},
+    {'s','p','a','u','l'},
+    {'s','p','a','w','l'},
+    {'s','p','a','w','n'},
+    {'s','p','a','w','s'},
+    {'s','p','a','y','d'},
+    {'s','p','a','y','s'},
+    {'s','p','a','z','a'},
+    {'s','p','a','z','z'},
+    {'s','p','e','a','k'},
+    {'s','p','e','a','l'},
+    {'s','p','e','a','n'},
+    {'s','p','e','a','r'},
+    {'s','p','e','a','t'},
+    {'s','p','e','c','k'},
+    {'s','p','e','c','s'},
+    {'s','p','e','c','t'},
+    {'s','p','e','e','d'},
+    {'s','p','e','e','l'},
+    {'s','p','e','e','r'},
+    {'s','p','e','i','l'},
+    {'s','p','e','i','r'},
+    {'s','p','e','k','s'},
+    {'s','p','e','l','d'},
+    {'s','p','e','l','k'},
+    {'s','p','e','l','l'},
+    {'s','p','e','l','t'},
+    {'s','p','e','n','d'},
+    {'s','p','e','n','t'},
+    {'s','p','e','o','s'},
+    {'s','p','e','r','m'},
+    {'s','p','e','s','h'},
+    {'s','p','e','t','s'},
+    {'s','p','e','u','g'},
+    {'s','p','e','w','s'},
+    {'s','p','e','w','y'},
+    {'s','p','i','a','l'},
+    {'s','p','i','c','a'},
+    {'s','p','i','c','e'},
+    {'s','p','i','c','k'},
+    {'s','p','i','c','s'},
+    {'s','p','i','c','y'},
+    {'s','p','i','d','e'},
+    {'s','p','i','e','d'},
+    {'s','p','i','e','l'},
+    {'s','p','i','e','r'},
+    {'s','p','i','e','s'},
+    {'s','p','i','f','f'},
+    {'s','p','i','f','s'},
+    {'s','p','i','k','e'},
+    {'s','p','i','k','s'},
+    {'s','p','i','k','y'},
+    {'s','p','i','l','e'},
+    {'s','p','i','l','l'},
+    {'s','p','i','l','t'},
+    {'s','p','i','m','s'},
+    {'s','p','i','n','a'},
+    {'s','p','i','n','e'},
+    {'s','p','i','n','k'},
+    {'s','p','i','n','s'},
+    {'s','p','i','n','y'},
+    {'s','p','i','r','e'},
+    {'s','p','i','r','t'},
+    {'s','p','i','r','y'},
+    {'s','p','i','t','e'},
+    {'s','p','i','t','s'},
+    {'s','p','i','t','z'},
+    {'s','p','i','v','s'},
+    {'s','p','l','a','t'},
+    {'s','p','l','a','y'},
+    {'s','p','l','i','t'},
+    {'s','p','l','o','g'},
+    {'s','p','o','d','e'},
+    {'s','p','o','d','s'},
+    {'s','p','o','i','l'},
+    {'s','p','o','k','e'},
+    {'s','p','o','o','f'},
+    {'s','p','o','o','k'},
+    {'s','p','o','o','l'},
+    {'s','p','o','o','m'},
+    {'s','p','o','o','n'},
+    {'s','p','o','o','r'},
+    {'s','p','o','o','t'},
+    {'s','p','o','r','e'},
+    {'s','p','o','r','k'},
+    {'s','p','o','r','t'},
+    {'s','p','o','s','a'},
+    {'s','p','o','s','h'},
+    {'s','p','o','s','o'},
+    {'s','p','o','t','s'},
+    {'s','p','o','u','t'},
+    {'s','p','r','a','d'},
+    {'s','p','r','a','g'},
+    {'s','p','r','a','t'},
+    {'s','p','r','a','y'},
+    {'s','p','r','e','d'},
+    {'s','p','r','e','e'},
+    {'s','p','r','e','w'},
+    {'s','p','r','i','g'},
+    {'s','p','r','i','t'},
+    {'s','p','r','o','d'},
+    {'s','p','r','o','g'},
+    {'s','p','r','u','e'},
+    {'s','p','r','u','g'},
+    {'s','p','u','d','s'},
+    {'s','p','u','e','d'},
+    {'s','p','u','e','r'},
+    {'s','p','u','e','s'},
+    {'s','p','u','g','s'},
+    {'s','p','u','l','e'},
+    {'s','p','u','m','e'},
+    {'s','p','u','m','y'},
+    {'s','p','u','n','k'},
+    {'s','p','u','r','n'},
+    {'s','p','u','r','s'},
+    {'s','p','u','r','t'},
+    {'s','p','u','t','a'},
+    {'s','p','y','a','l'},
+    {'s','p','y','r','e'},
+    {'s','q','u','a','b'},
+    {'s','q','u','a','d'},
+    {'s','q','u','a','t'},
+    {'s','q','u','a','w'},
+    {'s','q','u','e','e'},
+    {'s','q','u','e','g'},
+    {'s','q','u','i','b'},
+    {'s','q','u','i','d'},
+    {'s','q','u','i','t'},
+    {'s','q','u','i','z'},
+    {'s','r','s','l','y'},
+    {'s','t','a','b','s'},
+    {'s','t','a','c','k'},
+    {'s','t','a','d','e'},
+    {'s','t','a','f','f'},
+    {'s','t','a','g','e'},
+    {'s','t','a','g','s'},
+    {'s','t','a','g','y'},
+    {'s','t','a','i','d'},
+    {'s','t','a','i','g'},
+    {'s','t','a','i','n'},
+    {'s','t','a','i','r'},
+    {'s','t','a','k','e'},
+    {'s','t','a','l','e'},
+    {'s','t','a','l','k'},
+    {'s','t','a','l','l'},
+    {'s','t','a','m','p'},
+    {'s','t','a','n','d'},
+    {'s','t','a','n','e'},
+    {'s','t','a','n','g'},
+    {'s','t','a','n','k'},
+    {'s','t','a','n','s'},
+    {'s','t','a','p','h'},
+    {'s','t','a','p','s'},
+    {'s','t','a','r','e'},
+    {'s','t','a','r','k'},
+    {'s','t','a','r','n'},
+    {'s','t','a','r','r'},
+    {'s','t','a','r','s'},
+    {'s','t','a','r','t'},
+    {'s','t','a','r','y'},
+    {'s','t','a','s','h'},
+    {'s','t','a','t','e'},
+    {'s','t','a','t','s'},
+    {'s','t','a','t','u'},
+    {'s','t','a','u','n'},
+    {'s','t','a','v','e'},
+    {'s','t','a','w','s'},
+    {'s','t','a','y','s'},
+    {'s','t','e','a','d'},
+    {'s','t','e','a','k'},
+    {'s','t','e','a','l'},
+    {'s','t','e','a','m'},
+    {'s','t','e','a','n'},
+    {'s','t','e','a','r'},
+    {'s','t','e','d','d'},
+    {'s','t','e','d','e'},
+    {'s','t','e','d','s'},
+    {'s','t','e','e','d'},
+    {'s','t','e','e','k'},
+    {'s','t','e','e','l'},
+    {'s','t','e','e','m'},
+    {'s','t','e','e','n'},
+    {'s','t','e','e','p'},
+    {'s','t','e','e','r'},
+    {'s','t','e','e','z'},
+    {'s','t','e','i','k'},
+    {'s','t','e','i','l'},
+    {'s','t','e','i','n'},
+    {'s','t','e','l','a'},
+    {'s','t','e','l','e'},
+    {'s','t','e','l','l'},
+    {'s','t','e','m','e'},
+    {'s','t','e','m','s'},
+    {'s','t','e','n','d'},
+    {'s','t','e','n','o'},
+    {'s','t','e','n','s'},
+    {'s','t','e','n','t'},
+    {'s','t','e','p','s'},
+    {'s','t','e','p','t'},
+    {'s','t','e','r','e'},
+    {'s','t','e','r','n'},
+    {'s','t','e','t','s'},
+    {'s','t','e','w','s'},
+    {'s','t','e','w','y'},
+    {'s','t','e','y','s'},
+    {'s','t','i','c','h'},
+    {'s','t','i','c','k'},
+    {'s','t','i','e','d'},
+    {'s','t','i','e','s'},
+    {'s','t','i','f','f'},
+    {'s','t','i','l','b'},
+    {'s','t','i','l','e'},
+    {'s','t','i','l','l'},
+    {'s','t','i','l','t'},
+    {'s','t','i','m','e'},
+    {'s','t','i','m','s'},
+    {'s','t','i','m','y'},
+    {'s','t','i','n','g'},
+    {'s','t','i','n','k'},
+    {'s','t','i','n','t'},
+    {'s','t','i','p','a'},
+    {'s','t','i','p','e'},
+    {'s','t','i','r','e'},
+    {'s','t','i','r','k'},
+    {'s','t','i','r','p'},
+    {'s','t','i','r','s'},
+    {'s','t','i','v','e'},
+    {'s','t','i','v','y'},
+    {'s','t','o','a','e'},
+    {'s','t','o','a','i'},
+    {'s','t','o','a','s'},
+    {'s','t','o','a','t'},
+    {'s','t','o','b','s'},
+    {'s','t','o','c','k'},
+    {'s','t','o','e','p'},
+    {'s','t','o','g','s'},
+    {'s','t','o','g','y'},
+    {'s','t','o','i','c'},
+    {'s','t','o','i','t'},
+    {'s','t','o','k','e'},
+    {'s','t','o','l','e'},
+    {'s','t','o','l','n'},
+    {'s','t','o','m','a'},
+    {'s','t','o','m','p'},
+    {'s','t','o','n','d'},
+    {'s','t','o','n','e'},
+    {'s','t','o','n','g'},
+    {'s','t','o','n','k'},
+    {'s','t','o','n','n'},
+    {'s','t','o','n','y'},
+    {'s','t','o','o','d'},
+    {'s','t','o','o','k'},
+    {'s','t','o','o','l'},
+    {'s','t','o','o','p'},
+    {'s','t','o','o','r'},
+    {'s','t','o','p','e'},
+    {'s','t','o','p','s'},
+    {'s','t','o','p','t'},
+    {'s','t','o','r','e'},
+    {'s','t','o','r','k'},
+    {'s','t','o','r','m'},
+    {'s','t','o','r','y'},
+    {'s','t','o','s','s'},
+    {'s','t','o','t','s'},
+    {'s','t','o','t','t'},
+    {'s','t','o','u','n'},
+    {'s','t','o','u','p'},
+    {'s','t','o','u','r'},
+    {'s','t','o','u','t'},
+    {'s','t','o','v','e'},
+    {'s','t','o','w','n'},
+    {'s','t','o','w','p'},
+    {'s','t','o','w','s'},
+    {'s','t','r','a','d'},
+    {'s','t','r','a','e'},
+    {'s','t','r','a','g'},
+    {'s','t','r','a','k'},
+    {'s','t','r','a','p'},
+    {'s','t','r','a','w'},
+    {'s','t','r','a','y'},
+    {'s','t','r','e','p'},
+    {'s','t','r','e','w'},
+    {'s','t','r','i','a'},
+    {'s','t','r','i','g'},
+    {'s','t','r','i','m'},
+    {'s','t','r','i','p'},
+    {'s','t','r','o','p'},
+    {'s','t','r','o','w'},
+    {'s','t','r','o','y'},
+    {'s','t','r','u','m'},
+    {'s','t','r','u','t'},
+    {'s','t','u','b','s'},
+    {'s','t','u','c','k'},
+    {'s','t','u','c','s'},
+    {'s','t','u','d','e'},
+    {'s','t','u','d','s'},
+    {'s','t','u','d','y'},
+    {'s','t','u','f','f'},
+    {'s','t','u','l','l'},
+    {'s','t','u','l','m'},
+    {'s','t','u','m','m'},
+    {'s','t','u','m','p'},
+    {'s','t','u','m','s'},
+    {'s','t','u','n','g'},
+    {'s','t','u','n','k'},
+    {'s','t','u','n','s'},
+    {'s','t','u','n','t'},
+    {'s','t','u','p','a'},
+    {'s','t','u','p','e'},
+    {'s','t','u','r','e'},
+    {'s','t','u','r','t'},
+    {'s','t','u','s','h'},
+    {'s','t','y','e','d'},
+    {'s','t','y','e','s'},
+    {'s','t','y','l','e'},
+    {'s','t','y','l','i'},
+    {'s','t','y','l','o'},
+    {'s','t','y','m','e'},
+    {'s','t','y','m','y'},
+    {'s','t','y','r','e'},
+    {'s','t','y','t','e'},
+    {'s','u','a','v','e'},
+    {'s','u','b','a','h'},
+    {'s','u','b','a','k'},
+    {'s','u','b','a','s'},
+    {'s','u','b','b','y'},
+    {'s','u','b','e','r'},
+    {'s','u','b','h','a'},
+    {'s','u','c','c','i'},
+    {'s','u','c','k','s'},
+    {'s','u','c','k','y'},
+    {'s','u','c','r','e'},
+    {'s','u','d','a','n'},
+    {'s','u','d','d','s'},
+    {'s','u','d','o','r'},
+    {'s','u','d','s','y'},
+    {'s','u','e','d','e'},
+    {'s','u','e','n','t'},
+    {'s','u','e','r','s'},
+    {'s','u','e','t','e'},
+    {'s','u','e','t','s'},
+    {'s','u','e','t','y'},
+    {'s','u','g','a','n'},
+    {'s','u','g','a','r'},
+    {'s','u','g','h','s'},
+    {'s','u','g','o','s'},
+    {'s','u','h','u','r'},
+    {'s','u','i','d','s'},
+    {'s','u','i','n','g'},
+    {'s','u','i','n','t'},
+    {'s','u','i','t','e'},
+    {'s','u','i','t','s'},
+    {'s','u','j','e','e'},
+    {'s','u','k','h','s'},
+    {'s','u','k','i','s'},
+    {'s','u','k','u','k'},
+    {'s','u','l','c','i'},
+    {'s','u','l','f','a'},
+    {'s','u','l','f','o'},
+    {'s','u','l','k','s'},
+    {'s','u','l','k','y'},
+    {'s','u','l','l','s'},
+    {'s','u','l','l','y'},
+    {'s','u','l','p','h'},
+    {'s','u','l','u','s'},
+    {'s','u','m','a','c'},
+    {'s','u','m','i','s'},
+    {'s','u','m','m','a'},
+    {'s','u','m','o','s'},
+    {'s','u','m','p','h'},
+    {'s','u','m','p','s'},
+    {'s','u','n','i','s'},
+    {'s','u','n','k','s'},
+    {'s','u','n','n','a'},
+    {'s','u','n','n','s'},
+    {'s','u','n','n','y'},
+    {'s','u','n','t','s'},
+    {'s','u','n','u','p'},
+    {'s','u','o','n','a'},
+    {'s','u','p','e','d'},
+    {'s','u','p','e','r'},
+    {'s','u','p','e','s'},
+    {'s','u','p','r','a'},
+    {'s','u','r','a','h'},
+    {'s','u','r','a','l'},
+    {'s','u','r','a','s'},
+    {'s','u','r','a','t'},
+    {'s','u','r','d','s'},
+    {'s','u','r','e','d'},
+    {'s','u','r','e','r'},
+    {'s','u','r','e','s'},
+    {'s','u','r','f','s'},
+    {'s','u','r','f','y'},
+    {'s','u','r','g','e'},
+    {'s','u','r','g','y'},
+    {'s','u','r','l','y'},
+    {'s','u','r','r','a'},
+    {'s','u','s','e','d'},
+    {'s','u','s','e','s'},
+    {'s','u','s','h','i'},
+    {'s','u','s','u','s'},
+    {'s','u','t','o','r'},
+    {'s','u','t','r','a'},
+    {'s','u','t','t','a'},
+    {'s','w','a','b','s'},
+    {'s','w','a','c','k'},
+    {'s','w','a','d','s'},
+    {'s','w','a','g','e'},
+    {'s','w','a','g','s'},
+    {'s','w','a','i','l'},
+    {'s','w','a','i','n'},
+    {'s','w','a','l','e'},
+    {'s','w','a','l','y'},
+    {'s','w','a','m','i'},
+    {'s','w','a','m','p'},
+    {'s','w','a','m','y'},
+    {'s','w','a','n','g'},
+    {'s','w','a','n','k'},
+    {'s','w','a','n','s'},
+    {'s','w','a','p','s'},
+    {'s','w','a','p','t'},
+    {'s','w','a','r','d'},
+    {'s','w','a','r','e'},
+    {'s','w','a','r','f'},
+    {'s','w','a','r','m'},
+    {'s','w','a','r','t'},
+    {'s','w','a','s','h'},
+    {'s','w','a','t','h'},
+    {'s','w','a','t','s'},
+    {'s','w','a','y','l'},
+    {'s','w','a','y','s'},
+    {'s','w','e','a','l'},
+    {'s','w','e','a','r'},
+    {'s','w','e','a','t'},
+    {'s','w','e','d','e'},
+    {'s','w','e','e','d'},
+    {'s','w','e','e','l'},
+    {'s','w','e','e','p'},
+    {'s','w','e','e','r'},
+    {'s','w','e','e','s'},
+    {'s','w','e','e','t'},
+    {'s','w','e','i','r'},
+    {'s','w','e','l','l'},
+    {'s','w','e','l','t'},
+    {'s','w','e','p','t'},
+    {'s','w','e','r','f'},
+    {'s','w','e','y','s'},
+    {'s','w','i','e','s'},
+    {'s','w','i','f','t'},
+    {'s','w','i','g','s'},
+    {'s','w','i','l','e'},
+    {'s','w','i','l','l'},
+    {'s','w','i','m','s'},
+    {'s','w','i','n','e'},
+    {'s','w','i','n','g'},
+    {'s','w','i','n','k'},
+    {'s','w','i','p','e'},
+    {'s','w','i','r','e'},
+    {'s','w','i','r','l'},
+    {'s','w','i','s','h'},
+    {'s','w','i','s','s'},
+    {'s','w','i','t','h'},
+    {'s','w','i','t','s'},
+    {'s','w','i','v','e'},
+    {'s','w','i','z','z'},
+    {'s','w','o','b','s'},
+    {'s','w','o','l','e'},
+    {'s','w','o','l','l'},
+    {'s','w','o','l','n'},
+    {'s','w','o','o','n'},
+    {'s','w','o','o','p'},
+    {'s','w','o','p','s'},
+    {'s','w','o','p','t'},
+    {'s','w','o','r','d'},
+    {'s','w','o','r','e'},
+    {'s','w','o','r','n'},
+    {'s','w','o','t','s'},
+    {'s','w','o','u','n'},
+    {'s','w','u','n','g'},
+    {'s','y','b','b','e'},
+    {'s','y','b','i','l'},
+    {'s','y','b','o','e'},
+    {'s','y','b','o','w'},
+    {'s','y','c','e','e'},
+    {'s','y','c','e','s'},
+    {'s','y','c','o','n'},
+    {'s','y','e','d','s'},
+    {'s','y','e','n','s'},
+    {'s','y','k','e','r'},
+    {'s','y','k','e','s'},
+    {'s','y','l','i','s'},
+    {'s','y','l','p','h'},
+    {'s','y','l','v','a'},
+    {'s','y','m','a','r'},
+    {'s','y','n','c','h'},
+    {'s','y','n','c','s'},
+    {'s','y','n','d','s'},
+    {'s','y','n','e','d'},
+    {'s','y','n','e','s'},
+    {'s','y','n','o','d'},
+    {'s','y','n','t','h'},
+    {'s','y','p','e','d'},
+    {'s','y','p','e','s'},
+    {'s','y','p','h','s'},
+    {'s','y','r','a','h'},
+    {'s','y','r','e','n'},
+    {'s','y','r','u','p'},
+    {'s','y','s','o','p'},
+    {'s','y','t','h','e'},
+    {'s','y','v','e','r'},
+    {'t','a','a','l','s'},
+    {'t','a','a','t','a'},
+    {'t','a','b','a','c'},
+    {'t','a','b','b','y'},
+    {'t','a','b','e','r'},
+    {'t','a','b','e','s'},
+    {'t','a','b','i','d'},
+    {'t','a','b','i','s'},
+    {'t','a','b','l','a'},
+    {'t','a','b','l','e'},
+    {'t','a','b','l','s'},
+    {'t','a','b','o','o'},
+    {'t','a','b','o','r'},
+    {'t','a','b','o','s'},
+    {'t','a','b','u','n'},
+    {'t','a','b','u','s'},
+    {'t','a','c','a','n'},
+    {'t','a','c','e','s'},
+    {'t','a','c','e','t'},
+    {'t','a','c','h','e'},
+    {'t','a','c','h','i'},
+    {'t','a','c','h','o'},
+    {'t','a','c','h','s'},
+    {'t','a','c','i','t'},
+    {'t','a','c','k','s'},
+    {'t','a','c','k','y'},
+    {'t','a','c','o','s'},
+    {'t','a','c','t','s'},
+    {'t','a','d','a','h'},
+    {'t','a','e','l','s'},
+    {'t','a','f','f','y'},
+    {'t','a','f','i','a'},
+    {'t','a','g','g','y'},
+    {'t','a','g','m','a'},
+    {'t','a','g','u','a'},
+    {'t','a','h','a','s'},
+    {'t','a','h','r','s'},
+    {'t','a','i','g','a'},
+    {'t','a','i','g','s'},
+    {'t','a','i','k','o'},
+    {'t','a','i','l','s'},
+    {'t','a','i','n','s'},
+    {'t','a','i','n','t'},
+    {'t','a','i','r','a'},
+    {'t','a','i','s','h'},
+    {'t','a','i','t','s'},
+    {'t','a','j','e','s'},
+    {'t','a','k','a','s'},
+    {'t','a','k','e','n'},
+    {'t','a','k','e','r'},
+    {'t','a','k','e','s'},
+    {'t','a','k','h','i'},
+    {'t','a','k','h','t'},
+    {'t','a','k','i','n'},
+    {'t','a','k','i','s'},
+    {'t','a','k','k','y'},
+    {'t','a','l','a','k'},
+    {'t','a','l','a','q'},
+    {'t','a','l','a','r'},
+    {'t','a','l','a','s'},
+    {'t','a','l','c','s'},
+    {'t','a','l','c','y'},
+    {'t','a','l','e','a'},
+    {'t','a','l','e','r'},
+    {'t','a','l','e','s'},
+    {'t','a','l','i','k'},
+    {'t','a','l','k','s'},
+    {'t','a','l','k','y'},
+    {'t','a','l','l','s'},
+    {'t','a','l','l','y'},
+    {'t','a','l','m','a'},
+    {'t','a','l','o','n'},
+    {'t','a','l','p','a'},
+    {'t','a','l','u','k'},
+    {'t','a','l','u','s'},
+    {'t','a','m','a','l'},
+    {'t','a','m','a','s'},
+    {'t','a','m','e','d'},
+    {'t','a','m','e','r'},
+    {'t','a','m','e','s'},
+    {'t','a','m','i','n'},
+    {'t','a','m','i','s'},
+    {'t','a','m','m','y'},
+    {'t','a','m','p','s'},
+    {'t','a','n','a','s'},
+    {'t','a','n','g','a'},
+    {'t','a','n','g','i'},
+    {'t','a','n','g','o'},
+    {'t','a','n','g','s'},
+    {'t','a','n','g','y'},
+    {'t','a','n','h','s'},
+    {'t','a','n','i','a'},
+    {'t','a','n','k','a'},
+    {'t','a','n','k','s'},
+    {'t','a','n','k','y'},
+    {'t','a','n','n','a'},
+    {'t','a','n','s','u'},
+    {'t','a','n','s','y'},
+    {'t','a','n','t','e'},
+    {'t','a','n','t','i'},
+    {'t','a','n','t','o'},
+    {'t','a','n','t','y'},
+    {'t','a','p','a','s'},
+    {'t','a','p','e','d'},
+    {'t','a','p','e','n'},
+    {'t','a','p','e','r'},
+    {'t','a','p','e','s'},
+    {'t','a','p','e','t'},
+    {'t','a','p','i','r'},
+    {'t','a','p','i','s'},
+    {'t','a','p','p','a'},
+    {'t','a','p','u','s'},
+    {'t','a','r','a','s'},
+    {'t','a','r','d','o'},
+    {'t','a','r','d','s'},
+    {'t','a','r','d','y'},
+    {'t','a','r','e','d'},
+    {'t','a','r','e','s'},
+    {'t','a','r','g','a'},
+    {'t','a','r','g','e'},
+    {'t','a','r','k','a'},
+    {'t','a','r','n','s'},
+    {'t','a','r','o','c'},
+    {'t','a','r','o','k'},
+    {'t','a','r','o','s'},
+    {'t','a','r','o','t'},
+    {'t','a','r','p','s'},
+    {'t','a','r','r','e'},
+    {'t','a','r','r','y'},
+    {'t','a','r','s','e'},
+    {'t','a','r','s','i'},
+    {'t','a','r','t','e'},
+    {'t','a','r','t','s'},
+    {'t','a','r','t','y'},
+    {'t','a','r','z','y'},
+    {'t','a','s','a','r'},
+    {'t','a','s','c','a'},
+    {'t','a','s','e','d'},
+    {'t','a','s','e','r'},
+    {'t','a','s','e','s'},
+    {'t','a','s','k','s'},
+    {'t','a','s','s','a'},
+    {'t','a','s','s','e'},
+    {'t','a','s','s','o'},
+    {'t','a','s','t','e'},
+    {'t','a','s','t','o'},
+    {'t','a','s','t','y'},
+    {'t','a','t','a','r'},
+    {'t','a','t','e','r'},
+    {'t','a','t','e','s'},
+    {'t','a','t','h','s'},
+    {'t','a','t','i','e'},
+    {'t','a','t','o','u'},
+    {'t','a','t','t','s'},
+    {'t','a','t','t','y'},
+    {'t','a','t','u','s'},
+    {'t','a','u','b','e'},
+    {'t','a','u','l','d'},
+    {'t','a','u','n','t'},
+    {'t','a','u','o','n'},
+    {'t','a','u','p','e'},
+    {'t','a','u','t','s'},
+    {'t','a','u','t','y'},
+    {'t','a','v','a','h'},
+    {'t','a','v','a','s'},
+    {'t','a','v','e','r'},
+    {'t','a','w','a','f'},
+    {'t','a','w','a','i'},
+    {'t','a','w','a','s'},
+    {'t','a','w','e','d'},
+    {'t','a','w','e','r'},
+    {'t','a','w','i','e'},
+    {'t','a','w','n','y'},
+    {'t','a','w','s','e'},
+    {'t','a','w','t','s'},
+    {'t','a','x','e','d'},
+    {'t','a','x','e','r'},
+    {'t','a','x','e','s'},
+    {'t','a','x','i','s'},
+    {'t','a','x','o','l'},
+    {'t','a','x','o','n'},
+    {'t','a','x','o','r'},
+    {'t','a','x','u','s'},
+    {'t','a','y','r','a'},
+    {'t','a','z','z','a'},
+    {'t','a','z','z','e'},
+    {'t','e','a','c','h'},
+    {'t','e','a','d','e'},
+    {'t','e','a','d','s'},
+    {'t','e','a','e','d'},
+    {'t','e','a','k','s'},
+    {'t','e','a','l','s'},
+    {'t','e','a','m','s'},
+    {'t','e','a','r','s'},
+    {'t','e','a','r','y'},
+    {'t','e','a','s','e'},
+    {'t','e','a','t','s'},
+    {'t','e','a','z','e'},
+    {'t','e','c','h','s'},
+    {'t','e','c','h','y'},
+    {'t','e','c','t','a'},
+    {'t','e','c','u','m'},
+    {'t','e','d','d','y'},
+    {'t','e','e','l','s'},
+    {'t','e','e','m','s'},
+    {'t','e','e','n','d'},
+    {'t','e','e','n','e'},
+    {'t','e','e','n','s'},
+    {'t','e','e','n','y'},
+    {'t','e','e','r','s'},
+    {'t','e','e','t','h'},
+    {'t','e','e','t','s'},
+    {'t','e','f','f','s'},
+    {'t','e','g','g','s'},
+    {'t','e','g','u','a'},
+    {'t','e','g','u','s'},
+    {'t','e','h','e','e'},
+    {'t','e','h','r','s'},
+    {'t','e','i','i','d'},
+    {'t','e','i','l','s'},
+    {'t','e','i','n','d'},
+    {'t','e','i','n','s'},
+    {'t','e','k','k','e'},
+    {'t','e','l','a','e'},
+    {'t','e','l','c','o'},
+    {'t','e','l','e','s'},
+    {'t','e','l','e','x'},
+    {'t','e','l','i','a'},
+    {'t','e','l','i','c'},
+    {'t','e','l','l','s'},
+    {'t','e','l','l','y'},
+    {'t','e','l','o','i'},
+    {'t','e','l','o','s'},
+    {'t','e','m','e','d'},
+    {'t','e','m','e','s'},
+    {'t','e','m','p','i'},
+    {'t','e','m','p','o'},
+    {'t','e','m','p','s'},
+    {'t','e','m','p','t'},
+    {'t','e','m','s','e'},
+    {'t','e','n','c','h'},
+    {'t','e','n','d','s'},
+    {'t','e','n','d','u'},
+    {'t','e','n','e','s'},
+    {'t','e','n','e','t'},
+    {'t','e','n','g','e'},
+    {'t','e','n','i','a'},
+    {'t','e','n','n','e'},
+    {'t','e','n','n','o'},
+    {'t','e','n','n','y'},
+    {'t','e','n','o','n'},
+    {'t','e','n','o','r'},
+    {'t','e','n','s','e'},
+    {'t','e','n','t','h'},
+    {'t','e','n','t','s'},
+    {'t','e','n','t','y'},
+    {'t','e','n','u','e'},
+    {'t','e','p','a','l'},
+    {'t','e','p','a','s'},
+    {'t','e','p','e','e'},
+    {'t','e','p','i','d'},
+    {'t','e','p','o','y'},
+    {'t','e','r','a','i'},
+    {'t','e','r','a','s'},
+    {'t','e','r','c','e'},
+    {'t','e','r','e','k'},
+    {'t','e','r','e','s'},
+    {'t','e','r','f','e'},
+    {'t','e','r','f','s'},
+    {'t','e','r','g','a'},
+    {'t','e','r','m','s'},
+    {'t','e','r','n','e'},
+    {'t','e','r','n','s'},
+    {'t','e','r','r','a'},
+    {'t','e','r','r','e'},
+    {'t','e','r','r','y'},
+    {'t','e','r','s','e'},
+    {'t','e','r','t','s'},
+    {'t','e','r','z','a'},
+    {'t','e','s','l','a'},
+    {'t','e','s','t','a'},
+    {'t','e','s','t','e'},
+    {'t','e','s','t','s'},
+    {'t','e','s','t','y'},
+    {'t','e','t','e','s'},
+    {'t','e','t','h','s'},
+    {'t','e','t','r','a'},
+    {'t','e','t','r','i'},
+    {'t','e','u','c','h'},
+    {'t','e','u','g','h'},
+    {'t','e','w','e','d'},
+    {'t','e','w','e','l'},
+    {'t','e','w','i','t'},
+    {'t','e','x','a','s'},
+    {'t','e','x','e','s'},
+    {'t','e','x','t','a'},
+    {'t','e','x','t','s'},
+    {'t','h','a','c','k'},
+    {'t','h','a','g','i'},
+    {'t','h','a','i','m'},
+    {'t','h','a','l','e'},
+    {'t','h','a','l','i'},
+    {'t','h','a','n','a'},
+    {'t','h','a','n','e'},
+    {'t','h','a','n','g'},
+    {'t','h','a','n','k'},
+    {'t','h','a','n','s'},
+    {'t','h','a','n','x'},
+    {'t','h','a','r','m'},
+    {'t','h','a','r','s'},
+    {'t','h','a','w','s'},
+    {'t','h','a','w','t'},
+    {'t','h','a','w','y'},
+    {'t','h','e','b','e'},
+    {'t','h','e','c','a'},
+    {'t','h','e','e','d'},
+    {'t','h','e','e','k'},
+    {'t','h','e','e','s'},
+    {'t','h','e','f','t'},
+    {'t','h','e','g','n'},
+    {'t','h','e','i','c'},
+    {'t','h','e','i','n'},
+    {'t','h','e','i','r'},
+    {'t','h','e','l','f'},
+    {'t','h','e','m','a'},
+    {'t','h','e','m','e'},
+    {'t','h','e','n','s'},
+    {'t','h','e','o','r'},
+    {'t','h','e','o','w'},
+    {'t','h','e','r','e'},
+    {'t','h','e','r','m'},
+    {'t','h','e','s','e'},
+    {'t','h','e','s','p'},
+    {'t','h','e','t','a'},
+    {'t','h','e','t','e'},
+    {'t','h','e','w','s'},
+    {'t','h','e','w','y'},
+    {'t','h','i','c','k'},
+    {'t','h','i','e','f'},
+    {'t','h','i','g','h'},
+    {'t','h','i','g','s'},
+    {'t','h','i','l','k'},
+    {'t','h','i','l','l'},
+    {'t','h','i','n','e'},
+    {'t','h','i','n','g'},
+    {'t','h','i','n','k'},
+    {'t','h','i','n','s'},
+    {'t','h','i','o','l'},
+    {'t','h','i','r','d'},
+    {'t','h','i','r','l'},
+    {'t','h','o','f','t'},
+    {'t','h','o','l','e'},
+    {'t','h','o','l','i'},
+    {'t','h','o','n','g'},
+    {'t','h','o','r','n'},
+    {'t','h','o','r','o'},
+    {'t','h','o','r','p'},
+    {'t','h','o','s','e'},
+    {'t','h','o','t','s'},
+    {'t','h','o','u','s'},
+    {'t','h','o','w','l'},
+    {'t','h','r','a','e'},
+    {'t','h','r','a','w'},
+    {'t','h','r','e','e'},
+    {'t','h','r','e','w'},
+    {'t','h','r','i','d'},
+    {'t','h','r','i','p'},
+    {'t','h','r','o','b'},
+    {'t','h','r','o','e'},
+    {'t','h','r','o','w'},
+    {'t','h','r','u','m'},
+    {'t','h','u','d','s'},
+    {'t','h','u','g','s'},
+    {'t','h','u','j','a'},
+    {'t','h','u','m','b'},
+    {'t','h','u','m','p'},
+    {'t','h','u','n','k'},
+    {'t','h','u','r','l'},
+    {'t','h','u','y','a'},
+    {'t','h','y','m','e'},
+    {'t','h','y','m','i'},
+    {'t','h','y','m','y'},
+    {'t','i','a','n','s'},
+    {'t','i','a','r','a'},
+    {'t','i','a','r','e'},
+    {'t','i','a','r','s'},
+    {'t','i','b','i','a'},
+    {'t','i','c','a','l'},
+    {'t','i','c','c','a'},
+    {'t','i','c','e','d'},
+    {'t','i','c','e','s'},
+    {'t','i','c','h','y'},
+    {'t','i','c','k','s'},
+    {'t','i','c','k','y'},
+    {'t','i','d','a','l'},
+    {'t','i','d','d','y'},
+    {'t','i','d','e','d'},
+    {'t','i','d','e','s'},
+    {'t','i','e','f','s'},
+    {'t','i','e','r','s'},
+    {'t','i','f','f','s'},
+    {'t','i','f','o','s'},
+    {'t','i','f','t','s'},
+    {'t','i','g','e','r'},
+    {'t','i','g','e','s'},
+    {'t','i','g','h','t'},
+    {'t','i','g','o','n'},
+    {'t','i','k','a','s'},
+    {'t','i','k','e','s'},
+    {'t','i','k','i','a'},
+    {'t','i','k','i','s'},
+    {'t','i','k','k','a'},
+    {'t','i','l','a','k'},
+    {'t','i','l','d','e'},
+    {'t','i','l','e','d'},
+    {'t','i','l','e','r'},
+    {'t','i','l','e','s'},
+    {'t','i','l','l','s'},
+    {'t','i','l','l','y'},
+    {'t','i','l','t','h'},
+    {'t','i','l','t','s'},
+    {'t','i','m','b','o'},
+    {'t','i','m','e','d'},
+    {'t','i','m','e','r'},
+    {'t','i','m','e','s'},
+    {'t','i','m','i','d'},
+    {'t','i','m','o','n'},
+    {'t','i','m','p','s'},
+    {'t','i','n','a','s'},
+    {'t','i','n','c','t'},
+    {'t','i','n','d','s'},
+    {'t','i','n','e','a'},
+    {'t','i','n','e','d'},
+    {'t','i','n','e','s'},
+    {'t','i','n','g','e'},
+    {'t','i','n','g','s'},
+    {'t','i','n','k','s'},
+    {'t','i','n','n','y'},
+    {'t','i','n','t','o'},
+    {'t','i','n','t','s'},
+    {'t','i','n','t','y'},
+    {'t','i','p','i','s'},
+    {'t','i','p','p','y'},
+    {'t','i','p','s','y'},
+    {'t','i','p','u','p'},
+    {'t','i','r','e','d'},
+    {'t','i','r','e','s'},
+    {'t','i','r','l','s'},
+    {'t','i','r','o','s'},
+    {'t','i','r','r','s'},
+    {'t','i','r','t','h'},
+    {'t','i','t','a','n'},
+    {'t','i','t','a','r'},
+    {'t','i','t','a','s'},
+    {'t','i','t','c','h'},
+    {'t','i','t','e','r'},
+    {'t','i','t','h','e'},
+    {'t','i','t','h','i'},
+    {'t','i','t','i','n'},
+    {'t','i','t','i','r'},
+    {'t','i','t','i','s'},
+    {'t','i','t','l','e'},
+    {'t','i','t','r','e'},
+    {'t','i','t','t','y'},
+    {'t','i','t','u','p'},
+    {'t','i','y','i','n'},
+    {'t','i','y','n','s'},
+    {'t','i','z','e','s'},
+    {'t','i','z','z','y'},
+    {'t','o','a','d','s'},
+    {'t','o','a','d','y'},
+    {'t','o','a','s','t'},
+    {'t','o','a','z','e'},
+    {'t','o','c','k','s'},
+    {'t','o','c','k','y'},
+    {'t','o','c','o','s'},
+    {'t','o','d','a','y'},
+    {'t','o','d','d','e'},
+    {'t','o','d','d','y'},
+    {'t','o','d','e','a'},
+    {'t','o','d','o','s'},
+    {'t','o','e','a','s'},
+    {'t','o','f','f','s'},
+    {'t','o','f','f','y'},
+    {'t','o','f','t','s'},
+    {'t','o','f','u','s'},
+    {'t','o','g','a','e'},
+    {'t','o','g','a','s'},
+    {'t','o','g','e','d'},
+    {'t','o','g','e','s'},
+    {'t','o','g','u','e'},
+    {'t','o','h','o','s'},
+    {'t','o','i','d','y'},
+    {'t','o','i','l','e'},
+    {'t','o','i','l','s'},
+    {'t','o','i','n','g'},
+    {'t','o','i','s','e'},
+    {'t','o','i','t','s'},
+    {'t','o','i','t','y'},
+    {'t','o','k','a','y'},
+    {'t','o','k','e','d'},
+    {'t','o','k','e','n'},
+    {'t','o','k','e','r'},
+    {'t','o','k','e','s'},
+    {'t','o','k','o','s'},
+    {'t','o','l','a','n'},
+    {'t','o','l','a','r'},
+    {'t','o','l','a','s'},
+    {'t','o','l','e','d'},
+    {'t','o','l','e','s'},
+    {'t','o','l','l','s'},
+    {'t','o','l','l','y'},
+    {'t','o','l','t','s'},
+    {'t','o','l','u','s'},
+    {'t','o','l','y','l'},
+    {'t','o','m','a','n'},
+    {'t','o','m','b','o'},
+    {'t','o','m','b','s'},
+    {'t','o','m','e','n'},
+    {'t','o','m','e','s'},
+    {'t','o','m','i','a'},
+    {'t','o','m','i','n'},
+    {'t','o','m','m','e'},
+    {'t','o','m','m','y'},
+    {'t','o','m','o','s'},
+    {'t','o','m','o','z'},
+    {'t','o','n','a','l'},
+    {'t','o','n','d','i'},
+    {'t','o','n','d','o'},
+    {'t','o','n','e','d'},
+    {'t','o','n','e','r'},
+    {'t','o','n','e','s'},
+    {'t','o','n','e','y'},
+    {'t','o','n','g','a'},
+    {'t','o','n','g','s'},
+    {'t','o','n','i','c'},
+    {'t','o','n','k','a'},
+    {'t','o','n','k','s'},
+    {'t','o','n','n','e'},
+    {'t','o','n','u','s'},
+    {'t','o','o','l','s'},
+    {'t','o','o','m','s'},
+    {'t','o','o','n','s'},
+    {'t','o','o','t','h'},
+    {'t','o','o','t','s'},
+    {'t','o','p','a','z'},
+    {'t','o','p','e','d'},
+    {'t','o','p','e','e'},
+    {'t','o','p','e','k'},
+    {'t','o','p','e','r'},
+    {'t','o','p','e','s'},
+    {'t','o','p','h','e'},
+    {'t','o','p','h','i'},
+    {'t','o','p','h','s'},
+    {'t','o','p','i','c'},
+    {'t','o','p','i','s'},
+    {'t','o','p','o','i'},
+    {'t','o','p','o','s'},
+    {'t','o','p','p','y'},
+    {'t','o','q','u','e'},
+    {'t','o','r','a','h'},
+    {'t','o','r','a','n'},
+    {'t','o','r','a','s'},
+    {'t','o','r','c','h'},
+    {'t','o','r','c','s'},
+    {'t','o','r','e','s'},
+    {'t','o','r','i','c'},
+    {'t','o','r','i','i'},
+    {'t','o','r','o','s'},
+    {'t','o','r','o','t'},
+    {'t','o','r','r','s'},
+    {'t','o','r','s','e'},
+    {'t','o','r','s','i'},
+    {'t','o','r','s','k'},
+    {'t','o','r','s','o'},
+    {'t','o','r','t','a'},
+    {'t','o','r','t','e'},
+    {'t','o','r','t','s'},
+    {'t','o','r','u','s'},
+    {'t','o','s','a','s'},
+    {'t','o','s','e','d'},
+    {'t','o','s','e','s'},
+    {'t','o','s','h','y'},
+    {'t','o','s','s','y'},
+    {'t','o','s','y','l'},
+    {'t','o','t','a','l'},
+    {'t','o','t','e','d'},
+    {'t','o','t','e','m'},
+    {'t','o','t','e','r'},
+    {'t','o','t','e','s'},
+    {'t','o','t','t','y'},
+    {'t','o','u','c','h'},
+    {'t','o','u','g','h'},
+    {'t','o','u','k','s'},
+    {'t','o','u','n','s'},
+    {'t','o','u','r','s'},
+    {'t','o','u','s','e'},
+    {'t','o','u','s','y'},
+    {'t','o','u','t','s'},
+    {'t','o','u','z','e'},
+    {'t','o','u','z','y'},
+    {'t','o','w','a','i'},
+    {'t','o','w','e','d'},
+    {'t','o','w','e','l'},
+    {'t','o','w','e','r'},
+    {'t','o','w','i','e'},
+    {'t','o','w','n','o'},
+    {'t','o','w','n','s'},
+    {'t','o','w','n','y'},
+    {'t','o','w','s','e'},
+    {'t','o','w','s','y'},
+    {'t','o','w','t','s'},
+    {'t','o','w','z','e'},
+    {'t','o','w','z','y'},
+    {'t','o','x','i','c'},
+    {'t','o','x','i','n'},
+    {'t','o','y','e','d'},
+    {'t','o','y','e','r'},
+    {'t','o','y','o','n'},
+    {'t','o','y','o','s'},
+    {'t','o','z','e','d'},
+    {'t','o','z','e','s'},
+    {'t','o','z','i','e'},
+    {'t','r','a','b','s'},
+    {'t','r','a','c','e'},
+    {'t','r','a','c','k'},
+    {'t','r','a','c','t'},
+    {'t','r','a','d','e'},
+    {'t','r','a','d','s'},
+    {'t','r','a','d','y'},
+    {'t','r','a','g','a'},
+    {'t','r','a','g','i'},
+    {'t','r','a','g','s'},
+    {'t','r','a','g','u'},
+    {'t','r','a','i','k'},
+    {'t','r','a','i','l'},
+    {'t','r','a','i','n'},
+    {'t','r','a','i','t'},
+    {'t','r','a','m','p'},
+    {'t','r','a','m','s'},
+    {'t','r','a','n','k'},
+    {'t','r','a','n','q'},
+    {'t','r','a','n','s'},
+    {'t','r','a','n','t'},
+    {'t','r','a','p','e'},
+    {'t','r','a','p','o'},
+    {'t','r','a','p','s'},
+    {'t','r','a','p','t'},
+    {'t','r','a','s','h'},
+    {'t','r','a','s','s'},
+    {'t','r','a','t','s'},
+    {'t','r','a','t','t'},
+    {'t','r','a','v','e'},
+    {'t','r','a','w','l'},
+    {'t','r','a','y','f'},
+    {'t','r','a','y','s'},
+    {'t','r','e','a','d'},
+    {'t','r','e','a','t'},
+    {'t','r','e','c','k'},
+    {'t','r','e','e','d'},
+    {'t','r','e','e','n'},
+    {'t','r','e','e','s'},
+    {'t','r','e','f','a'},
+    {'t','r','e','i','f'},
+    {'t','r','e','k','s'},
+    {'t','r','e','m','a'},
+    {'t','r','e','m','s'},
+    {'t','r','e','n','d'},
+    {'t','r','e','s','s'},
+    {'t','r','e','s','t'},
+    {'t','r','e','t','s'},
+    {'t','r','e','w','s'},
+    {'t','r','e','y','f'},
+    {'t','r','e','y','s'},
+    {'t','r','i','a','c'},
+    {'t','r','i','a','d'},
+    {'t','r','i','a','l'},
+    {'t','r','i','b','e'},
+    {'t','r','i','c','e'},
+    {'t','r','i','c','k'},
+    {'t','r','i','d','e'},
+    {'t','r','i','e','d'},
+    {'t','r','i','e','r'},
+    {'t','r','i','e','s'},
+    {'t','r','i','f','a'},
+    {'t','r','i','f','f'},
+    {'t','r','i','g','o'},
+    {'t','r','i','g','s'},
+    {'t','r','i','k','e'},
+    {'t','r','i','l','d'},
+    {'t','r','i','l','l'},
+    {'t','r','i','m','s'},
+    {'t','r','i','n','e'},
+    {'t','r','i','n','s'},
+    {'t','r','i','o','l'},
+    {'t','r','i','o','r'},
+    {'t','r','i','o','s'},
+    {'t','r','i','p','e'},
+    {'t','r','i','p','s'},
+    {'t','r','i','p','y'},
+    {'t','r','i','s','t'},
+    {'t','r','i','t','e'},
+    {'t','r','o','a','d'},
+    {'t','r','o','a','k'},
+    {'t','r','o','a','t'},
+    {'t','r','o','c','k'},
+    {'t','r','o','d','e'},
+    {'t','r','o','d','s'},
+    {'t','r','o','g','s'},
+    {'t','r','o','i','s'},
+    {'t','r','o','k','e'},
+    {'t','r','o','l','l'},
+    {'t','r','o','m','p'},
+    {'t','r','o','n','a'},
+    {'t','r','o','n','c'},
+    {'t','r','o','n','e'},
+    {'t','r','o','n','k'},
+    {'t','r','o','n','s'},
+    {'t','r','o','o','p'},
+    {'t','r','o','o','z'},
+    {'t','r','o','p','e'},
+    {'t','r','o','p','o'},
+    {'t','r','o','t','h'},
+    {'t','r','o','t','s'},
+    {'t','r','o','u','t'},
+    {'t','r','o','v','e'},
+    {'t','r','o','w','s'},
+    {'t','r','o','y','s'},
+    {'t','r','u','c','e'},
+    {'t','r','u','c','k'},
+    {'t','r','u','e','d'},
+    {'t','r','u','e','r'},
+    {'t','r','u','e','s'},
+    {'t','r','u','g','o'},
+    {'t','r','u','g','s'},
+    {'t','r','u','l','l'},
+    {'t','r','u','l','y'},
+    {'t','r','u','m','p'},
+    {'t','r','u','n','k'},
+    {'t','r','u','s','s'},
+    {'t','r','u','s','t'},
+    {'t','r','u','t','h'},
+    {'t','r','y','e','r'},
+    {'t','r','y','k','e'},
+    {'t','r','y','m','a'},
+    {'t','r','y','p','s'},
+    {'t','r','y','s','t'},
+    {'t','s','a','d','e'},
+    {'t','s','a','d','i'},
+    {'t','s','a','r','s'},
+    {'t','s','k','e','d'},
+    {'t','s','u','b','a'},
+    {'t','s','u','b','o'},
+    {'t','u','a','n','s'},
+    {'t','u','a','r','t'},
+    {'t','u','a','t','h'},
+    {'t','u','b','a','e'},
+    {'t','u','b','a','l'},
+    {'t','u','b','a','r'},
+    {'t','u','b','a','s'},
+    {'t','u','b','b','y'},
+    {'t','u','b','e','d'},
+    {'t','u','b','e','r'},
+    {'t','u','b','e','s'},
+    {'t','u','c','k','s'},
+    {'t','u','f','a','s'},
+    {'t','u','f','f','e'},
+    {'t','u','f','f','s'},
+    {'t','u','f','t','s'},
+    {'t','u','f','t','y'},
+    {'t','u','g','r','a'},
+    {'t','u','i','l','e'},
+    {'t','u','i','n','a'},
+    {'t','u','i','s','m'},
+    {'t','u','k','t','u'},
+    {'t','u','l','e','s'},
+    {'t','u','l','i','p'},
+    {'t','u','l','l','e'},
+    {'t','u','l','p','a'},
+    {'t','u','l','p','s'},
+    {'t','u','l','s','i'},
+    {'t','u','m','i','d'},
+    {'t','u','m','m','y'},
+    {'t','u','m','o','r'},
+    {'t','u','m','p','s'},
+    {'t','u','m','p','y'},
+    {'t','u','n','a','s'},
+    {'t','u','n','d','s'},
+    {'t','u','n','e','d'},
+    {'t','u','n','e','r'},
+    {'t','u','n','e','s'},
+    {'t','u','n','g','s'},
+    {'t','u','n','i','c'},
+    {'t','u','n','n','y'},
+    {'t','u','p','e','k'},
+    {'t','u','p','i','k'},
+    {'t','u','p','l','e'},
+    {'t','u','q','u','e'},
+    {'t','u','r','b','o'},
+    {'t','u','r','d','s'},
+    {'t','u','r','f','s'},
+    {'t','u','r','f','y'},
+    {'t','u','r','k','s'},
+    {'t','u','r','m','e'},
+    {'t','u','r','m','s'},
+    {'t','u','r','n','s'},
+    {'t','u','r','n','t'},
+    {'t','u','r','o','n'},
+    {'t','u','r','p','s'},
+    {'t','u','r','r','s'},
+    {'t','u','s','h','y'},
+    {'t','u','s','k','s'},
+    {'t','u','s','k','y'},
+    {'t','u','t','e','e'},
+    {'t','u','t','e','s'},
+    {'t','u','t','o','r'},
+    {'t','u','t','t','i'},
+    {'t','u','t','t','y'},
+    {'t','u','t','u','s'},
+    {'t','u','x','e','s'},
+    {'t','u','y','e','r'},
+    {'t','w','a','e','s'},
+    {'t','w','a','i','n'},
+    {'t','w','a','l','s'},
+    {'t','w','a','n','g'},
+    {'t','w','a','n','k'},
+    {'t','w','a','t','s'},
+    {'t','w','a','y','s'},
+    {'t','w','e','a','k'},
+    {'t','w','e','e','d'},
+    {'t','w','e','e','l'},
+    {'t','w','e','e','n'},
+    {'t','w','e','e','p'},
+    {'t','w','e','e','r'},
+    {'t','w','e','e','t'},
+    {'t','w','e','r','k'},
+    {'t','w','e','r','p'},
+    {'t','w','i','c','e'},
+    {'t','w','i','e','r'},
+    {'t','w','i','g','s'},
+    {'t','w','i','l','l'},
+    {'t','w','i','l','t'},
+    {'t','w','i','n','e'},
+    {'t','w','i','n','k'},
+    {'t','w','i','n','s'},
+    {'t','w','i','n','y'},
+    {'t','w','i','r','e'},
+    {'t','w','i','r','k'},
+    {'t','w','i','r','l'},
+    {'t','w','i','r','p'},
+    {'t','w','i','s','t'},
+    {'t','w','i','t','e'},
+    {'t','w','i','t','s'},
+    {'t','w','i','x','t'},
+    {'t','w','o','c','s'},
+    {'t','w','o','e','r'},
+    {'t','w','o','n','k'},
+    {'t','w','y','e','r'},
+    {'t','y','e','e','s'},
+    {'t','y','e','r','s'},
+    {'t','y','i','n','g'},
+    {'t','y','i','y','n'},
+    {'t','y','k','e','s'},
+    {'t','y','l','e','r'},
+    {'t','y','m','p','s'},
+    {'t','y','n','d','e'},
+    {'t','y','n','e','d'},
+    {'t','y','n','e','s'},
+    {'t','y','p','a','l'},
+    {'t','y','p','e','d'},
+    {'t','y','p','e','s'},
+    {'t','y','p','e','y'},
+    {'t','y','p','i','c'},
+    {'t','y','p','o','s'},
+    {'t','y','p','p','s'},
+    {'t','y','p','t','o'},
+    {'t','y','r','a','n'},
+    {'t','y','r','e','d'},
+    {'t','y','r','e','s'},
+    {'t','y','r','o','s'},
+    {'t','y','t','h','e'},
+    {'t','z','a','r','s'},
+    {'u','b','a','c','s'},
+    {'u','b','i','t','y'},
+    {'u','d','a','l','s'},
+    {'u','d','d','e','r'},
+    {'u','d','o','n','s'},
+    {'u','d','y','o','g'},
+    {'u','g','a','l','i'},
+    {'u','g','g','e','d'},
+    {'u','h','l','a','n'},
+    {'u','h','u','r','u'},
+    {'u','k','a','s','e'},
+    {'u','l','a','m','a'},
+    {'u','l','a','n','s'},
+    {'u','l','c','e','r'},
+    {'u','l','e','m','a'},
+    {'u','l','m','i','n'},
+    {'u','l','m','o','s'},
+    {'u','l','n','a','d'},
+    {'u','l','n','a','e'},
+    {'u','l','n','a','r'},
+    {'u','l','n','a','s'},
+    {'u','l','p','a','n'},
+    {'u','l','t','r','a'},
+    {'u','l','v','a','s'},
+    {'u','l','y','i','e'},
+    {'u','l','z','i','e'},
+    {'u','m','a','m','i'},
+    {'u','m','b','e','l'},
+    {'u','m','b','e','r'},
+    {'u','m','b','l','e'},
+    {'u','m','b','o','s'},
+    {'u','m','b','r','a'},
+    {'u','m','b','r','e'},
+    {'u','m','i','a','c'},
+    {'u','m','i','a','k'},
+    {'u','m','i','a','q'},
+    {'u','m','m','a','h'},
+    {'u','m','m','a','s'},
+    {'u','m','m','e','d'},
+    {'u','m','p','e','d'},
+    {'u','m','p','h','s'},
+    {'u','m','p','i','e'},
+    {'u','m','p','t','y'},
+    {'u','m','r','a','h'},
+    {'u','m','r','a','s'},
+    {'u','n','a','g','i'},
+    {'u','n','a','i','s'},
+    {'u','n','a','p','t'},
+    {'u','n','a','r','m'},
+    {'u','n','a','r','y'},
+    {'u','n','a','u','s'},
+    {'u','n','b','a','g'},
+    {'u','n','b','a','n'},
+    {'u','n','b','a','r'},
+    {'u','n','b','e','d'},
+    {'u','n','b','i','d'},
+    {'u','n','b','o','x'},
+    {'u','n','c','a','p'},
+    {'u','n','c','e','s'},
+    {'u','n','c','i','a'},
+    {'u','n','c','l','e'},
+    {'u','n','c','o','s'},
+    {'u','n','c','o','y'},
+    {'u','n','c','u','s'},
+    {'u','n','c','u','t'},
+    {'u','n','d','a','m'},
+    {'u','n','d','e','e'},
+    {'u','n','d','e','r'},
+    {'u','n','d','i','d'},
+    {'u','n','d','o','s'},
+    {'u','n','d','u','e'},
+    {'u','n','d','u','g'},
+    {'u','n','e','t','h'},
+    {'u','n','f','e','d'},
+    {'u','n','f','i','t'},
+    {'u','n','f','i','x'},
+    {'u','n','g','a','g'},
+    {'u','n','g','e','t'},
+    {'u','n','g','o','d'},
+    {'u','n','g','o','t'},
+    {'u','n','g','u','m'},
+    {'u','n','h','a','t'},
+    {'u','n','h','i','p'},
+    {'u','n','i','c','a'},
+    {'u','n','i','f','y'},
+    {'u','n','i','o','n'},
+    {'u','n','i','o','s'},
+    {'u','n','i','t','e'},
+    {'u','n','i','t','s'},
+    {'u','n','i','t','y'},
+    {'u','n','j','a','m'},
+    {'u','n','k','e','d'},
+    {'u','n','k','e','t'},
+    {'u','n','k','e','y'},
+    {'u','n','k','i','d'},
+    {'u','n','k','u','t'},
+    {'u','n','l','a','p'},
+    {'u','n','l','a','w'},
+    {'u','n','l','a','y'},
+    {'u','n','l','e','d'},
+    {'u','n','l','e','g'},
+    {'u','n','l','e','t'},
+    {'u','n','l','i','d'},
+    {'u','n','l','i','t'},
+    {'u','n','m','a','d'},
+    {'u','n','m','a','n'},
+    {'u','n','m','e','t'},
+    {'u','n','m','e','w'},
+    {'u','n','m','i','x'},
+    {'u','n','o','d','e'},
+    {'u','n','o','l','d'},
+    {'u','n','o','w','n'},
+    {'u','n','p','a','y'},
+    {'u','n','p','e','g'},
+    {'u','n','p','e','n'},
+    {'u','n','p','i','n'},
+    {'u','n','p','l','y'},
+    {'u','n','p','o','t'},
+    {'u','n','p','u','t'},
+    {'u','n','r','e','d'},
+    {'u','n','r','i','d'},
+    {'u','n','r','i','g'},
+    {'u','n','r','i','p'},
+    {'u','n','s','a','w'},
+    {'u','n','s','a','y'},
+    {'u','n','s','e','e'},
+    {'u','n','s','e','t'},
+    {'u','n','s','e','w'},
+    {'u','n','s','e','x'},
+    {'u','n','s','o','d'},
+    {'u','n','s','u','b'},
+    {'u','n','t','a','g'},
+    {'u','n','t','a','x'},
+    {'u','n','t','i','e'},
+    {'u','n','t','i','l'},
+    {'u','n','t','i','n'},
+    {'u','n','w','e','d'},
+    {'u','n','w','e','t'},
+    {'u','n','w','i','t'},
+    {'u','n','w','o','n'},
+    {'u','n','z','i','p'},
+    {'u','p','b','o','w'},
+    {'u','p','b','y','e'},
+    {'u','p','d','o','s'},
+    {'u','p','d','r','y'},
+    {'u','p','e','n','d'},
+    {'u','p','f','u','l'},
+    {'u','p','j','e','t'},
+    {'u','p','l','a','y'},
+    {'u','p','l','e','d'},
+    {'u','p','l','i','t'},
+    {'u','p','p','e','d'},
+    {'u','p','p','e','r'},
+    {'u','p','r','a','n'},
+    {'u','p','r','u','n'},
+    {'u','p','s','e','e'},
+    {'u','p','s','e','t'},
+    {'u','p','s','e','y'},
+    {'u','p','t','a','k'},
+    {'u','p','t','e','r'},
+    {'u','p','t','i','e'},
+    {'u','r','a','e','i'},
+    {'u','r','a','l','i'},
+    {'u','r','a','o','s'},
+    {'u','r','a','r','e'},
+    {'u','r','a','r','i'},
+    {'u','r','a','s','e'},
+    {'u','r','a','t','e'},
+    {'u','r','b','a','n'},
+    {'u','r','b','e','x'},
+    {'u','r','b','i','a'},
+    {'u','r','d','e','e'},
+    {'u','r','e','a','l'},
+    {'u','r','e','a','s'},
+    {'u','r','e','d','o'},
+    {'u','r','e','i','c'},
+    {'u','r','e','i','d'},
+    {'u','r','e','n','a'},
+    {'u','r','e','n','t'},
+    {'u','r','g','e','d'},
+    {'u','r','g','e','r'},
+    {'u','r','g','e','s'},
+    {'u','r','i','a','l'},
+    {'u','r','i','n','e'},
+    {'u','r','i','t','e'},
+    {'u','r','m','a','n'},
+    {'u','r','n','a','l'},
+    {'u','r','n','e','d'},
+    {'u','r','p','e','d'},
+    {'u','r','s','a','e'},
+    {'u','r','s','i','d'},
+    {'u','r','s','o','n'},
+    {'u','r','u','b','u'},
+    {'u','r','u','p','a'},
+    {'u','r','v','a','s'},
+    {'u','s','a','g','e'},
+    {'u','s','e','n','s'},
+    {'u','s','e','r','s'},
+    {'u','s','e','t','a'},
+    {'u','s','h','e','r'},
+    {'u','s','i','n','g'},
+    {'u','s','n','e','a'},
+    {'u','s','n','i','c'},
+    {'u','s','q','u','e'},
+    {'u','s','t','a','d'},
+    {'u','s','t','e','r'},
+    {'u','s','u','a','l'},
+    {'u','s','u','r','e'},
+    {'u','s','u','r','p'},
+    {'u','s','u','r','y'},
+    {'u','t','e','r','i'},
+    {'u','t','e','r','o'},
+    {'u','t','i','l','e'},
+    {'u','t','t','e','r'},
+    {'u','v','e','a','l'},
+    {'u','v','e','a','s'},
+    {'u','v','u','l','a'},
+    {'v','a','c','a','s'},
+    {'v','a','c','a','y'},
+    {'v','a','c','u','a'},
+    {'v','a','c','u','i'},
+    {'v','a','c','u','o'},
+    {'v','a','d','a','s'},
+    {'v','a','d','e','d'},
+    {'v','a','d','e','s'},
+    {'v','a','d','g','e'},
+    {'v','a','g','a','l'},
+    {'v','a','g','u','e'},
+    {'v','a','g','u','s'},
+    {'v','a','i','d','s'},
+    {'v','a','i','l','s'},
+    {'v','a','i','r','e'},
+    {'v','a','i','r','s'},
+    {'v','a','i','r','y'},
+    {'v','a','j','r','a'},
+    {'v','a','k','a','s'},
+    {'v','a','k','i','l'},
+    {'v','a','l','e','s'},
+    {'v','a','l','e','t'},
+    {'v','a','l','i','d'},
+    {'v','a','l','i','s'},
+    {'v','a','l','l','i'},
+    {'v','a','l','o','r'},
+    {'v','a','l','s','e'},
+    {'v','a','l','u','e'},
+    {'v','a','l','v','e'},
+    {'v','a','m','p','s'},
+    {'v','a','m','p','y'},
+    {'v','a','n','d','a'},
+    {'v','a','n','e','d'},
+    {'v','a','n','e','s'},
+    {'v','a','n','g','a'},
+    {'v','a','n','g','s'},
+    {'v','a','n','t','s'},
+    {'v','a','p','e','d'},
+    {'v','a','p','e','r'},
+    {'v','a','p','e','s'},
+    {'v','a','p','i','d'},
+    {'v','a','p','o','r'},
+    {'v','a','r','a','n'},
+    {'v','a','r','a','s'},
+    {'v','a','r','d','a'},
+    {'v','a','r','d','o'},
+    {'v','a','r','d','y'},
+    {'v','a','r','e','c'},
+    {'v','a','r','e','s'},
+    {'v','a','r','i','a'},
+    {'v','a','r','i','x'},
+    {'v','a','r','n','a'},
+    {'v','a','r','u','s'},
+    {'v','a','r','v','e'},
+    {'v','a','s','a','l'},
+    {'v','a','s','e','s'},
+    {'v','a','s','t','s'},
+    {'v','a','s','t','y'},
+    {'v','a','t','a','s'},
+    {'v','a','t','h','a'},
+    {'v','a','t','i','c'},
+    {'v','a','t','j','e'},
+    {'v','a','t','o','s'},
+    {'v','a','t','u','s'},
+    {'v','a','u','c','h'},
+    {'v','a','u','l','t'},
+    {'v','a','u','n','t'},
+    {'v','a','u','t','e'},
+    {'v','a','u','t','s'},
+    {'v','a','w','t','e'},
+    {'v','a','x','e','s'},
+    {'v','e','a','l','e'},
+    {'v','e','a','l','s'},
+    {'v','e','a','l','y'},
+    {'v','e','e','n','a'},
+    {'v','e','e','p','s'},
+    {'v','e','e','r','s'},
+    {'v','e','e','r','y'},
+    {'v','e','g','a','n'},
+    {'v','e','g','a','s'},
+    {'v','e','g','e','s'},
+    {'v','e','g','g','o'},
+    {'v','e','g','i','e'},
+    {'v','e','g','o','s'},
+    {'v','e','h','m','e'},
+    {'v','e','i','l','s'},
+    {'v','e','i','l','y'},
+    {'v','e','i','n','s'},
+    {'v','e','i','n','y'},
+    {'v','e','l','a','r'},
+    {'v','e','l','d','s'},
+    {'v','e','l','d','t'},
+    {'v','e','l','e','s'},
+    {'v','e','l','l','s'},
+    {'v','e','l','u','m'},
+    {'v','e','n','a','e'},
+    {'v','e','n','a','l'},
+    {'v','e','n','a','s'},
+    {'v','e','n','d','s'},
+    {'v','e','n','d','u'},
+    {'v','e','n','e','y'},
+    {'v','e','n','g','e'},
+    {'v','e','n','i','n'},
+    {'v','e','n','o','m'},
+    {'v','e','n','t','i'},
+    {'v','e','n','t','s'},
+    {'v','e','n','u','e'},
+    {'v','e','n','u','s'},
+    {'v','e','r','b','a'},
+    {'v','e','r','b','s'},
+    {'v','e','r','d','e'},
+    {'v','e','r','g','e'},
+    {'v','e','r','r','a'},
+    {'v','e','r','r','e'},
+    {'v','e','r','r','y'},
+    {'v','e','r','s','a'},
+    {'v','e','r','s','e'},
+    {'v','e','r','s','o'},
+    {'v','e','r','s','t'},
+    {'v','e','r','t','e'},
+    {'v','e','r','t','s'},
+    {'v','e','r','t','u'},
+    {'v','e','r','v','e'},
+    {'v','e','s','p','a'},
+    {'v','e','s','t','a'},
+    {'v','e','s','t','s'},
+    {'v','e','t','c','h'},
+    {'v','e','u','v','e'},
+    {'v','e','v','e','s'},
+    {'v','e','x','e','d'},
+    {'v','e','x','e','r'},
+    {'v','e','x','e','s'},
+    {'v','e','x','i','l'},
+    {'v','e','z','i','r'},
+    {'v','i','a','l','s'},
+    {'v','i','a','n','d'},
+    {'v','i','b','e','d'},
+    {'v','i','b','e','s'},
+    {'v','i','b','e','x'},
+    {'v','i','b','e','y'},
+    {'v','i','c','a','r'},
+    {'v','i','c','e','d'},
+    {'v','i','c','e','s'},
+    {'v','i','c','h','y'},
+    {'v','i','c','u','s'},
+    {'v','i','d','e','o'},
+    {'v','i','e','r','s'},
+    {'v','i','e','u','x'},
+    {'v','i','e','w','s'},
+    {'v','i','e','w','y'},
+    {'v','i','f','d','a'},
+    {'v','i','f','f','s'},
+    {'v','i','g','a','s'},
+    {'v','i','g','i','a'},
+    {'v','i','g','i','l'},
+    {'v','i','g','o','r'},
+    {'v','i','l','d','e'},
+    {'v','i','l','e','r'},
+    {'v','i','l','l','a'},
+    {'v','i','l','l','e'},
+    {'v','i','l','l','i'},
+    {'v','i','l','l','s'},
+    {'v','i','m','e','n'},
+    {'v','i','n','a','l'},
+    {'v','i','n','a','s'},
+    {'v','i','n','c','a'},
+    {'v','i','n','e','d'},
+    {'v','i','n','e','r'},
+    {'v','i','n','e','s'},
+    {'v','i','n','e','w'},
+    {'v','i','n','h','o'},
+    {'v','i','n','i','c'},
+    {'v','i','n','n','y'},
+    {'v','i','n','o','s'},
+    {'v','i','n','t','s'},
+    {'v','i','n','y','l'},
+    {'v','i','o','l','a'},
+    {'v','i','o','l','d'},
+    {'v','i','o','l','s'},
+    {'v','i','p','e','r'},
+    {'v','i','r','a','l'},
+    {'v','i','r','e','d'},
+    {'v','i','r','e','o'},
+    {'v','i','r','e','s'},
+    {'v','i','r','g','a'},
+    {'v','i','r','g','e'},
+    {'v','i','r','g','o'},
+    {'v','i','r','i','d'},
+    {'v','i','r','l','s'},
+    {'v','i','r','t','u'},
+    {'v','i','r','u','s'},
+    {'v','i','s','a','s'},
+    {'v','i','s','e','d'},
+    {'v','i','s','e','s'},
+    {'v','i','s','i','e'},
+    {'v','i','s','i','t'},
+    {'v','i','s','n','a'},
+    {'v','i','s','n','e'},
+    {'v','i','s','o','n'},
+    {'v','i','s','o','r'},
+    {'v','i','s','t','a'},
+    {'v','i','s','t','o'},
+    {'v','i','t','a','e'},
+    {'v','i','t','a','l'},
+    {'v','i','t','a','s'},
+    {'v','i','t','e','x'},
+    {'v','i','t','r','o'},
+    {'v','i','t','t','a'},
+    {'v','i','v','a','s'},
+    {'v','i','v','a','t'},
+    {'v','i','v','d','a'},
+    {'v','i','v','e','r'},
+    {'v','i','v','e','s'},
+    {'v','i','v','i','d'},
+    {'v','i','v','o','s'},
+    {'v','i','v','r','e'},
+    {'v','i','x','e','n'},
+    {'v','i','z','i','r'},
+    {'v','i','z','o','r'},
+    {'v','l','a','s','t'},
+    {'v','l','e','i','s'},
+    {'v','l','i','e','s'},
+    {'v','l','o','g','s'},
+    {'v','o','a','r','s'},
+    {'v','o','b','l','a'},
+    {'v','o','c','a','b'},
+    {'v','o','c','a','l'},
+    {'v','o','c','e','s'},
+    {'v','o','d','d','y'},
+    {'v','o','d','k','a'},
+    {'v','o','d','o','u'},
+    {'v','o','d','u','n'},
+    {'v','o','e','m','a'},
+    {'v','o','g','i','e'},
+    {'v','o','g','u','e'},
+    {'v','o','i','c','e'},
+    {'v','o','i','c','i'},
+    {'v','o','i','d','s'},
+    {'v','o','i','l','a'},
+    {'v','o','i','l','e'},
+    {'v','o','i','p','s'},
+    {'v','o','l','a','e'},
+    {'v','o','l','a','r'},
+    {'v','o','l','e','d'},
+    {'v','o','l','e','s'},
+    {'v','o','l','e','t'},
+    {'v','o','l','k','e'},
+    {'v','o','l','k','s'},
+    {'v','o','l','t','a'},
+    {'v','o','l','t','e'},
+    {'v','o','l','t','i'},
+    {'v','o','l','t','s'},
+    {'v','o','l','v','a'},
+    {'v','o','l','v','e'},
+    {'v','o','m','e','r'},
+    {'v','o','m','i','t'},
+    {'v','o','t','e','d'},
+    {'v','o','t','e','r'},
+    {'v','o','t','e','s'},
+    {'v','o','u','c','h'},
+    {'v','o','u','g','e'},
+    {'v','o','u','l','u'},
+    {'v','o','w','e','d'},
+    {'v','o','w','e','l'},
+    {'v','o','w','e','r'},
+    {'v','o','x','e','l'},
+    {'v','o','x','e','s'},
+    {'v','o','z','h','d'},
+    {'v','r','a','i','c'},
+    {'v','r','i','l','s'},
+    {'v','r','o','o','m'},
+    {'v','r','o','u','s'},
+    {'v','r','o','u','w'},
+    {'v','r','o','w','s'},
+    {'v','u','g','g','s'},
+    {'v','u','g','g','y'},
+    {'v','u','g','h','s'},
+    {'v','u','g','h','y'},
+    {'v','u','l','g','o'},
+    {'v','u','l','n','s'},
+    {'v','u','l','v','a'},
+    {'v','u','t','t','y'},
+    {'v','y','g','i','e'},
+    {'v','y','i','n','g'},
+    {'w','a','a','c','s'},
+    {'w','a','c','k','e'},
+    {'w','a','c','k','o'},
+    {'w','a','c','k','s'},
+    {'w','a','c','k','y'},
+    {'w','a','d','a','s'},
+    {'w','a','d','d','s'},
+    {'w','a','d','d','y'},
+    {'w','a','d','e','d'},
+    {'w','a','d','e','r'},
+    {'w','a','d','e','s'},
+    {'w','a','d','g','e'},
+    {'w','a','d','i','s'},
+    {'w','a','d','t','s'},
+    {'w','a','f','e','r'},
+    {'w','a','f','f','s'},
+    {'w','a','f','t','s'},
+    {'w','a','g','e','d'},
+    {'w','a','g','e','r'},
+    {'w','a','g','e','s'},
+    {'w','a','g','g','a'},
+    {'w','a','g','o','n'},
+    {'w','a','g','y','u'},
+    {'w','a','h','a','y'},
+    {'w','a','h','e','y'},
+    {'w','a','h','o','o'},
+    {'w','a','i','d','e'},
+    {'w','a','i','f','s'},
+    {'w','a','i','f','t'},
+    {'w','a','i','l','s'},
+    {'w','a','i','n','s'},
+    {'w','a','i','r','s'},
+    {'w','a','i','s','t'},
+    {'w','a','i','t','e'},
+    {'w','a','i','t','s'},
+    {'w','a','i','v','e'},
+    {'w','a','k','a','s'},
+    {'w','a','k','e','d'},
+    {'w','a','k','e','n'},
+    {'w','a','k','e','r'},
+    {'w','a','k','e','s'},
+    {'w','a','k','f','s'},
+    {'w','a','l','d','o'},
+    {'w','a','l','d','s'},
+    {'w','a','l','e','d'},
+    {'w','a','l','e','r'},
+    {'w','a','l','e','s'},
+    {'w','a','l','i','e'},
+    {'w','a','l','i','s'},
+    {'w','a','l','k','s'},
+    {'w','a','l','l','a'},
+    {'w','a','l','l','s'},
+    {'w','a','l','l','y'},
+    {'w','a','l','t','y'},
+    {'w','a','l','t','z'},
+    {'w','a','m','e','d'},
+    {'w','a','m','e','s'},
+    {'w','a','m','u','s'},
+    {'w','a','n','d','s'},
+    {'w','a','n','e','d'},
+    {'w','a','n','e','s'},
+    {'w','a','n','e','y'},
+    {'w','a','n','g','s'},
+    {'w','a','n','k','s'},
+    {'w','a','n','k','y'},
+    {'w','a','n','l','e'},
+    {'w','a','n','l','y'},
+    {'w','a','n','n','a'},
+    {'w','a','n','t','a'},
+    {'w','a','n','t','s'},
+    {'w','a','n','t','y'},
+    {'w','a','n','z','e'},
+    {'w','a','q','f','s'},
+    {'w','a','r','b','s'},
+    {'w','a','r','b','y'},
+    {'w','a','r','d','s'},
+    {'w','a','r','e','d'},
+    {'w','a','r','e','s'},
+    {'w','a','r','e','z'},
+    {'w','a','r','k','s'},
+    {'w','a','r','m','s'},
+    {'w','a','r','n','s'},
+    {'w','a','r','p','s'},
+    {'w','a','r','r','e'},
+    {'w','a','r','s','t'},
+    {'w','a','r','t','s'},
+    {'w','a','r','t','y'},
+    {'w','a','s','e','s'},
+    {'w','a','s','h','i'},
+    {'w','a','s','h','y'},
+    {'w','a','s','m','s'},
+    {'w','a','s','p','s'},
+    {'w','a','s','p','y'},
+    {'w','a','s','t','e'},
+    {'w','a','s','t','s'},
+    {'w','a','t','a','p'},
+    {'w','a','t','c','h'},
+    {'w','a','t','e','r'},
+    {'w','a','t','t','s'},
+    {'w','a','u','f','f'},
+    {'w','a','u','g','h'},
+    {'w','a','u','k','s'},
+    {'w','a','u','l','k'},
+    {'w','a','u','l','s'},
+    {'w','a','u','r','s'},
+    {'w','a','v','e','d'},
+    {'w','a','v','e','r'},
+    {'w','a','v','e','s'},
+    {'w','a','v','e','y'},
+    {'w','a','w','a','s'},
+    {'w','a','w','e','s'},
+    {'w','a','w','l','s'},
+    {'w','a','x','e','d'},
+    {'w','a','x','e','n'},
+    {'w','a','x','e','r'},
+    {'w','a','x','e','s'},
+    {'w','a','y','e','d'},
+    {'w','a','z','i','r'},
+    {'w','a','z','o','o'},
+    {'w','e','a','l','d'},
+    {'w','e','a','l','s'},
+    {'w','e','a','m','b'},
+    {'w','e','a','n','s'},
+    {'w','e','a','r','s'},
+    {'w','e','a','r','y'},
+    {'w','e','a','v','e'},
+    {'w','e','b','b','y'},
+    {'w','e','b','e','r'},
+    {'w','e','c','h','t'},
+    {'w','e','d','e','l'},
+    {'w','e','d','g','e'},
+    {'w','e','d','g','y'},
+    {'w','e','e','d','s'},
+    {'w','e','e','d','y'},
+    {'w','e','e','i','s'},
+    {'w','e','e','k','e'},
+    {'w','e','e','k','s'},
+    {'w','e','e','l','s'},
+    {'w','e','e','m','s'},
+    {'w','e','e','n','s'},
+    {'w','e','e','n','y'},
+    {'w','e','e','p','s'},
+    {'w','e','e','p','y'},
+    {'w','e','e','s','t'},
+    {'w','e','e','t','e'},
+    {'w','e','e','t','s'},
+    {'w','e','f','t','e'},
+    {'w','e','f','t','s'},
+    {'w','e','i','d','s'},
+    {'w','e','i','g','h'},
+    {'w','e','i','l','s'},
+    {'w','e','i','r','d'},
+    {'w','e','i','r','s'},
+    {'w','e','i','s','e'},
+    {'w','e','i','z','e'},
+    {'w','e','k','a','s'},
+    {'w','e','l','c','h'},
+    {'w','e','l','d','s'},
+    {'w','e','l','k','e'},
+    {'w','e','l','k','s'},
+    {'w','e','l','k','t'},
+    {'w','e','l','l','s'},
+    {'w','e','l','l','y'},
+    {'w','e','l','s','h'},
+    {'w','e','l','t','s'},
+    {'w','e','m','b','s'},
+    {'w','e','n','c','h'},
+    {'w','e','n','d','s'},
+    {'w','e','n','g','e'},
+    {'w','e','n','n','y'},
+    {'w','e','n','t','s'},
+    {'w','e','r','f','s'},
+    {'w','e','r','o','s'},
+    {'w','e','r','s','h'},
+    {'w','e','s','t','s'},
+    {'w','e','t','a','s'},
+    {'w','e','t','l','y'},
+    {'w','e','x','e','d'},
+    {'w','e','x','e','s'},
+    {'w','h','a','c','k'},
+    {'w','h','a','l','e'},
+    {'w','h','a','m','o'},
+    {'w','h','a','m','s'},
+    {'w','h','a','n','g'},
+    {'w','h','a','p','s'},
+    {'w','h','a','r','e'},
+    {'w','h','a','r','f'},
+    {'w','h','a','t','a'},
+    {'w','h','a','t','s'},
+    {'w','h','a','u','p'},
+    {'w','h','a','u','r'},
+    {'w','h','e','a','l'},
+    {'w','h','e','a','r'},
+    {'w','h','e','a','t'},
+    {'w','h','e','e','k'},
+    {'w','h','e','e','l'},
+    {'w','h','e','e','n'},
+    {'w','h','e','e','p'},
+    {'w','h','e','f','t'},
+    {'w','h','e','l','k'},
+    {'w','h','e','l','m'},
+    {'w','h','e','l','p'},
+    {'w','h','e','n','s'},
+    {'w','h','e','r','e'},
+    {'w','h','e','t','s'},
+    {'w','h','e','w','s'},
+    {'w','h','e','y','s'},
+    {'w','h','i','c','h'},
+    {'w','h','i','d','s'},
+    {'w','h','i','e','s'},
+    {'w','h','i','f','f'},
+    {'w','h','i','f','t'},
+    {'w','h','i','g','s'},
+    {'w','h','i','l','e'},
+    {'w','h','i','l','k'},
+    {'w','h','i','m','s'},
+    {'w','h','i','n','e'},
+    {'w','h','i','n','s'},
+    {'w','h','i','n','y'},
+    {'w','h','i','o','s'},
+    {'w','h','i','p','s'},
+    {'w','h','i','p','t'},
+    {'w','h','i','r','l'},
+    {'w','h','i','r','r'},
+    {'w','h','i','r','s'},
+    {'w','h','i','s','h'},
+    {'w','h','i','s','k'},
+    {'w','h','i','s','s'},
+    {'w','h','i','s','t'},
+    {'w','h','i','t','e'},
+    {'w','h','i','t','s'},
+    {'w','h','i','t','y'},
+    {'w','h','i','z','z'},
+    {'w','h','o','l','e'},
+    {'w','h','o','m','p'},
+    {'w','h','o','o','f'},
+    {'w','h','o','o','p'},
+    {'w','h','o','o','t'},
+    {'w','h','o','p','s'},
+    {'w','h','o','r','e'},
+    {'w','h','o','r','l'},
+    {'w','h','o','r','t'},
+    {'w','h','o','s','e'},
+    {'w','h','o','s','o'},
+    {'w','h','o','w','s'},
+    {'w','h','u','m','p'},
+    {'w','h','u','p','s'},
+    {'w','h','y','d','a'},
+    {'w','i','c','c','a'},
+    {'w','i','c','k','s'},
+    {'w','i','c','k','y'},
+    {'w','i','d','d','y'},
+    {'w','i','d','e','n'},
+    {'w','i','d','e','r'},
+    {'w','i','d','e','s'},
+    {'w','i','d','o','w'},
+    {'w','i','d','t','h'},
+    {'w','i','e','l','d'},
+    {'w','i','e','l','s'},
+    {'w','i','f','e','d'},
+    {'w','i','f','e','s'},
+    {'w','i','f','e','y'},
+    {'w','i','f','i','e'},
+    {'w','i','f','t','s'},
+    {'w','i','f','t','y'},
+    {'w','i','g','a','n'},
+    {'w','i','g','g','a'},
+    {'w','i','g','g','y'},
+    {'w','i','g','h','t'},
+    {'w','i','k','i','s'},
+    {'w','i','l','c','o'},
+    {'w','i','l','d','s'},
+    {'w','i','l','e','d'},
+    {'w','i','l','e','s'},
+    {'w','i','l','g','a'},
+    {'w','i','l','i','s'},
+    {'w','i','l','j','a'},
+    {'w','i','l','l','s'},
+    {'w','i','l','l','y'},
+    {'w','i','l','t','s'},
+    {'w','i','m','p','s'},
+    {'w','i','m','p','y'},
+    {'w','i','n','c','e'},
+    {'w','i','n','c','h'},
+    {'w','i','n','d','s'},
+    {'w','i','n','d','y'},
+    {'w','i','n','e','d'},
+    {'w','i','n','e','s'},
+    {'w','i','n','e','y'},
+    {'w','i','n','g','e'},
+    {'w','i','n','g','s'},
+    {'w','i','n','g','y'},
+    {'w','i','n','k','s'},
+    {'w','i','n','k','y'},
+    {'w','i','n','n','a'},
+    {'w','i','n','n','s'},
+    {'w','i','n','o','s'},
+    {'w','i','n','z','e'},
+    {'w','i','p','e','d'},
+    {'w','i','p','e','r'},
+    {'w','i','p','e','s'},
+    {'w','i','r','e','d'},
+    {'w','i','r','e','r'},
+    {'w','i','r','e','s'},
+    {'w','i','r','r','a'},
+    {'w','i','r','r','i'},
+    {'w','i','s','e','d'},
+    {'w','i','s','e','r'},
+    {'w','i','s','e','s'},
+    {'w','i','s','h','a'},
+    {'w','i','s','h','t'},
+    {'w','i','s','p','s'},
+    {'w','i','s','p','y'},
+    {'w','i','s','t','s'},
+    {'w','i','t','a','n'},
+    {'w','i','t','c','h'},
+    {'w','i','t','e','d'},
+    {'w','i','t','e','s'},
+    {'w','i','t','h','e'},
+    {'w','i','t','h','s'},
+    {'w','i','t','h','y'},
+    {'w','i','t','t','y'},
+    {'w','i','v','e','d'},
+    {'w','i','v','e','r'},
+    {'w','i','v','e','s'},
+    {'w','i','z','e','n'},
+    {'w','i','z','e','s'},
+    {'w','i','z','z','o'},
+    {'w','o','a','d','s'},
+    {'w','o','a','d','y'},
+    {'w','o','a','l','d'},
+    {'w','o','c','k','s'},
+    {'w','o','d','g','e'},
+    {'w','o','d','g','y'},
+    {'w','o','f','u','l'},
+    {'w','o','j','u','s'},
+    {'w','o','k','e','n'},
+    {'w','o','k','e','r'},
+    {'w','o','k','k','a'},
+    {'w','o','l','d','s'},
+    {'w','o','l','f','s'},
+    {'w','o','l','l','y'},
+    {'w','o','l','v','e'},
+    {'w','o','m','a','n'},
+    {'w','o','m','a','s'},
+    {'w','o','m','b','s'},
+    {'w','o','m','b','y'},
+    {'w','o','m','e','n'},
+    {'w','o','m','y','n'},
+    {'w','o','n','g','a'},
+    {'w','o','n','g','i'},
+    {'w','o','n','k','s'},
+    {'w','o','n','k','y'},
+    {'w','o','n','t','s'},
+    {'w','o','o','d','s'},
+    {'w','o','o','d','y'},
+    {'w','o','o','e','d'},
+    {'w','o','o','e','r'},
+    {'w','o','o','f','s'},
+    {'w','o','o','f','y'},
+    {'w','o','o','l','d'},
+    {'w','o','o','l','s'},
+    {'w','o','o','l','y'},
+    {'w','o','o','n','s'},
+    {'w','o','o','p','s'},
+    {'w','o','o','p','y'},
+    {'w','o','o','s','e'},
+    {'w','o','o','s','h'},
+    {'w','o','o','t','z'},
+    {'w','o','o','z','y'},
+    {'w','o','r','d','s'},
+    {'w','o','r','d','y'},
+    {'w','o','r','k','s'},
+    {'w','o','r','k','y'},
+    {'w','o','r','l','d'},
+    {'w','o','r','m','s'},
+    {'w','o','r','m','y'},
+    {'w','o','r','r','y'},
+    {'w','o','r','s','e'},
+    {'w','o','r','s','t'},
+    {'w','o','r','t','h'},
+    {'w','o','r','t','s'},
+    {'w','o','u','l','d'},
+    {'w','o','u','n','d'},
+    {'w','o','v','e','n'},
+    {'w','o','w','e','d'},
+    {'w','o','w','e','e'},
+    {'w','o','w','s','e'},
+    {'w','o','x','e','n'},
+    {'w','r','a','c','k'},
+    {'w','r','a','n','g'},
+    {'w','r','a','p','s'},
+    {'w','r','a','p','t'},
+    {'w','r','a','s','t'},
+    {'w','r','a','t','e'},
+    {'w','r','a','t','h'},
+    {'w','r','a','w','l'},
+    {'w','r','e','a','k'},
+    {'w','r','e','c','k'},
+    {'w','r','e','n','s'},
+    {'w','r','e','s','t'},
+    {'w','r','i','c','k'},
+    {'w','r','i','e','d'},
+    {'w','r','i','e','r'},
+    {'w','r','i','e','s'},
+    {'w','r','i','n','g'},
+    {'w','r','i','s','t'},
+    {'w','r','i','t','e'},
+    {'w','r','i','t','s'},
+    {'w','r','o','k','e'},
+    {'w','r','o','n','g'},
+    {'w','r','o','o','t'},
+    {'w','r','o','t','e'},
+    {'w','r','o','t','h'},
+    {'w','r','u','n','g'},
+    {'w','r','y','e','r'},
+    {'w','r','y','l','y'},
+    {'w','u','d','d','y'},
+    {'w','u','d','u','s'},
+    {'w','u','f','f','s'},
+    {'w','u','l','l','s'},
+    {'w','u','n','g','a'},
+    {'w','u','r','s','t'},
+    {'w','u','s','e','s'},
+    {'w','u','s','h','u'},
+    {'w','u','s','s','y'},
+    {'w','u','x','i','a'},
+    {'w','y','l','e','d'},
+    {'w','y','l','e','s'},
+    {'w','y','n','d','s'},
+    {'w','y','n','n','s'},
+    {'w','y','t','e','d'},
+    {'w','y','t','e','s'},
+    {'w','y','t','h','e'},
+    {'x','e','b','e','c'},
+    {'x','e','n','i','a'},
+    {'x','e','n','i','c'},
+    {'x','e','n','o','n'},
+    {'x','e','r','i','c'},
+    {'x','e','r','o','x'},
+    {'x','e','r','u','s'},
+    {'x','o','a','n','a'},
+    {'x','o','l','o','s'},
+    {'x','r','a','y','s'},
+    {'x','v','i','i','i'},
+    {'x','y','l','a','n'},
+    {'x','y','l','e','m'},
+    {'x','y','l','i','c'},
+    {'x','y','l','o','l'},
+    {'x','y','l','y','l'},
+    {'x','y','s','t','i'},
+    {'x','y','s','t','s'},
+    {'y','a','a','r','s'},
+    {'y','a','a','s','s'},
+    {'y','a','b','a','s'},
+    {'y','a','b','b','a'},
+    {'y','a','b','b','y'},
+    {'y','a','c','c','a'},
+    {'y','a','c','h','t'},
+    {'y','a','c','k','a'},
+    {'y','a','c','k','s'},
+    {'y','a','d','d','a'},
+    {'y','a','f','f','s'},
+    {'y','a','g','e','r'},
+    {'y','a','g','e','s'},
+    {'y','a','g','i','s'},
+    {'y','a','g','n','a'},
+    {'y','a','h','o','o'},
+    {'y','a','i','r','d'},
+    {'y','a','j','n','a'},
+    {'y','a','k','k','a'},
+    {'y','a','k','o','w'},
+    {'y','a','l','e','s'},
+    {'y','a','m','e','n'},
+    {'y','a','m','p','a'},
+    {'y','a','m','p','y'},
+    {'y','a','m','u','n'},
+    {'y','a','n','d','y'},
+    {'y','a','n','g','s'},
+    {'y','a','n','k','s'},
+    {'y','a','p','o','k'},
+    {'y','a','p','o','n'},
+    {'y','a','p','p','s'},
+    {'y','a','p','p','y'},
+    {'y','a','r','a','k'},
+    {'y','a','r','c','o'},
+    {'y','a','r','d','s'},
+    {'y','a','r','e','r'},
+    {'y','a','r','f','a'},
+    {'y','a','r','k','s'},
+    {'y','a','r','n','s'},
+    {'y','a','r','r','a'},
+    {'y','a','r','r','s'},
+    {'y','a','r','t','a'},
+    {'y','a','r','t','o'},
+    {'y','a','t','e','s'},
+    {'y','a','t','r','a'},
+    {'y','a','u','d','s'},
+    {'y','a','u','l','d'},
+    {'y','a','u','p','s'},
+    {'y','a','w','e','d'},
+    {'y','a','w','e','y'},
+    {'y','a','w','l','s'},
+    {'y','a','w','n','s'},
+    {'y','a','w','n','y'},
+    {'y','a','w','p','s'},
+    {'y','a','y','a','s'},
+    {'y','b','o','r','e'},
+    {'y','c','l','a','d'},
+    {'y','c','l','e','d'},
+    {'y','c','o','n','d'},
+    {'y','d','r','a','d'},
+    {'y','d','r','e','d'},
+    {'y','e','a','d','s'},
+    {'y','e','a','h','s'},
+    {'y','e','a','l','m'},
+    {'y','e','a','n','s'},
+    {'y','e','a','r','d'},
+    {'y','e','a','r','n'},
+    {'y','e','a','r','s'},
+    {'y','e','a','s','t'},
+    {'y','e','c','c','h'},
+    {'y','e','c','h','s'},
+    {'y','e','c','h','y'},
+    {'y','e','d','e','s'},
+    {'y','e','e','d','s'},
+    {'y','e','e','e','k'},
+    {'y','e','e','s','h'},
+    {'y','e','g','g','s'},
+    {'y','e','l','k','s'},
+    {'y','e','l','l','s'},
+    {'y','e','l','m','s'},
+    {'y','e','l','p','s'},
+    {'y','e','l','t','s'},
+    {'y','e','n','t','a'},
+    {'y','e','n','t','e'},
+    {'y','e','r','b','a'},
+    {'y','e','r','d','s'},
+    {'y','e','r','k','s'},
+    {'y','e','s','e','s'},
+    {'y','e','s','k','s'},
+    {'y','e','s','t','s'},
+    {'y','e','s','t','y'},
+    {'y','e','t','i','s'},
+    {'y','e','t','t','s'},
+    {'y','e','u','c','h'},
+    {'y','e','u','k','s'},
+    {'y','e','u','k','y'},
+    {'y','e','v','e','n'},
+    {'y','e','v','e','s'},
+    {'y','e','w','e','n'},
+    {'y','e','x','e','d'},
+    {'y','e','x','e','s'},
+    {'y','f','e','r','e'},
+    {'y','i','e','l','d'},
+    {'y','i','k','e','d'},
+    {'y','i','k','e','s'},
+    {'y','i','l','l','s'},
+    {'y','i','n','c','e'},
+    {'y','i','p','e','s'},
+    {'y','i','p','p','y'},
+    {'y','i','r','d','s'},
+    {'y','i','r','k','s'},
+    {'y','i','r','r','s'},
+    {'y','i','r','t','h'},
+    {'y','i','t','e','s'},
+    {'y','i','t','i','e'},
+    {'y','l','e','m','s'},
+    {'y','l','i','d','e'},
+    {'y','l','i','d','s'},
+    {'y','l','i','k','e'},
+    {'y','l','k','e','s'},
+    {'y','m','o','l','t'},
+    {'y','m','p','e','s'},
+    {'y','o','b','b','o'},
+    {'y','o','b','b','y'},
+    {'y','o','c','k','s'},
+    {'y','o','d','e','l'},
+    {'y','o','d','h','s'},
+    {'y','o','d','l','e'},
+    {'y','o','g','a','s'},
+    {'y','o','g','e','e'},
+    {'y','o','g','h','s'},
+    {'y','o','g','i','c'},
+    {'y','o','g','i','n'},
+    {'y','o','g','i','s'},
+    {'y','o','h','a','h'},
+    {'y','o','h','a','y'},
+    {'y','o','i','c','k'},
+    {'y','o','j','a','n'},
+    {'y','o','k','a','n'},
+    {'y','o','k','e','d'},
+    {'y','o','k','e','g'},
+    {'y','o','k','e','l'},
+    {'y','o','k','e','r'},
+    {'y','o','k','e','s'},
+    {'y','o','k','u','l'},
+    {'y','o','l','k','s'},
+    {'y','o','l','k','y'},
+    {'y','o','l','p','s'},
+    {'y','o','m','i','m'},
+    {'y','o','m','p','s'},
+    {'y','o','n','i','c'},
+    {'y','o','n','i','s'},
+    {'y','o','n','k','s'},
+    {'y','o','n','n','y'},
+    {'y','o','o','f','s'},
+    {'y','o','o','p','s'},
+    {'y','o','p','o','s'},
+    {'y','o','p','p','o'},
+    {'y','o','r','e','s'},
+    {'y','o','r','g','a'},
+    {'y','o','r','k','s'},
+    {'y','o','r','p','s'},
+    {'y','o','u','k','s'},
+    {'y','o','u','n','g'},
+    {'y','o','u','r','n'},
+    {'y','o','u','r','s'},
+    {'y','o','u','r','t'},
+    {'y','o','u','s','e'},
+    {'y','o','u','t','h'},
+    {'y','o','w','e','d'},
+    {'y','o','w','e','s'},
+    {'y','o','w','i','e'},
+    {'y','o','w','l','s'},
+    {'y','o','w','s','a'},
+    {'y','o','w','z','a'},
+    {'y','o','y','o','s'},
+    {'y','r','a','p','t'},
+    {'y','r','e','n','t'},
+    {'y','r','i','v','d'},
+    {'y','r','n','e','h'},
+    {'y','s','a','m','e'},
+    {'y','t','o','s','t'},
+    {'y','u','a','n','s'},
+    {'y','u','c','a','s'},
+    {'y','u','c','c','a'},
+    {'y','u','c','c','h'},
+    {'y','u','c','k','o'},
+    {'y','u','c','k','s'},
+    {'y','u','c','k','y'},
+    {'y','u','f','t','s'},
+    {'y','u','g','a','s'},
+    {'y','u','k','e','d'},
+    {'y','u','k','e','s'},
+    {'y','u','k','k','y'},
+    {'y','u','k','o','s'},
+    {'y','u','l','a','n'},
+    {'y','u','l','e','s'},
+    {'y','u','m','m','o'},
+    {'y','u','m','m','y'},
+    {'y','u','m','p','s'},
+    {'y','u','p','o','n'},
+    {'y','u','p','p','y'},
+    {'y','u','r','t','a'},
+    {'y','u','r','t','s'},
+    {'y','u','z','u','s'},
+    {'z','a','b','r','a'},
+    {'z','a','c','k','s'},
+    {'z','a','i','d','a'},
+    {'z','a','i','d','e'},
+    {'z','a','i','d','y'},
+    {'z','a','i','r','e'},
+    {'z','a','k','a','t'},
+    {'z','a','m','a','c'},
+    {'z','a','m','a','k'},
+    {'z','a','m','a','n'},
+    {'z','a','m','b','o'},
+    {'z','a','m','i','a'},
+    {'z','a','m','i','s'},
+    {'z','a','n','j','a'},
+    {'z','a','n','t','e'},
+    {'z','a','n','z','a'},
+    {'z','a','n','z','e'},
+    {'z','a','p','p','y'},
+    {'z','a','r','d','a'},
+    {'z','a','r','f','s'},
+    {'z','a','r','i','s'},
+    {'z','a','t','i','s'},
+    {'z','a','w','n','s'},
+    {'z','a','x','e','s'},
+    {'z','a','y','d','e'},
+    {'z','a','y','i','n'},
+    {'z','a','z','e','n'},
+    {'z','e','a','l','s'},
+    {'z','e','b','e','c'},
+    {'z','e','b','r','a'},
+    {'z','e','b','u','b'},
+    {'z','e','b','u','s'},
+    {'z','e','d','a','s'},
+    {'z','e','e','r','a'},
+    {'z','e','i','n','s'},
+    {'z','e','n','d','o'},
+    {'z','e','r','d','a'},
+    {'z','e','r','k','s'},
+    {'z','e','r','o','s'},
+    {'z','e','s','t','s'},
+    {'z','e','s','t','y'},
+    {'z','e','t','a','s'},
+    {'z','e','x','e','s'},
+    {'z','e','z','e','s'},
+    {'z','h','o','m','o'},
+    {'z','h','u','s','h'},
+    {'z','h','u','z','h'},
+    {'z','i','b','e','t'},
+    {'z','i','f','f','s'},
+    {'z','i','g','a','n'},
+    {'z','i','k','r','s'},
+    {'z','i','l','a','s'},
+    {'z','i','l','c','h'},
+    {'z','i','l','l','a'},
+    {'z','i','l','l','s'},
+    {'z','i','m','b','i'},
+    {'z','i','m','b','s'},
+    {'z','i','n','c','o'},
+    {'z','i','n','c','s'},
+    {'z','i','n','c','y'},
+    {'z','i','n','e','b'},
+    {'z','i','n','e','s'},
+    {'z','i','n','g','s'},
+    {'z','i','n','g','y'},
+    {'z','i','n','k','e'},
+    {'z','i','n','k','y'},
+    {'z','i','n','o','s'},
+    {'z','i','p','p','o'},
+    {'z','i','p','p','y'},
+    {'z','i','r','a','m'},
+    {'z','i','t','i','s'},
+    {'z','i','t','t','y'},
+    {'z','i','z','e','l'},
+    {'z','i','z','i','t'},
+    {'z','l','o','t','e'},
+    {'z','l','o','t','y'},
+    {'z','o','a','e','a'},
+    {'z','o','b','o','s'},
+    {'z','o','b','u','s'},
+    {'z','o','c','c','o'},
+    {'z','o','e','a','e'},
+    {'z','o','e','a','l'},
+    {'z','o','e','a','s'},
+    {'z','o','i','s','m'},
+    {'z','o','i','s','t'},
+    {'z','o','k','o','r'},
+    {'z','o','l','l','e'},
+    {'z','o','m','b','i'},
+    {'z','o','n','a','e'},
+    {'z','o','n','a','l'},
+    {'z','o','n','d','a'},
+    {'z','o','n','e','d'},
+    {'z','o','n','e','r'},
+    {'z','o','n','e','s'},
+    {'z','o','n','k','s'},
+    {'z','o','o','e','a'},
+    {'z','o','o','e','y'},
+    {'z','o','o','i','d'},
+    {'z','o','o','k','s'},
+    {'z','o','o','m','s'},
+    {'z','o','o','m','y'},
+    {'z','o','o','n','s'},
+    {'z','o','o','t','y'},
+    {'z','o','p','p','a'},
+    {'z','o','p','p','o'},
+    {'z','o','r','i','l'},
+    {'z','o','r','i','s'},
+    {'z','o','r','r','o'},
+    {'z','o','r','s','e'},
+    {'z','o','u','k','s'},
+    {'z','o','w','e','e'},
+    {'z','o','w','i','e'},
+    {'z','u','l','u','s'},
+    {'z','u','p','a','n'},
+    {'z','u','p','a','s'},
+    {'z','u','p','p','a'},
+    {'z','u','r','f','s'},
+    {'z','u','z','i','m'},
+    {'z','y','g','a','l'},
+    {'z','y','g','o','n'},
+    {'z','y','m','e','s'},
+    {'z','y','m','i','c'}
 };
 
-const char* VALID_WORDS[] = {
-    "aback",
-    "abase",
-    "abate",
-    "abbey",
-    "abbot",
-    "abhor",
-    "abide",
-    "abled",
-    "abode",
-    "abort",
-    "about",
-    "above",
-    "abuse",
-    "abyss",
-    "acorn",
-    "acrid",
-    "actor",
-    "acute",
-    "adage",
-    "adapt",
-    "adept",
-    "admin",
-    "admit",
-    "adobe",
-    "adopt",
-    "adore",
-    "adorn",
-    "adult",
-    "affix",
-    "afire",
-    "afoot",
-    "afoul",
-    "after",
-    "again",
-    "agape",
-    "agate",
-    "agent",
-    "agile",
-    "aging",
-    "aglow",
-    "agony",
-    "agora",
-    "agree",
-    "ahead",
-    "aider",
-    "aisle",
-    "alarm",
-    "album",
-    "alert",
-    "algae",
-    "alibi",
-    "alien",
-    "align",
-    "alike",
-    "alive",
-    "allay",
-    "alley",
-    "allot",
-    "allow",
-    "alloy",
-    "aloft",
-    "alone",
-    "along",
-    "aloof",
-    "aloud",
-    "alpha",
-    "altar",
-    "alter",
-    "amass",
-    "amaze",
-    "amber",
-    "amble",
-    "amend",
-    "amiss",
-    "amity",
-    "among",
-    "ample",
-    "amply",
-    "amuse",
-    "angel",
-    "anger",
-    "angle",
-    "angry",
-    "angst",
-    "anime",
-    "ankle",
-    "annex",
-    "annoy",
-    "annul",
-    "anode",
-    "antic",
-    "anvil",
-    "aorta",
-    "apart",
-    "aphid",
-    "aping",
-    "apnea",
-    "apple",
-    "apply",
-    "apron",
-    "aptly",
-    "arbor",
-    "ardor",
-    "arena",
-    "argue",
-    "arise",
-    "armor",
-    "aroma",
-    "arose",
-    "array",
-    "arrow",
-    "arson",
-    "artsy",
-    "ascot",
-    "ashen",
-    "aside",
-    "askew",
-    "assay",
-    "asset",
-    "atoll",
-    "atone",
-    "attic",
-    "audio",
-    "audit",
-    "augur",
-    "aunty",
-    "avail",
-    "avert",
-    "avian",
-    "avoid",
-    "await",
-    "awake",
-    "award",
-    "aware",
-    "awash",
-    "awful",
-    "awoke",
-    "axial",
-    "axiom",
-    "axion",
-    "azure",
-    "bacon",
-    "badge",
-    "badly",
-    "bagel",
-    "baggy",
-    "baker",
-    "baler",
-    "balmy",
-    "banal",
-    "banjo",
-    "barge",
-    "baron",
-    "basal",
-    "basic",
-    "basil",
-    "basin",
-    "basis",
-    "baste",
-    "batch",
-    "bathe",
-    "baton",
-    "batty",
-    "bawdy",
-    "bayou",
-    "beach",
-    "beady",
-    "beard",
-    "beast",
-    "beech",
-    "beefy",
-    "befit",
-    "began",
-    "begat",
-    "beget",
-    "begin",
-    "begun",
-    "being",
-    "belch",
-    "belie",
-    "belle",
-    "belly",
-    "below",
-    "bench",
-    "beret",
-    "berry",
-    "berth",
-    "beset",
-    "betel",
-    "bevel",
-    "bezel",
-    "bible",
-    "bicep",
-    "biddy",
-    "bigot",
-    "bilge",
-    "billy",
-    "binge",
-    "bingo",
-    "biome",
-    "birch",
-    "birth",
-    "bison",
-    "bitty",
-    "black",
-    "blade",
-    "blame",
-    "bland",
-    "blank",
-    "blare",
-    "blast",
-    "blaze",
-    "bleak",
-    "bleat",
-    "bleed",
-    "bleep",
-    "blend",
-    "bless",
-    "blimp",
-    "blind",
-    "blink",
-    "bliss",
-    "blitz",
-    "bloat",
-    "block",
-    "bloke",
-    "blond",
-    "blood",
-    "bloom",
-    "blown",
-    "bluer",
-    "bluff",
-    "blunt",
-    "blurb",
-    "blurt",
-    "blush",
-    "board",
-    "boast",
-    "bobby",
-    "boney",
-    "bongo",
-    "bonus",
-    "booby",
-    "boost",
-    "booth",
-    "booty",
-    "booze",
-    "boozy",
-    "borax",
-    "borne",
-    "bosom",
-    "bossy",
-    "botch",
-    "bough",
-    "boule",
-    "bound",
-    "bowel",
-    "boxer",
-    "brace",
-    "braid",
-    "brain",
-    "brake",
-    "brand",
-    "brash",
-    "brass",
-    "brave",
-    "bravo",
-    "brawl",
-    "brawn",
-    "bread",
-    "break",
-    "breed",
-    "briar",
-    "bribe",
-    "brick",
-    "bride",
-    "brief",
-    "brine",
-    "bring",
-    "brink",
-    "briny",
-    "brisk",
-    "broad",
-    "broil",
-    "broke",
-    "brood",
-    "brook",
-    "broom",
-    "broth",
-    "brown",
-    "brunt",
-    "brush",
-    "brute",
-    "buddy",
-    "budge",
-    "buggy",
-    "bugle",
-    "build",
-    "built",
-    "bulge",
-    "bulky",
-    "bully",
-    "bunch",
-    "bunny",
-    "burly",
-    "burnt",
-    "burst",
-    "bused",
-    "bushy",
-    "butch",
-    "butte",
-    "buxom",
-    "buyer",
-    "bylaw",
-    "cabal",
-    "cabby",
-    "cabin",
-    "cable",
-    "cacao",
-    "cache",
-    "cacti",
-    "caddy",
-    "cadet",
-    "cagey",
-    "cairn",
-    "camel",
-    "cameo",
-    "canal",
-    "candy",
-    "canny",
-    "canoe",
-    "canon",
-    "caper",
-    "caput",
-    "carat",
-    "cargo",
-    "carol",
-    "carry",
-    "carve",
-    "caste",
-    "catch",
-    "cater",
-    "catty",
-    "caulk",
-    "cause",
-    "cavil",
-    "cease",
-    "cedar",
-    "cello",
-    "chafe",
-    "chaff",
-    "chain",
-    "chair",
-    "chalk",
-    "champ",
-    "chant",
-    "chaos",
-    "chard",
-    "charm",
-    "chart",
-    "chase",
-    "chasm",
-    "cheap",
-    "cheat",
-    "check",
-    "cheek",
-    "cheer",
-    "chess",
-    "chest",
-    "chick",
-    "chide",
-    "chief",
-    "child",
-    "chili",
-    "chill",
-    "chime",
-    "china",
-    "chirp",
-    "chock",
-    "choir",
-    "choke",
-    "chord",
-    "chore",
-    "chose",
-    "chuck",
-    "chump",
-    "chunk",
-    "churn",
-    "chute",
-    "cider",
-    "cigar",
-    "cinch",
-    "circa",
-    "civic",
-    "civil",
-    "clack",
-    "claim",
-    "clamp",
-    "clang",
-    "clank",
-    "clash",
-    "clasp",
-    "class",
-    "clean",
-    "clear",
-    "cleat",
-    "cleft",
-    "clerk",
-    "click",
-    "cliff",
-    "climb",
-    "cling",
-    "clink",
-    "cloak",
-    "clock",
-    "clone",
-    "close",
-    "cloth",
-    "cloud",
-    "clout",
-    "clove",
-    "clown",
-    "cluck",
-    "clued",
-    "clump",
-    "clung",
-    "coach",
-    "coast",
-    "cobra",
-    "cocoa",
-    "colon",
-    "color",
-    "comet",
-    "comfy",
-    "comic",
-    "comma",
-    "conch",
-    "condo",
-    "conic",
-    "copse",
-    "coral",
-    "corer",
-    "corny",
-    "couch",
-    "cough",
-    "could",
-    "count",
-    "coupe",
-    "court",
-    "coven",
-    "cover",
-    "covet",
-    "covey",
-    "cower",
-    "coyly",
-    "crack",
-    "craft",
-    "cramp",
-    "crane",
-    "crank",
-    "crash",
-    "crass",
-    "crate",
-    "crave",
-    "crawl",
-    "craze",
-    "crazy",
-    "creak",
-    "cream",
-    "credo",
-    "creed",
-    "creek",
-    "creep",
-    "creme",
-    "crepe",
-    "crept",
-    "cress",
-    "crest",
-    "crick",
-    "cried",
-    "crier",
-    "crime",
-    "crimp",
-    "crisp",
-    "croak",
-    "crock",
-    "crone",
-    "crony",
-    "crook",
-    "cross",
-    "croup",
-    "crowd",
-    "crown",
-    "crude",
-    "cruel",
-    "crumb",
-    "crump",
-    "crush",
-    "crust",
-    "crypt",
-    "cubic",
-    "cumin",
-    "curio",
-    "curly",
-    "curry",
-    "curse",
-    "curve",
-    "curvy",
-    "cutie",
-    "cyber",
-    "cycle",
-    "cynic",
-    "daddy",
-    "daily",
-    "dairy",
-    "daisy",
-    "dally",
-    "dance",
-    "dandy",
-    "datum",
-    "daunt",
-    "dealt",
-    "death",
-    "debar",
-    "debit",
-    "debug",
-    "debut",
-    "decal",
-    "decay",
-    "decor",
-    "decoy",
-    "decry",
-    "defer",
-    "deign",
-    "deity",
-    "delay",
-    "delta",
-    "delve",
-    "demon",
-    "demur",
-    "denim",
-    "dense",
-    "depot",
-    "depth",
-    "derby",
-    "deter",
-    "detox",
-    "deuce",
-    "devil",
-    "diary",
-    "dicey",
-    "digit",
-    "dilly",
-    "dimly",
-    "diner",
-    "dingo",
-    "dingy",
-    "diode",
-    "dirge",
-    "dirty",
-    "disco",
-    "ditch",
-    "ditto",
-    "ditty",
-    "diver",
-    "dizzy",
-    "dodge",
-    "dodgy",
-    "dogma",
-    "doing",
-    "dolly",
-    "donor",
-    "donut",
-    "dopey",
-    "doubt",
-    "dough",
-    "dowdy",
-    "dowel",
-    "downy",
-    "dowry",
-    "dozen",
-    "draft",
-    "drain",
-    "drake",
-    "drama",
-    "drank",
-    "drape",
-    "drawl",
-    "drawn",
-    "dread",
-    "dream",
-    "dress",
-    "dried",
-    "drier",
-    "drift",
-    "drill",
-    "drink",
-    "drive",
-    "droit",
-    "droll",
-    "drone",
-    "drool",
-    "droop",
-    "dross",
-    "drove",
-    "drown",
-    "druid",
-    "drunk",
-    "dryer",
-    "dryly",
-    "duchy",
-    "dully",
-    "dummy",
-    "dumpy",
-    "dunce",
-    "dusky",
-    "dusty",
-    "dutch",
-    "duvet",
-    "dwarf",
-    "dwell",
-    "dwelt",
-    "dying",
-    "eager",
-    "eagle",
-    "early",
-    "earth",
-    "easel",
-    "eaten",
-    "eater",
-    "ebony",
-    "eclat",
-    "edict",
-    "edify",
-    "eerie",
-    "egret",
-    "eight",
-    "eject",
-    "eking",
-    "elate",
-    "elbow",
-    "elder",
-    "elect",
-    "elegy",
-    "elfin",
-    "elide",
-    "elite",
-    "elope",
-    "elude",
-    "email",
-    "embed",
-    "ember",
-    "emcee",
-    "empty",
-    "enact",
-    "endow",
-    "enema",
-    "enemy",
-    "enjoy",
-    "ennui",
-    "ensue",
-    "enter",
-    "entry",
-    "envoy",
-    "epoch",
-    "epoxy",
-    "equal",
-    "equip",
-    "erase",
-    "erect",
-    "erode",
-    "error",
-    "erupt",
-    "essay",
-    "ester",
-    "ether",
-    "ethic",
-    "ethos",
-    "etude",
-    "evade",
-    "event",
-    "every",
-    "evict",
-    "evoke",
-    "exact",
-    "exalt",
-    "excel",
-    "exert",
-    "exile",
-    "exist",
-    "expel",
-    "extol",
-    "extra",
-    "exult",
-    "eying",
-    "fable",
-    "facet",
-    "faint",
-    "fairy",
-    "faith",
-    "false",
-    "fancy",
-    "fanny",
-    "farce",
-    "fatal",
-    "fatty",
-    "fault",
-    "fauna",
-    "favor",
-    "feast",
-    "fecal",
-    "feign",
-    "fella",
-    "felon",
-    "femme",
-    "femur",
-    "fence",
-    "feral",
-    "ferry",
-    "fetal",
-    "fetch",
-    "fetid",
-    "fetus",
-    "fever",
-    "fewer",
-    "fiber",
-    "fibre",
-    "ficus",
-    "field",
-    "fiend",
-    "fiery",
-    "fifth",
-    "fifty",
-    "fight",
-    "filer",
-    "filet",
-    "filly",
-    "filmy",
-    "filth",
-    "final",
-    "finch",
-    "finer",
-    "first",
-    "fishy",
-    "fixer",
-    "fizzy",
-    "fjord",
-    "flack",
-    "flail",
-    "flair",
-    "flake",
-    "flaky",
-    "flame",
-    "flank",
-    "flare",
-    "flash",
-    "flask",
-    "fleck",
-    "fleet",
-    "flesh",
-    "flick",
-    "flier",
-    "fling",
-    "flint",
-    "flirt",
-    "float",
-    "flock",
-    "flood",
-    "floor",
-    "flora",
-    "floss",
-    "flour",
-    "flout",
-    "flown",
-    "fluff",
-    "fluid",
-    "fluke",
-    "flume",
-    "flung",
-    "flunk",
-    "flush",
-    "flute",
-    "flyer",
-    "foamy",
-    "focal",
-    "focus",
-    "foggy",
-    "foist",
-    "folio",
-    "folly",
-    "foray",
-    "force",
-    "forge",
-    "forgo",
-    "forte",
-    "forth",
-    "forty",
-    "forum",
-    "found",
-    "foyer",
-    "frail",
-    "frame",
-    "frank",
-    "fraud",
-    "freak",
-    "freed",
-    "freer",
-    "fresh",
-    "friar",
-    "fried",
-    "frill",
-    "frisk",
-    "fritz",
-    "frock",
-    "frond",
-    "front",
-    "frost",
-    "froth",
-    "frown",
-    "froze",
-    "fruit",
-    "fudge",
-    "fugue",
-    "fully",
-    "fungi",
-    "funky",
-    "funny",
-    "furor",
-    "furry",
-    "fussy",
-    "fuzzy",
-    "gaffe",
-    "gaily",
-    "gamer",
-    "gamma",
-    "gamut",
-    "gassy",
-    "gaudy",
-    "gauge",
-    "gaunt",
-    "gauze",
-    "gavel",
-    "gawky",
-    "gayer",
-    "gayly",
-    "gazer",
-    "gecko",
-    "geeky",
-    "geese",
-    "genie",
-    "genre",
-    "ghost",
-    "ghoul",
-    "giant",
-    "giddy",
-    "gipsy",
-    "girly",
-    "girth",
-    "given",
-    "giver",
-    "glade",
-    "gland",
-    "glare",
-    "glass",
-    "glaze",
-    "gleam",
-    "glean",
-    "glide",
-    "glint",
-    "gloat",
-    "globe",
-    "gloom",
-    "glory",
-    "gloss",
-    "glove",
-    "glyph",
-    "gnash",
-    "gnome",
-    "godly",
-    "going",
-    "golem",
-    "golly",
-    "gonad",
-    "goner",
-    "goody",
-    "gooey",
-    "goofy",
-    "goose",
-    "gorge",
-    "gouge",
-    "gourd",
-    "grace",
-    "grade",
-    "graft",
-    "grail",
-    "grain",
-    "grand",
-    "grant",
-    "grape",
-    "graph",
-    "grasp",
-    "grass",
-    "grate",
-    "grave",
-    "gravy",
-    "graze",
-    "great",
-    "greed",
-    "green",
-    "greet",
-    "grief",
-    "grill",
-    "grime",
-    "grimy",
-    "grind",
-    "gripe",
-    "groan",
-    "groin",
-    "groom",
-    "grope",
-    "gross",
-    "group",
-    "grout",
-    "grove",
-    "growl",
-    "grown",
-    "gruel",
-    "gruff",
-    "grunt",
-    "guard",
-    "guava",
-    "guess",
-    "guest",
-    "guide",
-    "guild",
-    "guile",
-    "guilt",
-    "guise",
-    "gulch",
-    "gully",
-    "gumbo",
-    "gummy",
-    "guppy",
-    "gusto",
-    "gusty",
-    "gypsy",
-    "habit",
-    "hairy",
-    "halve",
-    "handy",
-    "happy",
-    "hardy",
-    "harem",
-    "harpy",
-    "harry",
-    "harsh",
-    "haste",
-    "hasty",
-    "hatch",
-    "hater",
-    "haunt",
-    "haute",
-    "haven",
-    "havoc",
-    "hazel",
-    "heady",
-    "heard",
-    "heart",
-    "heath",
-    "heave",
-    "heavy",
-    "hedge",
-    "hefty",
-    "heist",
-    "helix",
-    "hello",
-    "hence",
-    "heron",
-    "hilly",
-    "hinge",
-    "hippo",
-    "hippy",
-    "hitch",
-    "hoard",
-    "hobby",
-    "hoist",
-    "holly",
-    "homer",
-    "honey",
-    "honor",
-    "horde",
-    "horny",
-    "horse",
-    "hotel",
-    "hotly",
-    "hound",
-    "house",
-    "hovel",
-    "hover",
-    "howdy",
-    "human",
-    "humid",
-    "humor",
-    "humph",
-    "humus",
-    "hunch",
-    "hunky",
-    "hurry",
-    "husky",
-    "hussy",
-    "hutch",
-    "hydro",
-    "hyena",
-    "hymen",
-    "hyper",
-    "icily",
-    "icing",
-    "ideal",
-    "idiom",
-    "idiot",
-    "idler",
-    "idyll",
-    "igloo",
-    "iliac",
-    "image",
-    "imbue",
-    "impel",
-    "imply",
-    "inane",
-    "inbox",
-    "incur",
-    "index",
-    "inept",
-    "inert",
-    "infer",
-    "ingot",
-    "inlay",
-    "inlet",
-    "inner",
-    "input",
-    "inter",
-    "intro",
-    "ionic",
-    "irate",
-    "irony",
-    "islet",
-    "issue",
-    "itchy",
-    "ivory",
-    "jaunt",
-    "jazzy",
-    "jelly",
-    "jerky",
-    "jetty",
-    "jewel",
-    "jiffy",
-    "joint",
-    "joist",
-    "joker",
-    "jolly",
-    "joust",
-    "judge",
-    "juice",
-    "juicy",
-    "jumbo",
-    "jumpy",
-    "junta",
-    "junto",
-    "juror",
-    "kappa",
-    "karma",
-    "kayak",
-    "kebab",
-    "khaki",
-    "kinky",
-    "kiosk",
-    "kitty",
-    "knack",
-    "knave",
-    "knead",
-    "kneed",
-    "kneel",
-    "knelt",
-    "knife",
-    "knock",
-    "knoll",
-    "known",
-    "koala",
-    "krill",
-    "label",
-    "labor",
-    "laden",
-    "ladle",
-    "lager",
-    "lance",
-    "lanky",
-    "lapel",
-    "lapse",
-    "large",
-    "larva",
-    "lasso",
-    "latch",
-    "later",
-    "lathe",
-    "latte",
-    "laugh",
-    "layer",
-    "leach",
-    "leafy",
-    "leaky",
-    "leant",
-    "leapt",
-    "learn",
-    "lease",
-    "leash",
-    "least",
-    "leave",
-    "ledge",
-    "leech",
-    "leery",
-    "lefty",
-    "legal",
-    "leggy",
-    "lemon",
-    "lemur",
-    "leper",
-    "level",
-    "lever",
-    "libel",
-    "liege",
-    "light",
-    "liken",
-    "lilac",
-    "limbo",
-    "limit",
-    "linen",
-    "liner",
-    "lingo",
-    "lipid",
-    "lithe",
-    "liver",
-    "livid",
-    "llama",
-    "loamy",
-    "loath",
-    "lobby",
-    "local",
-    "locus",
-    "lodge",
-    "lofty",
-    "logic",
-    "login",
-    "loopy",
-    "loose",
-    "lorry",
-    "loser",
-    "louse",
-    "lousy",
-    "lover",
-    "lower",
-    "lowly",
-    "loyal",
-    "lucid",
-    "lucky",
-    "lumen",
-    "lumpy",
-    "lunar",
-    "lunch",
-    "lunge",
-    "lupus",
-    "lurch",
-    "lurid",
-    "lusty",
-    "lying",
-    "lymph",
-    "lynch",
-    "lyric",
-    "macaw",
-    "macho",
-    "macro",
-    "madam",
-    "madly",
-    "mafia",
-    "magic",
-    "magma",
-    "maize",
-    "major",
-    "maker",
-    "mambo",
-    "mamma",
-    "mammy",
-    "manga",
-    "mange",
-    "mango",
-    "mangy",
-    "mania",
-    "manic",
-    "manly",
-    "manor",
-    "maple",
-    "march",
-    "marry",
-    "marsh",
-    "mason",
-    "masse",
-    "match",
-    "matey",
-    "mauve",
-    "maxim",
-    "maybe",
-    "mayor",
-    "mealy",
-    "meant",
-    "meaty",
-    "mecca",
-    "medal",
-    "media",
-    "medic",
-    "melee",
-    "melon",
-    "mercy",
-    "merge",
-    "merit",
-    "merry",
-    "metal",
-    "meter",
-    "metro",
-    "micro",
-    "midge",
-    "midst",
-    "might",
-    "milky",
-    "mimic",
-    "mince",
-    "miner",
-    "minim",
-    "minor",
-    "minty",
-    "minus",
-    "mirth",
-    "miser",
-    "missy",
-    "mocha",
-    "modal",
-    "model",
-    "modem",
-    "mogul",
-    "moist",
-    "molar",
-    "moldy",
-    "money",
-    "month",
-    "moody",
-    "moose",
-    "moral",
-    "moron",
-    "morph",
-    "mossy",
-    "motel",
-    "motif",
-    "motor",
-    "motto",
-    "moult",
-    "mound",
-    "mount",
-    "mourn",
-    "mouse",
-    "mouth",
-    "mover",
-    "movie",
-    "mower",
-    "mucky",
-    "mucus",
-    "muddy",
-    "mulch",
-    "mummy",
-    "munch",
-    "mural",
-    "murky",
-    "mushy",
-    "music",
-    "musky",
-    "musty",
-    "myrrh",
-    "nadir",
-    "naive",
-    "nanny",
-    "nasal",
-    "nasty",
-    "natal",
-    "naval",
-    "navel",
-    "needy",
-    "neigh",
-    "nerdy",
-    "nerve",
-    "never",
-    "newer",
-    "newly",
-    "nicer",
-    "niche",
-    "niece",
-    "night",
-    "ninja",
-    "ninny",
-    "ninth",
-    "noble",
-    "nobly",
-    "noise",
-    "noisy",
-    "nomad",
-    "noose",
-    "north",
-    "nosey",
-    "notch",
-    "novel",
-    "nudge",
-    "nurse",
-    "nutty",
-    "nylon",
-    "nymph",
-    "oaken",
-    "obese",
-    "occur",
-    "ocean",
-    "octal",
-    "octet",
-    "odder",
-    "oddly",
-    "offal",
-    "offer",
-    "often",
-    "olden",
-    "older",
-    "olive",
-    "ombre",
-    "omega",
-    "onion",
-    "onset",
-    "opera",
-    "opine",
-    "opium",
-    "optic",
-    "orbit",
-    "order",
-    "organ",
-    "other",
-    "otter",
-    "ought",
-    "ounce",
-    "outdo",
-    "outer",
-    "outgo",
-    "ovary",
-    "ovate",
-    "overt",
-    "ovine",
-    "ovoid",
-    "owing",
-    "owner",
-    "oxide",
-    "ozone",
-    "paddy",
-    "pagan",
-    "paint",
-    "paler",
-    "palsy",
-    "panel",
-    "panic",
-    "pansy",
-    "papal",
-    "paper",
-    "parer",
-    "parka",
-    "parry",
-    "parse",
-    "party",
-    "pasta",
-    "paste",
-    "pasty",
-    "patch",
-    "patio",
-    "patsy",
-    "patty",
-    "pause",
-    "payee",
-    "payer",
-    "peace",
-    "peach",
-    "pearl",
-    "pecan",
-    "pedal",
-    "penal",
-    "pence",
-    "penne",
-    "penny",
-    "perch",
-    "peril",
-    "perky",
-    "pesky",
-    "pesto",
-    "petal",
-    "petty",
-    "phase",
-    "phone",
-    "phony",
-    "photo",
-    "piano",
-    "picky",
-    "piece",
-    "piety",
-    "piggy",
-    "pilot",
-    "pinch",
-    "piney",
-    "pinky",
-    "pinto",
-    "piper",
-    "pique",
-    "pitch",
-    "pithy",
-    "pivot",
-    "pixel",
-    "pixie",
-    "pizza",
-    "place",
-    "plaid",
-    "plain",
-    "plait",
-    "plane",
-    "plank",
-    "plant",
-    "plate",
-    "plaza",
-    "plead",
-    "pleat",
-    "plied",
-    "plier",
-    "pluck",
-    "plumb",
-    "plume",
-    "plump",
-    "plunk",
-    "plush",
-    "poesy",
-    "point",
-    "poise",
-    "poker",
-    "polar",
-    "polka",
-    "polyp",
-    "pooch",
-    "poppy",
-    "porch",
-    "poser",
-    "posit",
-    "posse",
-    "pouch",
-    "pound",
-    "pouty",
-    "power",
-    "prank",
-    "prawn",
-    "preen",
-    "press",
-    "price",
-    "prick",
-    "pride",
-    "pried",
-    "prime",
-    "primo",
-    "print",
-    "prior",
-    "prism",
-    "privy",
-    "prize",
-    "probe",
-    "prone",
-    "prong",
-    "proof",
-    "prose",
-    "proud",
-    "prove",
-    "prowl",
-    "proxy",
-    "prude",
-    "prune",
-    "psalm",
-    "pubic",
-    "pudgy",
-    "puffy",
-    "pulpy",
-    "pulse",
-    "punch",
-    "pupal",
-    "pupil",
-    "puppy",
-    "puree",
-    "purer",
-    "purge",
-    "purse",
-    "pushy",
-    "putty",
-    "pygmy",
-    "quack",
-    "quail",
-    "quake",
-    "qualm",
-    "quark",
-    "quart",
-    "quash",
-    "quasi",
-    "queen",
-    "queer",
-    "quell",
-    "query",
-    "quest",
-    "queue",
-    "quick",
-    "quiet",
-    "quill",
-    "quilt",
-    "quirk",
-    "quite",
-    "quota",
-    "quote",
-    "quoth",
-    "rabbi",
-    "rabid",
-    "racer",
-    "radar",
-    "radii",
-    "radio",
-    "rainy",
-    "raise",
-    "rajah",
-    "rally",
-    "ralph",
-    "ramen",
-    "ranch",
-    "randy",
-    "range",
-    "rapid",
-    "rarer",
-    "raspy",
-    "ratio",
-    "ratty",
-    "raven",
-    "rayon",
-    "razor",
-    "reach",
-    "react",
-    "ready",
-    "realm",
-    "rearm",
-    "rebar",
-    "rebel",
-    "rebus",
-    "rebut",
-    "recap",
-    "recur",
-    "recut",
-    "reedy",
-    "refer",
-    "refit",
-    "regal",
-    "rehab",
-    "reign",
-    "relax",
-    "relay",
-    "relic",
-    "remit",
-    "renal",
-    "renew",
-    "repay",
-    "repel",
-    "reply",
-    "rerun",
-    "reset",
-    "resin",
-    "retch",
-    "retro",
-    "retry",
-    "reuse",
-    "revel",
-    "revue",
-    "rhino",
-    "rhyme",
-    "rider",
-    "ridge",
-    "rifle",
-    "right",
-    "rigid",
-    "rigor",
-    "rinse",
-    "ripen",
-    "riper",
-    "risen",
-    "riser",
-    "risky",
-    "rival",
-    "river",
-    "rivet",
-    "roach",
-    "roast",
-    "robin",
-    "robot",
-    "rocky",
-    "rodeo",
-    "roger",
-    "rogue",
-    "roomy",
-    "roost",
-    "rotor",
-    "rouge",
-    "rough",
-    "round",
-    "rouse",
-    "route",
-    "rover",
-    "rowdy",
-    "rower",
-    "royal",
-    "ruddy",
-    "ruder",
-    "rugby",
-    "ruler",
-    "rumba",
-    "rumor",
-    "rupee",
-    "rural",
-    "rusty",
-    "sadly",
-    "safer",
-    "saint",
-    "salad",
-    "sally",
-    "salon",
-    "salsa",
-    "salty",
-    "salve",
-    "salvo",
-    "sandy",
-    "saner",
-    "sappy",
-    "sassy",
-    "satin",
-    "satyr",
-    "sauce",
-    "saucy",
-    "sauna",
-    "saute",
-    "savor",
-    "savoy",
-    "savvy",
-    "scald",
-    "scale",
-    "scalp",
-    "scaly",
-    "scamp",
-    "scant",
-    "scare",
-    "scarf",
-    "scary",
-    "scene",
-    "scent",
-    "scion",
-    "scoff",
-    "scold",
-    "scone",
-    "scoop",
-    "scope",
-    "score",
-    "scorn",
-    "scour",
-    "scout",
-    "scowl",
-    "scram",
-    "scrap",
-    "scree",
-    "screw",
-    "scrub",
-    "scrum",
-    "scuba",
-    "sedan",
-    "seedy",
-    "segue",
-    "seize",
-    "semen",
-    "sense",
-    "sepia",
-    "serif",
-    "serum",
-    "serve",
-    "setup",
-    "seven",
-    "sever",
-    "sewer",
-    "shack",
-    "shade",
-    "shady",
-    "shaft",
-    "shake",
-    "shaky",
-    "shale",
-    "shall",
-    "shalt",
-    "shame",
-    "shank",
-    "shape",
-    "shard",
-    "share",
-    "shark",
-    "sharp",
-    "shave",
-    "shawl",
-    "shear",
-    "sheen",
-    "sheep",
-    "sheer",
-    "sheet",
-    "sheik",
-    "shelf",
-    "shell",
-    "shied",
-    "shift",
-    "shine",
-    "shiny",
-    "shire",
-    "shirk",
-    "shirt",
-    "shoal",
-    "shock",
-    "shone",
-    "shook",
-    "shoot",
-    "shore",
-    "shorn",
-    "short",
-    "shout",
-    "shove",
-    "shown",
-    "showy",
-    "shrew",
-    "shrub",
-    "shrug",
-    "shuck",
-    "shunt",
-    "shush",
-    "shyly",
-    "siege",
-    "sieve",
-    "sight",
-    "sigma",
-    "silky",
-    "silly",
-    "since",
-    "sinew",
-    "singe",
-    "siren",
-    "sissy",
-    "sixth",
-    "sixty",
-    "skate",
-    "skier",
-    "skiff",
-    "skill",
-    "skimp",
-    "skirt",
-    "skulk",
-    "skull",
-    "skunk",
-    "slack",
-    "slain",
-    "slang",
-    "slant",
-    "slash",
-    "slate",
-    "slave",
-    "sleek",
-    "sleep",
-    "sleet",
-    "slept",
-    "slice",
-    "slick",
-    "slide",
-    "slime",
-    "slimy",
-    "sling",
-    "slink",
-    "sloop",
-    "slope",
-    "slosh",
-    "sloth",
-    "slump",
-    "slung",
-    "slunk",
-    "slurp",
-    "slush",
-    "slyly",
-    "smack",
-    "small",
-    "smart",
-    "smash",
-    "smear",
-    "smell",
-    "smelt",
-    "smile",
-    "smirk",
-    "smite",
-    "smith",
-    "smock",
-    "smoke",
-    "smoky",
-    "smote",
-    "snack",
-    "snail",
-    "snake",
-    "snaky",
-    "snare",
-    "snarl",
-    "sneak",
-    "sneer",
-    "snide",
-    "sniff",
-    "snipe",
-    "snoop",
-    "snore",
-    "snort",
-    "snout",
-    "snowy",
-    "snuck",
-    "snuff",
-    "soapy",
-    "sober",
-    "soggy",
-    "solar",
-    "solid",
-    "solve",
-    "sonar",
-    "sonic",
-    "sooth",
-    "sooty",
-    "sorry",
-    "sound",
-    "south",
-    "sower",
-    "space",
-    "spade",
-    "spank",
-    "spare",
-    "spark",
-    "spasm",
-    "spawn",
-    "speak",
-    "spear",
-    "speck",
-    "speed",
-    "spell",
-    "spelt",
-    "spend",
-    "spent",
-    "sperm",
-    "spice",
-    "spicy",
-    "spied",
-    "spiel",
-    "spike",
-    "spiky",
-    "spill",
-    "spilt",
-    "spine",
-    "spiny",
-    "spire",
-    "spite",
-    "splat",
-    "split",
-    "spoil",
-    "spoke",
-    "spoof",
-    "spook",
-    "spool",
-    "spoon",
-    "spore",
-    "sport",
-    "spout",
-    "spray",
-    "spree",
-    "sprig",
-    "spunk",
-    "spurn",
-    "spurt",
-    "squad",
-    "squat",
-    "squib",
-    "stack",
-    "staff",
-    "stage",
-    "staid",
-    "stain",
-    "stair",
-    "stake",
-    "stale",
-    "stalk",
-    "stall",
-    "stamp",
-    "stand",
-    "stank",
-    "stare",
-    "stark",
-    "start",
-    "stash",
-    "state",
-    "stave",
-    "stead",
-    "steak",
-    "steal",
-    "steam",
-    "steed",
-    "steel",
-    "steep",
-    "steer",
-    "stein",
-    "stern",
-    "stick",
-    "stiff",
-    "still",
-    "stilt",
-    "sting",
-    "stink",
-    "stint",
-    "stock",
-    "stoic",
-    "stoke",
-    "stole",
-    "stomp",
-    "stone",
-    "stony",
-    "stood",
-    "stool",
-    "stoop",
-    "store",
-    "stork",
-    "storm",
-    "story",
-    "stout",
-    "stove",
-    "strap",
-    "straw",
-    "stray",
-    "strip",
-    "strut",
-    "stuck",
-    "study",
-    "stuff",
-    "stump",
-    "stung",
-    "stunk",
-    "stunt",
-    "style",
-    "suave",
-    "sugar",
-    "suing",
-    "suite",
-    "sulky",
-    "sully",
-    "sumac",
-    "sunny",
-    "super",
-    "surer",
-    "surge",
-    "surly",
-    "sushi",
-    "swami",
-    "swamp",
-    "swarm",
-    "swash",
-    "swath",
-    "swear",
-    "sweat",
-    "sweep",
-    "sweet",
-    "swell",
-    "swept",
-    "swift",
-    "swill",
-    "swine",
-    "swing",
-    "swirl",
-    "swish",
-    "swoon",
-    "swoop",
-    "sword",
-    "swore",
-    "sworn",
-    "swung",
-    "synod",
-    "syrup",
-    "tabby",
-    "table",
-    "taboo",
-    "tacit",
-    "tacky",
-    "taffy",
-    "taint",
-    "taken",
-    "taker",
-    "tally",
-    "talon",
-    "tamer",
-    "tango",
-    "tangy",
-    "taper",
-    "tapir",
-    "tardy",
-    "tarot",
-    "taste",
-    "tasty",
-    "tatty",
-    "taunt",
-    "tawny",
-    "teach",
-    "teary",
-    "tease",
-    "teddy",
-    "teeth",
-    "tempo",
-    "tenet",
-    "tenor",
-    "tense",
-    "tenth",
-    "tepee",
-    "tepid",
-    "terra",
-    "terse",
-    "testy",
-    "thank",
-    "theft",
-    "their",
-    "theme",
-    "there",
-    "these",
-    "theta",
-    "thick",
-    "thief",
-    "thigh",
-    "thing",
-    "think",
-    "third",
-    "thong",
-    "thorn",
-    "those",
-    "three",
-    "threw",
-    "throb",
-    "throw",
-    "thrum",
-    "thumb",
-    "thump",
-    "thyme",
-    "tiara",
-    "tibia",
-    "tidal",
-    "tiger",
-    "tight",
-    "tilde",
-    "timer",
-    "timid",
-    "tipsy",
-    "titan",
-    "tithe",
-    "title",
-    "toast",
-    "today",
-    "toddy",
-    "token",
-    "tonal",
-    "tonga",
-    "tonic",
-    "tooth",
-    "topaz",
-    "topic",
-    "torch",
-    "torso",
-    "torus",
-    "total",
-    "totem",
-    "touch",
-    "tough",
-    "towel",
-    "tower",
-    "toxic",
-    "toxin",
-    "trace",
-    "track",
-    "tract",
-    "trade",
-    "trail",
-    "train",
-    "trait",
-    "tramp",
-    "trash",
-    "trawl",
-    "tread",
-    "treat",
-    "trend",
-    "triad",
-    "trial",
-    "tribe",
-    "trice",
-    "trick",
-    "tried",
-    "tripe",
-    "trite",
-    "troll",
-    "troop",
-    "trope",
-    "trout",
-    "trove",
-    "truce",
-    "truck",
-    "truer",
-    "truly",
-    "trump",
-    "trunk",
-    "truss",
-    "trust",
-    "truth",
-    "tryst",
-    "tubal",
-    "tuber",
-    "tulip",
-    "tulle",
-    "tumor",
-    "tunic",
-    "turbo",
-    "tutor",
-    "twang",
-    "tweak",
-    "tweed",
-    "tweet",
-    "twice",
-    "twine",
-    "twirl",
-    "twist",
-    "twixt",
-    "tying",
-    "udder",
-    "ulcer",
-    "ultra",
-    "umbra",
-    "uncle",
-    "uncut",
-    "under",
-    "undid",
-    "undue",
-    "unfed",
-    "unfit",
-    "unify",
-    "union",
-    "unite",
-    "unity",
-    "unlit",
-    "unmet",
-    "unset",
-    "untie",
-    "until",
-    "unwed",
-    "unzip",
-    "upper",
-    "upset",
-    "urban",
-    "urine",
-    "usage",
-    "usher",
-    "using",
-    "usual",
-    "usurp",
-    "utile",
-    "utter",
-    "vague",
-    "valet",
-    "valid",
-    "valor",
-    "value",
-    "valve",
-    "vapid",
-    "vapor",
-    "vault",
-    "vaunt",
-    "vegan",
-    "venom",
-    "venue",
-    "verge",
-    "verse",
-    "verso",
-    "verve",
-    "vicar",
-    "video",
-    "vigil",
-    "vigor",
-    "villa",
-    "vinyl",
-    "viola",
-    "viper",
-    "viral",
-    "virus",
-    "visit",
-    "visor",
-    "vista",
-    "vital",
-    "vivid",
-    "vixen",
-    "vocal",
-    "vodka",
-    "vogue",
-    "voice",
-    "voila",
-    "vomit",
-    "voter",
-    "vouch",
-    "vowel",
-    "vying",
-    "wacky",
-    "wafer",
-    "wager",
-    "wagon",
-    "waist",
-    "waive",
-    "waltz",
-    "warty",
-    "waste",
-    "watch",
-    "water",
-    "waver",
-    "waxen",
-    "weary",
-    "weave",
-    "wedge",
-    "weedy",
-    "weigh",
-    "weird",
-    "welch",
-    "welsh",
-    "wench",
-    "whack",
-    "whale",
-    "wharf",
-    "wheat",
-    "wheel",
-    "whelp",
-    "where",
-    "which",
-    "whiff",
-    "while",
-    "whine",
-    "whiny",
-    "whirl",
-    "whisk",
-    "white",
-    "whole",
-    "whoop",
-    "whose",
-    "widen",
-    "wider",
-    "widow",
-    "width",
-    "wield",
-    "wight",
-    "willy",
-    "wimpy",
-    "wince",
-    "winch",
-    "windy",
-    "wiser",
-    "wispy",
-    "witch",
-    "witty",
-    "woken",
-    "woman",
-    "women",
-    "woody",
-    "wooer",
-    "wooly",
-    "woozy",
-    "wordy",
-    "world",
-    "worry",
-    "worse",
-    "worst",
-    "worth",
-    "would",
-    "wound",
-    "woven",
-    "wrack",
-    "wrath",
-    "wreak",
-    "wreck",
-    "wrest",
-    "wring",
-    "wrist",
-    "write",
-    "wrong",
-    "wrote",
-    "wrung",
-    "wryly",
-    "yacht",
-    "yearn",
-    "yeast",
-    "yield",
-    "young",
-    "youth",
-    "zebra",
-    "zesty",
-    "zonal"
+const char VALID_WORDS[][5] = {
+    {'a','b','a','c','k'},
+    {'a','b','a','s','e'},
+    {'a','b','a','t','e'},
+    {'a','b','b','e','y'},
+    {'a','b','b','o','t'},
+    {'a','b','h','o','r'},
+    {'a','b','i','d','e'},
+    {'a','b','l','e','d'},
+    {'a','b','o','d','e'},
+    {'a','b','o','r','t'},
+    {'a','b','o','u','t'},
+    {'a','b','o','v','e'},
+    {'a','b','u','s','e'},
+    {'a','b','y','s','s'},
+    {'a','c','o','r','n'},
+    {'a','c','r','i','d'},
+    {'a','c','t','o','r'},
+    {'a','c','u','t','e'},
+    {'a','d','a','g','e'},
+    {'a','d','a','p','t'},
+    {'a','d','e','p','t'},
+    {'a','d','m','i','n'},
+    {'a','d','m','i','t'},
+    {'a','d','o','b','e'},
+    {'a','d','o','p','t'},
+    {'a','d','o','r','e'},
+    {'a','d','o','r','n'},
+    {'a','d','u','l','t'},
+    {'a','f','f','i','x'},
+    {'a','f','i','r','e'},
+    {'a','f','o','o','t'},
+    {'a','f','o','u','l'},
+    {'a','f','t','e','r'},
+    {'a','g','a','i','n'},
+    {'a','g','a','p','e'},
+    {'a','g','a','t','e'},
+    {'a','g','e','n','t'},
+    {'a','g','i','l','e'},
+    {'a','g','i','n','g'},
+    {'a','g','l','o','w'},
+    {'a','g','o','n','y'},
+    {'a','g','o','r','a'},
+    {'a','g','r','e','e'},
+    {'a','h','e','a','d'},
+    {'a','i','d','e','r'},
+    {'a','i','s','l','e'},
+    {'a','l','a','r','m'},
+    {'a','l','b','u','m'},
+    {'a','l','e','r','t'},
+    {'a','l','g','a','e'},
+    {'a','l','i','b','i'},
+    {'a','l','i','e','n'},
+    {'a','l','i','g','n'},
+    {'a','l','i','k','e'},
+    {'a','l','i','v','e'},
+    {'a','l','l','a','y'},
+    {'a','l','l','e','y'},
+    {'a','l','l','o','t'},
+    {'a','l','l','o','w'},
+    {'a','l','l','o','y'},
+    {'a','l','o','f','t'},
+    {'a','l','o','n','e'},
+    {'a','l','o','n','g'},
+    {'a','l','o','o','f'},
+    {'a','l','o','u','d'},
+    {'a','l','p','h','a'},
+    {'a','l','t','a','r'},
+    {'a','l','t','e','r'},
+    {'a','m','a','s','s'},
+    {'a','m','a','z','e'},
+    {'a','m','b','e','r'},
+    {'a','m','b','l','e'},
+    {'a','m','e','n','d'},
+    {'a','m','i','s','s'},
+    {'a','m','i','t','y'},
+    {'a','m','o','n','g'},
+    {'a','m','p','l','e'},
+    {'a','m','p','l','y'},
+    {'a','m','u','s','e'},
+    {'a','n','g','e','l'},
+    {'a','n','g','e','r'},
+    {'a','n','g','l','e'},
+    {'a','n','g','r','y'},
+    {'a','n','g','s','t'},
+    {'a','n','i','m','e'},
+    {'a','n','k','l','e'},
+    {'a','n','n','e','x'},
+    {'a','n','n','o','y'},
+    {'a','n','n','u','l'},
+    {'a','n','o','d','e'},
+    {'a','n','t','i','c'},
+    {'a','n','v','i','l'},
+    {'a','o','r','t','a'},
+    {'a','p','a','r','t'},
+    {'a','p','h','i','d'},
+    {'a','p','i','n','g'},
+    {'a','p','n','e','a'},
+    {'a','p','p','l','e'},
+    {'a','p','p','l','y'},
+    {'a','p','r','o','n'},
+    {'a','p','t','l','y'},
+    {'a','r','b','o','r'},
+    {'a','r','d','o','r'},
+    {'a','r','e','n','a'},
+    {'a','r','g','u','e'},
+    {'a','r','i','s','e'},
+    {'a','r','m','o','r'},
+    {'a','r','o','m','a'},
+    {'a','r','o','s','e'},
+    {'a','r','r','a','y'},
+    {'a','r','r','o','w'},
+    {'a','r','s','o','n'},
+    {'a','r','t','s','y'},
+    {'a','s','c','o','t'},
+    {'a','s','h','e','n'},
+    {'a','s','i','d','e'},
+    {'a','s','k','e','w'},
+    {'a','s','s','a','y'},
+    {'a','s','s','e','t'},
+    {'a','t','o','l','l'},
+    {'a','t','o','n','e'},
+    {'a','t','t','i','c'},
+    {'a','u','d','i','o'},
+    {'a','u','d','i','t'},
+    {'a','u','g','u','r'},
+    {'a','u','n','t','y'},
+    {'a','v','a','i','l'},
+    {'a','v','e','r','t'},
+    {'a','v','i','a','n'},
+    {'a','v','o','i','d'},
+    {'a','w','a','i','t'},
+    {'a','w','a','k','e'},
+    {'a','w','a','r','d'},
+    {'a','w','a','r','e'},
+    {'a','w','a','s','h'},
+    {'a','w','f','u','l'},
+    {'a','w','o','k','e'},
+    {'a','x','i','a','l'},
+    {'a','x','i','o','m'},
+    {'a','x','i','o','n'},
+    {'a','z','u','r','e'},
+    {'b','a','c','o','n'},
+    {'b','a','d','g','e'},
+    {'b','a','d','l','y'},
+    {'b','a','g','e','l'},
+    {'b','a','g','g','y'},
+    {'b','a','k','e','r'},
+    {'b','a','l','e','r'},
+    {'b','a','l','m','y'},
+    {'b','a','n','a','l'},
+    {'b','a','n','j','o'},
+    {'b','a','r','g','e'},
+    {'b','a','r','o','n'},
+    {'b','a','s','a','l'},
+    {'b','a','s','i','c'},
+    {'b','a','s','i','l'},
+    {'b','a','s','i','n'},
+    {'b','a','s','i','s'},
+    {'b','a','s','t','e'},
+    {'b','a','t','c','h'},
+    {'b','a','t','h','e'},
+    {'b','a','t','o','n'},
+    {'b','a','t','t','y'},
+    {'b','a','w','d','y'},
+    {'b','a','y','o','u'},
+    {'b','e','a','c','h'},
+    {'b','e','a','d','y'},
+    {'b','e','a','r','d'},
+    {'b','e','a','s','t'},
+    {'b','e','e','c','h'},
+    {'b','e','e','f','y'},
+    {'b','e','f','i','t'},
+    {'b','e','g','a','n'},
+    {'b','e','g','a','t'},
+    {'b','e','g','e','t'},
+    {'b','e','g','i','n'},
+    {'b','e','g','u','n'},
+    {'b','e','i','n','g'},
+    {'b','e','l','c','h'},
+    {'b','e','l','i','e'},
+    {'b','e','l','l','e'},
+    {'b','e','l','l','y'},
+    {'b','e','l','o','w'},
+    {'b','e','n','c','h'},
+    {'b','e','r','e','t'},
+    {'b','e','r','r','y'},
+    {'b','e','r','t','h'},
+    {'b','e','s','e','t'},
+    {'b','e','t','e','l'},
+    {'b','e','v','e','l'},
+    {'b','e','z','e','l'},
+    {'b','i','b','l','e'},
+    {'b','i','c','e','p'},
+    {'b','i','d','d','y'},
+    {'b','i','g','o','t'},
+    {'b','i','l','g','e'},
+    {'b','i','l','l','y'},
+    {'b','i','n','g','e'},
+    {'b','i','n','g','o'},
+    {'b','i','o','m','e'},
+    {'b','i','r','c','h'},
+    {'b','i','r','t','h'},
+    {'b','i','s','o','n'},
+    {'b','i','t','t','y'},
+    {'b','l','a','c','k'},
+    {'b','l','a','d','e'},
+    {'b','l','a','m','e'},
+    {'b','l','a','n','d'},
+    {'b','l','a','n','k'},
+    {'b','l','a','r','e'},
+    {'b','l','a','s','t'},
+    {'b','l','a','z','e'},
+    {'b','l','e','a','k'},
+    {'b','l','e','a','t'},
+    {'b','l','e','e','d'},
+    {'b','l','e','e','p'},
+    {'b','l','e','n','d'},
+    {'b','l','e','s','s'},
+    {'b','l','i','m','p'},
+    {'b','l','i','n','d'},
+    {'b','l','i','n','k'},
+    {'b','l','i','s','s'},
+    {'b','l','i','t','z'},
+    {'b','l','o','a','t'},
+    {'b','l','o','c','k'},
+    {'b','l','o','k','e'},
+    {'b','l','o','n','d'},
+    {'b','l','o','o','d'},
+    {'b','l','o','o','m'},
+    {'b','l','o','w','n'},
+    {'b','l','u','e','r'},
+    {'b','l','u','f','f'},
+    {'b','l','u','n','t'},
+    {'b','l','u','r','b'},
+    {'b','l','u','r','t'},
+    {'b','l','u','s','h'},
+    {'b','o','a','r','d'},
+    {'b','o','a','s','t'},
+    {'b','o','b','b','y'},
+    {'b','o','n','e','y'},
+    {'b','o','n','g','o'},
+    {'b','o','n','u','s'},
+    {'b','o','o','b','y'},
+    {'b','o','o','s','t'},
+    {'b','o','o','t','h'},
+    {'b','o','o','t','y'},
+    {'b','o','o','z','e'},
+    {'b','o','o','z','y'},
+    {'b','o','r','a','x'},
+    {'b','o','r','n','e'},
+    {'b','o','s','o','m'},
+    {'b','o','s','s','y'},
+    {'b','o','t','c','h'},
+    {'b','o','u','g','h'},
+    {'b','o','u','l','e'},
+    {'b','o','u','n','d'},
+    {'b','o','w','e','l'},
+    {'b','o','x','e','r'},
+    {'b','r','a','c','e'},
+    {'b','r','a','i','d'},
+    {'b','r','a','i','n'},
+    {'b','r','a','k','e'},
+    {'b','r','a','n','d'},
+    {'b','r','a','s','h'},
+    {'b','r','a','s','s'},
+    {'b','r','a','v','e'},
+    {'b','r','a','v','o'},
+    {'b','r','a','w','l'},
+    {'b','r','a','w','n'},
+    {'b','r','e','a','d'},
+    {'b','r','e','a','k'},
+    {'b','r','e','e','d'},
+    {'b','r','i','a','r'},
+    {'b','r','i','b','e'},
+    {'b','r','i','c','k'},
+    {'b','r','i','d','e'},
+    {'b','r','i','e','f'},
+    {'b','r','i','n','e'},
+    {'b','r','i','n','g'},
+    {'b','r','i','n','k'},
+    {'b','r','i','n','y'},
+    {'b','r','i','s','k'},
+    {'b','r','o','a','d'},
+    {'b','r','o','i','l'},
+    {'b','r','o','k','e'},
+    {'b','r','o','o','d'},
+    {'b','r','o','o','k'},
+    {'b','r','o','o','m'},
+    {'b','r','o','t','h'},
+    {'b','r','o','w','n'},
+    {'b','r','u','n','t'},
+    {'b','r','u','s','h'},
+    {'b','r','u','t','e'},
+    {'b','u','d','d','y'},
+    {'b','u','d','g','e'},
+    {'b','u','g','g','y'},
+    {'b','u','g','l','e'},
+    {'b','u','i','l','d'},
+    {'b','u','i','l','t'},
+    {'b','u','l','g','e'},
+    {'b','u','l','k','y'},
+    {'b','u','l','l','y'},
+    {'b','u','n','c','h'},
+    {'b','u','n','n','y'},
+    {'b','u','r','l','y'},
+    {'b','u','r','n','t'},
+    {'b','u','r','s','t'},
+    {'b','u','s','e','d'},
+    {'b','u','s','h','y'},
+    {'b','u','t','c','h'},
+    {'b','u','t','t','e'},
+    {'b','u','x','o','m'},
+    {'b','u','y','e','r'},
+    {'b','y','l','a','w'},
+    {'c','a','b','a','l'},
+    {'c','a','b','b','y'},
+    {'c','a','b','i','n'},
+    {'c','a','b','l','e'},
+    {'c','a','c','a','o'},
+    {'c','a','c','h','e'},
+    {'c','a','c','t','i'},
+    {'c','a','d','d','y'},
+    {'c','a','d','e','t'},
+    {'c','a','g','e','y'},
+    {'c','a','i','r','n'},
+    {'c','a','m','e','l'},
+    {'c','a','m','e','o'},
+    {'c','a','n','a','l'},
+    {'c','a','n','d','y'},
+    {'c','a','n','n','y'},
+    {'c','a','n','o','e'},
+    {'c','a','n','o','n'},
+    {'c','a','p','e','r'},
+    {'c','a','p','u','t'},
+    {'c','a','r','a','t'},
+    {'c','a','r','g','o'},
+    {'c','a','r','o','l'},
+    {'c','a','r','r','y'},
+    {'c','a','r','v','e'},
+    {'c','a','s','t','e'},
+    {'c','a','t','c','h'},
+    {'c','a','t','e','r'},
+    {'c','a','t','t','y'},
+    {'c','a','u','l','k'},
+    {'c','a','u','s','e'},
+    {'c','a','v','i','l'},
+    {'c','e','a','s','e'},
+    {'c','e','d','a','r'},
+    {'c','e','l','l','o'},
+    {'c','h','a','f','e'},
+    {'c','h','a','f','f'},
+    {'c','h','a','i','n'},
+    {'c','h','a','i','r'},
+    {'c','h','a','l','k'},
+    {'c','h','a','m','p'},
+    {'c','h','a','n','t'},
+    {'c','h','a','o','s'},
+    {'c','h','a','r','d'},
+    {'c','h','a','r','m'},
+    {'c','h','a','r','t'},
+    {'c','h','a','s','e'},
+    {'c','h','a','s','m'},
+    {'c','h','e','a','p'},
+    {'c','h','e','a','t'},
+    {'c','h','e','c','k'},
+    {'c','h','e','e','k'},
+    {'c','h','e','e','r'},
+    {'c','h','e','s','s'},
+    {'c','h','e','s','t'},
+    {'c','h','i','c','k'},
+    {'c','h','i','d','e'},
+    {'c','h','i','e','f'},
+    {'c','h','i','l','d'},
+    {'c','h','i','l','i'},
+    {'c','h','i','l','l'},
+    {'c','h','i','m','e'},
+    {'c','h','i','n','a'},
+    {'c','h','i','r','p'},
+    {'c','h','o','c','k'},
+    {'c','h','o','i','r'},
+    {'c','h','o','k','e'},
+    {'c','h','o','r','d'},
+    {'c','h','o','r','e'},
+    {'c','h','o','s','e'},
+    {'c','h','u','c','k'},
+    {'c','h','u','m','p'},
+    {'c','h','u','n','k'},
+    {'c','h','u','r','n'},
+    {'c','h','u','t','e'},
+    {'c','i','d','e','r'},
+    {'c','i','g','a','r'},
+    {'c','i','n','c','h'},
+    {'c','i','r','c','a'},
+    {'c','i','v','i','c'},
+    {'c','i','v','i','l'},
+    {'c','l','a','c','k'},
+    {'c','l','a','i','m'},
+    {'c','l','a','m','p'},
+    {'c','l','a','n','g'},
+    {'c','l','a','n','k'},
+    {'c','l','a','s','h'},
+    {'c','l','a','s','p'},
+    {'c','l','a','s','s'},
+    {'c','l','e','a','n'},
+    {'c','l','e','a','r'},
+    {'c','l','e','a','t'},
+    {'c','l','e','f','t'},
+    {'c','l','e','r','k'},
+    {'c','l','i','c','k'},
+    {'c','l','i','f','f'},
+    {'c','l','i','m','b'},
+    {'c','l','i','n','g'},
+    {'c','l','i','n','k'},
+    {'c','l','o','a','k'},
+    {'c','l','o','c','k'},
+    {'c','l','o','n','e'},
+    {'c','l','o','s','e'},
+    {'c','l','o','t','h'},
+    {'c','l','o','u','d'},
+    {'c','l','o','u','t'},
+    {'c','l','o','v','e'},
+    {'c','l','o','w','n'},
+    {'c','l','u','c','k'},
+    {'c','l','u','e','d'},
+    {'c','l','u','m','p'},
+    {'c','l','u','n','g'},
+    {'c','o','a','c','h'},
+    {'c','o','a','s','t'},
+    {'c','o','b','r','a'},
+    {'c','o','c','o','a'},
+    {'c','o','l','o','n'},
+    {'c','o','l','o','r'},
+    {'c','o','m','e','t'},
+    {'c','o','m','f','y'},
+    {'c','o','m','i','c'},
+    {'c','o','m','m','a'},
+    {'c','o','n','c','h'},
+    {'c','o','n','d','o'},
+    {'c','o','n','i','c'},
+    {'c','o','p','s','e'},
+    {'c','o','r','a','l'},
+    {'c','o','r','e','r'},
+    {'c','o','r','n','y'},
+    {'c','o','u','c','h'},
+    {'c','o','u','g','h'},
+    {'c','o','u','l','d'},
+    {'c','o','u','n','t'},
+    {'c','o','u','p','e'},
+    {'c','o','u','r','t'},
+    {'c','o','v','e','n'},
+    {'c','o','v','e','r'},
+    {'c','o','v','e','t'},
+    {'c','o','v','e','y'},
+    {'c','o','w','e','r'},
+    {'c','o','y','l','y'},
+    {'c','r','a','c','k'},
+    {'c','r','a','f','t'},
+    {'c','r','a','m','p'},
+    {'c','r','a','n','e'},
+    {'c','r','a','n','k'},
+    {'c','r','a','s','h'},
+    {'c','r','a','s','s'},
+    {'c','r','a','t','e'},
+    {'c','r','a','v','e'},
+    {'c','r','a','w','l'},
+    {'c','r','a','z','e'},
+    {'c','r','a','z','y'},
+    {'c','r','e','a','k'},
+    {'c','r','e','a','m'},
+    {'c','r','e','d','o'},
+    {'c','r','e','e','d'},
+    {'c','r','e','e','k'},
+    {'c','r','e','e','p'},
+    {'c','r','e','m','e'},
+    {'c','r','e','p','e'},
+    {'c','r','e','p','t'},
+    {'c','r','e','s','s'},
+    {'c','r','e','s','t'},
+    {'c','r','i','c','k'},
+    {'c','r','i','e','d'},
+    {'c','r','i','e','r'},
+    {'c','r','i','m','e'},
+    {'c','r','i','m','p'},
+    {'c','r','i','s','p'},
+    {'c','r','o','a','k'},
+    {'c','r','o','c','k'},
+    {'c','r','o','n','e'},
+    {'c','r','o','n','y'},
+    {'c','r','o','o','k'},
+    {'c','r','o','s','s'},
+    {'c','r','o','u','p'},
+    {'c','r','o','w','d'},
+    {'c','r','o','w','n'},
+    {'c','r','u','d','e'},
+    {'c','r','u','e','l'},
+    {'c','r','u','m','b'},
+    {'c','r','u','m','p'},
+    {'c','r','u','s','h'},
+    {'c','r','u','s','t'},
+    {'c','r','y','p','t'},
+    {'c','u','b','i','c'},
+    {'c','u','m','i','n'},
+    {'c','u','r','i','o'},
+    {'c','u','r','l','y'},
+    {'c','u','r','r','y'},
+    {'c','u','r','s','e'},
+    {'c','u','r','v','e'},
+    {'c','u','r','v','y'},
+    {'c','u','t','i','e'},
+    {'c','y','b','e','r'},
+    {'c','y','c','l','e'},
+    {'c','y','n','i','c'},
+    {'d','a','d','d','y'},
+    {'d','a','i','l','y'},
+    {'d','a','i','r','y'},
+    {'d','a','i','s','y'},
+    {'d','a','l','l','y'},
+    {'d','a','n','c','e'},
+    {'d','a','n','d','y'},
+    {'d','a','t','u','m'},
+    {'d','a','u','n','t'},
+    {'d','e','a','l','t'},
+    {'d','e','a','t','h'},
+    {'d','e','b','a','r'},
+    {'d','e','b','i','t'},
+    {'d','e','b','u','g'},
+    {'d','e','b','u','t'},
+    {'d','e','c','a','l'},
+    {'d','e','c','a','y'},
+    {'d','e','c','o','r'},
+    {'d','e','c','o','y'},
+    {'d','e','c','r','y'},
+    {'d','e','f','e','r'},
+    {'d','e','i','g','n'},
+    {'d','e','i','t','y'},
+    {'d','e','l','a','y'},
+    {'d','e','l','t','a'},
+    {'d','e','l','v','e'},
+    {'d','e','m','o','n'},
+    {'d','e','m','u','r'},
+    {'d','e','n','i','m'},
+    {'d','e','n','s','e'},
+    {'d','e','p','o','t'},
+    {'d','e','p','t','h'},
+    {'d','e','r','b','y'},
+    {'d','e','t','e','r'},
+    {'d','e','t','o','x'},
+    {'d','e','u','c','e'},
+    {'d','e','v','i','l'},
+    {'d','i','a','r','y'},
+    {'d','i','c','e','y'},
+    {'d','i','g','i','t'},
+    {'d','i','l','l','y'},
+    {'d','i','m','l','y'},
+    {'d','i','n','e','r'},
+    {'d','i','n','g','o'},
+    {'d','i','n','g','y'},
+    {'d','i','o','d','e'},
+    {'d','i','r','g','e'},
+    {'d','i','r','t','y'},
+    {'d','i','s','c','o'},
+    {'d','i','t','c','h'},
+    {'d','i','t','t','o'},
+    {'d','i','t','t','y'},
+    {'d','i','v','e','r'},
+    {'d','i','z','z','y'},
+    {'d','o','d','g','e'},
+    {'d','o','d','g','y'},
+    {'d','o','g','m','a'},
+    {'d','o','i','n','g'},
+    {'d','o','l','l','y'},
+    {'d','o','n','o','r'},
+    {'d','o','n','u','t'},
+    {'d','o','p','e','y'},
+    {'d','o','u','b','t'},
+    {'d','o','u','g','h'},
+    {'d','o','w','d','y'},
+    {'d','o','w','e','l'},
+    {'d','o','w','n','y'},
+    {'d','o','w','r','y'},
+    {'d','o','z','e','n'},
+    {'d','r','a','f','t'},
+    {'d','r','a','i','n'},
+    {'d','r','a','k','e'},
+    {'d','r','a','m','a'},
+    {'d','r','a','n','k'},
+    {'d','r','a','p','e'},
+    {'d','r','a','w','l'},
+    {'d','r','a','w','n'},
+    {'d','r','e','a','d'},
+    {'d','r','e','a','m'},
+    {'d','r','e','s','s'},
+    {'d','r','i','e','d'},
+    {'d','r','i','e','r'},
+    {'d','r','i','f','t'},
+    {'d','r','i','l','l'},
+    {'d','r','i','n','k'},
+    {'d','r','i','v','e'},
+    {'d','r','o','i','t'},
+    {'d','r','o','l','l'},
+    {'d','r','o','n','e'},
+    {'d','r','o','o','l'},
+    {'d','r','o','o','p'},
+    {'d','r','o','s','s'},
+    {'d','r','o','v','e'},
+    {'d','r','o','w','n'},
+    {'d','r','u','i','d'},
+    {'d','r','u','n','k'},
+    {'d','r','y','e','r'},
+    {'d','r','y','l','y'},
+    {'d','u','c','h','y'},
+    {'d','u','l','l','y'},
+    {'d','u','m','m','y'},
+    {'d','u','m','p','y'},
+    {'d','u','n','c','e'},
+    {'d','u','s','k','y'},
+    {'d','u','s','t','y'},
+    {'d','u','t','c','h'},
+    {'d','u','v','e','t'},
+    {'d','w','a','r','f'},
+    {'d','w','e','l','l'},
+    {'d','w','e','l','t'},
+    {'d','y','i','n','g'},
+    {'e','a','g','e','r'},
+    {'e','a','g','l','e'},
+    {'e','a','r','l','y'},
+    {'e','a','r','t','h'},
+    {'e','a','s','e','l'},
+    {'e','a','t','e','n'},
+    {'e','a','t','e','r'},
+    {'e','b','o','n','y'},
+    {'e','c','l','a','t'},
+    {'e','d','i','c','t'},
+    {'e','d','i','f','y'},
+    {'e','e','r','i','e'},
+    {'e','g','r','e','t'},
+    {'e','i','g','h','t'},
+    {'e','j','e','c','t'},
+    {'e','k','i','n','g'},
+    {'e','l','a','t','e'},
+    {'e','l','b','o','w'},
+    {'e','l','d','e','r'},
+    {'e','l','e','c','t'},
+    {'e','l','e','g','y'},
+    {'e','l','f','i','n'},
+    {'e','l','i','d','e'},
+    {'e','l','i','t','e'},
+    {'e','l','o','p','e'},
+    {'e','l','u','d','e'},
+    {'e','m','a','i','l'},
+    {'e','m','b','e','d'},
+    {'e','m','b','e','r'},
+    {'e','m','c','e','e'},
+    {'e','m','p','t','y'},
+    {'e','n','a','c','t'},
+    {'e','n','d','o','w'},
+    {'e','n','e','m','a'},
+    {'e','n','e','m','y'},
+    {'e','n','j','o','y'},
+    {'e','n','n','u','i'},
+    {'e','n','s','u','e'},
+    {'e','n','t','e','r'},
+    {'e','n','t','r','y'},
+    {'e','n','v','o','y'},
+    {'e','p','o','c','h'},
+    {'e','p','o','x','y'},
+    {'e','q','u','a','l'},
+    {'e','q','u','i','p'},
+    {'e','r','a','s','e'},
+    {'e','r','e','c','t'},
+    {'e','r','o','d','e'},
+    {'e','r','r','o','r'},
+    {'e','r','u','p','t'},
+    {'e','s','s','a','y'},
+    {'e','s','t','e','r'},
+    {'e','t','h','e','r'},
+    {'e','t','h','i','c'},
+    {'e','t','h','o','s'},
+    {'e','t','u','d','e'},
+    {'e','v','a','d','e'},
+    {'e','v','e','n','t'},
+    {'e','v','e','r','y'},
+    {'e','v','i','c','t'},
+    {'e','v','o','k','e'},
+    {'e','x','a','c','t'},
+    {'e','x','a','l','t'},
+    {'e','x','c','e','l'},
+    {'e','x','e','r','t'},
+    {'e','x','i','l','e'},
+    {'e','x','i','s','t'},
+    {'e','x','p','e','l'},
+    {'e','x','t','o','l'},
+    {'e','x','t','r','a'},
+    {'e','x','u','l','t'},
+    {'e','y','i','n','g'},
+    {'f','a','b','l','e'},
+    {'f','a','c','e','t'},
+    {'f','a','i','n','t'},
+    {'f','a','i','r','y'},
+    {'f','a','i','t','h'},
+    {'f','a','l','s','e'},
+    {'f','a','n','c','y'},
+    {'f','a','n','n','y'},
+    {'f','a','r','c','e'},
+    {'f','a','t','a','l'},
+    {'f','a','t','t','y'},
+    {'f','a','u','l','t'},
+    {'f','a','u','n','a'},
+    {'f','a','v','o','r'},
+    {'f','e','a','s','t'},
+    {'f','e','c','a','l'},
+    {'f','e','i','g','n'},
+    {'f','e','l','l','a'},
+    {'f','e','l','o','n'},
+    {'f','e','m','m','e'},
+    {'f','e','m','u','r'},
+    {'f','e','n','c','e'},
+    {'f','e','r','a','l'},
+    {'f','e','r','r','y'},
+    {'f','e','t','a','l'},
+    {'f','e','t','c','h'},
+    {'f','e','t','i','d'},
+    {'f','e','t','u','s'},
+    {'f','e','v','e','r'},
+    {'f','e','w','e','r'},
+    {'f','i','b','e','r'},
+    {'f','i','b','r','e'},
+    {'f','i','c','u','s'},
+    {'f','i','e','l','d'},
+    {'f','i','e','n','d'},
+    {'f','i','e','r','y'},
+    {'f','i','f','t','h'},
+    {'f','i','f','t','y'},
+    {'f','i','g','h','t'},
+    {'f','i','l','e','r'},
+    {'f','i','l','e','t'},
+    {'f','i','l','l','y'},
+    {'f','i','l','m','y'},
+    {'f','i','l','t','h'},
+    {'f','i','n','a','l'},
+    {'f','i','n','c','h'},
+    {'f','i','n','e','r'},
+    {'f','i','r','s','t'},
+    {'f','i','s','h','y'},
+    {'f','i','x','e','r'},
+    {'f','i','z','z','y'},
+    {'f','j','o','r','d'},
+    {'f','l','a','c','k'},
+    {'f','l','a','i','l'},
+    {'f','l','a','i','r'},
+    {'f','l','a','k','e'},
+    {'f','l','a','k','y'},
+    {'f','l','a','m','e'},
+    {'f','l','a','n','k'},
+    {'f','l','a','r','e'},
+    {'f','l','a','s','h'},
+    {'f','l','a','s','k'},
+    {'f','l','e','c','k'},
+    {'f','l','e','e','t'},
+    {'f','l','e','s','h'},
+    {'f','l','i','c','k'},
+    {'f','l','i','e','r'},
+    {'f','l','i','n','g'},
+    {'f','l','i','n','t'},
+    {'f','l','i','r','t'},
+    {'f','l','o','a','t'},
+    {'f','l','o','c','k'},
+    {'f','l','o','o','d'},
+    {'f','l','o','o','r'},
+    {'f','l','o','r','a'},
+    {'f','l','o','s','s'},
+    {'f','l','o','u','r'},
+    {'f','l','o','u','t'},
+    {'f','l','o','w','n'},
+    {'f','l','u','f','f'},
+    {'f','l','u','i','d'},
+    {'f','l','u','k','e'},
+    {'f','l','u','m','e'},
+    {'f','l','u','n','g'},
+    {'f','l','u','n','k'},
+    {'f','l','u','s','h'},
+    {'f','l','u','t','e'},
+    {'f','l','y','e','r'},
+    {'f','o','a','m','y'},
+    {'f','o','c','a','l'},
+    {'f','o','c','u','s'},
+    {'f','o','g','g','y'},
+    {'f','o','i','s','t'},
+    {'f','o','l','i','o'},
+    {'f','o','l','l','y'},
+    {'f','o','r','a','y'},
+    {'f','o','r','c','e'},
+    {'f','o','r','g','e'},
+    {'f','o','r','g','o'},
+    {'f','o','r','t','e'},
+    {'f','o','r','t','h'},
+    {'f','o','r','t','y'},
+    {'f','o','r','u','m'},
+    {'f','o','u','n','d'},
+    {'f','o','y','e','r'},
+    {'f','r','a','i','l'},
+    {'f','r','a','m','e'},
+    {'f','r','a','n','k'},
+    {'f','r','a','u','d'},
+    {'f','r','e','a','k'},
+    {'f','r','e','e','d'},
+    {'f','r','e','e','r'},
+    {'f','r','e','s','h'},
+    {'f','r','i','a','r'},
+    {'f','r','i','e','d'},
+    {'f','r','i','l','l'},
+    {'f','r','i','s','k'},
+    {'f','r','i','t','z'},
+    {'f','r','o','c','k'},
+    {'f','r','o','n','d'},
+    {'f','r','o','n','t'},
+    {'f','r','o','s','t'},
+    {'f','r','o','t','h'},
+    {'f','r','o','w','n'},
+    {'f','r','o','z','e'},
+    {'f','r','u','i','t'},
+    {'f','u','d','g','e'},
+    {'f','u','g','u','e'},
+    {'f','u','l','l','y'},
+    {'f','u','n','g','i'},
+    {'f','u','n','k','y'},
+    {'f','u','n','n','y'},
+    {'f','u','r','o','r'},
+    {'f','u','r','r','y'},
+    {'f','u','s','s','y'},
+    {'f','u','z','z','y'},
+    {'g','a','f','f','e'},
+    {'g','a','i','l','y'},
+    {'g','a','m','e','r'},
+    {'g','a','m','m','a'},
+    {'g','a','m','u','t'},
+    {'g','a','s','s','y'},
+    {'g','a','u','d','y'},
+    {'g','a','u','g','e'},
+    {'g','a','u','n','t'},
+    {'g','a','u','z','e'},
+    {'g','a','v','e','l'},
+    {'g','a','w','k','y'},
+    {'g','a','y','e','r'},
+    {'g','a','y','l','y'},
+    {'g','a','z','e','r'},
+    {'g','e','c','k','o'},
+    {'g','e','e','k','y'},
+    {'g','e','e','s','e'},
+    {'g','e','n','i','e'},
+    {'g','e','n','r','e'},
+    {'g','h','o','s','t'},
+    {'g','h','o','u','l'},
+    {'g','i','a','n','t'},
+    {'g','i','d','d','y'},
+    {'g','i','p','s','y'},
+    {'g','i','r','l','y'},
+    {'g','i','r','t','h'},
+    {'g','i','v','e','n'},
+    {'g','i','v','e','r'},
+    {'g','l','a','d','e'},
+    {'g','l','a','n','d'},
+    {'g','l','a','r','e'},
+    {'g','l','a','s','s'},
+    {'g','l','a','z','e'},
+    {'g','l','e','a','m'},
+    {'g','l','e','a','n'},
+    {'g','l','i','d','e'},
+    {'g','l','i','n','t'},
+    {'g','l','o','a','t'},
+    {'g','l','o','b','e'},
+    {'g','l','o','o','m'},
+    {'g','l','o','r','y'},
+    {'g','l','o','s','s'},
+    {'g','l','o','v','e'},
+    {'g','l','y','p','h'},
+    {'g','n','a','s','h'},
+    {'g','n','o','m','e'},
+    {'g','o','d','l','y'},
+    {'g','o','i','n','g'},
+    {'g','o','l','e','m'},
+    {'g','o','l','l','y'},
+    {'g','o','n','a','d'},
+    {'g','o','n','e','r'},
+    {'g','o','o','d','y'},
+    {'g','o','o','e','y'},
+    {'g','o','o','f','y'},
+    {'g','o','o','s','e'},
+    {'g','o','r','g','e'},
+    {'g','o','u','g','e'},
+    {'g','o','u','r','d'},
+    {'g','r','a','c','e'},
+    {'g','r','a','d','e'},
+    {'g','r','a','f','t'},
+    {'g','r','a','i','l'},
+    {'g','r','a','i','n'},
+    {'g','r','a','n','d'},
+    {'g','r','a','n','t'},
+    {'g','r','a','p','e'},
+    {'g','r','a','p','h'},
+    {'g','r','a','s','p'},
+    {'g','r','a','s','s'},
+    {'g','r','a','t','e'},
+    {'g','r','a','v','e'},
+    {'g','r','a','v','y'},
+    {'g','r','a','z','e'},
+    {'g','r','e','a','t'},
+    {'g','r','e','e','d'},
+    {'g','r','e','e','n'},
+    {'g','r','e','e','t'},
+    {'g','r','i','e','f'},
+    {'g','r','i','l','l'},
+    {'g','r','i','m','e'},
+    {'g','r','i','m','y'},
+    {'g','r','i','n','d'},
+    {'g','r','i','p','e'},
+    {'g','r','o','a','n'},
+    {'g','r','o','i','n'},
+    {'g','r','o','o','m'},
+    {'g','r','o','p','e'},
+    {'g','r','o','s','s'},
+    {'g','r','o','u','p'},
+    {'g','r','o','u','t'},
+    {'g','r','o','v','e'},
+    {'g','r','o','w','l'},
+    {'g','r','o','w','n'},
+    {'g','r','u','e','l'},
+    {'g','r','u','f','f'},
+    {'g','r','u','n','t'},
+    {'g','u','a','r','d'},
+    {'g','u','a','v','a'},
+    {'g','u','e','s','s'},
+    {'g','u','e','s','t'},
+    {'g','u','i','d','e'},
+    {'g','u','i','l','d'},
+    {'g','u','i','l','e'},
+    {'g','u','i','l','t'},
+    {'g','u','i','s','e'},
+    {'g','u','l','c','h'},
+    {'g','u','l','l','y'},
+    {'g','u','m','b','o'},
+    {'g','u','m','m','y'},
+    {'g','u','p','p','y'},
+    {'g','u','s','t','o'},
+    {'g','u','s','t','y'},
+    {'g','y','p','s','y'},
+    {'h','a','b','i','t'},
+    {'h','a','i','r','y'},
+    {'h','a','l','v','e'},
+    {'h','a','n','d','y'},
+    {'h','a','p','p','y'},
+    {'h','a','r','d','y'},
+    {'h','a','r','e','m'},
+    {'h','a','r','p','y'},
+    {'h','a','r','r','y'},
+    {'h','a','r','s','h'},
+    {'h','a','s','t','e'},
+    {'h','a','s','t','y'},
+    {'h','a','t','c','h'},
+    {'h','a','t','e','r'},
+    {'h','a','u','n','t'},
+    {'h','a','u','t','e'},
+    {'h','a','v','e','n'},
+    {'h','a','v','o','c'},
+    {'h','a','z','e','l'},
+    {'h','e','a','d','y'},
+    {'h','e','a','r','d'},
+    {'h','e','a','r','t'},
+    {'h','e','a','t','h'},
+    {'h','e','a','v','e'},
+    {'h','e','a','v','y'},
+    {'h','e','d','g','e'},
+    {'h','e','f','t','y'},
+    {'h','e','i','s','t'},
+    {'h','e','l','i','x'},
+    {'h','e','l','l','o'},
+    {'h','e','n','c','e'},
+    {'h','e','r','o','n'},
+    {'h','i','l','l','y'},
+    {'h','i','n','g','e'},
+    {'h','i','p','p','o'},
+    {'h','i','p','p','y'},
+    {'h','i','t','c','h'},
+    {'h','o','a','r','d'},
+    {'h','o','b','b','y'},
+    {'h','o','i','s','t'},
+    {'h','o','l','l','y'},
+    {'h','o','m','e','r'},
+    {'h','o','n','e','y'},
+    {'h','o','n','o','r'},
+    {'h','o','r','d','e'},
+    {'h','o','r','n','y'},
+    {'h','o','r','s','e'},
+    {'h','o','t','e','l'},
+    {'h','o','t','l','y'},
+    {'h','o','u','n','d'},
+    {'h','o','u','s','e'},
+    {'h','o','v','e','l'},
+    {'h','o','v','e','r'},
+    {'h','o','w','d','y'},
+    {'h','u','m','a','n'},
+    {'h','u','m','i','d'},
+    {'h','u','m','o','r'},
+    {'h','u','m','p','h'},
+    {'h','u','m','u','s'},
+    {'h','u','n','c','h'},
+    {'h','u','n','k','y'},
+    {'h','u','r','r','y'},
+    {'h','u','s','k','y'},
+    {'h','u','s','s','y'},
+    {'h','u','t','c','h'},
+    {'h','y','d','r','o'},
+    {'h','y','e','n','a'},
+    {'h','y','m','e','n'},
+    {'h','y','p','e','r'},
+    {'i','c','i','l','y'},
+    {'i','c','i','n','g'},
+    {'i','d','e','a','l'},
+    {'i','d','i','o','m'},
+    {'i','d','i','o','t'},
+    {'i','d','l','e','r'},
+    {'i','d','y','l','l'},
+    {'i','g','l','o','o'},
+    {'i','l','i','a','c'},
+    {'i','m','a','g','e'},
+    {'i','m','b','u','e'},
+    {'i','m','p','e','l'},
+    {'i','m','p','l','y'},
+    {'i','n','a','n','e'},
+    {'i','n','b','o','x'},
+    {'i','n','c','u','r'},
+    {'i','n','d','e','x'},
+    {'i','n','e','p','t'},
+    {'i','n','e','r','t'},
+    {'i','n','f','e','r'},
+    {'i','n','g','o','t'},
+    {'i','n','l','a','y'},
+    {'i','n','l','e','t'},
+    {'i','n','n','e','r'},
+    {'i','n','p','u','t'},
+    {'i','n','t','e','r'},
+    {'i','n','t','r','o'},
+    {'i','o','n','i','c'},
+    {'i','r','a','t','e'},
+    {'i','r','o','n','y'},
+    {'i','s','l','e','t'},
+    {'i','s','s','u','e'},
+    {'i','t','c','h','y'},
+    {'i','v','o','r','y'},
+    {'j','a','u','n','t'},
+    {'j','a','z','z','y'},
+    {'j','e','l','l','y'},
+    {'j','e','r','k','y'},
+    {'j','e','t','t','y'},
+    {'j','e','w','e','l'},
+    {'j','i','f','f','y'},
+    {'j','o','i','n','t'},
+    {'j','o','i','s','t'},
+    {'j','o','k','e','r'},
+    {'j','o','l','l','y'},
+    {'j','o','u','s','t'},
+    {'j','u','d','g','e'},
+    {'j','u','i','c','e'},
+    {'j','u','i','c','y'},
+    {'j','u','m','b','o'},
+    {'j','u','m','p','y'},
+    {'j','u','n','t','a'},
+    {'j','u','n','t','o'},
+    {'j','u','r','o','r'},
+    {'k','a','p','p','a'},
+    {'k','a','r','m','a'},
+    {'k','a','y','a','k'},
+    {'k','e','b','a','b'},
+    {'k','h','a','k','i'},
+    {'k','i','n','k','y'},
+    {'k','i','o','s','k'},
+    {'k','i','t','t','y'},
+    {'k','n','a','c','k'},
+    {'k','n','a','v','e'},
+    {'k','n','e','a','d'},
+    {'k','n','e','e','d'},
+    {'k','n','e','e','l'},
+    {'k','n','e','l','t'},
+    {'k','n','i','f','e'},
+    {'k','n','o','c','k'},
+    {'k','n','o','l','l'},
+    {'k','n','o','w','n'},
+    {'k','o','a','l','a'},
+    {'k','r','i','l','l'},
+    {'l','a','b','e','l'},
+    {'l','a','b','o','r'},
+    {'l','a','d','e','n'},
+    {'l','a','d','l','e'},
+    {'l','a','g','e','r'},
+    {'l','a','n','c','e'},
+    {'l','a','n','k','y'},
+    {'l','a','p','e','l'},
+    {'l','a','p','s','e'},
+    {'l','a','r','g','e'},
+    {'l','a','r','v','a'},
+    {'l','a','s','s','o'},
+    {'l','a','t','c','h'},
+    {'l','a','t','e','r'},
+    {'l','a','t','h','e'},
+    {'l','a','t','t','e'},
+    {'l','a','u','g','h'},
+    {'l','a','y','e','r'},
+    {'l','e','a','c','h'},
+    {'l','e','a','f','y'},
+    {'l','e','a','k','y'},
+    {'l','e','a','n','t'},
+    {'l','e','a','p','t'},
+    {'l','e','a','r','n'},
+    {'l','e','a','s','e'},
+    {'l','e','a','s','h'},
+    {'l','e','a','s','t'},
+    {'l','e','a','v','e'},
+    {'l','e','d','g','e'},
+    {'l','e','e','c','h'},
+    {'l','e','e','r','y'},
+    {'l','e','f','t','y'},
+    {'l','e','g','a','l'},
+    {'l','e','g','g','y'},
+    {'l','e','m','o','n'},
+    {'l','e','m','u','r'},
+    {'l','e','p','e','r'},
+    {'l','e','v','e','l'},
+    {'l','e','v','e','r'},
+    {'l','i','b','e','l'},
+    {'l','i','e','g','e'},
+    {'l','i','g','h','t'},
+    {'l','i','k','e','n'},
+    {'l','i','l','a','c'},
+    {'l','i','m','b','o'},
+    {'l','i','m','i','t'},
+    {'l','i','n','e','n'},
+    {'l','i','n','e','r'},
+    {'l','i','n','g','o'},
+    {'l','i','p','i','d'},
+    {'l','i','t','h','e'},
+    {'l','i','v','e','r'},
+    {'l','i','v','i','d'},
+    {'l','l','a','m','a'},
+    {'l','o','a','m','y'},
+    {'l','o','a','t','h'},
+    {'l','o','b','b','y'},
+    {'l','o','c','a','l'},
+    {'l','o','c','u','s'},
+    {'l','o','d','g','e'},
+    {'l','o','f','t','y'},
+    {'l','o','g','i','c'},
+    {'l','o','g','i','n'},
+    {'l','o','o','p','y'},
+    {'l','o','o','s','e'},
+    {'l','o','r','r','y'},
+    {'l','o','s','e','r'},
+    {'l','o','u','s','e'},
+    {'l','o','u','s','y'},
+    {'l','o','v','e','r'},
+    {'l','o','w','e','r'},
+    {'l','o','w','l','y'},
+    {'l','o','y','a','l'},
+    {'l','u','c','i','d'},
+    {'l','u','c','k','y'},
+    {'l','u','m','e','n'},
+    {'l','u','m','p','y'},
+    {'l','u','n','a','r'},
+    {'l','u','n','c','h'},
+    {'l','u','n','g','e'},
+    {'l','u','p','u','s'},
+    {'l','u','r','c','h'},
+    {'l','u','r','i','d'},
+    {'l','u','s','t','y'},
+    {'l','y','i','n','g'},
+    {'l','y','m','p','h'},
+    {'l','y','n','c','h'},
+    {'l','y','r','i','c'},
+    {'m','a','c','a','w'},
+    {'m','a','c','h','o'},
+    {'m','a','c','r','o'},
+    {'m','a','d','a','m'},
+    {'m','a','d','l','y'},
+    {'m','a','f','i','a'},
+    {'m','a','g','i','c'},
+    {'m','a','g','m','a'},
+    {'m','a','i','z','e'},
+    {'m','a','j','o','r'},
+    {'m','a','k','e','r'},
+    {'m','a','m','b','o'},
+    {'m','a','m','m','a'},
+    {'m','a','m','m','y'},
+    {'m','a','n','g','a'},
+    {'m','a','n','g','e'},
+    {'m','a','n','g','o'},
+    {'m','a','n','g','y'},
+    {'m','a','n','i','a'},
+    {'m','a','n','i','c'},
+    {'m','a','n','l','y'},
+    {'m','a','n','o','r'},
+    {'m','a','p','l','e'},
+    {'m','a','r','c','h'},
+    {'m','a','r','r','y'},
+    {'m','a','r','s','h'},
+    {'m','a','s','o','n'},
+    {'m','a','s','s','e'},
+    {'m','a','t','c','h'},
+    {'m','a','t','e','y'},
+    {'m','a','u','v','e'},
+    {'m','a','x','i','m'},
+    {'m','a','y','b','e'},
+    {'m','a','y','o','r'},
+    {'m','e','a','l','y'},
+    {'m','e','a','n','t'},
+    {'m','e','a','t','y'},
+    {'m','e','c','c','a'},
+    {'m','e','d','a','l'},
+    {'m','e','d','i','a'},
+    {'m','e','d','i','c'},
+    {'m','e','l','e','e'},
+    {'m','e','l','o','n'},
+    {'m','e','r','c','y'},
+    {'m','e','r','g','e'},
+    {'m','e','r','i','t'},
+    {'m','e','r','r','y'},
+    {'m','e','t','a','l'},
+    {'m','e','t','e','r'},
+    {'m','e','t','r','o'},
+    {'m','i','c','r','o'},
+    {'m','i','d','g','e'},
+    {'m','i','d','s','t'},
+    {'m','i','g','h','t'},
+    {'m','i','l','k','y'},
+    {'m','i','m','i','c'},
+    {'m','i','n','c','e'},
+    {'m','i','n','e','r'},
+    {'m','i','n','i','m'},
+    {'m','i','n','o','r'},
+    {'m','i','n','t','y'},
+    {'m','i','n','u','s'},
+    {'m','i','r','t','h'},
+    {'m','i','s','e','r'},
+    {'m','i','s','s','y'},
+    {'m','o','c','h','a'},
+    {'m','o','d','a','l'},
+    {'m','o','d','e','l'},
+    {'m','o','d','e','m'},
+    {'m','o','g','u','l'},
+    {'m','o','i','s','t'},
+    {'m','o','l','a','r'},
+    {'m','o','l','d','y'},
+    {'m','o','n','e','y'},
+    {'m','o','n','t','h'},
+    {'m','o','o','d','y'},
+    {'m','o','o','s','e'},
+    {'m','o','r','a','l'},
+    {'m','o','r','o','n'},
+    {'m','o','r','p','h'},
+    {'m','o','s','s','y'},
+    {'m','o','t','e','l'},
+    {'m','o','t','i','f'},
+    {'m','o','t','o','r'},
+    {'m','o','t','t','o'},
+    {'m','o','u','l','t'},
+    {'m','o','u','n','d'},
+    {'m','o','u','n','t'},
+    {'m','o','u','r','n'},
+    {'m','o','u','s','e'},
+    {'m','o','u','t','h'},
+    {'m','o','v','e','r'},
+    {'m','o','v','i','e'},
+    {'m','o','w','e','r'},
+    {'m','u','c','k','y'},
+    {'m','u','c','u','s'},
+    {'m','u','d','d','y'},
+    {'m','u','l','c','h'},
+    {'m','u','m','m','y'},
+    {'m','u','n','c','h'},
+    {'m','u','r','a','l'},
+    {'m','u','r','k','y'},
+    {'m','u','s','h','y'},
+    {'m','u','s','i','c'},
+    {'m','u','s','k','y'},
+    {'m','u','s','t','y'},
+    {'m','y','r','r','h'},
+    {'n','a','d','i','r'},
+    {'n','a','i','v','e'},
+    {'n','a','n','n','y'},
+    {'n','a','s','a','l'},
+    {'n','a','s','t','y'},
+    {'n','a','t','a','l'},
+    {'n','a','v','a','l'},
+    {'n','a','v','e','l'},
+    {'n','e','e','d','y'},
+    {'n','e','i','g','h'},
+    {'n','e','r','d','y'},
+    {'n','e','r','v','e'},
+    {'n','e','v','e','r'},
+    {'n','e','w','e','r'},
+    {'n','e','w','l','y'},
+    {'n','i','c','e','r'},
+    {'n','i','c','h','e'},
+    {'n','i','e','c','e'},
+    {'n','i','g','h','t'},
+    {'n','i','n','j','a'},
+    {'n','i','n','n','y'},
+    {'n','i','n','t','h'},
+    {'n','o','b','l','e'},
+    {'n','o','b','l','y'},
+    {'n','o','i','s','e'},
+    {'n','o','i','s','y'},
+    {'n','o','m','a','d'},
+    {'n','o','o','s','e'},
+    {'n','o','r','t','h'},
+    {'n','o','s','e','y'},
+    {'n','o','t','c','h'},
+    {'n','o','v','e','l'},
+    {'n','u','d','g','e'},
+    {'n','u','r','s','e'},
+    {'n','u','t','t','y'},
+    {'n','y','l','o','n'},
+    {'n','y','m','p','h'},
+    {'o','a','k','e','n'},
+    {'o','b','e','s','e'},
+    {'o','c','c','u','r'},
+    {'o','c','e','a','n'},
+    {'o','c','t','a','l'},
+    {'o','c','t','e','t'},
+    {'o','d','d','e','r'},
+    {'o','d','d','l','y'},
+    {'o','f','f','a','l'},
+    {'o','f','f','e','r'},
+    {'o','f','t','e','n'},
+    {'o','l','d','e','n'},
+    {'o','l','d','e','r'},
+    {'o','l','i','v','e'},
+    {'o','m','b','r','e'},
+    {'o','m','e','g','a'},
+    {'o','n','i','o','n'},
+    {'o','n','s','e','t'},
+    {'o','p','e','r','a'},
+    {'o','p','i','n','e'},
+    {'o','p','i','u','m'},
+    {'o','p','t','i','c'},
+    {'o','r','b','i','t'},
+    {'o','r','d','e','r'},
+    {'o','r','g','a','n'},
+    {'o','t','h','e','r'},
+    {'o','t','t','e','r'},
+    {'o','u','g','h','t'},
+    {'o','u','n','c','e'},
+    {'o','u','t','d','o'},
+    {'o','u','t','e','r'},
+    {'o','u','t','g','o'},
+    {'o','v','a','r','y'},
+    {'o','v','a','t','e'},
+    {'o','v','e','r','t'},
+    {'o','v','i','n','e'},
+    {'o','v','o','i','d'},
+    {'o','w','i','n','g'},
+    {'o','w','n','e','r'},
+    {'o','x','i','d','e'},
+    {'o','z','o','n','e'},
+    {'p','a','d','d','y'},
+    {'p','a','g','a','n'},
+    {'p','a','i','n','t'},
+    {'p','a','l','e','r'},
+    {'p','a','l','s','y'},
+    {'p','a','n','e','l'},
+    {'p','a','n','i','c'},
+    {'p','a','n','s','y'},
+    {'p','a','p','a','l'},
+    {'p','a','p','e','r'},
+    {'p','a','r','e','r'},
+    {'p','a','r','k','a'},
+    {'p','a','r','r','y'},
+    {'p','a','r','s','e'},
+    {'p','a','r','t','y'},
+    {'p','a','s','t','a'},
+    {'p','a','s','t','e'},
+    {'p','a','s','t','y'},
+    {'p','a','t','c','h'},
+    {'p','a','t','i','o'},
+    {'p','a','t','s','y'},
+    {'p','a','t','t','y'},
+    {'p','a','u','s','e'},
+    {'p','a','y','e','e'},
+    {'p','a','y','e','r'},
+    {'p','e','a','c','e'},
+    {'p','e','a','c','h'},
+    {'p','e','a','r','l'},
+    {'p','e','c','a','n'},
+    {'p','e','d','a','l'},
+    {'p','e','n','a','l'},
+    {'p','e','n','c','e'},
+    {'p','e','n','n','e'},
+    {'p','e','n','n','y'},
+    {'p','e','r','c','h'},
+    {'p','e','r','i','l'},
+    {'p','e','r','k','y'},
+    {'p','e','s','k','y'},
+    {'p','e','s','t','o'},
+    {'p','e','t','a','l'},
+    {'p','e','t','t','y'},
+    {'p','h','a','s','e'},
+    {'p','h','o','n','e'},
+    {'p','h','o','n','y'},
+    {'p','h','o','t','o'},
+    {'p','i','a','n','o'},
+    {'p','i','c','k','y'},
+    {'p','i','e','c','e'},
+    {'p','i','e','t','y'},
+    {'p','i','g','g','y'},
+    {'p','i','l','o','t'},
+    {'p','i','n','c','h'},
+    {'p','i','n','e','y'},
+    {'p','i','n','k','y'},
+    {'p','i','n','t','o'},
+    {'p','i','p','e','r'},
+    {'p','i','q','u','e'},
+    {'p','i','t','c','h'},
+    {'p','i','t','h','y'},
+    {'p','i','v','o','t'},
+    {'p','i','x','e','l'},
+    {'p','i','x','i','e'},
+    {'p','i','z','z','a'},
+    {'p','l','a','c','e'},
+    {'p','l','a','i','d'},
+    {'p','l','a','i','n'},
+    {'p','l','a','i','t'},
+    {'p','l','a','n','e'},
+    {'p','l','a','n','k'},
+    {'p','l','a','n','t'},
+    {'p','l','a','t','e'},
+    {'p','l','a','z','a'},
+    {'p','l','e','a','d'},
+    {'p','l','e','a','t'},
+    {'p','l','i','e','d'},
+    {'p','l','i','e','r'},
+    {'p','l','u','c','k'},
+    {'p','l','u','m','b'},
+    {'p','l','u','m','e'},
+    {'p','l','u','m','p'},
+    {'p','l','u','n','k'},
+    {'p','l','u','s','h'},
+    {'p','o','e','s','y'},
+    {'p','o','i','n','t'},
+    {'p','o','i','s','e'},
+    {'p','o','k','e','r'},
+    {'p','o','l','a','r'},
+    {'p','o','l','k','a'},
+    {'p','o','l','y','p'},
+    {'p','o','o','c','h'},
+    {'p','o','p','p','y'},
+    {'p','o','r','c','h'},
+    {'p','o','s','e','r'},
+    {'p','o','s','i','t'},
+    {'p','o','s','s','e'},
+    {'p','o','u','c','h'},
+    {'p','o','u','n','d'},
+    {'p','o','u','t','y'},
+    {'p','o','w','e','r'},
+    {'p','r','a','n','k'},
+    {'p','r','a','w','n'},
+    {'p','r','e','e','n'},
+    {'p','r','e','s','s'},
+    {'p','r','i','c','e'},
+    {'p','r','i','c','k'},
+    {'p','r','i','d','e'},
+    {'p','r','i','e','d'},
+    {'p','r','i','m','e'},
+    {'p','r','i','m','o'},
+    {'p','r','i','n','t'},
+    {'p','r','i','o','r'},
+    {'p','r','i','s','m'},
+    {'p','r','i','v','y'},
+    {'p','r','i','z','e'},
+    {'p','r','o','b','e'},
+    {'p','r','o','n','e'},
+    {'p','r','o','n','g'},
+    {'p','r','o','o','f'},
+    {'p','r','o','s','e'},
+    {'p','r','o','u','d'},
+    {'p','r','o','v','e'},
+    {'p','r','o','w','l'},
+    {'p','r','o','x','y'},
+    {'p','r','u','d','e'},
+    {'p','r','u','n','e'},
+    {'p','s','a','l','m'},
+    {'p','u','b','i','c'},
+    {'p','u','d','g','y'},
+    {'p','u','f','f','y'},
+    {'p','u','l','p','y'},
+    {'p','u','l','s','e'},
+    {'p','u','n','c','h'},
+    {'p','u','p','a','l'},
+    {'p','u','p','i','l'},
+    {'p','u','p','p','y'},
+    {'p','u','r','e','e'},
+    {'p','u','r','e','r'},
+    {'p','u','r','g','e'},
+    {'p','u','r','s','e'},
+    {'p','u','s','h','y'},
+    {'p','u','t','t','y'},
+    {'p','y','g','m','y'},
+    {'q','u','a','c','k'},
+    {'q','u','a','i','l'},
+    {'q','u','a','k','e'},
+    {'q','u','a','l','m'},
+    {'q','u','a','r','k'},
+    {'q','u','a','r','t'},
+    {'q','u','a','s','h'},
+    {'q','u','a','s','i'},
+    {'q','u','e','e','n'},
+    {'q','u','e','e','r'},
+    {'q','u','e','l','l'},
+    {'q','u','e','r','y'},
+    {'q','u','e','s','t'},
+    {'q','u','e','u','e'},
+    {'q','u','i','c','k'},
+    {'q','u','i','e','t'},
+    {'q','u','i','l','l'},
+    {'q','u','i','l','t'},
+    {'q','u','i','r','k'},
+    {'q','u','i','t','e'},
+    {'q','u','o','t','a'},
+    {'q','u','o','t','e'},
+    {'q','u','o','t','h'},
+    {'r','a','b','b','i'},
+    {'r','a','b','i','d'},
+    {'r','a','c','e','r'},
+    {'r','a','d','a','r'},
+    {'r','a','d','i','i'},
+    {'r','a','d','i','o'},
+    {'r','a','i','n','y'},
+    {'r','a','i','s','e'},
+    {'r','a','j','a','h'},
+    {'r','a','l','l','y'},
+    {'r','a','l','p','h'},
+    {'r','a','m','e','n'},
+    {'r','a','n','c','h'},
+    {'r','a','n','d','y'},
+    {'r','a','n','g','e'},
+    {'r','a','p','i','d'},
+    {'r','a','r','e','r'},
+    {'r','a','s','p','y'},
+    {'r','a','t','i','o'},
+    {'r','a','t','t','y'},
+    {'r','a','v','e','n'},
+    {'r','a','y','o','n'},
+    {'r','a','z','o','r'},
+    {'r','e','a','c','h'},
+    {'r','e','a','c','t'},
+    {'r','e','a','d','y'},
+    {'r','e','a','l','m'},
+    {'r','e','a','r','m'},
+    {'r','e','b','a','r'},
+    {'r','e','b','e','l'},
+    {'r','e','b','u','s'},
+    {'r','e','b','u','t'},
+    {'r','e','c','a','p'},
+    {'r','e','c','u','r'},
+    {'r','e','c','u','t'},
+    {'r','e','e','d','y'},
+    {'r','e','f','e','r'},
+    {'r','e','f','i','t'},
+    {'r','e','g','a','l'},
+    {'r','e','h','a','b'},
+    {'r','e','i','g','n'},
+    {'r','e','l','a','x'},
+    {'r','e','l','a','y'},
+    {'r','e','l','i','c'},
+    {'r','e','m','i','t'},
+    {'r','e','n','a','l'},
+    {'r','e','n','e','w'},
+    {'r','e','p','a','y'},
+    {'r','e','p','e','l'},
+    {'r','e','p','l','y'},
+    {'r','e','r','u','n'},
+    {'r','e','s','e','t'},
+    {'r','e','s','i','n'},
+    {'r','e','t','c','h'},
+    {'r','e','t','r','o'},
+    {'r','e','t','r','y'},
+    {'r','e','u','s','e'},
+    {'r','e','v','e','l'},
+    {'r','e','v','u','e'},
+    {'r','h','i','n','o'},
+    {'r','h','y','m','e'},
+    {'r','i','d','e','r'},
+    {'r','i','d','g','e'},
+    {'r','i','f','l','e'},
+    {'r','i','g','h','t'},
+    {'r','i','g','i','d'},
+    {'r','i','g','o','r'},
+    {'r','i','n','s','e'},
+    {'r','i','p','e','n'},
+    {'r','i','p','e','r'},
+    {'r','i','s','e','n'},
+    {'r','i','s','e','r'},
+    {'r','i','s','k','y'},
+    {'r','i','v','a','l'},
+    {'r','i','v','e','r'},
+    {'r','i','v','e','t'},
+    {'r','o','a','c','h'},
+    {'r','o','a','s','t'},
+    {'r','o','b','i','n'},
+    {'r','o','b','o','t'},
+    {'r','o','c','k','y'},
+    {'r','o','d','e','o'},
+    {'r','o','g','e','r'},
+    {'r','o','g','u','e'},
+    {'r','o','o','m','y'},
+    {'r','o','o','s','t'},
+    {'r','o','t','o','r'},
+    {'r','o','u','g','e'},
+    {'r','o','u','g','h'},
+    {'r','o','u','n','d'},
+    {'r','o','u','s','e'},
+    {'r','o','u','t','e'},
+    {'r','o','v','e','r'},
+    {'r','o','w','d','y'},
+    {'r','o','w','e','r'},
+    {'r','o','y','a','l'},
+    {'r','u','d','d','y'},
+    {'r','u','d','e','r'},
+    {'r','u','g','b','y'},
+    {'r','u','l','e','r'},
+    {'r','u','m','b','a'},
+    {'r','u','m','o','r'},
+    {'r','u','p','e','e'},
+    {'r','u','r','a','l'},
+    {'r','u','s','t','y'},
+    {'s','a','d','l','y'},
+    {'s','a','f','e','r'},
+    {'s','a','i','n','t'},
+    {'s','a','l','a','d'},
+    {'s','a','l','l','y'},
+    {'s','a','l','o','n'},
+    {'s','a','l','s','a'},
+    {'s','a','l','t','y'},
+    {'s','a','l','v','e'},
+    {'s','a','l','v','o'},
+    {'s','a','n','d','y'},
+    {'s','a','n','e','r'},
+    {'s','a','p','p','y'},
+    {'s','a','s','s','y'},
+    {'s','a','t','i','n'},
+    {'s','a','t','y','r'},
+    {'s','a','u','c','e'},
+    {'s','a','u','c','y'},
+    {'s','a','u','n','a'},
+    {'s','a','u','t','e'},
+    {'s','a','v','o','r'},
+    {'s','a','v','o','y'},
+    {'s','a','v','v','y'},
+    {'s','c','a','l','d'},
+    {'s','c','a','l','e'},
+    {'s','c','a','l','p'},
+    {'s','c','a','l','y'},
+    {'s','c','a','m','p'},
+    {'s','c','a','n','t'},
+    {'s','c','a','r','e'},
+    {'s','c','a','r','f'},
+    {'s','c','a','r','y'},
+    {'s','c','e','n','e'},
+    {'s','c','e','n','t'},
+    {'s','c','i','o','n'},
+    {'s','c','o','f','f'},
+    {'s','c','o','l','d'},
+    {'s','c','o','n','e'},
+    {'s','c','o','o','p'},
+    {'s','c','o','p','e'},
+    {'s','c','o','r','e'},
+    {'s','c','o','r','n'},
+    {'s','c','o','u','r'},
+    {'s','c','o','u','t'},
+    {'s','c','o','w','l'},
+    {'s','c','r','a','m'},
+    {'s','c','r','a','p'},
+    {'s','c','r','e','e'},
+    {'s','c','r','e','w'},
+    {'s','c','r','u','b'},
+    {'s','c','r','u','m'},
+    {'s','c','u','b','a'},
+    {'s','e','d','a','n'},
+    {'s','e','e','d','y'},
+    {'s','e','g','u','e'},
+    {'s','e','i','z','e'},
+    {'s','e','m','e','n'},
+    {'s','e','n','s','e'},
+    {'s','e','p','i','a'},
+    {'s','e','r','i','f'},
+    {'s','e','r','u','m'},
+    {'s','e','r','v','e'},
+    {'s','e','t','u','p'},
+    {'s','e','v','e','n'},
+    {'s','e','v','e','r'},
+    {'s','e','w','e','r'},
+    {'s','h','a','c','k'},
+    {'s','h','a','d','e'},
+    {'s','h','a','d','y'},
+    {'s','h','a','f','t'},
+    {'s','h','a','k','e'},
+    {'s','h','a','k','y'},
+    {'s','h','a','l','e'},
+    {'s','h','a','l','l'},
+    {'s','h','a','l','t'},
+    {'s','h','a','m','e'},
+    {'s','h','a','n','k'},
+    {'s','h','a','p','e'},
+    {'s','h','a','r','d'},
+    {'s','h','a','r','e'},
+    {'s','h','a','r','k'},
+    {'s','h','a','r','p'},
+    {'s','h','a','v','e'},
+    {'s','h','a','w','l'},
+    {'s','h','e','a','r'},
+    {'s','h','e','e','n'},
+    {'s','h','e','e','p'},
+    {'s','h','e','e','r'},
+    {'s','h','e','e','t'},
+    {'s','h','e','i','k'},
+    {'s','h','e','l','f'},
+    {'s','h','e','l','l'},
+    {'s','h','i','e','d'},
+    {'s','h','i','f','t'},
+    {'s','h','i','n','e'},
+    {'s','h','i','n','y'},
+    {'s','h','i','r','e'},
+    {'s','h','i','r','k'},
+    {'s','h','i','r','t'},
+    {'s','h','o','a','l'},
+    {'s','h','o','c','k'},
+    {'s','h','o','n','e'},
+    {'s','h','o','o','k'},
+    {'s','h','o','o','t'},
+    {'s','h','o','r','e'},
+    {'s','h','o','r','n'},
+    {'s','h','o','r','t'},
+    {'s','h','o','u','t'},
+    {'s','h','o','v','e'},
+    {'s','h','o','w','n'},
+    {'s','h','o','w','y'},
+    {'s','h','r','e','w'},
+    {'s','h','r','u','b'},
+    {'s','h','r','u','g'},
+    {'s','h','u','c','k'},
+    {'s','h','u','n','t'},
+    {'s','h','u','s','h'},
+    {'s','h','y','l','y'},
+    {'s','i','e','g','e'},
+    {'s','i','e','v','e'},
+    {'s','i','g','h','t'},
+    {'s','i','g','m','a'},
+    {'s','i','l','k','y'},
+    {'s','i','l','l','y'},
+    {'s','i','n','c','e'},
+    {'s','i','n','e','w'},
+    {'s','i','n','g','e'},
+    {'s','i','r','e','n'},
+    {'s','i','s','s','y'},
+    {'s','i','x','t','h'},
+    {'s','i','x','t','y'},
+    {'s','k','a','t','e'},
+    {'s','k','i','e','r'},
+    {'s','k','i','f','f'},
+    {'s','k','i','l','l'},
+    {'s','k','i','m','p'},
+    {'s','k','i','r','t'},
+    {'s','k','u','l','k'},
+    {'s','k','u','l','l'},
+    {'s','k','u','n','k'},
+    {'s','l','a','c','k'},
+    {'s','l','a','i','n'},
+    {'s','l','a','n','g'},
+    {'s','l','a','n','t'},
+    {'s','l','a','s','h'},
+    {'s','l','a','t','e'},
+    {'s','l','a','v','e'},
+    {'s','l','e','e','k'},
+    {'s','l','e','e','p'},
+    {'s','l','e','e','t'},
+    {'s','l','e','p','t'},
+    {'s','l','i','c','e'},
+    {'s','l','i','c','k'},
+    {'s','l','i','d','e'},
+    {'s','l','i','m','e'},
+    {'s','l','i','m','y'},
+    {'s','l','i','n','g'},
+    {'s','l','i','n','k'},
+    {'s','l','o','o','p'},
+    {'s','l','o','p','e'},
+    {'s','l','o','s','h'},
+    {'s','l','o','t','h'},
+    {'s','l','u','m','p'},
+    {'s','l','u','n','g'},
+    {'s','l','u','n','k'},
+    {'s','l','u','r','p'},
+    {'s','l','u','s','h'},
+    {'s','l','y','l','y'},
+    {'s','m','a','c','k'},
+    {'s','m','a','l','l'},
+    {'s','m','a','r','t'},
+    {'s','m','a','s','h'},
+    {'s','m','e','a','r'},
+    {'s','m','e','l','l'},
+    {'s','m','e','l','t'},
+    {'s','m','i','l','e'},
+    {'s','m','i','r','k'},
+    {'s','m','i','t','e'},
+    {'s','m','i','t','h'},
+    {'s','m','o','c','k'},
+    {'s','m','o','k','e'},
+    {'s','m','o','k','y'},
+    {'s','m','o','t','e'},
+    {'s','n','a','c','k'},
+    {'s','n','a','i','l'},
+    {'s','n','a','k','e'},
+    {'s','n','a','k','y'},
+    {'s','n','a','r','e'},
+    {'s','n','a','r','l'},
+    {'s','n','e','a','k'},
+    {'s','n','e','e','r'},
+    {'s','n','i','d','e'},
+    {'s','n','i','f','f'},
+    {'s','n','i','p','e'},
+    {'s','n','o','o','p'},
+    {'s','n','o','r','e'},
+    {'s','n','o','r','t'},
+    {'s','n','o','u','t'},
+    {'s','n','o','w','y'},
+    {'s','n','u','c','k'},
+    {'s','n','u','f','f'},
+    {'s','o','a','p','y'},
+    {'s','o','b','e','r'},
+    {'s','o','g','g','y'},
+    {'s','o','l','a','r'},
+    {'s','o','l','i','d'},
+    {'s','o','l','v','e'},
+    {'s','o','n','a','r'},
+    {'s','o','n','i','c'},
+    {'s','o','o','t','h'},
+    {'s','o','o','t','y'},
+    {'s','o','r','r','y'},
+    {'s','o','u','n','d'},
+    {'s','o','u','t','h'},
+    {'s','o','w','e','r'},
+    {'s','p','a','c','e'},
+    {'s','p','a','d','e'},
+    {'s','p','a','n','k'},
+    {'s','p','a','r','e'},
+    {'s','p','a','r','k'},
+    {'s','p','a','s','m'},
+    {'s','p','a','w','n'},
+    {'s','p','e','a','k'},
+    {'s','p','e','a','r'},
+    {'s','p','e','c','k'},
+    {'s','p','e','e','d'},
+    {'s','p','e','l','l'},
+    {'s','p','e','l','t'},
+    {'s','p','e','n','d'},
+    {'s','p','e','n','t'},
+    {'s','p','e','r','m'},
+    {'s','p','i','c','e'},
+    {'s','p','i','c','y'},
+    {'s','p','i','e','d'},
+    {'s','p','i','e','l'},
+    {'s','p','i','k','e'},
+    {'s','p','i','k','y'},
+    {'s','p','i','l','l'},
+    {'s','p','i','l','t'},
+    {'s','p','i','n','e'},
+    {'s','p','i','n','y'},
+    {'s','p','i','r','e'},
+    {'s','p','i','t','e'},
+    {'s','p','l','a','t'},
+    {'s','p','l','i','t'},
+    {'s','p','o','i','l'},
+    {'s','p','o','k','e'},
+    {'s','p','o','o','f'},
+    {'s','p','o','o','k'},
+    {'s','p','o','o','l'},
+    {'s','p','o','o','n'},
+    {'s','p','o','r','e'},
+    {'s','p','o','r','t'},
+    {'s','p','o','u','t'},
+    {'s','p','r','a','y'},
+    {'s','p','r','e','e'},
+    {'s','p','r','i','g'},
+    {'s','p','u','n','k'},
+    {'s','p','u','r','n'},
+    {'s','p','u','r','t'},
+    {'s','q','u','a','d'},
+    {'s','q','u','a','t'},
+    {'s','q','u','i','b'},
+    {'s','t','a','c','k'},
+    {'s','t','a','f','f'},
+    {'s','t','a','g','e'},
+    {'s','t','a','i','d'},
+    {'s','t','a','i','n'},
+    {'s','t','a','i','r'},
+    {'s','t','a','k','e'},
+    {'s','t','a','l','e'},
+    {'s','t','a','l','k'},
+    {'s','t','a','l','l'},
+    {'s','t','a','m','p'},
+    {'s','t','a','n','d'},
+    {'s','t','a','n','k'},
+    {'s','t','a','r','e'},
+    {'s','t','a','r','k'},
+    {'s','t','a','r','t'},
+    {'s','t','a','s','h'},
+    {'s','t','a','t','e'},
+    {'s','t','a','v','e'},
+    {'s','t','e','a','d'},
+    {'s','t','e','a','k'},
+    {'s','t','e','a','l'},
+    {'s','t','e','a','m'},
+    {'s','t','e','e','d'},
+    {'s','t','e','e','l'},
+    {'s','t','e','e','p'},
+    {'s','t','e','e','r'},
+    {'s','t','e','i','n'},
+    {'s','t','e','r','n'},
+    {'s','t','i','c','k'},
+    {'s','t','i','f','f'},
+    {'s','t','i','l','l'},
+    {'s','t','i','l','t'},
+    {'s','t','i','n','g'},
+    {'s','t','i','n','k'},
+    {'s','t','i','n','t'},
+    {'s','t','o','c','k'},
+    {'s','t','o','i','c'},
+    {'s','t','o','k','e'},
+    {'s','t','o','l','e'},
+    {'s','t','o','m','p'},
+    {'s','t','o','n','e'},
+    {'s','t','o','n','y'},
+    {'s','t','o','o','d'},
+    {'s','t','o','o','l'},
+    {'s','t','o','o','p'},
+    {'s','t','o','r','e'},
+    {'s','t','o','r','k'},
+    {'s','t','o','r','m'},
+    {'s','t','o','r','y'},
+    {'s','t','o','u','t'},
+    {'s','t','o','v','e'},
+    {'s','t','r','a','p'},
+    {'s','t','r','a','w'},
+    {'s','t','r','a','y'},
+    {'s','t','r','i','p'},
+    {'s','t','r','u','t'},
+    {'s','t','u','c','k'},
+    {'s','t','u','d','y'},
+    {'s','t','u','f','f'},
+    {'s','t','u','m','p'},
+    {'s','t','u','n','g'},
+    {'s','t','u','n','k'},
+    {'s','t','u','n','t'},
+    {'s','t','y','l','e'},
+    {'s','u','a','v','e'},
+    {'s','u','g','a','r'},
+    {'s','u','i','n','g'},
+    {'s','u','i','t','e'},
+    {'s','u','l','k','y'},
+    {'s','u','l','l','y'},
+    {'s','u','m','a','c'},
+    {'s','u','n','n','y'},
+    {'s','u','p','e','r'},
+    {'s','u','r','e','r'},
+    {'s','u','r','g','e'},
+    {'s','u','r','l','y'},
+    {'s','u','s','h','i'},
+    {'s','w','a','m','i'},
+    {'s','w','a','m','p'},
+    {'s','w','a','r','m'},
+    {'s','w','a','s','h'},
+    {'s','w','a','t','h'},
+    {'s','w','e','a','r'},
+    {'s','w','e','a','t'},
+    {'s','w','e','e','p'},
+    {'s','w','e','e','t'},
+    {'s','w','e','l','l'},
+    {'s','w','e','p','t'},
+    {'s','w','i','f','t'},
+    {'s','w','i','l','l'},
+    {'s','w','i','n','e'},
+    {'s','w','i','n','g'},
+    {'s','w','i','r','l'},
+    {'s','w','i','s','h'},
+    {'s','w','o','o','n'},
+    {'s','w','o','o','p'},
+    {'s','w','o','r','d'},
+    {'s','w','o','r','e'},
+    {'s','w','o','r','n'},
+    {'s','w','u','n','g'},
+    {'s','y','n','o','d'},
+    {'s','y','r','u','p'},
+    {'t','a','b','b','y'},
+    {'t','a','b','l','e'},
+    {'t','a','b','o','o'},
+    {'t','a','c','i','t'},
+    {'t','a','c','k','y'},
+    {'t','a','f','f','y'},
+    {'t','a','i','n','t'},
+    {'t','a','k','e','n'},
+    {'t','a','k','e','r'},
+    {'t','a','l','l','y'},
+    {'t','a','l','o','n'},
+    {'t','a','m','e','r'},
+    {'t','a','n','g','o'},
+    {'t','a','n','g','y'},
+    {'t','a','p','e','r'},
+    {'t','a','p','i','r'},
+    {'t','a','r','d','y'},
+    {'t','a','r','o','t'},
+    {'t','a','s','t','e'},
+    {'t','a','s','t','y'},
+    {'t','a','t','t','y'},
+    {'t','a','u','n','t'},
+    {'t','a','w','n','y'},
+    {'t','e','a','c','h'},
+    {'t','e','a','r','y'},
+    {'t','e','a','s','e'},
+    {'t','e','d','d','y'},
+    {'t','e','e','t','h'},
+    {'t','e','m','p','o'},
+    {'t','e','n','e','t'},
+    {'t','e','n','o','r'},
+    {'t','e','n','s','e'},
+    {'t','e','n','t','h'},
+    {'t','e','p','e','e'},
+    {'t','e','p','i','d'},
+    {'t','e','r','r','a'},
+    {'t','e','r','s','e'},
+    {'t','e','s','t','y'},
+    {'t','h','a','n','k'},
+    {'t','h','e','f','t'},
+    {'t','h','e','i','r'},
+    {'t','h','e','m','e'},
+    {'t','h','e','r','e'},
+    {'t','h','e','s','e'},
+    {'t','h','e','t','a'},
+    {'t','h','i','c','k'},
+    {'t','h','i','e','f'},
+    {'t','h','i','g','h'},
+    {'t','h','i','n','g'},
+    {'t','h','i','n','k'},
+    {'t','h','i','r','d'},
+    {'t','h','o','n','g'},
+    {'t','h','o','r','n'},
+    {'t','h','o','s','e'},
+    {'t','h','r','e','e'},
+    {'t','h','r','e','w'},
+    {'t','h','r','o','b'},
+    {'t','h','r','o','w'},
+    {'t','h','r','u','m'},
+    {'t','h','u','m','b'},
+    {'t','h','u','m','p'},
+    {'t','h','y','m','e'},
+    {'t','i','a','r','a'},
+    {'t','i','b','i','a'},
+    {'t','i','d','a','l'},
+    {'t','i','g','e','r'},
+    {'t','i','g','h','t'},
+    {'t','i','l','d','e'},
+    {'t','i','m','e','r'},
+    {'t','i','m','i','d'},
+    {'t','i','p','s','y'},
+    {'t','i','t','a','n'},
+    {'t','i','t','h','e'},
+    {'t','i','t','l','e'},
+    {'t','o','a','s','t'},
+    {'t','o','d','a','y'},
+    {'t','o','d','d','y'},
+    {'t','o','k','e','n'},
+    {'t','o','n','a','l'},
+    {'t','o','n','g','a'},
+    {'t','o','n','i','c'},
+    {'t','o','o','t','h'},
+    {'t','o','p','a','z'},
+    {'t','o','p','i','c'},
+    {'t','o','r','c','h'},
+    {'t','o','r','s','o'},
+    {'t','o','r','u','s'},
+    {'t','o','t','a','l'},
+    {'t','o','t','e','m'},
+    {'t','o','u','c','h'},
+    {'t','o','u','g','h'},
+    {'t','o','w','e','l'},
+    {'t','o','w','e','r'},
+    {'t','o','x','i','c'},
+    {'t','o','x','i','n'},
+    {'t','r','a','c','e'},
+    {'t','r','a','c','k'},
+    {'t','r','a','c','t'},
+    {'t','r','a','d','e'},
+    {'t','r','a','i','l'},
+    {'t','r','a','i','n'},
+    {'t','r','a','i','t'},
+    {'t','r','a','m','p'},
+    {'t','r','a','s','h'},
+    {'t','r','a','w','l'},
+    {'t','r','e','a','d'},
+    {'t','r','e','a','t'},
+    {'t','r','e','n','d'},
+    {'t','r','i','a','d'},
+    {'t','r','i','a','l'},
+    {'t','r','i','b','e'},
+    {'t','r','i','c','e'},
+    {'t','r','i','c','k'},
+    {'t','r','i','e','d'},
+    {'t','r','i','p','e'},
+    {'t','r','i','t','e'},
+    {'t','r','o','l','l'},
+    {'t','r','o','o','p'},
+    {'t','r','o','p','e'},
+    {'t','r','o','u','t'},
+    {'t','r','o','v','e'},
+    {'t','r','u','c','e'},
+    {'t','r','u','c','k'},
+    {'t','r','u','e','r'},
+    {'t','r','u','l','y'},
+    {'t','r','u','m','p'},
+    {'t','r','u','n','k'},
+    {'t','r','u','s','s'},
+    {'t','r','u','s','t'},
+    {'t','r','u','t','h'},
+    {'t','r','y','s','t'},
+    {'t','u','b','a','l'},
+    {'t','u','b','e','r'},
+    {'t','u','l','i','p'},
+    {'t','u','l','l','e'},
+    {'t','u','m','o','r'},
+    {'t','u','n','i','c'},
+    {'t','u','r','b','o'},
+    {'t','u','t','o','r'},
+    {'t','w','a','n','g'},
+    {'t','w','e','a','k'},
+    {'t','w','e','e','d'},
+    {'t','w','e','e','t'},
+    {'t','w','i','c','e'},
+    {'t','w','i','n','e'},
+    {'t','w','i','r','l'},
+    {'t','w','i','s','t'},
+    {'t','w','i','x','t'},
+    {'t','y','i','n','g'},
+    {'u','d','d','e','r'},
+    {'u','l','c','e','r'},
+    {'u','l','t','r','a'},
+    {'u','m','b','r','a'},
+    {'u','n','c','l','e'},
+    {'u','n','c','u','t'},
+    {'u','n','d','e','r'},
+    {'u','n','d','i','d'},
+    {'u','n','d','u','e'},
+    {'u','n','f','e','d'},
+    {'u','n','f','i','t'},
+    {'u','n','i','f','y'},
+    {'u','n','i','o','n'},
+    {'u','n','i','t','e'},
+    {'u','n','i','t','y'},
+    {'u','n','l','i','t'},
+    {'u','n','m','e','t'},
+    {'u','n','s','e','t'},
+    {'u','n','t','i','e'},
+    {'u','n','t','i','l'},
+    {'u','n','w','e','d'},
+    {'u','n','z','i','p'},
+    {'u','p','p','e','r'},
+    {'u','p','s','e','t'},
+    {'u','r','b','a','n'},
+    {'u','r','i','n','e'},
+    {'u','s','a','g','e'},
+    {'u','s','h','e','r'},
+    {'u','s','i','n','g'},
+    {'u','s','u','a','l'},
+    {'u','s','u','r','p'},
+    {'u','t','i','l','e'},
+    {'u','t','t','e','r'},
+    {'v','a','g','u','e'},
+    {'v','a','l','e','t'},
+    {'v','a','l','i','d'},
+    {'v','a','l','o','r'},
+    {'v','a','l','u','e'},
+    {'v','a','l','v','e'},
+    {'v','a','p','i','d'},
+    {'v','a','p','o','r'},
+    {'v','a','u','l','t'},
+    {'v','a','u','n','t'},
+    {'v','e','g','a','n'},
+    {'v','e','n','o','m'},
+    {'v','e','n','u','e'},
+    {'v','e','r','g','e'},
+    {'v','e','r','s','e'},
+    {'v','e','r','s','o'},
+    {'v','e','r','v','e'},
+    {'v','i','c','a','r'},
+    {'v','i','d','e','o'},
+    {'v','i','g','i','l'},
+    {'v','i','g','o','r'},
+    {'v','i','l','l','a'},
+    {'v','i','n','y','l'},
+    {'v','i','o','l','a'},
+    {'v','i','p','e','r'},
+    {'v','i','r','a','l'},
+    {'v','i','r','u','s'},
+    {'v','i','s','i','t'},
+    {'v','i','s','o','r'},
+    {'v','i','s','t','a'},
+    {'v','i','t','a','l'},
+    {'v','i','v','i','d'},
+    {'v','i','x','e','n'},
+    {'v','o','c','a','l'},
+    {'v','o','d','k','a'},
+    {'v','o','g','u','e'},
+    {'v','o','i','c','e'},
+    {'v','o','i','l','a'},
+    {'v','o','m','i','t'},
+    {'v','o','t','e','r'},
+    {'v','o','u','c','h'},
+    {'v','o','w','e','l'},
+    {'v','y','i','n','g'},
+    {'w','a','c','k','y'},
+    {'w','a','f','e','r'},
+    {'w','a','g','e','r'},
+    {'w','a','g','o','n'},
+    {'w','a','i','s','t'},
+    {'w','a','i','v','e'},
+    {'w','a','l','t','z'},
+    {'w','a','r','t','y'},
+    {'w','a','s','t','e'},
+    {'w','a','t','c','h'},
+    {'w','a','t','e','r'},
+    {'w','a','v','e','r'},
+    {'w','a','x','e','n'},
+    {'w','e','a','r','y'},
+    {'w','e','a','v','e'},
+    {'w','e','d','g','e'},
+    {'w','e','e','d','y'},
+    {'w','e','i','g','h'},
+    {'w','e','i','r','d'},
+    {'w','e','l','c','h'},
+    {'w','e','l','s','h'},
+    {'w','e','n','c','h'},
+    {'w','h','a','c','k'},
+    {'w','h','a','l','e'},
+    {'w','h','a','r','f'},
+    {'w','h','e','a','t'},
+    {'w','h','e','e','l'},
+    {'w','h','e','l','p'},
+    {'w','h','e','r','e'},
+    {'w','h','i','c','h'},
+    {'w','h','i','f','f'},
+    {'w','h','i','l','e'},
+    {'w','h','i','n','e'},
+    {'w','h','i','n','y'},
+    {'w','h','i','r','l'},
+    {'w','h','i','s','k'},
+    {'w','h','i','t','e'},
+    {'w','h','o','l','e'},
+    {'w','h','o','o','p'},
+    {'w','h','o','s','e'},
+    {'w','i','d','e','n'},
+    {'w','i','d','e','r'},
+    {'w','i','d','o','w'},
+    {'w','i','d','t','h'},
+    {'w','i','e','l','d'},
+    {'w','i','g','h','t'},
+    {'w','i','l','l','y'},
+    {'w','i','m','p','y'},
+    {'w','i','n','c','e'},
+    {'w','i','n','c','h'},
+    {'w','i','n','d','y'},
+    {'w','i','s','e','r'},
+    {'w','i','s','p','y'},
+    {'w','i','t','c','h'},
+    {'w','i','t','t','y'},
+    {'w','o','k','e','n'},
+    {'w','o','m','a','n'},
+    {'w','o','m','e','n'},
+    {'w','o','o','d','y'},
+    {'w','o','o','e','r'},
+    {'w','o','o','l','y'},
+    {'w','o','o','z','y'},
+    {'w','o','r','d','y'},
+    {'w','o','r','l','d'},
+    {'w','o','r','r','y'},
+    {'w','o','r','s','e'},
+    {'w','o','r','s','t'},
+    {'w','o','r','t','h'},
+    {'w','o','u','l','d'},
+    {'w','o','u','n','d'},
+    {'w','o','v','e','n'},
+    {'w','r','a','c','k'},
+    {'w','r','a','t','h'},
+    {'w','r','e','a','k'},
+    {'w','r','e','c','k'},
+    {'w','r','e','s','t'},
+    {'w','r','i','n','g'},
+    {'w','r','i','s','t'},
+    {'w','r','i','t','e'},
+    {'w','r','o','n','g'},
+    {'w','r','o','t','e'},
+    {'w','r','u','n','g'},
+    {'w','r','y','l','y'},
+    {'y','a','c','h','t'},
+    {'y','e','a','r','n'},
+    {'y','e','a','s','t'},
+    {'y','i','e','l','d'},
+    {'y','o','u','n','g'},
+    {'y','o','u','t','h'},
+    {'z','e','b','r','a'},
+    {'z','e','s','t','y'},
+    {'z','o','n','a','l'}
 };
 
 const size_t ALL_WORD_COUNT = sizeof(ALL_WORDS)/sizeof(ALL_WORDS[0]);
 
-inline std::vector<std::string> get_all_solutions() {
-    return std::vector<std::string>(ALL_WORDS, ALL_WORDS + ALL_WORD_COUNT);
-}
-
 const size_t VALID_WORD_COUNT = sizeof(VALID_WORDS)/sizeof(VALID_WORDS[0]);
 
-inline std::vector<std::string> get_valid_solutions() {
-    return std::vector<std::string>(VALID_WORDS, VALID_WORDS + VALID_WORD_COUNT);
-}
-
 #endif
\ No newline at end of file